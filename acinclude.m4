@@ -4,7 +4,13 @@ dnl Version: 20240501
 
 dnl Function to detect if libfwevt dependencies are available
 AC_DEFUN([AX_LIBFWEVT_CHECK_LOCAL],
-  [dnl No additional checks.
+  [dnl Headers and functions included in libfwevt/libfwevt_file_mapping.c
+  AS_IF(
+    [test "x$ac_cv_enable_winapi" = xno],
+    [AC_CHECK_HEADERS([errno.h fcntl.h sys/mman.h sys/stat.h unistd.h])
+
+    AC_CHECK_FUNCS([close fstat mmap munmap open])
+    ])
   ])
 
 dnl Function to check if DLL support is needed
@@ -0,0 +1,117 @@
+/*
+ * The manifest archive file definitions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _FWEVT_MANIFEST_ARCHIVE_H )
+#define _FWEVT_MANIFEST_ARCHIVE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct fwevt_manifest_archive_header fwevt_manifest_archive_header_t;
+
+struct fwevt_manifest_archive_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * Contains: "FWEVTARC"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The file size
+	 * Consists of 4 bytes
+	 */
+	uint8_t file_size[ 4 ];
+
+	/* The number of manifests
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_manifests[ 4 ];
+
+	/* The manifests table offset
+	 * Consists of 4 bytes
+	 */
+	uint8_t manifests_table_offset[ 4 ];
+
+	/* The number of provider index slots
+	 * Consists of 4 bytes
+	 * Contains a power of 2
+	 */
+	uint8_t number_of_index_slots[ 4 ];
+
+	/* The provider index offset
+	 * Consists of 4 bytes
+	 */
+	uint8_t index_offset[ 4 ];
+};
+
+typedef struct fwevt_manifest_archive_manifest_entry fwevt_manifest_archive_manifest_entry_t;
+
+struct fwevt_manifest_archive_manifest_entry
+{
+	/* The data offset
+	 * Consists of 4 bytes
+	 * Contains the offset of the unmodified manifest (CRIM) data
+	 */
+	uint8_t data_offset[ 4 ];
+
+	/* The data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t data_size[ 4 ];
+};
+
+typedef struct fwevt_manifest_archive_index_entry fwevt_manifest_archive_index_entry_t;
+
+struct fwevt_manifest_archive_index_entry
+{
+	/* The provider identifier
+	 * Consists of 16 bytes
+	 * Contains a GUID
+	 */
+	uint8_t identifier[ 16 ];
+
+	/* The manifest index
+	 * Consists of 4 bytes
+	 * Contains 0xffffffff if the slot is not used
+	 */
+	uint8_t manifest_index[ 4 ];
+
+	/* The provider index
+	 * Consists of 4 bytes
+	 */
+	uint8_t provider_index[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _FWEVT_MANIFEST_ARCHIVE_H ) */
+
@@ -0,0 +1,318 @@
+/*
+ * Arena allocator functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwevt_arena.h"
+#include "libfwevt_libcerror.h"
+
+/* The alignment of the allocations
+ */
+#define LIBFWEVT_ARENA_ALIGNMENT	16
+
+/* Aligns a size to the alignment of the allocations
+ */
+#define libfwevt_arena_align_size( size ) \
+	( ( ( size ) + ( LIBFWEVT_ARENA_ALIGNMENT - 1 ) ) & ~( (size_t) LIBFWEVT_ARENA_ALIGNMENT - 1 ) )
+
+/* The size of the block header, the block data is stored directly after the header
+ */
+#define LIBFWEVT_ARENA_BLOCK_HEADER_SIZE \
+	libfwevt_arena_align_size( sizeof( libfwevt_arena_block_t ) )
+
+/* Creates an arena
+ * Make sure the value arena is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_arena_initialize(
+     libfwevt_arena_t **arena,
+     size_t block_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_arena_initialize";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid arena value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( block_size <= LIBFWEVT_ARENA_BLOCK_HEADER_SIZE )
+	 || ( block_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid block size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*arena = memory_allocate_structure(
+	          libfwevt_arena_t );
+
+	if( *arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create arena.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *arena,
+	     0,
+	     sizeof( libfwevt_arena_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear arena.",
+		 function );
+
+		goto on_error;
+	}
+	( *arena )->block_size = block_size;
+
+	return( 1 );
+
+on_error:
+	if( *arena != NULL )
+	{
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an arena
+ * All the memory allocated from the arena is freed as well
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_arena_free(
+     libfwevt_arena_t **arena,
+     libcerror_error_t **error )
+{
+	libfwevt_arena_block_t *block      = NULL;
+	libfwevt_arena_block_t *next_block = NULL;
+	static char *function              = "libfwevt_arena_free";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( *arena != NULL )
+	{
+		block = ( *arena )->first_block;
+
+		while( block != NULL )
+		{
+			next_block = block->next_block;
+
+			memory_free(
+			 block );
+
+			block = next_block;
+		}
+		memory_free(
+		 *arena );
+
+		*arena = NULL;
+	}
+	return( 1 );
+}
+
+/* Resets an arena
+ * All the memory allocated from the arena is released, the blocks are kept for reuse
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_arena_reset(
+     libfwevt_arena_t *arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_arena_reset";
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	/* The used size of the blocks after the first block is reset
+	 * when the block becomes the current block
+	 */
+	arena->current_block = arena->first_block;
+
+	if( arena->current_block != NULL )
+	{
+		arena->current_block->used_size = 0;
+	}
+	return( 1 );
+}
+
+/* Allocates memory from an arena
+ * The memory is aligned to 16 bytes and is not cleared
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_arena_allocate(
+     libfwevt_arena_t *arena,
+     size_t size,
+     void **memory,
+     libcerror_error_t **error )
+{
+	libfwevt_arena_block_t *block      = NULL;
+	libfwevt_arena_block_t *last_block = NULL;
+	static char *function              = "libfwevt_arena_allocate";
+	size_t block_size                  = 0;
+
+	if( arena == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid arena.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( size == 0 )
+	 || ( size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE - ( 2 * LIBFWEVT_ARENA_BLOCK_HEADER_SIZE ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid memory.",
+		 function );
+
+		return( -1 );
+	}
+	size = libfwevt_arena_align_size( size );
+
+	block = arena->current_block;
+
+	while( block != NULL )
+	{
+		if( size <= ( block->size - block->used_size ) )
+		{
+			*memory = (void *) &( ( (uint8_t *) block )[ LIBFWEVT_ARENA_BLOCK_HEADER_SIZE + block->used_size ] );
+
+			block->used_size += size;
+
+			return( 1 );
+		}
+		last_block = block;
+		block      = block->next_block;
+
+		if( block != NULL )
+		{
+			arena->current_block = block;
+			block->used_size     = 0;
+		}
+	}
+	block_size = arena->block_size - LIBFWEVT_ARENA_BLOCK_HEADER_SIZE;
+
+	if( size > block_size )
+	{
+		block_size = size;
+	}
+	block = (libfwevt_arena_block_t *) memory_allocate(
+	                                    LIBFWEVT_ARENA_BLOCK_HEADER_SIZE + block_size );
+
+	if( block == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create block.",
+		 function );
+
+		return( -1 );
+	}
+	block->next_block = NULL;
+	block->size       = block_size;
+	block->used_size  = size;
+
+	if( last_block == NULL )
+	{
+		arena->first_block = block;
+	}
+	else
+	{
+		last_block->next_block = block;
+	}
+	arena->current_block = block;
+
+	*memory = (void *) &( ( (uint8_t *) block )[ LIBFWEVT_ARENA_BLOCK_HEADER_SIZE ] );
+
+	return( 1 );
+}
+
@@ -0,0 +1,94 @@
+/*
+ * Arena allocator functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWEVT_ARENA_H )
+#define _LIBFWEVT_ARENA_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwevt_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfwevt_arena_block libfwevt_arena_block_t;
+
+struct libfwevt_arena_block
+{
+	/* The next block
+	 */
+	libfwevt_arena_block_t *next_block;
+
+	/* The size of the data of the block
+	 */
+	size_t size;
+
+	/* The used size of the data of the block
+	 */
+	size_t used_size;
+};
+
+typedef struct libfwevt_arena libfwevt_arena_t;
+
+struct libfwevt_arena
+{
+	/* The block size
+	 * Contains the allocation size of a block including the block header
+	 */
+	size_t block_size;
+
+	/* The first block
+	 */
+	libfwevt_arena_block_t *first_block;
+
+	/* The current block
+	 * Allocations are made from the current block and the blocks after it
+	 */
+	libfwevt_arena_block_t *current_block;
+};
+
+int libfwevt_arena_initialize(
+     libfwevt_arena_t **arena,
+     size_t block_size,
+     libcerror_error_t **error );
+
+int libfwevt_arena_free(
+     libfwevt_arena_t **arena,
+     libcerror_error_t **error );
+
+int libfwevt_arena_reset(
+     libfwevt_arena_t *arena,
+     libcerror_error_t **error );
+
+int libfwevt_arena_allocate(
+     libfwevt_arena_t *arena,
+     size_t size,
+     void **memory,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWEVT_ARENA_H ) */
+
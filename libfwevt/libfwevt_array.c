@@ -0,0 +1,483 @@
+/*
+ * Array functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwevt_arena.h"
+#include "libfwevt_array.h"
+#include "libfwevt_libcerror.h"
+
+/* Creates an array
+ * Make sure the value array is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_array_initialize(
+     libfwevt_array_t **array,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_array_initialize";
+
+	if( libfwevt_array_initialize_with_arena(
+	     array,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create array.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates an array
+ * Make sure the value array is referencing, is set to NULL
+ * If an arena is provided the array and its entries are allocated from the arena
+ * and are released when the arena is reset or freed, the entries themselves are
+ * not owned by the array
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_array_initialize_with_arena(
+     libfwevt_array_t **array,
+     libfwevt_arena_t *arena,
+     libcerror_error_t **error )
+{
+	libfwevt_array_t *safe_array = NULL;
+	static char *function        = "libfwevt_array_initialize_with_arena";
+
+	if( array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid array.",
+		 function );
+
+		return( -1 );
+	}
+	if( *array != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid array value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( arena != NULL )
+	{
+		if( libfwevt_arena_allocate(
+		     arena,
+		     sizeof( libfwevt_array_t ),
+		     (void **) &safe_array,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to allocate array from arena.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		safe_array = memory_allocate_structure(
+		              libfwevt_array_t );
+
+		if( safe_array == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create array.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	safe_array->entries                     = NULL;
+	safe_array->number_of_entries           = 0;
+	safe_array->number_of_allocated_entries = 0;
+	safe_array->arena                       = arena;
+
+	*array = safe_array;
+
+	return( 1 );
+}
+
+/* Frees an array
+ * The entries are freed using the entry free function
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_array_free(
+     libfwevt_array_t **array,
+     int (*entry_free_function)(
+            intptr_t **entry,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_array_free";
+	int result            = 1;
+
+	if( array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid array.",
+		 function );
+
+		return( -1 );
+	}
+	if( *array != NULL )
+	{
+		if( libfwevt_array_empty(
+		     *array,
+		     entry_free_function,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty array.",
+			 function );
+
+			result = -1;
+		}
+		/* The entries and array allocated from an arena are released with the arena
+		 */
+		if( ( *array )->arena == NULL )
+		{
+			if( ( *array )->entries != NULL )
+			{
+				memory_free(
+				 ( *array )->entries );
+			}
+			memory_free(
+			 *array );
+		}
+		*array = NULL;
+	}
+	return( result );
+}
+
+/* Empties an array
+ * The entries are freed using the entry free function, the allocated entries are retained for reuse
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_array_empty(
+     libfwevt_array_t *array,
+     int (*entry_free_function)(
+            intptr_t **entry,
+            libcerror_error_t **error ),
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_array_empty";
+	int entry_index       = 0;
+	int result            = 1;
+
+	if( array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid array.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_free_function != NULL )
+	{
+		for( entry_index = 0;
+		     entry_index < array->number_of_entries;
+		     entry_index++ )
+		{
+			if( array->entries[ entry_index ] == NULL )
+			{
+				continue;
+			}
+			if( entry_free_function(
+			     &( array->entries[ entry_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free entry: %d.",
+				 function,
+				 entry_index );
+
+				result = -1;
+			}
+		}
+	}
+	array->number_of_entries = 0;
+
+	return( result );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_array_get_number_of_entries(
+     libfwevt_array_t *array,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_array_get_number_of_entries";
+
+	if( array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid array.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = array->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves a specific entry
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_array_get_entry_by_index(
+     libfwevt_array_t *array,
+     int entry_index,
+     intptr_t **entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_array_get_entry_by_index";
+
+	if( array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid array.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= array->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	*entry = array->entries[ entry_index ];
+
+	return( 1 );
+}
+
+/* Appends an entry
+ * The entries are allocated in steps of 4, if the array was allocated from an arena
+ * the entries are moved to a larger allocation of the arena when they no longer fit
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_array_append_entry(
+     libfwevt_array_t *array,
+     int *entry_index,
+     intptr_t *entry,
+     libcerror_error_t **error )
+{
+	intptr_t **entries              = NULL;
+	static char *function           = "libfwevt_array_append_entry";
+	size_t entries_size             = 0;
+	int number_of_allocated_entries = 0;
+
+	if( array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid array.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( array->number_of_entries >= ( INT_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( array->number_of_entries >= array->number_of_allocated_entries )
+	{
+		number_of_allocated_entries = array->number_of_allocated_entries;
+
+		if( number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = 4;
+		}
+		else if( number_of_allocated_entries >= ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_entries = INT_MAX - 1;
+		}
+		else
+		{
+			number_of_allocated_entries *= 2;
+		}
+		entries_size = sizeof( intptr_t * ) * number_of_allocated_entries;
+
+		if( entries_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid entries size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		if( array->arena != NULL )
+		{
+			if( libfwevt_arena_allocate(
+			     array->arena,
+			     entries_size,
+			     (void **) &entries,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to allocate entries from arena.",
+				 function );
+
+				return( -1 );
+			}
+			if( array->number_of_entries > 0 )
+			{
+				if( memory_copy(
+				     entries,
+				     array->entries,
+				     sizeof( intptr_t * ) * array->number_of_entries ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy entries.",
+					 function );
+
+					return( -1 );
+				}
+			}
+		}
+		else
+		{
+			entries = (intptr_t **) memory_reallocate(
+			                         array->entries,
+			                         entries_size );
+
+			if( entries == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to resize entries.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		array->entries                     = entries;
+		array->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	array->entries[ array->number_of_entries ] = entry;
+
+	*entry_index = array->number_of_entries;
+
+	array->number_of_entries += 1;
+
+	return( 1 );
+}
+
@@ -0,0 +1,102 @@
+/*
+ * Array functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWEVT_ARRAY_H )
+#define _LIBFWEVT_ARRAY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwevt_arena.h"
+#include "libfwevt_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfwevt_array libfwevt_array_t;
+
+struct libfwevt_array
+{
+	/* The entries
+	 */
+	intptr_t **entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* The arena
+	 * Only set if the array and its entries are allocated from an arena
+	 */
+	libfwevt_arena_t *arena;
+};
+
+int libfwevt_array_initialize(
+     libfwevt_array_t **array,
+     libcerror_error_t **error );
+
+int libfwevt_array_initialize_with_arena(
+     libfwevt_array_t **array,
+     libfwevt_arena_t *arena,
+     libcerror_error_t **error );
+
+int libfwevt_array_free(
+     libfwevt_array_t **array,
+     int (*entry_free_function)(
+            intptr_t **entry,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+int libfwevt_array_empty(
+     libfwevt_array_t *array,
+     int (*entry_free_function)(
+            intptr_t **entry,
+            libcerror_error_t **error ),
+     libcerror_error_t **error );
+
+int libfwevt_array_get_number_of_entries(
+     libfwevt_array_t *array,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libfwevt_array_get_entry_by_index(
+     libfwevt_array_t *array,
+     int entry_index,
+     intptr_t **entry,
+     libcerror_error_t **error );
+
+int libfwevt_array_append_entry(
+     libfwevt_array_t *array,
+     int *entry_index,
+     intptr_t *entry,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWEVT_ARRAY_H ) */
+
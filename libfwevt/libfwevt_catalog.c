@@ -0,0 +1,933 @@
+/*
+ * Manifest catalog functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwevt_catalog.h"
+#include "libfwevt_guid_index.h"
+#include "libfwevt_libcdata.h"
+#include "libfwevt_libcerror.h"
+#include "libfwevt_libcnotify.h"
+#include "libfwevt_manifest.h"
+#include "libfwevt_provider.h"
+
+/* Creates a catalog
+ * Make sure the value catalog is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_catalog_initialize(
+     libfwevt_catalog_t **catalog,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_catalog_t *internal_catalog = NULL;
+	static char *function                         = "libfwevt_catalog_initialize";
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( *catalog != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid catalog value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_catalog = memory_allocate_structure(
+	                    libfwevt_internal_catalog_t );
+
+	if( internal_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create catalog.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_catalog,
+	     0,
+	     sizeof( libfwevt_internal_catalog_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear catalog.",
+		 function );
+
+		memory_free(
+		 internal_catalog );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( internal_catalog->manifests_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create manifests array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_guid_index_initialize(
+	     &( internal_catalog->providers_index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create providers index.",
+		 function );
+
+		goto on_error;
+	}
+	*catalog = (libfwevt_catalog_t *) internal_catalog;
+
+	return( 1 );
+
+on_error:
+	if( internal_catalog != NULL )
+	{
+		if( internal_catalog->manifests_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_catalog->manifests_array ),
+			 NULL,
+			 NULL );
+		}
+		memory_free(
+		 internal_catalog );
+	}
+	return( -1 );
+}
+
+/* Frees a catalog
+ * The manifests appended to the catalog are freed as well
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_catalog_free(
+     libfwevt_catalog_t **catalog,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_catalog_t *internal_catalog = NULL;
+	static char *function                         = "libfwevt_catalog_free";
+	int result                                    = 1;
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( *catalog != NULL )
+	{
+		internal_catalog = (libfwevt_internal_catalog_t *) *catalog;
+		*catalog         = NULL;
+
+		/* The providers index and entries only reference the providers
+		 */
+		if( libfwevt_guid_index_free(
+		     &( internal_catalog->providers_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free providers index.",
+			 function );
+
+			result = -1;
+		}
+		if( internal_catalog->entries != NULL )
+		{
+			memory_free(
+			 internal_catalog->entries );
+		}
+		if( libcdata_array_free(
+		     &( internal_catalog->manifests_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfwevt_manifest_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free manifests array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_catalog );
+	}
+	return( result );
+}
+
+/* Appends a manifest to the catalog
+ * On success the catalog takes ownership of the manifest
+ * Manifests can only be appended before the catalog is built
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_catalog_append_manifest(
+     libfwevt_catalog_t *catalog,
+     libfwevt_manifest_t *manifest,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_catalog_t *internal_catalog = NULL;
+	static char *function                         = "libfwevt_catalog_append_manifest";
+	int entry_index                               = 0;
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	internal_catalog = (libfwevt_internal_catalog_t *) catalog;
+
+	if( internal_catalog->is_built != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid catalog - already built.",
+		 function );
+
+		return( -1 );
+	}
+	if( manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_append_entry(
+	     internal_catalog->manifests_array,
+	     &entry_index,
+	     (intptr_t *) manifest,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append manifest to array.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the duplicate provider function
+ * The function is called when building the catalog for every provider with an identifier
+ * that already is in the catalog. The function should return 1 if the provider should
+ * replace the existing provider, 0 if the existing provider should be kept or -1 on error.
+ * If no function is set the provider of the first appended manifest is kept
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_catalog_set_duplicate_provider_function(
+     libfwevt_catalog_t *catalog,
+     int (*duplicate_provider_function)(
+            libfwevt_manifest_t *existing_manifest,
+            libfwevt_provider_t *existing_provider,
+            libfwevt_manifest_t *manifest,
+            libfwevt_provider_t *provider,
+            void *function_data ),
+     void *function_data,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_catalog_t *internal_catalog = NULL;
+	static char *function                         = "libfwevt_catalog_set_duplicate_provider_function";
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	internal_catalog = (libfwevt_internal_catalog_t *) catalog;
+
+	if( internal_catalog->is_built != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid catalog - already built.",
+		 function );
+
+		return( -1 );
+	}
+	internal_catalog->duplicate_provider_function      = duplicate_provider_function;
+	internal_catalog->duplicate_provider_function_data = function_data;
+
+	return( 1 );
+}
+
+/* Inserts a provider into the providers index
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_internal_catalog_insert_provider(
+     libfwevt_internal_catalog_t *internal_catalog,
+     libfwevt_manifest_t *manifest,
+     libfwevt_provider_t *provider,
+     libcerror_error_t **error )
+{
+	libfwevt_catalog_entry_t *entry = NULL;
+	static char *function           = "libfwevt_internal_catalog_insert_provider";
+	int result                      = 0;
+
+	if( internal_catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_catalog->entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid catalog - missing entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( provider == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid provider.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwevt_guid_index_get_value_by_identifier(
+	          internal_catalog->providers_index,
+	          ( (libfwevt_internal_provider_t *) provider )->identifier,
+	          16,
+	          (intptr_t **) &entry,
+	          NULL,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry from providers index.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( internal_catalog->duplicate_provider_function == NULL )
+		{
+			return( 1 );
+		}
+		result = internal_catalog->duplicate_provider_function(
+		          entry->manifest,
+		          entry->provider,
+		          manifest,
+		          provider,
+		          internal_catalog->duplicate_provider_function_data );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: duplicate provider function failed.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			entry->manifest = manifest;
+			entry->provider = provider;
+		}
+		return( 1 );
+	}
+	/* The entries are allocated for the total number of providers
+	 */
+	entry = &( internal_catalog->entries[ internal_catalog->number_of_entries ] );
+
+	entry->manifest = manifest;
+	entry->provider = provider;
+
+	if( libfwevt_guid_index_insert_value(
+	     internal_catalog->providers_index,
+	     ( (libfwevt_internal_provider_t *) provider )->identifier,
+	     16,
+	     (intptr_t *) entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert entry into providers index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_catalog->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Builds the catalog
+ * This creates the providers index of all the providers of the appended manifests.
+ * After the catalog is built no manifests can be appended and the catalog lookup
+ * functions do not modify the catalog, hence they can be used concurrently
+ * The tables of providers of manifests that are read on demand are read on first use,
+ * concurrent use of these providers is only supported when multi-thread support is enabled
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_catalog_build(
+     libfwevt_catalog_t *catalog,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_catalog_t *internal_catalog = NULL;
+	libfwevt_manifest_t *manifest                 = NULL;
+	libfwevt_provider_t *provider                 = NULL;
+	static char *function                         = "libfwevt_catalog_build";
+	size_t entries_size                           = 0;
+	int manifest_index                            = 0;
+	int number_of_manifests                       = 0;
+	int number_of_providers                       = 0;
+	int provider_index                            = 0;
+	int total_number_of_providers                 = 0;
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	internal_catalog = (libfwevt_internal_catalog_t *) catalog;
+
+	if( internal_catalog->is_built != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid catalog - already built.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_catalog->manifests_array,
+	     &number_of_manifests,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of manifests.",
+		 function );
+
+		goto on_error;
+	}
+	for( manifest_index = 0;
+	     manifest_index < number_of_manifests;
+	     manifest_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_catalog->manifests_array,
+		     manifest_index,
+		     (intptr_t **) &manifest,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve manifest: %d.",
+			 function,
+			 manifest_index );
+
+			goto on_error;
+		}
+		if( libfwevt_manifest_get_number_of_providers(
+		     manifest,
+		     &number_of_providers,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of providers of manifest: %d.",
+			 function,
+			 manifest_index );
+
+			goto on_error;
+		}
+		if( number_of_providers > ( INT_MAX - total_number_of_providers ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid total number of providers value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		total_number_of_providers += number_of_providers;
+	}
+	if( total_number_of_providers > 0 )
+	{
+		if( (size_t) total_number_of_providers > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfwevt_catalog_entry_t ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid total number of providers value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		entries_size = sizeof( libfwevt_catalog_entry_t ) * total_number_of_providers;
+
+		internal_catalog->entries = (libfwevt_catalog_entry_t *) memory_allocate(
+		                                                          entries_size );
+
+		if( internal_catalog->entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entries.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( manifest_index = 0;
+	     manifest_index < number_of_manifests;
+	     manifest_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_catalog->manifests_array,
+		     manifest_index,
+		     (intptr_t **) &manifest,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve manifest: %d.",
+			 function,
+			 manifest_index );
+
+			goto on_error;
+		}
+		if( libfwevt_manifest_get_number_of_providers(
+		     manifest,
+		     &number_of_providers,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of providers of manifest: %d.",
+			 function,
+			 manifest_index );
+
+			goto on_error;
+		}
+		for( provider_index = 0;
+		     provider_index < number_of_providers;
+		     provider_index++ )
+		{
+			if( libfwevt_manifest_get_provider_by_index(
+			     manifest,
+			     provider_index,
+			     &provider,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve provider: %d of manifest: %d.",
+				 function,
+				 provider_index,
+				 manifest_index );
+
+				goto on_error;
+			}
+			if( libfwevt_internal_catalog_insert_provider(
+			     internal_catalog,
+			     manifest,
+			     provider,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert provider: %d of manifest: %d.",
+				 function,
+				 provider_index,
+				 manifest_index );
+
+				goto on_error;
+			}
+		}
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: number of manifests\t\t\t\t: %d\n",
+		 function,
+		 number_of_manifests );
+
+		libcnotify_printf(
+		 "%s: number of providers\t\t\t\t: %d\n",
+		 function,
+		 total_number_of_providers );
+
+		libcnotify_printf(
+		 "%s: number of unique providers\t\t\t: %d\n",
+		 function,
+		 internal_catalog->number_of_entries );
+	}
+#endif
+	internal_catalog->is_built = 1;
+
+	return( 1 );
+
+on_error:
+	libfwevt_guid_index_empty(
+	 internal_catalog->providers_index,
+	 NULL );
+
+	if( internal_catalog->entries != NULL )
+	{
+		memory_free(
+		 internal_catalog->entries );
+
+		internal_catalog->entries = NULL;
+	}
+	internal_catalog->number_of_entries = 0;
+
+	return( -1 );
+}
+
+/* Retrieves the number of manifests
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_catalog_get_number_of_manifests(
+     libfwevt_catalog_t *catalog,
+     int *number_of_manifests,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_catalog_t *internal_catalog = NULL;
+	static char *function                         = "libfwevt_catalog_get_number_of_manifests";
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	internal_catalog = (libfwevt_internal_catalog_t *) catalog;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_catalog->manifests_array,
+	     number_of_manifests,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific manifest
+ * The manifest is managed by the catalog and should not be freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_catalog_get_manifest_by_index(
+     libfwevt_catalog_t *catalog,
+     int manifest_index,
+     libfwevt_manifest_t **manifest,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_catalog_t *internal_catalog = NULL;
+	static char *function                         = "libfwevt_catalog_get_manifest_by_index";
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	internal_catalog = (libfwevt_internal_catalog_t *) catalog;
+
+	if( libcdata_array_get_entry_by_index(
+	     internal_catalog->manifests_array,
+	     manifest_index,
+	     (intptr_t **) manifest,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry: %d.",
+		 function,
+		 manifest_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of providers
+ * Providers with the same identifier (GUID) are counted once
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_catalog_get_number_of_providers(
+     libfwevt_catalog_t *catalog,
+     int *number_of_providers,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_catalog_t *internal_catalog = NULL;
+	static char *function                         = "libfwevt_catalog_get_number_of_providers";
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	internal_catalog = (libfwevt_internal_catalog_t *) catalog;
+
+	if( internal_catalog->is_built == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid catalog - not built.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_providers == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of providers.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_providers = internal_catalog->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves a specific provider by identifier (GUID)
+ * The provider is managed by the manifest that contains it
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwevt_catalog_get_provider_by_identifier(
+     libfwevt_catalog_t *catalog,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     libfwevt_provider_t **provider,
+     libcerror_error_t **error )
+{
+	libfwevt_catalog_entry_t *entry               = NULL;
+	libfwevt_internal_catalog_t *internal_catalog = NULL;
+	static char *function                         = "libfwevt_catalog_get_provider_by_identifier";
+	int number_of_probes                          = 0;
+	int result                                    = 0;
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	internal_catalog = (libfwevt_internal_catalog_t *) catalog;
+
+	if( internal_catalog->is_built == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid catalog - not built.",
+		 function );
+
+		return( -1 );
+	}
+	if( provider == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid provider.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwevt_guid_index_get_value_by_identifier(
+	          internal_catalog->providers_index,
+	          provider_identifier,
+	          provider_identifier_size,
+	          (intptr_t **) &entry,
+	          &number_of_probes,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry from providers index.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: number of index probes\t\t\t\t: %d\n",
+		 function,
+		 number_of_probes );
+	}
+#endif
+	if( result != 0 )
+	{
+		*provider = entry->provider;
+	}
+	return( result );
+}
+
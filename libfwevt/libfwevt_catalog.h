@@ -0,0 +1,162 @@
+/*
+ * Manifest catalog functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWEVT_CATALOG_H )
+#define _LIBFWEVT_CATALOG_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwevt_extern.h"
+#include "libfwevt_guid_index.h"
+#include "libfwevt_libcdata.h"
+#include "libfwevt_libcerror.h"
+#include "libfwevt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfwevt_catalog_entry libfwevt_catalog_entry_t;
+
+struct libfwevt_catalog_entry
+{
+	/* The manifest that contains the provider
+	 */
+	libfwevt_manifest_t *manifest;
+
+	/* The provider
+	 */
+	libfwevt_provider_t *provider;
+};
+
+typedef struct libfwevt_internal_catalog libfwevt_internal_catalog_t;
+
+struct libfwevt_internal_catalog
+{
+	/* The manifests array
+	 */
+	libcdata_array_t *manifests_array;
+
+	/* The entries
+	 * Contains an entry per unique provider identifier
+	 */
+	libfwevt_catalog_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The providers index
+	 * Maps a provider identifier (GUID) to an entry
+	 */
+	libfwevt_guid_index_t *providers_index;
+
+	/* The duplicate provider function
+	 */
+	int (*duplicate_provider_function)(
+	       libfwevt_manifest_t *existing_manifest,
+	       libfwevt_provider_t *existing_provider,
+	       libfwevt_manifest_t *manifest,
+	       libfwevt_provider_t *provider,
+	       void *function_data );
+
+	/* The duplicate provider function data
+	 */
+	void *duplicate_provider_function_data;
+
+	/* Value to indicate the providers index was built
+	 */
+	uint8_t is_built;
+};
+
+LIBFWEVT_EXTERN \
+int libfwevt_catalog_initialize(
+     libfwevt_catalog_t **catalog,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_catalog_free(
+     libfwevt_catalog_t **catalog,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_catalog_append_manifest(
+     libfwevt_catalog_t *catalog,
+     libfwevt_manifest_t *manifest,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_catalog_set_duplicate_provider_function(
+     libfwevt_catalog_t *catalog,
+     int (*duplicate_provider_function)(
+            libfwevt_manifest_t *existing_manifest,
+            libfwevt_provider_t *existing_provider,
+            libfwevt_manifest_t *manifest,
+            libfwevt_provider_t *provider,
+            void *function_data ),
+     void *function_data,
+     libcerror_error_t **error );
+
+int libfwevt_internal_catalog_insert_provider(
+     libfwevt_internal_catalog_t *internal_catalog,
+     libfwevt_manifest_t *manifest,
+     libfwevt_provider_t *provider,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_catalog_build(
+     libfwevt_catalog_t *catalog,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_catalog_get_number_of_manifests(
+     libfwevt_catalog_t *catalog,
+     int *number_of_manifests,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_catalog_get_manifest_by_index(
+     libfwevt_catalog_t *catalog,
+     int manifest_index,
+     libfwevt_manifest_t **manifest,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_catalog_get_number_of_providers(
+     libfwevt_catalog_t *catalog,
+     int *number_of_providers,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_catalog_get_provider_by_identifier(
+     libfwevt_catalog_t *catalog,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     libfwevt_provider_t **provider,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWEVT_CATALOG_H ) */
+
@@ -20,9 +20,11 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
+#include "libfwevt_arena.h"
 #include "libfwevt_data_segment.h"
 #include "libfwevt_definitions.h"
 #include "libfwevt_libcerror.h"
@@ -42,6 +44,44 @@ int libfwevt_data_segment_initialize(
 {
 	static char *function = "libfwevt_data_segment_initialize";
 
+	if( libfwevt_data_segment_initialize_with_arena(
+	     data_segment,
+	     data,
+	     data_size,
+	     0,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data segment.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a data segment
+ * Make sure the value data_segment is referencing, is set to NULL
+ * If an arena is provided the data segment and its copy of the data are allocated from the arena
+ * If LIBFWEVT_DATA_SEGMENT_FLAG_BORROW_DATA is set the data segment refers to the data
+ * instead of storing a copy, in which case the data must remain available while
+ * the data segment is used
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_data_segment_initialize_with_arena(
+     libfwevt_data_segment_t **data_segment,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t flags,
+     libfwevt_arena_t *arena,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_data_segment_initialize_with_arena";
+
 	if( data_segment == NULL )
 	{
 		libcerror_error_set(
@@ -86,19 +126,54 @@ int libfwevt_data_segment_initialize(
 
 		return( -1 );
 	}
-	*data_segment = memory_allocate_structure(
-	                 libfwevt_data_segment_t );
-
-	if( *data_segment == NULL )
+	if( ( flags & ~( LIBFWEVT_DATA_SEGMENT_FLAG_BORROW_DATA ) ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create data segment.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
 
-		goto on_error;
+		return( -1 );
+	}
+	if( arena != NULL )
+	{
+		if( libfwevt_arena_allocate(
+		     arena,
+		     sizeof( libfwevt_data_segment_t ),
+		     (void **) data_segment,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create data segment.",
+			 function );
+
+			*data_segment = NULL;
+
+			return( -1 );
+		}
+	}
+	else
+	{
+		*data_segment = memory_allocate_structure(
+		                 libfwevt_data_segment_t );
+
+		if( *data_segment == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create data segment.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	if( memory_set(
 	     *data_segment,
@@ -112,18 +187,42 @@ int libfwevt_data_segment_initialize(
 		 "%s: unable to clear data segment.",
 		 function );
 
-		memory_free(
-		 *data_segment );
-
+		if( arena == NULL )
+		{
+			memory_free(
+			 *data_segment );
+		}
 		*data_segment = NULL;
 
 		return( -1 );
 	}
-	if( data_size > 0 )
-	{
-		( *data_segment)->data = (uint8_t *) memory_allocate(
-		                                      sizeof( uint8_t ) * data_size );
+	( *data_segment )->arena = arena;
 
+	if( ( data_size > 0 )
+	 && ( ( flags & LIBFWEVT_DATA_SEGMENT_FLAG_BORROW_DATA ) != 0 ) )
+	{
+		( *data_segment )->data             = (uint8_t *) data;
+		( *data_segment )->data_size        = data_size;
+		( *data_segment )->data_is_borrowed = 1;
+	}
+	else if( data_size > 0 )
+	{
+		if( arena != NULL )
+		{
+			if( libfwevt_arena_allocate(
+			     arena,
+			     sizeof( uint8_t ) * data_size,
+			     (void **) &( ( *data_segment )->data ),
+			     error ) != 1 )
+			{
+				( *data_segment )->data = NULL;
+			}
+		}
+		else
+		{
+			( *data_segment )->data = (uint8_t *) memory_allocate(
+			                                       sizeof( uint8_t ) * data_size );
+		}
 		if( ( *data_segment)->data == NULL )
 		{
 			libcerror_error_set(
@@ -157,14 +256,17 @@ int libfwevt_data_segment_initialize(
 on_error:
 	if( *data_segment != NULL )
 	{
-		if( ( *data_segment )->data != NULL )
+		if( arena == NULL )
 		{
+			if( ( ( *data_segment )->data != NULL )
+			 && ( ( *data_segment )->data_is_borrowed == 0 ) )
+			{
+				memory_free(
+				 ( *data_segment )->data );
+			}
 			memory_free(
-			 ( *data_segment )->data );
+			 *data_segment );
 		}
-		memory_free(
-		 *data_segment );
-
 		*data_segment = NULL;
 	}
 	return( -1 );
@@ -193,82 +295,462 @@ int libfwevt_data_segment_free(
 	}
 	if( *data_segment != NULL )
 	{
-		switch( ( *data_segment )->cached_value_type & 0x7f )
+		if( libfwevt_data_segment_clear_cached_value(
+		     *data_segment,
+		     error ) != 1 )
 		{
-			case LIBFWEVT_VALUE_TYPE_GUID:
-				if( libfguid_identifier_free(
-				     &( ( *data_segment )->guid ),
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-					 "%s: unable to free GUID.",
-					 function );
-
-					result = -1;
-				}
-				break;
-
-			case LIBFWEVT_VALUE_TYPE_FILETIME:
-				if( libfdatetime_filetime_free(
-				     &( ( *data_segment )->filetime ),
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-					 "%s: unable to free FILETIME.",
-					 function );
-
-					result = -1;
-				}
-				break;
-
-			case LIBFWEVT_VALUE_TYPE_SYSTEMTIME:
-				if( libfdatetime_systemtime_free(
-				     &( ( *data_segment )->systemtime ),
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-					 "%s: unable to free SYSTEMTIME.",
-					 function );
-
-					result = -1;
-				}
-				break;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear cached value.",
+			 function );
 
-			case LIBFWEVT_VALUE_TYPE_NT_SECURITY_IDENTIFIER:
-				if( libfwnt_security_identifier_free(
-				     &( ( *data_segment )->security_identifier ),
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-					 "%s: unable to free NT security identifier.",
-					 function );
-
-					result = -1;
-				}
-				break;
+			result = -1;
 		}
-		if( ( *data_segment )->data != NULL )
+		/* The data and data segment allocated from an arena are released with the arena
+		 * and borrowed data is owned by the caller
+		 */
+		if( ( *data_segment )->arena == NULL )
 		{
+			if( ( ( *data_segment )->data != NULL )
+			 && ( ( *data_segment )->data_is_borrowed == 0 ) )
+			{
+				memory_free(
+				 ( *data_segment )->data );
+			}
 			memory_free(
-			 ( *data_segment )->data );
+			 *data_segment );
 		}
-		memory_free(
-		 *data_segment );
-
 		*data_segment = NULL;
 	}
 	return( result );
 }
 
+/* Sets the cached value of a data segment
+ * The data is converted according to the value type, the array flag of the value type is ignored
+ * The GUID, FILETIME, SYSTEMTIME and NT security identifier values are not cached for a data
+ * segment allocated from an arena, since these are allocated on the heap, refer to
+ * libfwevt_data_segment_copy_with_cached_value
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_data_segment_set_cached_value(
+     libfwevt_data_segment_t *data_segment,
+     uint8_t value_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_data_segment_set_cached_value";
+
+	if( data_segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_segment->cached_value_type != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data segment - cached value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_segment->arena != NULL )
+	{
+		switch( value_type & 0x7f )
+		{
+			case LIBFWEVT_VALUE_TYPE_GUID:
+			case LIBFWEVT_VALUE_TYPE_FILETIME:
+			case LIBFWEVT_VALUE_TYPE_SYSTEMTIME:
+			case LIBFWEVT_VALUE_TYPE_NT_SECURITY_IDENTIFIER:
+				return( 1 );
+
+			default:
+				break;
+		}
+	}
+	switch( value_type & 0x7f )
+	{
+		case LIBFWEVT_VALUE_TYPE_INTEGER_8BIT:
+		case LIBFWEVT_VALUE_TYPE_UNSIGNED_INTEGER_8BIT:
+			if( data_segment->data_size != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: invalid data segment - unsupported data size.",
+				 function );
+
+				return( -1 );
+			}
+			data_segment->value_64bit = data_segment->data[ 0 ];
+
+			break;
+
+		case LIBFWEVT_VALUE_TYPE_INTEGER_16BIT:
+		case LIBFWEVT_VALUE_TYPE_UNSIGNED_INTEGER_16BIT:
+			if( data_segment->data_size != 2 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: invalid data segment - unsupported data size.",
+				 function );
+
+				return( -1 );
+			}
+			byte_stream_copy_to_uint16_little_endian(
+			 data_segment->data,
+			 data_segment->value_64bit );
+
+			break;
+
+		case LIBFWEVT_VALUE_TYPE_INTEGER_32BIT:
+		case LIBFWEVT_VALUE_TYPE_UNSIGNED_INTEGER_32BIT:
+		case LIBFWEVT_VALUE_TYPE_HEXADECIMAL_INTEGER_32BIT:
+		case LIBFWEVT_VALUE_TYPE_FLOATING_POINT_32BIT:
+		case LIBFWEVT_VALUE_TYPE_BOOLEAN:
+			if( data_segment->data_size != 4 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: invalid data segment - unsupported data size.",
+				 function );
+
+				return( -1 );
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 data_segment->data,
+			 data_segment->value_64bit );
+
+			break;
+
+		case LIBFWEVT_VALUE_TYPE_INTEGER_64BIT:
+		case LIBFWEVT_VALUE_TYPE_UNSIGNED_INTEGER_64BIT:
+		case LIBFWEVT_VALUE_TYPE_HEXADECIMAL_INTEGER_64BIT:
+		case LIBFWEVT_VALUE_TYPE_FLOATING_POINT_64BIT:
+			if( data_segment->data_size != 8 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: invalid data segment - unsupported data size.",
+				 function );
+
+				return( -1 );
+			}
+			byte_stream_copy_to_uint64_little_endian(
+			 data_segment->data,
+			 data_segment->value_64bit );
+
+			break;
+
+		case LIBFWEVT_VALUE_TYPE_GUID:
+			if( libfguid_identifier_initialize(
+			     &( data_segment->guid ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create GUID.",
+				 function );
+
+				return( -1 );
+			}
+			if( libfguid_identifier_copy_from_byte_stream(
+			     data_segment->guid,
+			     data_segment->data,
+			     data_segment->data_size,
+			     LIBFGUID_ENDIAN_LITTLE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy byte stream to GUID.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+
+		case LIBFWEVT_VALUE_TYPE_FILETIME:
+			if( libfdatetime_filetime_initialize(
+			     &( data_segment->filetime ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create FILETIME.",
+				 function );
+
+				return( -1 );
+			}
+			if( libfdatetime_filetime_copy_from_byte_stream(
+			     data_segment->filetime,
+			     data_segment->data,
+			     data_segment->data_size,
+			     LIBFDATETIME_ENDIAN_LITTLE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy byte stream to FILETIME.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+
+		case LIBFWEVT_VALUE_TYPE_SYSTEMTIME:
+			if( libfdatetime_systemtime_initialize(
+			     &( data_segment->systemtime ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create SYSTEMTIME.",
+				 function );
+
+				return( -1 );
+			}
+			if( libfdatetime_systemtime_copy_from_byte_stream(
+			     data_segment->systemtime,
+			     data_segment->data,
+			     data_segment->data_size,
+			     LIBFDATETIME_ENDIAN_LITTLE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy byte stream to SYSTEMTIME.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+
+		case LIBFWEVT_VALUE_TYPE_NT_SECURITY_IDENTIFIER:
+			if( libfwnt_security_identifier_initialize(
+			     &( data_segment->security_identifier ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create NT security identifier.",
+				 function );
+
+				return( -1 );
+			}
+			if( libfwnt_security_identifier_copy_from_byte_stream(
+			     data_segment->security_identifier,
+			     data_segment->data,
+			     data_segment->data_size,
+			     LIBFWNT_ENDIAN_LITTLE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy byte stream to NT security identifier.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+	}
+	data_segment->cached_value_type = value_type & 0x7f;
+
+	return( 1 );
+}
+
+/* Copies a data segment and sets the cached value of the copy
+ * The destination data segment is not allocated, it refers to the data of the source
+ * data segment and is only used to format the value, for example when the source data
+ * segment is allocated from an arena. Use libfwevt_data_segment_clear_cached_value to
+ * free the cached value of the destination data segment
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_data_segment_copy_with_cached_value(
+     libfwevt_data_segment_t *destination_data_segment,
+     const libfwevt_data_segment_t *source_data_segment,
+     uint8_t value_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_data_segment_copy_with_cached_value";
+
+	if( destination_data_segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid destination data segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( source_data_segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source data segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     destination_data_segment,
+	     0,
+	     sizeof( libfwevt_data_segment_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear destination data segment.",
+		 function );
+
+		return( -1 );
+	}
+	destination_data_segment->data             = source_data_segment->data;
+	destination_data_segment->data_size        = source_data_segment->data_size;
+	destination_data_segment->data_is_borrowed = 1;
+
+	if( libfwevt_data_segment_set_cached_value(
+	     destination_data_segment,
+	     value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set cached value of destination data segment.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Clears the cached value of a data segment
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_data_segment_clear_cached_value(
+     libfwevt_data_segment_t *data_segment,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_data_segment_clear_cached_value";
+
+	if( data_segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data segment.",
+		 function );
+
+		return( -1 );
+	}
+	switch( data_segment->cached_value_type )
+	{
+		case LIBFWEVT_VALUE_TYPE_GUID:
+			if( libfguid_identifier_free(
+			     &( data_segment->guid ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free GUID.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+
+		case LIBFWEVT_VALUE_TYPE_FILETIME:
+			if( libfdatetime_filetime_free(
+			     &( data_segment->filetime ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free FILETIME.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+
+		case LIBFWEVT_VALUE_TYPE_SYSTEMTIME:
+			if( libfdatetime_systemtime_free(
+			     &( data_segment->systemtime ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free SYSTEMTIME.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+
+		case LIBFWEVT_VALUE_TYPE_NT_SECURITY_IDENTIFIER:
+			if( libfwnt_security_identifier_free(
+			     &( data_segment->security_identifier ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free NT security identifier.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+	}
+	data_segment->cached_value_type = 0;
+
+	return( 1 );
+}
+
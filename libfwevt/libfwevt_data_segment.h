@@ -25,6 +25,7 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfwevt_arena.h"
 #include "libfwevt_libcerror.h"
 #include "libfwevt_libfdatetime.h"
 #include "libfwevt_libfguid.h"
@@ -46,6 +47,10 @@ struct libfwevt_data_segment
 	 */
 	size_t data_size;
 
+	/* Value to indicate the data is borrowed from the caller
+	 */
+	uint8_t data_is_borrowed;
+
 	/* The cached value type
 	 */
 	uint8_t cached_value_type;
@@ -74,6 +79,11 @@ struct libfwevt_data_segment
 		 */
 		libfwnt_security_identifier_t *security_identifier;
 	};
+
+	/* The arena
+	 * Only set if the data segment was allocated from an arena
+	 */
+	libfwevt_arena_t *arena;
 };
 
 int libfwevt_data_segment_initialize(
@@ -82,10 +92,33 @@ int libfwevt_data_segment_initialize(
      size_t data_size,
      libcerror_error_t **error );
 
+int libfwevt_data_segment_initialize_with_arena(
+     libfwevt_data_segment_t **data_segment,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t flags,
+     libfwevt_arena_t *arena,
+     libcerror_error_t **error );
+
 int libfwevt_data_segment_free(
      libfwevt_data_segment_t **data_segment,
      libcerror_error_t **error );
 
+int libfwevt_data_segment_set_cached_value(
+     libfwevt_data_segment_t *data_segment,
+     uint8_t value_type,
+     libcerror_error_t **error );
+
+int libfwevt_data_segment_copy_with_cached_value(
+     libfwevt_data_segment_t *destination_data_segment,
+     const libfwevt_data_segment_t *source_data_segment,
+     uint8_t value_type,
+     libcerror_error_t **error );
+
+int libfwevt_data_segment_clear_cached_value(
+     libfwevt_data_segment_t *data_segment,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
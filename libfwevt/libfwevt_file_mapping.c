@@ -0,0 +1,532 @@
+/*
+ * Memory mapped file functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_ERRNO_H ) || defined( WINAPI )
+#include <errno.h>
+#endif
+
+#if defined( HAVE_FCNTL_H ) && !defined( WINAPI )
+#include <fcntl.h>
+#endif
+
+#if defined( HAVE_SYS_MMAN_H ) && !defined( WINAPI )
+#include <sys/mman.h>
+#endif
+
+#if defined( HAVE_SYS_STAT_H ) && !defined( WINAPI )
+#include <sys/stat.h>
+#endif
+
+#if defined( HAVE_UNISTD_H ) && !defined( WINAPI )
+#include <unistd.h>
+#endif
+
+#include "libfwevt_file_mapping.h"
+#include "libfwevt_libcerror.h"
+
+#if !defined( WINAPI ) && defined( HAVE_OPEN ) && defined( HAVE_FSTAT ) && defined( HAVE_CLOSE ) && defined( HAVE_MMAP ) && defined( HAVE_MUNMAP )
+#define HAVE_POSIX_FILE_MAPPING		1
+#endif
+
+/* Creates a file mapping
+ * Make sure the value file_mapping is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_file_mapping_initialize(
+     libfwevt_file_mapping_t **file_mapping,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_file_mapping_initialize";
+
+	if( file_mapping == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file mapping.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_mapping != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file mapping value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*file_mapping = memory_allocate_structure(
+	                 libfwevt_file_mapping_t );
+
+	if( *file_mapping == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create file mapping.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *file_mapping,
+	     0,
+	     sizeof( libfwevt_file_mapping_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear file mapping.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( WINAPI )
+	( *file_mapping )->file_handle    = INVALID_HANDLE_VALUE;
+	( *file_mapping )->mapping_handle = NULL;
+#endif
+	return( 1 );
+
+on_error:
+	if( *file_mapping != NULL )
+	{
+		memory_free(
+		 *file_mapping );
+
+		*file_mapping = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a file mapping
+ * Unmaps the file if it is still mapped
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_file_mapping_free(
+     libfwevt_file_mapping_t **file_mapping,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_file_mapping_free";
+	int result            = 1;
+
+	if( file_mapping == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file mapping.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file_mapping != NULL )
+	{
+		if( ( *file_mapping )->data != NULL )
+		{
+			if( libfwevt_file_mapping_close(
+			     *file_mapping,
+			     error ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file mapping.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *file_mapping );
+
+		*file_mapping = NULL;
+	}
+	return( result );
+}
+
+/* Opens a file and maps its content read-only into memory
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_file_mapping_open(
+     libfwevt_file_mapping_t *file_mapping,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	static char *function         = "libfwevt_file_mapping_open";
+
+#if defined( WINAPI )
+	DWORD error_code              = 0;
+	DWORD file_size_lower         = 0;
+	DWORD file_size_upper         = 0;
+	uint64_t file_size            = 0;
+
+#elif defined( HAVE_POSIX_FILE_MAPPING )
+	struct stat file_statistics;
+
+	void *mapped_data             = NULL;
+	int file_descriptor           = -1;
+#endif
+
+	if( file_mapping == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file mapping.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_mapping->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid file mapping - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( WINAPI )
+	file_mapping->file_handle = CreateFileA(
+	                             (LPCSTR) filename,
+	                             GENERIC_READ,
+	                             FILE_SHARE_READ,
+	                             NULL,
+	                             OPEN_EXISTING,
+	                             FILE_ATTRIBUTE_NORMAL,
+	                             NULL );
+
+	if( file_mapping->file_handle == INVALID_HANDLE_VALUE )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 (uint32_t) error_code,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	file_size_lower = GetFileSize(
+	                   file_mapping->file_handle,
+	                   &file_size_upper );
+
+	if( file_size_lower == INVALID_FILE_SIZE )
+	{
+		error_code = GetLastError();
+
+		if( error_code != NO_ERROR )
+		{
+			libcerror_system_set_error(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_GENERIC,
+			 (uint32_t) error_code,
+			 "%s: unable to retrieve file size.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	file_size = ( (uint64_t) file_size_upper << 32 ) | file_size_lower;
+
+	if( ( file_size == 0 )
+	 || ( file_size > (uint64_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	file_mapping->mapping_handle = CreateFileMappingA(
+	                                file_mapping->file_handle,
+	                                NULL,
+	                                PAGE_READONLY,
+	                                0,
+	                                0,
+	                                NULL );
+
+	if( file_mapping->mapping_handle == NULL )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 (uint32_t) error_code,
+		 "%s: unable to create file mapping.",
+		 function );
+
+		goto on_error;
+	}
+	file_mapping->data = (uint8_t *) MapViewOfFile(
+	                                  file_mapping->mapping_handle,
+	                                  FILE_MAP_READ,
+	                                  0,
+	                                  0,
+	                                  0 );
+
+	if( file_mapping->data == NULL )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 (uint32_t) error_code,
+		 "%s: unable to map view of file.",
+		 function );
+
+		goto on_error;
+	}
+	file_mapping->data_size = (size_t) file_size;
+
+	return( 1 );
+
+on_error:
+	if( file_mapping->mapping_handle != NULL )
+	{
+		CloseHandle(
+		 file_mapping->mapping_handle );
+
+		file_mapping->mapping_handle = NULL;
+	}
+	if( file_mapping->file_handle != INVALID_HANDLE_VALUE )
+	{
+		CloseHandle(
+		 file_mapping->file_handle );
+
+		file_mapping->file_handle = INVALID_HANDLE_VALUE;
+	}
+	return( -1 );
+
+#elif defined( HAVE_POSIX_FILE_MAPPING )
+	file_descriptor = open(
+	                   filename,
+	                   O_RDONLY );
+
+	if( file_descriptor == -1 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 (uint32_t) errno,
+		 "%s: unable to open file: %s.",
+		 function,
+		 filename );
+
+		goto on_error;
+	}
+	if( fstat(
+	     file_descriptor,
+	     &file_statistics ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 (uint32_t) errno,
+		 "%s: unable to retrieve file statistics.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( file_statistics.st_size <= 0 )
+	 || ( (uint64_t) file_statistics.st_size > (uint64_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	mapped_data = mmap(
+	               NULL,
+	               (size_t) file_statistics.st_size,
+	               PROT_READ,
+	               MAP_PRIVATE,
+	               file_descriptor,
+	               0 );
+
+	if( mapped_data == MAP_FAILED )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 (uint32_t) errno,
+		 "%s: unable to map file.",
+		 function );
+
+		goto on_error;
+	}
+	/* The mapping remains valid after the file descriptor is closed
+	 */
+	close(
+	 file_descriptor );
+
+	file_mapping->data      = (uint8_t *) mapped_data;
+	file_mapping->data_size = (size_t) file_statistics.st_size;
+
+	return( 1 );
+
+on_error:
+	if( file_descriptor != -1 )
+	{
+		close(
+		 file_descriptor );
+	}
+	return( -1 );
+
+#else
+	libcerror_error_set(
+	 error,
+	 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+	 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+	 "%s: memory mapped files are not supported.",
+	 function );
+
+	return( -1 );
+#endif
+}
+
+/* Unmaps the file
+ * Returns 0 if successful or -1 on error
+ */
+int libfwevt_file_mapping_close(
+     libfwevt_file_mapping_t *file_mapping,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_file_mapping_close";
+	int result            = 0;
+
+#if defined( WINAPI )
+	DWORD error_code      = 0;
+#endif
+
+	if( file_mapping == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file mapping.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_mapping->data == NULL )
+	{
+		return( 0 );
+	}
+#if defined( WINAPI )
+	if( UnmapViewOfFile(
+	     (LPCVOID) file_mapping->data ) == 0 )
+	{
+		error_code = GetLastError();
+
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 (uint32_t) error_code,
+		 "%s: unable to unmap view of file.",
+		 function );
+
+		result = -1;
+	}
+	if( file_mapping->mapping_handle != NULL )
+	{
+		CloseHandle(
+		 file_mapping->mapping_handle );
+
+		file_mapping->mapping_handle = NULL;
+	}
+	if( file_mapping->file_handle != INVALID_HANDLE_VALUE )
+	{
+		CloseHandle(
+		 file_mapping->file_handle );
+
+		file_mapping->file_handle = INVALID_HANDLE_VALUE;
+	}
+#elif defined( HAVE_POSIX_FILE_MAPPING )
+	if( munmap(
+	     (void *) file_mapping->data,
+	     file_mapping->data_size ) != 0 )
+	{
+		libcerror_system_set_error(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 (uint32_t) errno,
+		 "%s: unable to unmap file.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	file_mapping->data      = NULL;
+	file_mapping->data_size = 0;
+
+	return( result );
+}
+
@@ -0,0 +1,79 @@
+/*
+ * Memory mapped file functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWEVT_FILE_MAPPING_H )
+#define _LIBFWEVT_FILE_MAPPING_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwevt_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfwevt_file_mapping libfwevt_file_mapping_t;
+
+struct libfwevt_file_mapping
+{
+	/* The mapped data
+	 */
+	uint8_t *data;
+
+	/* The mapped data size
+	 */
+	size_t data_size;
+
+#if defined( WINAPI )
+	/* The file handle
+	 */
+	HANDLE file_handle;
+
+	/* The file mapping handle
+	 */
+	HANDLE mapping_handle;
+#endif
+};
+
+int libfwevt_file_mapping_initialize(
+     libfwevt_file_mapping_t **file_mapping,
+     libcerror_error_t **error );
+
+int libfwevt_file_mapping_free(
+     libfwevt_file_mapping_t **file_mapping,
+     libcerror_error_t **error );
+
+int libfwevt_file_mapping_open(
+     libfwevt_file_mapping_t *file_mapping,
+     const char *filename,
+     libcerror_error_t **error );
+
+int libfwevt_file_mapping_close(
+     libfwevt_file_mapping_t *file_mapping,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWEVT_FILE_MAPPING_H ) */
+
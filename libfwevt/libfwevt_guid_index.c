@@ -0,0 +1,567 @@
+/*
+ * GUID index functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwevt_guid_index.h"
+#include "libfwevt_libcerror.h"
+
+/* The initial number of slots of a GUID index
+ */
+#define LIBFWEVT_GUID_INDEX_INITIAL_NUMBER_OF_SLOTS	16
+
+/* The maximum number of slots of a GUID index
+ */
+#define LIBFWEVT_GUID_INDEX_MAXIMUM_NUMBER_OF_SLOTS \
+	( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libfwevt_guid_index_slot_t ) )
+
+/* Calculates the hash of an identifier (GUID)
+ * Uses the 32-bit FNV-1a hash of the 16 bytes of the GUID
+ * Note that the hash is also stored in manifest archives and must not be changed
+ */
+uint32_t libfwevt_guid_index_calculate_hash(
+          const uint8_t *identifier )
+{
+	uint32_t hash  = 0x811c9dc5UL;
+	uint8_t index  = 0;
+
+	for( index = 0;
+	     index < 16;
+	     index++ )
+	{
+		hash ^= identifier[ index ];
+		hash *= 0x01000193UL;
+	}
+	return( hash );
+}
+
+/* Creates a GUID index
+ * Make sure the value guid_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_guid_index_initialize(
+     libfwevt_guid_index_t **guid_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_guid_index_initialize";
+
+	if( guid_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *guid_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid GUID index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*guid_index = memory_allocate_structure(
+	               libfwevt_guid_index_t );
+
+	if( *guid_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create GUID index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *guid_index,
+	     0,
+	     sizeof( libfwevt_guid_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear GUID index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *guid_index != NULL )
+	{
+		memory_free(
+		 *guid_index );
+
+		*guid_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a GUID index
+ * The values are not freed, these are owned by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_guid_index_free(
+     libfwevt_guid_index_t **guid_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_guid_index_free";
+
+	if( guid_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *guid_index != NULL )
+	{
+		if( ( *guid_index )->slots != NULL )
+		{
+			memory_free(
+			 ( *guid_index )->slots );
+		}
+		memory_free(
+		 *guid_index );
+
+		*guid_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Empties a GUID index
+ * The values are not freed, these are owned by the caller
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_guid_index_empty(
+     libfwevt_guid_index_t *guid_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_guid_index_empty";
+
+	if( guid_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID index.",
+		 function );
+
+		return( -1 );
+	}
+	if( guid_index->slots != NULL )
+	{
+		memory_free(
+		 guid_index->slots );
+
+		guid_index->slots = NULL;
+	}
+	guid_index->number_of_slots  = 0;
+	guid_index->number_of_values = 0;
+
+	return( 1 );
+}
+
+/* Resizes the slots of a GUID index
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_guid_index_resize(
+     libfwevt_guid_index_t *guid_index,
+     uint32_t number_of_slots,
+     libcerror_error_t **error )
+{
+	libfwevt_guid_index_slot_t *slots = NULL;
+	static char *function             = "libfwevt_guid_index_resize";
+	uint32_t hash_mask                = 0;
+	uint32_t slot_index               = 0;
+	uint32_t new_slot_index           = 0;
+
+	if( guid_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_slots == 0 )
+	 || ( ( number_of_slots & ( number_of_slots - 1 ) ) != 0 )
+	 || ( (size_t) number_of_slots > LIBFWEVT_GUID_INDEX_MAXIMUM_NUMBER_OF_SLOTS )
+	 || ( number_of_slots <= guid_index->number_of_values ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of slots value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	slots = (libfwevt_guid_index_slot_t *) memory_allocate(
+	                                        sizeof( libfwevt_guid_index_slot_t ) * number_of_slots );
+
+	if( slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create slots.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     slots,
+	     0,
+	     sizeof( libfwevt_guid_index_slot_t ) * number_of_slots ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear slots.",
+		 function );
+
+		memory_free(
+		 slots );
+
+		return( -1 );
+	}
+	hash_mask = number_of_slots - 1;
+
+	for( slot_index = 0;
+	     slot_index < guid_index->number_of_slots;
+	     slot_index++ )
+	{
+		if( guid_index->slots[ slot_index ].value == NULL )
+		{
+			continue;
+		}
+		new_slot_index = libfwevt_guid_index_calculate_hash(
+		                  guid_index->slots[ slot_index ].identifier ) & hash_mask;
+
+		while( slots[ new_slot_index ].value != NULL )
+		{
+			new_slot_index = ( new_slot_index + 1 ) & hash_mask;
+		}
+		slots[ new_slot_index ] = guid_index->slots[ slot_index ];
+	}
+	if( guid_index->slots != NULL )
+	{
+		memory_free(
+		 guid_index->slots );
+	}
+	guid_index->slots           = slots;
+	guid_index->number_of_slots = number_of_slots;
+
+	return( 1 );
+}
+
+/* Inserts a value into the GUID index
+ * The index is kept at most half full, so that a lookup needs few probes
+ * Returns 1 if successful, 0 if the identifier already has a value or -1 on error
+ */
+int libfwevt_guid_index_insert_value(
+     libfwevt_guid_index_t *guid_index,
+     const uint8_t *identifier,
+     size_t identifier_size,
+     intptr_t *value,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfwevt_guid_index_insert_value";
+	uint32_t hash_mask       = 0;
+	uint32_t number_of_slots = 0;
+	uint32_t slot_index      = 0;
+
+	if( guid_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID index.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier_size != 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid identifier size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( guid_index->number_of_values + 1 ) > ( guid_index->number_of_slots / 2 ) )
+	{
+		if( guid_index->number_of_slots == 0 )
+		{
+			number_of_slots = LIBFWEVT_GUID_INDEX_INITIAL_NUMBER_OF_SLOTS;
+		}
+		else
+		{
+			number_of_slots = guid_index->number_of_slots * 2;
+		}
+		if( libfwevt_guid_index_resize(
+		     guid_index,
+		     number_of_slots,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize slots.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	hash_mask  = guid_index->number_of_slots - 1;
+	slot_index = libfwevt_guid_index_calculate_hash(
+	              identifier ) & hash_mask;
+
+	while( guid_index->slots[ slot_index ].value != NULL )
+	{
+		if( memory_compare(
+		     guid_index->slots[ slot_index ].identifier,
+		     identifier,
+		     16 ) == 0 )
+		{
+			return( 0 );
+		}
+		slot_index = ( slot_index + 1 ) & hash_mask;
+	}
+	if( memory_copy(
+	     guid_index->slots[ slot_index ].identifier,
+	     identifier,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy identifier.",
+		 function );
+
+		return( -1 );
+	}
+	guid_index->slots[ slot_index ].value = value;
+
+	guid_index->number_of_values += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the number of values
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_guid_index_get_number_of_values(
+     libfwevt_guid_index_t *guid_index,
+     int *number_of_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_guid_index_get_number_of_values";
+
+	if( guid_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of values.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_values = (int) guid_index->number_of_values;
+
+	return( 1 );
+}
+
+/* Retrieves a value by identifier (GUID)
+ * The number of probes is set to the number of slots that were inspected
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwevt_guid_index_get_value_by_identifier(
+     libfwevt_guid_index_t *guid_index,
+     const uint8_t *identifier,
+     size_t identifier_size,
+     intptr_t **value,
+     int *number_of_probes,
+     libcerror_error_t **error )
+{
+	static char *function       = "libfwevt_guid_index_get_value_by_identifier";
+	uint32_t hash_mask          = 0;
+	uint32_t slot_index         = 0;
+	int safe_number_of_probes   = 0;
+
+	if( guid_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid GUID index.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( identifier_size != 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid identifier size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value.",
+		 function );
+
+		return( -1 );
+	}
+	*value = NULL;
+
+	if( guid_index->number_of_slots == 0 )
+	{
+		if( number_of_probes != NULL )
+		{
+			*number_of_probes = 0;
+		}
+		return( 0 );
+	}
+	hash_mask  = guid_index->number_of_slots - 1;
+	slot_index = libfwevt_guid_index_calculate_hash(
+	              identifier ) & hash_mask;
+
+	/* The index is at most half full hence there is always an unused slot
+	 */
+	while( guid_index->slots[ slot_index ].value != NULL )
+	{
+		safe_number_of_probes++;
+
+		if( memory_compare(
+		     guid_index->slots[ slot_index ].identifier,
+		     identifier,
+		     16 ) == 0 )
+		{
+			*value = guid_index->slots[ slot_index ].value;
+
+			break;
+		}
+		slot_index = ( slot_index + 1 ) & hash_mask;
+	}
+	if( *value == NULL )
+	{
+		/* Count the probe of the unused slot that ended the search
+		 */
+		safe_number_of_probes++;
+	}
+	if( number_of_probes != NULL )
+	{
+		*number_of_probes = safe_number_of_probes;
+	}
+	if( *value == NULL )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
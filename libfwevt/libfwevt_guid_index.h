@@ -0,0 +1,111 @@
+/*
+ * GUID index functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWEVT_GUID_INDEX_H )
+#define _LIBFWEVT_GUID_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwevt_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfwevt_guid_index_slot libfwevt_guid_index_slot_t;
+
+struct libfwevt_guid_index_slot
+{
+	/* The identifier
+	 * Contains a GUID
+	 */
+	uint8_t identifier[ 16 ];
+
+	/* The value, NULL if the slot is not used
+	 */
+	intptr_t *value;
+};
+
+typedef struct libfwevt_guid_index libfwevt_guid_index_t;
+
+struct libfwevt_guid_index
+{
+	/* The number of slots
+	 * Is either 0 or a power of 2
+	 */
+	uint32_t number_of_slots;
+
+	/* The number of used slots
+	 */
+	uint32_t number_of_values;
+
+	/* The slots
+	 */
+	libfwevt_guid_index_slot_t *slots;
+};
+
+uint32_t libfwevt_guid_index_calculate_hash(
+          const uint8_t *identifier );
+
+int libfwevt_guid_index_initialize(
+     libfwevt_guid_index_t **guid_index,
+     libcerror_error_t **error );
+
+int libfwevt_guid_index_free(
+     libfwevt_guid_index_t **guid_index,
+     libcerror_error_t **error );
+
+int libfwevt_guid_index_empty(
+     libfwevt_guid_index_t *guid_index,
+     libcerror_error_t **error );
+
+int libfwevt_guid_index_resize(
+     libfwevt_guid_index_t *guid_index,
+     uint32_t number_of_slots,
+     libcerror_error_t **error );
+
+int libfwevt_guid_index_insert_value(
+     libfwevt_guid_index_t *guid_index,
+     const uint8_t *identifier,
+     size_t identifier_size,
+     intptr_t *value,
+     libcerror_error_t **error );
+
+int libfwevt_guid_index_get_number_of_values(
+     libfwevt_guid_index_t *guid_index,
+     int *number_of_values,
+     libcerror_error_t **error );
+
+int libfwevt_guid_index_get_value_by_identifier(
+     libfwevt_guid_index_t *guid_index,
+     const uint8_t *identifier,
+     size_t identifier_size,
+     intptr_t **value,
+     int *number_of_probes,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWEVT_GUID_INDEX_H ) */
+
@@ -22,6 +22,10 @@
 #include <common.h>
 #include <types.h>
 
+#if defined( _MSC_VER ) && defined( _M_X64 )
+#include <intrin.h>
+#endif
+
 #include "libfwevt_integer.h"
 #include "libfwevt_libcerror.h"
 
@@ -138,6 +142,213 @@ int libfwevt_integer_copy_from_utf16_stream(
 	return( 1 );
 }
 
+/* The decimal digit pairs 00 to 99
+ */
+static const uint8_t libfwevt_integer_decimal_digit_pairs[ 201 ] =
+	"00010203040506070809"
+	"10111213141516171819"
+	"20212223242526272829"
+	"30313233343536373839"
+	"40414243444546474849"
+	"50515253545556575859"
+	"60616263646566676869"
+	"70717273747576777879"
+	"80818283848586878889"
+	"90919293949596979899";
+
+/* The hexadecimal digits
+ */
+static const uint8_t libfwevt_integer_hexadecimal_digits[ 17 ] =
+	"0123456789abcdef";
+
+/* The powers of 10 that fit in a 64-bit integer
+ */
+static const uint64_t libfwevt_integer_powers_of_10[ 20 ] = {
+	(uint64_t) 1UL,
+	(uint64_t) 10UL,
+	(uint64_t) 100UL,
+	(uint64_t) 1000UL,
+	(uint64_t) 10000UL,
+	(uint64_t) 100000UL,
+	(uint64_t) 1000000UL,
+	(uint64_t) 10000000UL,
+	(uint64_t) 100000000UL,
+	(uint64_t) 1000000000UL,
+	(uint64_t) 10000000000UL,
+	(uint64_t) 100000000000UL,
+	(uint64_t) 1000000000000UL,
+	(uint64_t) 10000000000000UL,
+	(uint64_t) 100000000000000UL,
+	(uint64_t) 1000000000000000UL,
+	(uint64_t) 10000000000000000UL,
+	(uint64_t) 100000000000000000UL,
+	(uint64_t) 1000000000000000000UL,
+	(uint64_t) 10000000000000000000UL };
+
+/* Determines the number of decimal digits of an integer
+ * Returns the number of digits
+ */
+uint8_t libfwevt_integer_get_number_of_decimal_digits(
+         uint64_t integer_value )
+{
+#if defined( _MSC_VER ) && defined( _M_X64 )
+	unsigned long bit_index  = 0;
+#endif
+	uint8_t number_of_digits = 0;
+
+	/* Setting the least significant bit does not change the number of digits
+	 * since a power of 10 minus 1 is odd, but makes 0 a single digit
+	 */
+	integer_value |= 1;
+
+#if defined( __GNUC__ ) || ( defined( _MSC_VER ) && defined( _M_X64 ) )
+#if defined( __GNUC__ )
+	number_of_digits = (uint8_t) ( 64 - __builtin_clzll( integer_value ) );
+#else
+	_BitScanReverse64(
+	 &bit_index,
+	 integer_value );
+
+	number_of_digits = (uint8_t) ( bit_index + 1 );
+#endif
+	/* Approximate log10 of the number of bits with 1233 / 4096 and correct
+	 * the approximation with a single comparison
+	 */
+	number_of_digits = (uint8_t) ( ( (uint32_t) number_of_digits * 1233 ) >> 12 );
+
+	number_of_digits += (uint8_t) ( integer_value >= libfwevt_integer_powers_of_10[ number_of_digits ] );
+#else
+	number_of_digits = 1;
+
+	while( ( number_of_digits < 20 )
+	    && ( integer_value >= libfwevt_integer_powers_of_10[ number_of_digits ] ) )
+	{
+		number_of_digits++;
+	}
+#endif
+	return( number_of_digits );
+}
+
+/* Formats an integer as an unsigned decimal
+ * If characters is NULL only the number of characters is determined, otherwise
+ * it must be able to contain 20 characters
+ * No end of string character is added
+ * Returns the number of characters
+ */
+uint8_t libfwevt_integer_as_unsigned_decimal_format(
+         uint64_t integer_value,
+         uint8_t *characters )
+{
+	size_t digit_pair_index      = 0;
+	uint8_t character_index      = 0;
+	uint8_t number_of_characters = 0;
+
+	number_of_characters = libfwevt_integer_get_number_of_decimal_digits(
+	                        integer_value );
+
+	if( characters == NULL )
+	{
+		return( number_of_characters );
+	}
+	/* The digits are formatted from least significant pair to most significant
+	 */
+	character_index = number_of_characters;
+
+	while( integer_value >= 100 )
+	{
+		digit_pair_index = (size_t) ( integer_value % 100 ) * 2;
+		integer_value   /= 100;
+		character_index -= 2;
+
+		characters[ character_index ]     = libfwevt_integer_decimal_digit_pairs[ digit_pair_index ];
+		characters[ character_index + 1 ] = libfwevt_integer_decimal_digit_pairs[ digit_pair_index + 1 ];
+	}
+	if( integer_value >= 10 )
+	{
+		digit_pair_index = (size_t) integer_value * 2;
+
+		characters[ 0 ] = libfwevt_integer_decimal_digit_pairs[ digit_pair_index ];
+		characters[ 1 ] = libfwevt_integer_decimal_digit_pairs[ digit_pair_index + 1 ];
+	}
+	else
+	{
+		characters[ 0 ] = (uint8_t) '0' + (uint8_t) integer_value;
+	}
+	return( number_of_characters );
+}
+
+/* Formats an integer as a signed decimal
+ * The most significant bit of an integer of integer_size bits is the sign
+ * If characters is NULL only the number of characters is determined, otherwise
+ * it must be able to contain 21 characters
+ * No end of string character is added
+ * Returns the number of characters
+ */
+uint8_t libfwevt_integer_as_signed_decimal_format(
+         uint64_t integer_value,
+         uint8_t integer_size,
+         uint8_t *characters )
+{
+	uint8_t is_negative = 0;
+	int8_t bit_shift    = integer_size - 1;
+
+	is_negative = (uint8_t) ( integer_value >> bit_shift );
+
+	if( is_negative == 0 )
+	{
+		return( libfwevt_integer_as_unsigned_decimal_format(
+		         integer_value,
+		         characters ) );
+	}
+	integer_value &= ~( (uint64_t) 1 << bit_shift );
+
+	if( integer_value == 0 )
+	{
+		integer_value |= (uint64_t) 1 << bit_shift;
+	}
+	if( characters == NULL )
+	{
+		return( 1 + libfwevt_integer_as_unsigned_decimal_format(
+		             integer_value,
+		             NULL ) );
+	}
+	characters[ 0 ] = (uint8_t) '-';
+
+	return( 1 + libfwevt_integer_as_unsigned_decimal_format(
+	             integer_value,
+	             &( characters[ 1 ] ) ) );
+}
+
+/* Formats an integer as hexadecimal with a 0x prefix
+ * The integer is formatted with integer_size / 4 digits
+ * characters must be able to contain 2 + ( integer_size / 4 ) characters
+ * No end of string character is added
+ * Returns the number of characters
+ */
+uint8_t libfwevt_integer_as_hexadecimal_format(
+         uint64_t integer_value,
+         uint8_t integer_size,
+         uint8_t *characters )
+{
+	uint8_t character_index      = 0;
+	uint8_t number_of_characters = 0;
+
+	number_of_characters = 2 + ( integer_size / 4 );
+
+	characters[ 0 ] = (uint8_t) '0';
+	characters[ 1 ] = (uint8_t) 'x';
+
+	for( character_index = number_of_characters - 1;
+	     character_index >= 2;
+	     character_index-- )
+	{
+		characters[ character_index ] = libfwevt_integer_hexadecimal_digits[ integer_value & 0x0f ];
+
+		integer_value >>= 4;
+	}
+	return( number_of_characters );
+}
+
 /* Deterimes the size of the string of the integer as a signed decimal
  * The string size includes the end of string character
  * Returns 1 if successful or -1 on error
@@ -148,11 +359,7 @@ int libfwevt_integer_as_signed_decimal_get_string_size(
      size_t *string_size,
      libcerror_error_t **error )
 {
-	static char *function        = "libfwevt_integer_as_signed_decimal_get_string_size";
-	uint64_t divider             = 0;
-	uint8_t is_negative          = 0;
-	uint8_t number_of_characters = 0;
-	int8_t bit_shift             = integer_size - 1;
+	static char *function = "libfwevt_integer_as_signed_decimal_get_string_size";
 
 	if( string_size == NULL )
 	{
@@ -165,32 +372,10 @@ int libfwevt_integer_as_signed_decimal_get_string_size(
 
 		return( -1 );
 	}
-	/* The string is at least a single digit with an end of string character
-	 */
-	number_of_characters = 2;
-
-	is_negative = (uint8_t) ( integer_value >> bit_shift );
-
-	if( is_negative != 0 )
-	{
-		number_of_characters += 1;
-
-		integer_value &= ~( (uint64_t) 1 << bit_shift );
-
-		if( integer_value == 0 )
-		{
-			integer_value |= (uint64_t) 1 << bit_shift;
-		}
-	}
-	divider = 1;
-
-	while( ( integer_value / divider ) >= 10 )
-	{
-		divider *= 10;
-
-		number_of_characters += 1;
-	}
-	*string_size = number_of_characters;
+	*string_size = 1 + (size_t) libfwevt_integer_as_signed_decimal_format(
+	                             integer_value,
+	                             integer_size,
+	                             NULL );
 
 	return( 1 );
 }
@@ -209,10 +394,7 @@ int libfwevt_integer_as_signed_decimal_copy_to_utf8_string_with_index(
 {
 	static char *function         = "libfwevt_integer_as_signed_decimal_copy_to_utf8_string_with_index";
 	size_t safe_utf8_string_index = 0;
-	uint64_t divider              = 0;
-	uint8_t is_negative           = 0;
 	uint8_t number_of_characters  = 0;
-	int8_t bit_shift              = integer_size - 1;
 
 	if( utf8_string == NULL )
 	{
@@ -249,33 +431,15 @@ int libfwevt_integer_as_signed_decimal_copy_to_utf8_string_with_index(
 	}
 	safe_utf8_string_index = *utf8_string_index;
 
-	/* The string is at least a single digit with an end of string character
-	 */
-	number_of_characters = 2;
-
-	is_negative = (uint8_t) ( integer_value >> bit_shift );
-
-	if( is_negative != 0 )
-	{
-		number_of_characters += 1;
-
-		integer_value &= ~( (uint64_t) 1 << bit_shift );
-
-		if( integer_value == 0 )
-		{
-			integer_value |= (uint64_t) 1 << bit_shift;
-		}
-	}
-	divider = 1;
+	number_of_characters = libfwevt_integer_as_signed_decimal_format(
+	                        integer_value,
+	                        integer_size,
+	                        NULL );
 
-	while( ( integer_value / divider ) >= 10 )
-	{
-		divider *= 10;
-
-		number_of_characters += 1;
-	}
-	if( ( number_of_characters > utf8_string_size )
-	 || ( safe_utf8_string_index > ( utf8_string_size - number_of_characters ) ) )
+	/* The string size includes the end of string character
+	 */
+	if( ( (size_t) number_of_characters >= utf8_string_size )
+	 || ( safe_utf8_string_index > ( utf8_string_size - number_of_characters - 1 ) ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -286,19 +450,11 @@ int libfwevt_integer_as_signed_decimal_copy_to_utf8_string_with_index(
 
 		return( -1 );
 	}
-	if( is_negative != 0 )
-	{
-		utf8_string[ safe_utf8_string_index++ ] = (uint8_t) '-';
-	}
-	while( divider > 1 )
-	{
-		utf8_string[ safe_utf8_string_index++ ] = (uint8_t) '0' + (uint8_t) ( integer_value / divider );
-
-		integer_value %= divider;
+	safe_utf8_string_index += libfwevt_integer_as_signed_decimal_format(
+	                          integer_value,
+	                          integer_size,
+	                          &( utf8_string[ safe_utf8_string_index ] ) );
 
-		divider /= 10;
-	}
-	utf8_string[ safe_utf8_string_index++ ] = (uint8_t) '0' + (uint8_t) ( integer_value / divider );
 	utf8_string[ safe_utf8_string_index++ ] = 0;
 
 	*utf8_string_index = safe_utf8_string_index;
@@ -318,12 +474,12 @@ int libfwevt_integer_as_signed_decimal_copy_to_utf16_string_with_index(
      size_t *utf16_string_index,
      libcerror_error_t **error )
 {
+	uint8_t characters[ 24 ];
+
 	static char *function          = "libfwevt_integer_as_signed_decimal_copy_to_utf16_string_with_index";
 	size_t safe_utf16_string_index = 0;
-	uint64_t divider               = 0;
-	uint8_t is_negative            = 0;
+	uint8_t character_index        = 0;
 	uint8_t number_of_characters   = 0;
-	int8_t bit_shift               = integer_size - 1;
 
 	if( utf16_string == NULL )
 	{
@@ -360,33 +516,17 @@ int libfwevt_integer_as_signed_decimal_copy_to_utf16_string_with_index(
 	}
 	safe_utf16_string_index = *utf16_string_index;
 
-	/* The string is at least a single digit with an end of string character
+	/* The integer is formatted as ASCII and widened to UTF-16
 	 */
-	number_of_characters = 2;
+	number_of_characters = libfwevt_integer_as_signed_decimal_format(
+	                        integer_value,
+	                        integer_size,
+	                        characters );
 
-	is_negative = (uint8_t) ( integer_value >> bit_shift );
-
-	if( is_negative != 0 )
-	{
-		number_of_characters += 1;
-
-		integer_value &= ~( (uint64_t) 1 << bit_shift );
-
-		if( integer_value == 0 )
-		{
-			integer_value |= (uint64_t) 1 << bit_shift;
-		}
-	}
-	divider = 1;
-
-	while( ( integer_value / divider ) >= 10 )
-	{
-		divider *= 10;
-
-		number_of_characters += 1;
-	}
-	if( ( number_of_characters > utf16_string_size )
-	 || ( safe_utf16_string_index > ( utf16_string_size - number_of_characters ) ) )
+	/* The string size includes the end of string character
+	 */
+	if( ( (size_t) number_of_characters >= utf16_string_size )
+	 || ( safe_utf16_string_index > ( utf16_string_size - number_of_characters - 1 ) ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -397,19 +537,12 @@ int libfwevt_integer_as_signed_decimal_copy_to_utf16_string_with_index(
 
 		return( -1 );
 	}
-	if( is_negative != 0 )
+	for( character_index = 0;
+	     character_index < number_of_characters;
+	     character_index++ )
 	{
-		utf16_string[ safe_utf16_string_index++ ] = (uint16_t) '-';
-	}
-	while( divider > 1 )
-	{
-		utf16_string[ safe_utf16_string_index++ ] = (uint16_t) '0' + (uint16_t) ( integer_value / divider );
-
-		integer_value %= divider;
-
-		divider /= 10;
+		utf16_string[ safe_utf16_string_index++ ] = (uint16_t) characters[ character_index ];
 	}
-	utf16_string[ safe_utf16_string_index++ ] = (uint16_t) '0' + (uint16_t) ( integer_value / divider );
 	utf16_string[ safe_utf16_string_index++ ] = 0;
 
 	*utf16_string_index = safe_utf16_string_index;
@@ -426,9 +559,7 @@ int libfwevt_integer_as_unsigned_decimal_get_string_size(
      size_t *string_size,
      libcerror_error_t **error )
 {
-	static char *function        = "libfwevt_integer_as_decimal_get_string_size";
-	uint64_t divider             = 0;
-	uint8_t number_of_characters = 0;
+	static char *function = "libfwevt_integer_as_unsigned_decimal_get_string_size";
 
 	if( string_size == NULL )
 	{
@@ -441,19 +572,9 @@ int libfwevt_integer_as_unsigned_decimal_get_string_size(
 
 		return( -1 );
 	}
-	/* The string is at least a single digit with an end of string character
-	 */
-	number_of_characters = 2;
-
-	divider = 1;
-
-	while( ( integer_value / divider ) >= 10 )
-	{
-		divider *= 10;
-
-		number_of_characters += 1;
-	}
-	*string_size = number_of_characters;
+	*string_size = 1 + (size_t) libfwevt_integer_as_unsigned_decimal_format(
+	                             integer_value,
+	                             NULL );
 
 	return( 1 );
 }
@@ -471,7 +592,6 @@ int libfwevt_integer_as_unsigned_decimal_copy_to_utf8_string_with_index(
 {
 	static char *function         = "libfwevt_integer_as_unsigned_decimal_copy_to_utf8_string_with_index";
 	size_t safe_utf8_string_index = 0;
-	uint64_t divider              = 0;
 	uint8_t number_of_characters  = 0;
 
 	if( utf8_string == NULL )
@@ -509,20 +629,14 @@ int libfwevt_integer_as_unsigned_decimal_copy_to_utf8_string_with_index(
 	}
 	safe_utf8_string_index = *utf8_string_index;
 
-	/* The string is at least a single digit with an end of string character
-	 */
-	number_of_characters = 2;
-
-	divider = 1;
+	number_of_characters = libfwevt_integer_as_unsigned_decimal_format(
+	                        integer_value,
+	                        NULL );
 
-	while( ( integer_value / divider ) >= 10 )
-	{
-		divider *= 10;
-
-		number_of_characters += 1;
-	}
-	if( ( number_of_characters > utf8_string_size )
-	 || ( safe_utf8_string_index > ( utf8_string_size - number_of_characters ) ) )
+	/* The string size includes the end of string character
+	 */
+	if( ( (size_t) number_of_characters >= utf8_string_size )
+	 || ( safe_utf8_string_index > ( utf8_string_size - number_of_characters - 1 ) ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -533,15 +647,10 @@ int libfwevt_integer_as_unsigned_decimal_copy_to_utf8_string_with_index(
 
 		return( -1 );
 	}
-	while( divider > 1 )
-	{
-		utf8_string[ safe_utf8_string_index++ ] = (uint8_t) '0' + (uint8_t) ( integer_value / divider );
-
-		integer_value %= divider;
+	safe_utf8_string_index += libfwevt_integer_as_unsigned_decimal_format(
+	                          integer_value,
+	                          &( utf8_string[ safe_utf8_string_index ] ) );
 
-		divider /= 10;
-	}
-	utf8_string[ safe_utf8_string_index++ ] = (uint8_t) '0' + (uint8_t) ( integer_value / divider );
 	utf8_string[ safe_utf8_string_index++ ] = 0;
 
 	*utf8_string_index = safe_utf8_string_index;
@@ -560,9 +669,11 @@ int libfwevt_integer_as_unsigned_decimal_copy_to_utf16_string_with_index(
      size_t *utf16_string_index,
      libcerror_error_t **error )
 {
+	uint8_t characters[ 24 ];
+
 	static char *function          = "libfwevt_integer_as_unsigned_decimal_copy_to_utf16_string_with_index";
 	size_t safe_utf16_string_index = 0;
-	uint64_t divider               = 0;
+	uint8_t character_index        = 0;
 	uint8_t number_of_characters   = 0;
 
 	if( utf16_string == NULL )
@@ -600,20 +711,16 @@ int libfwevt_integer_as_unsigned_decimal_copy_to_utf16_string_with_index(
 	}
 	safe_utf16_string_index = *utf16_string_index;
 
-	/* The string is at least a single digit with an end of string character
+	/* The integer is formatted as ASCII and widened to UTF-16
 	 */
-	number_of_characters = 2;
+	number_of_characters = libfwevt_integer_as_unsigned_decimal_format(
+	                        integer_value,
+	                        characters );
 
-	divider = 1;
-
-	while( ( integer_value / divider ) >= 10 )
-	{
-		divider *= 10;
-
-		number_of_characters += 1;
-	}
-	if( ( number_of_characters > utf16_string_size )
-	 || ( safe_utf16_string_index > ( utf16_string_size - number_of_characters ) ) )
+	/* The string size includes the end of string character
+	 */
+	if( ( (size_t) number_of_characters >= utf16_string_size )
+	 || ( safe_utf16_string_index > ( utf16_string_size - number_of_characters - 1 ) ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -624,15 +731,12 @@ int libfwevt_integer_as_unsigned_decimal_copy_to_utf16_string_with_index(
 
 		return( -1 );
 	}
-	while( divider > 1 )
+	for( character_index = 0;
+	     character_index < number_of_characters;
+	     character_index++ )
 	{
-		utf16_string[ safe_utf16_string_index++ ] = (uint16_t) '0' + (uint16_t) ( integer_value / divider );
-
-		integer_value %= divider;
-
-		divider /= 10;
+		utf16_string[ safe_utf16_string_index++ ] = (uint16_t) characters[ character_index ];
 	}
-	utf16_string[ safe_utf16_string_index++ ] = (uint16_t) '0' + (uint16_t) ( integer_value / divider );
 	utf16_string[ safe_utf16_string_index++ ] = 0;
 
 	*utf16_string_index = safe_utf16_string_index;
@@ -655,8 +759,6 @@ int libfwevt_integer_as_hexadecimal_copy_to_utf8_string_with_index(
 	static char *function         = "libfwevt_integer_as_hexadecimal_copy_to_utf8_string_with_index";
 	size_t safe_utf8_string_index = 0;
 	uint8_t number_of_characters  = 0;
-	uint8_t byte_value            = 0;
-	int8_t bit_shift              = 0;
 
 	if( integer_size == 32 )
 	{
@@ -724,26 +826,12 @@ int libfwevt_integer_as_hexadecimal_copy_to_utf8_string_with_index(
 
 		return( -1 );
 	}
-	utf8_string[ safe_utf8_string_index++ ] = (uint8_t) '0';
-	utf8_string[ safe_utf8_string_index++ ] = (uint8_t) 'x';
-
-	bit_shift = (uint8_t) ( integer_size - 4 );
+	libfwevt_integer_as_hexadecimal_format(
+	 integer_value,
+	 integer_size,
+	 &( utf8_string[ safe_utf8_string_index ] ) );
 
-	do
-	{
-		byte_value = (uint8_t) ( ( integer_value >> bit_shift ) & 0x0f );
-
-		if( byte_value <= 9 )
-		{
-			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) '0' + byte_value;
-		}
-		else
-		{
-			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) 'a' + byte_value - 10;
-		}
-		bit_shift -= 4;
-	}
-	while( bit_shift >= 0 );
+	safe_utf8_string_index += number_of_characters - 1;
 
 	utf8_string[ safe_utf8_string_index++ ] = 0;
 
@@ -764,11 +852,12 @@ int libfwevt_integer_as_hexadecimal_copy_to_utf16_string_with_index(
      size_t *utf16_string_index,
      libcerror_error_t **error )
 {
+	uint8_t characters[ 24 ];
+
 	static char *function          = "libfwevt_integer_as_hexadecimal_copy_to_utf16_string_with_index";
 	size_t safe_utf16_string_index = 0;
+	uint8_t character_index        = 0;
 	uint8_t number_of_characters   = 0;
-	uint8_t byte_value             = 0;
-	int8_t bit_shift               = 0;
 
 	if( integer_size == 32 )
 	{
@@ -836,27 +925,17 @@ int libfwevt_integer_as_hexadecimal_copy_to_utf16_string_with_index(
 
 		return( -1 );
 	}
-	utf16_string[ safe_utf16_string_index++ ] = (uint16_t) '0';
-	utf16_string[ safe_utf16_string_index++ ] = (uint16_t) 'x';
+	libfwevt_integer_as_hexadecimal_format(
+	 integer_value,
+	 integer_size,
+	 characters );
 
-	bit_shift = (uint16_t) ( integer_size - 4 );
-
-	do
+	for( character_index = 0;
+	     character_index < ( number_of_characters - 1 );
+	     character_index++ )
 	{
-		byte_value = (uint16_t) ( ( integer_value >> bit_shift ) & 0x0f );
-
-		if( byte_value <= 9 )
-		{
-			utf16_string[ safe_utf16_string_index++ ] = (uint16_t) '0' + byte_value;
-		}
-		else
-		{
-			utf16_string[ safe_utf16_string_index++ ] = (uint16_t) 'a' + byte_value - 10;
-		}
-		bit_shift -= 4;
+		utf16_string[ safe_utf16_string_index++ ] = (uint16_t) characters[ character_index ];
 	}
-	while( bit_shift >= 0 );
-
 	utf16_string[ safe_utf16_string_index++ ] = 0;
 
 	*utf16_string_index = safe_utf16_string_index;
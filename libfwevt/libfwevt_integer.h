@@ -37,6 +37,23 @@ int libfwevt_integer_copy_from_utf16_stream(
      size_t utf16_stream_size,
      libcerror_error_t **error );
 
+uint8_t libfwevt_integer_get_number_of_decimal_digits(
+         uint64_t integer_value );
+
+uint8_t libfwevt_integer_as_unsigned_decimal_format(
+         uint64_t integer_value,
+         uint8_t *characters );
+
+uint8_t libfwevt_integer_as_signed_decimal_format(
+         uint64_t integer_value,
+         uint8_t integer_size,
+         uint8_t *characters );
+
+uint8_t libfwevt_integer_as_hexadecimal_format(
+         uint64_t integer_value,
+         uint8_t integer_size,
+         uint8_t *characters );
+
 int libfwevt_integer_as_signed_decimal_get_string_size(
      uint64_t integer_value,
      uint8_t integer_size,
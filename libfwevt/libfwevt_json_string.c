@@ -0,0 +1,483 @@
+/*
+ * JSON string functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwevt_json_string.h"
+#include "libfwevt_libcerror.h"
+#include "libfwevt_libuna.h"
+
+/* Copies an Unicode character to an UTF-8 JSON string
+ * The characters '"' and '\\' and the control characters are escaped
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_utf8_json_string_with_index_copy_from_unicode_character(
+     libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libuna_unicode_character_t unicode_character,
+     libcerror_error_t **error )
+{
+	static char *function         = "libfwevt_utf8_json_string_with_index_copy_from_unicode_character";
+	size_t safe_utf8_string_index = 0;
+	uint8_t escape_character      = 0;
+	uint8_t nibble                = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string index.",
+		 function );
+
+		return( -1 );
+	}
+	safe_utf8_string_index = *utf8_string_index;
+
+	if( unicode_character >= 0x20 )
+	{
+		if( unicode_character == (libuna_unicode_character_t) '"' )
+		{
+			escape_character = (uint8_t) '"';
+		}
+		else if( unicode_character == (libuna_unicode_character_t) '\\' )
+		{
+			escape_character = (uint8_t) '\\';
+		}
+		else if( unicode_character < 0x80 )
+		{
+			if( safe_utf8_string_index >= utf8_string_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: UTF-8 string size too small.",
+				 function );
+
+				return( -1 );
+			}
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) unicode_character;
+
+			*utf8_string_index = safe_utf8_string_index;
+
+			return( 1 );
+		}
+		else
+		{
+			if( libuna_unicode_character_copy_to_utf8(
+			     unicode_character,
+			     utf8_string,
+			     utf8_string_size,
+			     utf8_string_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+				 "%s: unable to copy Unicode character to UTF-8.",
+				 function );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+	}
+	else
+	{
+		switch( unicode_character )
+		{
+			case 0x08:
+				escape_character = (uint8_t) 'b';
+				break;
+
+			case 0x09:
+				escape_character = (uint8_t) 't';
+				break;
+
+			case 0x0a:
+				escape_character = (uint8_t) 'n';
+				break;
+
+			case 0x0c:
+				escape_character = (uint8_t) 'f';
+				break;
+
+			case 0x0d:
+				escape_character = (uint8_t) 'r';
+				break;
+
+			default:
+				break;
+		}
+	}
+	if( escape_character != 0 )
+	{
+		if( ( safe_utf8_string_index + 2 ) > utf8_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string size too small.",
+			 function );
+
+			return( -1 );
+		}
+		utf8_string[ safe_utf8_string_index++ ] = (uint8_t) '\\';
+		utf8_string[ safe_utf8_string_index++ ] = escape_character;
+	}
+	else
+	{
+		/* Replace other control characters by \u00##
+		 */
+		if( ( safe_utf8_string_index + 6 ) > utf8_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string size too small.",
+			 function );
+
+			return( -1 );
+		}
+		utf8_string[ safe_utf8_string_index++ ] = (uint8_t) '\\';
+		utf8_string[ safe_utf8_string_index++ ] = (uint8_t) 'u';
+		utf8_string[ safe_utf8_string_index++ ] = (uint8_t) '0';
+		utf8_string[ safe_utf8_string_index++ ] = (uint8_t) '0';
+
+		nibble = (uint8_t) ( unicode_character >> 4 );
+
+		utf8_string[ safe_utf8_string_index++ ] = (uint8_t) '0' + nibble;
+
+		nibble = (uint8_t) ( unicode_character & 0x0f );
+
+		if( nibble < 10 )
+		{
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) '0' + nibble;
+		}
+		else
+		{
+			utf8_string[ safe_utf8_string_index++ ] = (uint8_t) 'a' + nibble - 10;
+		}
+	}
+	*utf8_string_index = safe_utf8_string_index;
+
+	return( 1 );
+}
+
+/* Copies an UTF-8 JSON string from an UTF-16 stream
+ * The copy stops at the first end-of-string character, the UTF-8 string is always terminated
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_utf8_json_string_with_index_copy_from_utf16_stream(
+     libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     int byte_order,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libfwevt_utf8_json_string_with_index_copy_from_utf16_stream";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t safe_utf8_string_index                = 0;
+	size_t utf16_stream_index                    = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	safe_utf8_string_index = *utf8_string_index;
+
+	while( ( utf16_stream_index + 1 ) < utf16_stream_size )
+	{
+		/* Convert the UTF-16 stream bytes into an Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_utf16_stream(
+		     &unicode_character,
+		     utf16_stream,
+		     utf16_stream_size,
+		     &utf16_stream_index,
+		     byte_order,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-16 stream.",
+			 function );
+
+			return( -1 );
+		}
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+		if( libfwevt_utf8_json_string_with_index_copy_from_unicode_character(
+		     utf8_string,
+		     utf8_string_size,
+		     &safe_utf8_string_index,
+		     unicode_character,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+			 "%s: unable to copy Unicode character to UTF-8 JSON string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( safe_utf8_string_index >= utf8_string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-8 string size too small.",
+		 function );
+
+		return( -1 );
+	}
+	utf8_string[ safe_utf8_string_index++ ] = 0;
+
+	*utf8_string_index = safe_utf8_string_index;
+
+	return( 1 );
+}
+
+/* Copies an UTF-8 JSON string from a byte stream
+ * The copy stops at the first end-of-string character, the UTF-8 string is always terminated
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_utf8_json_string_with_index_copy_from_byte_stream(
+     libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int codepage,
+     libcerror_error_t **error )
+{
+	static char *function                        = "libfwevt_utf8_json_string_with_index_copy_from_byte_stream";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t safe_utf8_string_index                = 0;
+	size_t byte_stream_index                     = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	safe_utf8_string_index = *utf8_string_index;
+
+	while( byte_stream_index < byte_stream_size )
+	{
+		/* Convert the byte stream bytes into an Unicode character
+		 */
+		if( libuna_unicode_character_copy_from_byte_stream(
+		     &unicode_character,
+		     byte_stream,
+		     byte_stream_size,
+		     &byte_stream_index,
+		     codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from byte stream.",
+			 function );
+
+			return( -1 );
+		}
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+		if( libfwevt_utf8_json_string_with_index_copy_from_unicode_character(
+		     utf8_string,
+		     utf8_string_size,
+		     &safe_utf8_string_index,
+		     unicode_character,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+			 "%s: unable to copy Unicode character to UTF-8 JSON string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( safe_utf8_string_index >= utf8_string_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: UTF-8 string size too small.",
+		 function );
+
+		return( -1 );
+	}
+	utf8_string[ safe_utf8_string_index++ ] = 0;
+
+	*utf8_string_index = safe_utf8_string_index;
+
+	return( 1 );
+}
+
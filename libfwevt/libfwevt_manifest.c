@@ -26,8 +26,12 @@
 #include <types.h>
 
 #include "libfwevt_debug.h"
+#include "libfwevt_definitions.h"
+#include "libfwevt_file_mapping.h"
+#include "libfwevt_guid_index.h"
 #include "libfwevt_libcerror.h"
 #include "libfwevt_libcnotify.h"
+#include "libfwevt_libcthreads.h"
 #include "libfwevt_libfguid.h"
 #include "libfwevt_manifest.h"
 #include "libfwevt_provider.h"
@@ -35,6 +39,10 @@
 
 #include "fwevt_template.h"
 
+/* The maximum number of threads used to read a manifest
+ */
+#define LIBFWEVT_MANIFEST_MAXIMUM_NUMBER_OF_THREADS	256
+
 /* Creates a manifest
  * Make sure the value manifest is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -113,6 +121,19 @@ int libfwevt_manifest_initialize(
 
 		goto on_error;
 	}
+	if( libfwevt_guid_index_initialize(
+	     &( internal_manifest->providers_index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create providers index.",
+		 function );
+
+		goto on_error;
+	}
 	*manifest = (libfwevt_manifest_t *) internal_manifest;
 
 	return( 1 );
@@ -120,6 +141,13 @@ int libfwevt_manifest_initialize(
 on_error:
 	if( internal_manifest != NULL )
 	{
+		if( internal_manifest->providers_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_manifest->providers_array ),
+			 NULL,
+			 NULL );
+		}
 		memory_free(
 		 internal_manifest );
 	}
@@ -153,6 +181,19 @@ int libfwevt_manifest_free(
 		internal_manifest = (libfwevt_internal_manifest_t *) *manifest;
 		*manifest         = NULL;
 
+		if( libfwevt_guid_index_free(
+		     &( internal_manifest->providers_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free providers index.",
+			 function );
+
+			result = -1;
+		}
 		if( libcdata_array_free(
 		     &( internal_manifest->providers_array ),
 		     (int (*)(intptr_t **, libcerror_error_t **)) &libfwevt_internal_provider_free,
@@ -167,6 +208,24 @@ int libfwevt_manifest_free(
 
 			result = -1;
 		}
+		/* The file mapping is freed after the providers since they can refer to its data
+		 */
+		if( internal_manifest->file_mapping != NULL )
+		{
+			if( libfwevt_file_mapping_free(
+			     &( internal_manifest->file_mapping ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file mapping.",
+				 function );
+
+				result = -1;
+			}
+		}
 		memory_free(
 		 internal_manifest );
 	}
@@ -181,12 +240,153 @@ int libfwevt_manifest_read(
      const uint8_t *data,
      size_t data_size,
      libcerror_error_t **error )
+{
+	static char *function = "libfwevt_manifest_read";
+
+	if( libfwevt_manifest_read_with_flags(
+	     manifest,
+	     data,
+	     data_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read manifest.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Opens and reads a manifest from a file
+ * The file is mapped read-only into memory and the manifest is read in place,
+ * where the provider tables are read on demand and the templates refer to the mapped data.
+ * The mapping is released when the manifest is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_manifest_open_file(
+     libfwevt_manifest_t *manifest,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_manifest_t *internal_manifest = NULL;
+	static char *function                           = "libfwevt_manifest_open_file";
+
+	if( manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest.",
+		 function );
+
+		return( -1 );
+	}
+	internal_manifest = (libfwevt_internal_manifest_t *) manifest;
+
+	if( internal_manifest->file_mapping != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid manifest - file mapping value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_file_mapping_initialize(
+	     &( internal_manifest->file_mapping ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file mapping.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_file_mapping_open(
+	     internal_manifest->file_mapping,
+	     filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file mapping.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_manifest_read_with_flags(
+	     manifest,
+	     internal_manifest->file_mapping->data,
+	     internal_manifest->file_mapping->data_size,
+	     LIBFWEVT_MANIFEST_READ_FLAG_READ_ON_DEMAND | LIBFWEVT_MANIFEST_READ_FLAG_BORROW_DATA,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read manifest.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_manifest->file_mapping != NULL )
+	{
+		libfwevt_file_mapping_free(
+		 &( internal_manifest->file_mapping ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the manifest using specific read flags
+ * If LIBFWEVT_MANIFEST_READ_FLAG_READ_ON_DEMAND is set only the provider entries are read
+ * and the provider tables are read when they are first accessed. In this case the data
+ * must remain available and unmodified while the manifest is used.
+ * If LIBFWEVT_MANIFEST_READ_FLAG_BORROW_DATA is set the templates refer to the data
+ * instead of storing a copy, which has the same requirement.
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_manifest_read_with_flags(
+     libfwevt_manifest_t *manifest,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t read_flags,
+     libcerror_error_t **error )
 {
 	fwevt_template_manifest_t *wevt_manifest        = NULL;
 	fwevt_template_provider_entry_t *provider_entry = NULL;
 	libfwevt_internal_manifest_t *internal_manifest = NULL;
+	libfwevt_internal_provider_t *safe_provider     = NULL;
 	libfwevt_provider_t *provider                   = NULL;
-	static char *function                           = "libfwevt_manifest_read";
+	static char *function                           = "libfwevt_manifest_read_with_flags";
 	size_t data_offset                              = 0;
 	uint32_t number_of_providers                    = 0;
 	uint32_t provider_data_offset                   = 0;
@@ -233,6 +433,18 @@ int libfwevt_manifest_read(
 
 		return( -1 );
 	}
+	if( ( read_flags & ~( LIBFWEVT_MANIFEST_READ_FLAG_READ_ON_DEMAND | LIBFWEVT_MANIFEST_READ_FLAG_BORROW_DATA ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported read flags: 0x%02" PRIx8 ".",
+		 function,
+		 read_flags );
+
+		return( -1 );
+	}
 	wevt_manifest = (fwevt_template_manifest_t *) data;
 
 #if defined( HAVE_DEBUG_OUTPUT )
@@ -435,194 +647,578 @@ int libfwevt_manifest_read(
 
 			goto on_error;
 		}
-		provider = NULL;
-	}
-/* TODO refactor to read on demand ? */
-	for( provider_index = 0;
-	     provider_index < number_of_providers;
-	     provider_index++ )
-	{
-		if( libcdata_array_get_entry_by_index(
-		     internal_manifest->providers_array,
-		     provider_index,
-		     (intptr_t **) &provider,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve provider: %d.",
-			 function,
-			 provider_index );
-
-			provider = NULL;
+		/* The provider is now managed by the providers array
+		 */
+		safe_provider = (libfwevt_internal_provider_t *) provider;
+		provider      = NULL;
 
-			goto on_error;
-		}
-		if( libfwevt_provider_read_channels(
-		     provider,
-		     data,
-		     data_size,
-		     error ) != 1 )
+		if( ( read_flags & LIBFWEVT_MANIFEST_READ_FLAG_BORROW_DATA ) != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read channels.",
-			 function );
-
-			provider = NULL;
-
-			goto on_error;
+			safe_provider->template_read_flags = LIBFWEVT_TEMPLATE_READ_FLAG_BORROW_DATA;
 		}
-		if( libfwevt_provider_read_events(
-		     provider,
-		     data,
-		     data_size,
-		     error ) != 1 )
+		if( ( read_flags & LIBFWEVT_MANIFEST_READ_FLAG_READ_ON_DEMAND ) != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read events.",
-			 function );
-
-			provider = NULL;
+			if( libfwevt_provider_set_read_on_demand(
+			     (libfwevt_provider_t *) safe_provider,
+			     data,
+			     data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set provider: %" PRIu32 " to be read on demand.",
+				 function,
+				 provider_index );
 
-			goto on_error;
+				goto on_error;
+			}
 		}
-		if( libfwevt_provider_read_keywords(
-		     provider,
-		     data,
-		     data_size,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read keywords.",
-			 function );
 
-			provider = NULL;
-
-			goto on_error;
-		}
-		if( libfwevt_provider_read_levels(
-		     provider,
-		     data,
-		     data_size,
-		     error ) != 1 )
+		/* If the manifest contains multiple providers with the same identifier
+		 * the index refers to the first one
+		 */
+		if( libfwevt_guid_index_insert_value(
+		     internal_manifest->providers_index,
+		     safe_provider->identifier,
+		     16,
+		     (intptr_t *) safe_provider,
+		     error ) == -1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read levels.",
-			 function );
-
-			provider = NULL;
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert provider: %" PRIu32 " into index.",
+			 function,
+			 provider_index );
 
 			goto on_error;
 		}
-		if( libfwevt_provider_read_maps(
-		     provider,
-		     data,
-		     data_size,
-		     error ) != 1 )
+	}
+	if( ( read_flags & LIBFWEVT_MANIFEST_READ_FLAG_READ_ON_DEMAND ) == 0 )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( ( internal_manifest->maximum_number_of_threads > 1 )
+		 && ( number_of_providers > 1 ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read maps.",
-			 function );
-
-			provider = NULL;
+			if( libfwevt_internal_manifest_read_provider_tables_in_threads(
+			     internal_manifest,
+			     data,
+			     data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read provider tables in threads.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
 		}
-		if( libfwevt_provider_read_opcodes(
-		     provider,
-		     data,
-		     data_size,
-		     error ) != 1 )
+		else
+#endif
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read opcodes.",
-			 function );
-
-			provider = NULL;
-
-			goto on_error;
+			for( provider_index = 0;
+			     provider_index < number_of_providers;
+			     provider_index++ )
+			{
+				if( libcdata_array_get_entry_by_index(
+				     internal_manifest->providers_array,
+				     provider_index,
+				     (intptr_t **) &provider,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve provider: %d.",
+					 function,
+					 provider_index );
+
+					provider = NULL;
+
+					goto on_error;
+				}
+				if( libfwevt_internal_manifest_read_provider_tables(
+				     provider,
+				     data,
+				     data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read tables of provider: %d.",
+					 function,
+					 provider_index );
+
+					provider = NULL;
+
+					goto on_error;
+				}
+			}
 		}
-		if( libfwevt_provider_read_tasks(
-		     provider,
-		     data,
-		     data_size,
-		     error ) != 1 )
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( number_of_providers > 0 )
+		{
+			libcnotify_printf(
+			 "\n" );
+		}
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( provider != NULL )
+	{
+		libfwevt_internal_provider_free(
+		 (libfwevt_internal_provider_t **) &provider,
+		 NULL );
+	}
+	libfwevt_guid_index_empty(
+	 internal_manifest->providers_index,
+	 NULL );
+
+	libcdata_array_empty(
+	 internal_manifest->providers_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libfwevt_internal_provider_free,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Reads the tables of a provider
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_internal_manifest_read_provider_tables(
+     libfwevt_provider_t *provider,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_internal_manifest_read_provider_tables";
+
+	if( libfwevt_provider_read_channels(
+	     provider,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read channels.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_provider_read_events(
+	     provider,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read events.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_provider_read_keywords(
+	     provider,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read keywords.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_provider_read_levels(
+	     provider,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read levels.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_provider_read_maps(
+	     provider,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read maps.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_provider_read_opcodes(
+	     provider,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read opcodes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_provider_read_tasks(
+	     provider,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read tasks.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_provider_read_templates(
+	     provider,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read templates.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Reads the tables of the providers assigned to a read thread
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_manifest_read_thread_start_function(
+     libfwevt_manifest_read_thread_context_t *thread_context )
+{
+	libfwevt_provider_t *provider = NULL;
+	static char *function         = "libfwevt_manifest_read_thread_start_function";
+	int provider_index            = 0;
+
+	if( thread_context == NULL )
+	{
+		return( -1 );
+	}
+	thread_context->result = 1;
+
+	for( provider_index = thread_context->first_provider_index;
+	     provider_index < thread_context->number_of_providers;
+	     provider_index += thread_context->provider_index_step )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     thread_context->providers_array,
+		     provider_index,
+		     (intptr_t **) &provider,
+		     &( thread_context->error ) ) != 1 )
 		{
 			libcerror_error_set(
-			 error,
+			 &( thread_context->error ),
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve provider: %d.",
+			 function,
+			 provider_index );
+
+			thread_context->result = -1;
+
+			break;
+		}
+		if( libfwevt_internal_manifest_read_provider_tables(
+		     provider,
+		     thread_context->data,
+		     thread_context->data_size,
+		     &( thread_context->error ) ) != 1 )
+		{
+			libcerror_error_set(
+			 &( thread_context->error ),
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read tasks.",
-			 function );
+			 "%s: unable to read tables of provider: %d.",
+			 function,
+			 provider_index );
 
-			provider = NULL;
+			thread_context->result = -1;
 
-			goto on_error;
+			break;
 		}
-		if( libfwevt_provider_read_templates(
-		     provider,
-		     data,
-		     data_size,
+	}
+	return( thread_context->result );
+}
+
+/* Reads the tables of the providers using multiple threads
+ * The providers are distributed round-robin over the threads, where the calling
+ * thread reads the tables of the first share of providers. The providers themselves
+ * were already appended in their original order.
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_internal_manifest_read_provider_tables_in_threads(
+     libfwevt_internal_manifest_t *internal_manifest,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfwevt_manifest_read_thread_context_t *thread_contexts = NULL;
+	static char *function                                    = "libfwevt_internal_manifest_read_provider_tables_in_threads";
+	size_t thread_contexts_size                              = 0;
+	int number_of_providers                                  = 0;
+	int number_of_started_threads                            = 0;
+	int number_of_threads                                    = 0;
+	int result                                               = 1;
+	int thread_index                                         = 0;
+
+	if( internal_manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_manifest->providers_array,
+	     &number_of_providers,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of providers.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_threads = internal_manifest->maximum_number_of_threads;
+
+	if( number_of_threads > number_of_providers )
+	{
+		number_of_threads = number_of_providers;
+	}
+	if( number_of_threads <= 0 )
+	{
+		return( 1 );
+	}
+	thread_contexts_size = sizeof( libfwevt_manifest_read_thread_context_t ) * number_of_threads;
+
+	thread_contexts = (libfwevt_manifest_read_thread_context_t *) memory_allocate(
+	                                                               thread_contexts_size );
+
+	if( thread_contexts == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create thread contexts.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     thread_contexts,
+	     0,
+	     thread_contexts_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear thread contexts.",
+		 function );
+
+		memory_free(
+		 thread_contexts );
+
+		return( -1 );
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		thread_contexts[ thread_index ].providers_array      = internal_manifest->providers_array;
+		thread_contexts[ thread_index ].data                 = data;
+		thread_contexts[ thread_index ].data_size            = data_size;
+		thread_contexts[ thread_index ].first_provider_index = thread_index;
+		thread_contexts[ thread_index ].number_of_providers  = number_of_providers;
+		thread_contexts[ thread_index ].provider_index_step  = number_of_threads;
+	}
+	/* The first share of providers is read by the calling thread
+	 */
+	for( thread_index = 1;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		if( libcthreads_thread_create(
+		     &( thread_contexts[ thread_index ].thread ),
+		     NULL,
+		     (int (*)(void *)) &libfwevt_manifest_read_thread_start_function,
+		     (void *) &( thread_contexts[ thread_index ] ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read templates.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create read thread: %d.",
+			 function,
+			 thread_index );
 
-			provider = NULL;
+			result = -1;
 
-			goto on_error;
+			break;
 		}
+		number_of_started_threads++;
 	}
-/* TODO end refactor */
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( result == 1 )
 	{
-		if( number_of_providers > 0 )
+		libfwevt_manifest_read_thread_start_function(
+		 &( thread_contexts[ 0 ] ) );
+	}
+	for( thread_index = 1;
+	     thread_index <= number_of_started_threads;
+	     thread_index++ )
+	{
+		if( libcthreads_thread_join(
+		     &( thread_contexts[ thread_index ].thread ),
+		     ( result == 1 ) ? error : NULL ) != 1 )
 		{
-			libcnotify_printf(
-			 "\n" );
+			if( result == 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join read thread: %d.",
+				 function,
+				 thread_index );
+			}
+			result = -1;
 		}
 	}
-#endif
-	return( 1 );
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		if( thread_contexts[ thread_index ].error == NULL )
+		{
+			continue;
+		}
+		/* Pass the error of the first failing thread on to the caller
+		 */
+		if( ( result == 1 )
+		 && ( error != NULL )
+		 && ( *error == NULL ) )
+		{
+			*error = thread_contexts[ thread_index ].error;
 
-on_error:
-	if( provider != NULL )
+			thread_contexts[ thread_index ].error = NULL;
+		}
+		else
+		{
+			libcerror_error_free(
+			 &( thread_contexts[ thread_index ].error ) );
+		}
+		result = -1;
+	}
+	memory_free(
+	 thread_contexts );
+
+	return( result );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Sets the maximum number of threads used to read the provider tables
+ * A value of 0 or 1 reads the provider tables in the calling thread
+ * The value is ignored if multi-threading is not supported
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_manifest_set_maximum_number_of_threads(
+     libfwevt_manifest_t *manifest,
+     int maximum_number_of_threads,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_manifest_t *internal_manifest = NULL;
+	static char *function                           = "libfwevt_manifest_set_maximum_number_of_threads";
+
+	if( manifest == NULL )
 	{
-		libfwevt_internal_provider_free(
-		 (libfwevt_internal_provider_t **) &provider,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest.",
+		 function );
+
+		return( -1 );
 	}
-	libcdata_array_empty(
-	 internal_manifest->providers_array,
-	 (int (*)(intptr_t **, libcerror_error_t **)) &libfwevt_internal_provider_free,
-	 NULL );
+	internal_manifest = (libfwevt_internal_manifest_t *) manifest;
 
-	return( -1 );
+	if( ( maximum_number_of_threads < 0 )
+	 || ( maximum_number_of_threads > LIBFWEVT_MANIFEST_MAXIMUM_NUMBER_OF_THREADS ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	internal_manifest->maximum_number_of_threads = maximum_number_of_threads;
+
+	return( 1 );
 }
 
 /* Retrieves the number of providers
@@ -721,10 +1317,8 @@ int libfwevt_manifest_get_provider_by_identifier(
      libcerror_error_t **error )
 {
 	libfwevt_internal_manifest_t *internal_manifest = NULL;
-	libfwevt_provider_t *safe_provider              = NULL;
 	static char *function                           = "libfwevt_manifest_get_provider_by_identifier";
-	int number_of_providers                         = 0;
-	int provider_index                              = 0;
+	int number_of_probes                            = 0;
 	int result                                      = 0;
 
 	if( manifest == NULL )
@@ -773,67 +1367,34 @@ int libfwevt_manifest_get_provider_by_identifier(
 
 		return( -1 );
 	}
-	*provider = NULL;
-
-	if( libcdata_array_get_number_of_entries(
-	     internal_manifest->providers_array,
-	     &number_of_providers,
-	     error ) != 1 )
+	result = libfwevt_guid_index_get_value_by_identifier(
+	          internal_manifest->providers_index,
+	          provider_identifier,
+	          provider_identifier_size,
+	          (intptr_t **) provider,
+	          &number_of_probes,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries.",
+		 "%s: unable to retrieve provider from index.",
 		 function );
 
 		return( -1 );
 	}
-	for( provider_index = 0;
-	     provider_index < number_of_providers;
-	     provider_index++ )
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     internal_manifest->providers_array,
-		     provider_index,
-		     (intptr_t **) &safe_provider,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve entry: %d.",
-			 function,
-			 provider_index );
-
-			return( -1 );
-		}
-		result = libfwevt_provider_compare_identifier(
-		          safe_provider,
-		          provider_identifier,
-		          16,
-		          error );
-
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to compare identifier of provider: %d.",
-			 function,
-			 provider_index );
-
-			return( -1 );
-		}
-		else if( result != 0 )
-		{
-			*provider = safe_provider;
-
-			return( 1 );
-		}
+		libcnotify_printf(
+		 "%s: number of index probes\t\t\t\t: %d\n",
+		 function,
+		 number_of_probes );
 	}
-	return( 0 );
+#endif
+	return( result );
 }
 
@@ -26,8 +26,11 @@
 #include <types.h>
 
 #include "libfwevt_extern.h"
+#include "libfwevt_file_mapping.h"
+#include "libfwevt_guid_index.h"
 #include "libfwevt_libcdata.h"
 #include "libfwevt_libcerror.h"
+#include "libfwevt_libcthreads.h"
 #include "libfwevt_types.h"
 
 #if defined( __cplusplus )
@@ -49,8 +52,68 @@ struct libfwevt_internal_manifest
 	/* The providers array
 	 */
 	libcdata_array_t *providers_array;
+
+	/* The providers index
+	 * Maps a provider identifier (GUID) to a provider in the providers array
+	 */
+	libfwevt_guid_index_t *providers_index;
+
+	/* The file mapping
+	 * Only set if the manifest was opened from a file
+	 */
+	libfwevt_file_mapping_t *file_mapping;
+
+	/* The maximum number of threads used to read the provider tables
+	 */
+	int maximum_number_of_threads;
+};
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct libfwevt_manifest_read_thread_context libfwevt_manifest_read_thread_context_t;
+
+struct libfwevt_manifest_read_thread_context
+{
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+
+	/* The providers array
+	 */
+	libcdata_array_t *providers_array;
+
+	/* The manifest data
+	 */
+	const uint8_t *data;
+
+	/* The manifest data size
+	 */
+	size_t data_size;
+
+	/* The index of the first provider read by the thread
+	 */
+	int first_provider_index;
+
+	/* The number of providers
+	 */
+	int number_of_providers;
+
+	/* The provider index step
+	 * Contains the number of threads
+	 */
+	int provider_index_step;
+
+	/* The result
+	 */
+	int result;
+
+	/* The error
+	 */
+	libcerror_error_t *error;
 };
 
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 LIBFWEVT_EXTERN \
 int libfwevt_manifest_initialize(
      libfwevt_manifest_t **manifest,
@@ -68,6 +131,45 @@ int libfwevt_manifest_read(
      size_t data_size,
      libcerror_error_t **error );
 
+LIBFWEVT_EXTERN \
+int libfwevt_manifest_open_file(
+     libfwevt_manifest_t *manifest,
+     const char *filename,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_manifest_read_with_flags(
+     libfwevt_manifest_t *manifest,
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t read_flags,
+     libcerror_error_t **error );
+
+int libfwevt_internal_manifest_read_provider_tables(
+     libfwevt_provider_t *provider,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int libfwevt_manifest_read_thread_start_function(
+     libfwevt_manifest_read_thread_context_t *thread_context );
+
+int libfwevt_internal_manifest_read_provider_tables_in_threads(
+     libfwevt_internal_manifest_t *internal_manifest,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+LIBFWEVT_EXTERN \
+int libfwevt_manifest_set_maximum_number_of_threads(
+     libfwevt_manifest_t *manifest,
+     int maximum_number_of_threads,
+     libcerror_error_t **error );
+
 LIBFWEVT_EXTERN \
 int libfwevt_manifest_get_number_of_providers(
      libfwevt_manifest_t *manifest,
@@ -0,0 +1,1956 @@
+/*
+ * Manifest archive functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwevt_data_segment.h"
+#include "libfwevt_definitions.h"
+#include "libfwevt_file_mapping.h"
+#include "libfwevt_guid_index.h"
+#include "libfwevt_libcdata.h"
+#include "libfwevt_libcerror.h"
+#include "libfwevt_libcnotify.h"
+#include "libfwevt_libcthreads.h"
+#include "libfwevt_manifest.h"
+#include "libfwevt_manifest_archive.h"
+#include "libfwevt_provider.h"
+
+#include "fwevt_manifest_archive.h"
+
+/* The manifest archive format version
+ */
+#define LIBFWEVT_MANIFEST_ARCHIVE_FORMAT_VERSION		1
+
+/* The initial number of provider index slots of a manifest archive
+ */
+#define LIBFWEVT_MANIFEST_ARCHIVE_INITIAL_NUMBER_OF_INDEX_SLOTS	16
+
+/* The maximum number of manifests of a manifest archive
+ */
+#define LIBFWEVT_MANIFEST_ARCHIVE_MAXIMUM_NUMBER_OF_MANIFESTS	65536
+
+/* The value of the manifest index of an unused provider index slot
+ */
+#define LIBFWEVT_MANIFEST_ARCHIVE_UNUSED_INDEX_SLOT		0xffffffffUL
+
+/* Creates a manifest archive
+ * Make sure the value manifest_archive is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_manifest_archive_initialize(
+     libfwevt_manifest_archive_t **manifest_archive,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_manifest_archive_t *internal_manifest_archive = NULL;
+	static char *function                                           = "libfwevt_manifest_archive_initialize";
+
+	if( manifest_archive == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest archive.",
+		 function );
+
+		return( -1 );
+	}
+	if( *manifest_archive != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid manifest archive value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_manifest_archive = memory_allocate_structure(
+	                             libfwevt_internal_manifest_archive_t );
+
+	if( internal_manifest_archive == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create manifest archive.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_manifest_archive,
+	     0,
+	     sizeof( libfwevt_internal_manifest_archive_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear manifest archive.",
+		 function );
+
+		memory_free(
+		 internal_manifest_archive );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( internal_manifest_archive->data_segments_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data segments array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( internal_manifest_archive->manifests_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create manifests array.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_manifest_archive->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	*manifest_archive = (libfwevt_manifest_archive_t *) internal_manifest_archive;
+
+	return( 1 );
+
+on_error:
+	if( internal_manifest_archive != NULL )
+	{
+		if( internal_manifest_archive->manifests_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_manifest_archive->manifests_array ),
+			 NULL,
+			 NULL );
+		}
+		if( internal_manifest_archive->data_segments_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_manifest_archive->data_segments_array ),
+			 NULL,
+			 NULL );
+		}
+		memory_free(
+		 internal_manifest_archive );
+	}
+	return( -1 );
+}
+
+/* Frees a manifest archive
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_manifest_archive_free(
+     libfwevt_manifest_archive_t **manifest_archive,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_manifest_archive_t *internal_manifest_archive = NULL;
+	static char *function                                           = "libfwevt_manifest_archive_free";
+	int result                                                      = 1;
+
+	if( manifest_archive == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest archive.",
+		 function );
+
+		return( -1 );
+	}
+	if( *manifest_archive != NULL )
+	{
+		internal_manifest_archive = (libfwevt_internal_manifest_archive_t *) *manifest_archive;
+		*manifest_archive         = NULL;
+
+		/* The manifests are freed first since they refer to the data segments or the file mapping
+		 */
+		if( libcdata_array_free(
+		     &( internal_manifest_archive->manifests_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfwevt_manifest_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free manifests array.",
+			 function );
+
+			result = -1;
+		}
+		if( libcdata_array_free(
+		     &( internal_manifest_archive->data_segments_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfwevt_data_segment_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free data segments array.",
+			 function );
+
+			result = -1;
+		}
+		if( internal_manifest_archive->file_mapping != NULL )
+		{
+			if( libfwevt_file_mapping_free(
+			     &( internal_manifest_archive->file_mapping ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free file mapping.",
+				 function );
+
+				result = -1;
+			}
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_manifest_archive->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 internal_manifest_archive );
+	}
+	return( result );
+}
+
+/* Appends manifest data to the manifest archive
+ * The data is copied and validated by reading the manifest
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_manifest_archive_append_manifest_data(
+     libfwevt_manifest_archive_t *manifest_archive,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfwevt_data_segment_t *data_segment                           = NULL;
+	libfwevt_internal_manifest_archive_t *internal_manifest_archive = NULL;
+	libfwevt_manifest_t *manifest                                   = NULL;
+	static char *function                                           = "libfwevt_manifest_archive_append_manifest_data";
+	int entry_index                                                 = 0;
+	int number_of_manifests                                         = 0;
+
+	if( manifest_archive == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest archive.",
+		 function );
+
+		return( -1 );
+	}
+	internal_manifest_archive = (libfwevt_internal_manifest_archive_t *) manifest_archive;
+
+	if( internal_manifest_archive->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid manifest archive - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size == 0 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_manifest_archive->manifests_array,
+	     &number_of_manifests,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of manifests.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_manifests >= LIBFWEVT_MANIFEST_ARCHIVE_MAXIMUM_NUMBER_OF_MANIFESTS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of manifests value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_data_segment_initialize(
+	     &data_segment,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create data segment.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_manifest_initialize(
+	     &manifest,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create manifest.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_manifest_read_with_flags(
+	     manifest,
+	     data_segment->data,
+	     data_segment->data_size,
+	     LIBFWEVT_MANIFEST_READ_FLAG_READ_ON_DEMAND | LIBFWEVT_MANIFEST_READ_FLAG_BORROW_DATA,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read manifest.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_append_entry(
+	     internal_manifest_archive->data_segments_array,
+	     &entry_index,
+	     (intptr_t *) data_segment,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append data segment to array.",
+		 function );
+
+		goto on_error;
+	}
+	/* The data segment is now managed by the data segments array
+	 */
+	data_segment = NULL;
+
+	if( libcdata_array_append_entry(
+	     internal_manifest_archive->manifests_array,
+	     &entry_index,
+	     (intptr_t *) manifest,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append manifest to array.",
+		 function );
+
+		/* Remove the data segment so that the arrays remain in sync
+		 */
+		libcdata_array_resize(
+		 internal_manifest_archive->data_segments_array,
+		 number_of_manifests,
+		 (int (*)(intptr_t **, libcerror_error_t **)) &libfwevt_data_segment_free,
+		 NULL );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( manifest != NULL )
+	{
+		libfwevt_manifest_free(
+		 &manifest,
+		 NULL );
+	}
+	if( data_segment != NULL )
+	{
+		libfwevt_data_segment_free(
+		 &data_segment,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determines the layout of the manifest archive to write
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_internal_manifest_archive_get_write_layout(
+     libfwevt_internal_manifest_archive_t *internal_manifest_archive,
+     uint32_t *number_of_index_slots,
+     size_t *write_size,
+     libcerror_error_t **error )
+{
+	libfwevt_data_segment_t *data_segment = NULL;
+	libfwevt_manifest_t *manifest         = NULL;
+	static char *function                 = "libfwevt_internal_manifest_archive_get_write_layout";
+	uint64_t safe_write_size              = 0;
+	uint32_t safe_number_of_index_slots   = 0;
+	uint32_t total_number_of_providers    = 0;
+	int manifest_index                    = 0;
+	int number_of_manifests               = 0;
+	int number_of_providers               = 0;
+
+	if( internal_manifest_archive == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest archive.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_manifest_archive->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid manifest archive - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_index_slots == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of index slots.",
+		 function );
+
+		return( -1 );
+	}
+	if( write_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid write size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_manifest_archive->manifests_array,
+	     &number_of_manifests,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of manifests.",
+		 function );
+
+		return( -1 );
+	}
+	safe_write_size = sizeof( fwevt_manifest_archive_header_t )
+	                + ( (uint64_t) number_of_manifests * sizeof( fwevt_manifest_archive_manifest_entry_t ) );
+
+	for( manifest_index = 0;
+	     manifest_index < number_of_manifests;
+	     manifest_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_manifest_archive->manifests_array,
+		     manifest_index,
+		     (intptr_t **) &manifest,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve manifest: %d.",
+			 function,
+			 manifest_index );
+
+			return( -1 );
+		}
+		if( libfwevt_manifest_get_number_of_providers(
+		     manifest,
+		     &number_of_providers,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of providers of manifest: %d.",
+			 function,
+			 manifest_index );
+
+			return( -1 );
+		}
+		total_number_of_providers += (uint32_t) number_of_providers;
+	}
+	if( total_number_of_providers > ( (uint32_t) INT32_MAX / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid total number of providers value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Keep the provider index at most half full to keep the probe sequences short
+	 */
+	safe_number_of_index_slots = LIBFWEVT_MANIFEST_ARCHIVE_INITIAL_NUMBER_OF_INDEX_SLOTS;
+
+	while( safe_number_of_index_slots < ( total_number_of_providers * 2 ) )
+	{
+		safe_number_of_index_slots *= 2;
+	}
+	safe_write_size += (uint64_t) safe_number_of_index_slots * sizeof( fwevt_manifest_archive_index_entry_t );
+
+	for( manifest_index = 0;
+	     manifest_index < number_of_manifests;
+	     manifest_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_manifest_archive->data_segments_array,
+		     manifest_index,
+		     (intptr_t **) &data_segment,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data segment: %d.",
+			 function,
+			 manifest_index );
+
+			return( -1 );
+		}
+		if( data_segment == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing data segment: %d.",
+			 function,
+			 manifest_index );
+
+			return( -1 );
+		}
+		/* The manifest data is stored 8-byte aligned
+		 */
+		safe_write_size  = ( safe_write_size + 7 ) & ~( (uint64_t) 7 );
+		safe_write_size += data_segment->data_size;
+	}
+	if( ( safe_write_size > (uint64_t) UINT32_MAX )
+	 || ( safe_write_size > (uint64_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid write size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_index_slots = safe_number_of_index_slots;
+	*write_size            = (size_t) safe_write_size;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the data needed to write the manifest archive
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_manifest_archive_get_write_size(
+     libfwevt_manifest_archive_t *manifest_archive,
+     size_t *write_size,
+     libcerror_error_t **error )
+{
+	static char *function          = "libfwevt_manifest_archive_get_write_size";
+	uint32_t number_of_index_slots = 0;
+
+	if( manifest_archive == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest archive.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_internal_manifest_archive_get_write_layout(
+	     (libfwevt_internal_manifest_archive_t *) manifest_archive,
+	     &number_of_index_slots,
+	     write_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine write layout.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes the manifest archive
+ * The data must be at least the size returned by libfwevt_manifest_archive_get_write_size
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_manifest_archive_write(
+     libfwevt_manifest_archive_t *manifest_archive,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t provider_identifier[ 16 ];
+
+	fwevt_manifest_archive_header_t *file_header                    = NULL;
+	fwevt_manifest_archive_index_entry_t *index_entry               = NULL;
+	fwevt_manifest_archive_manifest_entry_t *manifest_entry         = NULL;
+	libfwevt_data_segment_t *data_segment                           = NULL;
+	libfwevt_internal_manifest_archive_t *internal_manifest_archive = NULL;
+	libfwevt_manifest_t *manifest                                   = NULL;
+	libfwevt_provider_t *provider                                   = NULL;
+	static char *function                                           = "libfwevt_manifest_archive_write";
+	size_t data_offset                                              = 0;
+	size_t write_size                                               = 0;
+	uint32_t index_offset                                           = 0;
+	uint32_t index_slot                                             = 0;
+	uint32_t number_of_index_slots                                  = 0;
+	uint32_t slot_manifest_index                                    = 0;
+	int manifest_index                                              = 0;
+	int number_of_manifests                                         = 0;
+	int number_of_providers                                         = 0;
+	int provider_index                                              = 0;
+
+	if( manifest_archive == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest archive.",
+		 function );
+
+		return( -1 );
+	}
+	internal_manifest_archive = (libfwevt_internal_manifest_archive_t *) manifest_archive;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_internal_manifest_archive_get_write_layout(
+	     internal_manifest_archive,
+	     &number_of_index_slots,
+	     &write_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine write layout.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < write_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_manifest_archive->manifests_array,
+	     &number_of_manifests,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of manifests.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     data,
+	     0,
+	     write_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data.",
+		 function );
+
+		return( -1 );
+	}
+	index_offset = (uint32_t) ( sizeof( fwevt_manifest_archive_header_t )
+	             + ( number_of_manifests * sizeof( fwevt_manifest_archive_manifest_entry_t ) ) );
+
+	file_header = (fwevt_manifest_archive_header_t *) data;
+
+	if( memory_copy(
+	     file_header->signature,
+	     "FWEVTARC",
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->format_version,
+	 LIBFWEVT_MANIFEST_ARCHIVE_FORMAT_VERSION );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->file_size,
+	 (uint32_t) write_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->number_of_manifests,
+	 (uint32_t) number_of_manifests );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->manifests_table_offset,
+	 (uint32_t) sizeof( fwevt_manifest_archive_header_t ) );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->number_of_index_slots,
+	 number_of_index_slots );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 file_header->index_offset,
+	 index_offset );
+
+	for( index_slot = 0;
+	     index_slot < number_of_index_slots;
+	     index_slot++ )
+	{
+		index_entry = (fwevt_manifest_archive_index_entry_t *) &( data[ index_offset + ( index_slot * sizeof( fwevt_manifest_archive_index_entry_t ) ) ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 index_entry->manifest_index,
+		 LIBFWEVT_MANIFEST_ARCHIVE_UNUSED_INDEX_SLOT );
+	}
+	data_offset = (size_t) index_offset + ( (size_t) number_of_index_slots * sizeof( fwevt_manifest_archive_index_entry_t ) );
+
+	for( manifest_index = 0;
+	     manifest_index < number_of_manifests;
+	     manifest_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_manifest_archive->data_segments_array,
+		     manifest_index,
+		     (intptr_t **) &data_segment,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data segment: %d.",
+			 function,
+			 manifest_index );
+
+			return( -1 );
+		}
+		data_offset = ( data_offset + 7 ) & ~( (size_t) 7 );
+
+		if( memory_copy(
+		     &( data[ data_offset ] ),
+		     data_segment->data,
+		     data_segment->data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy manifest: %d data.",
+			 function,
+			 manifest_index );
+
+			return( -1 );
+		}
+		manifest_entry = (fwevt_manifest_archive_manifest_entry_t *) &( data[ sizeof( fwevt_manifest_archive_header_t ) + ( manifest_index * sizeof( fwevt_manifest_archive_manifest_entry_t ) ) ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 manifest_entry->data_offset,
+		 (uint32_t) data_offset );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 manifest_entry->data_size,
+		 (uint32_t) data_segment->data_size );
+
+		data_offset += data_segment->data_size;
+
+		if( libcdata_array_get_entry_by_index(
+		     internal_manifest_archive->manifests_array,
+		     manifest_index,
+		     (intptr_t **) &manifest,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve manifest: %d.",
+			 function,
+			 manifest_index );
+
+			return( -1 );
+		}
+		if( libfwevt_manifest_get_number_of_providers(
+		     manifest,
+		     &number_of_providers,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of providers of manifest: %d.",
+			 function,
+			 manifest_index );
+
+			return( -1 );
+		}
+		for( provider_index = 0;
+		     provider_index < number_of_providers;
+		     provider_index++ )
+		{
+			if( libfwevt_manifest_get_provider_by_index(
+			     manifest,
+			     provider_index,
+			     &provider,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve provider: %d of manifest: %d.",
+				 function,
+				 provider_index,
+				 manifest_index );
+
+				return( -1 );
+			}
+			if( libfwevt_provider_get_identifier(
+			     provider,
+			     provider_identifier,
+			     16,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve identifier of provider: %d of manifest: %d.",
+				 function,
+				 provider_index,
+				 manifest_index );
+
+				libfwevt_provider_free(
+				 &provider,
+				 NULL );
+
+				return( -1 );
+			}
+			if( libfwevt_provider_free(
+			     &provider,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free provider: %d of manifest: %d.",
+				 function,
+				 provider_index,
+				 manifest_index );
+
+				return( -1 );
+			}
+			/* The index is at most half full hence there always is an unused slot
+			 */
+			index_slot = libfwevt_guid_index_calculate_hash(
+			              provider_identifier ) & ( number_of_index_slots - 1 );
+
+			for( ;; )
+			{
+				index_entry = (fwevt_manifest_archive_index_entry_t *) &( data[ index_offset + ( index_slot * sizeof( fwevt_manifest_archive_index_entry_t ) ) ] );
+
+				byte_stream_copy_to_uint32_little_endian(
+				 index_entry->manifest_index,
+				 slot_manifest_index );
+
+				if( slot_manifest_index == LIBFWEVT_MANIFEST_ARCHIVE_UNUSED_INDEX_SLOT )
+				{
+					break;
+				}
+				if( memory_compare(
+				     index_entry->identifier,
+				     provider_identifier,
+				     16 ) == 0 )
+				{
+					break;
+				}
+				index_slot = ( index_slot + 1 ) & ( number_of_index_slots - 1 );
+			}
+			/* If multiple manifests contain a provider with the same identifier
+			 * the index refers to the first one
+			 */
+			if( slot_manifest_index != LIBFWEVT_MANIFEST_ARCHIVE_UNUSED_INDEX_SLOT )
+			{
+				continue;
+			}
+			if( memory_copy(
+			     index_entry->identifier,
+			     provider_identifier,
+			     16 ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy provider identifier.",
+				 function );
+
+				return( -1 );
+			}
+			byte_stream_copy_from_uint32_little_endian(
+			 index_entry->manifest_index,
+			 (uint32_t) manifest_index );
+
+			byte_stream_copy_from_uint32_little_endian(
+			 index_entry->provider_index,
+			 (uint32_t) provider_index );
+		}
+	}
+	return( 1 );
+}
+
+/* Reads the manifest archive
+ * The manifest archive contains the unmodified manifest data and a provider index,
+ * it does not contain decoded event, template or name tables. Only the header and
+ * tables are validated, a manifest is parsed when one of its providers is first looked up
+ * and its events, templates and names are read by the provider as before
+ * The data must remain available and unmodified while the manifest archive is used
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_manifest_archive_read(
+     libfwevt_manifest_archive_t *manifest_archive,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	fwevt_manifest_archive_header_t *file_header                    = NULL;
+	fwevt_manifest_archive_manifest_entry_t *manifest_entry         = NULL;
+	libfwevt_internal_manifest_archive_t *internal_manifest_archive = NULL;
+	static char *function                                           = "libfwevt_manifest_archive_read";
+	uint64_t table_end_offset                                       = 0;
+	uint32_t file_size                                              = 0;
+	uint32_t format_version                                         = 0;
+	uint32_t index_offset                                           = 0;
+	uint32_t manifest_data_offset                                   = 0;
+	uint32_t manifest_data_size                                     = 0;
+	uint32_t manifest_index                                         = 0;
+	uint32_t manifests_table_offset                                 = 0;
+	uint32_t number_of_index_slots                                  = 0;
+	uint32_t number_of_manifests                                    = 0;
+	int number_of_entries                                           = 0;
+
+	if( manifest_archive == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest archive.",
+		 function );
+
+		return( -1 );
+	}
+	internal_manifest_archive = (libfwevt_internal_manifest_archive_t *) manifest_archive;
+
+	if( internal_manifest_archive->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid manifest archive - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_manifest_archive->manifests_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of manifests.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid manifest archive - manifests already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( fwevt_manifest_archive_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	file_header = (fwevt_manifest_archive_header_t *) data;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->file_size,
+	 file_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->number_of_manifests,
+	 number_of_manifests );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->manifests_table_offset,
+	 manifests_table_offset );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->number_of_index_slots,
+	 number_of_index_slots );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 file_header->index_offset,
+	 index_offset );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: signature\t\t\t\t: %c%c%c%c%c%c%c%c\n",
+		 function,
+		 file_header->signature[ 0 ],
+		 file_header->signature[ 1 ],
+		 file_header->signature[ 2 ],
+		 file_header->signature[ 3 ],
+		 file_header->signature[ 4 ],
+		 file_header->signature[ 5 ],
+		 file_header->signature[ 6 ],
+		 file_header->signature[ 7 ] );
+
+		libcnotify_printf(
+		 "%s: format version\t\t\t: %" PRIu32 "\n",
+		 function,
+		 format_version );
+
+		libcnotify_printf(
+		 "%s: file size\t\t\t\t: %" PRIu32 "\n",
+		 function,
+		 file_size );
+
+		libcnotify_printf(
+		 "%s: number of manifests\t\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_manifests );
+
+		libcnotify_printf(
+		 "%s: manifests table offset\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 manifests_table_offset );
+
+		libcnotify_printf(
+		 "%s: number of index slots\t\t: %" PRIu32 "\n",
+		 function,
+		 number_of_index_slots );
+
+		libcnotify_printf(
+		 "%s: index offset\t\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 index_offset );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( memory_compare(
+	     file_header->signature,
+	     "FWEVTARC",
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported manifest archive signature.",
+		 function );
+
+		return( -1 );
+	}
+	if( format_version != LIBFWEVT_MANIFEST_ARCHIVE_FORMAT_VERSION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported manifest archive format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	if( ( file_size < sizeof( fwevt_manifest_archive_header_t ) )
+	 || ( (size_t) file_size > data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid file size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_manifests > LIBFWEVT_MANIFEST_ARCHIVE_MAXIMUM_NUMBER_OF_MANIFESTS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of manifests value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	table_end_offset = (uint64_t) manifests_table_offset
+	                 + ( (uint64_t) number_of_manifests * sizeof( fwevt_manifest_archive_manifest_entry_t ) );
+
+	if( ( manifests_table_offset < sizeof( fwevt_manifest_archive_header_t ) )
+	 || ( table_end_offset > (uint64_t) file_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid manifests table offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_index_slots == 0 )
+	 || ( ( number_of_index_slots & ( number_of_index_slots - 1 ) ) != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported number of index slots: %" PRIu32 ".",
+		 function,
+		 number_of_index_slots );
+
+		return( -1 );
+	}
+	table_end_offset = (uint64_t) index_offset
+	                 + ( (uint64_t) number_of_index_slots * sizeof( fwevt_manifest_archive_index_entry_t ) );
+
+	if( ( index_offset < sizeof( fwevt_manifest_archive_header_t ) )
+	 || ( table_end_offset > (uint64_t) file_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid index offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( manifest_index = 0;
+	     manifest_index < number_of_manifests;
+	     manifest_index++ )
+	{
+		manifest_entry = (fwevt_manifest_archive_manifest_entry_t *) &( data[ manifests_table_offset + ( manifest_index * sizeof( fwevt_manifest_archive_manifest_entry_t ) ) ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 manifest_entry->data_offset,
+		 manifest_data_offset );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 manifest_entry->data_size,
+		 manifest_data_size );
+
+		if( ( manifest_data_offset < sizeof( fwevt_manifest_archive_header_t ) )
+		 || ( manifest_data_offset >= file_size )
+		 || ( manifest_data_size == 0 )
+		 || ( manifest_data_size > ( file_size - manifest_data_offset ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid manifest: %" PRIu32 " data offset or size value out of bounds.",
+			 function,
+			 manifest_index );
+
+			return( -1 );
+		}
+	}
+	/* The manifests are created when first needed
+	 */
+	if( libcdata_array_resize(
+	     internal_manifest_archive->manifests_array,
+	     (int) number_of_manifests,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfwevt_manifest_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize manifests array.",
+		 function );
+
+		return( -1 );
+	}
+	internal_manifest_archive->data                   = data;
+	internal_manifest_archive->data_size              = (size_t) file_size;
+	internal_manifest_archive->number_of_manifests    = number_of_manifests;
+	internal_manifest_archive->manifests_table_offset = manifests_table_offset;
+	internal_manifest_archive->number_of_index_slots  = number_of_index_slots;
+	internal_manifest_archive->index_offset           = index_offset;
+
+	return( 1 );
+}
+
+/* Opens a manifest archive
+ * The file is mapped read-only into memory and read in place,
+ * the manifest data is parsed from the mapping when first needed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_manifest_archive_open(
+     libfwevt_manifest_archive_t *manifest_archive,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_manifest_archive_t *internal_manifest_archive = NULL;
+	static char *function                                           = "libfwevt_manifest_archive_open";
+
+	if( manifest_archive == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest archive.",
+		 function );
+
+		return( -1 );
+	}
+	internal_manifest_archive = (libfwevt_internal_manifest_archive_t *) manifest_archive;
+
+	if( internal_manifest_archive->file_mapping != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid manifest archive - file mapping value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_file_mapping_initialize(
+	     &( internal_manifest_archive->file_mapping ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file mapping.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_file_mapping_open(
+	     internal_manifest_archive->file_mapping,
+	     filename,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file mapping.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_manifest_archive_read(
+	     manifest_archive,
+	     internal_manifest_archive->file_mapping->data,
+	     internal_manifest_archive->file_mapping->data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read manifest archive.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( internal_manifest_archive->file_mapping != NULL )
+	{
+		libfwevt_file_mapping_free(
+		 &( internal_manifest_archive->file_mapping ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a specific manifest
+ * The manifest of a read manifest archive is read on demand, this is done
+ * while holding the read/write lock for writing so that concurrent lookups
+ * read the manifest only once
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_internal_manifest_archive_get_manifest(
+     libfwevt_internal_manifest_archive_t *internal_manifest_archive,
+     uint32_t manifest_index,
+     libfwevt_manifest_t **manifest,
+     libcerror_error_t **error )
+{
+	fwevt_manifest_archive_manifest_entry_t *manifest_entry = NULL;
+	libfwevt_manifest_t *new_manifest                       = NULL;
+	libfwevt_manifest_t *safe_manifest                      = NULL;
+	static char *function                                   = "libfwevt_internal_manifest_archive_get_manifest";
+	uint32_t manifest_data_offset                           = 0;
+	uint32_t manifest_data_size                             = 0;
+	int result                                              = 0;
+
+	if( internal_manifest_archive == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest archive.",
+		 function );
+
+		return( -1 );
+	}
+	if( manifest_index > (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid manifest index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_manifest_archive->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libcdata_array_get_entry_by_index(
+	          internal_manifest_archive->manifests_array,
+	          (int) manifest_index,
+	          (intptr_t **) &safe_manifest,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve manifest: %" PRIu32 ".",
+		 function,
+		 manifest_index );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_manifest_archive->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result != 1 )
+	{
+		return( -1 );
+	}
+	if( ( safe_manifest == NULL )
+	 && ( internal_manifest_archive->data != NULL ) )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     internal_manifest_archive->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		/* Another thread could have read the manifest while the lock was released
+		 */
+		if( libcdata_array_get_entry_by_index(
+		     internal_manifest_archive->manifests_array,
+		     (int) manifest_index,
+		     (intptr_t **) &safe_manifest,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve manifest: %" PRIu32 ".",
+			 function,
+			 manifest_index );
+
+			goto on_error;
+		}
+		if( safe_manifest == NULL )
+		{
+			manifest_entry = (fwevt_manifest_archive_manifest_entry_t *) &( internal_manifest_archive->data[ internal_manifest_archive->manifests_table_offset + ( manifest_index * sizeof( fwevt_manifest_archive_manifest_entry_t ) ) ] );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 manifest_entry->data_offset,
+			 manifest_data_offset );
+
+			byte_stream_copy_to_uint32_little_endian(
+			 manifest_entry->data_size,
+			 manifest_data_size );
+
+			if( libfwevt_manifest_initialize(
+			     &new_manifest,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create manifest.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfwevt_manifest_read_with_flags(
+			     new_manifest,
+			     &( internal_manifest_archive->data[ manifest_data_offset ] ),
+			     (size_t) manifest_data_size,
+			     LIBFWEVT_MANIFEST_READ_FLAG_READ_ON_DEMAND | LIBFWEVT_MANIFEST_READ_FLAG_BORROW_DATA,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read manifest: %" PRIu32 ".",
+				 function,
+				 manifest_index );
+
+				goto on_error;
+			}
+			if( libcdata_array_set_entry_by_index(
+			     internal_manifest_archive->manifests_array,
+			     (int) manifest_index,
+			     (intptr_t *) new_manifest,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set manifest: %" PRIu32 ".",
+				 function,
+				 manifest_index );
+
+				goto on_error;
+			}
+			safe_manifest = new_manifest;
+			new_manifest  = NULL;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     internal_manifest_archive->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+	}
+	if( safe_manifest == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing manifest: %" PRIu32 ".",
+		 function,
+		 manifest_index );
+
+		return( -1 );
+	}
+	*manifest = safe_manifest;
+
+	return( 1 );
+
+on_error:
+	if( new_manifest != NULL )
+	{
+		libfwevt_manifest_free(
+		 &new_manifest,
+		 NULL );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_manifest_archive->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the number of manifests
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_manifest_archive_get_number_of_manifests(
+     libfwevt_manifest_archive_t *manifest_archive,
+     int *number_of_manifests,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_manifest_archive_t *internal_manifest_archive = NULL;
+	static char *function                                           = "libfwevt_manifest_archive_get_number_of_manifests";
+
+	if( manifest_archive == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest archive.",
+		 function );
+
+		return( -1 );
+	}
+	internal_manifest_archive = (libfwevt_internal_manifest_archive_t *) manifest_archive;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_manifest_archive->manifests_array,
+	     number_of_manifests,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific provider by identifier (GUID)
+ * The lookup uses the provider index stored in the manifest archive, only the
+ * manifest that contains the provider is parsed, on the first lookup of that manifest
+ * This function can be called from multiple threads when multi-thread support is enabled
+ * Returns 1 if successful, 0 if no such provider or -1 on error
+ */
+int libfwevt_manifest_archive_get_provider_by_identifier(
+     libfwevt_manifest_archive_t *manifest_archive,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     libfwevt_provider_t **provider,
+     libcerror_error_t **error )
+{
+	fwevt_manifest_archive_index_entry_t *index_entry               = NULL;
+	libfwevt_internal_manifest_archive_t *internal_manifest_archive = NULL;
+	libfwevt_manifest_t *manifest                                   = NULL;
+	static char *function                                           = "libfwevt_manifest_archive_get_provider_by_identifier";
+	uint32_t index_slot                                             = 0;
+	uint32_t manifest_index                                         = 0;
+	uint32_t number_of_probes                                       = 0;
+	uint32_t provider_index                                         = 0;
+
+	if( manifest_archive == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid manifest archive.",
+		 function );
+
+		return( -1 );
+	}
+	internal_manifest_archive = (libfwevt_internal_manifest_archive_t *) manifest_archive;
+
+	if( internal_manifest_archive->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid manifest archive - missing data.",
+		 function );
+
+		return( -1 );
+	}
+	if( provider_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid provider identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( provider_identifier_size != 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid provider identifier size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( provider == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid provider.",
+		 function );
+
+		return( -1 );
+	}
+	index_slot = libfwevt_guid_index_calculate_hash(
+	              provider_identifier ) & ( internal_manifest_archive->number_of_index_slots - 1 );
+
+	for( number_of_probes = 0;
+	     number_of_probes < internal_manifest_archive->number_of_index_slots;
+	     number_of_probes++ )
+	{
+		index_entry = (fwevt_manifest_archive_index_entry_t *) &( internal_manifest_archive->data[ internal_manifest_archive->index_offset + ( index_slot * sizeof( fwevt_manifest_archive_index_entry_t ) ) ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 index_entry->manifest_index,
+		 manifest_index );
+
+		if( manifest_index == LIBFWEVT_MANIFEST_ARCHIVE_UNUSED_INDEX_SLOT )
+		{
+			break;
+		}
+		if( memory_compare(
+		     index_entry->identifier,
+		     provider_identifier,
+		     16 ) == 0 )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 index_entry->provider_index,
+			 provider_index );
+
+			if( ( manifest_index >= internal_manifest_archive->number_of_manifests )
+			 || ( provider_index > (uint32_t) INT_MAX ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid index slot: %" PRIu32 " value out of bounds.",
+				 function,
+				 index_slot );
+
+				return( -1 );
+			}
+			if( libfwevt_internal_manifest_archive_get_manifest(
+			     internal_manifest_archive,
+			     manifest_index,
+			     &manifest,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve manifest: %" PRIu32 ".",
+				 function,
+				 manifest_index );
+
+				return( -1 );
+			}
+			if( libfwevt_manifest_get_provider_by_index(
+			     manifest,
+			     (int) provider_index,
+			     provider,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve provider: %" PRIu32 " of manifest: %" PRIu32 ".",
+				 function,
+				 provider_index,
+				 manifest_index );
+
+				return( -1 );
+			}
+			return( 1 );
+		}
+		index_slot = ( index_slot + 1 ) & ( internal_manifest_archive->number_of_index_slots - 1 );
+	}
+	return( 0 );
+}
+
@@ -0,0 +1,164 @@
+/*
+ * Manifest archive functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWEVT_MANIFEST_ARCHIVE_H )
+#define _LIBFWEVT_MANIFEST_ARCHIVE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwevt_extern.h"
+#include "libfwevt_file_mapping.h"
+#include "libfwevt_libcdata.h"
+#include "libfwevt_libcerror.h"
+#include "libfwevt_libcthreads.h"
+#include "libfwevt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfwevt_internal_manifest_archive libfwevt_internal_manifest_archive_t;
+
+struct libfwevt_internal_manifest_archive
+{
+	/* The file mapping
+	 * Only set if the manifest archive was opened from a file
+	 */
+	libfwevt_file_mapping_t *file_mapping;
+
+	/* The manifest archive data
+	 * Only set if the manifest archive was read
+	 */
+	const uint8_t *data;
+
+	/* The manifest archive data size
+	 */
+	size_t data_size;
+
+	/* The number of manifests
+	 */
+	uint32_t number_of_manifests;
+
+	/* The manifests table offset
+	 */
+	uint32_t manifests_table_offset;
+
+	/* The number of provider index slots
+	 */
+	uint32_t number_of_index_slots;
+
+	/* The provider index offset
+	 */
+	uint32_t index_offset;
+
+	/* The data segments array
+	 * Contains copies of the manifest data appended to the manifest archive
+	 */
+	libcdata_array_t *data_segments_array;
+
+	/* The manifests array
+	 * Contains the manifests, a manifest of a read manifest archive is only created when first needed
+	 */
+	libcdata_array_t *manifests_array;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+LIBFWEVT_EXTERN \
+int libfwevt_manifest_archive_initialize(
+     libfwevt_manifest_archive_t **manifest_archive,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_manifest_archive_free(
+     libfwevt_manifest_archive_t **manifest_archive,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_manifest_archive_append_manifest_data(
+     libfwevt_manifest_archive_t *manifest_archive,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfwevt_internal_manifest_archive_get_write_layout(
+     libfwevt_internal_manifest_archive_t *internal_manifest_archive,
+     uint32_t *number_of_index_slots,
+     size_t *write_size,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_manifest_archive_get_write_size(
+     libfwevt_manifest_archive_t *manifest_archive,
+     size_t *write_size,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_manifest_archive_write(
+     libfwevt_manifest_archive_t *manifest_archive,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_manifest_archive_read(
+     libfwevt_manifest_archive_t *manifest_archive,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_manifest_archive_open(
+     libfwevt_manifest_archive_t *manifest_archive,
+     const char *filename,
+     libcerror_error_t **error );
+
+int libfwevt_internal_manifest_archive_get_manifest(
+     libfwevt_internal_manifest_archive_t *internal_manifest_archive,
+     uint32_t manifest_index,
+     libfwevt_manifest_t **manifest,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_manifest_archive_get_number_of_manifests(
+     libfwevt_manifest_archive_t *manifest_archive,
+     int *number_of_manifests,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_manifest_archive_get_provider_by_identifier(
+     libfwevt_manifest_archive_t *manifest_archive,
+     const uint8_t *provider_identifier,
+     size_t provider_identifier_size,
+     libfwevt_provider_t **provider,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWEVT_MANIFEST_ARCHIVE_H ) */
+
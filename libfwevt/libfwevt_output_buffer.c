@@ -0,0 +1,556 @@
+/*
+ * Output buffer functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwevt_libcerror.h"
+#include "libfwevt_libuna.h"
+#include "libfwevt_output_buffer.h"
+
+/* The initial allocated data size of an output buffer
+ */
+#define LIBFWEVT_OUTPUT_BUFFER_INITIAL_DATA_SIZE	4096
+
+/* Flushes an output buffer
+ * Writes the data to the write callback, if set, and empties the output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_output_buffer_flush(
+     libfwevt_output_buffer_t *output_buffer,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_output_buffer_flush";
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( output_buffer->write_callback == NULL )
+	 || ( output_buffer->data_size == 0 ) )
+	{
+		return( 1 );
+	}
+	if( output_buffer->write_callback(
+	     output_buffer->data,
+	     output_buffer->data_size,
+	     output_buffer->callback_data,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write data.",
+		 function );
+
+		return( -1 );
+	}
+	output_buffer->data_size = 0;
+
+	return( 1 );
+}
+
+/* Reserves space in an output buffer
+ * Makes sure that at least size bytes can be appended to the data
+ * If a write callback is set the data is flushed first, the data is only
+ * reallocated if size exceeds the allocated data size
+ * Fixed data is never reallocated, reserving more than the remaining size is an error
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_output_buffer_reserve(
+     libfwevt_output_buffer_t *output_buffer,
+     size_t size,
+     libcerror_error_t **error )
+{
+	uint8_t *data              = NULL;
+	static char *function      = "libfwevt_output_buffer_reserve";
+	size_t allocated_data_size = 0;
+	size_t required_data_size  = 0;
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( output_buffer->data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	 || ( size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - output_buffer->data_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	required_data_size = output_buffer->data_size + size;
+
+	if( required_data_size <= output_buffer->allocated_data_size )
+	{
+		return( 1 );
+	}
+	if( output_buffer->data_is_fixed != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid output buffer - fixed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( output_buffer->write_callback != NULL )
+	 && ( output_buffer->data_size > 0 ) )
+	{
+		if( libfwevt_output_buffer_flush(
+		     output_buffer,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to flush output buffer.",
+			 function );
+
+			return( -1 );
+		}
+		required_data_size = size;
+
+		if( required_data_size <= output_buffer->allocated_data_size )
+		{
+			return( 1 );
+		}
+	}
+	allocated_data_size = output_buffer->allocated_data_size;
+
+	if( allocated_data_size < LIBFWEVT_OUTPUT_BUFFER_INITIAL_DATA_SIZE )
+	{
+		allocated_data_size = LIBFWEVT_OUTPUT_BUFFER_INITIAL_DATA_SIZE;
+	}
+	while( allocated_data_size < required_data_size )
+	{
+		if( allocated_data_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+		{
+			allocated_data_size = (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE;
+
+			break;
+		}
+		allocated_data_size *= 2;
+	}
+	data = (uint8_t *) memory_reallocate(
+	                    output_buffer->data,
+	                    sizeof( uint8_t ) * allocated_data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize data.",
+		 function );
+
+		return( -1 );
+	}
+	output_buffer->data                = data;
+	output_buffer->allocated_data_size = allocated_data_size;
+
+	return( 1 );
+}
+
+/* Reserves space in an output buffer for data of which only the maximum size is known
+ * Makes sure that at least minimum_size bytes and, unless the data is fixed,
+ * maximum_size bytes can be appended to the data
+ * If the data is fixed the data must be appended by functions that are bounded
+ * by the allocated data size
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_output_buffer_reserve_maximum(
+     libfwevt_output_buffer_t *output_buffer,
+     size_t minimum_size,
+     size_t maximum_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_output_buffer_reserve_maximum";
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( minimum_size > maximum_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid minimum size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_buffer->data_is_fixed != 0 )
+	{
+		maximum_size = minimum_size;
+	}
+	if( libfwevt_output_buffer_reserve(
+	     output_buffer,
+	     maximum_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve space in output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Appends data to an output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_output_buffer_append_data(
+     libfwevt_output_buffer_t *output_buffer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_output_buffer_append_data";
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_output_buffer_reserve(
+	     output_buffer,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve space in output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > 0 )
+	{
+		if( memory_copy(
+		     &( output_buffer->data[ output_buffer->data_size ] ),
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			return( -1 );
+		}
+		output_buffer->data_size += data_size;
+	}
+	return( 1 );
+}
+
+/* Appends 2 x ' ' characters per indentation level to an output buffer
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_output_buffer_append_indentation(
+     libfwevt_output_buffer_t *output_buffer,
+     int indentation_level,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_output_buffer_append_indentation";
+
+	if( ( indentation_level < 0 )
+	 || ( indentation_level > ( INT_MAX / 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid indentation level value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_output_buffer_reserve(
+	     output_buffer,
+	     (size_t) indentation_level * 2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve space in output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( indentation_level > 0 )
+	{
+		if( memory_set(
+		     &( output_buffer->data[ output_buffer->data_size ] ),
+		     (uint8_t) ' ',
+		     (size_t) indentation_level * 2 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to set indentation.",
+			 function );
+
+			return( -1 );
+		}
+		output_buffer->data_size += (size_t) indentation_level * 2;
+	}
+	return( 1 );
+}
+
+/* Appends an UTF-16 little-endian stream as UTF-8 to an output buffer
+ * The end-of-string character is not appended
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_output_buffer_append_utf16_stream(
+     libfwevt_output_buffer_t *output_buffer,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_output_buffer_append_utf16_stream";
+	size_t data_size      = 0;
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* An UTF-16 character is encoded as at most 3 UTF-8 bytes, a surrogate pair as 4
+	 * The size includes the end-of-string character
+	 */
+	if( libfwevt_output_buffer_reserve(
+	     output_buffer,
+	     ( ( ( utf16_stream_size + 1 ) / 2 ) * 3 ) + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve space in output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	data_size = output_buffer->data_size;
+
+	if( libuna_utf8_string_with_index_copy_from_utf16_stream(
+	     output_buffer->data,
+	     output_buffer->allocated_data_size,
+	     &data_size,
+	     utf16_stream,
+	     utf16_stream_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-16 stream to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	/* Remove the end-of-string character
+	 */
+	output_buffer->data_size = data_size - 1;
+
+	return( 1 );
+}
+
+/* Writes data to a FILE stream
+ * Callback function for an output buffer, callback_data must contain the FILE stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_output_buffer_write_to_file_stream(
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	FILE *stream          = NULL;
+	static char *function = "libfwevt_output_buffer_write_to_file_stream";
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback data.",
+		 function );
+
+		return( -1 );
+	}
+	stream = (FILE *) callback_data;
+
+	if( file_stream_write(
+	     stream,
+	     data,
+	     data_size ) != data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write data to stream.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Counts the size of data
+ * Callback function for an output buffer, callback_data must contain a size_t
+ * that is incremented by the data size, the data itself is discarded
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_output_buffer_count_data_size(
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	size_t *counted_data_size = NULL;
+	static char *function     = "libfwevt_output_buffer_count_data_size";
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback data.",
+		 function );
+
+		return( -1 );
+	}
+	counted_data_size = (size_t *) callback_data;
+
+	if( data_size > ( (size_t) SSIZE_MAX - *counted_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*counted_data_size += data_size;
+
+	return( 1 );
+}
+
@@ -0,0 +1,123 @@
+/*
+ * Output buffer functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWEVT_OUTPUT_BUFFER_H )
+#define _LIBFWEVT_OUTPUT_BUFFER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwevt_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfwevt_output_buffer libfwevt_output_buffer_t;
+
+/* An output buffer contains rendered output that is appended in place,
+ * the data is reallocated when more space is reserved than is available
+ * unless a write callback is set, then the data is written to the callback
+ * first and the data is only used as a staging buffer, or the data is fixed,
+ * then the data is provided by the caller and is never reallocated
+ */
+struct libfwevt_output_buffer
+{
+	/* The data
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 * Contains the number of bytes that are used
+	 */
+	size_t data_size;
+
+	/* The allocated data size
+	 */
+	size_t allocated_data_size;
+
+	/* Value to indicate the data is fixed
+	 */
+	uint8_t data_is_fixed;
+
+	/* The write callback
+	 */
+	int (*write_callback)(
+	       const uint8_t *data,
+	       size_t data_size,
+	       void *callback_data,
+	       libcerror_error_t **error );
+
+	/* The write callback data
+	 */
+	void *callback_data;
+};
+
+int libfwevt_output_buffer_flush(
+     libfwevt_output_buffer_t *output_buffer,
+     libcerror_error_t **error );
+
+int libfwevt_output_buffer_reserve(
+     libfwevt_output_buffer_t *output_buffer,
+     size_t size,
+     libcerror_error_t **error );
+
+int libfwevt_output_buffer_reserve_maximum(
+     libfwevt_output_buffer_t *output_buffer,
+     size_t minimum_size,
+     size_t maximum_size,
+     libcerror_error_t **error );
+
+int libfwevt_output_buffer_append_data(
+     libfwevt_output_buffer_t *output_buffer,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfwevt_output_buffer_append_indentation(
+     libfwevt_output_buffer_t *output_buffer,
+     int indentation_level,
+     libcerror_error_t **error );
+
+int libfwevt_output_buffer_append_utf16_stream(
+     libfwevt_output_buffer_t *output_buffer,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libcerror_error_t **error );
+
+int libfwevt_output_buffer_write_to_file_stream(
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libfwevt_output_buffer_count_data_size(
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWEVT_OUTPUT_BUFFER_H ) */
+
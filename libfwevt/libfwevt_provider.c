@@ -25,17 +25,21 @@
 #include <types.h>
 
 #include "libfwevt_channel.h"
+#include "libfwevt_definitions.h"
 #include "libfwevt_event.h"
+#include "libfwevt_guid_index.h"
 #include "libfwevt_keyword.h"
 #include "libfwevt_level.h"
 #include "libfwevt_libcdata.h"
 #include "libfwevt_libcerror.h"
 #include "libfwevt_libcnotify.h"
+#include "libfwevt_libcthreads.h"
 #include "libfwevt_libfguid.h"
 #include "libfwevt_libuna.h"
 #include "libfwevt_map.h"
 #include "libfwevt_opcode.h"
 #include "libfwevt_provider.h"
+#include "libfwevt_sorted_index.h"
 #include "libfwevt_task.h"
 #include "libfwevt_template.h"
 #include "libfwevt_types.h"
@@ -172,6 +176,19 @@ int libfwevt_provider_initialize(
 
 		goto on_error;
 	}
+	if( libfwevt_sorted_index_initialize(
+	     &( internal_provider->events_index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create events index.",
+		 function );
+
+		goto on_error;
+	}
 	if( libcdata_array_initialize(
 	     &( internal_provider->keywords_array ),
 	     0,
@@ -256,6 +273,47 @@ int libfwevt_provider_initialize(
 
 		goto on_error;
 	}
+	if( libfwevt_sorted_index_initialize(
+	     &( internal_provider->templates_offset_index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create templates offset index.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_guid_index_initialize(
+	     &( internal_provider->templates_identifier_index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create templates identifier index.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_provider->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	*provider = (libfwevt_provider_t *) internal_provider;
 
 	return( 1 );
@@ -263,6 +321,25 @@ int libfwevt_provider_initialize(
 on_error:
 	if( internal_provider != NULL )
 	{
+		if( internal_provider->templates_identifier_index != NULL )
+		{
+			libfwevt_guid_index_free(
+			 &( internal_provider->templates_identifier_index ),
+			 NULL );
+		}
+		if( internal_provider->templates_offset_index != NULL )
+		{
+			libfwevt_sorted_index_free(
+			 &( internal_provider->templates_offset_index ),
+			 NULL );
+		}
+		if( internal_provider->templates_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_provider->templates_array ),
+			 NULL,
+			 NULL );
+		}
 		if( internal_provider->tasks_array != NULL )
 		{
 			libcdata_array_free(
@@ -298,6 +375,12 @@ on_error:
 			 NULL,
 			 NULL );
 		}
+		if( internal_provider->events_index != NULL )
+		{
+			libfwevt_sorted_index_free(
+			 &( internal_provider->events_index ),
+			 NULL );
+		}
 		if( internal_provider->events_array != NULL )
 		{
 			libcdata_array_free(
@@ -396,6 +479,19 @@ int libfwevt_internal_provider_free(
 
 			result = -1;
 		}
+		if( libfwevt_sorted_index_free(
+		     &( ( *internal_provider )->events_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free events index.",
+			 function );
+
+			result = -1;
+		}
 		if( libcdata_array_free(
 		     &( ( *internal_provider )->keywords_array ),
 		     (int (*)(intptr_t **, libcerror_error_t **)) &libfwevt_internal_keyword_free,
@@ -480,6 +576,47 @@ int libfwevt_internal_provider_free(
 
 			result = -1;
 		}
+		if( libfwevt_sorted_index_free(
+		     &( ( *internal_provider )->templates_offset_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free templates offset index.",
+			 function );
+
+			result = -1;
+		}
+		if( libfwevt_guid_index_free(
+		     &( ( *internal_provider )->templates_identifier_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free templates identifier index.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *internal_provider )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 *internal_provider );
 
@@ -836,6 +973,281 @@ int libfwevt_provider_read_data(
 	return( 1 );
 }
 
+/* Sets the provider tables to be read on demand
+ * The data must remain available and unmodified while the provider is used
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_provider_set_read_on_demand(
+     libfwevt_provider_t *provider,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_provider_t *internal_provider = NULL;
+	static char *function                           = "libfwevt_provider_set_read_on_demand";
+
+	if( provider == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid provider.",
+		 function );
+
+		return( -1 );
+	}
+	internal_provider = (libfwevt_internal_provider_t *) provider;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	internal_provider->data                = data;
+	internal_provider->data_size           = data_size;
+	internal_provider->unread_tables_flags = LIBFWEVT_PROVIDER_TABLE_FLAG_ALL;
+
+	return( 1 );
+}
+
+/* Reads a provider table on demand, if it has not been read before
+ * The table is read while holding the read/write lock for writing so that
+ * concurrent getters on the same provider read the table only once
+ * The lock is only taken while the table can still be unread
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_internal_provider_read_table_on_demand(
+     libfwevt_internal_provider_t *internal_provider,
+     uint16_t table_flag,
+     libcerror_error_t **error )
+{
+	static char *function        = "libfwevt_internal_provider_read_table_on_demand";
+	uint16_t unread_tables_flags = 0;
+	int result                   = 0;
+
+	if( internal_provider == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid provider.",
+		 function );
+
+		return( -1 );
+	}
+	/* Without data the tables are not read on demand
+	 */
+	if( internal_provider->data == NULL )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( __GNUC__ )
+	/* The flags are loaded atomically so that no lock is needed for a table
+	 * that has already been read
+	 */
+	unread_tables_flags = __atomic_load_n(
+	                       &( internal_provider->unread_tables_flags ),
+	                       __ATOMIC_ACQUIRE );
+#elif defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_provider->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+	unread_tables_flags = internal_provider->unread_tables_flags;
+
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_provider->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#else
+	unread_tables_flags = internal_provider->unread_tables_flags;
+#endif
+	if( ( unread_tables_flags & table_flag ) == 0 )
+	{
+		return( 1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_provider->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Another thread could have read the table while the lock was released
+	 */
+	if( ( internal_provider->unread_tables_flags & table_flag ) != 0 )
+	{
+		switch( table_flag )
+		{
+			case LIBFWEVT_PROVIDER_TABLE_FLAG_CHANNELS:
+				result = libfwevt_provider_read_channels(
+				          (libfwevt_provider_t *) internal_provider,
+				          internal_provider->data,
+				          internal_provider->data_size,
+				          error );
+				break;
+
+			case LIBFWEVT_PROVIDER_TABLE_FLAG_EVENTS:
+				result = libfwevt_provider_read_events(
+				          (libfwevt_provider_t *) internal_provider,
+				          internal_provider->data,
+				          internal_provider->data_size,
+				          error );
+				break;
+
+			case LIBFWEVT_PROVIDER_TABLE_FLAG_KEYWORDS:
+				result = libfwevt_provider_read_keywords(
+				          (libfwevt_provider_t *) internal_provider,
+				          internal_provider->data,
+				          internal_provider->data_size,
+				          error );
+				break;
+
+			case LIBFWEVT_PROVIDER_TABLE_FLAG_LEVELS:
+				result = libfwevt_provider_read_levels(
+				          (libfwevt_provider_t *) internal_provider,
+				          internal_provider->data,
+				          internal_provider->data_size,
+				          error );
+				break;
+
+			case LIBFWEVT_PROVIDER_TABLE_FLAG_MAPS:
+				result = libfwevt_provider_read_maps(
+				          (libfwevt_provider_t *) internal_provider,
+				          internal_provider->data,
+				          internal_provider->data_size,
+				          error );
+				break;
+
+			case LIBFWEVT_PROVIDER_TABLE_FLAG_OPCODES:
+				result = libfwevt_provider_read_opcodes(
+				          (libfwevt_provider_t *) internal_provider,
+				          internal_provider->data,
+				          internal_provider->data_size,
+				          error );
+				break;
+
+			case LIBFWEVT_PROVIDER_TABLE_FLAG_TASKS:
+				result = libfwevt_provider_read_tasks(
+				          (libfwevt_provider_t *) internal_provider,
+				          internal_provider->data,
+				          internal_provider->data_size,
+				          error );
+				break;
+
+			case LIBFWEVT_PROVIDER_TABLE_FLAG_TEMPLATES:
+				result = libfwevt_provider_read_templates(
+				          (libfwevt_provider_t *) internal_provider,
+				          internal_provider->data,
+				          internal_provider->data_size,
+				          error );
+				break;
+
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported table flag: 0x%04" PRIx16 ".",
+				 function,
+				 table_flag );
+
+				goto on_error;
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read table: 0x%04" PRIx16 ".",
+			 function,
+			 table_flag );
+
+			goto on_error;
+		}
+		/* The table is only marked as read after it was read successfully
+		 */
+#if defined( HAVE_MULTI_THREAD_SUPPORT ) && defined( __GNUC__ )
+		__atomic_and_fetch(
+		 &( internal_provider->unread_tables_flags ),
+		 (uint16_t) ~table_flag,
+		 __ATOMIC_RELEASE );
+#else
+		internal_provider->unread_tables_flags &= ~table_flag;
+#endif
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_provider->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+
+on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 internal_provider->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
 /* Reads the provider channels
  * Returns 1 if successful or -1 on error
  */
@@ -1138,6 +1550,7 @@ int libfwevt_provider_read_events(
 {
 	fwevt_template_events_t *wevt_events            = NULL;
 	libfwevt_event_t *event                         = NULL;
+	libfwevt_internal_event_t *internal_event       = NULL;
 	libfwevt_internal_provider_t *internal_provider = NULL;
 	static char *function                           = "libfwevt_provider_read_events";
 	size_t data_offset                              = 0;
@@ -1394,7 +1807,28 @@ int libfwevt_provider_read_events(
 
 			goto on_error;
 		}
-		event = NULL;
+		internal_event = (libfwevt_internal_event_t *) event;
+		event          = NULL;
+
+		/* If the provider contains multiple events with the same identifier and version
+		 * the index refers to the first one
+		 */
+		if( libfwevt_sorted_index_insert_key(
+		     internal_provider->events_index,
+		     ( (uint32_t) internal_event->identifier << 8 ) | internal_event->version,
+		     entry_index,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert event: %" PRIu32 " into index.",
+			 function,
+			 event_index );
+
+			goto on_error;
+		}
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -1420,6 +1854,10 @@ on_error:
 		 (libfwevt_internal_event_t **) &event,
 		 NULL );
 	}
+	libfwevt_sorted_index_empty(
+	 internal_provider->events_index,
+	 NULL );
+
 	libcdata_array_empty(
 	 internal_provider->events_array,
 	 (int (*)(intptr_t **, libcerror_error_t **)) &libfwevt_internal_event_free,
@@ -2964,6 +3402,7 @@ int libfwevt_provider_read_templates(
      libcerror_error_t **error )
 {
 	libfwevt_internal_provider_t *internal_provider = NULL;
+	libfwevt_internal_template_t *internal_template = NULL;
 	libfwevt_template_t *wevt_template              = NULL;
 	fwevt_template_table_t *template_table          = NULL;
 	static char *function                           = "libfwevt_provider_read_templates";
@@ -3165,11 +3604,12 @@ int libfwevt_provider_read_templates(
 		( (libfwevt_internal_template_t *) wevt_template )->is_managed = 1;
 
 /* TODO handle ASCII codepage */
-		if( libfwevt_template_read(
+		if( libfwevt_template_read_with_flags(
 		     wevt_template,
 		     data,
 		     data_size,
 		     data_offset,
+		     internal_provider->template_read_flags,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -3226,17 +3666,55 @@ int libfwevt_provider_read_templates(
 
 			goto on_error;
 		}
-		wevt_template = NULL;
-	}
-/* TODO count data size ?
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		if( template_table_size > 0 )
+		internal_template = (libfwevt_internal_template_t *) wevt_template;
+		wevt_template     = NULL;
+
+		/* If the provider contains multiple templates with the same offset or identifier
+		 * the indexes refer to the first one
+		 */
+		if( libfwevt_sorted_index_insert_key(
+		     internal_provider->templates_offset_index,
+		     internal_template->offset,
+		     entry_index,
+		     error ) == -1 )
 		{
-			libcnotify_printf(
-			 "%s: trailing data:\n",
-			 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert template: %" PRIu32 " into offset index.",
+			 function,
+			 template_index );
+
+			goto on_error;
+		}
+		if( libfwevt_guid_index_insert_value(
+		     internal_provider->templates_identifier_index,
+		     internal_template->identifier,
+		     16,
+		     (intptr_t *) internal_template,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert template: %" PRIu32 " into identifier index.",
+			 function,
+			 template_index );
+
+			goto on_error;
+		}
+	}
+/* TODO count data size ?
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( template_table_size > 0 )
+		{
+			libcnotify_printf(
+			 "%s: trailing data:\n",
+			 function );
 			libcnotify_print_data(
 			 &( data[ data_offset ] ),
 			 template_table_size,
@@ -3254,6 +3732,14 @@ on_error:
 		 (libfwevt_internal_template_t **) &wevt_template,
 		 NULL );
 	}
+	libfwevt_guid_index_empty(
+	 internal_provider->templates_identifier_index,
+	 NULL );
+
+	libfwevt_sorted_index_empty(
+	 internal_provider->templates_offset_index,
+	 NULL );
+
 	libcdata_array_empty(
 	 internal_provider->templates_array,
 	 (int (*)(intptr_t **, libcerror_error_t **)) &libfwevt_internal_template_free,
@@ -3409,6 +3895,20 @@ int libfwevt_provider_get_number_of_channels(
 	}
 	internal_provider = (libfwevt_internal_provider_t *) provider;
 
+	if( libfwevt_internal_provider_read_table_on_demand(
+	     internal_provider,
+	     LIBFWEVT_PROVIDER_TABLE_FLAG_CHANNELS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read channels.",
+		 function );
+
+		return( -1 );
+	}
 	if( libcdata_array_get_number_of_entries(
 	     internal_provider->channels_array,
 	     number_of_channels,
@@ -3451,6 +3951,20 @@ int libfwevt_provider_get_channel_by_index(
 	}
 	internal_provider = (libfwevt_internal_provider_t *) provider;
 
+	if( libfwevt_internal_provider_read_table_on_demand(
+	     internal_provider,
+	     LIBFWEVT_PROVIDER_TABLE_FLAG_CHANNELS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read channels.",
+		 function );
+
+		return( -1 );
+	}
 	if( libcdata_array_get_entry_by_index(
 	     internal_provider->channels_array,
 	     channel_index,
@@ -3494,6 +4008,20 @@ int libfwevt_provider_get_number_of_events(
 	}
 	internal_provider = (libfwevt_internal_provider_t *) provider;
 
+	if( libfwevt_internal_provider_read_table_on_demand(
+	     internal_provider,
+	     LIBFWEVT_PROVIDER_TABLE_FLAG_EVENTS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read events.",
+		 function );
+
+		return( -1 );
+	}
 	if( libcdata_array_get_number_of_entries(
 	     internal_provider->events_array,
 	     number_of_events,
@@ -3536,6 +4064,20 @@ int libfwevt_provider_get_event_by_index(
 	}
 	internal_provider = (libfwevt_internal_provider_t *) provider;
 
+	if( libfwevt_internal_provider_read_table_on_demand(
+	     internal_provider,
+	     LIBFWEVT_PROVIDER_TABLE_FLAG_EVENTS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read events.",
+		 function );
+
+		return( -1 );
+	}
 	if( libcdata_array_get_entry_by_index(
 	     internal_provider->events_array,
 	     event_index,
@@ -3556,6 +4098,7 @@ int libfwevt_provider_get_event_by_index(
 }
 
 /* Retrieves a specific event by identifier
+ * If the provider contains multiple versions of the event the first one is returned
  * Returns 1 if successful, 0 if not available or -1 on error
  */
 int libfwevt_provider_get_event_by_identifier(
@@ -3564,12 +4107,10 @@ int libfwevt_provider_get_event_by_identifier(
      libfwevt_event_t **event,
      libcerror_error_t **error )
 {
-	libfwevt_event_t *safe_event                    = NULL;
 	libfwevt_internal_provider_t *internal_provider = NULL;
 	static char *function                           = "libfwevt_provider_get_event_by_identifier";
-	uint32_t identifier                             = 0;
 	int event_index                                 = 0;
-	int number_of_events                            = 0;
+	int result                                      = 0;
 
 	if( provider == NULL )
 	{
@@ -3597,28 +4138,50 @@ int libfwevt_provider_get_event_by_identifier(
 	}
 	*event = NULL;
 
-	if( libcdata_array_get_number_of_entries(
-	     internal_provider->events_array,
-	     &number_of_events,
+	/* The event identifier is stored as a 16-bit value
+	 */
+	if( event_identifier > 0x0000ffffUL )
+	{
+		return( 0 );
+	}
+	if( libfwevt_internal_provider_read_table_on_demand(
+	     internal_provider,
+	     LIBFWEVT_PROVIDER_TABLE_FLAG_EVENTS,
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read events.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwevt_sorted_index_get_first_entry_index_in_key_range(
+	          internal_provider->events_index,
+	          event_identifier << 8,
+	          ( event_identifier << 8 ) | 0x000000ffUL,
+	          &event_index,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries.",
+		 "%s: unable to retrieve event index from events index.",
 		 function );
 
 		return( -1 );
 	}
-	for( event_index = 0;
-	     event_index < number_of_events;
-	     event_index++ )
+	else if( result != 0 )
 	{
 		if( libcdata_array_get_entry_by_index(
 		     internal_provider->events_array,
 		     event_index,
-		     (intptr_t **) &safe_event,
+		     (intptr_t **) event,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -3631,30 +4194,108 @@ int libfwevt_provider_get_event_by_identifier(
 
 			return( -1 );
 		}
-/* TODO refactor to compare function */
-		if( libfwevt_event_get_identifier(
-		     safe_event,
-		     &identifier,
+	}
+	return( result );
+}
+
+/* Retrieves a specific event by identifier and version
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwevt_provider_get_event_by_identifier_and_version(
+     libfwevt_provider_t *provider,
+     uint32_t event_identifier,
+     uint8_t event_version,
+     libfwevt_event_t **event,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_provider_t *internal_provider = NULL;
+	static char *function                           = "libfwevt_provider_get_event_by_identifier_and_version";
+	int event_index                                 = 0;
+	int result                                      = 0;
+
+	if( provider == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid provider.",
+		 function );
+
+		return( -1 );
+	}
+	internal_provider = (libfwevt_internal_provider_t *) provider;
+
+	if( event == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid event.",
+		 function );
+
+		return( -1 );
+	}
+	*event = NULL;
+
+	/* The event identifier is stored as a 16-bit value
+	 */
+	if( event_identifier > 0x0000ffffUL )
+	{
+		return( 0 );
+	}
+	if( libfwevt_internal_provider_read_table_on_demand(
+	     internal_provider,
+	     LIBFWEVT_PROVIDER_TABLE_FLAG_EVENTS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read events.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwevt_sorted_index_get_entry_index_by_key(
+	          internal_provider->events_index,
+	          ( event_identifier << 8 ) | event_version,
+	          &event_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve event index from events index.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_provider->events_array,
+		     event_index,
+		     (intptr_t **) event,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve event identifier: %d.",
+			 "%s: unable to retrieve entry: %d.",
 			 function,
 			 event_index );
 
 			return( -1 );
 		}
-		if( event_identifier == identifier )
-		{
-			*event = safe_event;
-
-			return( 1 );
-		}
 	}
-	return( 0 );
+	return( result );
 }
 
 /* Retrieves the number of keywords
@@ -3681,6 +4322,20 @@ int libfwevt_provider_get_number_of_keywords(
 	}
 	internal_provider = (libfwevt_internal_provider_t *) provider;
 
+	if( libfwevt_internal_provider_read_table_on_demand(
+	     internal_provider,
+	     LIBFWEVT_PROVIDER_TABLE_FLAG_KEYWORDS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read keywords.",
+		 function );
+
+		return( -1 );
+	}
 	if( libcdata_array_get_number_of_entries(
 	     internal_provider->keywords_array,
 	     number_of_keywords,
@@ -3723,6 +4378,20 @@ int libfwevt_provider_get_keyword_by_index(
 	}
 	internal_provider = (libfwevt_internal_provider_t *) provider;
 
+	if( libfwevt_internal_provider_read_table_on_demand(
+	     internal_provider,
+	     LIBFWEVT_PROVIDER_TABLE_FLAG_KEYWORDS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read keywords.",
+		 function );
+
+		return( -1 );
+	}
 	if( libcdata_array_get_entry_by_index(
 	     internal_provider->keywords_array,
 	     keyword_index,
@@ -3766,6 +4435,20 @@ int libfwevt_provider_get_number_of_levels(
 	}
 	internal_provider = (libfwevt_internal_provider_t *) provider;
 
+	if( libfwevt_internal_provider_read_table_on_demand(
+	     internal_provider,
+	     LIBFWEVT_PROVIDER_TABLE_FLAG_LEVELS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read levels.",
+		 function );
+
+		return( -1 );
+	}
 	if( libcdata_array_get_number_of_entries(
 	     internal_provider->levels_array,
 	     number_of_levels,
@@ -3808,6 +4491,20 @@ int libfwevt_provider_get_level_by_index(
 	}
 	internal_provider = (libfwevt_internal_provider_t *) provider;
 
+	if( libfwevt_internal_provider_read_table_on_demand(
+	     internal_provider,
+	     LIBFWEVT_PROVIDER_TABLE_FLAG_LEVELS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read levels.",
+		 function );
+
+		return( -1 );
+	}
 	if( libcdata_array_get_entry_by_index(
 	     internal_provider->levels_array,
 	     level_index,
@@ -3851,6 +4548,20 @@ int libfwevt_provider_get_number_of_maps(
 	}
 	internal_provider = (libfwevt_internal_provider_t *) provider;
 
+	if( libfwevt_internal_provider_read_table_on_demand(
+	     internal_provider,
+	     LIBFWEVT_PROVIDER_TABLE_FLAG_MAPS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read maps.",
+		 function );
+
+		return( -1 );
+	}
 	if( libcdata_array_get_number_of_entries(
 	     internal_provider->maps_array,
 	     number_of_maps,
@@ -3893,6 +4604,20 @@ int libfwevt_provider_get_map_by_index(
 	}
 	internal_provider = (libfwevt_internal_provider_t *) provider;
 
+	if( libfwevt_internal_provider_read_table_on_demand(
+	     internal_provider,
+	     LIBFWEVT_PROVIDER_TABLE_FLAG_MAPS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read maps.",
+		 function );
+
+		return( -1 );
+	}
 	if( libcdata_array_get_entry_by_index(
 	     internal_provider->maps_array,
 	     map_index,
@@ -3936,6 +4661,20 @@ int libfwevt_provider_get_number_of_opcodes(
 	}
 	internal_provider = (libfwevt_internal_provider_t *) provider;
 
+	if( libfwevt_internal_provider_read_table_on_demand(
+	     internal_provider,
+	     LIBFWEVT_PROVIDER_TABLE_FLAG_OPCODES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read opcodes.",
+		 function );
+
+		return( -1 );
+	}
 	if( libcdata_array_get_number_of_entries(
 	     internal_provider->opcodes_array,
 	     number_of_opcodes,
@@ -3978,6 +4717,20 @@ int libfwevt_provider_get_opcode_by_index(
 	}
 	internal_provider = (libfwevt_internal_provider_t *) provider;
 
+	if( libfwevt_internal_provider_read_table_on_demand(
+	     internal_provider,
+	     LIBFWEVT_PROVIDER_TABLE_FLAG_OPCODES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read opcodes.",
+		 function );
+
+		return( -1 );
+	}
 	if( libcdata_array_get_entry_by_index(
 	     internal_provider->opcodes_array,
 	     opcode_index,
@@ -4021,6 +4774,20 @@ int libfwevt_provider_get_number_of_tasks(
 	}
 	internal_provider = (libfwevt_internal_provider_t *) provider;
 
+	if( libfwevt_internal_provider_read_table_on_demand(
+	     internal_provider,
+	     LIBFWEVT_PROVIDER_TABLE_FLAG_TASKS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read tasks.",
+		 function );
+
+		return( -1 );
+	}
 	if( libcdata_array_get_number_of_entries(
 	     internal_provider->tasks_array,
 	     number_of_tasks,
@@ -4063,6 +4830,20 @@ int libfwevt_provider_get_task_by_index(
 	}
 	internal_provider = (libfwevt_internal_provider_t *) provider;
 
+	if( libfwevt_internal_provider_read_table_on_demand(
+	     internal_provider,
+	     LIBFWEVT_PROVIDER_TABLE_FLAG_TASKS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read tasks.",
+		 function );
+
+		return( -1 );
+	}
 	if( libcdata_array_get_entry_by_index(
 	     internal_provider->tasks_array,
 	     task_index,
@@ -4106,6 +4887,20 @@ int libfwevt_provider_get_number_of_templates(
 	}
 	internal_provider = (libfwevt_internal_provider_t *) provider;
 
+	if( libfwevt_internal_provider_read_table_on_demand(
+	     internal_provider,
+	     LIBFWEVT_PROVIDER_TABLE_FLAG_TEMPLATES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read templates.",
+		 function );
+
+		return( -1 );
+	}
 	if( libcdata_array_get_number_of_entries(
 	     internal_provider->templates_array,
 	     number_of_templates,
@@ -4148,6 +4943,20 @@ int libfwevt_provider_get_template_by_index(
 	}
 	internal_provider = (libfwevt_internal_provider_t *) provider;
 
+	if( libfwevt_internal_provider_read_table_on_demand(
+	     internal_provider,
+	     LIBFWEVT_PROVIDER_TABLE_FLAG_TEMPLATES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read templates.",
+		 function );
+
+		return( -1 );
+	}
 	if( libcdata_array_get_entry_by_index(
 	     internal_provider->templates_array,
 	     template_index,
@@ -4177,10 +4986,8 @@ int libfwevt_provider_get_template_by_offset(
      libcerror_error_t **error )
 {
 	libfwevt_internal_provider_t *internal_provider = NULL;
-	libfwevt_template_t *safe_wevt_template         = NULL;
 	static char *function                           = "libfwevt_provider_get_template_by_offset";
-	uint32_t template_offset                        = 0;
-	int number_of_templates                         = 0;
+	int result                                      = 0;
 	int template_index                              = 0;
 
 	if( provider == NULL )
@@ -4209,28 +5016,43 @@ int libfwevt_provider_get_template_by_offset(
 	}
 	*wevt_template = NULL;
 
-	if( libcdata_array_get_number_of_entries(
-	     internal_provider->templates_array,
-	     &number_of_templates,
+	if( libfwevt_internal_provider_read_table_on_demand(
+	     internal_provider,
+	     LIBFWEVT_PROVIDER_TABLE_FLAG_TEMPLATES,
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read templates.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwevt_sorted_index_get_entry_index_by_key(
+	          internal_provider->templates_offset_index,
+	          offset,
+	          &template_index,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries.",
+		 "%s: unable to retrieve template index from offset index.",
 		 function );
 
 		return( -1 );
 	}
-	for( template_index = 0;
-	     template_index < number_of_templates;
-	     template_index++ )
+	else if( result != 0 )
 	{
 		if( libcdata_array_get_entry_by_index(
 		     internal_provider->templates_array,
 		     template_index,
-		     (intptr_t **) &safe_wevt_template,
+		     (intptr_t **) wevt_template,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -4243,28 +5065,103 @@ int libfwevt_provider_get_template_by_offset(
 
 			return( -1 );
 		}
-		if( libfwevt_template_get_offset(
-		     safe_wevt_template,
-		     &template_offset,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve template offset: %d.",
-			 function,
-			 template_index );
+	}
+	return( result );
+}
 
-			return( -1 );
-		}
-		if( offset == template_offset )
-		{
-			*wevt_template = safe_wevt_template;
+/* Retrieves a specific template by identifier (GUID)
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwevt_provider_get_template_by_identifier(
+     libfwevt_provider_t *provider,
+     const uint8_t *template_identifier,
+     size_t template_identifier_size,
+     libfwevt_template_t **wevt_template,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_provider_t *internal_provider = NULL;
+	static char *function                           = "libfwevt_provider_get_template_by_identifier";
+	int result                                      = 0;
 
-			return( 1 );
-		}
+	if( provider == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid provider.",
+		 function );
+
+		return( -1 );
 	}
-	return( 0 );
+	internal_provider = (libfwevt_internal_provider_t *) provider;
+
+	if( template_identifier == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template identifier.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_identifier_size != 16 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid template identifier size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( wevt_template == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_internal_provider_read_table_on_demand(
+	     internal_provider,
+	     LIBFWEVT_PROVIDER_TABLE_FLAG_TEMPLATES,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read templates.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwevt_guid_index_get_value_by_identifier(
+	          internal_provider->templates_identifier_index,
+	          template_identifier,
+	          template_identifier_size,
+	          (intptr_t **) wevt_template,
+	          NULL,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve template from identifier index.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
 }
 
@@ -28,12 +28,15 @@
 #include "libfwevt_channel.h"
 #include "libfwevt_extern.h"
 #include "libfwevt_event.h"
+#include "libfwevt_guid_index.h"
 #include "libfwevt_keyword.h"
 #include "libfwevt_level.h"
 #include "libfwevt_libcdata.h"
 #include "libfwevt_libcerror.h"
+#include "libfwevt_libcthreads.h"
 #include "libfwevt_map.h"
 #include "libfwevt_opcode.h"
+#include "libfwevt_sorted_index.h"
 #include "libfwevt_task.h"
 #include "libfwevt_template.h"
 #include "libfwevt_types.h"
@@ -83,6 +86,22 @@ struct libfwevt_internal_provider
 	 */
 	uint8_t identifier[ 16 ];
 
+	/* The data, used to read the tables on demand
+	 */
+	const uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The flags of the tables that have not been read
+	 */
+	uint16_t unread_tables_flags;
+
+	/* The template read flags
+	 */
+	uint8_t template_read_flags;
+
 	/* The channels array
 	 */
 	libcdata_array_t *channels_array;
@@ -91,6 +110,11 @@ struct libfwevt_internal_provider
 	 */
 	libcdata_array_t *events_array;
 
+	/* The events index
+	 * Maps the event identifier and version to an entry in the events array
+	 */
+	libfwevt_sorted_index_t *events_index;
+
 	/* The keywords array
 	 */
 	libcdata_array_t *keywords_array;
@@ -114,6 +138,22 @@ struct libfwevt_internal_provider
 	/* The templates array
 	 */
 	libcdata_array_t *templates_array;
+
+	/* The templates offset index
+	 * Maps the template offset to an entry in the templates array
+	 */
+	libfwevt_sorted_index_t *templates_offset_index;
+
+	/* The templates identifier index
+	 * Maps the template identifier (GUID) to a template
+	 */
+	libfwevt_guid_index_t *templates_identifier_index;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libfwevt_provider_initialize(
@@ -138,6 +178,17 @@ int libfwevt_provider_read_data(
      size_t data_offset,
      libcerror_error_t **error );
 
+int libfwevt_provider_set_read_on_demand(
+     libfwevt_provider_t *provider,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfwevt_internal_provider_read_table_on_demand(
+     libfwevt_internal_provider_t *internal_provider,
+     uint16_t table_flag,
+     libcerror_error_t **error );
+
 int libfwevt_provider_read_channels(
      libfwevt_provider_t *provider,
      const uint8_t *data,
@@ -232,6 +283,14 @@ int libfwevt_provider_get_event_by_identifier(
      libfwevt_event_t **event,
      libcerror_error_t **error );
 
+LIBFWEVT_EXTERN \
+int libfwevt_provider_get_event_by_identifier_and_version(
+     libfwevt_provider_t *provider,
+     uint32_t event_identifier,
+     uint8_t event_version,
+     libfwevt_event_t **event,
+     libcerror_error_t **error );
+
 LIBFWEVT_EXTERN \
 int libfwevt_provider_get_number_of_keywords(
      libfwevt_provider_t *provider,
@@ -317,6 +376,14 @@ int libfwevt_provider_get_template_by_offset(
      libfwevt_template_t **wevt_template,
      libcerror_error_t **error );
 
+LIBFWEVT_EXTERN \
+int libfwevt_provider_get_template_by_identifier(
+     libfwevt_provider_t *provider,
+     const uint8_t *template_identifier,
+     size_t template_identifier_size,
+     libfwevt_template_t **wevt_template,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
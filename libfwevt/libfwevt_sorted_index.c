@@ -0,0 +1,467 @@
+/*
+ * Sorted index functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwevt_libcerror.h"
+#include "libfwevt_sorted_index.h"
+
+/* Creates a sorted index
+ * Make sure the value sorted_index is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_sorted_index_initialize(
+     libfwevt_sorted_index_t **sorted_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_sorted_index_initialize";
+
+	if( sorted_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sorted index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sorted_index != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid sorted index value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*sorted_index = memory_allocate_structure(
+	                 libfwevt_sorted_index_t );
+
+	if( *sorted_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create sorted index.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *sorted_index,
+	     0,
+	     sizeof( libfwevt_sorted_index_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear sorted index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *sorted_index != NULL )
+	{
+		memory_free(
+		 *sorted_index );
+
+		*sorted_index = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a sorted index
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_sorted_index_free(
+     libfwevt_sorted_index_t **sorted_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_sorted_index_free";
+
+	if( sorted_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sorted index.",
+		 function );
+
+		return( -1 );
+	}
+	if( *sorted_index != NULL )
+	{
+		if( ( *sorted_index )->entries != NULL )
+		{
+			memory_free(
+			 ( *sorted_index )->entries );
+		}
+		memory_free(
+		 *sorted_index );
+
+		*sorted_index = NULL;
+	}
+	return( 1 );
+}
+
+/* Empties a sorted index
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_sorted_index_empty(
+     libfwevt_sorted_index_t *sorted_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_sorted_index_empty";
+
+	if( sorted_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sorted index.",
+		 function );
+
+		return( -1 );
+	}
+	if( sorted_index->entries != NULL )
+	{
+		memory_free(
+		 sorted_index->entries );
+
+		sorted_index->entries = NULL;
+	}
+	sorted_index->number_of_entries           = 0;
+	sorted_index->number_of_allocated_entries = 0;
+
+	return( 1 );
+}
+
+/* Determines the position of the first entry with a key greater than or equal to the key
+ * Returns the position, which is the number of entries if no such entry exists
+ */
+static int libfwevt_sorted_index_get_lower_bound(
+            libfwevt_sorted_index_t *sorted_index,
+            uint32_t key )
+{
+	int first_position = 0;
+	int last_position  = sorted_index->number_of_entries;
+	int position       = 0;
+
+	while( first_position < last_position )
+	{
+		position = first_position + ( ( last_position - first_position ) / 2 );
+
+		if( sorted_index->entries[ position ].key < key )
+		{
+			first_position = position + 1;
+		}
+		else
+		{
+			last_position = position;
+		}
+	}
+	return( first_position );
+}
+
+/* Inserts a key into the sorted index
+ * Returns 1 if successful, 0 if the key already exists or -1 on error
+ */
+int libfwevt_sorted_index_insert_key(
+     libfwevt_sorted_index_t *sorted_index,
+     uint32_t key,
+     int entry_index,
+     libcerror_error_t **error )
+{
+	libfwevt_sorted_index_entry_t *entries = NULL;
+	static char *function                  = "libfwevt_sorted_index_insert_key";
+	size_t entries_size                    = 0;
+	int entry_position                     = 0;
+	int number_of_allocated_entries        = 0;
+	int position                           = 0;
+
+	if( sorted_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sorted index.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid entry index value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	/* Entries are commonly stored in ascending key order, hence check the last entry first
+	 */
+	if( ( sorted_index->number_of_entries == 0 )
+	 || ( sorted_index->entries[ sorted_index->number_of_entries - 1 ].key < key ) )
+	{
+		position = sorted_index->number_of_entries;
+	}
+	else
+	{
+		position = libfwevt_sorted_index_get_lower_bound(
+		            sorted_index,
+		            key );
+
+		if( ( position < sorted_index->number_of_entries )
+		 && ( sorted_index->entries[ position ].key == key ) )
+		{
+			return( 0 );
+		}
+	}
+	if( sorted_index->number_of_entries >= sorted_index->number_of_allocated_entries )
+	{
+		if( sorted_index->number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = 16;
+		}
+		else
+		{
+			number_of_allocated_entries = sorted_index->number_of_allocated_entries * 2;
+		}
+		entries_size = sizeof( libfwevt_sorted_index_entry_t ) * (size_t) number_of_allocated_entries;
+
+		if( ( number_of_allocated_entries <= sorted_index->number_of_allocated_entries )
+		 || ( entries_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		entries = (libfwevt_sorted_index_entry_t *) memory_reallocate(
+		                                             sorted_index->entries,
+		                                             entries_size );
+
+		if( entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		sorted_index->entries                     = entries;
+		sorted_index->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	for( entry_position = sorted_index->number_of_entries;
+	     entry_position > position;
+	     entry_position-- )
+	{
+		sorted_index->entries[ entry_position ] = sorted_index->entries[ entry_position - 1 ];
+	}
+	sorted_index->entries[ position ].key         = key;
+	sorted_index->entries[ position ].entry_index = entry_index;
+
+	sorted_index->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Retrieves the number of entries
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_sorted_index_get_number_of_entries(
+     libfwevt_sorted_index_t *sorted_index,
+     int *number_of_entries,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_sorted_index_get_number_of_entries";
+
+	if( sorted_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sorted index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_entries == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_entries = sorted_index->number_of_entries;
+
+	return( 1 );
+}
+
+/* Retrieves the (array) entry index of a specific key
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwevt_sorted_index_get_entry_index_by_key(
+     libfwevt_sorted_index_t *sorted_index,
+     uint32_t key,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_sorted_index_get_entry_index_by_key";
+	int position          = 0;
+
+	if( sorted_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sorted index.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	position = libfwevt_sorted_index_get_lower_bound(
+	            sorted_index,
+	            key );
+
+	if( ( position >= sorted_index->number_of_entries )
+	 || ( sorted_index->entries[ position ].key != key ) )
+	{
+		return( 0 );
+	}
+	*entry_index = sorted_index->entries[ position ].entry_index;
+
+	return( 1 );
+}
+
+/* Retrieves the lowest (array) entry index of the keys in a specific range
+ * The range includes both the first and the last key
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwevt_sorted_index_get_first_entry_index_in_key_range(
+     libfwevt_sorted_index_t *sorted_index,
+     uint32_t first_key,
+     uint32_t last_key,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_sorted_index_get_first_entry_index_in_key_range";
+	int position          = 0;
+	int safe_entry_index  = -1;
+
+	if( sorted_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid sorted index.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_key > last_key )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first key value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	for( position = libfwevt_sorted_index_get_lower_bound(
+	                 sorted_index,
+	                 first_key );
+	     position < sorted_index->number_of_entries;
+	     position++ )
+	{
+		if( sorted_index->entries[ position ].key > last_key )
+		{
+			break;
+		}
+		if( ( safe_entry_index == -1 )
+		 || ( sorted_index->entries[ position ].entry_index < safe_entry_index ) )
+		{
+			safe_entry_index = sorted_index->entries[ position ].entry_index;
+		}
+	}
+	if( safe_entry_index == -1 )
+	{
+		return( 0 );
+	}
+	*entry_index = safe_entry_index;
+
+	return( 1 );
+}
+
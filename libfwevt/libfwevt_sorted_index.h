@@ -0,0 +1,106 @@
+/*
+ * Sorted index functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWEVT_SORTED_INDEX_H )
+#define _LIBFWEVT_SORTED_INDEX_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwevt_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfwevt_sorted_index_entry libfwevt_sorted_index_entry_t;
+
+struct libfwevt_sorted_index_entry
+{
+	/* The key
+	 */
+	uint32_t key;
+
+	/* The (array) entry index
+	 */
+	int entry_index;
+};
+
+typedef struct libfwevt_sorted_index libfwevt_sorted_index_t;
+
+struct libfwevt_sorted_index
+{
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* The entries
+	 * Sorted by key in ascending order
+	 */
+	libfwevt_sorted_index_entry_t *entries;
+};
+
+int libfwevt_sorted_index_initialize(
+     libfwevt_sorted_index_t **sorted_index,
+     libcerror_error_t **error );
+
+int libfwevt_sorted_index_free(
+     libfwevt_sorted_index_t **sorted_index,
+     libcerror_error_t **error );
+
+int libfwevt_sorted_index_empty(
+     libfwevt_sorted_index_t *sorted_index,
+     libcerror_error_t **error );
+
+int libfwevt_sorted_index_insert_key(
+     libfwevt_sorted_index_t *sorted_index,
+     uint32_t key,
+     int entry_index,
+     libcerror_error_t **error );
+
+int libfwevt_sorted_index_get_number_of_entries(
+     libfwevt_sorted_index_t *sorted_index,
+     int *number_of_entries,
+     libcerror_error_t **error );
+
+int libfwevt_sorted_index_get_entry_index_by_key(
+     libfwevt_sorted_index_t *sorted_index,
+     uint32_t key,
+     int *entry_index,
+     libcerror_error_t **error );
+
+int libfwevt_sorted_index_get_first_entry_index_in_key_range(
+     libfwevt_sorted_index_t *sorted_index,
+     uint32_t first_key,
+     uint32_t last_key,
+     int *entry_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWEVT_SORTED_INDEX_H ) */
+
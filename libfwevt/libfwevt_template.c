@@ -219,7 +219,8 @@ int libfwevt_internal_template_free(
 	}
 	if( *internal_template != NULL )
 	{
-		if( ( *internal_template )->data != NULL )
+		if( ( ( *internal_template )->data != NULL )
+		 && ( ( *internal_template )->data_is_borrowed == 0 ) )
 		{
 			memory_free(
 			 ( *internal_template )->data );
@@ -269,9 +270,45 @@ int libfwevt_template_read(
      size_t data_size,
      size_t data_offset,
      libcerror_error_t **error )
+{
+	static char *function = "libfwevt_template_read";
+
+	if( libfwevt_template_read_with_flags(
+	     wevt_template,
+	     data,
+	     data_size,
+	     data_offset,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read template.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads the template using specific read flags
+ * If LIBFWEVT_TEMPLATE_READ_FLAG_BORROW_DATA is set the template refers to the data
+ * instead of storing a copy, in which case the data must remain available while
+ * the template is used
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_template_read_with_flags(
+     libfwevt_template_t *wevt_template,
+     const uint8_t *data,
+     size_t data_size,
+     size_t data_offset,
+     uint8_t read_flags,
+     libcerror_error_t **error )
 {
 	libfwevt_internal_template_t *internal_template = NULL;
-	static char *function                           = "libfwevt_template_read";
+	static char *function                           = "libfwevt_template_read_with_flags";
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	libfwevt_xml_document_t *xml_document           = NULL;
@@ -334,6 +371,18 @@ int libfwevt_template_read(
 
 		return( -1 );
 	}
+	if( ( read_flags & ~( LIBFWEVT_TEMPLATE_READ_FLAG_BORROW_DATA ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported read flags: 0x%02" PRIx8 ".",
+		 function,
+		 read_flags );
+
+		return( -1 );
+	}
 	if( libfwevt_template_read_header(
 	     internal_template,
 	     &( data[ data_offset ] ),
@@ -389,33 +438,41 @@ int libfwevt_template_read(
 
 		goto on_error;
 	}
-	internal_template->data = (uint8_t *) memory_allocate(
-	                                       sizeof( uint8_t ) * internal_template->size );
-
-	if( internal_template->data == NULL )
+	if( ( read_flags & LIBFWEVT_TEMPLATE_READ_FLAG_BORROW_DATA ) != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create data.",
-		 function );
-
-		goto on_error;
+		internal_template->data             = (uint8_t *) &( data[ data_offset ] );
+		internal_template->data_is_borrowed = 1;
 	}
-	if( memory_copy(
-	     internal_template->data,
-	     &( data[ data_offset ] ),
-	     (size_t) internal_template->size ) == NULL )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
-		 "%s: unable to copy data.",
-		 function );
+		internal_template->data = (uint8_t *) memory_allocate(
+		                                       sizeof( uint8_t ) * internal_template->size );
 
-		goto on_error;
+		if( internal_template->data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create data.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_copy(
+		     internal_template->data,
+		     &( data[ data_offset ] ),
+		     (size_t) internal_template->size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	internal_template->data_size = (size_t) internal_template->size;
 
@@ -498,10 +555,13 @@ on_error:
 #endif
 	if( internal_template->data != NULL )
 	{
-		memory_free(
-		 internal_template->data );
-
-		internal_template->data = NULL;
+		if( internal_template->data_is_borrowed == 0 )
+		{
+			memory_free(
+			 internal_template->data );
+		}
+		internal_template->data             = NULL;
+		internal_template->data_is_borrowed = 0;
 	}
 	return( -1 );
 }
@@ -50,6 +50,11 @@ struct libfwevt_internal_template
 	 */
 	size_t data_size;
 
+	/* Value to indicate the data is borrowed from the caller
+	 * and is not owned by the template
+	 */
+	uint8_t data_is_borrowed;
+
 	/* The size
 	 */
 	uint32_t size;
@@ -110,6 +115,14 @@ int libfwevt_template_read(
      size_t data_offset,
      libcerror_error_t **error );
 
+int libfwevt_template_read_with_flags(
+     libfwevt_template_t *wevt_template,
+     const uint8_t *data,
+     size_t data_size,
+     size_t data_offset,
+     uint8_t read_flags,
+     libcerror_error_t **error );
+
 int libfwevt_template_read_header(
      libfwevt_internal_template_t *internal_template,
      const uint8_t *data,
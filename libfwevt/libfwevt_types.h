@@ -34,36 +34,46 @@
 /* The following type definitions hide internal data structures
  */
 #if defined( HAVE_DEBUG_OUTPUT ) && !defined( WINAPI )
+typedef struct libfwevt_catalog {}		libfwevt_catalog_t;
 typedef struct libfwevt_channel {}		libfwevt_channel_t;
 typedef struct libfwevt_event {}		libfwevt_event_t;
 typedef struct libfwevt_keyword {}		libfwevt_keyword_t;
 typedef struct libfwevt_level {}		libfwevt_level_t;
 typedef struct libfwevt_manifest {}		libfwevt_manifest_t;
+typedef struct libfwevt_manifest_archive {}	libfwevt_manifest_archive_t;
 typedef struct libfwevt_map {}			libfwevt_map_t;
 typedef struct libfwevt_opcode {}		libfwevt_opcode_t;
 typedef struct libfwevt_provider {}		libfwevt_provider_t;
 typedef struct libfwevt_task {}			libfwevt_task_t;
 typedef struct libfwevt_template {}		libfwevt_template_t;
 typedef struct libfwevt_template_item {}	libfwevt_template_item_t;
+typedef struct libfwevt_xml_cursor {}		libfwevt_xml_cursor_t;
 typedef struct libfwevt_xml_document {}		libfwevt_xml_document_t;
+typedef struct libfwevt_xml_path_filter {}	libfwevt_xml_path_filter_t;
 typedef struct libfwevt_xml_tag {}		libfwevt_xml_tag_t;
+typedef struct libfwevt_xml_template_cache {}	libfwevt_xml_template_cache_t;
 typedef struct libfwevt_xml_template_value {}	libfwevt_xml_template_value_t;
 typedef struct libfwevt_xml_value {}		libfwevt_xml_value_t;
 
 #else
+typedef intptr_t libfwevt_catalog_t;
 typedef intptr_t libfwevt_channel_t;
 typedef intptr_t libfwevt_event_t;
 typedef intptr_t libfwevt_keyword_t;
 typedef intptr_t libfwevt_level_t;
 typedef intptr_t libfwevt_manifest_t;
+typedef intptr_t libfwevt_manifest_archive_t;
 typedef intptr_t libfwevt_map_t;
 typedef intptr_t libfwevt_opcode_t;
 typedef intptr_t libfwevt_provider_t;
 typedef intptr_t libfwevt_task_t;
 typedef intptr_t libfwevt_template_t;
 typedef intptr_t libfwevt_template_item_t;
+typedef intptr_t libfwevt_xml_cursor_t;
 typedef intptr_t libfwevt_xml_document_t;
+typedef intptr_t libfwevt_xml_path_filter_t;
 typedef intptr_t libfwevt_xml_tag_t;
+typedef intptr_t libfwevt_xml_template_cache_t;
 typedef intptr_t libfwevt_xml_template_value_t;
 typedef intptr_t libfwevt_xml_value_t;
 
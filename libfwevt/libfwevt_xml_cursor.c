@@ -0,0 +1,2606 @@
+/*
+ * XML cursor functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_WCTYPE_H )
+#include <wctype.h>
+#endif
+
+#include "libfwevt_definitions.h"
+#include "libfwevt_libcerror.h"
+#include "libfwevt_libuna.h"
+#include "libfwevt_types.h"
+#include "libfwevt_unused.h"
+#include "libfwevt_xml_cursor.h"
+#include "libfwevt_xml_document.h"
+#include "libfwevt_xml_tag.h"
+#include "libfwevt_xml_value.h"
+
+/* Creates a XML cursor
+ * Make sure the value xml_cursor is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_cursor_initialize(
+     libfwevt_xml_cursor_t **xml_cursor,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_cursor_t *internal_xml_cursor = NULL;
+	static char *function                               = "libfwevt_xml_cursor_initialize";
+
+	if( xml_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *xml_cursor != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid XML cursor value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_cursor = memory_allocate_structure(
+	                       libfwevt_internal_xml_cursor_t );
+
+	if( internal_xml_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create XML cursor.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_xml_cursor,
+	     0,
+	     sizeof( libfwevt_internal_xml_cursor_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear XML cursor.",
+		 function );
+
+		memory_free(
+		 internal_xml_cursor );
+
+		return( -1 );
+	}
+	internal_xml_cursor->open_element_index    = -1;
+	internal_xml_cursor->current_element_index = -1;
+
+	*xml_cursor = (libfwevt_xml_cursor_t *) internal_xml_cursor;
+
+	return( 1 );
+
+on_error:
+	if( internal_xml_cursor != NULL )
+	{
+		memory_free(
+		 internal_xml_cursor );
+	}
+	return( -1 );
+}
+
+/* Frees a XML cursor
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_cursor_free(
+     libfwevt_xml_cursor_t **xml_cursor,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_cursor_t *internal_xml_cursor = NULL;
+	static char *function                               = "libfwevt_xml_cursor_free";
+	int result                                          = 1;
+
+	if( xml_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( *xml_cursor != NULL )
+	{
+		internal_xml_cursor = (libfwevt_internal_xml_cursor_t *) *xml_cursor;
+		*xml_cursor         = NULL;
+
+		if( internal_xml_cursor->xml_value != NULL )
+		{
+			if( libfwevt_internal_xml_value_free(
+			     (libfwevt_internal_xml_value_t **) &( internal_xml_cursor->xml_value ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free XML value.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_xml_cursor->entries != NULL )
+		{
+			memory_free(
+			 internal_xml_cursor->entries );
+		}
+		if( internal_xml_cursor->data != NULL )
+		{
+			memory_free(
+			 internal_xml_cursor->data );
+		}
+		memory_free(
+		 internal_xml_cursor );
+	}
+	return( result );
+}
+
+/* Clears the entries of a XML cursor
+ * The allocated memory and the XML value are retained for reuse
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_internal_xml_cursor_clear(
+     libfwevt_internal_xml_cursor_t *internal_xml_cursor,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_internal_xml_cursor_clear";
+
+	if( internal_xml_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_xml_cursor->xml_value != NULL )
+	{
+		if( libfwevt_internal_xml_value_empty(
+		     (libfwevt_internal_xml_value_t *) internal_xml_cursor->xml_value,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty XML value.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	internal_xml_cursor->binary_data           = NULL;
+	internal_xml_cursor->binary_data_size      = 0;
+	internal_xml_cursor->number_of_entries     = 0;
+	internal_xml_cursor->data_size             = 0;
+	internal_xml_cursor->open_element_index    = -1;
+	internal_xml_cursor->current_element_index = -1;
+
+	return( 1 );
+}
+
+/* Determines if data is part of the binary data the entries are read from
+ * Returns 1 if the data is part of the binary data or if the binary data is not set, 0 if not
+ */
+int libfwevt_internal_xml_cursor_is_binary_data(
+     libfwevt_internal_xml_cursor_t *internal_xml_cursor,
+     const uint8_t *data,
+     size_t data_size )
+{
+	if( ( internal_xml_cursor == NULL )
+	 || ( internal_xml_cursor->binary_data == NULL )
+	 || ( data_size == 0 ) )
+	{
+		return( 1 );
+	}
+	if( ( data < internal_xml_cursor->binary_data )
+	 || ( data_size > internal_xml_cursor->binary_data_size )
+	 || ( (size_t) ( data - internal_xml_cursor->binary_data ) > ( internal_xml_cursor->binary_data_size - data_size ) ) )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Appends an entry
+ * The name and value data that are part of the binary data are referenced,
+ * other name and value data, such as that of character references, are copied
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_internal_xml_cursor_append_entry(
+     libfwevt_internal_xml_cursor_t *internal_xml_cursor,
+     uint8_t entry_type,
+     const uint8_t *name_data,
+     size_t name_data_size,
+     uint8_t value_type,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     int *entry_index,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_cursor_entry_t *entries = NULL;
+	libfwevt_xml_cursor_entry_t *entry   = NULL;
+	uint8_t *data                        = NULL;
+	static char *function                = "libfwevt_internal_xml_cursor_append_entry";
+	size_t allocated_data_size           = 0;
+	size_t entries_size                  = 0;
+	size_t name_copy_size                = 0;
+	size_t required_data_size            = 0;
+	size_t value_data_copy_size          = 0;
+	int number_of_allocated_entries      = 0;
+
+	if( internal_xml_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_data == NULL )
+	 && ( name_data_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name data.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_data_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_data == NULL )
+	 && ( value_data_size != 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid value data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_xml_cursor->number_of_entries >= internal_xml_cursor->number_of_allocated_entries )
+	{
+		if( internal_xml_cursor->number_of_allocated_entries == 0 )
+		{
+			number_of_allocated_entries = 64;
+		}
+		else if( internal_xml_cursor->number_of_allocated_entries < ( INT_MAX / 2 ) )
+		{
+			number_of_allocated_entries = internal_xml_cursor->number_of_allocated_entries * 2;
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid XML cursor - number of entries value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		entries_size = sizeof( libfwevt_xml_cursor_entry_t ) * number_of_allocated_entries;
+
+		if( entries_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid entries size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		entries = (libfwevt_xml_cursor_entry_t *) memory_reallocate(
+		                                           internal_xml_cursor->entries,
+		                                           entries_size );
+
+		if( entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize entries.",
+			 function );
+
+			return( -1 );
+		}
+		internal_xml_cursor->entries                     = entries;
+		internal_xml_cursor->number_of_allocated_entries = number_of_allocated_entries;
+	}
+	if( libfwevt_internal_xml_cursor_is_binary_data(
+	     internal_xml_cursor,
+	     name_data,
+	     name_data_size ) == 0 )
+	{
+		name_copy_size = name_data_size;
+	}
+	if( libfwevt_internal_xml_cursor_is_binary_data(
+	     internal_xml_cursor,
+	     value_data,
+	     value_data_size ) == 0 )
+	{
+		value_data_copy_size = value_data_size;
+	}
+	required_data_size = name_copy_size + value_data_copy_size;
+
+	if( ( required_data_size > 0 )
+	 && ( ( internal_xml_cursor->data == NULL )
+	  ||  ( required_data_size > ( internal_xml_cursor->allocated_data_size - internal_xml_cursor->data_size ) ) ) )
+	{
+		allocated_data_size = internal_xml_cursor->allocated_data_size;
+
+		if( allocated_data_size == 0 )
+		{
+			allocated_data_size = 1024;
+		}
+		while( required_data_size > ( allocated_data_size - internal_xml_cursor->data_size ) )
+		{
+			if( allocated_data_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid data size value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			allocated_data_size *= 2;
+		}
+		data = (uint8_t *) memory_reallocate(
+		                    internal_xml_cursor->data,
+		                    sizeof( uint8_t ) * allocated_data_size );
+
+		if( data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize data.",
+			 function );
+
+			return( -1 );
+		}
+		internal_xml_cursor->data                = data;
+		internal_xml_cursor->allocated_data_size = allocated_data_size;
+	}
+	entry = &( internal_xml_cursor->entries[ internal_xml_cursor->number_of_entries ] );
+
+	entry->flags             = 0;
+	entry->name_data         = name_data;
+	entry->name_offset       = 0;
+	entry->value_data        = value_data;
+	entry->value_data_offset = 0;
+
+	/* The copied data is referenced after all entries are read,
+	 * since the data of the cursor can be reallocated
+	 */
+	if( name_copy_size > 0 )
+	{
+		if( memory_copy(
+		     &( internal_xml_cursor->data[ internal_xml_cursor->data_size ] ),
+		     name_data,
+		     name_copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name data.",
+			 function );
+
+			return( -1 );
+		}
+		entry->flags      |= LIBFWEVT_XML_CURSOR_ENTRY_FLAG_NAME_IS_COPIED;
+		entry->name_data   = NULL;
+		entry->name_offset = internal_xml_cursor->data_size;
+	}
+	if( value_data_copy_size > 0 )
+	{
+		if( memory_copy(
+		     &( internal_xml_cursor->data[ internal_xml_cursor->data_size + name_copy_size ] ),
+		     value_data,
+		     value_data_copy_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value data.",
+			 function );
+
+			return( -1 );
+		}
+		entry->flags            |= LIBFWEVT_XML_CURSOR_ENTRY_FLAG_VALUE_DATA_IS_COPIED;
+		entry->value_data        = NULL;
+		entry->value_data_offset = internal_xml_cursor->data_size + name_copy_size;
+	}
+	entry->type                 = entry_type;
+	entry->value_type           = value_type;
+	entry->name_size            = name_data_size;
+	entry->value_data_size      = value_data_size;
+	entry->parent_index         = internal_xml_cursor->open_element_index;
+	entry->end_index            = internal_xml_cursor->number_of_entries + 1;
+	entry->number_of_attributes = 0;
+
+	internal_xml_cursor->data_size += required_data_size;
+
+	*entry_index = internal_xml_cursor->number_of_entries;
+
+	internal_xml_cursor->number_of_entries += 1;
+
+	return( 1 );
+}
+
+/* Sets the name and value data of the entries that refer to copied data
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_internal_xml_cursor_set_copied_data(
+     libfwevt_internal_xml_cursor_t *internal_xml_cursor,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_cursor_entry_t *entry = NULL;
+	static char *function              = "libfwevt_internal_xml_cursor_set_copied_data";
+	int entry_index                    = 0;
+
+	if( internal_xml_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML cursor.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < internal_xml_cursor->number_of_entries;
+	     entry_index++ )
+	{
+		entry = &( internal_xml_cursor->entries[ entry_index ] );
+
+		if( ( entry->flags & LIBFWEVT_XML_CURSOR_ENTRY_FLAG_NAME_IS_COPIED ) != 0 )
+		{
+			entry->name_data = &( internal_xml_cursor->data[ entry->name_offset ] );
+		}
+		if( ( entry->flags & LIBFWEVT_XML_CURSOR_ENTRY_FLAG_VALUE_DATA_IS_COPIED ) != 0 )
+		{
+			entry->value_data = &( internal_xml_cursor->data[ entry->value_data_offset ] );
+		}
+	}
+	return( 1 );
+}
+
+/* Appends the entry of an element that is started
+ * Callback function for libfwevt_xml_document_parse_with_callbacks
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_cursor_start_element_callback(
+     const uint8_t *name_utf16_stream,
+     size_t name_utf16_stream_size,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_cursor_t *internal_xml_cursor = NULL;
+	static char *function                               = "libfwevt_xml_cursor_start_element_callback";
+	int entry_index                                     = 0;
+
+	if( callback_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback data.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_cursor = (libfwevt_internal_xml_cursor_t *) callback_data;
+
+	if( libfwevt_internal_xml_cursor_append_entry(
+	     internal_xml_cursor,
+	     LIBFWEVT_XML_CURSOR_ENTRY_TYPE_ELEMENT,
+	     name_utf16_stream,
+	     name_utf16_stream_size,
+	     0,
+	     NULL,
+	     0,
+	     &entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append element entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_cursor->open_element_index = entry_index;
+
+	return( 1 );
+}
+
+/* Appends the entry of an attribute of the element that is started
+ * Callback function for libfwevt_xml_document_parse_with_callbacks
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_cursor_attribute_callback(
+     const uint8_t *name_utf16_stream,
+     size_t name_utf16_stream_size,
+     uint8_t value_type,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_cursor_t *internal_xml_cursor = NULL;
+	static char *function                               = "libfwevt_xml_cursor_attribute_callback";
+	int entry_index                                     = 0;
+
+	if( callback_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback data.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_cursor = (libfwevt_internal_xml_cursor_t *) callback_data;
+
+	if( internal_xml_cursor->open_element_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid XML cursor - missing open element.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_internal_xml_cursor_append_entry(
+	     internal_xml_cursor,
+	     LIBFWEVT_XML_CURSOR_ENTRY_TYPE_ATTRIBUTE,
+	     name_utf16_stream,
+	     name_utf16_stream_size,
+	     value_type,
+	     value_data,
+	     value_data_size,
+	     &entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append attribute entry.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_cursor->entries[ internal_xml_cursor->open_element_index ].number_of_attributes += 1;
+
+	return( 1 );
+}
+
+/* Appends the entry of a value of the element that is started
+ * Callback function for libfwevt_xml_document_parse_with_callbacks
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_cursor_value_callback(
+     uint8_t value_type,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_cursor_t *internal_xml_cursor = NULL;
+	static char *function                               = "libfwevt_xml_cursor_value_callback";
+	int entry_index                                     = 0;
+
+	if( callback_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback data.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_cursor = (libfwevt_internal_xml_cursor_t *) callback_data;
+
+	if( internal_xml_cursor->open_element_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid XML cursor - missing open element.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_internal_xml_cursor_append_entry(
+	     internal_xml_cursor,
+	     LIBFWEVT_XML_CURSOR_ENTRY_TYPE_VALUE,
+	     NULL,
+	     0,
+	     value_type,
+	     value_data,
+	     value_data_size,
+	     &entry_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value entry.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes the entry of the element that is ended
+ * Callback function for libfwevt_xml_document_parse_with_callbacks
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_cursor_end_element_callback(
+     const uint8_t *name_utf16_stream LIBFWEVT_ATTRIBUTE_UNUSED,
+     size_t name_utf16_stream_size LIBFWEVT_ATTRIBUTE_UNUSED,
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_cursor_t *internal_xml_cursor = NULL;
+	libfwevt_xml_cursor_entry_t *entry                  = NULL;
+	static char *function                               = "libfwevt_xml_cursor_end_element_callback";
+
+	LIBFWEVT_UNREFERENCED_PARAMETER( name_utf16_stream )
+	LIBFWEVT_UNREFERENCED_PARAMETER( name_utf16_stream_size )
+
+	if( callback_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback data.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_cursor = (libfwevt_internal_xml_cursor_t *) callback_data;
+
+	if( internal_xml_cursor->open_element_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid XML cursor - missing open element.",
+		 function );
+
+		return( -1 );
+	}
+	entry = &( internal_xml_cursor->entries[ internal_xml_cursor->open_element_index ] );
+
+	entry->end_index = internal_xml_cursor->number_of_entries;
+
+	internal_xml_cursor->open_element_index = entry->parent_index;
+
+	return( 1 );
+}
+
+/* Reads the entries of a binary XML document
+ * The binary XML document is parsed with the XML document, which template cache
+ * and path filter are used, and no XML tags are built. The entries refer to the names
+ * and value data in the binary data, hence the cursor is only valid while the binary
+ * data and the template cache of the XML document remain available. The cursor is
+ * positioned on the root element
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_cursor_read(
+     libfwevt_xml_cursor_t *xml_cursor,
+     libfwevt_xml_document_t *xml_document,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     int ascii_codepage,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_cursor_t *internal_xml_cursor = NULL;
+	static char *function                               = "libfwevt_xml_cursor_read";
+
+	if( xml_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_cursor = (libfwevt_internal_xml_cursor_t *) xml_cursor;
+
+	if( libfwevt_internal_xml_cursor_clear(
+	     internal_xml_cursor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear XML cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_cursor->binary_data      = binary_data;
+	internal_xml_cursor->binary_data_size = binary_data_size;
+
+	/* The value data is borrowed so that it refers to the binary data
+	 */
+	if( libfwevt_xml_document_parse_with_callbacks(
+	     xml_document,
+	     binary_data,
+	     binary_data_size,
+	     binary_data_offset,
+	     ascii_codepage,
+	     ( flags & ~( LIBFWEVT_XML_DOCUMENT_READ_FLAG_USE_ARENA ) ) | LIBFWEVT_XML_DOCUMENT_READ_FLAG_BORROW_DATA,
+	     &libfwevt_xml_cursor_start_element_callback,
+	     &libfwevt_xml_cursor_attribute_callback,
+	     &libfwevt_xml_cursor_value_callback,
+	     NULL,
+	     &libfwevt_xml_cursor_end_element_callback,
+	     (void *) internal_xml_cursor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to parse XML document.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_xml_cursor->open_element_index != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid XML cursor - open element index value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_internal_xml_cursor_set_copied_data(
+	     internal_xml_cursor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set copied data.",
+		 function );
+
+		goto on_error;
+	}
+	if( internal_xml_cursor->number_of_entries > 0 )
+	{
+		internal_xml_cursor->current_element_index = 0;
+	}
+	return( 1 );
+
+on_error:
+	libfwevt_internal_xml_cursor_clear(
+	 internal_xml_cursor,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Reads the entries of a XML tag and its sub elements
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_internal_xml_cursor_read_element(
+     libfwevt_internal_xml_cursor_t *internal_xml_cursor,
+     libfwevt_xml_tag_t *xml_tag,
+     int element_recursion_depth,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *sub_xml_tag  = NULL;
+	libfwevt_xml_value_t *xml_value  = NULL;
+	const uint8_t *name_data         = NULL;
+	const uint8_t *value_data        = NULL;
+	static char *function            = "libfwevt_internal_xml_cursor_read_element";
+	size_t name_data_size            = 0;
+	size_t value_data_size           = 0;
+	uint8_t value_type               = 0;
+	int data_segment_index           = 0;
+	int element_index                = 0;
+	int entry_index                  = 0;
+	int number_of_data_segments      = 0;
+	int number_of_sub_tags           = 0;
+	int sub_tag_index                = 0;
+
+	if( internal_xml_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( element_recursion_depth < 0 )
+	 || ( element_recursion_depth > LIBFWEVT_XML_DOCUMENT_ELEMENT_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid element recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_get_name_data(
+	     xml_tag,
+	     &name_data,
+	     &name_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve name data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_cursor_start_element_callback(
+	     name_data,
+	     name_data_size,
+	     (void *) internal_xml_cursor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append element entry.",
+		 function );
+
+		return( -1 );
+	}
+	element_index = internal_xml_cursor->open_element_index;
+
+	if( libfwevt_xml_tag_get_number_of_attributes(
+	     xml_tag,
+	     &number_of_sub_tags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of attributes.",
+		 function );
+
+		return( -1 );
+	}
+	for( sub_tag_index = 0;
+	     sub_tag_index < number_of_sub_tags;
+	     sub_tag_index++ )
+	{
+		if( libfwevt_xml_tag_get_attribute_by_index(
+		     xml_tag,
+		     sub_tag_index,
+		     &sub_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve attribute: %d.",
+			 function,
+			 sub_tag_index );
+
+			return( -1 );
+		}
+		if( libfwevt_xml_tag_get_name_data(
+		     sub_xml_tag,
+		     &name_data,
+		     &name_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve attribute: %d name data.",
+			 function,
+			 sub_tag_index );
+
+			return( -1 );
+		}
+		if( libfwevt_xml_tag_get_value(
+		     sub_xml_tag,
+		     &xml_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve attribute: %d value.",
+			 function,
+			 sub_tag_index );
+
+			return( -1 );
+		}
+		value_type      = 0;
+		value_data      = NULL;
+		value_data_size = 0;
+
+		if( xml_value != NULL )
+		{
+			if( libfwevt_xml_value_get_type(
+			     xml_value,
+			     &value_type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve attribute: %d value type.",
+				 function,
+				 sub_tag_index );
+
+				return( -1 );
+			}
+			if( libfwevt_xml_value_get_number_of_data_segments(
+			     xml_value,
+			     &number_of_data_segments,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve attribute: %d number of value data segments.",
+				 function,
+				 sub_tag_index );
+
+				return( -1 );
+			}
+			if( number_of_data_segments > 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported attribute: %d number of value data segments.",
+				 function,
+				 sub_tag_index );
+
+				return( -1 );
+			}
+			else if( number_of_data_segments == 1 )
+			{
+				if( libfwevt_xml_value_get_data_segment_data(
+				     xml_value,
+				     0,
+				     &value_data,
+				     &value_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve attribute: %d value data.",
+					 function,
+					 sub_tag_index );
+
+					return( -1 );
+				}
+			}
+		}
+		if( libfwevt_xml_cursor_attribute_callback(
+		     name_data,
+		     name_data_size,
+		     value_type,
+		     value_data,
+		     value_data_size,
+		     (void *) internal_xml_cursor,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append attribute: %d entry.",
+			 function,
+			 sub_tag_index );
+
+			return( -1 );
+		}
+	}
+	if( libfwevt_xml_tag_get_value(
+	     xml_tag,
+	     &xml_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_value != NULL )
+	{
+		if( libfwevt_xml_value_get_type(
+		     xml_value,
+		     &value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwevt_xml_value_get_number_of_data_segments(
+		     xml_value,
+		     &number_of_data_segments,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of value data segments.",
+			 function );
+
+			return( -1 );
+		}
+		for( data_segment_index = 0;
+		     data_segment_index < number_of_data_segments;
+		     data_segment_index++ )
+		{
+			if( libfwevt_xml_value_get_data_segment_data(
+			     xml_value,
+			     data_segment_index,
+			     &value_data,
+			     &value_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value data segment: %d data.",
+				 function,
+				 data_segment_index );
+
+				return( -1 );
+			}
+			if( libfwevt_internal_xml_cursor_append_entry(
+			     internal_xml_cursor,
+			     LIBFWEVT_XML_CURSOR_ENTRY_TYPE_VALUE,
+			     NULL,
+			     0,
+			     value_type,
+			     value_data,
+			     value_data_size,
+			     &entry_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append value entry.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	if( libfwevt_xml_tag_get_number_of_elements(
+	     xml_tag,
+	     &number_of_sub_tags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements.",
+		 function );
+
+		return( -1 );
+	}
+	for( sub_tag_index = 0;
+	     sub_tag_index < number_of_sub_tags;
+	     sub_tag_index++ )
+	{
+		if( libfwevt_xml_tag_get_element_by_index(
+		     xml_tag,
+		     sub_tag_index,
+		     &sub_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d.",
+			 function,
+			 sub_tag_index );
+
+			return( -1 );
+		}
+		if( libfwevt_internal_xml_cursor_read_element(
+		     internal_xml_cursor,
+		     sub_xml_tag,
+		     element_recursion_depth + 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read element: %d.",
+			 function,
+			 sub_tag_index );
+
+			return( -1 );
+		}
+	}
+	internal_xml_cursor->entries[ element_index ].end_index = internal_xml_cursor->number_of_entries;
+
+	internal_xml_cursor->open_element_index = internal_xml_cursor->entries[ element_index ].parent_index;
+
+	return( 1 );
+}
+
+/* Reads the entries of a XML tag, such as the root XML tag of a XML document that was read
+ * The entries refer to the names and value data of the XML tag, hence the cursor is
+ * only valid while the XML tag remains available. The cursor is positioned on the XML tag
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_cursor_read_xml_tag(
+     libfwevt_xml_cursor_t *xml_cursor,
+     libfwevt_xml_tag_t *xml_tag,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_cursor_t *internal_xml_cursor = NULL;
+	static char *function                               = "libfwevt_xml_cursor_read_xml_tag";
+
+	if( xml_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_cursor = (libfwevt_internal_xml_cursor_t *) xml_cursor;
+
+	if( xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_internal_xml_cursor_clear(
+	     internal_xml_cursor,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear XML cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_internal_xml_cursor_read_element(
+	     internal_xml_cursor,
+	     xml_tag,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read element.",
+		 function );
+
+		libfwevt_internal_xml_cursor_clear(
+		 internal_xml_cursor,
+		 NULL );
+
+		return( -1 );
+	}
+	internal_xml_cursor->current_element_index = 0;
+
+	return( 1 );
+}
+
+/* Moves the cursor to the root element
+ * Returns 1 if successful, 0 if there is no root element or -1 on error
+ */
+int libfwevt_xml_cursor_go_to_root(
+     libfwevt_xml_cursor_t *xml_cursor,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_cursor_t *internal_xml_cursor = NULL;
+	static char *function                               = "libfwevt_xml_cursor_go_to_root";
+
+	if( xml_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_cursor = (libfwevt_internal_xml_cursor_t *) xml_cursor;
+
+	if( internal_xml_cursor->number_of_entries == 0 )
+	{
+		return( 0 );
+	}
+	internal_xml_cursor->current_element_index = 0;
+
+	return( 1 );
+}
+
+/* Moves the cursor to the next sibling element
+ * Returns 1 if successful, 0 if there is no next sibling element or -1 on error
+ */
+int libfwevt_xml_cursor_next(
+     libfwevt_xml_cursor_t *xml_cursor,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_cursor_t *internal_xml_cursor = NULL;
+	libfwevt_xml_cursor_entry_t *entry                  = NULL;
+	static char *function                               = "libfwevt_xml_cursor_next";
+	int entry_index                                     = 0;
+	int last_entry_index                                = 0;
+
+	if( xml_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_cursor = (libfwevt_internal_xml_cursor_t *) xml_cursor;
+
+	if( libfwevt_internal_xml_cursor_get_current_element(
+	     internal_xml_cursor,
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current element.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry->parent_index == -1 )
+	{
+		last_entry_index = internal_xml_cursor->number_of_entries;
+	}
+	else
+	{
+		last_entry_index = internal_xml_cursor->entries[ entry->parent_index ].end_index;
+	}
+	/* The entries of the sub elements are skipped using the end index,
+	 * hence only values of the parent element remain to be skipped
+	 */
+	for( entry_index = entry->end_index;
+	     entry_index < last_entry_index;
+	     entry_index++ )
+	{
+		if( internal_xml_cursor->entries[ entry_index ].type == LIBFWEVT_XML_CURSOR_ENTRY_TYPE_ELEMENT )
+		{
+			internal_xml_cursor->current_element_index = entry_index;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Moves the cursor to the first sub element
+ * Returns 1 if successful, 0 if there is no sub element or -1 on error
+ */
+int libfwevt_xml_cursor_enter_child(
+     libfwevt_xml_cursor_t *xml_cursor,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_cursor_t *internal_xml_cursor = NULL;
+	libfwevt_xml_cursor_entry_t *entry                  = NULL;
+	static char *function                               = "libfwevt_xml_cursor_enter_child";
+	int entry_index                                     = 0;
+
+	if( xml_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_cursor = (libfwevt_internal_xml_cursor_t *) xml_cursor;
+
+	if( libfwevt_internal_xml_cursor_get_current_element(
+	     internal_xml_cursor,
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current element.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = internal_xml_cursor->current_element_index + 1 + entry->number_of_attributes;
+	     entry_index < entry->end_index;
+	     entry_index++ )
+	{
+		if( internal_xml_cursor->entries[ entry_index ].type == LIBFWEVT_XML_CURSOR_ENTRY_TYPE_ELEMENT )
+		{
+			internal_xml_cursor->current_element_index = entry_index;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Moves the cursor to the parent element
+ * Returns 1 if successful, 0 if there is no parent element or -1 on error
+ */
+int libfwevt_xml_cursor_leave(
+     libfwevt_xml_cursor_t *xml_cursor,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_cursor_t *internal_xml_cursor = NULL;
+	libfwevt_xml_cursor_entry_t *entry                  = NULL;
+	static char *function                               = "libfwevt_xml_cursor_leave";
+
+	if( xml_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_cursor = (libfwevt_internal_xml_cursor_t *) xml_cursor;
+
+	if( libfwevt_internal_xml_cursor_get_current_element(
+	     internal_xml_cursor,
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current element.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry->parent_index == -1 )
+	{
+		return( 0 );
+	}
+	internal_xml_cursor->current_element_index = entry->parent_index;
+
+	return( 1 );
+}
+
+/* Retrieves the entry of the current element
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_internal_xml_cursor_get_current_element(
+     libfwevt_internal_xml_cursor_t *internal_xml_cursor,
+     libfwevt_xml_cursor_entry_t **entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_internal_xml_cursor_get_current_element";
+
+	if( internal_xml_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_xml_cursor->current_element_index < 0 )
+	 || ( internal_xml_cursor->current_element_index >= internal_xml_cursor->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid XML cursor - current element index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*entry = &( internal_xml_cursor->entries[ internal_xml_cursor->current_element_index ] );
+
+	return( 1 );
+}
+
+/* Retrieves the entry of a specific attribute of the current element
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_internal_xml_cursor_get_attribute(
+     libfwevt_internal_xml_cursor_t *internal_xml_cursor,
+     int attribute_index,
+     libfwevt_xml_cursor_entry_t **entry,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_cursor_entry_t *element_entry = NULL;
+	static char *function                      = "libfwevt_internal_xml_cursor_get_attribute";
+
+	if( libfwevt_internal_xml_cursor_get_current_element(
+	     internal_xml_cursor,
+	     &element_entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current element.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( attribute_index < 0 )
+	 || ( attribute_index >= element_entry->number_of_attributes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid attribute index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*entry = &( internal_xml_cursor->entries[ internal_xml_cursor->current_element_index + 1 + attribute_index ] );
+
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded name of the current element
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_cursor_get_utf8_name_size(
+     libfwevt_xml_cursor_t *xml_cursor,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_cursor_t *internal_xml_cursor = NULL;
+	libfwevt_xml_cursor_entry_t *entry                  = NULL;
+	static char *function                               = "libfwevt_xml_cursor_get_utf8_name_size";
+
+	if( xml_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_cursor = (libfwevt_internal_xml_cursor_t *) xml_cursor;
+
+	if( libfwevt_internal_xml_cursor_get_current_element(
+	     internal_xml_cursor,
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current element.",
+		 function );
+
+		return( -1 );
+	}
+	if( libuna_utf8_string_size_from_utf16_stream(
+	     entry->name_data,
+	     entry->name_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded name of the current element
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_cursor_get_utf8_name(
+     libfwevt_xml_cursor_t *xml_cursor,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_cursor_t *internal_xml_cursor = NULL;
+	libfwevt_xml_cursor_entry_t *entry                  = NULL;
+	static char *function                               = "libfwevt_xml_cursor_get_utf8_name";
+
+	if( xml_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_cursor = (libfwevt_internal_xml_cursor_t *) xml_cursor;
+
+	if( libfwevt_internal_xml_cursor_get_current_element(
+	     internal_xml_cursor,
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current element.",
+		 function );
+
+		return( -1 );
+	}
+	if( libuna_utf8_string_copy_from_utf16_stream(
+	     utf8_string,
+	     utf8_string_size,
+	     entry->name_data,
+	     entry->name_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy name to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-16 encoded name of the current element
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_cursor_get_utf16_name_size(
+     libfwevt_xml_cursor_t *xml_cursor,
+     size_t *utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_cursor_t *internal_xml_cursor = NULL;
+	libfwevt_xml_cursor_entry_t *entry                  = NULL;
+	static char *function                               = "libfwevt_xml_cursor_get_utf16_name_size";
+
+	if( xml_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_cursor = (libfwevt_internal_xml_cursor_t *) xml_cursor;
+
+	if( libfwevt_internal_xml_cursor_get_current_element(
+	     internal_xml_cursor,
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current element.",
+		 function );
+
+		return( -1 );
+	}
+	if( libuna_utf16_string_size_from_utf16_stream(
+	     entry->name_data,
+	     entry->name_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     utf16_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-16 string size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 encoded name of the current element
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_cursor_get_utf16_name(
+     libfwevt_xml_cursor_t *xml_cursor,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_cursor_t *internal_xml_cursor = NULL;
+	libfwevt_xml_cursor_entry_t *entry                  = NULL;
+	static char *function                               = "libfwevt_xml_cursor_get_utf16_name";
+
+	if( xml_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_cursor = (libfwevt_internal_xml_cursor_t *) xml_cursor;
+
+	if( libfwevt_internal_xml_cursor_get_current_element(
+	     internal_xml_cursor,
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current element.",
+		 function );
+
+		return( -1 );
+	}
+	if( libuna_utf16_string_copy_from_utf16_stream(
+	     utf16_string,
+	     utf16_string_size,
+	     entry->name_data,
+	     entry->name_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy name to UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the value type of the current element
+ * Returns 1 if successful, 0 if the element has no value or -1 on error
+ */
+int libfwevt_xml_cursor_get_value_type(
+     libfwevt_xml_cursor_t *xml_cursor,
+     uint8_t *value_type,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_cursor_t *internal_xml_cursor = NULL;
+	libfwevt_xml_cursor_entry_t *entry                  = NULL;
+	static char *function                               = "libfwevt_xml_cursor_get_value_type";
+	int entry_index                                     = 0;
+
+	if( xml_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_cursor = (libfwevt_internal_xml_cursor_t *) xml_cursor;
+
+	if( libfwevt_internal_xml_cursor_get_current_element(
+	     internal_xml_cursor,
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current element.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value type.",
+		 function );
+
+		return( -1 );
+	}
+	entry_index = internal_xml_cursor->current_element_index + 1 + entry->number_of_attributes;
+
+	while( entry_index < entry->end_index )
+	{
+		if( internal_xml_cursor->entries[ entry_index ].type == LIBFWEVT_XML_CURSOR_ENTRY_TYPE_VALUE )
+		{
+			*value_type = internal_xml_cursor->entries[ entry_index ].value_type;
+
+			return( 1 );
+		}
+		entry_index = internal_xml_cursor->entries[ entry_index ].end_index;
+	}
+	return( 0 );
+}
+
+/* Sets the XML value of the cursor from an attribute or the values of an element
+ * The XML value of the cursor is reused, its data segments refer to the value data of the entries
+ * Returns 1 if successful, 0 if there is no value or -1 on error
+ */
+int libfwevt_internal_xml_cursor_set_xml_value(
+     libfwevt_internal_xml_cursor_t *internal_xml_cursor,
+     int entry_index,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_cursor_entry_t *entry       = NULL;
+	libfwevt_xml_cursor_entry_t *value_entry = NULL;
+	static char *function                    = "libfwevt_internal_xml_cursor_set_xml_value";
+	int data_segment_index                   = 0;
+	int last_entry_index                     = 0;
+	int result                               = 0;
+	int value_entry_index                    = 0;
+
+	if( internal_xml_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML cursor.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( entry_index < 0 )
+	 || ( entry_index >= internal_xml_cursor->number_of_entries ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entry index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	entry = &( internal_xml_cursor->entries[ entry_index ] );
+
+	if( entry->type == LIBFWEVT_XML_CURSOR_ENTRY_TYPE_ATTRIBUTE )
+	{
+		value_entry_index = entry_index;
+		last_entry_index  = entry_index + 1;
+	}
+	else
+	{
+		value_entry_index = entry_index + 1 + entry->number_of_attributes;
+		last_entry_index  = entry->end_index;
+	}
+	/* The entries of the sub elements are skipped using the end index
+	 */
+	while( value_entry_index < last_entry_index )
+	{
+		value_entry = &( internal_xml_cursor->entries[ value_entry_index ] );
+
+		if( value_entry->type != LIBFWEVT_XML_CURSOR_ENTRY_TYPE_ELEMENT )
+		{
+			if( result == 0 )
+			{
+				if( internal_xml_cursor->xml_value == NULL )
+				{
+					if( libfwevt_xml_value_initialize(
+					     &( internal_xml_cursor->xml_value ),
+					     value_entry->value_type,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+						 "%s: unable to create XML value.",
+						 function );
+
+						goto on_error;
+					}
+				}
+				else if( libfwevt_internal_xml_value_empty(
+				          (libfwevt_internal_xml_value_t *) internal_xml_cursor->xml_value,
+				          value_entry->value_type,
+				          error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to empty XML value.",
+					 function );
+
+					goto on_error;
+				}
+				result = 1;
+			}
+			if( libfwevt_xml_value_append_data_segment(
+			     internal_xml_cursor->xml_value,
+			     value_entry->value_data,
+			     value_entry->value_data_size,
+			     LIBFWEVT_DATA_SEGMENT_FLAG_BORROW_DATA,
+			     &data_segment_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append value data segment.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		value_entry_index = value_entry->end_index;
+	}
+	return( result );
+
+on_error:
+	if( internal_xml_cursor->xml_value != NULL )
+	{
+		libfwevt_internal_xml_value_empty(
+		 (libfwevt_internal_xml_value_t *) internal_xml_cursor->xml_value,
+		 0,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the value of the current element
+ * The XML value is managed by the cursor and remains valid until another value
+ * is retrieved or the cursor is read or freed
+ * Returns 1 if successful, 0 if the element has no value or -1 on error
+ */
+int libfwevt_xml_cursor_get_value(
+     libfwevt_xml_cursor_t *xml_cursor,
+     libfwevt_xml_value_t **xml_value,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_cursor_t *internal_xml_cursor = NULL;
+	libfwevt_xml_cursor_entry_t *entry                  = NULL;
+	static char *function                               = "libfwevt_xml_cursor_get_value";
+	int result                                          = 0;
+
+	if( xml_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_cursor = (libfwevt_internal_xml_cursor_t *) xml_cursor;
+
+	if( libfwevt_internal_xml_cursor_get_current_element(
+	     internal_xml_cursor,
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current element.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML value.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwevt_internal_xml_cursor_set_xml_value(
+	          internal_xml_cursor,
+	          internal_xml_cursor->current_element_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set XML value.",
+		 function );
+
+		return( -1 );
+	}
+	if( result == 0 )
+	{
+		*xml_value = NULL;
+	}
+	else
+	{
+		*xml_value = internal_xml_cursor->xml_value;
+	}
+	return( result );
+}
+
+/* Retrieves the number of attributes of the current element
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_cursor_get_number_of_attributes(
+     libfwevt_xml_cursor_t *xml_cursor,
+     int *number_of_attributes,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_cursor_t *internal_xml_cursor = NULL;
+	libfwevt_xml_cursor_entry_t *entry                  = NULL;
+	static char *function                               = "libfwevt_xml_cursor_get_number_of_attributes";
+
+	if( xml_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_cursor = (libfwevt_internal_xml_cursor_t *) xml_cursor;
+
+	if( libfwevt_internal_xml_cursor_get_current_element(
+	     internal_xml_cursor,
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current element.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_attributes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of attributes.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_attributes = entry->number_of_attributes;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded name of a specific attribute of the current element
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_cursor_get_attribute_utf8_name_size(
+     libfwevt_xml_cursor_t *xml_cursor,
+     int attribute_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_cursor_t *internal_xml_cursor = NULL;
+	libfwevt_xml_cursor_entry_t *entry                  = NULL;
+	static char *function                               = "libfwevt_xml_cursor_get_attribute_utf8_name_size";
+
+	if( xml_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_cursor = (libfwevt_internal_xml_cursor_t *) xml_cursor;
+
+	if( libfwevt_internal_xml_cursor_get_attribute(
+	     internal_xml_cursor,
+	     attribute_index,
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve attribute: %d.",
+		 function,
+		 attribute_index );
+
+		return( -1 );
+	}
+	if( libuna_utf8_string_size_from_utf16_stream(
+	     entry->name_data,
+	     entry->name_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 encoded name of a specific attribute of the current element
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_cursor_get_attribute_utf8_name(
+     libfwevt_xml_cursor_t *xml_cursor,
+     int attribute_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_cursor_t *internal_xml_cursor = NULL;
+	libfwevt_xml_cursor_entry_t *entry                  = NULL;
+	static char *function                               = "libfwevt_xml_cursor_get_attribute_utf8_name";
+
+	if( xml_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_cursor = (libfwevt_internal_xml_cursor_t *) xml_cursor;
+
+	if( libfwevt_internal_xml_cursor_get_attribute(
+	     internal_xml_cursor,
+	     attribute_index,
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve attribute: %d.",
+		 function,
+		 attribute_index );
+
+		return( -1 );
+	}
+	if( libuna_utf8_string_copy_from_utf16_stream(
+	     utf8_string,
+	     utf8_string_size,
+	     entry->name_data,
+	     entry->name_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy name to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the value of a specific attribute of the current element
+ * The XML value is managed by the cursor and remains valid until another value
+ * is retrieved or the cursor is read or freed
+ * Returns 1 if successful, 0 if the attribute has no value or -1 on error
+ */
+int libfwevt_xml_cursor_get_attribute_value(
+     libfwevt_xml_cursor_t *xml_cursor,
+     int attribute_index,
+     libfwevt_xml_value_t **xml_value,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_cursor_t *internal_xml_cursor = NULL;
+	libfwevt_xml_cursor_entry_t *entry                  = NULL;
+	static char *function                               = "libfwevt_xml_cursor_get_attribute_value";
+	int result                                          = 0;
+
+	if( xml_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_cursor = (libfwevt_internal_xml_cursor_t *) xml_cursor;
+
+	if( libfwevt_internal_xml_cursor_get_attribute(
+	     internal_xml_cursor,
+	     attribute_index,
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve attribute: %d.",
+		 function,
+		 attribute_index );
+
+		return( -1 );
+	}
+	if( xml_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML value.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwevt_internal_xml_cursor_set_xml_value(
+	          internal_xml_cursor,
+	          internal_xml_cursor->current_element_index + 1 + attribute_index,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set XML value.",
+		 function );
+
+		return( -1 );
+	}
+	if( result == 0 )
+	{
+		*xml_value = NULL;
+	}
+	else
+	{
+		*xml_value = internal_xml_cursor->xml_value;
+	}
+	return( result );
+}
+
+/* Retrieves the value of the attribute of the current element for the specific UTF-8 encoded name
+ * The XML value is managed by the cursor and remains valid until another value
+ * is retrieved or the cursor is read or freed
+ * Returns 1 if successful, 0 if no such attribute or -1 on error
+ */
+int libfwevt_xml_cursor_get_attribute_value_by_utf8_name(
+     libfwevt_xml_cursor_t *xml_cursor,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfwevt_xml_value_t **xml_value,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_cursor_t *internal_xml_cursor = NULL;
+	libfwevt_xml_cursor_entry_t *attribute_entry        = NULL;
+	libfwevt_xml_cursor_entry_t *entry                  = NULL;
+	const uint8_t *name_data                            = NULL;
+	static char *function                               = "libfwevt_xml_cursor_get_attribute_value_by_utf8_name";
+	libuna_unicode_character_t name_character           = 0;
+	libuna_unicode_character_t string_character         = 0;
+	size_t name_data_size                               = 0;
+	size_t name_index                                   = 0;
+	size_t utf8_string_index                            = 0;
+	int attribute_index                                 = 0;
+	int result                                          = 0;
+
+	if( xml_cursor == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML cursor.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_cursor = (libfwevt_internal_xml_cursor_t *) xml_cursor;
+
+	if( libfwevt_internal_xml_cursor_get_current_element(
+	     internal_xml_cursor,
+	     &entry,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve current element.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML value.",
+		 function );
+
+		return( -1 );
+	}
+	for( attribute_index = 0;
+	     attribute_index < entry->number_of_attributes;
+	     attribute_index++ )
+	{
+		attribute_entry = &( internal_xml_cursor->entries[ internal_xml_cursor->current_element_index + 1 + attribute_index ] );
+
+		name_data      = attribute_entry->name_data;
+		name_data_size = attribute_entry->name_size;
+
+		if( ( name_data_size >= 2 )
+		 && ( name_data[ name_data_size - 2 ] == 0 )
+		 && ( name_data[ name_data_size - 1 ] == 0 ) )
+		{
+			name_data_size -= 2;
+		}
+		name_index        = 0;
+		utf8_string_index = 0;
+
+		while( name_index < name_data_size )
+		{
+			if( utf8_string_index >= utf8_string_length )
+			{
+				break;
+			}
+			if( libuna_unicode_character_copy_from_utf16_stream(
+			     &name_character,
+			     name_data,
+			     name_data_size,
+			     &name_index,
+			     LIBUNA_ENDIAN_LITTLE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy attribute name to Unicode character.",
+				 function );
+
+				return( -1 );
+			}
+			if( libuna_unicode_character_copy_from_utf8(
+			     &string_character,
+			     utf8_string,
+			     utf8_string_length,
+			     &utf8_string_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy UTF-8 string to Unicode character.",
+				 function );
+
+				return( -1 );
+			}
+			if( towupper( (wint_t) name_character ) != towupper( (wint_t) string_character ) )
+			{
+				break;
+			}
+		}
+		if( ( name_index == name_data_size )
+		 && ( utf8_string_index == utf8_string_length ) )
+		{
+			result = libfwevt_internal_xml_cursor_set_xml_value(
+			          internal_xml_cursor,
+			          internal_xml_cursor->current_element_index + 1 + attribute_index,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set XML value.",
+				 function );
+
+				return( -1 );
+			}
+			if( result == 0 )
+			{
+				*xml_value = NULL;
+			}
+			else
+			{
+				*xml_value = internal_xml_cursor->xml_value;
+			}
+			return( result );
+		}
+	}
+	return( 0 );
+}
+
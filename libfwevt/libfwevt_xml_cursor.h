@@ -0,0 +1,348 @@
+/*
+ * XML cursor functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWEVT_XML_CURSOR_H )
+#define _LIBFWEVT_XML_CURSOR_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwevt_extern.h"
+#include "libfwevt_libcerror.h"
+#include "libfwevt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfwevt_xml_cursor_entry libfwevt_xml_cursor_entry_t;
+
+struct libfwevt_xml_cursor_entry
+{
+	/* The entry type
+	 */
+	uint8_t type;
+
+	/* The value type
+	 */
+	uint8_t value_type;
+
+	/* The entry flags
+	 */
+	uint8_t flags;
+
+	/* The name data
+	 * Refers to the data the entry was read from or to the data of the cursor
+	 */
+	const uint8_t *name_data;
+
+	/* The offset of the name in the data of the cursor
+	 * Only used if LIBFWEVT_XML_CURSOR_ENTRY_FLAG_NAME_IS_COPIED is set
+	 */
+	size_t name_offset;
+
+	/* The name size
+	 */
+	size_t name_size;
+
+	/* The value data
+	 * Refers to the data the entry was read from or to the data of the cursor
+	 */
+	const uint8_t *value_data;
+
+	/* The offset of the value data in the data of the cursor
+	 * Only used if LIBFWEVT_XML_CURSOR_ENTRY_FLAG_VALUE_DATA_IS_COPIED is set
+	 */
+	size_t value_data_offset;
+
+	/* The value data size
+	 */
+	size_t value_data_size;
+
+	/* The index of the entry of the parent element or -1 if not set
+	 */
+	int parent_index;
+
+	/* The index of the entry after the last entry of the element
+	 */
+	int end_index;
+
+	/* The number of attributes of the element
+	 */
+	int number_of_attributes;
+};
+
+typedef struct libfwevt_internal_xml_cursor libfwevt_internal_xml_cursor_t;
+
+struct libfwevt_internal_xml_cursor
+{
+	/* The entries in document order
+	 */
+	libfwevt_xml_cursor_entry_t *entries;
+
+	/* The number of entries
+	 */
+	int number_of_entries;
+
+	/* The number of allocated entries
+	 */
+	int number_of_allocated_entries;
+
+	/* The binary data the entries are read from
+	 * The names and value data inside the binary data are referenced by the entries,
+	 * the names and value data outside the binary data are copied. If not set all
+	 * names and value data are referenced
+	 */
+	const uint8_t *binary_data;
+
+	/* The binary data size
+	 */
+	size_t binary_data_size;
+
+	/* The data
+	 * Contains copies of the UTF-16 little-endian encoded names and of the value data
+	 * of the entries that are not part of the binary data, such as character references
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The allocated data size
+	 */
+	size_t allocated_data_size;
+
+	/* The index of the entry of the element that is being read or -1 if not set
+	 */
+	int open_element_index;
+
+	/* The index of the entry of the current element or -1 if not set
+	 */
+	int current_element_index;
+
+	/* The XML value that was last retrieved
+	 * The XML value is reused by every value that is retrieved
+	 */
+	libfwevt_xml_value_t *xml_value;
+};
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_cursor_initialize(
+     libfwevt_xml_cursor_t **xml_cursor,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_cursor_free(
+     libfwevt_xml_cursor_t **xml_cursor,
+     libcerror_error_t **error );
+
+int libfwevt_internal_xml_cursor_clear(
+     libfwevt_internal_xml_cursor_t *internal_xml_cursor,
+     libcerror_error_t **error );
+
+int libfwevt_internal_xml_cursor_is_binary_data(
+     libfwevt_internal_xml_cursor_t *internal_xml_cursor,
+     const uint8_t *data,
+     size_t data_size );
+
+int libfwevt_internal_xml_cursor_append_entry(
+     libfwevt_internal_xml_cursor_t *internal_xml_cursor,
+     uint8_t entry_type,
+     const uint8_t *name_data,
+     size_t name_data_size,
+     uint8_t value_type,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     int *entry_index,
+     libcerror_error_t **error );
+
+int libfwevt_internal_xml_cursor_set_copied_data(
+     libfwevt_internal_xml_cursor_t *internal_xml_cursor,
+     libcerror_error_t **error );
+
+int libfwevt_xml_cursor_start_element_callback(
+     const uint8_t *name_utf16_stream,
+     size_t name_utf16_stream_size,
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libfwevt_xml_cursor_attribute_callback(
+     const uint8_t *name_utf16_stream,
+     size_t name_utf16_stream_size,
+     uint8_t value_type,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libfwevt_xml_cursor_value_callback(
+     uint8_t value_type,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libfwevt_xml_cursor_end_element_callback(
+     const uint8_t *name_utf16_stream,
+     size_t name_utf16_stream_size,
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_cursor_read(
+     libfwevt_xml_cursor_t *xml_cursor,
+     libfwevt_xml_document_t *xml_document,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     int ascii_codepage,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+int libfwevt_internal_xml_cursor_read_element(
+     libfwevt_internal_xml_cursor_t *internal_xml_cursor,
+     libfwevt_xml_tag_t *xml_tag,
+     int element_recursion_depth,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_cursor_read_xml_tag(
+     libfwevt_xml_cursor_t *xml_cursor,
+     libfwevt_xml_tag_t *xml_tag,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_cursor_go_to_root(
+     libfwevt_xml_cursor_t *xml_cursor,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_cursor_next(
+     libfwevt_xml_cursor_t *xml_cursor,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_cursor_enter_child(
+     libfwevt_xml_cursor_t *xml_cursor,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_cursor_leave(
+     libfwevt_xml_cursor_t *xml_cursor,
+     libcerror_error_t **error );
+
+int libfwevt_internal_xml_cursor_get_current_element(
+     libfwevt_internal_xml_cursor_t *internal_xml_cursor,
+     libfwevt_xml_cursor_entry_t **entry,
+     libcerror_error_t **error );
+
+int libfwevt_internal_xml_cursor_get_attribute(
+     libfwevt_internal_xml_cursor_t *internal_xml_cursor,
+     int attribute_index,
+     libfwevt_xml_cursor_entry_t **entry,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_cursor_get_utf8_name_size(
+     libfwevt_xml_cursor_t *xml_cursor,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_cursor_get_utf8_name(
+     libfwevt_xml_cursor_t *xml_cursor,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_cursor_get_utf16_name_size(
+     libfwevt_xml_cursor_t *xml_cursor,
+     size_t *utf16_string_size,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_cursor_get_utf16_name(
+     libfwevt_xml_cursor_t *xml_cursor,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_cursor_get_value_type(
+     libfwevt_xml_cursor_t *xml_cursor,
+     uint8_t *value_type,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_cursor_get_value(
+     libfwevt_xml_cursor_t *xml_cursor,
+     libfwevt_xml_value_t **xml_value,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_cursor_get_number_of_attributes(
+     libfwevt_xml_cursor_t *xml_cursor,
+     int *number_of_attributes,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_cursor_get_attribute_utf8_name_size(
+     libfwevt_xml_cursor_t *xml_cursor,
+     int attribute_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_cursor_get_attribute_utf8_name(
+     libfwevt_xml_cursor_t *xml_cursor,
+     int attribute_index,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_cursor_get_attribute_value(
+     libfwevt_xml_cursor_t *xml_cursor,
+     int attribute_index,
+     libfwevt_xml_value_t **xml_value,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_cursor_get_attribute_value_by_utf8_name(
+     libfwevt_xml_cursor_t *xml_cursor,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libfwevt_xml_value_t **xml_value,
+     libcerror_error_t **error );
+
+int libfwevt_internal_xml_cursor_set_xml_value(
+     libfwevt_internal_xml_cursor_t *internal_xml_cursor,
+     int entry_index,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWEVT_XML_CURSOR_H ) */
+
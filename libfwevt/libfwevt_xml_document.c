@@ -25,6 +25,7 @@
 #include <system_string.h>
 #include <types.h>
 
+#include "libfwevt_arena.h"
 #include "libfwevt_debug.h"
 #include "libfwevt_definitions.h"
 #include "libfwevt_integer.h"
@@ -33,12 +34,17 @@
 #include "libfwevt_libcnotify.h"
 #include "libfwevt_libfguid.h"
 #include "libfwevt_libuna.h"
+#include "libfwevt_output_buffer.h"
 #include "libfwevt_types.h"
 #include "libfwevt_unused.h"
 #include "libfwevt_xml_document.h"
+#include "libfwevt_xml_template_cache.h"
+#include "libfwevt_xml_template_definition.h"
+#include "libfwevt_xml_template_program.h"
 #include "libfwevt_xml_template_value.h"
 #include "libfwevt_xml_tag.h"
 #include "libfwevt_xml_token.h"
+#include "libfwevt_xml_value.h"
 
 /* Creates a binary XML document
  * Make sure the value xml_document is referencing, is set to NULL
@@ -124,6 +130,7 @@ int libfwevt_xml_document_free(
 	libfwevt_internal_xml_document_t *internal_xml_document = NULL;
 	static char *function                                   = "libfwevt_xml_document_free";
 	int result                                              = 1;
+	int template_instance_recursion_depth                   = 0;
 
 	if( xml_document == NULL )
 	{
@@ -141,7 +148,12 @@ int libfwevt_xml_document_free(
 		internal_xml_document = (libfwevt_internal_xml_document_t *) *xml_document;
 		*xml_document         = NULL;
 
-		if( internal_xml_document->root_xml_tag != NULL )
+		/* The root XML tag of a XML tree is freed with the XML tree and
+		 * the XML tags allocated from the arena are freed with the arena
+		 */
+		if( ( internal_xml_document->root_xml_tag != NULL )
+		 && ( ( (libfwevt_internal_xml_tag_t *) internal_xml_document->root_xml_tag )->tree == NULL )
+		 && ( ( (libfwevt_internal_xml_tag_t *) internal_xml_document->root_xml_tag )->arena == NULL ) )
 		{
 			if( libfwevt_internal_xml_tag_free(
 			     (libfwevt_internal_xml_tag_t **) &( internal_xml_document->root_xml_tag ),
@@ -157,12 +169,211 @@ int libfwevt_xml_document_free(
 				result = -1;
 			}
 		}
+		if( internal_xml_document->tree != NULL )
+		{
+			if( libfwevt_xml_tree_free(
+			     &( internal_xml_document->tree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free XML tree.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_xml_document->name_table != NULL )
+		{
+			if( libfwevt_xml_name_table_free(
+			     &( internal_xml_document->name_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free name table.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( internal_xml_document->arena != NULL )
+		{
+			if( libfwevt_arena_free(
+			     &( internal_xml_document->arena ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free arena.",
+				 function );
+
+				result = -1;
+			}
+		}
+		for( template_instance_recursion_depth = 0;
+		     template_instance_recursion_depth <= LIBFWEVT_XML_DOCUMENT_TEMPLATE_INSTANCE_RECURSION_DEPTH;
+		     template_instance_recursion_depth++ )
+		{
+			/* The template values array does not own its entries
+			 */
+			if( internal_xml_document->template_values_arrays[ template_instance_recursion_depth ] != NULL )
+			{
+				if( libcdata_array_free(
+				     &( internal_xml_document->template_values_arrays[ template_instance_recursion_depth ] ),
+				     NULL,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free template values array: %d.",
+					 function,
+					 template_instance_recursion_depth );
+
+					result = -1;
+				}
+			}
+			if( internal_xml_document->template_values_pools[ template_instance_recursion_depth ] != NULL )
+			{
+				if( libcdata_array_free(
+				     &( internal_xml_document->template_values_pools[ template_instance_recursion_depth ] ),
+				     (int (*)(intptr_t **, libcerror_error_t **)) &libfwevt_xml_template_value_free,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free template values pool: %d.",
+					 function,
+					 template_instance_recursion_depth );
+
+					result = -1;
+				}
+			}
+		}
+		if( internal_xml_document->path_filter_results != NULL )
+		{
+			memory_free(
+			 internal_xml_document->path_filter_results );
+		}
 		memory_free(
 		 internal_xml_document );
 	}
 	return( result );
 }
 
+/* Resets a binary XML document
+ * Releases the XML tags and values of the document so that another binary XML document
+ * can be read, the blocks of the arena, the name table, the XML tree, the path filter
+ * results array, the template values and the template cache are retained for reuse
+ * The document must have been read with LIBFWEVT_XML_DOCUMENT_READ_FLAG_USE_ARENA
+ * or LIBFWEVT_XML_DOCUMENT_READ_FLAG_FLAT_TREE, since the XML tags are released by
+ * rewinding the arena or emptying the XML tree and are not freed individually
+ * A document read without either flag is not reset and should be freed instead
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_reset(
+     libfwevt_xml_document_t *xml_document,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_document_t *internal_xml_document = NULL;
+	static char *function                                   = "libfwevt_xml_document_reset";
+	int result                                              = 1;
+
+	if( xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_document = (libfwevt_internal_xml_document_t *) xml_document;
+
+	if( internal_xml_document->number_of_active_template_definitions != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid binary XML document - number of active template definitions value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* The root XML tag of a XML tree is freed when the XML tree is emptied and
+	 * the XML tags allocated from the arena, including their names, values, arrays
+	 * and data segments, are released when the arena is reset
+	 */
+	if( internal_xml_document->root_xml_tag != NULL )
+	{
+		if( ( ( (libfwevt_internal_xml_tag_t *) internal_xml_document->root_xml_tag )->tree == NULL )
+		 && ( ( (libfwevt_internal_xml_tag_t *) internal_xml_document->root_xml_tag )->arena == NULL ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported binary XML document - XML tags not allocated from arena or XML tree.",
+			 function );
+
+			return( -1 );
+		}
+		internal_xml_document->root_xml_tag = NULL;
+	}
+	if( internal_xml_document->tree != NULL )
+	{
+		if( libfwevt_xml_tree_empty(
+		     internal_xml_document->tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty XML tree.",
+			 function );
+
+			result = -1;
+		}
+	}
+	/* The arena is only reset after the XML tags have been freed
+	 * since freeing the XML tags accesses memory allocated from the arena
+	 */
+	if( internal_xml_document->arena != NULL )
+	{
+		if( libfwevt_arena_reset(
+		     internal_xml_document->arena,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to reset arena.",
+			 function );
+
+			result = -1;
+		}
+	}
+	internal_xml_document->size                          = 0;
+	internal_xml_document->number_of_path_filter_results = 0;
+
+	return( result );
+}
+
 /* Retrieves the root XML tag
  * Returns 1 if successful or -1 on error
  */
@@ -203,59 +414,55 @@ int libfwevt_xml_document_get_root_xml_tag(
 	return( 1 );
 }
 
-/* Reads a binary XML document
+/* Sets the template cache
+ * The template cache is used to cache the template definitions of template instances
+ * and must remain available while the binary XML document is read, the template cache
+ * can be shared by binary XML documents that are read from the same thread
+ * Use NULL to read the template definitions without cache
  * Returns 1 if successful or -1 on error
  */
-int libfwevt_xml_document_read(
+int libfwevt_xml_document_set_template_cache(
      libfwevt_xml_document_t *xml_document,
-     const uint8_t *binary_data,
-     size_t binary_data_size,
-     size_t binary_data_offset,
-     int ascii_codepage,
-     uint8_t flags,
+     libfwevt_xml_template_cache_t *template_cache,
      libcerror_error_t **error )
 {
-	static char *function = "libfwevt_xml_document_read";
+	libfwevt_internal_xml_document_t *internal_xml_document = NULL;
+	static char *function                                   = "libfwevt_xml_document_set_template_cache";
 
-	if( libfwevt_xml_document_read_with_template_values(
-	     xml_document,
-	     binary_data,
-	     binary_data_size,
-	     binary_data_offset,
-	     ascii_codepage,
-	     flags,
-	     NULL,
-	     error ) != 1 )
+	if( xml_document == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read XML document.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
 		 function );
 
 		return( -1 );
 	}
+	internal_xml_document = (libfwevt_internal_xml_document_t *) xml_document;
+
+	internal_xml_document->template_cache = template_cache;
+
 	return( 1 );
 }
 
-/* Reads a binary XML document with template values
+/* Sets the path filter
+ * The path filter is used by libfwevt_xml_document_read_with_path_filter, which reads
+ * the binary XML document without building XML tags. Elements that cannot match a path
+ * are skipped and the values that match a path are stored as path filter results.
+ * The path filter must remain available while the binary XML document is read and can
+ * be shared by binary XML documents
+ * Use NULL to read the binary XML document without path filter
  * Returns 1 if successful or -1 on error
  */
-int libfwevt_xml_document_read_with_template_values(
+int libfwevt_xml_document_set_path_filter(
      libfwevt_xml_document_t *xml_document,
-     const uint8_t *binary_data,
-     size_t binary_data_size,
-     size_t binary_data_offset,
-     int ascii_codepage,
-     uint8_t flags,
-     libcdata_array_t *template_values_array,
+     libfwevt_xml_path_filter_t *path_filter,
      libcerror_error_t **error )
 {
 	libfwevt_internal_xml_document_t *internal_xml_document = NULL;
-	libfwevt_xml_token_t *xml_token                         = NULL;
-	static char *function                                   = "libfwevt_xml_document_read_with_template_values";
-	uint8_t supported_flags                                 = 0;
+	static char *function                                   = "libfwevt_xml_document_set_path_filter";
 
 	if( xml_document == NULL )
 	{
@@ -270,249 +477,262 @@ int libfwevt_xml_document_read_with_template_values(
 	}
 	internal_xml_document = (libfwevt_internal_xml_document_t *) xml_document;
 
-	if( internal_xml_document->root_xml_tag != NULL )
+	if( internal_xml_document->parse_state != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid binary XML document - root XML tag already set.",
+		 "%s: invalid binary XML document - parse state value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( binary_data == NULL )
+	internal_xml_document->path_filter                   = path_filter;
+	internal_xml_document->number_of_path_filter_results = 0;
+
+	return( 1 );
+}
+
+/* Retrieves the number of path filter results
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_get_number_of_path_filter_results(
+     libfwevt_xml_document_t *xml_document,
+     int *number_of_results,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_document_t *internal_xml_document = NULL;
+	static char *function                                   = "libfwevt_xml_document_get_number_of_path_filter_results";
+
+	if( xml_document == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid binary data.",
+		 "%s: invalid binary XML document.",
 		 function );
 
 		return( -1 );
 	}
-	if( binary_data_size > (size_t) SSIZE_MAX )
+	internal_xml_document = (libfwevt_internal_xml_document_t *) xml_document;
+
+	if( number_of_results == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid binary XML document data size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of results.",
 		 function );
 
 		return( -1 );
 	}
-	if( binary_data_offset >= binary_data_size )
+	*number_of_results = internal_xml_document->number_of_path_filter_results;
+
+	return( 1 );
+}
+
+/* Retrieves a specific path filter result
+ * The results are stored in document order, a path can have multiple results.
+ * The value data references the binary data, or the template cache if the value
+ * is part of a cached template definition, and is stored as in the binary XML document.
+ * The value data is only valid while the binary data and the template cache remain
+ * available and until the binary XML document is read again or reset
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_get_path_filter_result_by_index(
+     libfwevt_xml_document_t *xml_document,
+     int result_index,
+     int *path_index,
+     uint8_t *value_type,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_document_t *internal_xml_document = NULL;
+	libfwevt_xml_document_path_filter_result_t *result      = NULL;
+	static char *function                                   = "libfwevt_xml_document_get_path_filter_result_by_index";
+
+	if( xml_document == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid binary data offset value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
 		 function );
 
 		return( -1 );
 	}
-	supported_flags = LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS
-	                | LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DEPENDENCY_IDENTIFIERS;
+	internal_xml_document = (libfwevt_internal_xml_document_t *) xml_document;
 
-	if( ( flags & ~( supported_flags ) ) != 0 )
+	if( ( result_index < 0 )
+	 || ( result_index >= internal_xml_document->number_of_path_filter_results ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported flags: 0x%02" PRIx8 ".",
-		 function,
-		 flags );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid result index value out of bounds.",
+		 function );
 
 		return( -1 );
 	}
-	if( libfwevt_xml_token_initialize(
-	     &xml_token,
-	     error ) != 1 )
+	if( path_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create binary XML token.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path index.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	while( binary_data_offset < binary_data_size )
+	if( value_type == NULL )
 	{
-		if( libfwevt_xml_token_read_data(
-		     xml_token,
-		     binary_data,
-		     binary_data_size,
-		     binary_data_offset,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read binary XML token.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value type.",
+		 function );
 
-			goto on_error;
-		}
-/* TODO check for prologue */
-/* TODO validate the order */
-/* TODO check for Miscellaneous before end of file token */
-		switch( xml_token->type & 0xbf )
-		{
-			case LIBFWEVT_XML_TOKEN_END_OF_FILE:
-				if( ( binary_data_size < 1 )
-				 || ( binary_data_offset >= ( binary_data_size - 1 ) ) )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: invalid binary XML document data size value too small.",
-					 function );
-
-					goto on_error;
-				}
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: data offset\t\t: 0x%08" PRIzx "\n",
-					 function,
-					 binary_data_offset );
-
-					libcnotify_printf(
-					 "%s: end of file data:\n",
-					 function );
-					libcnotify_print_data(
-					 &( binary_data[ binary_data_offset ] ),
-					 1,
-					 0 );
-				}
-#endif
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: type\t\t\t: 0x%02" PRIx8 "\n",
-					 function,
-					 binary_data[ binary_data_offset ] );
+		return( -1 );
+	}
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
 
-					libcnotify_printf(
-					 "\n" );
-				}
-#endif
-				xml_token->size = 1;
+		return( -1 );
+	}
+	if( value_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data size.",
+		 function );
 
-				break;
+		return( -1 );
+	}
+	result = &( internal_xml_document->path_filter_results[ result_index ] );
 
-			case LIBFWEVT_XML_TOKEN_FRAGMENT_HEADER:
-				if( libfwevt_xml_document_read_fragment(
-				     internal_xml_document,
-				     xml_token,
-				     binary_data,
-				     binary_data_size,
-				     binary_data_offset,
-				     ascii_codepage,
-				     flags,
-				     template_values_array,
-				     internal_xml_document->root_xml_tag,
-				     0,
-				     0,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read fragment header.",
-					 function );
+	*path_index      = result->path_index;
+	*value_type      = result->value_type;
+	*value_data      = result->value_data;
+	*value_data_size = result->value_data_size;
 
-					goto on_error;
-				}
-				break;
+	return( 1 );
+}
 
-			default:
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: invalid binary XML token - unsupported type: 0x%02" PRIx8 ".",
-				 function,
-				 xml_token->type );
+/* Reads a binary XML document
+ * The binary XML document cannot be read into XML tags if a path filter is set,
+ * use libfwevt_xml_document_read_with_path_filter instead
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_read(
+     libfwevt_xml_document_t *xml_document,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     int ascii_codepage,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_document_t *internal_xml_document = NULL;
+	static char *function                                   = "libfwevt_xml_document_read";
+	int result                                              = 0;
 
-				goto on_error;
-		}
-		internal_xml_document->size += xml_token->size;
-		binary_data_offset          += xml_token->size;
+	if( xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
+		 function );
 
-		if( xml_token->type == LIBFWEVT_XML_TOKEN_END_OF_FILE )
-		{
-			break;
-		}
+		return( -1 );
 	}
-	if( libfwevt_xml_token_free(
-	     &xml_token,
-	     error ) != 1 )
+	internal_xml_document = (libfwevt_internal_xml_document_t *) xml_document;
+
+	if( internal_xml_document->path_filter != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free binary XML token.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid binary XML document - path filter value already set.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	return( 1 );
-
-on_error:
-	if( xml_token != NULL )
+	if( ( flags & LIBFWEVT_XML_DOCUMENT_READ_FLAG_FLAT_TREE ) != 0 )
 	{
-		libfwevt_xml_token_free(
-		 &xml_token,
-		 NULL );
+		/* The arena is not used since the XML tags are freed when their element has been parsed
+		 */
+		result = libfwevt_internal_xml_document_read_tree(
+		          internal_xml_document,
+		          binary_data,
+		          binary_data_size,
+		          binary_data_offset,
+		          ascii_codepage,
+		          flags & ~( LIBFWEVT_XML_DOCUMENT_READ_FLAG_USE_ARENA | LIBFWEVT_XML_DOCUMENT_READ_FLAG_FLAT_TREE ),
+		          error );
 	}
-	return( -1 );
+	else
+	{
+		result = libfwevt_xml_document_read_with_template_values(
+		          xml_document,
+		          binary_data,
+		          binary_data_size,
+		          binary_data_offset,
+		          ascii_codepage,
+		          flags,
+		          NULL,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
 }
 
-/* Reads an attribute from a binary XML document
+/* Reads a binary XML document with the path filter
+ * No XML tags are built, the values that match a path of the path filter are
+ * stored as path filter results, which reference the binary data
  * Returns 1 if successful or -1 on error
  */
-int libfwevt_xml_document_read_attribute(
-     libfwevt_internal_xml_document_t *internal_xml_document,
-     libfwevt_xml_token_t *xml_token,
+int libfwevt_xml_document_read_with_path_filter(
+     libfwevt_xml_document_t *xml_document,
      const uint8_t *binary_data,
      size_t binary_data_size,
      size_t binary_data_offset,
      int ascii_codepage,
      uint8_t flags,
-     libcdata_array_t *template_values_array,
-     libfwevt_xml_tag_t *xml_tag,
-     int element_recursion_depth,
-     int template_instance_recursion_depth,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *attribute_xml_tag    = NULL;
-	libfwevt_xml_token_t *xml_sub_token      = NULL;
-	const uint8_t *xml_document_data         = NULL;
-	static char *function                    = "libfwevt_xml_document_read_attribute";
-	size_t additional_value_size             = 0;
-	size_t template_value_offset             = 0;
-	size_t trailing_data_size                = 0;
-	size_t xml_document_data_offset          = 0;
-	size_t xml_document_data_size            = 0;
-	uint32_t attribute_name_offset           = 0;
-	uint32_t attribute_name_size             = 0;
-	int result                               = 0;
-	int template_value_array_recursion_depth = 0;
+	libfwevt_internal_xml_document_t *internal_xml_document = NULL;
+	static char *function                                   = "libfwevt_xml_document_read_with_path_filter";
 
-	if( internal_xml_document == NULL )
+	if( xml_document == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -523,432 +743,400 @@ int libfwevt_xml_document_read_attribute(
 
 		return( -1 );
 	}
-	if( xml_token == NULL )
+	internal_xml_document = (libfwevt_internal_xml_document_t *) xml_document;
+
+	if( internal_xml_document->path_filter == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid binary XML token.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid binary XML document - missing path filter.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( xml_token->type & 0xbf ) != LIBFWEVT_XML_TOKEN_ATTRIBUTE )
+	if( libfwevt_xml_document_parse_with_callbacks(
+	     xml_document,
+	     binary_data,
+	     binary_data_size,
+	     binary_data_offset,
+	     ascii_codepage,
+	     flags,
+	     NULL,
+	     NULL,
+	     NULL,
+	     NULL,
+	     NULL,
+	     NULL,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid binary XML token - unsupported type: 0x%02" PRIx8 ".",
-		 function,
-		 xml_token->type );
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document.",
+		 function );
 
 		return( -1 );
 	}
-	if( binary_data == NULL )
+	return( 1 );
+}
+
+/* Reads a binary XML document into the XML tree
+ * The nodes are appended to the XML tree while the elements are parsed, hence
+ * only the XML tags of the elements that are being parsed are kept. The root
+ * XML tag is set to the root node of the XML tree
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_internal_xml_document_read_tree(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     int ascii_codepage,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_document_parse_state_t *parse_state = NULL;
+	libfwevt_xml_tag_t *root_xml_tag                 = NULL;
+	static char *function                            = "libfwevt_internal_xml_document_read_tree";
+	int result                                       = 0;
+
+	if( internal_xml_document == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid binary data.",
+		 "%s: invalid binary XML document.",
 		 function );
 
 		return( -1 );
 	}
-	if( binary_data_size > (size_t) SSIZE_MAX )
+	if( internal_xml_document->root_xml_tag != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid binary XML document data size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid binary XML document - root XML tag value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( binary_data_offset >= binary_data_size )
+	if( internal_xml_document->parse_state != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid binary data offset value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid binary XML document - parse state value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( flags & LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS ) != 0 )
+	if( internal_xml_document->tree == NULL )
 	{
-		additional_value_size = 4;
-
-		if( ( binary_data_size < 4 )
-		 || ( binary_data_offset > ( binary_data_size - 4 ) ) )
+		if( libfwevt_xml_tree_initialize(
+		     &( internal_xml_document->tree ),
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid binary data offset value out of bounds.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create XML tree.",
+			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 	}
-	xml_document_data      = &( binary_data[ binary_data_offset ] );
-	xml_document_data_size = binary_data_size - binary_data_offset;
+	else if( internal_xml_document->tree->number_of_nodes != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid binary XML document - XML tree nodes already set.",
+		 function );
 
-	if( libfwevt_xml_token_initialize(
-	     &xml_sub_token,
+		return( -1 );
+	}
+	if( libfwevt_xml_document_parse_state_initialize(
+	     &parse_state,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create binary XML sub token.",
+		 "%s: unable to create parse state.",
 		 function );
 
 		goto on_error;
 	}
-	do
-	{
-		if( ( template_value_array_recursion_depth < 0 )
-		 || ( template_value_array_recursion_depth > LIBFWEVT_XML_DOCUMENT_TEMPLATE_VALUE_ARRAY_RECURSION_DEPTH ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid template value array recursion depth value out of bounds.",
-			 function );
+	parse_state->tree = internal_xml_document->tree;
 
-			goto on_error;
-		}
-		if( ( xml_document_data_size < ( additional_value_size + 1 ) )
-		 || ( xml_document_data_offset > ( xml_document_data_size - ( additional_value_size + 1 ) ) ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid binary XML document data size value too small.",
-			 function );
+	internal_xml_document->parse_state = parse_state;
 
-			goto on_error;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: data offset\t\t\t: 0x%08" PRIzx "\n",
-			 function,
-			 binary_data_offset + xml_document_data_offset );
+	result = libfwevt_xml_document_read_with_template_values(
+	          (libfwevt_xml_document_t *) internal_xml_document,
+	          binary_data,
+	          binary_data_size,
+	          binary_data_offset,
+	          ascii_codepage,
+	          flags,
+	          NULL,
+	          error );
 
-			libcnotify_printf(
-			 "%s: attribute data:\n",
-			 function );
-			libcnotify_print_data(
-			 &( xml_document_data[ xml_document_data_offset ] ),
-			 additional_value_size + 1,
-			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-		}
-#endif
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: type\t\t\t\t: 0x%02" PRIx8 "\n",
-			 function,
-			 xml_document_data[ xml_document_data_offset ] );
-		}
-#endif
-		xml_document_data_offset += 1;
+	internal_xml_document->parse_state = NULL;
 
-		if( ( flags & LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS ) == 0 )
-		{
-			attribute_name_offset = (uint32_t) ( binary_data_offset + xml_document_data_offset );
-		}
-		else
-		{
-			if( ( xml_document_data_size < 4 )
-			 || ( xml_document_data_offset >= ( xml_document_data_size - 4 ) ) )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid binary XML document data size value too small.",
-				 function );
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read XML document into XML tree.",
+		 function );
 
-				goto on_error;
-			}
-			byte_stream_copy_to_uint32_little_endian(
-			 &( xml_document_data[ xml_document_data_offset ] ),
-			 attribute_name_offset );
+		goto on_error;
+	}
+	if( libfwevt_xml_document_parse_state_free(
+	     &parse_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free parse state.",
+		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: name offset\t\t\t: 0x%08" PRIx32 "\n",
-				 function,
-				 attribute_name_offset );
-			}
-#endif
-			xml_document_data_offset += 4;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "\n" );
-		}
-#endif
-		if( attribute_name_offset > ( binary_data_offset + xml_document_data_offset ) )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid attribute data offset value out of bounds.",
-			 function );
+		goto on_error;
+	}
+	if( libfwevt_xml_tree_set_element_node_indexes(
+	     internal_xml_document->tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set element node indexes of XML tree.",
+		 function );
 
-			goto on_error;
-		}
-		if( ( binary_data_offset + xml_document_data_offset ) < attribute_name_offset )
-		{
-			trailing_data_size = attribute_name_offset - ( binary_data_offset - xml_document_data_offset );
+		goto on_error;
+	}
+	result = libfwevt_xml_tree_get_root_xml_tag(
+	          internal_xml_document->tree,
+	          &root_xml_tag,
+	          error );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: data offset\t\t: 0x%08" PRIzx "\n",
-				 function,
-				 binary_data_offset + xml_document_data_offset );
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve root XML tag from XML tree.",
+		 function );
 
-				libcnotify_printf(
-				 "%s: trailing data:\n",
-				 function );
-				libcnotify_print_data(
-				 &( xml_document_data[ xml_document_data_offset ] ),
-				 trailing_data_size,
-				 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-			}
-#endif
-			xml_document_data_offset += trailing_data_size;
-		}
-		if( libfwevt_xml_tag_initialize(
-		     &attribute_xml_tag,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create attribute XML tag.",
-			 function );
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		internal_xml_document->root_xml_tag = root_xml_tag;
+	}
+	return( 1 );
 
-			goto on_error;
-		}
-		if( libfwevt_xml_document_read_name(
-		     internal_xml_document,
-		     binary_data,
-		     binary_data_size,
-		     attribute_name_offset,
-		     flags,
-		     &attribute_name_size,
-		     attribute_xml_tag,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read attribute name.",
-			 function );
+on_error:
+	if( parse_state != NULL )
+	{
+		libfwevt_xml_document_parse_state_free(
+		 &parse_state,
+		 NULL );
+	}
+	if( internal_xml_document->tree != NULL )
+	{
+		libfwevt_xml_tree_empty(
+		 internal_xml_document->tree,
+		 NULL );
+	}
+	return( -1 );
+}
 
-			goto on_error;
-		}
-		if( ( binary_data_offset + xml_document_data_offset ) == attribute_name_offset )
-		{
-			xml_document_data_offset += attribute_name_size;
-		}
-		if( libfwevt_xml_token_read_data(
-		     xml_sub_token,
-		     binary_data,
-		     binary_data_size,
-		     binary_data_offset + xml_document_data_offset,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read binary XML sub token.",
-			 function );
+/* Parses a binary XML document with callbacks
+ * Instead of building XML tags for the binary XML document, the elements,
+ * attributes and values are reported to the callback functions as they are read.
+ * Only the XML tags of the elements that are being parsed are kept, hence the
+ * memory used depends on the nesting depth instead of the size of the document.
+ *
+ * The start of an element is reported together with its attributes before its first
+ * value or sub element. An element that is omitted, because of an optional substitution
+ * without a value, is not reported unless its content was reported before the
+ * optional substitution was read.
+ *
+ * Substituted values are reported to the substitution callback function, or to
+ * the value callback function if no substitution callback function is provided.
+ * Names are reported as UTF-16 little-endian encoded strings including the
+ * end-of-string character, value data as it is stored in the binary XML document.
+ * Names and value data are only valid during the callback.
+ *
+ * If a path filter is set, elements that cannot match a path are skipped and not
+ * reported and the values that match a path are stored as path filter results.
+ *
+ * Callback functions can be NULL, a callback function returns 1 if successful
+ * or -1 on error, which stops the parsing.
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_parse_with_callbacks(
+     libfwevt_xml_document_t *xml_document,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     int ascii_codepage,
+     uint8_t flags,
+     int (*start_element_callback)(
+            const uint8_t *name_utf16_stream,
+            size_t name_utf16_stream_size,
+            void *callback_data,
+            libcerror_error_t **error ),
+     int (*attribute_callback)(
+            const uint8_t *name_utf16_stream,
+            size_t name_utf16_stream_size,
+            uint8_t value_type,
+            const uint8_t *value_data,
+            size_t value_data_size,
+            void *callback_data,
+            libcerror_error_t **error ),
+     int (*value_callback)(
+            uint8_t value_type,
+            const uint8_t *value_data,
+            size_t value_data_size,
+            void *callback_data,
+            libcerror_error_t **error ),
+     int (*substitution_callback)(
+            uint16_t template_value_index,
+            uint8_t value_type,
+            const uint8_t *value_data,
+            size_t value_data_size,
+            void *callback_data,
+            libcerror_error_t **error ),
+     int (*end_element_callback)(
+            const uint8_t *name_utf16_stream,
+            size_t name_utf16_stream_size,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_document_t *internal_xml_document = NULL;
+	libfwevt_xml_document_parse_state_t *parse_state        = NULL;
+	static char *function                                   = "libfwevt_xml_document_parse_with_callbacks";
+	uint8_t supported_flags                                 = 0;
+	int result                                              = 0;
 
-			goto on_error;
-		}
-		result = 1;
-
-		switch( xml_sub_token->type & 0xbf )
-		{
-			case LIBFWEVT_XML_TOKEN_VALUE:
-				if( template_value_offset != 0 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-					 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: invalid template value offset value out of bounds.",
-					 function );
-
-					goto on_error;
-				}
-				if( libfwevt_xml_document_read_value(
-				     internal_xml_document,
-				     xml_sub_token,
-				     binary_data,
-				     binary_data_size,
-				     binary_data_offset + xml_document_data_offset,
-				     attribute_xml_tag,
-				     ascii_codepage,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read value.",
-					 function );
-
-					goto on_error;
-				}
-				break;
-
-			case LIBFWEVT_XML_TOKEN_NORMAL_SUBSTITUTION:
-				result = libfwevt_xml_document_read_normal_substitution(
-				          internal_xml_document,
-				          xml_sub_token,
-				          binary_data,
-				          binary_data_size,
-				          binary_data_offset + xml_document_data_offset,
-				          ascii_codepage,
-				          flags,
-				          template_values_array,
-				          &template_value_offset,
-				          attribute_xml_tag,
-				          element_recursion_depth,
-				          template_instance_recursion_depth,
-				          error );
-
-				if( result == -1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read normal substitution.",
-					 function );
+	if( xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
+		 function );
 
-					goto on_error;
-				}
-				break;
+		return( -1 );
+	}
+	internal_xml_document = (libfwevt_internal_xml_document_t *) xml_document;
 
-			case LIBFWEVT_XML_TOKEN_OPTIONAL_SUBSTITUTION:
-				result = libfwevt_xml_document_read_optional_substitution(
-					  internal_xml_document,
-					  xml_sub_token,
-					  binary_data,
-					  binary_data_size,
-					  binary_data_offset + xml_document_data_offset,
-					  ascii_codepage,
-					  flags,
-					  template_values_array,
-					  &template_value_offset,
-					  attribute_xml_tag,
-				          element_recursion_depth,
-				          template_instance_recursion_depth,
-					  error );
+	if( internal_xml_document->parse_state != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid binary XML document - parse state value already set.",
+		 function );
 
-				if( result == -1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read optional substitution.",
-					 function );
+		return( -1 );
+	}
+	supported_flags = LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS
+	                | LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DEPENDENCY_IDENTIFIERS
+	                | LIBFWEVT_XML_DOCUMENT_READ_FLAG_BORROW_DATA;
 
-					goto on_error;
-				}
-				break;
+	if( ( flags & ~( supported_flags ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
 
-			default:
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: invalid binary XML sub token - unsupported type: 0x%02" PRIx8 ".",
-				 function,
-				 xml_sub_token->type );
+		return( -1 );
+	}
+	if( libfwevt_xml_document_parse_state_initialize(
+	     &parse_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create parse state.",
+		 function );
 
-				goto on_error;
-		}
-		if( result != 0 )
-		{
-			if( libfwevt_xml_tag_append_attribute(
-			     xml_tag,
-			     attribute_xml_tag,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable to append attribute to XML tag.",
-				 function );
+		goto on_error;
+	}
+	parse_state->start_element_callback = start_element_callback;
+	parse_state->attribute_callback     = attribute_callback;
+	parse_state->value_callback         = value_callback;
+	parse_state->substitution_callback  = substitution_callback;
+	parse_state->end_element_callback   = end_element_callback;
+	parse_state->callback_data          = callback_data;
+	parse_state->path_filter            = (libfwevt_internal_xml_path_filter_t *) internal_xml_document->path_filter;
 
-				goto on_error;
-			}
-			attribute_xml_tag = NULL;
-		}
-		xml_document_data_offset += xml_sub_token->size;
+	internal_xml_document->parse_state                   = parse_state;
+	internal_xml_document->number_of_path_filter_results = 0;
 
-		template_value_array_recursion_depth++;
-	}
-	while( template_value_offset > 0 );
+	/* The value data is always borrowed since it is reported before the
+	 * XML tags are freed
+	 */
+	result = libfwevt_xml_document_read_with_template_values(
+	          xml_document,
+	          binary_data,
+	          binary_data_size,
+	          binary_data_offset,
+	          ascii_codepage,
+	          flags | LIBFWEVT_XML_DOCUMENT_READ_FLAG_BORROW_DATA,
+	          NULL,
+	          error );
 
-	xml_token->size = xml_document_data_offset;
+	internal_xml_document->parse_state = NULL;
 
-	if( attribute_xml_tag != NULL )
+	if( result != 1 )
 	{
-		if( libfwevt_internal_xml_tag_free(
-		     (libfwevt_internal_xml_tag_t **) &attribute_xml_tag,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free attribute XML tag.",
-			 function );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to parse XML document.",
+		 function );
 
-			goto on_error;
-		}
+		goto on_error;
 	}
-	if( libfwevt_xml_token_free(
-	     &xml_sub_token,
+	if( libfwevt_xml_document_parse_state_free(
+	     &parse_state,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free binary XML sub token.",
+		 "%s: unable to free parse state.",
 		 function );
 
 		goto on_error;
@@ -956,299 +1144,239 @@ int libfwevt_xml_document_read_attribute(
 	return( 1 );
 
 on_error:
-	if( attribute_xml_tag != NULL )
-	{
-		libfwevt_internal_xml_tag_free(
-		 (libfwevt_internal_xml_tag_t **) &attribute_xml_tag,
-		 NULL );
-	}
-	if( xml_sub_token != NULL )
+	if( parse_state != NULL )
 	{
-		libfwevt_xml_token_free(
-		 &xml_sub_token,
+		libfwevt_xml_document_parse_state_free(
+		 &parse_state,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Reads a CDATA section from a binary XML document
+/* Creates a parse state
+ * Make sure the value parse_state is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
  */
-int libfwevt_xml_document_read_cdata_section(
-     libfwevt_internal_xml_document_t *internal_xml_document,
-     libfwevt_xml_token_t *xml_token,
-     const uint8_t *binary_data,
-     size_t binary_data_size,
-     size_t binary_data_offset,
-     libfwevt_xml_tag_t *xml_tag,
-     int ascii_codepage LIBFWEVT_ATTRIBUTE_UNUSED,
+int libfwevt_xml_document_parse_state_initialize(
+     libfwevt_xml_document_parse_state_t **parse_state,
      libcerror_error_t **error )
 {
-	const uint8_t *xml_document_data = NULL;
-	static char *function            = "libfwevt_xml_document_read_cdata_section";
-	size_t value_data_size           = 0;
-	size_t xml_document_data_size    = 0;
+	static char *function = "libfwevt_xml_document_parse_state_initialize";
 
-	LIBFWEVT_UNREFERENCED_PARAMETER( ascii_codepage )
-
-	if( internal_xml_document == NULL )
+	if( parse_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid binary XML document.",
+		 "%s: invalid parse state.",
 		 function );
 
 		return( -1 );
 	}
-	if( xml_token == NULL )
+	if( *parse_state != NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid binary XML token.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid parse state value already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( xml_token->type != LIBFWEVT_XML_TOKEN_CDATA_SECTION )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid binary XML token - unsupported type: 0x%02" PRIx8 ".",
-		 function,
-		 xml_token->type );
+	*parse_state = memory_allocate_structure(
+	                libfwevt_xml_document_parse_state_t );
 
-		return( -1 );
-	}
-	if( binary_data == NULL )
+	if( *parse_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid binary data.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create parse state.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( binary_data_size > (size_t) SSIZE_MAX )
+	if( memory_set(
+	     *parse_state,
+	     0,
+	     sizeof( libfwevt_xml_document_parse_state_t ) ) == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid binary XML document data size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear parse state.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( binary_data_offset >= binary_data_size )
+	return( 1 );
+
+on_error:
+	if( *parse_state != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid binary data offset value out of bounds.",
-		 function );
+		memory_free(
+		 *parse_state );
 
-		return( -1 );
+		*parse_state = NULL;
 	}
-	if( xml_tag == NULL )
+	return( -1 );
+}
+
+/* Frees a parse state
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_parse_state_free(
+     libfwevt_xml_document_parse_state_t **parse_state,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_xml_document_parse_state_free";
+	int element_index     = 0;
+	int result            = 1;
+
+	if( parse_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid XML tag.",
+		 "%s: invalid parse state.",
 		 function );
 
 		return( -1 );
 	}
-	xml_document_data      = &( binary_data[ binary_data_offset ] );
-	xml_document_data_size = binary_data_size - binary_data_offset;
+	if( *parse_state != NULL )
+	{
+		for( element_index = 0;
+		     element_index <= LIBFWEVT_XML_DOCUMENT_ELEMENT_RECURSION_DEPTH;
+		     element_index++ )
+		{
+			if( libfwevt_internal_xml_tag_free(
+			     (libfwevt_internal_xml_tag_t **) &( ( *parse_state )->xml_tags[ element_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free XML tag: %d.",
+				 function,
+				 element_index );
 
-	if( xml_document_data_size < 3 )
+				result = -1;
+			}
+		}
+		memory_free(
+		 *parse_state );
+
+		*parse_state = NULL;
+	}
+	return( result );
+}
+
+/* Pushes an element that is being parsed
+ * The name data is not copied and must remain valid until the element is popped
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_push_parse_element(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     const uint8_t *name_data,
+     size_t name_data_size,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_document_parse_element_t *parse_element = NULL;
+	libfwevt_xml_document_parse_state_t *parse_state     = NULL;
+	static char *function                                = "libfwevt_xml_document_push_parse_element";
+
+	if( internal_xml_document == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid binary XML document data size value too small.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfwevt_xml_tag_set_type(
-	     xml_tag,
-	     LIBFWEVT_XML_TAG_TYPE_CDATA,
-	     error ) != 1 )
+	if( internal_xml_document->parse_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set XML tag type.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid binary XML document - missing parse state.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: data offset\t\t: 0x%08" PRIzx "\n",
-		 function,
-		 binary_data_offset );
-
-		libcnotify_printf(
-		 "%s: cdata section data:\n",
-		 function );
-		libcnotify_print_data(
-		 xml_document_data,
-		 3,
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-	}
-#endif
-	byte_stream_copy_to_uint16_little_endian(
-	 &( xml_document_data[ 1 ] ),
-	 value_data_size );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: type\t\t\t: 0x%02" PRIx8 "\n",
-		 function,
-		 xml_document_data[ 0 ] );
-
-		libcnotify_printf(
-		 "%s: number of characters\t: %" PRIzd "\n",
-		 function,
-		 value_data_size );
-	}
-#endif
-	xml_token->size     = 3;
-	binary_data_offset += 3;
-
-	value_data_size *= 2;
+	parse_state = internal_xml_document->parse_state;
 
-	if( ( value_data_size > binary_data_size )
-	 || ( binary_data_offset >= ( binary_data_size - value_data_size ) ) )
+	if( name_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid value data size value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name data.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: data offset\t\t: 0x%08" PRIzx "\n",
-		 function,
-		 binary_data_offset );
-
-		libcnotify_printf(
-		 "%s: value data:\n",
-		 function );
-		libcnotify_print_data(
-		 &( xml_document_data[ 3 ] ),
-		 value_data_size,
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-	}
-#endif
-	if( libfwevt_xml_tag_set_value_type(
-	     xml_tag,
-	     LIBFWEVT_VALUE_TYPE_STRING_UTF16,
-	     error ) != 1 )
+	if( name_data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set value type.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid name data size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfwevt_xml_tag_set_value_data(
-	     xml_tag,
-	     &( binary_data[ binary_data_offset ] ),
-	     value_data_size,
-	     error ) != 1 )
+	if( ( parse_state->number_of_elements < 0 )
+	 || ( parse_state->number_of_elements > LIBFWEVT_XML_DOCUMENT_ELEMENT_RECURSION_DEPTH ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set value data.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid parse state - number of elements value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		if( libfwevt_xml_tag_debug_print_value_data_segment(
-		     xml_tag,
-		     0,
-		     0,
-		     ascii_codepage,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print value data segment: 0.",
-			 function );
+	parse_element = &( parse_state->elements[ parse_state->number_of_elements ] );
 
-			return( -1 );
-		}
-	}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+	parse_element->name_data                        = name_data;
+	parse_element->name_data_size                   = name_data_size;
+	parse_element->xml_tag                          = NULL;
+	parse_element->number_of_reported_data_segments = 0;
+	parse_element->number_of_reported_elements      = 0;
+	parse_element->node_index                       = -1;
+	parse_element->path_mask                        = 0;
 
-	xml_token->size += value_data_size;
+	parse_state->number_of_elements += 1;
 
 	return( 1 );
 }
 
-/* Reads a character entity reference from a binary XML document
+/* Retrieves the XML tag of the element that is being parsed
+ * The XML tag is owned by the parse state and reused by the subsequent elements
+ * at the same depth, hence it is cleared before it is returned
  * Returns 1 if successful or -1 on error
  */
-int libfwevt_xml_document_read_character_reference(
+int libfwevt_xml_document_get_parse_element_xml_tag(
      libfwevt_internal_xml_document_t *internal_xml_document,
-     libfwevt_xml_token_t *xml_token,
-     const uint8_t *binary_data,
-     size_t binary_data_size,
-     size_t binary_data_offset,
-     libfwevt_xml_tag_t *xml_tag,
-     int ascii_codepage LIBFWEVT_ATTRIBUTE_UNUSED,
+     libfwevt_xml_tag_t **xml_tag,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *character_xml_tag     = NULL;
-	uint16_t *character_value_string          = NULL;
-	uint8_t *character_value_utf16_stream     = NULL;
-	const uint8_t *xml_document_data          = NULL;
-	static char *function                     = "libfwevt_xml_document_read_character_reference";
-	size_t character_value_string_index       = 0;
-	size_t character_value_string_size        = 0;
-	size_t character_value_utf16_stream_index = 0;
-	size_t character_value_utf16_stream_size  = 0;
-	size_t xml_document_data_size             = 0;
-	uint16_t character_value                  = 0;
-	int data_segment_index                    = 0;
-
-	LIBFWEVT_UNREFERENCED_PARAMETER( ascii_codepage )
+	libfwevt_xml_document_parse_state_t *parse_state = NULL;
+	static char *function                            = "libfwevt_xml_document_get_parse_element_xml_tag";
+	int element_index                                = 0;
 
 	if( internal_xml_document == NULL )
 	{
@@ -1261,365 +1389,642 @@ int libfwevt_xml_document_read_character_reference(
 
 		return( -1 );
 	}
-	if( xml_token == NULL )
+	if( internal_xml_document->parse_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid binary XML token.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid binary XML document - missing parse state.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( xml_token->type & 0xbf ) != LIBFWEVT_XML_TOKEN_ENTITY_REFERENCE )
+	parse_state = internal_xml_document->parse_state;
+
+	if( xml_tag == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid binary XML token - unsupported type: 0x%02" PRIx8 ".",
-		 function,
-		 xml_token->type );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tag.",
+		 function );
 
 		return( -1 );
 	}
-	if( binary_data == NULL )
+	if( ( parse_state->number_of_elements <= 0 )
+	 || ( parse_state->number_of_elements > ( LIBFWEVT_XML_DOCUMENT_ELEMENT_RECURSION_DEPTH + 1 ) ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid binary data.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid parse state - number of elements value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( binary_data_size > (size_t) SSIZE_MAX )
+	element_index = parse_state->number_of_elements - 1;
+
+	if( parse_state->xml_tags[ element_index ] == NULL )
+	{
+		if( libfwevt_xml_tag_initialize(
+		     &( parse_state->xml_tags[ element_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create XML tag: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+	}
+	else if( libfwevt_internal_xml_tag_clear(
+	          (libfwevt_internal_xml_tag_t *) parse_state->xml_tags[ element_index ],
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid binary XML document data size value exceeds maximum.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear XML tag: %d.",
+		 function,
+		 element_index );
 
 		return( -1 );
 	}
-	if( binary_data_offset >= binary_data_size )
+	parse_state->elements[ element_index ].xml_tag = parse_state->xml_tags[ element_index ];
+
+	*xml_tag = parse_state->xml_tags[ element_index ];
+
+	return( 1 );
+}
+
+/* Filters the element that is being parsed with the path filter
+ * The element is first matched by name and, once its attributes have been read,
+ * by the attribute predicates of the paths
+ * Returns 1 if the element matches a path, 0 if not or -1 on error
+ */
+int libfwevt_xml_document_filter_parse_element(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     uint8_t match_attributes,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_document_parse_element_t *parse_element = NULL;
+	libfwevt_xml_document_parse_state_t *parse_state     = NULL;
+	static char *function                                = "libfwevt_xml_document_filter_parse_element";
+	uint32_t parent_path_mask                            = 0;
+	int element_index                                    = 0;
+
+	if( internal_xml_document == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid binary data offset value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
 		 function );
 
 		return( -1 );
 	}
-	if( xml_tag == NULL )
+	if( internal_xml_document->parse_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid XML tag.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid binary XML document - missing parse state.",
 		 function );
 
 		return( -1 );
 	}
-	xml_document_data      = &( binary_data[ binary_data_offset ] );
-	xml_document_data_size = binary_data_size - binary_data_offset;
+	parse_state = internal_xml_document->parse_state;
 
-	if( xml_document_data_size < 3 )
+	if( parse_state->path_filter == NULL )
+	{
+		return( 1 );
+	}
+	if( ( parse_state->number_of_elements <= 0 )
+	 || ( parse_state->number_of_elements > ( LIBFWEVT_XML_DOCUMENT_ELEMENT_RECURSION_DEPTH + 1 ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid binary XML document data size value too small.",
+		 "%s: invalid parse state - number of elements value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	element_index = parse_state->number_of_elements - 1;
+	parse_element = &( parse_state->elements[ element_index ] );
+
+	if( match_attributes == 0 )
 	{
-		libcnotify_printf(
-		 "%s: data offset\t\t: 0x%08" PRIzx "\n",
-		 function,
-		 binary_data_offset );
+		if( element_index == 0 )
+		{
+			if( libfwevt_internal_xml_path_filter_get_path_mask(
+			     parse_state->path_filter,
+			     &parent_path_mask,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve path mask.",
+				 function );
 
-		libcnotify_printf(
-		 "%s: character reference data:\n",
-		 function );
-		libcnotify_print_data(
-		 xml_document_data,
-		 3,
-		 0 );
-	}
-#endif
-	byte_stream_copy_to_uint16_little_endian(
-	 &( xml_document_data[ 1 ] ),
-	 character_value );
+				return( -1 );
+			}
+		}
+		else
+		{
+			parent_path_mask = parse_state->elements[ element_index - 1 ].path_mask;
+		}
+		if( libfwevt_internal_xml_path_filter_match_element_name(
+		     parse_state->path_filter,
+		     parent_path_mask,
+		     element_index,
+		     parse_element->name_data,
+		     parse_element->name_data_size,
+		     &( parse_element->path_mask ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to match element name.",
+			 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+			return( -1 );
+		}
+	}
+	else if( parse_element->path_mask != 0 )
 	{
-		libcnotify_printf(
-		 "%s: type\t\t\t: 0x%02" PRIx8 "\n",
-		 function,
-		 xml_document_data[ 0 ] );
-
-		libcnotify_printf(
-		 "%s: character value\t\t: 0x%04" PRIx16 "\n",
-		 function,
-		 character_value );
+		if( libfwevt_internal_xml_path_filter_match_element_attributes(
+		     parse_state->path_filter,
+		     element_index,
+		     parse_element->xml_tag,
+		     &( parse_element->path_mask ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to match element attributes.",
+			 function );
 
-		libcnotify_printf(
-		 "\n" );
+			return( -1 );
+		}
 	}
-#endif
-	xml_token->size = 3;
+	if( parse_element->path_mask == 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
 
-	if( libfwevt_integer_as_unsigned_decimal_get_string_size(
-	     (uint64_t) character_value,
-	     &character_value_string_size,
-	     error ) != 1 )
+/* Reports the start of the elements that are being parsed and have not been started
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_start_parse_elements(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_document_parse_state_t *parse_state = NULL;
+	libfwevt_xml_tag_t *attribute_xml_tag            = NULL;
+	libfwevt_xml_tag_t *xml_tag                      = NULL;
+	libfwevt_xml_value_t *xml_value                  = NULL;
+	const uint8_t *name_data                         = NULL;
+	const uint8_t *value_data                        = NULL;
+	static char *function                            = "libfwevt_xml_document_start_parse_elements";
+	size_t name_data_size                            = 0;
+	size_t value_data_size                           = 0;
+	uint8_t value_type                               = 0;
+	int attribute_index                              = 0;
+	int element_index                                = 0;
+	int number_of_attributes                         = 0;
+	int number_of_data_segments                      = 0;
+
+	if( internal_xml_document == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to determine size of character value string.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	character_value_string_size += 3;
-
-	if( character_value_string_size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint16_t ) ) )
+	if( internal_xml_document->parse_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid character value string size value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid binary XML document - missing parse state.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	character_value_string = (uint16_t *) memory_allocate(
-	                                       sizeof( uint16_t ) * character_value_string_size );
+	parse_state = internal_xml_document->parse_state;
 
-	if( character_value_string == NULL )
+	for( element_index = parse_state->number_of_started_elements;
+	     element_index < parse_state->number_of_elements;
+	     element_index++ )
+	{
+		xml_tag = parse_state->elements[ element_index ].xml_tag;
+
+		if( parse_state->start_element_callback != NULL )
+		{
+			if( parse_state->start_element_callback(
+			     parse_state->elements[ element_index ].name_data,
+			     parse_state->elements[ element_index ].name_data_size,
+			     parse_state->callback_data,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to report start of element: %d.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+		}
+		if( parse_state->attribute_callback != NULL )
+		{
+			if( libfwevt_xml_tag_get_number_of_attributes(
+			     xml_tag,
+			     &number_of_attributes,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve element: %d number of attributes.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+			for( attribute_index = 0;
+			     attribute_index < number_of_attributes;
+			     attribute_index++ )
+			{
+				if( libfwevt_xml_tag_get_attribute_by_index(
+				     xml_tag,
+				     attribute_index,
+				     &attribute_xml_tag,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve attribute: %d.",
+					 function,
+					 attribute_index );
+
+					return( -1 );
+				}
+				if( libfwevt_xml_tag_get_name_data(
+				     attribute_xml_tag,
+				     &name_data,
+				     &name_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve attribute: %d name data.",
+					 function,
+					 attribute_index );
+
+					return( -1 );
+				}
+				if( libfwevt_xml_tag_get_value(
+				     attribute_xml_tag,
+				     &xml_value,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve attribute: %d value.",
+					 function,
+					 attribute_index );
+
+					return( -1 );
+				}
+				value_type              = 0;
+				value_data              = NULL;
+				value_data_size         = 0;
+				number_of_data_segments = 0;
+
+				if( xml_value != NULL )
+				{
+					if( libfwevt_xml_value_get_type(
+					     xml_value,
+					     &value_type,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve attribute: %d value type.",
+						 function,
+						 attribute_index );
+
+						return( -1 );
+					}
+					if( libfwevt_xml_value_get_number_of_data_segments(
+					     xml_value,
+					     &number_of_data_segments,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve attribute: %d number of value data segments.",
+						 function,
+						 attribute_index );
+
+						return( -1 );
+					}
+				}
+				if( number_of_data_segments > 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+					 "%s: unsupported attribute: %d number of value data segments.",
+					 function,
+					 attribute_index );
+
+					return( -1 );
+				}
+				else if( number_of_data_segments == 1 )
+				{
+					if( libfwevt_xml_value_get_data_segment_data(
+					     xml_value,
+					     0,
+					     &value_data,
+					     &value_data_size,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+						 "%s: unable to retrieve attribute: %d value data.",
+						 function,
+						 attribute_index );
+
+						return( -1 );
+					}
+				}
+				if( parse_state->attribute_callback(
+				     name_data,
+				     name_data_size,
+				     value_type,
+				     value_data,
+				     value_data_size,
+				     parse_state->callback_data,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to report attribute: %d.",
+					 function,
+					 attribute_index );
+
+					return( -1 );
+				}
+			}
+		}
+		if( parse_state->path_filter != NULL )
+		{
+			if( libfwevt_xml_document_append_path_filter_attribute_results(
+			     internal_xml_document,
+			     element_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append element: %d path filter attribute results.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+		}
+		if( parse_state->tree != NULL )
+		{
+			if( libfwevt_xml_document_append_parse_element_node(
+			     internal_xml_document,
+			     element_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append element: %d node.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+		}
+		parse_state->number_of_started_elements = element_index + 1;
+	}
+	return( 1 );
+}
+
+/* Appends the element that is being parsed and its attributes as nodes to the XML tree
+ * The value of the element is moved to its node when the element is popped
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_append_parse_element_node(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     int element_index,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_document_parse_element_t *parse_element = NULL;
+	libfwevt_xml_document_parse_state_t *parse_state     = NULL;
+	libfwevt_xml_tag_t *attribute_xml_tag                = NULL;
+	static char *function                                = "libfwevt_xml_document_append_parse_element_node";
+	int attribute_index                                  = 0;
+	int node_index                                       = 0;
+	int number_of_attributes                             = 0;
+	int parent_index                                     = -1;
+
+	if( internal_xml_document == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create character value string.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	character_value_string[ character_value_string_index++ ] = (uint16_t) '&';
-	character_value_string[ character_value_string_index++ ] = (uint16_t) '#';
-
-	if( libfwevt_integer_as_unsigned_decimal_copy_to_utf16_string_with_index(
-	     (uint64_t) character_value,
-	     character_value_string,
-	     character_value_string_size,
-	     &character_value_string_index,
-	     error ) != 1 )
+	if( internal_xml_document->parse_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy character value to UTF-16 string.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid binary XML document - missing parse state.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	character_value_string[ character_value_string_size - 2 ] = (uint16_t) ';';
-	character_value_string[ character_value_string_size - 1 ] = 0;
+	parse_state = internal_xml_document->parse_state;
 
-	if( libfwevt_xml_tag_set_value_type(
-	     xml_tag,
-	     LIBFWEVT_VALUE_TYPE_STRING_UTF16,
-	     error ) != 1 )
+	if( parse_state->tree == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set value type.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid parse state - missing XML tree.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	/* Make sure the character value data is in UTF-16 litte-endian
-	 */
-	if( ( character_value_utf16_stream_size == 0 )
-	 || ( character_value_utf16_stream_size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) ) )
+	if( ( element_index < 0 )
+	 || ( element_index >= parse_state->number_of_elements ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid character value UTF-16 stream size value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid element index value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	character_value_utf16_stream_size = character_value_string_size * 2;
+	parse_element = &( parse_state->elements[ element_index ] );
 
-	character_value_utf16_stream = (uint8_t *) memory_allocate(
-	                                            sizeof( uint8_t ) * character_value_utf16_stream_size );
-
-	if( character_value_utf16_stream == NULL )
+	if( element_index > 0 )
+	{
+		parent_index = parse_state->elements[ element_index - 1 ].node_index;
+	}
+	if( libfwevt_xml_tree_append_node(
+	     parse_state->tree,
+	     parent_index,
+	     (libfwevt_internal_xml_tag_t *) parse_element->xml_tag,
+	     &node_index,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create character value UTF-16 stream.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append node.",
 		 function );
 
-		goto on_error;
-	}
-	for( character_value_string_index = 0;
-	     character_value_string_index < character_value_string_size;
-	     character_value_string_index++ )
-	{
-		byte_stream_copy_from_uint16_little_endian(
-		 &( character_value_utf16_stream[ character_value_utf16_stream_index ] ),
-		 character_value_string[ character_value_string_index ] );
-
-		character_value_utf16_stream_index += 2;
+		return( -1 );
 	}
-	memory_free(
-	 character_value_string );
-
-	character_value_string = NULL;
+	parse_element->node_index = node_index;
 
-	if( libfwevt_xml_tag_append_value_data(
-	     xml_tag,
-	     character_value_utf16_stream,
-	     character_value_utf16_stream_size,
-	     &data_segment_index,
+	if( libfwevt_xml_tag_get_number_of_attributes(
+	     parse_element->xml_tag,
+	     &number_of_attributes,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append value data.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of attributes.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	memory_free(
-	 character_value_utf16_stream );
-
-	character_value_utf16_stream = NULL;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	for( attribute_index = 0;
+	     attribute_index < number_of_attributes;
+	     attribute_index++ )
 	{
-		if( libfwevt_xml_tag_debug_print_value_data_segment(
-		     xml_tag,
-		     data_segment_index,
-		     0,
-		     ascii_codepage,
+		if( libfwevt_xml_tag_get_attribute_by_index(
+		     parse_element->xml_tag,
+		     attribute_index,
+		     &attribute_xml_tag,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print value data segment: %d.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve attribute: %d.",
 			 function,
-			 data_segment_index );
+			 attribute_index );
 
-			goto on_error;
+			return( -1 );
 		}
-	}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-
-	if( libfwevt_internal_xml_tag_free(
-	     (libfwevt_internal_xml_tag_t **) &character_xml_tag,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free character XML tag.",
-		 function );
+		if( libfwevt_xml_tree_append_attribute(
+		     parse_state->tree,
+		     node_index,
+		     (libfwevt_internal_xml_tag_t *) attribute_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append attribute: %d.",
+			 function,
+			 attribute_index );
 
-		goto on_error;
+			return( -1 );
+		}
 	}
 	return( 1 );
-
-on_error:
-	if( character_value_utf16_stream != NULL )
-	{
-		memory_free(
-		 character_value_utf16_stream );
-	}
-	if( character_value_string != NULL )
-	{
-		memory_free(
-		 character_value_string );
-	}
-	if( character_xml_tag != NULL )
-	{
-		libfwevt_internal_xml_tag_free(
-		 (libfwevt_internal_xml_tag_t **) &character_xml_tag,
-		 NULL );
-	}
-	return( -1 );
 }
 
-/* Reads an element from a binary XML document
+/* Reports value data segments of an element that is being parsed
+ * The template value index is -1 if the value data was not substituted
  * Returns 1 if successful or -1 on error
  */
-int libfwevt_xml_document_read_element(
+int libfwevt_xml_document_report_parse_element_values(
      libfwevt_internal_xml_document_t *internal_xml_document,
-     libfwevt_xml_token_t *xml_token,
-     const uint8_t *binary_data,
-     size_t binary_data_size,
-     size_t binary_data_offset,
-     int ascii_codepage,
-     uint8_t flags,
-     libcdata_array_t *template_values_array,
-     libfwevt_xml_tag_t *xml_tag,
-     int element_recursion_depth,
-     int template_instance_recursion_depth,
+     libfwevt_xml_value_t *xml_value,
+     int first_data_segment_index,
+     int number_of_data_segments,
+     int template_value_index,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *element_xml_tag      = NULL;
-	libfwevt_xml_token_t *xml_sub_token      = NULL;
-	const uint8_t *xml_document_data         = NULL;
-	static char *function                    = "libfwevt_xml_document_read_element";
-	size_t additional_value_size             = 0;
-	size_t element_size_offset               = 0;
-	size_t template_value_offset             = 0;
-	size_t trailing_data_size                = 0;
-	size_t xml_document_data_offset          = 0;
-	size_t xml_document_data_size            = 0;
-	uint32_t attribute_list_size             = 0;
-	uint32_t element_name_offset             = 0;
-	uint32_t element_name_size               = 0;
-	uint32_t element_size                    = 0;
-	int result                               = 0;
-	int template_value_array_recursion_depth = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint16_t value_16bit                     = 0;
-#endif
+	libfwevt_xml_document_parse_state_t *parse_state = NULL;
+	const uint8_t *value_data                        = NULL;
+	static char *function                            = "libfwevt_xml_document_report_parse_element_values";
+	size_t value_data_size                           = 0;
+	uint8_t value_type                               = 0;
+	int data_segment_index                           = 0;
+	int result                                       = 0;
 
 	if( internal_xml_document == NULL )
 	{
@@ -1632,969 +2037,1063 @@ int libfwevt_xml_document_read_element(
 
 		return( -1 );
 	}
-	if( xml_token == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid binary XML token.",
-		 function );
-
-		return( -1 );
-	}
-	if( ( xml_token->type & 0xbf ) != LIBFWEVT_XML_TOKEN_OPEN_START_ELEMENT_TAG )
+	if( internal_xml_document->parse_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid binary XML token - unsupported type: 0x%02" PRIx8 ".",
-		 function,
-		 xml_token->type );
-
-		return( -1 );
-	}
-	if( binary_data == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid binary data.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid binary XML document - missing parse state.",
 		 function );
 
 		return( -1 );
 	}
-	if( binary_data_size > (size_t) SSIZE_MAX )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid binary XML document data size value exceeds maximum.",
-		 function );
+	parse_state = internal_xml_document->parse_state;
 
-		return( -1 );
-	}
-	if( binary_data_offset >= binary_data_size )
+	if( ( template_value_index < -1 )
+	 || ( template_value_index > (int) UINT16_MAX ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid binary data offset value out of bounds.",
+		 "%s: invalid template value index value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( element_recursion_depth < 0 )
-	 || ( element_recursion_depth > LIBFWEVT_XML_DOCUMENT_ELEMENT_RECURSION_DEPTH ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid element recursion depth value out of bounds.",
-		 function );
-
-		return( -1 );
-	}
-	if( ( flags & LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS ) != 0 )
-	{
-		additional_value_size = 4;
-	}
-	if( ( binary_data_size < ( 5 + additional_value_size ) )
-	 || ( binary_data_offset > ( binary_data_size - 5 - additional_value_size ) ) )
+	if( ( parse_state->value_callback == NULL )
+	 && ( ( template_value_index == -1 )
+	  ||  ( parse_state->substitution_callback == NULL ) ) )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid binary XML document data size value too small.",
-		 function );
-
-		goto on_error;
+		return( 1 );
 	}
-	if( libfwevt_xml_token_initialize(
-	     &xml_sub_token,
+	if( libfwevt_xml_value_get_type(
+	     xml_value,
+	     &value_type,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create binary XML sub token.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value type.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	xml_document_data      = &( binary_data[ binary_data_offset ] );
-	xml_document_data_size = binary_data_size - binary_data_offset;
-
-	do
+	for( data_segment_index = first_data_segment_index;
+	     data_segment_index < number_of_data_segments;
+	     data_segment_index++ )
 	{
-		if( ( template_value_array_recursion_depth < 0 )
-		 || ( template_value_array_recursion_depth > LIBFWEVT_XML_DOCUMENT_TEMPLATE_VALUE_ARRAY_RECURSION_DEPTH ) )
+		if( libfwevt_xml_value_get_data_segment_data(
+		     xml_value,
+		     data_segment_index,
+		     &value_data,
+		     &value_data_size,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid template value array recursion depth value out of bounds.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value data segment: %d data.",
+			 function,
+			 data_segment_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( libfwevt_xml_tag_initialize(
-		     &element_xml_tag,
-		     error ) != 1 )
+		if( ( template_value_index != -1 )
+		 && ( parse_state->substitution_callback != NULL ) )
+		{
+			result = parse_state->substitution_callback(
+			          (uint16_t) template_value_index,
+			          value_type,
+			          value_data,
+			          value_data_size,
+			          parse_state->callback_data,
+			          error );
+		}
+		else
+		{
+			result = parse_state->value_callback(
+			          value_type,
+			          value_data,
+			          value_data_size,
+			          parse_state->callback_data,
+			          error );
+		}
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create element XML tag.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to report value data segment: %d.",
+			 function,
+			 data_segment_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		/* Note that the dependency identifier is an optional value.
-		 */
-		element_size_offset = 1;
+	}
+	return( 1 );
+}
 
-		byte_stream_copy_to_uint32_little_endian(
-		 &( xml_document_data[ element_size_offset ] ),
-		 element_size );
+/* Appends a path filter result
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_append_path_filter_result(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     int path_index,
+     uint8_t value_type,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_document_path_filter_result_t *path_filter_results = NULL;
+	libfwevt_xml_document_path_filter_result_t *result              = NULL;
+	static char *function                                           = "libfwevt_xml_document_append_path_filter_result";
+	size_t path_filter_results_size                                 = 0;
+	int number_of_allocated_path_filter_results                     = 0;
 
-		if( ( xml_document_data_size > 7 )
-		 && ( element_size > ( xml_document_data_size - 7 ) ) )
-		{
-			element_size_offset = 3;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: data offset\t\t\t\t: 0x%08" PRIzx "\n",
-			 function,
-			 binary_data_offset );
-
-			libcnotify_printf(
-			 "%s: element data:\n",
-			 function );
-			libcnotify_print_data(
-			 xml_document_data,
-			 element_size_offset + 4 + additional_value_size,
-			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-		}
-#endif
-		byte_stream_copy_to_uint32_little_endian(
-		 &( xml_document_data[ element_size_offset ] ),
-		 element_size );
+	if( internal_xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
+		 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		return( -1 );
+	}
+	if( internal_xml_document->number_of_path_filter_results >= internal_xml_document->number_of_allocated_path_filter_results )
+	{
+		if( internal_xml_document->number_of_allocated_path_filter_results == 0 )
 		{
-			libcnotify_printf(
-			 "%s: type\t\t\t\t: 0x%02" PRIx8 "\n",
-			 function,
-			 xml_document_data[ 0 ] );
-
-			if( element_size_offset == 3 )
-			{
-				byte_stream_copy_to_uint16_little_endian(
-				 &( xml_document_data[ 1 ] ),
-				 value_16bit );
-				libcnotify_printf(
-				 "%s: dependency identifier\t\t: %" PRIi16 " (0x%04" PRIx16 ")\n",
-				 function,
-				 (int16_t) value_16bit,
-				 value_16bit );
-			}
-			libcnotify_printf(
-			 "%s: size\t\t\t\t: %" PRIu32 "\n",
-			 function,
-			 element_size );
+			number_of_allocated_path_filter_results = 16;
 		}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-
-		xml_document_data_offset = element_size_offset + 4;
-
-		/* The first 5 or 7 bytes are not included in the element size
-		 */
-		if( ( flags & LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS ) == 0 )
+		else if( internal_xml_document->number_of_allocated_path_filter_results < ( INT_MAX / 2 ) )
 		{
-			element_name_offset = (uint32_t) ( binary_data_offset + xml_document_data_offset );
+			number_of_allocated_path_filter_results = internal_xml_document->number_of_allocated_path_filter_results * 2;
 		}
 		else
 		{
-			if( xml_document_data_offset >= ( xml_document_data_size - 4 ) )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid binary XML document data size value too small.",
-				 function );
-
-				goto on_error;
-			}
-			byte_stream_copy_to_uint32_little_endian(
-			 &( xml_document_data[ xml_document_data_offset ] ),
-			 element_name_offset );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid binary XML document - number of path filter results value exceeds maximum.",
+			 function );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: name offset\t\t\t\t: 0x%08" PRIx32 "\n",
-				 function,
-				 element_name_offset );
-			}
-#endif
-			xml_document_data_offset += 4;
-			element_size             -= 4;
+			return( -1 );
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		path_filter_results_size = sizeof( libfwevt_xml_document_path_filter_result_t ) * number_of_allocated_path_filter_results;
+
+		if( path_filter_results_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
 		{
-			libcnotify_printf(
-			 "\n" );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid path filter results size value exceeds maximum.",
+			 function );
+
+			return( -1 );
 		}
-#endif
-		if( element_name_offset > ( binary_data_offset + xml_document_data_offset ) )
+		path_filter_results = (libfwevt_xml_document_path_filter_result_t *) memory_reallocate(
+		                                                                      internal_xml_document->path_filter_results,
+		                                                                      path_filter_results_size );
+
+		if( path_filter_results == NULL )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid element data offset value out of bounds.",
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize path filter results.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( ( binary_data_offset + xml_document_data_offset ) < element_name_offset )
-		{
-			trailing_data_size = element_name_offset - ( binary_data_offset + xml_document_data_offset );
+		internal_xml_document->path_filter_results                     = path_filter_results;
+		internal_xml_document->number_of_allocated_path_filter_results = number_of_allocated_path_filter_results;
+	}
+	result = &( internal_xml_document->path_filter_results[ internal_xml_document->number_of_path_filter_results ] );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: data offset\t\t\t\t: 0x%08" PRIzx "\n",
-				 function,
-				 binary_data_offset + xml_document_data_offset );
+	result->value_data      = value_data;
+	result->value_data_size = value_data_size;
+	result->path_index      = path_index;
+	result->value_type      = value_type;
 
-				libcnotify_printf(
-				 "%s: trailing data:\n",
-				 function );
-				libcnotify_print_data(
-				 &( xml_document_data[ xml_document_data_offset ] ),
-				 trailing_data_size,
-				 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-			}
-#endif
-			xml_document_data_offset += trailing_data_size;
-			element_size             -= (uint32_t) trailing_data_size;
+	internal_xml_document->number_of_path_filter_results += 1;
+
+	return( 1 );
+}
+
+/* Appends the attribute values of an element that is being parsed as path filter results
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_append_path_filter_attribute_results(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     int element_index,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_document_parse_element_t *parse_element = NULL;
+	libfwevt_xml_document_parse_state_t *parse_state     = NULL;
+	libfwevt_xml_path_filter_path_t *path                = NULL;
+	libfwevt_xml_tag_t *attribute_xml_tag                = NULL;
+	libfwevt_xml_value_t *xml_value                      = NULL;
+	const uint8_t *name_data                             = NULL;
+	const uint8_t *value_data                            = NULL;
+	static char *function                                = "libfwevt_xml_document_append_path_filter_attribute_results";
+	size_t name_data_size                                = 0;
+	size_t value_data_size                               = 0;
+	uint8_t value_type                                   = 0;
+	int attribute_index                                  = 0;
+	int number_of_attributes                             = 0;
+	int number_of_data_segments                          = 0;
+	int path_index                                       = 0;
+
+	if( internal_xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_xml_document->parse_state == NULL )
+	 || ( internal_xml_document->parse_state->path_filter == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid binary XML document - missing parse state or path filter.",
+		 function );
+
+		return( -1 );
+	}
+	parse_state = internal_xml_document->parse_state;
+
+	if( ( element_index < 0 )
+	 || ( element_index >= parse_state->number_of_elements ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid element index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	parse_element = &( parse_state->elements[ element_index ] );
+
+	for( path_index = 0;
+	     path_index < parse_state->path_filter->number_of_paths;
+	     path_index++ )
+	{
+		if( ( parse_element->path_mask & ( (uint32_t) 1 << path_index ) ) == 0 )
+		{
+			continue;
 		}
-		if( libfwevt_xml_document_read_name(
-		     internal_xml_document,
-		     binary_data,
-		     binary_data_size,
-		     element_name_offset,
-		     flags,
-		     &element_name_size,
-		     element_xml_tag,
+		path = parse_state->path_filter->paths[ path_index ];
+
+		if( ( path->attribute_name == NULL )
+		 || ( path->number_of_elements != element_index ) )
+		{
+			continue;
+		}
+		if( libfwevt_xml_tag_get_number_of_attributes(
+		     parse_element->xml_tag,
+		     &number_of_attributes,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read element name.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of attributes.",
 			 function );
 
-			goto on_error;
-		}
-		if( ( binary_data_offset + xml_document_data_offset ) == element_name_offset )
-		{
-			xml_document_data_offset += element_name_size;
-			element_size             -= element_name_size;
+			return( -1 );
 		}
-		if( ( xml_token->type & LIBFWEVT_XML_TOKEN_FLAG_HAS_MORE_DATA ) != 0 )
+		for( attribute_index = 0;
+		     attribute_index < number_of_attributes;
+		     attribute_index++ )
 		{
-			if( xml_document_data_offset >= ( xml_document_data_size - 4 ) )
+			if( libfwevt_xml_tag_get_attribute_by_index(
+			     parse_element->xml_tag,
+			     attribute_index,
+			     &attribute_xml_tag,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid binary XML document data size value too small.",
-				 function );
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve attribute: %d.",
+				 function,
+				 attribute_index );
 
-				goto on_error;
+				return( -1 );
 			}
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			if( libfwevt_xml_tag_get_name_data(
+			     attribute_xml_tag,
+			     &name_data,
+			     &name_data_size,
+			     error ) != 1 )
 			{
-				libcnotify_printf(
-				 "%s: data offset\t\t\t\t: 0x%08" PRIzx "\n",
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve attribute: %d name data.",
 				 function,
-				 binary_data_offset + xml_document_data_offset );
+				 attribute_index );
 
-				libcnotify_printf(
-				 "%s: attribute list data:\n",
-				 function );
-				libcnotify_print_data(
-				 &( xml_document_data[ xml_document_data_offset ] ),
-				 4,
-				 0 );
+				return( -1 );
 			}
-#endif
-			byte_stream_copy_to_uint32_little_endian(
-			 &( xml_document_data[ xml_document_data_offset ] ),
-			 attribute_list_size );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
+			if( ( path->attribute_name_size != name_data_size )
+			 || ( memory_compare(
+			       path->attribute_name,
+			       name_data,
+			       name_data_size ) != 0 ) )
 			{
-				libcnotify_printf(
-				 "%s: attribute list size\t\t\t: %" PRIu32 "\n",
-				 function,
-				 attribute_list_size );
-
-				libcnotify_printf(
-				 "\n" );
+				continue;
 			}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-
-			xml_document_data_offset += 4;
-			element_size             -= 4;
-
-			if( attribute_list_size > ( binary_data_size - ( binary_data_offset + xml_document_data_offset ) ) )
+			if( libfwevt_xml_tag_get_value(
+			     attribute_xml_tag,
+			     &xml_value,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid attribute list size value out of bounds.",
-				 function );
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve attribute: %d value.",
+				 function,
+				 attribute_index );
 
-				goto on_error;
+				return( -1 );
 			}
-			while( attribute_list_size > 0 )
+			if( xml_value == NULL )
 			{
-				if( libfwevt_xml_token_read_data(
-				     xml_sub_token,
-				     binary_data,
-				     binary_data_size,
-				     binary_data_offset + xml_document_data_offset,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read binary XML sub token.",
-					 function );
+				break;
+			}
+			if( libfwevt_xml_value_get_type(
+			     xml_value,
+			     &value_type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve attribute: %d value type.",
+				 function,
+				 attribute_index );
 
-					goto on_error;
-				}
-				if( libfwevt_xml_document_read_attribute(
-				     internal_xml_document,
-				     xml_sub_token,
-				     binary_data,
-				     binary_data_size,
-				     binary_data_offset + xml_document_data_offset,
-				     ascii_codepage,
-				     flags,
-				     template_values_array,
-				     element_xml_tag,
-				     element_recursion_depth,
-				     template_instance_recursion_depth,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read attribute.",
-					 function );
+				return( -1 );
+			}
+			if( libfwevt_xml_value_get_number_of_data_segments(
+			     xml_value,
+			     &number_of_data_segments,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve attribute: %d number of value data segments.",
+				 function,
+				 attribute_index );
 
-					goto on_error;
-				}
-				xml_document_data_offset += xml_sub_token->size;
-				element_size             -= (uint32_t) xml_sub_token->size;
+				return( -1 );
+			}
+			if( number_of_data_segments != 1 )
+			{
+				break;
+			}
+			if( libfwevt_xml_value_get_data_segment_data(
+			     xml_value,
+			     0,
+			     &value_data,
+			     &value_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve attribute: %d value data.",
+				 function,
+				 attribute_index );
 
-				if( attribute_list_size < xml_sub_token->size )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: invalid attribute list size value too small.",
-					 function );
+				return( -1 );
+			}
+			if( libfwevt_xml_document_append_path_filter_result(
+			     internal_xml_document,
+			     path_index,
+			     value_type,
+			     value_data,
+			     value_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append path filter result.",
+				 function );
 
-					goto on_error;
-				}
-				attribute_list_size -= (uint32_t) xml_sub_token->size;
+				return( -1 );
 			}
+			break;
 		}
-		if( libfwevt_xml_token_read_data(
-		     xml_sub_token,
-		     binary_data,
-		     binary_data_size,
-		     binary_data_offset + xml_document_data_offset,
+	}
+	return( 1 );
+}
+
+/* Appends value data segments of an element that is being parsed as path filter results
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_append_path_filter_value_results(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     int element_index,
+     libfwevt_xml_value_t *xml_value,
+     int first_data_segment_index,
+     int number_of_data_segments,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_document_parse_state_t *parse_state = NULL;
+	libfwevt_xml_path_filter_path_t *path            = NULL;
+	const uint8_t *value_data                        = NULL;
+	static char *function                            = "libfwevt_xml_document_append_path_filter_value_results";
+	size_t value_data_size                           = 0;
+	uint32_t path_mask                               = 0;
+	uint8_t value_type                               = 0;
+	int data_segment_index                           = 0;
+	int path_index                                   = 0;
+
+	if( internal_xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_xml_document->parse_state == NULL )
+	 || ( internal_xml_document->parse_state->path_filter == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid binary XML document - missing parse state or path filter.",
+		 function );
+
+		return( -1 );
+	}
+	parse_state = internal_xml_document->parse_state;
+
+	if( ( element_index < 0 )
+	 || ( element_index >= parse_state->number_of_elements ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid element index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	path_mask = parse_state->elements[ element_index ].path_mask;
+
+	for( path_index = 0;
+	     path_index < parse_state->path_filter->number_of_paths;
+	     path_index++ )
+	{
+		if( ( path_mask & ( (uint32_t) 1 << path_index ) ) == 0 )
+		{
+			continue;
+		}
+		path = parse_state->path_filter->paths[ path_index ];
+
+		if( ( path->attribute_name != NULL )
+		 || ( path->number_of_elements != element_index ) )
+		{
+			continue;
+		}
+		if( libfwevt_xml_value_get_type(
+		     xml_value,
+		     &value_type,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read binary XML sub token.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value type.",
 			 function );
 
-			goto on_error;
+			return( -1 );
+		}
+		for( data_segment_index = first_data_segment_index;
+		     data_segment_index < number_of_data_segments;
+		     data_segment_index++ )
+		{
+			if( libfwevt_xml_value_get_data_segment_data(
+			     xml_value,
+			     data_segment_index,
+			     &value_data,
+			     &value_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value data segment: %d data.",
+				 function,
+				 data_segment_index );
+
+				return( -1 );
+			}
+			if( libfwevt_xml_document_append_path_filter_result(
+			     internal_xml_document,
+			     path_index,
+			     value_type,
+			     value_data,
+			     value_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append path filter result.",
+				 function );
+
+				return( -1 );
+			}
 		}
-		if( ( xml_sub_token->type != LIBFWEVT_XML_TOKEN_CLOSE_START_ELEMENT_TAG )
-		 && ( xml_sub_token->type != LIBFWEVT_XML_TOKEN_CLOSE_EMPTY_ELEMENT_TAG ) )
+	}
+	return( 1 );
+}
+
+/* Reports the content of the element that is being parsed that has not been reported
+ * The template value index is -1 if the content was not substituted
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_report_parse_element_content(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     int template_value_index,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_document_parse_element_t *parse_element = NULL;
+	libfwevt_xml_document_parse_state_t *parse_state     = NULL;
+	libfwevt_xml_tag_t *element_xml_tag                  = NULL;
+	libfwevt_xml_value_t *xml_value                      = NULL;
+	const uint8_t *name_data                             = NULL;
+	static char *function                                = "libfwevt_xml_document_report_parse_element_content";
+	size_t name_data_size                                = 0;
+	int element_index                                    = 0;
+	int node_index                                       = 0;
+	int number_of_data_segments                          = 0;
+	int number_of_elements                               = 0;
+
+	if( internal_xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_xml_document->parse_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid binary XML document - missing parse state.",
+		 function );
+
+		return( -1 );
+	}
+	parse_state = internal_xml_document->parse_state;
+
+	if( ( parse_state->number_of_elements <= 0 )
+	 || ( parse_state->number_of_elements > ( LIBFWEVT_XML_DOCUMENT_ELEMENT_RECURSION_DEPTH + 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid parse state - number of elements value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	parse_element = &( parse_state->elements[ parse_state->number_of_elements - 1 ] );
+
+	if( libfwevt_xml_tag_get_value(
+	     parse_element->xml_tag,
+	     &xml_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_value != NULL )
+	{
+		if( libfwevt_xml_value_get_number_of_data_segments(
+		     xml_value,
+		     &number_of_data_segments,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: invalid binary XML token - unsupported type: 0x%02" PRIx8 ".",
-			 function,
-			 xml_token->type );
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of value data segments.",
+			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( xml_document_data_offset >= xml_document_data_size )
+	}
+	if( number_of_data_segments > parse_element->number_of_reported_data_segments )
+	{
+		if( libfwevt_xml_document_start_parse_elements(
+		     internal_xml_document,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid binary XML document data size value too small.",
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to report start of elements.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( libfwevt_xml_document_report_parse_element_values(
+		     internal_xml_document,
+		     xml_value,
+		     parse_element->number_of_reported_data_segments,
+		     number_of_data_segments,
+		     template_value_index,
+		     error ) != 1 )
 		{
-			libcnotify_printf(
-			 "%s: data offset\t\t\t\t: 0x%08" PRIzx "\n",
-			 function,
-			 binary_data_offset + xml_document_data_offset );
-
-			libcnotify_printf(
-			 "%s: close element tag data:\n",
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to report values.",
 			 function );
-			libcnotify_print_data(
-			 &( xml_document_data[ xml_document_data_offset ] ),
-			 1,
-			 0 );
-		}
-#endif
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: type\t\t\t\t: 0x%02" PRIx8 "\n",
-			 function,
-			 xml_document_data[ xml_document_data_offset ] );
 
-			libcnotify_printf(
-			 "\n" );
+			return( -1 );
 		}
-#endif
-		xml_document_data_offset += 1;
-		element_size             -= 1;
+		if( parse_state->path_filter != NULL )
+		{
+			if( libfwevt_xml_document_append_path_filter_value_results(
+			     internal_xml_document,
+			     parse_state->number_of_elements - 1,
+			     xml_value,
+			     parse_element->number_of_reported_data_segments,
+			     number_of_data_segments,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append path filter value results.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		parse_element->number_of_reported_data_segments = number_of_data_segments;
+	}
+	if( libfwevt_xml_tag_get_number_of_elements(
+	     parse_element->xml_tag,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_elements > parse_element->number_of_reported_elements )
+	{
+		if( libfwevt_xml_document_start_parse_elements(
+		     internal_xml_document,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to report start of elements.",
+			 function );
 
-		if( xml_sub_token->type == LIBFWEVT_XML_TOKEN_CLOSE_START_ELEMENT_TAG )
+			return( -1 );
+		}
+		/* Processing instructions are reported as elements named after their target
+		 */
+		for( element_index = parse_element->number_of_reported_elements;
+		     element_index < number_of_elements;
+		     element_index++ )
 		{
-			result = 1;
+			if( libfwevt_xml_tag_get_element_by_index(
+			     parse_element->xml_tag,
+			     element_index,
+			     &element_xml_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve element: %d.",
+				 function,
+				 element_index );
 
-			while( element_size > 0 )
+				return( -1 );
+			}
+			if( libfwevt_xml_tag_get_name_data(
+			     element_xml_tag,
+			     &name_data,
+			     &name_data_size,
+			     error ) != 1 )
 			{
-				if( libfwevt_xml_token_read_data(
-				     xml_sub_token,
-				     binary_data,
-				     binary_data_size,
-				     binary_data_offset + xml_document_data_offset,
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve element: %d name data.",
+				 function,
+				 element_index );
+
+				return( -1 );
+			}
+			if( parse_state->start_element_callback != NULL )
+			{
+				if( parse_state->start_element_callback(
+				     name_data,
+				     name_data_size,
+				     parse_state->callback_data,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read binary XML sub token.",
-					 function );
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to report start of element: %d.",
+					 function,
+					 element_index );
 
-					goto on_error;
+					return( -1 );
 				}
-				switch( xml_sub_token->type & 0xbf )
-				{
-					case LIBFWEVT_XML_TOKEN_OPEN_START_ELEMENT_TAG:
-						if( libfwevt_xml_document_read_element(
-						     internal_xml_document,
-						     xml_sub_token,
-						     binary_data,
-						     binary_data_size,
-						     binary_data_offset + xml_document_data_offset,
-						     ascii_codepage,
-						     flags,
-						     template_values_array,
-						     element_xml_tag,
-						     element_recursion_depth + 1,
-						     template_instance_recursion_depth,
-						     error ) != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_IO,
-							 LIBCERROR_IO_ERROR_READ_FAILED,
-							 "%s: unable to read element.",
-							 function );
-
-							goto on_error;
-						}
-						break;
+			}
+			if( libfwevt_xml_tag_get_value(
+			     element_xml_tag,
+			     &xml_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve element: %d value.",
+				 function,
+				 element_index );
 
-					case LIBFWEVT_XML_TOKEN_CLOSE_EMPTY_ELEMENT_TAG:
-					case LIBFWEVT_XML_TOKEN_END_ELEMENT_TAG:
-						if( xml_document_data_offset >= xml_document_data_size )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-							 "%s: invalid binary XML document data size value too small.",
-							 function );
+				return( -1 );
+			}
+			if( xml_value != NULL )
+			{
+				if( libfwevt_xml_value_get_number_of_data_segments(
+				     xml_value,
+				     &number_of_data_segments,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve element: %d number of value data segments.",
+					 function,
+					 element_index );
 
-							goto on_error;
-						}
-#if defined( HAVE_DEBUG_OUTPUT )
-						if( libcnotify_verbose != 0 )
-						{
-							libcnotify_printf(
-							 "%s: data offset\t\t\t\t: 0x%08" PRIzx "\n",
-							 function,
-							 binary_data_offset + xml_document_data_offset );
+					return( -1 );
+				}
+				if( libfwevt_xml_document_report_parse_element_values(
+				     internal_xml_document,
+				     xml_value,
+				     0,
+				     number_of_data_segments,
+				     -1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to report element: %d values.",
+					 function,
+					 element_index );
 
-							libcnotify_printf(
-							 "%s: end element tag data:\n",
-							 function );
-							libcnotify_print_data(
-							 &( xml_document_data[ xml_document_data_offset ] ),
-							 1,
-							 0 );
-						}
-#endif
-#if defined( HAVE_DEBUG_OUTPUT )
-						if( libcnotify_verbose != 0 )
-						{
-							libcnotify_printf(
-							 "%s: type\t\t\t\t: 0x%02" PRIx8 "\n",
-							 function,
-							 xml_document_data[ xml_document_data_offset ] );
+					return( -1 );
+				}
+			}
+			if( parse_state->end_element_callback != NULL )
+			{
+				if( parse_state->end_element_callback(
+				     name_data,
+				     name_data_size,
+				     parse_state->callback_data,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to report end of element: %d.",
+					 function,
+					 element_index );
 
-							libcnotify_printf(
-							 "\n" );
-						}
-#endif
-						xml_sub_token->size = 1;
+					return( -1 );
+				}
+			}
+			if( parse_state->tree != NULL )
+			{
+				if( libfwevt_xml_tree_append_node(
+				     parse_state->tree,
+				     parse_element->node_index,
+				     (libfwevt_internal_xml_tag_t *) element_xml_tag,
+				     &node_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append element: %d node.",
+					 function,
+					 element_index );
 
-						break;
+					return( -1 );
+				}
+				if( libfwevt_xml_tree_set_node_value(
+				     parse_state->tree,
+				     node_index,
+				     (libfwevt_internal_xml_tag_t *) element_xml_tag,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set value of element: %d node.",
+					 function,
+					 element_index );
 
-					case LIBFWEVT_XML_TOKEN_CDATA_SECTION:
-						if( template_value_offset != 0 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-							 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-							 "%s: invalid template value offset value out of bounds.",
-							 function );
+					return( -1 );
+				}
+			}
+		}
+		parse_element->number_of_reported_elements = number_of_elements;
+	}
+	return( 1 );
+}
 
-							goto on_error;
-						}
-						if( libfwevt_xml_document_read_cdata_section(
-						     internal_xml_document,
-						     xml_sub_token,
-						     binary_data,
-						     binary_data_size,
-						     binary_data_offset + xml_document_data_offset,
-						     element_xml_tag,
-						     ascii_codepage,
-						     error ) != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_IO,
-							 LIBCERROR_IO_ERROR_READ_FAILED,
-							 "%s: unable to read CDATA section.",
-							 function );
+/* Pops the element that is being parsed and reports its end
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_pop_parse_element(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     uint8_t is_omitted,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_document_parse_state_t *parse_state = NULL;
+	static char *function                            = "libfwevt_xml_document_pop_parse_element";
+	int element_index                                = 0;
+	int node_index                                   = 0;
+	int result                                       = 0;
 
-							goto on_error;
-						}
-						break;
+	if( internal_xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
+		 function );
 
-					case LIBFWEVT_XML_TOKEN_PI_TARGET:
-						if( template_value_offset != 0 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-							 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-							 "%s: invalid template value offset value out of bounds.",
-							 function );
+		return( -1 );
+	}
+	if( internal_xml_document->parse_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid binary XML document - missing parse state.",
+		 function );
 
-							goto on_error;
-						}
-						if( libfwevt_xml_document_read_pi_target(
-						     internal_xml_document,
-						     xml_sub_token,
-						     binary_data,
-						     binary_data_size,
-						     binary_data_offset + xml_document_data_offset,
-						     flags,
-						     element_xml_tag,
-						     ascii_codepage,
-						     error ) != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_IO,
-							 LIBCERROR_IO_ERROR_READ_FAILED,
-							 "%s: unable to read PI target.",
-							 function );
+		return( -1 );
+	}
+	parse_state = internal_xml_document->parse_state;
 
-							goto on_error;
-						}
-						break;
+	if( ( parse_state->number_of_elements <= 0 )
+	 || ( parse_state->number_of_elements > ( LIBFWEVT_XML_DOCUMENT_ELEMENT_RECURSION_DEPTH + 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid parse state - number of elements value out of bounds.",
+		 function );
 
-					case LIBFWEVT_XML_TOKEN_CHARACTER_REFERENCE:
-						if( template_value_offset != 0 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-							 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-							 "%s: invalid template value offset value out of bounds.",
-							 function );
+		return( -1 );
+	}
+	element_index = parse_state->number_of_elements - 1;
 
-							goto on_error;
-						}
-						if( libfwevt_xml_document_read_character_reference(
-						     internal_xml_document,
-						     xml_sub_token,
-						     binary_data,
-						     binary_data_size,
-						     binary_data_offset + xml_document_data_offset,
-						     element_xml_tag,
-						     ascii_codepage,
-						     error ) != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_IO,
-							 LIBCERROR_IO_ERROR_READ_FAILED,
-							 "%s: unable to read character reference.",
-							 function );
+	if( is_omitted == 0 )
+	{
+		if( libfwevt_xml_document_start_parse_elements(
+		     internal_xml_document,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to report start of elements.",
+			 function );
 
-							goto on_error;
-						}
-						break;
+			return( -1 );
+		}
+	}
+	/* The end of an omitted element is reported if its start was reported
+	 */
+	if( ( element_index < parse_state->number_of_started_elements )
+	 && ( parse_state->end_element_callback != NULL ) )
+	{
+		if( parse_state->end_element_callback(
+		     parse_state->elements[ element_index ].name_data,
+		     parse_state->elements[ element_index ].name_data_size,
+		     parse_state->callback_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to report end of element: %d.",
+			 function,
+			 element_index );
 
-					case LIBFWEVT_XML_TOKEN_ENTITY_REFERENCE:
-						if( template_value_offset != 0 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-							 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-							 "%s: invalid template value offset value out of bounds.",
-							 function );
+			return( -1 );
+		}
+	}
+	if( ( parse_state->tree != NULL )
+	 && ( element_index < parse_state->number_of_started_elements ) )
+	{
+		node_index = parse_state->elements[ element_index ].node_index;
 
-							goto on_error;
-						}
-						if( libfwevt_xml_document_read_entity_reference(
-						     internal_xml_document,
-						     xml_sub_token,
-						     binary_data,
-						     binary_data_size,
-						     binary_data_offset + xml_document_data_offset,
-						     flags,
-						     element_xml_tag,
-						     ascii_codepage,
-						     error ) != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_IO,
-							 LIBCERROR_IO_ERROR_READ_FAILED,
-							 "%s: unable to read entity reference.",
-							 function );
-
-							goto on_error;
-						}
-						break;
-
-					case LIBFWEVT_XML_TOKEN_VALUE:
-						if( template_value_offset != 0 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-							 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-							 "%s: invalid template value offset value out of bounds.",
-							 function );
-
-							goto on_error;
-						}
-						if( libfwevt_xml_document_read_value(
-						     internal_xml_document,
-						     xml_sub_token,
-						     binary_data,
-						     binary_data_size,
-						     binary_data_offset + xml_document_data_offset,
-						     element_xml_tag,
-						     ascii_codepage,
-						     error ) != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_IO,
-							 LIBCERROR_IO_ERROR_READ_FAILED,
-							 "%s: unable to read value.",
-							 function );
-
-							goto on_error;
-						}
-						break;
-
-					case LIBFWEVT_XML_TOKEN_NORMAL_SUBSTITUTION:
-						result = libfwevt_xml_document_read_normal_substitution(
-							  internal_xml_document,
-							  xml_sub_token,
-							  binary_data,
-							  binary_data_size,
-							  binary_data_offset + xml_document_data_offset,
-							  ascii_codepage,
-							  flags,
-							  template_values_array,
-							  &template_value_offset,
-							  element_xml_tag,
-							  element_recursion_depth,
-							  template_instance_recursion_depth,
-							  error );
-
-						if( result == -1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_IO,
-							 LIBCERROR_IO_ERROR_READ_FAILED,
-							 "%s: unable to read normal substitution.",
-							 function );
-
-							goto on_error;
-						}
-						break;
-
-					case LIBFWEVT_XML_TOKEN_OPTIONAL_SUBSTITUTION:
-						result = libfwevt_xml_document_read_optional_substitution(
-							  internal_xml_document,
-							  xml_sub_token,
-							  binary_data,
-							  binary_data_size,
-							  binary_data_offset + xml_document_data_offset,
-							  ascii_codepage,
-							  flags,
-							  template_values_array,
-							  &template_value_offset,
-							  element_xml_tag,
-						          element_recursion_depth,
-							  template_instance_recursion_depth,
-							  error );
-
-						if( result == -1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_IO,
-							 LIBCERROR_IO_ERROR_READ_FAILED,
-							 "%s: unable to read optional substitution.",
-							 function );
-
-							goto on_error;
-						}
-						break;
-
-					default:
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-						 "%s: invalid binary XML sub token - unsupported type: 0x%02" PRIx8 ".",
-						 function,
-						 xml_sub_token->type );
-
-						goto on_error;
-				}
-				xml_document_data_offset += xml_sub_token->size;
-
-				if( element_size < xml_sub_token->size )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: invalid element size value too small.",
-					 function );
-
-					goto on_error;
-				}
-				element_size -= (uint32_t) xml_sub_token->size;
-
-				if( ( xml_sub_token->type == LIBFWEVT_XML_TOKEN_CLOSE_EMPTY_ELEMENT_TAG )
-				 || ( xml_sub_token->type == LIBFWEVT_XML_TOKEN_END_ELEMENT_TAG ) )
-				{
-					break;
-				}
-			}
-		}
-		else if( xml_sub_token->type == LIBFWEVT_XML_TOKEN_CLOSE_EMPTY_ELEMENT_TAG )
-		{
-			result = 1;
-		}
-		if( element_size > 0 )
+		/* An omitted element and a top level element other than the root
+		 * are removed from the XML tree together with their sub nodes
+		 */
+		if( ( is_omitted != 0 )
+		 || ( ( element_index == 0 )
+		  &&  ( node_index != 0 ) ) )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid element size value out of bounds.",
-			 function );
-
-			goto on_error;
+			result = libfwevt_xml_tree_truncate(
+			          parse_state->tree,
+			          node_index,
+			          error );
 		}
-		if( result != 0 )
+		else
 		{
-			if( xml_tag != NULL )
-			{
-				if( libfwevt_xml_tag_append_element(
-				     xml_tag,
-				     element_xml_tag,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-					 "%s: unable to append element to XML tag.",
-					 function );
-
-					goto on_error;
-				}
-				element_xml_tag = NULL;
-			}
-			else if( internal_xml_document->root_xml_tag == NULL )
-			{
-				internal_xml_document->root_xml_tag = element_xml_tag;
-
-				element_xml_tag = NULL;
-			}
+			result = libfwevt_xml_tree_set_node_value(
+			          parse_state->tree,
+			          node_index,
+			          (libfwevt_internal_xml_tag_t *) parse_state->elements[ element_index ].xml_tag,
+			          error );
 		}
-		template_value_array_recursion_depth++;
-	}
-	while( template_value_offset > 0 );
-
-	xml_token->size = xml_document_data_offset;
-
-	if( element_xml_tag != NULL )
-	{
-		if( libfwevt_internal_xml_tag_free(
-		     (libfwevt_internal_xml_tag_t **) &element_xml_tag,
-		     error ) != 1 )
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free element XML tag.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set element: %d node.",
+			 function,
+			 element_index );
 
-			goto on_error;
+			return( -1 );
 		}
 	}
-	if( libfwevt_xml_token_free(
-	     &xml_sub_token,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free binary XML sub token.",
-		 function );
+	parse_state->elements[ element_index ].name_data  = NULL;
+	parse_state->elements[ element_index ].xml_tag    = NULL;
+	parse_state->elements[ element_index ].node_index = -1;
 
-		goto on_error;
-	}
-	return( 1 );
+	parse_state->number_of_elements = element_index;
 
-on_error:
-	if( ( element_xml_tag != NULL )
-	 && ( element_xml_tag != internal_xml_document->root_xml_tag ) )
-	{
-		libfwevt_internal_xml_tag_free(
-		 (libfwevt_internal_xml_tag_t **) &element_xml_tag,
-		 NULL );
-	}
-	if( xml_sub_token != NULL )
+	if( parse_state->number_of_started_elements > element_index )
 	{
-		libfwevt_xml_token_free(
-		 &xml_sub_token,
-		 NULL );
+		parse_state->number_of_started_elements = element_index;
 	}
-	return( -1 );
+	return( 1 );
 }
 
-/* Reads an entity reference from a binary XML document
+/* Reads a binary XML document with template values
  * Returns 1 if successful or -1 on error
  */
-int libfwevt_xml_document_read_entity_reference(
-     libfwevt_internal_xml_document_t *internal_xml_document,
-     libfwevt_xml_token_t *xml_token,
+int libfwevt_xml_document_read_with_template_values(
+     libfwevt_xml_document_t *xml_document,
      const uint8_t *binary_data,
      size_t binary_data_size,
      size_t binary_data_offset,
+     int ascii_codepage,
      uint8_t flags,
-     libfwevt_xml_tag_t *xml_tag,
-     int ascii_codepage LIBFWEVT_ATTRIBUTE_UNUSED,
+     libcdata_array_t *template_values_array,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *entity_xml_tag = NULL;
-	uint8_t *entity_name               = NULL;
-	uint8_t *entity_value_utf16_stream = NULL;
-	const uint8_t *xml_document_data   = NULL;
-	static char *function              = "libfwevt_xml_document_read_entity_reference";
-	size_t additional_value_size       = 0;
-	size_t trailing_data_size          = 0;
-	size_t utf8_string_size            = 0;
-	size_t xml_document_data_offset    = 0;
-	size_t xml_document_data_size      = 0;
-	uint32_t entity_name_offset        = 0;
-	uint32_t entity_name_size          = 0;
-	uint8_t entity_name_match          = 0;
-	int data_segment_index             = 0;
-
-	LIBFWEVT_UNREFERENCED_PARAMETER( ascii_codepage )
+	libfwevt_internal_xml_document_t *internal_xml_document = NULL;
+	libfwevt_xml_token_t *xml_token                         = NULL;
+	static char *function                                   = "libfwevt_xml_document_read_with_template_values";
+	uint8_t supported_flags                                 = 0;
 
-	if( internal_xml_document == NULL )
+	if( xml_document == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -2605,26 +3104,16 @@ int libfwevt_xml_document_read_entity_reference(
 
 		return( -1 );
 	}
-	if( xml_token == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid binary XML token.",
-		 function );
+	internal_xml_document = (libfwevt_internal_xml_document_t *) xml_document;
 
-		return( -1 );
-	}
-	if( ( xml_token->type & 0xbf ) != LIBFWEVT_XML_TOKEN_ENTITY_REFERENCE )
+	if( internal_xml_document->root_xml_tag != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid binary XML token - unsupported type: 0x%02" PRIx8 ".",
-		 function,
-		 xml_token->type );
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid binary XML document - root XML tag already set.",
+		 function );
 
 		return( -1 );
 	}
@@ -2661,617 +3150,6122 @@ int libfwevt_xml_document_read_entity_reference(
 
 		return( -1 );
 	}
-	if( xml_tag == NULL )
+	supported_flags = LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS
+	                | LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DEPENDENCY_IDENTIFIERS
+	                | LIBFWEVT_XML_DOCUMENT_READ_FLAG_USE_ARENA
+	                | LIBFWEVT_XML_DOCUMENT_READ_FLAG_BORROW_DATA;
+
+	if( ( flags & ~( supported_flags ) ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid XML tag.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
+		 function,
+		 flags );
 
 		return( -1 );
 	}
-	if( ( flags & LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS ) != 0 )
+	if( ( flags & LIBFWEVT_XML_DOCUMENT_READ_FLAG_BORROW_DATA ) != 0 )
 	{
-		additional_value_size = 4;
+		internal_xml_document->data_segment_flags = LIBFWEVT_DATA_SEGMENT_FLAG_BORROW_DATA;
 	}
-	xml_document_data      = &( binary_data[ binary_data_offset ] );
-	xml_document_data_size = binary_data_size - binary_data_offset;
-
-	if( xml_document_data_size < ( 1 + additional_value_size ) )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid binary XML document data size value too small.",
-		 function );
-
-		goto on_error;
+		internal_xml_document->data_segment_flags = 0;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( ( flags & LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS ) != 0 )
 	{
-		libcnotify_printf(
-		 "%s: data offset\t\t: 0x%08" PRIzx "\n",
-		 function,
-		 binary_data_offset );
+		if( internal_xml_document->name_table == NULL )
+		{
+			if( libfwevt_xml_name_table_initialize(
+			     &( internal_xml_document->name_table ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create name table.",
+				 function );
 
-		libcnotify_printf(
-		 "%s: entity reference data:\n",
-		 function );
-		libcnotify_print_data(
-		 xml_document_data,
-		 1 + additional_value_size,
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-	}
-#endif
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: type\t\t\t: 0x%02" PRIx8 "\n",
-		 function,
-		 xml_document_data[ 0 ] );
-	}
-#endif
-	xml_token->size          = 1;
-	xml_document_data_offset = 1;
+				return( -1 );
+			}
+		}
+		/* The name table is only emptied when no XML tags refer to its names
+		 */
+		else if( libfwevt_xml_name_table_is_full(
+		          internal_xml_document->name_table,
+		          NULL ) == 1 )
+		{
+			if( libfwevt_xml_name_table_empty(
+			     internal_xml_document->name_table,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to empty name table.",
+				 function );
 
-	if( ( flags & LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS ) == 0 )
-	{
-		entity_name_offset = (uint32_t) ( binary_data_offset + xml_document_data_offset );
+				return( -1 );
+			}
+		}
 	}
-	else
+	if( ( ( flags & LIBFWEVT_XML_DOCUMENT_READ_FLAG_USE_ARENA ) != 0 )
+	 && ( internal_xml_document->arena == NULL ) )
 	{
-		if( ( xml_document_data_size < 4 )
-		 || ( xml_document_data_offset >= ( xml_document_data_size - 4 ) ) )
+		if( libfwevt_arena_initialize(
+		     &( internal_xml_document->arena ),
+		     LIBFWEVT_XML_DOCUMENT_ARENA_BLOCK_SIZE,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid binary XML document data size value too small.",
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create arena.",
 			 function );
 
-			goto on_error;
-		}
-		byte_stream_copy_to_uint32_little_endian(
-		 &( xml_document_data[ xml_document_data_offset ] ),
-		 entity_name_offset );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: name offset\t\t: 0x%08" PRIx32 "\n",
-			 function,
-			 entity_name_offset );
+			return( -1 );
 		}
-#endif
-		xml_token->size          += 4;
-		xml_document_data_offset += 4;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "\n" );
 	}
-#endif
-	if( entity_name_offset > ( binary_data_offset + xml_document_data_offset ) )
+	if( libfwevt_xml_token_initialize(
+	     &xml_token,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid entity name offset value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create binary XML token.",
 		 function );
 
 		goto on_error;
 	}
-	if( ( binary_data_offset + xml_document_data_offset ) < entity_name_offset )
+	while( binary_data_offset < binary_data_size )
 	{
-		trailing_data_size = entity_name_offset - ( binary_data_offset + xml_document_data_offset );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		if( libfwevt_xml_token_read_data(
+		     xml_token,
+		     binary_data,
+		     binary_data_size,
+		     binary_data_offset,
+		     error ) != 1 )
 		{
-			libcnotify_printf(
-			 "%s: data offset\t\t: 0x%08" PRIzx "\n",
-			 function,
-			 binary_data_offset + xml_document_data_offset );
-
-			libcnotify_printf(
-			 "%s: trailing data:\n",
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read binary XML token.",
 			 function );
-			libcnotify_print_data(
-			 &( xml_document_data[ xml_document_data_offset ] ),
-			 trailing_data_size,
-			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+
+			goto on_error;
 		}
+/* TODO check for prologue */
+/* TODO validate the order */
+/* TODO check for Miscellaneous before end of file token */
+		switch( xml_token->type & 0xbf )
+		{
+			case LIBFWEVT_XML_TOKEN_END_OF_FILE:
+				if( ( binary_data_size < 1 )
+				 || ( binary_data_offset >= ( binary_data_size - 1 ) ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid binary XML document data size value too small.",
+					 function );
+
+					goto on_error;
+				}
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: data offset\t\t: 0x%08" PRIzx "\n",
+					 function,
+					 binary_data_offset );
+
+					libcnotify_printf(
+					 "%s: end of file data:\n",
+					 function );
+					libcnotify_print_data(
+					 &( binary_data[ binary_data_offset ] ),
+					 1,
+					 0 );
+				}
 #endif
-		xml_token->size          += trailing_data_size;
-		xml_document_data_offset += trailing_data_size;
-	}
-	if( libfwevt_xml_tag_initialize(
-	     &entity_xml_tag,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create entity XML tag.",
-		 function );
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: type\t\t\t: 0x%02" PRIx8 "\n",
+					 function,
+					 binary_data[ binary_data_offset ] );
 
-		goto on_error;
-	}
-	if( libfwevt_xml_document_read_name(
-	     internal_xml_document,
-	     binary_data,
-	     binary_data_size,
-	     entity_name_offset,
-	     flags,
-	     &entity_name_size,
-	     entity_xml_tag,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read entity name.",
-		 function );
+					libcnotify_printf(
+					 "\n" );
+				}
+#endif
+				xml_token->size = 1;
 
-		goto on_error;
-	}
-	if( ( binary_data_offset + xml_document_data_offset ) == entity_name_offset )
-	{
-		xml_token->size += entity_name_size;
+				break;
+
+			case LIBFWEVT_XML_TOKEN_FRAGMENT_HEADER:
+				if( libfwevt_xml_document_read_fragment(
+				     internal_xml_document,
+				     xml_token,
+				     binary_data,
+				     binary_data_size,
+				     binary_data_offset,
+				     ascii_codepage,
+				     flags,
+				     template_values_array,
+				     internal_xml_document->root_xml_tag,
+				     0,
+				     0,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read fragment header.",
+					 function );
+
+					goto on_error;
+				}
+				break;
+
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: invalid binary XML token - unsupported type: 0x%02" PRIx8 ".",
+				 function,
+				 xml_token->type );
+
+				goto on_error;
+		}
+		internal_xml_document->size += xml_token->size;
+		binary_data_offset          += xml_token->size;
+
+		if( xml_token->type == LIBFWEVT_XML_TOKEN_END_OF_FILE )
+		{
+			break;
+		}
 	}
-	if( libfwevt_xml_tag_get_utf8_name_size(
-	     entity_xml_tag,
-	     &utf8_string_size,
+	if( libfwevt_xml_token_free(
+	     &xml_token,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 string size of entity name.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free binary XML token.",
 		 function );
 
 		goto on_error;
 	}
-	if( ( utf8_string_size == 0 )
-	 || ( utf8_string_size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint8_t ) ) ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid UTF-8 string size value out of bounds.",
-		 function );
+	return( 1 );
 
-		goto on_error;
+on_error:
+	if( xml_token != NULL )
+	{
+		libfwevt_xml_token_free(
+		 &xml_token,
+		 NULL );
 	}
-	entity_name = (uint8_t *) memory_allocate(
-	                           sizeof( uint8_t ) * utf8_string_size );
+	return( -1 );
+}
 
-	if( entity_name == NULL )
+/* Reads an attribute from a binary XML document
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_read_attribute(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     libfwevt_xml_token_t *xml_token,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     int ascii_codepage,
+     uint8_t flags,
+     libcdata_array_t *template_values_array,
+     libfwevt_xml_tag_t *xml_tag,
+     int element_recursion_depth,
+     int template_instance_recursion_depth,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *attribute_xml_tag    = NULL;
+	libfwevt_xml_token_t *xml_sub_token      = NULL;
+	const uint8_t *xml_document_data         = NULL;
+	static char *function                    = "libfwevt_xml_document_read_attribute";
+	size_t additional_value_size             = 0;
+	size_t template_value_offset             = 0;
+	size_t trailing_data_size                = 0;
+	size_t xml_document_data_offset          = 0;
+	size_t xml_document_data_size            = 0;
+	uint32_t attribute_name_offset           = 0;
+	uint32_t attribute_name_size             = 0;
+	int result                               = 0;
+	int template_value_array_recursion_depth = 0;
+
+	if( internal_xml_document == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create entity name.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfwevt_xml_tag_get_utf8_name(
-	     entity_xml_tag,
-	     entity_name,
-	     utf8_string_size,
-	     error ) != 1 )
+	if( xml_token == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-		 "%s: unable to copy entity name to UTF-16 string.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML token.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfwevt_xml_tag_set_value_type(
-	     xml_tag,
-	     LIBFWEVT_VALUE_TYPE_STRING_UTF16,
-	     error ) != 1 )
+	if( ( xml_token->type & 0xbf ) != LIBFWEVT_XML_TOKEN_ATTRIBUTE )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set value type.",
-		 function );
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid binary XML token - unsupported type: 0x%02" PRIx8 ".",
+		 function,
+		 xml_token->type );
 
-		goto on_error;
+		return( -1 );
 	}
-	/* Make sure the character value data is in UTF-16 litte-endian
-	 */
-	entity_value_utf16_stream = (uint8_t *) memory_allocate(
-	                                         sizeof( uint8_t ) * 4 );
-
-	if( entity_value_utf16_stream == NULL )
+	if( binary_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create entity value UTF-16 stream.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary data.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( utf8_string_size == 3 )
+	if( binary_data_size > (size_t) SSIZE_MAX )
 	{
-		if( ( entity_name[ 0 ] == (uint8_t) 'g' )
-		 && ( entity_name[ 1 ] == (uint8_t) 't' ) )
-		{
-			entity_value_utf16_stream[ 0 ] = (uint8_t) '>';
-			entity_value_utf16_stream[ 1 ] = 0;
-
-			entity_name_match = 1;
-		}
-		else if( ( entity_name[ 0 ] == (uint8_t) 'l' )
-		      && ( entity_name[ 1 ] == (uint8_t) 't' ) )
-		{
-			entity_value_utf16_stream[ 0 ] = (uint8_t) '<';
-			entity_value_utf16_stream[ 1 ] = 0;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid binary XML document data size value exceeds maximum.",
+		 function );
 
-			entity_name_match = 1;
-		}
+		return( -1 );
 	}
-	else if( utf8_string_size == 4 )
+	if( binary_data_offset >= binary_data_size )
 	{
-		if( ( entity_name[ 0 ] == (uint8_t) 'a' )
-		 && ( entity_name[ 1 ] == (uint8_t) 'm' )
-		 && ( entity_name[ 2 ] == (uint8_t) 'p' ) )
-		{
-			entity_value_utf16_stream[ 0 ] = (uint8_t) '&';
-			entity_value_utf16_stream[ 1 ] = 0;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid binary data offset value out of bounds.",
+		 function );
 
-			entity_name_match = 1;
-		}
+		return( -1 );
 	}
-	else if( utf8_string_size == 5 )
+	if( ( flags & LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS ) != 0 )
 	{
-		if( ( entity_name[ 0 ] == (uint8_t) 'a' )
-		 && ( entity_name[ 1 ] == (uint8_t) 'p' )
-		 && ( entity_name[ 2 ] == (uint8_t) 'o' )
-		 && ( entity_name[ 3 ] == (uint8_t) 's' ) )
-		{
-			entity_value_utf16_stream[ 0 ] = (uint8_t) '\'';
-			entity_value_utf16_stream[ 1 ] = 0;
+		additional_value_size = 4;
 
-			entity_name_match = 1;
-		}
-		else if( ( entity_name[ 0 ] == (uint8_t) 'q' )
-		      && ( entity_name[ 1 ] == (uint8_t) 'u' )
-		      && ( entity_name[ 2 ] == (uint8_t) 'o' )
-		      && ( entity_name[ 3 ] == (uint8_t) 't' ) )
+		if( ( binary_data_size < 4 )
+		 || ( binary_data_offset > ( binary_data_size - 4 ) ) )
 		{
-			entity_value_utf16_stream[ 0 ] = (uint8_t) '"';
-			entity_value_utf16_stream[ 1 ] = 0;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid binary data offset value out of bounds.",
+			 function );
 
-			entity_name_match = 1;
+			return( -1 );
 		}
 	}
-	if( entity_name_match == 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported entity name: %s\n",
-		 function,
-		 entity_name );
-
-		goto on_error;
-	}
-	entity_value_utf16_stream[ 2 ] = 0;
-	entity_value_utf16_stream[ 3 ] = 0;
-
-	memory_free(
-	 entity_name );
-
-	entity_name = NULL;
+	xml_document_data      = &( binary_data[ binary_data_offset ] );
+	xml_document_data_size = binary_data_size - binary_data_offset;
 
-	if( libfwevt_xml_tag_append_value_data(
-	     xml_tag,
-	     entity_value_utf16_stream,
-	     4,
-	     &data_segment_index,
+	if( libfwevt_xml_token_initialize(
+	     &xml_sub_token,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append value data.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create binary XML sub token.",
 		 function );
 
 		goto on_error;
 	}
-	memory_free(
-	 entity_value_utf16_stream );
-
-	entity_value_utf16_stream = NULL;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	do
 	{
-		if( libfwevt_xml_tag_debug_print_value_data_segment(
-		     xml_tag,
-		     data_segment_index,
-		     0,
-		     ascii_codepage,
-		     error ) != 1 )
+		if( ( template_value_array_recursion_depth < 0 )
+		 || ( template_value_array_recursion_depth > LIBFWEVT_XML_DOCUMENT_TEMPLATE_VALUE_ARRAY_RECURSION_DEPTH ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print value data segment: %d.",
-			 function,
-			 data_segment_index );
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid template value array recursion depth value out of bounds.",
+			 function );
 
 			goto on_error;
 		}
-	}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-
-	if( libfwevt_internal_xml_tag_free(
-	     (libfwevt_internal_xml_tag_t **) &entity_xml_tag,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free entity XML tag.",
-		 function );
+		if( ( xml_document_data_size < ( additional_value_size + 1 ) )
+		 || ( xml_document_data_offset > ( xml_document_data_size - ( additional_value_size + 1 ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid binary XML document data size value too small.",
+			 function );
 
-		goto on_error;
-	}
-	return( 1 );
+			goto on_error;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: data offset\t\t\t: 0x%08" PRIzx "\n",
+			 function,
+			 binary_data_offset + xml_document_data_offset );
 
-on_error:
-	if( entity_value_utf16_stream != NULL )
-	{
-		memory_free(
-		 entity_value_utf16_stream );
-	}
-	if( entity_name != NULL )
-	{
-		memory_free(
-		 entity_name );
-	}
-	if( entity_xml_tag != NULL )
-	{
-		libfwevt_internal_xml_tag_free(
-		 (libfwevt_internal_xml_tag_t **) &entity_xml_tag,
-		 NULL );
-	}
-	return( -1 );
-}
-
-/* Reads a fragment from a binary XML document
- * Returns 1 if successful or -1 on error
- */
-int libfwevt_xml_document_read_fragment(
-     libfwevt_internal_xml_document_t *internal_xml_document,
-     libfwevt_xml_token_t *xml_token,
-     const uint8_t *binary_data,
-     size_t binary_data_size,
-     size_t binary_data_offset,
-     int ascii_codepage,
-     uint8_t flags,
-     libcdata_array_t *template_values_array,
-     libfwevt_xml_tag_t *xml_tag,
-     int element_recursion_depth,
-     int template_instance_recursion_depth,
-     libcerror_error_t **error )
-{
-	libfwevt_xml_token_t *xml_sub_token = NULL;
-	static char *function               = "libfwevt_xml_document_read_fragment";
-
-	if( internal_xml_document == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid binary XML document.",
-		 function );
-
-		return( -1 );
-	}
-	if( xml_token == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid binary XML token.",
-		 function );
-
-		return( -1 );
-	}
-	if( libfwevt_xml_document_read_fragment_header(
-	     internal_xml_document,
-	     xml_token,
-	     binary_data,
-	     binary_data_size,
-	     binary_data_offset,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read fragment header.",
-		 function );
-
-		goto on_error;
-	}
-	binary_data_offset += xml_token->size;
-
-	if( libfwevt_xml_token_initialize(
-	     &xml_sub_token,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create binary XML sub token.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfwevt_xml_token_read_data(
-	     xml_sub_token,
-	     binary_data,
-	     binary_data_size,
-	     binary_data_offset,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read binary XML sub token.",
-		 function );
+			libcnotify_printf(
+			 "%s: attribute data:\n",
+			 function );
+			libcnotify_print_data(
+			 &( xml_document_data[ xml_document_data_offset ] ),
+			 additional_value_size + 1,
+			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+		}
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: type\t\t\t\t: 0x%02" PRIx8 "\n",
+			 function,
+			 xml_document_data[ xml_document_data_offset ] );
+		}
+#endif
+		xml_document_data_offset += 1;
 
-		goto on_error;
-	}
-	switch( xml_sub_token->type & 0xbf )
-	{
-		case LIBFWEVT_XML_TOKEN_OPEN_START_ELEMENT_TAG:
-			if( libfwevt_xml_document_read_element(
-			     internal_xml_document,
-			     xml_sub_token,
-			     binary_data,
-			     binary_data_size,
-			     binary_data_offset,
-			     ascii_codepage,
-			     flags,
-			     template_values_array,
-			     xml_tag,
-			     element_recursion_depth + 1,
-			     template_instance_recursion_depth,
-			     error ) != 1 )
+		if( ( flags & LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS ) == 0 )
+		{
+			attribute_name_offset = (uint32_t) ( binary_data_offset + xml_document_data_offset );
+		}
+		else
+		{
+			if( ( xml_document_data_size < 4 )
+			 || ( xml_document_data_offset >= ( xml_document_data_size - 4 ) ) )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read element.",
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid binary XML document data size value too small.",
 				 function );
 
 				goto on_error;
 			}
-			break;
+			byte_stream_copy_to_uint32_little_endian(
+			 &( xml_document_data[ xml_document_data_offset ] ),
+			 attribute_name_offset );
 
-		case LIBFWEVT_XML_TOKEN_TEMPLATE_INSTANCE:
-			if( libfwevt_xml_document_read_template_instance(
-			     internal_xml_document,
-			     xml_sub_token,
-			     binary_data,
-			     binary_data_size,
-			     binary_data_offset,
-			     ascii_codepage,
-			     flags,
-			     xml_tag,
-			     element_recursion_depth,
-			     template_instance_recursion_depth + 1,
-			     error ) != 1 )
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
 			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_IO,
-				 LIBCERROR_IO_ERROR_READ_FAILED,
-				 "%s: unable to read document template instance.",
-				 function );
-
-				goto on_error;
+				libcnotify_printf(
+				 "%s: name offset\t\t\t: 0x%08" PRIx32 "\n",
+				 function,
+				 attribute_name_offset );
 			}
-			break;
-
-		default:
+#endif
+			xml_document_data_offset += 4;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif
+		if( attribute_name_offset > ( binary_data_offset + xml_document_data_offset ) )
+		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: invalid binary XML token - unsupported type: 0x%02" PRIx8 ".",
-			 function,
-			 xml_sub_token->type );
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid attribute data offset value out of bounds.",
+			 function );
 
 			goto on_error;
-	}
-	xml_token->size += xml_sub_token->size;
-
-	if( libfwevt_xml_token_free(
-	     &xml_sub_token,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free binary XML sub token.",
-		 function );
-
-		goto on_error;
-	}
-	return( 1 );
-
-on_error:
-	if( xml_sub_token != NULL )
-	{
-		libfwevt_xml_token_free(
-		 &xml_sub_token,
-		 NULL );
-	}
-	return( -1 );
-}
-
-/* Reads a fragment header from a binary XML document
- * Returns 1 if successful or -1 on error
- */
-int libfwevt_xml_document_read_fragment_header(
-     libfwevt_internal_xml_document_t *internal_xml_document,
-     libfwevt_xml_token_t *xml_token,
-     const uint8_t *binary_data,
-     size_t binary_data_size,
-     size_t binary_data_offset,
-     libcerror_error_t **error )
-{
-	static char *function            = "libfwevt_xml_document_read_fragment_header";
-	size_t xml_document_data_size    = 0;
+		}
+		if( ( binary_data_offset + xml_document_data_offset ) < attribute_name_offset )
+		{
+			trailing_data_size = attribute_name_offset - ( binary_data_offset - xml_document_data_offset );
 
 #if defined( HAVE_DEBUG_OUTPUT )
-	const uint8_t *xml_document_data = NULL;
-#endif
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: data offset\t\t: 0x%08" PRIzx "\n",
+				 function,
+				 binary_data_offset + xml_document_data_offset );
 
-	if( internal_xml_document == NULL )
-	{
-		libcerror_error_set(
-		 error,
+				libcnotify_printf(
+				 "%s: trailing data:\n",
+				 function );
+				libcnotify_print_data(
+				 &( xml_document_data[ xml_document_data_offset ] ),
+				 trailing_data_size,
+				 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+			}
+#endif
+			xml_document_data_offset += trailing_data_size;
+		}
+		if( libfwevt_xml_tag_initialize_with_arena(
+		     &attribute_xml_tag,
+		     internal_xml_document->arena,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create attribute XML tag.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfwevt_xml_document_read_name(
+		     internal_xml_document,
+		     binary_data,
+		     binary_data_size,
+		     attribute_name_offset,
+		     flags,
+		     &attribute_name_size,
+		     attribute_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read attribute name.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( binary_data_offset + xml_document_data_offset ) == attribute_name_offset )
+		{
+			xml_document_data_offset += attribute_name_size;
+		}
+		if( libfwevt_xml_token_read_data(
+		     xml_sub_token,
+		     binary_data,
+		     binary_data_size,
+		     binary_data_offset + xml_document_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read binary XML sub token.",
+			 function );
+
+			goto on_error;
+		}
+		result = 1;
+
+		switch( xml_sub_token->type & 0xbf )
+		{
+			case LIBFWEVT_XML_TOKEN_VALUE:
+				if( template_value_offset != 0 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid template value offset value out of bounds.",
+					 function );
+
+					goto on_error;
+				}
+				if( libfwevt_xml_document_read_value(
+				     internal_xml_document,
+				     xml_sub_token,
+				     binary_data,
+				     binary_data_size,
+				     binary_data_offset + xml_document_data_offset,
+				     attribute_xml_tag,
+				     ascii_codepage,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read value.",
+					 function );
+
+					goto on_error;
+				}
+				break;
+
+			case LIBFWEVT_XML_TOKEN_NORMAL_SUBSTITUTION:
+				result = libfwevt_xml_document_read_normal_substitution(
+				          internal_xml_document,
+				          xml_sub_token,
+				          binary_data,
+				          binary_data_size,
+				          binary_data_offset + xml_document_data_offset,
+				          ascii_codepage,
+				          flags,
+				          template_values_array,
+				          &template_value_offset,
+				          attribute_xml_tag,
+				          element_recursion_depth,
+				          template_instance_recursion_depth,
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read normal substitution.",
+					 function );
+
+					goto on_error;
+				}
+				break;
+
+			case LIBFWEVT_XML_TOKEN_OPTIONAL_SUBSTITUTION:
+				result = libfwevt_xml_document_read_optional_substitution(
+					  internal_xml_document,
+					  xml_sub_token,
+					  binary_data,
+					  binary_data_size,
+					  binary_data_offset + xml_document_data_offset,
+					  ascii_codepage,
+					  flags,
+					  template_values_array,
+					  &template_value_offset,
+					  attribute_xml_tag,
+				          element_recursion_depth,
+				          template_instance_recursion_depth,
+					  error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read optional substitution.",
+					 function );
+
+					goto on_error;
+				}
+				break;
+
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: invalid binary XML sub token - unsupported type: 0x%02" PRIx8 ".",
+				 function,
+				 xml_sub_token->type );
+
+				goto on_error;
+		}
+		if( result != 0 )
+		{
+			if( libfwevt_xml_tag_append_attribute(
+			     xml_tag,
+			     attribute_xml_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append attribute to XML tag.",
+				 function );
+
+				goto on_error;
+			}
+			attribute_xml_tag = NULL;
+		}
+		xml_document_data_offset += xml_sub_token->size;
+
+		template_value_array_recursion_depth++;
+	}
+	while( template_value_offset > 0 );
+
+	xml_token->size = xml_document_data_offset;
+
+	if( attribute_xml_tag != NULL )
+	{
+		if( libfwevt_internal_xml_tag_free(
+		     (libfwevt_internal_xml_tag_t **) &attribute_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free attribute XML tag.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfwevt_xml_token_free(
+	     &xml_sub_token,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free binary XML sub token.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( attribute_xml_tag != NULL )
+	{
+		libfwevt_internal_xml_tag_free(
+		 (libfwevt_internal_xml_tag_t **) &attribute_xml_tag,
+		 NULL );
+	}
+	if( xml_sub_token != NULL )
+	{
+		libfwevt_xml_token_free(
+		 &xml_sub_token,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads a CDATA section from a binary XML document
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_read_cdata_section(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     libfwevt_xml_token_t *xml_token,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     libfwevt_xml_tag_t *xml_tag,
+     int ascii_codepage LIBFWEVT_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	const uint8_t *xml_document_data = NULL;
+	static char *function            = "libfwevt_xml_document_read_cdata_section";
+	size_t value_data_size           = 0;
+	size_t xml_document_data_size    = 0;
+
+	LIBFWEVT_UNREFERENCED_PARAMETER( ascii_codepage )
+
+	if( internal_xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML token.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_token->type != LIBFWEVT_XML_TOKEN_CDATA_SECTION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid binary XML token - unsupported type: 0x%02" PRIx8 ".",
+		 function,
+		 xml_token->type );
+
+		return( -1 );
+	}
+	if( binary_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary data.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid binary XML document data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data_offset >= binary_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid binary data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	xml_document_data      = &( binary_data[ binary_data_offset ] );
+	xml_document_data_size = binary_data_size - binary_data_offset;
+
+	if( xml_document_data_size < 3 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid binary XML document data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_set_type(
+	     xml_tag,
+	     LIBFWEVT_XML_TAG_TYPE_CDATA,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set XML tag type.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: data offset\t\t: 0x%08" PRIzx "\n",
+		 function,
+		 binary_data_offset );
+
+		libcnotify_printf(
+		 "%s: cdata section data:\n",
+		 function );
+		libcnotify_print_data(
+		 xml_document_data,
+		 3,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+	}
+#endif
+	byte_stream_copy_to_uint16_little_endian(
+	 &( xml_document_data[ 1 ] ),
+	 value_data_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: type\t\t\t: 0x%02" PRIx8 "\n",
+		 function,
+		 xml_document_data[ 0 ] );
+
+		libcnotify_printf(
+		 "%s: number of characters\t: %" PRIzd "\n",
+		 function,
+		 value_data_size );
+	}
+#endif
+	xml_token->size     = 3;
+	binary_data_offset += 3;
+
+	value_data_size *= 2;
+
+	if( ( value_data_size > binary_data_size )
+	 || ( binary_data_offset >= ( binary_data_size - value_data_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: data offset\t\t: 0x%08" PRIzx "\n",
+		 function,
+		 binary_data_offset );
+
+		libcnotify_printf(
+		 "%s: value data:\n",
+		 function );
+		libcnotify_print_data(
+		 &( xml_document_data[ 3 ] ),
+		 value_data_size,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+	}
+#endif
+	if( libfwevt_xml_tag_set_value_type(
+	     xml_tag,
+	     LIBFWEVT_VALUE_TYPE_STRING_UTF16,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_set_value_data(
+	     xml_tag,
+	     &( binary_data[ binary_data_offset ] ),
+	     value_data_size,
+	     internal_xml_document->data_segment_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set value data.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( libfwevt_xml_tag_debug_print_value_data_segment(
+		     xml_tag,
+		     0,
+		     0,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print value data segment: 0.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	xml_token->size += value_data_size;
+
+	return( 1 );
+}
+
+/* Reads a character entity reference from a binary XML document
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_read_character_reference(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     libfwevt_xml_token_t *xml_token,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     libfwevt_xml_tag_t *xml_tag,
+     int ascii_codepage LIBFWEVT_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *character_xml_tag     = NULL;
+	uint16_t *character_value_string          = NULL;
+	uint8_t *character_value_utf16_stream     = NULL;
+	const uint8_t *xml_document_data          = NULL;
+	static char *function                     = "libfwevt_xml_document_read_character_reference";
+	size_t character_value_string_index       = 0;
+	size_t character_value_string_size        = 0;
+	size_t character_value_utf16_stream_index = 0;
+	size_t character_value_utf16_stream_size  = 0;
+	size_t xml_document_data_size             = 0;
+	uint16_t character_value                  = 0;
+	int data_segment_index                    = 0;
+
+	LIBFWEVT_UNREFERENCED_PARAMETER( ascii_codepage )
+
+	if( internal_xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML token.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( xml_token->type & 0xbf ) != LIBFWEVT_XML_TOKEN_ENTITY_REFERENCE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid binary XML token - unsupported type: 0x%02" PRIx8 ".",
+		 function,
+		 xml_token->type );
+
+		return( -1 );
+	}
+	if( binary_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary data.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid binary XML document data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data_offset >= binary_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid binary data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	xml_document_data      = &( binary_data[ binary_data_offset ] );
+	xml_document_data_size = binary_data_size - binary_data_offset;
+
+	if( xml_document_data_size < 3 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid binary XML document data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: data offset\t\t: 0x%08" PRIzx "\n",
+		 function,
+		 binary_data_offset );
+
+		libcnotify_printf(
+		 "%s: character reference data:\n",
+		 function );
+		libcnotify_print_data(
+		 xml_document_data,
+		 3,
+		 0 );
+	}
+#endif
+	byte_stream_copy_to_uint16_little_endian(
+	 &( xml_document_data[ 1 ] ),
+	 character_value );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: type\t\t\t: 0x%02" PRIx8 "\n",
+		 function,
+		 xml_document_data[ 0 ] );
+
+		libcnotify_printf(
+		 "%s: character value\t\t: 0x%04" PRIx16 "\n",
+		 function,
+		 character_value );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	xml_token->size = 3;
+
+	if( libfwevt_integer_as_unsigned_decimal_get_string_size(
+	     (uint64_t) character_value,
+	     &character_value_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of character value string.",
+		 function );
+
+		goto on_error;
+	}
+	character_value_string_size += 3;
+
+	if( character_value_string_size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint16_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid character value string size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	character_value_string = (uint16_t *) memory_allocate(
+	                                       sizeof( uint16_t ) * character_value_string_size );
+
+	if( character_value_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create character value string.",
+		 function );
+
+		goto on_error;
+	}
+	character_value_string[ character_value_string_index++ ] = (uint16_t) '&';
+	character_value_string[ character_value_string_index++ ] = (uint16_t) '#';
+
+	if( libfwevt_integer_as_unsigned_decimal_copy_to_utf16_string_with_index(
+	     (uint64_t) character_value,
+	     character_value_string,
+	     character_value_string_size,
+	     &character_value_string_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy character value to UTF-16 string.",
+		 function );
+
+		goto on_error;
+	}
+	character_value_string[ character_value_string_size - 2 ] = (uint16_t) ';';
+	character_value_string[ character_value_string_size - 1 ] = 0;
+
+	if( libfwevt_xml_tag_set_value_type(
+	     xml_tag,
+	     LIBFWEVT_VALUE_TYPE_STRING_UTF16,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set value type.",
+		 function );
+
+		goto on_error;
+	}
+	/* Make sure the character value data is in UTF-16 litte-endian
+	 */
+	if( ( character_value_utf16_stream_size == 0 )
+	 || ( character_value_utf16_stream_size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid character value UTF-16 stream size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	character_value_utf16_stream_size = character_value_string_size * 2;
+
+	character_value_utf16_stream = (uint8_t *) memory_allocate(
+	                                            sizeof( uint8_t ) * character_value_utf16_stream_size );
+
+	if( character_value_utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create character value UTF-16 stream.",
+		 function );
+
+		goto on_error;
+	}
+	for( character_value_string_index = 0;
+	     character_value_string_index < character_value_string_size;
+	     character_value_string_index++ )
+	{
+		byte_stream_copy_from_uint16_little_endian(
+		 &( character_value_utf16_stream[ character_value_utf16_stream_index ] ),
+		 character_value_string[ character_value_string_index ] );
+
+		character_value_utf16_stream_index += 2;
+	}
+	memory_free(
+	 character_value_string );
+
+	character_value_string = NULL;
+
+	if( libfwevt_xml_tag_append_value_data(
+	     xml_tag,
+	     character_value_utf16_stream,
+	     character_value_utf16_stream_size,
+	     0,
+	     &data_segment_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value data.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 character_value_utf16_stream );
+
+	character_value_utf16_stream = NULL;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( libfwevt_xml_tag_debug_print_value_data_segment(
+		     xml_tag,
+		     data_segment_index,
+		     0,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print value data segment: %d.",
+			 function,
+			 data_segment_index );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( libfwevt_internal_xml_tag_free(
+	     (libfwevt_internal_xml_tag_t **) &character_xml_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free character XML tag.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( character_value_utf16_stream != NULL )
+	{
+		memory_free(
+		 character_value_utf16_stream );
+	}
+	if( character_value_string != NULL )
+	{
+		memory_free(
+		 character_value_string );
+	}
+	if( character_xml_tag != NULL )
+	{
+		libfwevt_internal_xml_tag_free(
+		 (libfwevt_internal_xml_tag_t **) &character_xml_tag,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads an element from a binary XML document
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_read_element(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     libfwevt_xml_token_t *xml_token,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     int ascii_codepage,
+     uint8_t flags,
+     libcdata_array_t *template_values_array,
+     libfwevt_xml_tag_t *xml_tag,
+     int element_recursion_depth,
+     int template_instance_recursion_depth,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *element_xml_tag      = NULL;
+	libfwevt_xml_token_t *xml_sub_token      = NULL;
+	const uint8_t *name_data                 = NULL;
+	const uint8_t *xml_document_data         = NULL;
+	static char *function                    = "libfwevt_xml_document_read_element";
+	size_t additional_value_size             = 0;
+	size_t element_size_offset               = 0;
+	size_t name_data_size                    = 0;
+	size_t template_value_offset             = 0;
+	size_t trailing_data_size                = 0;
+	size_t xml_document_data_offset          = 0;
+	size_t xml_document_data_size            = 0;
+	uint32_t attribute_list_size             = 0;
+	uint32_t element_name_offset             = 0;
+	uint32_t element_name_size               = 0;
+	uint32_t element_size                    = 0;
+	uint16_t name_hash                       = 0;
+	uint8_t is_filtered                      = 0;
+	int result                               = 0;
+	int template_value_array_recursion_depth = 0;
+	int template_value_index                 = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint16_t value_16bit                     = 0;
+#endif
+
+	if( internal_xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML token.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( xml_token->type & 0xbf ) != LIBFWEVT_XML_TOKEN_OPEN_START_ELEMENT_TAG )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid binary XML token - unsupported type: 0x%02" PRIx8 ".",
+		 function,
+		 xml_token->type );
+
+		return( -1 );
+	}
+	if( binary_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary data.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid binary XML document data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data_offset >= binary_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid binary data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( element_recursion_depth < 0 )
+	 || ( element_recursion_depth > LIBFWEVT_XML_DOCUMENT_ELEMENT_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid element recursion depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS ) != 0 )
+	{
+		additional_value_size = 4;
+	}
+	if( ( binary_data_size < ( 5 + additional_value_size ) )
+	 || ( binary_data_offset > ( binary_data_size - 5 - additional_value_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid binary XML document data size value too small.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_xml_token_initialize(
+	     &xml_sub_token,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create binary XML sub token.",
+		 function );
+
+		goto on_error;
+	}
+	xml_document_data      = &( binary_data[ binary_data_offset ] );
+	xml_document_data_size = binary_data_size - binary_data_offset;
+
+	do
+	{
+		if( ( template_value_array_recursion_depth < 0 )
+		 || ( template_value_array_recursion_depth > LIBFWEVT_XML_DOCUMENT_TEMPLATE_VALUE_ARRAY_RECURSION_DEPTH ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid template value array recursion depth value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		/* Note that the dependency identifier is an optional value.
+		 */
+		element_size_offset = 1;
+
+		byte_stream_copy_to_uint32_little_endian(
+		 &( xml_document_data[ element_size_offset ] ),
+		 element_size );
+
+		if( ( xml_document_data_size > 7 )
+		 && ( element_size > ( xml_document_data_size - 7 ) ) )
+		{
+			element_size_offset = 3;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: data offset\t\t\t\t: 0x%08" PRIzx "\n",
+			 function,
+			 binary_data_offset );
+
+			libcnotify_printf(
+			 "%s: element data:\n",
+			 function );
+			libcnotify_print_data(
+			 xml_document_data,
+			 element_size_offset + 4 + additional_value_size,
+			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+		}
+#endif
+		byte_stream_copy_to_uint32_little_endian(
+		 &( xml_document_data[ element_size_offset ] ),
+		 element_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: type\t\t\t\t: 0x%02" PRIx8 "\n",
+			 function,
+			 xml_document_data[ 0 ] );
+
+			if( element_size_offset == 3 )
+			{
+				byte_stream_copy_to_uint16_little_endian(
+				 &( xml_document_data[ 1 ] ),
+				 value_16bit );
+				libcnotify_printf(
+				 "%s: dependency identifier\t\t: %" PRIi16 " (0x%04" PRIx16 ")\n",
+				 function,
+				 (int16_t) value_16bit,
+				 value_16bit );
+			}
+			libcnotify_printf(
+			 "%s: size\t\t\t\t: %" PRIu32 "\n",
+			 function,
+			 element_size );
+		}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+		xml_document_data_offset = element_size_offset + 4;
+
+		/* The first 5 or 7 bytes are not included in the element size
+		 */
+		if( ( flags & LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS ) == 0 )
+		{
+			element_name_offset = (uint32_t) ( binary_data_offset + xml_document_data_offset );
+		}
+		else
+		{
+			if( xml_document_data_offset >= ( xml_document_data_size - 4 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid binary XML document data size value too small.",
+				 function );
+
+				goto on_error;
+			}
+			byte_stream_copy_to_uint32_little_endian(
+			 &( xml_document_data[ xml_document_data_offset ] ),
+			 element_name_offset );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: name offset\t\t\t\t: 0x%08" PRIx32 "\n",
+				 function,
+				 element_name_offset );
+			}
+#endif
+			xml_document_data_offset += 4;
+			element_size             -= 4;
+		}
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif
+		if( element_name_offset > ( binary_data_offset + xml_document_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid element data offset value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( binary_data_offset + xml_document_data_offset ) < element_name_offset )
+		{
+			trailing_data_size = element_name_offset - ( binary_data_offset + xml_document_data_offset );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: data offset\t\t\t\t: 0x%08" PRIzx "\n",
+				 function,
+				 binary_data_offset + xml_document_data_offset );
+
+				libcnotify_printf(
+				 "%s: trailing data:\n",
+				 function );
+				libcnotify_print_data(
+				 &( xml_document_data[ xml_document_data_offset ] ),
+				 trailing_data_size,
+				 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+			}
+#endif
+			xml_document_data_offset += trailing_data_size;
+			element_size             -= (uint32_t) trailing_data_size;
+		}
+		if( libfwevt_xml_document_read_name_data(
+		     internal_xml_document,
+		     binary_data,
+		     binary_data_size,
+		     element_name_offset,
+		     flags,
+		     &name_hash,
+		     &name_data,
+		     &name_data_size,
+		     &element_name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read element name.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( binary_data_offset + xml_document_data_offset ) == element_name_offset )
+		{
+			xml_document_data_offset += element_name_size;
+			element_size             -= element_name_size;
+		}
+		is_filtered = 0;
+
+		if( internal_xml_document->parse_state != NULL )
+		{
+			if( libfwevt_xml_document_push_parse_element(
+			     internal_xml_document,
+			     name_data,
+			     name_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push parse element.",
+				 function );
+
+				goto on_error;
+			}
+			result = libfwevt_xml_document_filter_parse_element(
+			          internal_xml_document,
+			          0,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to filter parse element.",
+				 function );
+
+				goto on_error;
+			}
+			is_filtered = (uint8_t) ( result == 0 );
+		}
+		/* No XML tag is created for an element of which the name cannot match the path filter
+		 */
+		if( is_filtered == 0 )
+		{
+			if( internal_xml_document->parse_state != NULL )
+			{
+				if( libfwevt_xml_document_get_parse_element_xml_tag(
+				     internal_xml_document,
+				     &element_xml_tag,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve parse element XML tag.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			else if( libfwevt_xml_tag_initialize_with_arena(
+			          &element_xml_tag,
+			          internal_xml_document->arena,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create element XML tag.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfwevt_xml_document_set_xml_tag_name(
+			     internal_xml_document,
+			     element_xml_tag,
+			     flags,
+			     element_name_offset,
+			     name_hash,
+			     name_data,
+			     name_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set element name.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( ( is_filtered == 0 )
+		 && ( ( xml_token->type & LIBFWEVT_XML_TOKEN_FLAG_HAS_MORE_DATA ) != 0 ) )
+		{
+			if( xml_document_data_offset >= ( xml_document_data_size - 4 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid binary XML document data size value too small.",
+				 function );
+
+				goto on_error;
+			}
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: data offset\t\t\t\t: 0x%08" PRIzx "\n",
+				 function,
+				 binary_data_offset + xml_document_data_offset );
+
+				libcnotify_printf(
+				 "%s: attribute list data:\n",
+				 function );
+				libcnotify_print_data(
+				 &( xml_document_data[ xml_document_data_offset ] ),
+				 4,
+				 0 );
+			}
+#endif
+			byte_stream_copy_to_uint32_little_endian(
+			 &( xml_document_data[ xml_document_data_offset ] ),
+			 attribute_list_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: attribute list size\t\t\t: %" PRIu32 "\n",
+				 function,
+				 attribute_list_size );
+
+				libcnotify_printf(
+				 "\n" );
+			}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+			xml_document_data_offset += 4;
+			element_size             -= 4;
+
+			if( attribute_list_size > ( binary_data_size - ( binary_data_offset + xml_document_data_offset ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid attribute list size value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			while( attribute_list_size > 0 )
+			{
+				if( libfwevt_xml_token_read_data(
+				     xml_sub_token,
+				     binary_data,
+				     binary_data_size,
+				     binary_data_offset + xml_document_data_offset,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read binary XML sub token.",
+					 function );
+
+					goto on_error;
+				}
+				if( libfwevt_xml_document_read_attribute(
+				     internal_xml_document,
+				     xml_sub_token,
+				     binary_data,
+				     binary_data_size,
+				     binary_data_offset + xml_document_data_offset,
+				     ascii_codepage,
+				     flags,
+				     template_values_array,
+				     element_xml_tag,
+				     element_recursion_depth,
+				     template_instance_recursion_depth,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read attribute.",
+					 function );
+
+					goto on_error;
+				}
+				xml_document_data_offset += xml_sub_token->size;
+				element_size             -= (uint32_t) xml_sub_token->size;
+
+				if( attribute_list_size < xml_sub_token->size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid attribute list size value too small.",
+					 function );
+
+					goto on_error;
+				}
+				attribute_list_size -= (uint32_t) xml_sub_token->size;
+			}
+		}
+		if( ( is_filtered == 0 )
+		 && ( internal_xml_document->parse_state != NULL ) )
+		{
+			result = libfwevt_xml_document_filter_parse_element(
+			          internal_xml_document,
+			          1,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to filter parse element.",
+				 function );
+
+				goto on_error;
+			}
+			is_filtered = (uint8_t) ( result == 0 );
+		}
+		if( is_filtered != 0 )
+		{
+			/* Skip the remainder of an element that cannot match the path filter
+			 */
+			if( (size_t) element_size > ( xml_document_data_size - xml_document_data_offset ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid element size value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			xml_document_data_offset += element_size;
+			element_size              = 0;
+			result                    = 0;
+		}
+		else
+		{
+			if( libfwevt_xml_token_read_data(
+			     xml_sub_token,
+			     binary_data,
+			     binary_data_size,
+			     binary_data_offset + xml_document_data_offset,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read binary XML sub token.",
+				 function );
+
+				goto on_error;
+			}
+			if( ( xml_sub_token->type != LIBFWEVT_XML_TOKEN_CLOSE_START_ELEMENT_TAG )
+			 && ( xml_sub_token->type != LIBFWEVT_XML_TOKEN_CLOSE_EMPTY_ELEMENT_TAG ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: invalid binary XML token - unsupported type: 0x%02" PRIx8 ".",
+				 function,
+				 xml_token->type );
+
+				goto on_error;
+			}
+			if( xml_document_data_offset >= xml_document_data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid binary XML document data size value too small.",
+				 function );
+
+				goto on_error;
+			}
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: data offset\t\t\t\t: 0x%08" PRIzx "\n",
+				 function,
+				 binary_data_offset + xml_document_data_offset );
+
+				libcnotify_printf(
+				 "%s: close element tag data:\n",
+				 function );
+				libcnotify_print_data(
+				 &( xml_document_data[ xml_document_data_offset ] ),
+				 1,
+				 0 );
+			}
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: type\t\t\t\t: 0x%02" PRIx8 "\n",
+				 function,
+				 xml_document_data[ xml_document_data_offset ] );
+
+				libcnotify_printf(
+				 "\n" );
+			}
+#endif
+			xml_document_data_offset += 1;
+			element_size             -= 1;
+
+			if( xml_sub_token->type == LIBFWEVT_XML_TOKEN_CLOSE_START_ELEMENT_TAG )
+			{
+				result = 1;
+
+				while( element_size > 0 )
+				{
+					if( libfwevt_xml_token_read_data(
+					     xml_sub_token,
+					     binary_data,
+					     binary_data_size,
+					     binary_data_offset + xml_document_data_offset,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_READ_FAILED,
+						 "%s: unable to read binary XML sub token.",
+						 function );
+
+						goto on_error;
+					}
+					switch( xml_sub_token->type & 0xbf )
+					{
+						case LIBFWEVT_XML_TOKEN_OPEN_START_ELEMENT_TAG:
+							if( libfwevt_xml_document_read_element(
+							     internal_xml_document,
+							     xml_sub_token,
+							     binary_data,
+							     binary_data_size,
+							     binary_data_offset + xml_document_data_offset,
+							     ascii_codepage,
+							     flags,
+							     template_values_array,
+							     element_xml_tag,
+							     element_recursion_depth + 1,
+							     template_instance_recursion_depth,
+							     error ) != 1 )
+							{
+								libcerror_error_set(
+								 error,
+								 LIBCERROR_ERROR_DOMAIN_IO,
+								 LIBCERROR_IO_ERROR_READ_FAILED,
+								 "%s: unable to read element.",
+								 function );
+
+								goto on_error;
+							}
+							break;
+
+						case LIBFWEVT_XML_TOKEN_CLOSE_EMPTY_ELEMENT_TAG:
+						case LIBFWEVT_XML_TOKEN_END_ELEMENT_TAG:
+							if( xml_document_data_offset >= xml_document_data_size )
+							{
+								libcerror_error_set(
+								 error,
+								 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+								 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+								 "%s: invalid binary XML document data size value too small.",
+								 function );
+
+								goto on_error;
+							}
+#if defined( HAVE_DEBUG_OUTPUT )
+							if( libcnotify_verbose != 0 )
+							{
+								libcnotify_printf(
+								 "%s: data offset\t\t\t\t: 0x%08" PRIzx "\n",
+								 function,
+								 binary_data_offset + xml_document_data_offset );
+
+								libcnotify_printf(
+								 "%s: end element tag data:\n",
+								 function );
+								libcnotify_print_data(
+								 &( xml_document_data[ xml_document_data_offset ] ),
+								 1,
+								 0 );
+							}
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+							if( libcnotify_verbose != 0 )
+							{
+								libcnotify_printf(
+								 "%s: type\t\t\t\t: 0x%02" PRIx8 "\n",
+								 function,
+								 xml_document_data[ xml_document_data_offset ] );
+
+								libcnotify_printf(
+								 "\n" );
+							}
+#endif
+							xml_sub_token->size = 1;
+
+							break;
+
+						case LIBFWEVT_XML_TOKEN_CDATA_SECTION:
+							if( template_value_offset != 0 )
+							{
+								libcerror_error_set(
+								 error,
+								 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+								 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+								 "%s: invalid template value offset value out of bounds.",
+								 function );
+
+								goto on_error;
+							}
+							if( libfwevt_xml_document_read_cdata_section(
+							     internal_xml_document,
+							     xml_sub_token,
+							     binary_data,
+							     binary_data_size,
+							     binary_data_offset + xml_document_data_offset,
+							     element_xml_tag,
+							     ascii_codepage,
+							     error ) != 1 )
+							{
+								libcerror_error_set(
+								 error,
+								 LIBCERROR_ERROR_DOMAIN_IO,
+								 LIBCERROR_IO_ERROR_READ_FAILED,
+								 "%s: unable to read CDATA section.",
+								 function );
+
+								goto on_error;
+							}
+							break;
+
+						case LIBFWEVT_XML_TOKEN_PI_TARGET:
+							if( template_value_offset != 0 )
+							{
+								libcerror_error_set(
+								 error,
+								 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+								 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+								 "%s: invalid template value offset value out of bounds.",
+								 function );
+
+								goto on_error;
+							}
+							if( libfwevt_xml_document_read_pi_target(
+							     internal_xml_document,
+							     xml_sub_token,
+							     binary_data,
+							     binary_data_size,
+							     binary_data_offset + xml_document_data_offset,
+							     flags,
+							     element_xml_tag,
+							     ascii_codepage,
+							     error ) != 1 )
+							{
+								libcerror_error_set(
+								 error,
+								 LIBCERROR_ERROR_DOMAIN_IO,
+								 LIBCERROR_IO_ERROR_READ_FAILED,
+								 "%s: unable to read PI target.",
+								 function );
+
+								goto on_error;
+							}
+							break;
+
+						case LIBFWEVT_XML_TOKEN_CHARACTER_REFERENCE:
+							if( template_value_offset != 0 )
+							{
+								libcerror_error_set(
+								 error,
+								 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+								 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+								 "%s: invalid template value offset value out of bounds.",
+								 function );
+
+								goto on_error;
+							}
+							if( libfwevt_xml_document_read_character_reference(
+							     internal_xml_document,
+							     xml_sub_token,
+							     binary_data,
+							     binary_data_size,
+							     binary_data_offset + xml_document_data_offset,
+							     element_xml_tag,
+							     ascii_codepage,
+							     error ) != 1 )
+							{
+								libcerror_error_set(
+								 error,
+								 LIBCERROR_ERROR_DOMAIN_IO,
+								 LIBCERROR_IO_ERROR_READ_FAILED,
+								 "%s: unable to read character reference.",
+								 function );
+
+								goto on_error;
+							}
+							break;
+
+						case LIBFWEVT_XML_TOKEN_ENTITY_REFERENCE:
+							if( template_value_offset != 0 )
+							{
+								libcerror_error_set(
+								 error,
+								 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+								 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+								 "%s: invalid template value offset value out of bounds.",
+								 function );
+
+								goto on_error;
+							}
+							if( libfwevt_xml_document_read_entity_reference(
+							     internal_xml_document,
+							     xml_sub_token,
+							     binary_data,
+							     binary_data_size,
+							     binary_data_offset + xml_document_data_offset,
+							     flags,
+							     element_xml_tag,
+							     ascii_codepage,
+							     error ) != 1 )
+							{
+								libcerror_error_set(
+								 error,
+								 LIBCERROR_ERROR_DOMAIN_IO,
+								 LIBCERROR_IO_ERROR_READ_FAILED,
+								 "%s: unable to read entity reference.",
+								 function );
+
+								goto on_error;
+							}
+							break;
+
+						case LIBFWEVT_XML_TOKEN_VALUE:
+							if( template_value_offset != 0 )
+							{
+								libcerror_error_set(
+								 error,
+								 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+								 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+								 "%s: invalid template value offset value out of bounds.",
+								 function );
+
+								goto on_error;
+							}
+							if( libfwevt_xml_document_read_value(
+							     internal_xml_document,
+							     xml_sub_token,
+							     binary_data,
+							     binary_data_size,
+							     binary_data_offset + xml_document_data_offset,
+							     element_xml_tag,
+							     ascii_codepage,
+							     error ) != 1 )
+							{
+								libcerror_error_set(
+								 error,
+								 LIBCERROR_ERROR_DOMAIN_IO,
+								 LIBCERROR_IO_ERROR_READ_FAILED,
+								 "%s: unable to read value.",
+								 function );
+
+								goto on_error;
+							}
+							break;
+
+						case LIBFWEVT_XML_TOKEN_NORMAL_SUBSTITUTION:
+							result = libfwevt_xml_document_read_normal_substitution(
+								  internal_xml_document,
+								  xml_sub_token,
+								  binary_data,
+								  binary_data_size,
+								  binary_data_offset + xml_document_data_offset,
+								  ascii_codepage,
+								  flags,
+								  template_values_array,
+								  &template_value_offset,
+								  element_xml_tag,
+								  element_recursion_depth,
+								  template_instance_recursion_depth,
+								  error );
+
+							if( result == -1 )
+							{
+								libcerror_error_set(
+								 error,
+								 LIBCERROR_ERROR_DOMAIN_IO,
+								 LIBCERROR_IO_ERROR_READ_FAILED,
+								 "%s: unable to read normal substitution.",
+								 function );
+
+								goto on_error;
+							}
+							break;
+
+						case LIBFWEVT_XML_TOKEN_OPTIONAL_SUBSTITUTION:
+							result = libfwevt_xml_document_read_optional_substitution(
+								  internal_xml_document,
+								  xml_sub_token,
+								  binary_data,
+								  binary_data_size,
+								  binary_data_offset + xml_document_data_offset,
+								  ascii_codepage,
+								  flags,
+								  template_values_array,
+								  &template_value_offset,
+								  element_xml_tag,
+							          element_recursion_depth,
+								  template_instance_recursion_depth,
+								  error );
+
+							if( result == -1 )
+							{
+								libcerror_error_set(
+								 error,
+								 LIBCERROR_ERROR_DOMAIN_IO,
+								 LIBCERROR_IO_ERROR_READ_FAILED,
+								 "%s: unable to read optional substitution.",
+								 function );
+
+								goto on_error;
+							}
+							break;
+
+						default:
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+							 "%s: invalid binary XML sub token - unsupported type: 0x%02" PRIx8 ".",
+							 function,
+							 xml_sub_token->type );
+
+							goto on_error;
+					}
+					if( ( internal_xml_document->parse_state != NULL )
+					 && ( ( xml_sub_token->type & 0xbf ) != LIBFWEVT_XML_TOKEN_OPEN_START_ELEMENT_TAG )
+					 && ( xml_sub_token->type != LIBFWEVT_XML_TOKEN_CLOSE_EMPTY_ELEMENT_TAG )
+					 && ( xml_sub_token->type != LIBFWEVT_XML_TOKEN_END_ELEMENT_TAG ) )
+					{
+						template_value_index = -1;
+
+						if( ( xml_sub_token->type == LIBFWEVT_XML_TOKEN_NORMAL_SUBSTITUTION )
+						 || ( xml_sub_token->type == LIBFWEVT_XML_TOKEN_OPTIONAL_SUBSTITUTION ) )
+						{
+							byte_stream_copy_to_uint16_little_endian(
+							 &( xml_document_data[ xml_document_data_offset + 1 ] ),
+							 template_value_index );
+						}
+						if( libfwevt_xml_document_report_parse_element_content(
+						     internal_xml_document,
+						     template_value_index,
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_GENERIC,
+							 "%s: unable to report parse element content.",
+							 function );
+
+							goto on_error;
+						}
+					}
+					xml_document_data_offset += xml_sub_token->size;
+
+					if( element_size < xml_sub_token->size )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: invalid element size value too small.",
+						 function );
+
+						goto on_error;
+					}
+					element_size -= (uint32_t) xml_sub_token->size;
+
+					if( ( xml_sub_token->type == LIBFWEVT_XML_TOKEN_CLOSE_EMPTY_ELEMENT_TAG )
+					 || ( xml_sub_token->type == LIBFWEVT_XML_TOKEN_END_ELEMENT_TAG ) )
+					{
+						break;
+					}
+				}
+			}
+			else if( xml_sub_token->type == LIBFWEVT_XML_TOKEN_CLOSE_EMPTY_ELEMENT_TAG )
+			{
+				result = 1;
+			}
+		}
+		if( element_size > 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid element size value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( internal_xml_document->parse_state != NULL )
+		{
+			if( libfwevt_xml_document_pop_parse_element(
+			     internal_xml_document,
+			     (uint8_t) ( result == 0 ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to pop parse element.",
+				 function );
+
+				goto on_error;
+			}
+			/* The XML tag of the element is owned by the parse state
+			 */
+			element_xml_tag = NULL;
+		}
+		else if( result != 0 )
+		{
+			if( xml_tag != NULL )
+			{
+				if( libfwevt_xml_tag_append_element(
+				     xml_tag,
+				     element_xml_tag,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append element to XML tag.",
+					 function );
+
+					goto on_error;
+				}
+				element_xml_tag = NULL;
+			}
+			else if( internal_xml_document->root_xml_tag == NULL )
+			{
+				internal_xml_document->root_xml_tag = element_xml_tag;
+
+				element_xml_tag = NULL;
+			}
+		}
+		template_value_array_recursion_depth++;
+	}
+	while( template_value_offset > 0 );
+
+	xml_token->size = xml_document_data_offset;
+
+	if( element_xml_tag != NULL )
+	{
+		if( libfwevt_internal_xml_tag_free(
+		     (libfwevt_internal_xml_tag_t **) &element_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free element XML tag.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfwevt_xml_token_free(
+	     &xml_sub_token,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free binary XML sub token.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( ( element_xml_tag != NULL )
+	 && ( element_xml_tag != internal_xml_document->root_xml_tag )
+	 && ( internal_xml_document->parse_state == NULL ) )
+	{
+		libfwevt_internal_xml_tag_free(
+		 (libfwevt_internal_xml_tag_t **) &element_xml_tag,
+		 NULL );
+	}
+	if( xml_sub_token != NULL )
+	{
+		libfwevt_xml_token_free(
+		 &xml_sub_token,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads an entity reference from a binary XML document
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_read_entity_reference(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     libfwevt_xml_token_t *xml_token,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     uint8_t flags,
+     libfwevt_xml_tag_t *xml_tag,
+     int ascii_codepage LIBFWEVT_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *entity_xml_tag = NULL;
+	uint8_t *entity_name               = NULL;
+	uint8_t *entity_value_utf16_stream = NULL;
+	const uint8_t *xml_document_data   = NULL;
+	static char *function              = "libfwevt_xml_document_read_entity_reference";
+	size_t additional_value_size       = 0;
+	size_t trailing_data_size          = 0;
+	size_t utf8_string_size            = 0;
+	size_t xml_document_data_offset    = 0;
+	size_t xml_document_data_size      = 0;
+	uint32_t entity_name_offset        = 0;
+	uint32_t entity_name_size          = 0;
+	uint8_t entity_name_match          = 0;
+	int data_segment_index             = 0;
+
+	LIBFWEVT_UNREFERENCED_PARAMETER( ascii_codepage )
+
+	if( internal_xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML token.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( xml_token->type & 0xbf ) != LIBFWEVT_XML_TOKEN_ENTITY_REFERENCE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid binary XML token - unsupported type: 0x%02" PRIx8 ".",
+		 function,
+		 xml_token->type );
+
+		return( -1 );
+	}
+	if( binary_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary data.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid binary XML document data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data_offset >= binary_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid binary data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS ) != 0 )
+	{
+		additional_value_size = 4;
+	}
+	xml_document_data      = &( binary_data[ binary_data_offset ] );
+	xml_document_data_size = binary_data_size - binary_data_offset;
+
+	if( xml_document_data_size < ( 1 + additional_value_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid binary XML document data size value too small.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: data offset\t\t: 0x%08" PRIzx "\n",
+		 function,
+		 binary_data_offset );
+
+		libcnotify_printf(
+		 "%s: entity reference data:\n",
+		 function );
+		libcnotify_print_data(
+		 xml_document_data,
+		 1 + additional_value_size,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+	}
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: type\t\t\t: 0x%02" PRIx8 "\n",
+		 function,
+		 xml_document_data[ 0 ] );
+	}
+#endif
+	xml_token->size          = 1;
+	xml_document_data_offset = 1;
+
+	if( ( flags & LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS ) == 0 )
+	{
+		entity_name_offset = (uint32_t) ( binary_data_offset + xml_document_data_offset );
+	}
+	else
+	{
+		if( ( xml_document_data_size < 4 )
+		 || ( xml_document_data_offset >= ( xml_document_data_size - 4 ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid binary XML document data size value too small.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( xml_document_data[ xml_document_data_offset ] ),
+		 entity_name_offset );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: name offset\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 entity_name_offset );
+		}
+#endif
+		xml_token->size          += 4;
+		xml_document_data_offset += 4;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	if( entity_name_offset > ( binary_data_offset + xml_document_data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid entity name offset value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( binary_data_offset + xml_document_data_offset ) < entity_name_offset )
+	{
+		trailing_data_size = entity_name_offset - ( binary_data_offset + xml_document_data_offset );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: data offset\t\t: 0x%08" PRIzx "\n",
+			 function,
+			 binary_data_offset + xml_document_data_offset );
+
+			libcnotify_printf(
+			 "%s: trailing data:\n",
+			 function );
+			libcnotify_print_data(
+			 &( xml_document_data[ xml_document_data_offset ] ),
+			 trailing_data_size,
+			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+		}
+#endif
+		xml_token->size          += trailing_data_size;
+		xml_document_data_offset += trailing_data_size;
+	}
+	if( libfwevt_xml_tag_initialize_with_arena(
+	     &entity_xml_tag,
+	     internal_xml_document->arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create entity XML tag.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_xml_document_read_name(
+	     internal_xml_document,
+	     binary_data,
+	     binary_data_size,
+	     entity_name_offset,
+	     flags,
+	     &entity_name_size,
+	     entity_xml_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read entity name.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( binary_data_offset + xml_document_data_offset ) == entity_name_offset )
+	{
+		xml_token->size += entity_name_size;
+	}
+	if( libfwevt_xml_tag_get_utf8_name_size(
+	     entity_xml_tag,
+	     &utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size of entity name.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( utf8_string_size == 0 )
+	 || ( utf8_string_size > ( MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint8_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	entity_name = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * utf8_string_size );
+
+	if( entity_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entity name.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_xml_tag_get_utf8_name(
+	     entity_xml_tag,
+	     entity_name,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy entity name to UTF-16 string.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_xml_tag_set_value_type(
+	     xml_tag,
+	     LIBFWEVT_VALUE_TYPE_STRING_UTF16,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set value type.",
+		 function );
+
+		goto on_error;
+	}
+	/* Make sure the character value data is in UTF-16 litte-endian
+	 */
+	entity_value_utf16_stream = (uint8_t *) memory_allocate(
+	                                         sizeof( uint8_t ) * 4 );
+
+	if( entity_value_utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create entity value UTF-16 stream.",
+		 function );
+
+		goto on_error;
+	}
+	if( utf8_string_size == 3 )
+	{
+		if( ( entity_name[ 0 ] == (uint8_t) 'g' )
+		 && ( entity_name[ 1 ] == (uint8_t) 't' ) )
+		{
+			entity_value_utf16_stream[ 0 ] = (uint8_t) '>';
+			entity_value_utf16_stream[ 1 ] = 0;
+
+			entity_name_match = 1;
+		}
+		else if( ( entity_name[ 0 ] == (uint8_t) 'l' )
+		      && ( entity_name[ 1 ] == (uint8_t) 't' ) )
+		{
+			entity_value_utf16_stream[ 0 ] = (uint8_t) '<';
+			entity_value_utf16_stream[ 1 ] = 0;
+
+			entity_name_match = 1;
+		}
+	}
+	else if( utf8_string_size == 4 )
+	{
+		if( ( entity_name[ 0 ] == (uint8_t) 'a' )
+		 && ( entity_name[ 1 ] == (uint8_t) 'm' )
+		 && ( entity_name[ 2 ] == (uint8_t) 'p' ) )
+		{
+			entity_value_utf16_stream[ 0 ] = (uint8_t) '&';
+			entity_value_utf16_stream[ 1 ] = 0;
+
+			entity_name_match = 1;
+		}
+	}
+	else if( utf8_string_size == 5 )
+	{
+		if( ( entity_name[ 0 ] == (uint8_t) 'a' )
+		 && ( entity_name[ 1 ] == (uint8_t) 'p' )
+		 && ( entity_name[ 2 ] == (uint8_t) 'o' )
+		 && ( entity_name[ 3 ] == (uint8_t) 's' ) )
+		{
+			entity_value_utf16_stream[ 0 ] = (uint8_t) '\'';
+			entity_value_utf16_stream[ 1 ] = 0;
+
+			entity_name_match = 1;
+		}
+		else if( ( entity_name[ 0 ] == (uint8_t) 'q' )
+		      && ( entity_name[ 1 ] == (uint8_t) 'u' )
+		      && ( entity_name[ 2 ] == (uint8_t) 'o' )
+		      && ( entity_name[ 3 ] == (uint8_t) 't' ) )
+		{
+			entity_value_utf16_stream[ 0 ] = (uint8_t) '"';
+			entity_value_utf16_stream[ 1 ] = 0;
+
+			entity_name_match = 1;
+		}
+	}
+	if( entity_name_match == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported entity name: %s\n",
+		 function,
+		 entity_name );
+
+		goto on_error;
+	}
+	entity_value_utf16_stream[ 2 ] = 0;
+	entity_value_utf16_stream[ 3 ] = 0;
+
+	memory_free(
+	 entity_name );
+
+	entity_name = NULL;
+
+	if( libfwevt_xml_tag_append_value_data(
+	     xml_tag,
+	     entity_value_utf16_stream,
+	     4,
+	     0,
+	     &data_segment_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value data.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 entity_value_utf16_stream );
+
+	entity_value_utf16_stream = NULL;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( libfwevt_xml_tag_debug_print_value_data_segment(
+		     xml_tag,
+		     data_segment_index,
+		     0,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print value data segment: %d.",
+			 function,
+			 data_segment_index );
+
+			goto on_error;
+		}
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	if( libfwevt_internal_xml_tag_free(
+	     (libfwevt_internal_xml_tag_t **) &entity_xml_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free entity XML tag.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( entity_value_utf16_stream != NULL )
+	{
+		memory_free(
+		 entity_value_utf16_stream );
+	}
+	if( entity_name != NULL )
+	{
+		memory_free(
+		 entity_name );
+	}
+	if( entity_xml_tag != NULL )
+	{
+		libfwevt_internal_xml_tag_free(
+		 (libfwevt_internal_xml_tag_t **) &entity_xml_tag,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads a fragment from a binary XML document
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_read_fragment(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     libfwevt_xml_token_t *xml_token,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     int ascii_codepage,
+     uint8_t flags,
+     libcdata_array_t *template_values_array,
+     libfwevt_xml_tag_t *xml_tag,
+     int element_recursion_depth,
+     int template_instance_recursion_depth,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_token_t *xml_sub_token = NULL;
+	static char *function               = "libfwevt_xml_document_read_fragment";
+
+	if( internal_xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML token.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_document_read_fragment_header(
+	     internal_xml_document,
+	     xml_token,
+	     binary_data,
+	     binary_data_size,
+	     binary_data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read fragment header.",
+		 function );
+
+		goto on_error;
+	}
+	binary_data_offset += xml_token->size;
+
+	if( libfwevt_xml_token_initialize(
+	     &xml_sub_token,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create binary XML sub token.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_xml_token_read_data(
+	     xml_sub_token,
+	     binary_data,
+	     binary_data_size,
+	     binary_data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read binary XML sub token.",
+		 function );
+
+		goto on_error;
+	}
+	switch( xml_sub_token->type & 0xbf )
+	{
+		case LIBFWEVT_XML_TOKEN_OPEN_START_ELEMENT_TAG:
+			if( libfwevt_xml_document_read_element(
+			     internal_xml_document,
+			     xml_sub_token,
+			     binary_data,
+			     binary_data_size,
+			     binary_data_offset,
+			     ascii_codepage,
+			     flags,
+			     template_values_array,
+			     xml_tag,
+			     element_recursion_depth + 1,
+			     template_instance_recursion_depth,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read element.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		case LIBFWEVT_XML_TOKEN_TEMPLATE_INSTANCE:
+			if( libfwevt_xml_document_read_template_instance(
+			     internal_xml_document,
+			     xml_sub_token,
+			     binary_data,
+			     binary_data_size,
+			     binary_data_offset,
+			     ascii_codepage,
+			     flags,
+			     xml_tag,
+			     element_recursion_depth,
+			     template_instance_recursion_depth + 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read document template instance.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid binary XML token - unsupported type: 0x%02" PRIx8 ".",
+			 function,
+			 xml_sub_token->type );
+
+			goto on_error;
+	}
+	xml_token->size += xml_sub_token->size;
+
+	if( libfwevt_xml_token_free(
+	     &xml_sub_token,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free binary XML sub token.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( xml_sub_token != NULL )
+	{
+		libfwevt_xml_token_free(
+		 &xml_sub_token,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads a fragment header from a binary XML document
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_read_fragment_header(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     libfwevt_xml_token_t *xml_token,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     libcerror_error_t **error )
+{
+	static char *function            = "libfwevt_xml_document_read_fragment_header";
+	size_t xml_document_data_size    = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	const uint8_t *xml_document_data = NULL;
+#endif
+
+	if( internal_xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML token.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_token->type != LIBFWEVT_XML_TOKEN_FRAGMENT_HEADER )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid binary XML token - unsupported type: 0x%02" PRIx8 ".",
+		 function,
+		 xml_token->type );
+
+		return( -1 );
+	}
+	if( binary_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary data.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid binary XML document data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data_offset >= binary_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid binary data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	xml_document_data = &( binary_data[ binary_data_offset ] );
+#endif
+
+	xml_document_data_size = binary_data_size - binary_data_offset;
+
+	if( xml_document_data_size < 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid binary XML document data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: data offset\t\t\t: 0x%08" PRIzx "\n",
+		 function,
+		 binary_data_offset );
+
+		libcnotify_printf(
+		 "%s: fragment header data:\n",
+		 function );
+		libcnotify_print_data(
+		 xml_document_data,
+		 4,
+		 0 );
+	}
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: type\t\t\t: 0x%02" PRIx8 "\n",
+		 function,
+		 xml_document_data[ 0 ] );
+
+		libcnotify_printf(
+		 "%s: major version\t\t: %" PRIu8 "\n",
+		 function,
+		 xml_document_data[ 1 ] );
+
+		libcnotify_printf(
+		 "%s: minor version\t\t: %" PRIu8 "\n",
+		 function,
+		 xml_document_data[ 2 ] );
+
+		libcnotify_printf(
+		 "%s: flags\t\t\t: 0x%02" PRIx8 "\n",
+		 function,
+		 xml_document_data[ 3 ] );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+/* TODO check values */
+	xml_token->size = 4;
+
+	return( 1 );
+}
+
+/* Reads the name data from a binary XML document
+ * The name data is not copied and references the binary data
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_read_name_data(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     uint8_t flags,
+     uint16_t *name_hash,
+     const uint8_t **name_data,
+     size_t *name_data_size,
+     uint32_t *read_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *xml_document_data = NULL;
+	static char *function            = "libfwevt_xml_document_read_name_data";
+	size_t additional_value_size     = 0;
+	size_t xml_document_data_offset  = 0;
+	size_t xml_document_data_size    = 0;
+	uint32_t name_size               = 0;
+	uint16_t safe_name_hash          = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint32_t value_32bit             = 0;
+#endif
+
+	if( internal_xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( binary_data_size < 4 )
+	 || ( binary_data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid binary XML document data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data_offset >= binary_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid binary data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name data.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( read_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid read size.",
+		 function );
+
+		return( -1 );
+	}
+	xml_document_data      = &( binary_data[ binary_data_offset ] );
+	xml_document_data_size = binary_data_size - binary_data_offset;
+
+	if( ( flags & LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS ) != 0 )
+	{
+		additional_value_size += 4;
+	}
+	if( ( additional_value_size + 4 ) > xml_document_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid binary XML document data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: data offset\t\t\t\t: 0x%08" PRIzx "\n",
+		 function,
+		 binary_data_offset );
+
+		libcnotify_printf(
+		 "%s: name header data:\n",
+		 function );
+		libcnotify_print_data(
+		 xml_document_data,
+		 additional_value_size + 4,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+	}
+#endif
+	if( ( flags & LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS ) != 0 )
+	{
+/* TODO determine if this used */
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			byte_stream_copy_to_uint32_little_endian(
+			 xml_document_data,
+			 value_32bit );
+			libcnotify_printf(
+			 "%s: name unknown1\t\t\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 value_32bit );
+		}
+#endif
+		xml_document_data_offset += 4;
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( xml_document_data[ xml_document_data_offset ] ),
+	 safe_name_hash );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( xml_document_data[ xml_document_data_offset + 2 ] ),
+	 name_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: name hash\t\t\t\t: 0x%04" PRIx16 "\n",
+		 function,
+		 safe_name_hash );
+
+		libcnotify_printf(
+		 "%s: name number of characters\t\t: %" PRIu16 "\n",
+		 function,
+		 name_size );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	xml_document_data_offset += 4;
+
+	if( ( name_size == 0 )
+	 || ( (size_t) name_size > ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) / 2 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	name_size = ( name_size + 1 ) * 2;
+
+	if( (size_t) name_size > ( xml_document_data_size - xml_document_data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid binary XML document data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: name data:\n",
+		 function );
+		libcnotify_print_data(
+		 &( xml_document_data[ xml_document_data_offset ] ),
+		 name_size,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+	}
+#endif
+	*name_hash      = safe_name_hash;
+	*name_data      = &( xml_document_data[ xml_document_data_offset ] );
+	*name_data_size = (size_t) name_size;
+	*read_size      = (uint32_t) ( xml_document_data_offset + name_size );
+
+	return( 1 );
+}
+
+/* Reads a name from a binary XML document
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_read_name(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     uint8_t flags,
+     uint32_t *name_data_size,
+     libfwevt_xml_tag_t *xml_tag,
+     libcerror_error_t **error )
+{
+	const uint8_t *name_data = NULL;
+	static char *function    = "libfwevt_xml_document_read_name";
+	size_t name_size         = 0;
+	uint16_t name_hash       = 0;
+
+	if( xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_document_read_name_data(
+	     internal_xml_document,
+	     binary_data,
+	     binary_data_size,
+	     binary_data_offset,
+	     flags,
+	     &name_hash,
+	     &name_data,
+	     &name_size,
+	     name_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read name data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_document_set_xml_tag_name(
+	     internal_xml_document,
+	     xml_tag,
+	     flags,
+	     (uint32_t) binary_data_offset,
+	     name_hash,
+	     name_data,
+	     name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name data.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( libfwevt_xml_tag_name_debug_print(
+		     xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print name.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	return( 1 );
+}
+
+/* Reads a normal substitution from a binary XML document
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_read_normal_substitution(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     libfwevt_xml_token_t *xml_token,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     int ascii_codepage,
+     uint8_t flags,
+     libcdata_array_t *template_values_array,
+     size_t *template_value_offset,
+     libfwevt_xml_tag_t *xml_tag,
+     int element_recursion_depth,
+     int template_instance_recursion_depth,
+     libcerror_error_t **error )
+{
+	const uint8_t *xml_document_data = NULL;
+	static char *function            = "libfwevt_xml_document_read_normal_substitution";
+	size_t xml_document_data_size    = 0;
+	uint16_t template_value_index    = 0;
+	uint8_t template_value_type      = 0;
+	int result                       = 0;
+
+	if( internal_xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML token.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_token->type != LIBFWEVT_XML_TOKEN_NORMAL_SUBSTITUTION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid binary XML token - unsupported type: 0x%02" PRIx8 ".",
+		 function,
+		 xml_token->type );
+
+		return( -1 );
+	}
+	if( binary_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary data.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid binary XML document data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data_offset >= binary_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid binary data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	xml_document_data      = &( binary_data[ binary_data_offset ] );
+	xml_document_data_size = binary_data_size - binary_data_offset;
+
+	if( xml_document_data_size < 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid binary XML document data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: data offset\t\t: 0x%08" PRIzx "\n",
+		 function,
+		 binary_data_offset );
+
+		libcnotify_printf(
+		 "%s: normal substitution data:\n",
+		 function );
+		libcnotify_print_data(
+		 xml_document_data,
+		 4,
+		 0 );
+	}
+#endif
+	byte_stream_copy_to_uint16_little_endian(
+	 &( xml_document_data[ 1 ] ),
+	 template_value_index );
+
+	template_value_type = xml_document_data[ 3 ];
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: type\t\t\t: 0x%02" PRIx8 "\n",
+		 function,
+		 xml_document_data[ 0 ] );
+
+		libcnotify_printf(
+		 "%s: identifier\t\t: %" PRIu16 "\n",
+		 function,
+		 template_value_index );
+
+		libcnotify_printf(
+		 "%s: value type\t\t: 0x%02" PRIx8 " (",
+		 function,
+		 template_value_type );
+		libfwevt_debug_print_value_type(
+		 template_value_type );
+		libcnotify_printf(
+		 ")\n" );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	xml_token->size = 4;
+
+	result = libfwevt_xml_document_substitute_template_value(
+	          internal_xml_document,
+	          binary_data,
+	          binary_data_size,
+	          ascii_codepage,
+	          flags,
+	          template_values_array,
+	          template_value_index,
+	          template_value_type,
+	          template_value_offset,
+	          xml_tag,
+	          element_recursion_depth,
+	          template_instance_recursion_depth,
+	          error );
+
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to substitute template value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Reads an optional substitution from a binary XML document
+ * Returns 1 if successful, 0 if no substitution or -1 on error
+ */
+int libfwevt_xml_document_read_optional_substitution(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     libfwevt_xml_token_t *xml_token,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     int ascii_codepage,
+     uint8_t flags,
+     libcdata_array_t *template_values_array,
+     size_t *template_value_offset,
+     libfwevt_xml_tag_t *xml_tag,
+     int element_recursion_depth,
+     int template_instance_recursion_depth,
+     libcerror_error_t **error )
+{
+	const uint8_t *xml_document_data = NULL;
+	static char *function            = "libfwevt_xml_document_read_optional_substitution";
+	size_t xml_document_data_size    = 0;
+	uint16_t template_value_index    = 0;
+	uint8_t template_value_type      = 0;
+	int result                       = 0;
+
+	if( internal_xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML token.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_token->type != LIBFWEVT_XML_TOKEN_OPTIONAL_SUBSTITUTION )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid binary XML token - unsupported type: 0x%02" PRIx8 ".",
+		 function,
+		 xml_token->type );
+
+		return( -1 );
+	}
+	if( binary_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary data.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid binary XML document data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data_offset >= binary_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid binary data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	xml_document_data      = &( binary_data[ binary_data_offset ] );
+	xml_document_data_size = binary_data_size - binary_data_offset;
+
+	if( xml_document_data_size < 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid binary XML document data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: data offset\t\t: 0x%08" PRIzx "\n",
+		 function,
+		 binary_data_offset );
+
+		libcnotify_printf(
+		 "%s: optional substitution data:\n",
+		 function );
+		libcnotify_print_data(
+		 xml_document_data,
+		 4,
+		 0 );
+	}
+#endif
+	byte_stream_copy_to_uint16_little_endian(
+	 &( xml_document_data[ 1 ] ),
+	 template_value_index );
+
+	template_value_type = xml_document_data[ 3 ];
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: type\t\t\t: 0x%02" PRIx8 "\n",
+		 function,
+		 xml_document_data[ 0 ] );
+
+		libcnotify_printf(
+		 "%s: identifier\t\t: %" PRIu16 "\n",
+		 function,
+		 template_value_index );
+
+		libcnotify_printf(
+		 "%s: value type\t\t: 0x%02" PRIx8 " (",
+		 function,
+		 template_value_type );
+		libfwevt_debug_print_value_type(
+		 template_value_type );
+		libcnotify_printf(
+		 ")\n" );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	xml_token->size = 4;
+
+	result = libfwevt_xml_document_substitute_template_value(
+	          internal_xml_document,
+	          binary_data,
+	          binary_data_size,
+	          ascii_codepage,
+	          flags,
+	          template_values_array,
+	          template_value_index,
+	          template_value_type,
+	          template_value_offset,
+	          xml_tag,
+	          element_recursion_depth,
+	          template_instance_recursion_depth,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to substitute template value.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Reads a PI data from a binary XML document
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_read_pi_data(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     libfwevt_xml_token_t *xml_token,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     libfwevt_xml_tag_t *xml_tag,
+     int ascii_codepage LIBFWEVT_ATTRIBUTE_UNUSED,
+     libcerror_error_t **error )
+{
+	const uint8_t *xml_document_data = NULL;
+	static char *function            = "libfwevt_xml_document_read_pi_data";
+	size_t value_data_size           = 0;
+	size_t xml_document_data_size    = 0;
+
+	LIBFWEVT_UNREFERENCED_PARAMETER( ascii_codepage )
+
+	if( internal_xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML token.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_token->type != LIBFWEVT_XML_TOKEN_PI_DATA )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid binary XML token - unsupported type: 0x%02" PRIx8 ".",
+		 function,
+		 xml_token->type );
+
+		return( -1 );
+	}
+	if( binary_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary data.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid binary XML document data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data_offset >= binary_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid binary data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	xml_document_data      = &( binary_data[ binary_data_offset ] );
+	xml_document_data_size = binary_data_size - binary_data_offset;
+
+	if( xml_document_data_size < 3 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid binary XML document data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: data offset\t\t: 0x%08" PRIzx "\n",
+		 function,
+		 binary_data_offset );
+
+		libcnotify_printf(
+		 "%s: PI data:\n",
+		 function );
+		libcnotify_print_data(
+		 xml_document_data,
+		 3,
+		 0 );
+	}
+#endif
+	byte_stream_copy_to_uint16_little_endian(
+	 &( xml_document_data[ 1 ] ),
+	 value_data_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: type\t\t\t\t: 0x%02" PRIx8 "\n",
+		 function,
+		 xml_document_data[ 0 ] );
+
+		libcnotify_printf(
+		 "%s: number of characters\t\t: %" PRIzd "\n",
+		 function,
+		 value_data_size );
+	}
+#endif
+	xml_token->size     = 3;
+	binary_data_offset += 3;
+
+	value_data_size *= 2;
+
+	if( ( value_data_size > binary_data_size )
+	 || ( binary_data_offset >= ( binary_data_size - value_data_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: data offset\t\t: 0x%08" PRIzx "\n",
+		 function,
+		 binary_data_offset );
+
+		libcnotify_printf(
+		 "%s: value data:\n",
+		 function );
+		libcnotify_print_data(
+		 &( xml_document_data[ 3 ] ),
+		 value_data_size,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+	}
+#endif
+	if( libfwevt_xml_tag_set_value_type(
+	     xml_tag,
+	     LIBFWEVT_VALUE_TYPE_STRING_UTF16,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_set_value_data(
+	     xml_tag,
+	     &( binary_data[ binary_data_offset ] ),
+	     value_data_size,
+	     internal_xml_document->data_segment_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set value data.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( libfwevt_xml_tag_debug_print_value_data_segment(
+		     xml_tag,
+		     0,
+		     0,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print value data segment: 0.",
+			 function );
+
+			return( -1 );
+		}
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	xml_token->size += value_data_size;
+
+	return( 1 );
+}
+
+/* Reads a PI target from a binary XML document
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_read_pi_target(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     libfwevt_xml_token_t *xml_token,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     uint8_t flags,
+     libfwevt_xml_tag_t *xml_tag,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *pi_xml_tag      = NULL;
+	libfwevt_xml_token_t *xml_sub_token = NULL;
+	const uint8_t *xml_document_data    = NULL;
+	static char *function               = "libfwevt_xml_document_read_pi_target";
+	size_t additional_value_size        = 0;
+	size_t trailing_data_size           = 0;
+	size_t xml_document_data_offset     = 0;
+	size_t xml_document_data_size       = 0;
+	uint32_t pi_name_offset             = 0;
+	uint32_t pi_name_size               = 0;
+
+	if( internal_xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML token.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_token->type != LIBFWEVT_XML_TOKEN_PI_TARGET )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: invalid binary XML token - unsupported type: 0x%02" PRIx8 ".",
+		 function,
+		 xml_token->type );
+
+		return( -1 );
+	}
+	if( binary_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary data.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid binary XML document data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data_offset >= binary_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid binary data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( flags & LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS ) != 0 )
+	{
+		additional_value_size = 4;
+	}
+	xml_document_data      = &( binary_data[ binary_data_offset ] );
+	xml_document_data_size = binary_data_size - binary_data_offset;
+
+	if( xml_document_data_size < ( 1 + additional_value_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid binary XML document data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_initialize_with_arena(
+	     &pi_xml_tag,
+	     internal_xml_document->arena,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create PI XML tag.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_xml_tag_set_type(
+	     pi_xml_tag,
+	     LIBFWEVT_XML_TAG_TYPE_PI,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set XML tag type.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: data offset\t\t: 0x%08" PRIzx "\n",
+		 function,
+		 binary_data_offset );
+
+		libcnotify_printf(
+		 "%s: PI target data:\n",
+		 function );
+		libcnotify_print_data(
+		 xml_document_data,
+		 1 + additional_value_size,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+	}
+#endif
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: type\t\t\t: 0x%02" PRIx8 "\n",
+		 function,
+		 xml_document_data[ 0 ] );
+	}
+#endif
+	xml_token->size          = 1;
+	xml_document_data_offset = 1;
+
+	if( ( flags & LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS ) == 0 )
+	{
+		/* TODO double check if this needs to be binary_data_offset + xml_document_data_offset + 1
+		 */
+		pi_name_offset = (uint32_t) ( binary_data_offset + xml_document_data_offset );
+	}
+	else
+	{
+		if( ( xml_document_data_size < 4 )
+		 || ( xml_document_data_offset >= ( xml_document_data_size - 4 ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid binary XML document data size value too small.",
+			 function );
+
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( xml_document_data[ xml_document_data_offset ] ),
+		 pi_name_offset );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: name offset\t\t\t: 0x%08" PRIx32 "\n",
+			 function,
+			 pi_name_offset );
+		}
+#endif
+		xml_token->size           = 4;
+/* TODO
+		xml_document_data_offset += 4;
+*/
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+
+	/* TODO double check setting this to 5 but this is currently needed
+	 * likely because of additional_value_size when LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS is not set
+	 */
+	xml_token->size          = 5;
+	xml_document_data_offset = 5;
+
+	if( pi_name_offset > ( binary_data_offset + xml_document_data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid PI name offset value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( binary_data_offset + xml_document_data_offset ) < pi_name_offset )
+	{
+		trailing_data_size = pi_name_offset - ( binary_data_offset + xml_document_data_offset );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: data offset\t\t: 0x%08" PRIzx "\n",
+			 function,
+			 binary_data_offset + 5 );
+
+			libcnotify_printf(
+			 "%s: trailing data:\n",
+			 function );
+			libcnotify_print_data(
+			 &( xml_document_data[ 5 ] ),
+			 trailing_data_size,
+			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+		}
+#endif
+		xml_token->size          += trailing_data_size;
+		xml_document_data_offset += trailing_data_size;
+	}
+	if( libfwevt_xml_document_read_name(
+	     internal_xml_document,
+	     binary_data,
+	     binary_data_size,
+	     pi_name_offset,
+	     flags,
+	     &pi_name_size,
+	     pi_xml_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read PI name.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( binary_data_offset + xml_document_data_offset ) == pi_name_offset )
+	{
+		xml_token->size          += pi_name_size;
+		xml_document_data_offset += pi_name_size;
+	}
+	if( libfwevt_xml_token_initialize(
+	     &xml_sub_token,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create binary XML sub token.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_xml_token_read_data(
+	     xml_sub_token,
+	     binary_data,
+	     binary_data_size,
+	     binary_data_offset + xml_document_data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read binary XML sub token.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_xml_document_read_pi_data(
+	     internal_xml_document,
+	     xml_sub_token,
+	     binary_data,
+	     binary_data_size,
+	     binary_data_offset + xml_document_data_offset,
+	     pi_xml_tag,
+	     ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read PI target.",
+		 function );
+
+		goto on_error;
+	}
+	xml_token->size += xml_sub_token->size;
+
+	if( libfwevt_xml_token_free(
+	     &xml_sub_token,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free binary XML sub token.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_xml_tag_append_element(
+	     xml_tag,
+	     pi_xml_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append PI to XML tag.",
+		 function );
+
+		goto on_error;
+	}
+	pi_xml_tag = NULL;
+
+	return( 1 );
+
+on_error:
+	if( xml_sub_token != NULL )
+	{
+		libfwevt_xml_token_free(
+		 &xml_sub_token,
+		 NULL );
+	}
+	if( pi_xml_tag != NULL )
+	{
+		libfwevt_internal_xml_tag_free(
+		 (libfwevt_internal_xml_tag_t **) &pi_xml_tag,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads a template definition from a binary XML document
+ * The definition is read into a template definition that can be substituted
+ * with the template values of other template instances
+ * Data that cannot be read is reported as not cacheable, the template
+ * instance is then read without the template definition, which reports the error
+ * Returns 1 if successful, 0 if the template definition cannot be cached or -1 on error
+ */
+int libfwevt_xml_document_read_template_definition(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     int ascii_codepage,
+     uint8_t flags,
+     libfwevt_xml_template_definition_t **template_definition,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_template_definition_t *safe_template_definition = NULL;
+	libfwevt_xml_token_t *xml_sub_token                          = NULL;
+	static char *function                                        = "libfwevt_xml_document_read_template_definition";
+	size_t template_data_offset                                  = 0;
+	int result                                                   = 0;
+
+	if( internal_xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary data.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid binary XML document data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( binary_data_size < 24 )
+	 || ( binary_data_offset >= ( binary_data_size - 24 ) )
+	 || ( binary_data_offset > (size_t) UINT32_MAX ) )
+	{
+		return( 0 );
+	}
+	if( libfwevt_xml_template_definition_initialize(
+	     &safe_template_definition,
+	     (uint32_t) binary_data_offset,
+	     flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create template definition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_xml_token_initialize(
+	     &xml_sub_token,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create binary XML sub token.",
+		 function );
+
+		goto on_error;
+	}
+	template_data_offset = binary_data_offset + 24;
+
+	if( libfwevt_xml_token_read_data(
+	     xml_sub_token,
+	     binary_data,
+	     binary_data_size,
+	     template_data_offset,
+	     NULL ) != 1 )
+	{
+		goto on_not_cacheable;
+	}
+	if( libfwevt_xml_document_read_fragment_header(
+	     internal_xml_document,
+	     xml_sub_token,
+	     binary_data,
+	     binary_data_size,
+	     template_data_offset,
+	     NULL ) != 1 )
+	{
+		goto on_not_cacheable;
+	}
+	template_data_offset += xml_sub_token->size;
+
+	if( libfwevt_xml_token_read_data(
+	     xml_sub_token,
+	     binary_data,
+	     binary_data_size,
+	     template_data_offset,
+	     NULL ) != 1 )
+	{
+		goto on_not_cacheable;
+	}
+	if( ( xml_sub_token->type & 0xbf ) != LIBFWEVT_XML_TOKEN_OPEN_START_ELEMENT_TAG )
+	{
+		goto on_not_cacheable;
+	}
+	result = libfwevt_xml_document_read_template_definition_element(
+	          internal_xml_document,
+	          xml_sub_token,
+	          binary_data,
+	          binary_data_size,
+	          template_data_offset,
+	          ascii_codepage,
+	          flags,
+	          safe_template_definition,
+	          0,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read element.",
+		 function );
+
+		goto on_error;
+	}
+	else if( result == 0 )
+	{
+		goto on_not_cacheable;
+	}
+	template_data_offset += xml_sub_token->size;
+
+	if( libfwevt_xml_token_read_data(
+	     xml_sub_token,
+	     binary_data,
+	     binary_data_size,
+	     template_data_offset,
+	     NULL ) != 1 )
+	{
+		goto on_not_cacheable;
+	}
+	if( xml_sub_token->type != LIBFWEVT_XML_TOKEN_END_OF_FILE )
+	{
+		goto on_not_cacheable;
+	}
+	template_data_offset += 1;
+
+	if( libfwevt_xml_template_definition_set_data(
+	     safe_template_definition,
+	     binary_data,
+	     binary_data_size,
+	     template_data_offset - binary_data_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set template definition data.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_xml_token_free(
+	     &xml_sub_token,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free binary XML sub token.",
+		 function );
+
+		goto on_error;
+	}
+	*template_definition = safe_template_definition;
+
+	return( 1 );
+
+on_not_cacheable:
+	if( libfwevt_xml_token_free(
+	     &xml_sub_token,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free binary XML sub token.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_xml_template_definition_free(
+	     &safe_template_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free template definition.",
+		 function );
+
+		goto on_error;
+	}
+	return( 0 );
+
+on_error:
+	if( xml_sub_token != NULL )
+	{
+		libfwevt_xml_token_free(
+		 &xml_sub_token,
+		 NULL );
+	}
+	if( safe_template_definition != NULL )
+	{
+		libfwevt_xml_template_definition_free(
+		 &safe_template_definition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads an attribute of a template definition from a binary XML document
+ * Returns 1 if successful, 0 if the attribute cannot be cached or -1 on error
+ */
+int libfwevt_xml_document_read_template_definition_attribute(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     libfwevt_xml_token_t *xml_token,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     int ascii_codepage,
+     uint8_t flags,
+     libfwevt_xml_template_definition_t *template_definition,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *value_xml_tag     = NULL;
+	libfwevt_xml_token_t *xml_sub_token   = NULL;
+	const uint8_t *xml_document_data      = NULL;
+	static char *function                 = "libfwevt_xml_document_read_template_definition_attribute";
+	size_t additional_value_size          = 0;
+	size_t xml_document_data_offset       = 0;
+	size_t xml_document_data_size         = 0;
+	uint32_t attribute_name_offset        = 0;
+	uint32_t attribute_name_size          = 0;
+	int node_index                        = 0;
+	int result                            = -1;
+
+	if( internal_xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML token.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary data.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( xml_token->type & 0xbf ) != LIBFWEVT_XML_TOKEN_ATTRIBUTE )
+	 || ( binary_data_size > (size_t) SSIZE_MAX )
+	 || ( binary_data_offset >= binary_data_size ) )
+	{
+		return( 0 );
+	}
+	if( ( flags & LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS ) != 0 )
+	{
+		additional_value_size = 4;
+
+		if( ( binary_data_size < 4 )
+		 || ( binary_data_offset > ( binary_data_size - 4 ) ) )
+		{
+			return( 0 );
+		}
+	}
+	xml_document_data      = &( binary_data[ binary_data_offset ] );
+	xml_document_data_size = binary_data_size - binary_data_offset;
+
+	if( xml_document_data_size < ( additional_value_size + 1 ) )
+	{
+		return( 0 );
+	}
+	xml_document_data_offset = 1;
+
+	if( ( flags & LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS ) == 0 )
+	{
+		attribute_name_offset = (uint32_t) ( binary_data_offset + xml_document_data_offset );
+	}
+	else
+	{
+		if( ( xml_document_data_size < 4 )
+		 || ( xml_document_data_offset >= ( xml_document_data_size - 4 ) ) )
+		{
+			return( 0 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( xml_document_data[ xml_document_data_offset ] ),
+		 attribute_name_offset );
+
+		xml_document_data_offset += 4;
+	}
+	if( attribute_name_offset > ( binary_data_offset + xml_document_data_offset ) )
+	{
+		return( 0 );
+	}
+	if( libfwevt_xml_template_definition_append_node(
+	     template_definition,
+	     LIBFWEVT_XML_TEMPLATE_NODE_TYPE_ATTRIBUTE,
+	     &node_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append attribute node.",
+		 function );
+
+		goto on_error;
+	}
+	template_definition->nodes[ node_index ].token_type = xml_token->type;
+
+	result = libfwevt_xml_document_read_template_definition_name(
+	          internal_xml_document,
+	          binary_data,
+	          binary_data_size,
+	          attribute_name_offset,
+	          flags,
+	          template_definition,
+	          node_index,
+	          &attribute_name_size,
+	          error );
+
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	if( ( binary_data_offset + xml_document_data_offset ) == attribute_name_offset )
+	{
+		xml_document_data_offset += attribute_name_size;
+	}
+	if( libfwevt_xml_token_initialize(
+	     &xml_sub_token,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create binary XML sub token.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_xml_token_read_data(
+	     xml_sub_token,
+	     binary_data,
+	     binary_data_size,
+	     binary_data_offset + xml_document_data_offset,
+	     NULL ) != 1 )
+	{
+		result = 0;
+
+		goto on_error;
+	}
+	if( ( ( xml_sub_token->type & 0xbf ) != LIBFWEVT_XML_TOKEN_VALUE )
+	 && ( ( xml_sub_token->type & 0xbf ) != LIBFWEVT_XML_TOKEN_NORMAL_SUBSTITUTION )
+	 && ( ( xml_sub_token->type & 0xbf ) != LIBFWEVT_XML_TOKEN_OPTIONAL_SUBSTITUTION ) )
+	{
+		result = 0;
+
+		goto on_error;
+	}
+	result = libfwevt_xml_document_read_template_definition_content(
+	          internal_xml_document,
+	          xml_sub_token,
+	          binary_data,
+	          binary_data_size,
+	          binary_data_offset + xml_document_data_offset,
+	          ascii_codepage,
+	          template_definition,
+	          &value_xml_tag,
+	          error );
+
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	xml_document_data_offset += xml_sub_token->size;
+
+	xml_token->size = xml_document_data_offset;
+
+	if( value_xml_tag != NULL )
+	{
+		if( libfwevt_internal_xml_tag_free(
+		     (libfwevt_internal_xml_tag_t **) &value_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free value XML tag.",
+			 function );
+
+			result = -1;
+
+			goto on_error;
+		}
+	}
+	if( libfwevt_xml_token_free(
+	     &xml_sub_token,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free binary XML sub token.",
+		 function );
+
+		result = -1;
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( value_xml_tag != NULL )
+	{
+		libfwevt_internal_xml_tag_free(
+		 (libfwevt_internal_xml_tag_t **) &value_xml_tag,
+		 NULL );
+	}
+	if( xml_sub_token != NULL )
+	{
+		libfwevt_xml_token_free(
+		 &xml_sub_token,
+		 NULL );
+	}
+	return( result );
+}
+
+/* Reads a content token of a template definition from a binary XML document
+ * The content token is either a value, CDATA section, character reference
+ * or a substitution
+ * The value XML tag is used to validate the value, CDATA section and character
+ * reference and is created if needed
+ * Returns 1 if successful, 0 if the content cannot be cached or -1 on error
+ */
+int libfwevt_xml_document_read_template_definition_content(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     libfwevt_xml_token_t *xml_token,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     int ascii_codepage,
+     libfwevt_xml_template_definition_t *template_definition,
+     libfwevt_xml_tag_t **value_xml_tag,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_xml_document_read_template_definition_content";
+	int node_index        = 0;
+	int result            = 0;
+
+	if( internal_xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML token.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary data.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( binary_data_offset < template_definition->offset )
+	 || ( binary_data_offset >= binary_data_size )
+	 || ( ( binary_data_offset - template_definition->offset ) > (size_t) UINT32_MAX ) )
+	{
+		return( 0 );
+	}
+	switch( xml_token->type & 0xbf )
+	{
+		case LIBFWEVT_XML_TOKEN_CDATA_SECTION:
+		case LIBFWEVT_XML_TOKEN_CHARACTER_REFERENCE:
+		case LIBFWEVT_XML_TOKEN_VALUE:
+			if( *value_xml_tag == NULL )
+			{
+				if( libfwevt_xml_tag_initialize(
+				     value_xml_tag,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+					 "%s: unable to create value XML tag.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			if( ( xml_token->type & 0xbf ) == LIBFWEVT_XML_TOKEN_CDATA_SECTION )
+			{
+				result = libfwevt_xml_document_read_cdata_section(
+				          internal_xml_document,
+				          xml_token,
+				          binary_data,
+				          binary_data_size,
+				          binary_data_offset,
+				          *value_xml_tag,
+				          ascii_codepage,
+				          NULL );
+			}
+			else if( ( xml_token->type & 0xbf ) == LIBFWEVT_XML_TOKEN_CHARACTER_REFERENCE )
+			{
+				result = libfwevt_xml_document_read_character_reference(
+				          internal_xml_document,
+				          xml_token,
+				          binary_data,
+				          binary_data_size,
+				          binary_data_offset,
+				          *value_xml_tag,
+				          ascii_codepage,
+				          NULL );
+			}
+			else
+			{
+				result = libfwevt_xml_document_read_value(
+				          internal_xml_document,
+				          xml_token,
+				          binary_data,
+				          binary_data_size,
+				          binary_data_offset,
+				          *value_xml_tag,
+				          ascii_codepage,
+				          NULL );
+			}
+			if( result != 1 )
+			{
+				return( 0 );
+			}
+			if( libfwevt_xml_template_definition_append_node(
+			     template_definition,
+			     LIBFWEVT_XML_TEMPLATE_NODE_TYPE_LITERAL,
+			     &node_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append literal node.",
+				 function );
+
+				return( -1 );
+			}
+			break;
+
+		case LIBFWEVT_XML_TOKEN_NORMAL_SUBSTITUTION:
+		case LIBFWEVT_XML_TOKEN_OPTIONAL_SUBSTITUTION:
+			if( ( ( xml_token->type != LIBFWEVT_XML_TOKEN_NORMAL_SUBSTITUTION )
+			  &&  ( xml_token->type != LIBFWEVT_XML_TOKEN_OPTIONAL_SUBSTITUTION ) )
+			 || ( ( binary_data_size - binary_data_offset ) < 4 ) )
+			{
+				return( 0 );
+			}
+			if( libfwevt_xml_template_definition_append_node(
+			     template_definition,
+			     LIBFWEVT_XML_TEMPLATE_NODE_TYPE_SUBSTITUTION,
+			     &node_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append substitution node.",
+				 function );
+
+				return( -1 );
+			}
+			byte_stream_copy_to_uint16_little_endian(
+			 &( binary_data[ binary_data_offset + 1 ] ),
+			 template_definition->nodes[ node_index ].value_index );
+
+			template_definition->nodes[ node_index ].value_type = binary_data[ binary_data_offset + 3 ];
+
+			xml_token->size = 4;
+
+			break;
+
+		default:
+			return( 0 );
+	}
+	template_definition->nodes[ node_index ].token_type  = xml_token->type;
+	template_definition->nodes[ node_index ].data_offset = (uint32_t) ( binary_data_offset - template_definition->offset );
+
+	return( 1 );
+}
+
+/* Reads an element of a template definition from a binary XML document
+ * Returns 1 if successful, 0 if the element cannot be cached or -1 on error
+ */
+int libfwevt_xml_document_read_template_definition_element(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     libfwevt_xml_token_t *xml_token,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     int ascii_codepage,
+     uint8_t flags,
+     libfwevt_xml_template_definition_t *template_definition,
+     int element_recursion_depth,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *value_xml_tag   = NULL;
+	libfwevt_xml_token_t *xml_sub_token = NULL;
+	const uint8_t *xml_document_data    = NULL;
+	static char *function               = "libfwevt_xml_document_read_template_definition_element";
+	size_t additional_value_size        = 0;
+	size_t element_size_offset          = 0;
+	size_t xml_document_data_offset     = 0;
+	size_t xml_document_data_size       = 0;
+	uint32_t attribute_list_size        = 0;
+	uint32_t element_name_offset        = 0;
+	uint32_t element_name_size          = 0;
+	uint32_t element_size               = 0;
+	int element_node_index              = 0;
+	int end_node_index                  = 0;
+	int result                          = -1;
+
+	if( internal_xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_token == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML token.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary data.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( ( xml_token->type & 0xbf ) != LIBFWEVT_XML_TOKEN_OPEN_START_ELEMENT_TAG )
+	 || ( binary_data_size > (size_t) SSIZE_MAX )
+	 || ( binary_data_offset >= binary_data_size ) )
+	{
+		return( 0 );
+	}
+	/* The element recursion depth is relative to the start of the template definition
+	 * the depth including the template instance is checked when the definition is substituted
+	 */
+	if( ( element_recursion_depth < 0 )
+	 || ( element_recursion_depth > LIBFWEVT_XML_DOCUMENT_ELEMENT_RECURSION_DEPTH ) )
+	{
+		return( 0 );
+	}
+	if( ( flags & LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS ) != 0 )
+	{
+		additional_value_size = 4;
+	}
+	if( ( binary_data_size < ( 5 + additional_value_size ) )
+	 || ( binary_data_offset > ( binary_data_size - 5 - additional_value_size ) ) )
+	{
+		return( 0 );
+	}
+	xml_document_data      = &( binary_data[ binary_data_offset ] );
+	xml_document_data_size = binary_data_size - binary_data_offset;
+
+	/* Note that the dependency identifier is an optional value.
+	 */
+	element_size_offset = 1;
+
+	byte_stream_copy_to_uint32_little_endian(
+	 &( xml_document_data[ element_size_offset ] ),
+	 element_size );
+
+	if( ( xml_document_data_size > 7 )
+	 && ( element_size > ( xml_document_data_size - 7 ) ) )
+	{
+		element_size_offset = 3;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( xml_document_data[ element_size_offset ] ),
+	 element_size );
+
+	xml_document_data_offset = element_size_offset + 4;
+
+	/* The first 5 or 7 bytes are not included in the element size
+	 */
+	if( ( flags & LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS ) == 0 )
+	{
+		element_name_offset = (uint32_t) ( binary_data_offset + xml_document_data_offset );
+	}
+	else
+	{
+		if( xml_document_data_offset >= ( xml_document_data_size - 4 ) )
+		{
+			return( 0 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( xml_document_data[ xml_document_data_offset ] ),
+		 element_name_offset );
+
+		xml_document_data_offset += 4;
+		element_size             -= 4;
+	}
+	if( element_name_offset > ( binary_data_offset + xml_document_data_offset ) )
+	{
+		return( 0 );
+	}
+	if( ( binary_data_offset + xml_document_data_offset ) < element_name_offset )
+	{
+		element_size             -= (uint32_t) ( element_name_offset - ( binary_data_offset + xml_document_data_offset ) );
+		xml_document_data_offset  = element_name_offset - binary_data_offset;
+	}
+	if( libfwevt_xml_template_definition_append_node(
+	     template_definition,
+	     LIBFWEVT_XML_TEMPLATE_NODE_TYPE_ELEMENT,
+	     &element_node_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append element node.",
+		 function );
+
+		goto on_error;
+	}
+	template_definition->nodes[ element_node_index ].token_type = xml_token->type;
+
+	result = libfwevt_xml_document_read_template_definition_name(
+	          internal_xml_document,
+	          binary_data,
+	          binary_data_size,
+	          element_name_offset,
+	          flags,
+	          template_definition,
+	          element_node_index,
+	          &element_name_size,
+	          error );
+
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	result = 0;
+
+	if( ( binary_data_offset + xml_document_data_offset ) == element_name_offset )
+	{
+		xml_document_data_offset += element_name_size;
+		element_size             -= element_name_size;
+	}
+	if( libfwevt_xml_token_initialize(
+	     &xml_sub_token,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create binary XML sub token.",
+		 function );
+
+		result = -1;
+
+		goto on_error;
+	}
+	if( ( xml_token->type & LIBFWEVT_XML_TOKEN_FLAG_HAS_MORE_DATA ) != 0 )
+	{
+		if( xml_document_data_offset >= ( xml_document_data_size - 4 ) )
+		{
+			goto on_error;
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( xml_document_data[ xml_document_data_offset ] ),
+		 attribute_list_size );
+
+		xml_document_data_offset += 4;
+		element_size             -= 4;
+
+		if( attribute_list_size > ( binary_data_size - ( binary_data_offset + xml_document_data_offset ) ) )
+		{
+			goto on_error;
+		}
+		while( attribute_list_size > 0 )
+		{
+			if( libfwevt_xml_token_read_data(
+			     xml_sub_token,
+			     binary_data,
+			     binary_data_size,
+			     binary_data_offset + xml_document_data_offset,
+			     NULL ) != 1 )
+			{
+				goto on_error;
+			}
+			result = libfwevt_xml_document_read_template_definition_attribute(
+			          internal_xml_document,
+			          xml_sub_token,
+			          binary_data,
+			          binary_data_size,
+			          binary_data_offset + xml_document_data_offset,
+			          ascii_codepage,
+			          flags,
+			          template_definition,
+			          error );
+
+			if( result != 1 )
+			{
+				goto on_error;
+			}
+			result = 0;
+
+			xml_document_data_offset += xml_sub_token->size;
+			element_size             -= (uint32_t) xml_sub_token->size;
+
+			if( attribute_list_size < xml_sub_token->size )
+			{
+				goto on_error;
+			}
+			attribute_list_size -= (uint32_t) xml_sub_token->size;
+		}
+	}
+	if( libfwevt_xml_token_read_data(
+	     xml_sub_token,
+	     binary_data,
+	     binary_data_size,
+	     binary_data_offset + xml_document_data_offset,
+	     NULL ) != 1 )
+	{
+		goto on_error;
+	}
+	if( ( ( xml_sub_token->type != LIBFWEVT_XML_TOKEN_CLOSE_START_ELEMENT_TAG )
+	  &&  ( xml_sub_token->type != LIBFWEVT_XML_TOKEN_CLOSE_EMPTY_ELEMENT_TAG ) )
+	 || ( xml_document_data_offset >= xml_document_data_size ) )
+	{
+		goto on_error;
+	}
+	xml_document_data_offset += 1;
+	element_size             -= 1;
+
+	if( xml_sub_token->type == LIBFWEVT_XML_TOKEN_CLOSE_START_ELEMENT_TAG )
+	{
+		while( element_size > 0 )
+		{
+			if( libfwevt_xml_token_read_data(
+			     xml_sub_token,
+			     binary_data,
+			     binary_data_size,
+			     binary_data_offset + xml_document_data_offset,
+			     NULL ) != 1 )
+			{
+				goto on_error;
+			}
+			switch( xml_sub_token->type & 0xbf )
+			{
+				case LIBFWEVT_XML_TOKEN_OPEN_START_ELEMENT_TAG:
+					result = libfwevt_xml_document_read_template_definition_element(
+					          internal_xml_document,
+					          xml_sub_token,
+					          binary_data,
+					          binary_data_size,
+					          binary_data_offset + xml_document_data_offset,
+					          ascii_codepage,
+					          flags,
+					          template_definition,
+					          element_recursion_depth + 1,
+					          error );
+					break;
+
+				case LIBFWEVT_XML_TOKEN_CLOSE_EMPTY_ELEMENT_TAG:
+				case LIBFWEVT_XML_TOKEN_END_ELEMENT_TAG:
+					if( xml_document_data_offset < xml_document_data_size )
+					{
+						xml_sub_token->size = 1;
+
+						result = 1;
+					}
+					break;
+
+				default:
+					result = libfwevt_xml_document_read_template_definition_content(
+					          internal_xml_document,
+					          xml_sub_token,
+					          binary_data,
+					          binary_data_size,
+					          binary_data_offset + xml_document_data_offset,
+					          ascii_codepage,
+					          template_definition,
+					          &value_xml_tag,
+					          error );
+					break;
+			}
+			if( result != 1 )
+			{
+				goto on_error;
+			}
+			result = 0;
+
+			xml_document_data_offset += xml_sub_token->size;
+
+			if( element_size < xml_sub_token->size )
+			{
+				goto on_error;
+			}
+			element_size -= (uint32_t) xml_sub_token->size;
+
+			if( ( xml_sub_token->type == LIBFWEVT_XML_TOKEN_CLOSE_EMPTY_ELEMENT_TAG )
+			 || ( xml_sub_token->type == LIBFWEVT_XML_TOKEN_END_ELEMENT_TAG ) )
+			{
+				break;
+			}
+		}
+	}
+	if( element_size > 0 )
+	{
+		goto on_error;
+	}
+	if( libfwevt_xml_template_definition_append_node(
+	     template_definition,
+	     LIBFWEVT_XML_TEMPLATE_NODE_TYPE_END_ELEMENT,
+	     &end_node_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append end element node.",
+		 function );
+
+		result = -1;
+
+		goto on_error;
+	}
+	template_definition->nodes[ element_node_index ].end_node_index = end_node_index;
+
+	xml_token->size = xml_document_data_offset;
+
+	if( value_xml_tag != NULL )
+	{
+		if( libfwevt_internal_xml_tag_free(
+		     (libfwevt_internal_xml_tag_t **) &value_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free value XML tag.",
+			 function );
+
+			result = -1;
+
+			goto on_error;
+		}
+	}
+	if( libfwevt_xml_token_free(
+	     &xml_sub_token,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free binary XML sub token.",
+		 function );
+
+		result = -1;
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( value_xml_tag != NULL )
+	{
+		libfwevt_internal_xml_tag_free(
+		 (libfwevt_internal_xml_tag_t **) &value_xml_tag,
+		 NULL );
+	}
+	if( xml_sub_token != NULL )
+	{
+		libfwevt_xml_token_free(
+		 &xml_sub_token,
+		 NULL );
+	}
+	return( result );
+}
+
+/* Reads the name of an element or attribute of a template definition from a binary XML document
+ * Returns 1 if successful, 0 if the name cannot be cached or -1 on error
+ */
+int libfwevt_xml_document_read_template_definition_name(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     uint8_t flags,
+     libfwevt_xml_template_definition_t *template_definition,
+     int node_index,
+     uint32_t *name_data_size,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *name_xml_tag = NULL;
+	static char *function            = "libfwevt_xml_document_read_template_definition_name";
+	int result                       = 0;
+
+	if( name_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_initialize(
+	     &name_xml_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create name XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	/* The name is read to validate it
+	 */
+	if( libfwevt_xml_document_read_name(
+	     internal_xml_document,
+	     binary_data,
+	     binary_data_size,
+	     binary_data_offset,
+	     flags,
+	     name_data_size,
+	     name_xml_tag,
+	     NULL ) == 1 )
+	{
+		if( libfwevt_xml_template_definition_set_node_name(
+		     template_definition,
+		     node_index,
+		     binary_data,
+		     binary_data_size,
+		     (uint32_t) binary_data_offset,
+		     *name_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set node name.",
+			 function );
+
+			goto on_error;
+		}
+		result = 1;
+	}
+	if( libfwevt_internal_xml_tag_free(
+	     (libfwevt_internal_xml_tag_t **) &name_xml_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free name XML tag.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( name_xml_tag != NULL )
+	{
+		libfwevt_internal_xml_tag_free(
+		 (libfwevt_internal_xml_tag_t **) &name_xml_tag,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a template definition from the template cache
+ * The template definition is read and inserted into the template cache if it is not cached.
+ * If it cannot be cached free template definition is set and the caller must free the template definition
+ * Returns 1 if successful, 0 if the template definition is not available or -1 on error
+ */
+int libfwevt_xml_document_get_template_definition(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     uint32_t template_definition_data_offset,
+     int ascii_codepage,
+     uint8_t flags,
+     libfwevt_xml_template_definition_t **template_definition,
+     uint8_t *free_template_definition,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_xml_document_get_template_definition";
+	int result            = 0;
+
+	if( internal_xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_xml_document->template_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid binary XML document - missing template cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( free_template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid free template definition.",
+		 function );
+
+		return( -1 );
+	}
+	*free_template_definition = 0;
+
+	result = libfwevt_internal_xml_template_cache_get_definition(
+	          (libfwevt_internal_xml_template_cache_t *) internal_xml_document->template_cache,
+	          binary_data,
+	          binary_data_size,
+	          template_definition_data_offset,
+	          flags,
+	          template_definition,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve template definition from cache.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		result = libfwevt_xml_document_read_template_definition(
+		          internal_xml_document,
+		          binary_data,
+		          binary_data_size,
+		          (size_t) template_definition_data_offset,
+		          ascii_codepage,
+		          flags,
+		          template_definition,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read template definition.",
+			 function );
+
+			return( -1 );
+		}
+		else if( result != 0 )
+		{
+			/* The template definition is freed after substitution if it cannot be cached
+			 */
+			*free_template_definition = 1;
+
+			result = libfwevt_internal_xml_template_cache_insert_definition(
+			          (libfwevt_internal_xml_template_cache_t *) internal_xml_document->template_cache,
+			          *template_definition,
+			          error );
+
+			/* Stale template definitions, for example of another chunk, are
+			 * removed by emptying the cache, which is only possible if none
+			 * of its template definitions are being substituted
+			 */
+			if( ( result == 0 )
+			 && ( internal_xml_document->number_of_active_template_definitions == 0 ) )
+			{
+				if( libfwevt_xml_template_cache_empty(
+				     internal_xml_document->template_cache,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+					 "%s: unable to empty template cache.",
+					 function );
+
+					return( -1 );
+				}
+				result = libfwevt_internal_xml_template_cache_insert_definition(
+				          (libfwevt_internal_xml_template_cache_t *) internal_xml_document->template_cache,
+				          *template_definition,
+				          error );
+			}
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to insert template definition into cache.",
+				 function );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				*free_template_definition = 0;
+			}
+		}
+	}
+	if( *template_definition == NULL )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Reads a template instance from a binary XML document
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_read_template_instance(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     libfwevt_xml_token_t *xml_token,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     int ascii_codepage,
+     uint8_t flags,
+     libfwevt_xml_tag_t *xml_tag,
+     int element_recursion_depth,
+     int template_instance_recursion_depth,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *template_values_array                 = NULL;
+	libfwevt_xml_template_definition_t *template_definition = NULL;
+	libfwevt_xml_token_t *xml_sub_token                     = NULL;
+	const uint8_t *xml_document_data                        = NULL;
+	static char *function                                   = "libfwevt_xml_document_read_template_instance";
+	size_t template_data_offset                             = 0;
+	size_t template_data_size                               = 0;
+	size_t template_values_data_offset                      = 0;
+	size_t template_values_data_size                        = 0;
+	size_t trailing_data_size                               = 0;
+	size_t xml_document_data_size                           = 0;
+	uint32_t template_definition_data_offset                = 0;
+	uint32_t template_definition_data_size                  = 0;
+	uint8_t free_template_definition                        = 0;
+	int result                                              = 0;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	uint32_t value_32bit                                    = 0;
+#endif
+
+	if( internal_xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
 		 "%s: invalid binary XML document.",
@@ -3290,7 +9284,7 @@ int libfwevt_xml_document_read_fragment_header(
 
 		return( -1 );
 	}
-	if( xml_token->type != LIBFWEVT_XML_TOKEN_FRAGMENT_HEADER )
+	if( xml_token->type != LIBFWEVT_XML_TOKEN_TEMPLATE_INSTANCE )
 	{
 		libcerror_error_set(
 		 error,
@@ -3335,13 +9329,23 @@ int libfwevt_xml_document_read_fragment_header(
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	xml_document_data = &( binary_data[ binary_data_offset ] );
-#endif
+	if( ( template_instance_recursion_depth < 0 )
+	 || ( template_instance_recursion_depth > LIBFWEVT_XML_DOCUMENT_TEMPLATE_INSTANCE_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid template instance recursion depth value out of bounds.",
+		 function );
 
+		return( -1 );
+	}
+	xml_document_data      = &( binary_data[ binary_data_offset ] );
 	xml_document_data_size = binary_data_size - binary_data_offset;
 
-	if( xml_document_data_size < 4 )
+	if( ( binary_data_size < 10 )
+	 || ( binary_data_offset >= ( binary_data_size - 10 ) ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -3350,25 +9354,29 @@ int libfwevt_xml_document_read_fragment_header(
 		 "%s: invalid binary XML document data size value too small.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		 "%s: data offset\t\t\t: 0x%08" PRIzx "\n",
+		 "%s: data offset\t\t: 0x%08" PRIzx "\n",
 		 function,
 		 binary_data_offset );
 
 		libcnotify_printf(
-		 "%s: fragment header data:\n",
+		 "%s: template instance header data:\n",
 		 function );
 		libcnotify_print_data(
 		 xml_document_data,
-		 4,
+		 10,
 		 0 );
 	}
 #endif
+	byte_stream_copy_to_uint32_little_endian(
+	 &( xml_document_data[ 6 ] ),
+	 template_definition_data_offset );
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -3378,214 +9386,371 @@ int libfwevt_xml_document_read_fragment_header(
 		 xml_document_data[ 0 ] );
 
 		libcnotify_printf(
-		 "%s: major version\t\t: %" PRIu8 "\n",
+		 "%s: unknown1\t\t\t: %" PRIu8 "\n",
 		 function,
 		 xml_document_data[ 1 ] );
 
+		byte_stream_copy_to_uint32_little_endian(
+		 &( xml_document_data[ 2 ] ),
+		 value_32bit );
 		libcnotify_printf(
-		 "%s: minor version\t\t: %" PRIu8 "\n",
+		 "%s: unknown2\t\t\t: 0x%08" PRIx32 "\n",
 		 function,
-		 xml_document_data[ 2 ] );
+		 value_32bit );
 
 		libcnotify_printf(
-		 "%s: flags\t\t\t: 0x%02" PRIx8 "\n",
+		 "%s: data offset\t\t: 0x%08" PRIx32 "\n",
 		 function,
-		 xml_document_data[ 3 ] );
+		 template_definition_data_offset );
 
 		libcnotify_printf(
 		 "\n" );
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-/* TODO check values */
-	xml_token->size = 4;
+	xml_token->size     = 10;
+	binary_data_offset += 10;
 
-	return( 1 );
-}
+	if( template_definition_data_offset >= binary_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid template definition data offset value out of bounds.",
+		 function );
 
-/* Reads a name from a binary XML document
- * Returns 1 if successful or -1 on error
- */
-int libfwevt_xml_document_read_name(
-     libfwevt_internal_xml_document_t *internal_xml_document,
-     const uint8_t *binary_data,
-     size_t binary_data_size,
-     size_t binary_data_offset,
-     uint8_t flags,
-     uint32_t *name_data_size,
-     libfwevt_xml_tag_t *xml_tag,
-     libcerror_error_t **error )
-{
-	const uint8_t *xml_document_data = NULL;
-	static char *function            = "libfwevt_xml_document_read_name";
-	size_t additional_value_size     = 0;
-	size_t xml_document_data_offset  = 0;
-	size_t xml_document_data_size    = 0;
-	uint32_t name_size               = 0;
+		goto on_error;
+	}
+	if( template_definition_data_offset > binary_data_offset )
+	{
+		trailing_data_size = template_definition_data_offset - binary_data_offset;
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: data offset\t\t: 0x%08" PRIzx "\n",
+			 function,
+			 binary_data_offset );
+
+			libcnotify_printf(
+			 "%s: trailing data:\n",
+			 function );
+			libcnotify_print_data(
+			 &( binary_data[ binary_data_offset ] ),
+			 trailing_data_size,
+			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+		}
+#endif
+		xml_token->size    += trailing_data_size;
+		binary_data_offset += trailing_data_size;
+	}
+	template_data_offset = template_definition_data_offset;
+
+	if( ( binary_data_size < 24 )
+	 || ( template_data_offset >= ( binary_data_size - 24 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid binary XML document data size value too small.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 &( binary_data[ template_data_offset + 20 ] ),
+	 template_definition_data_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( binary_data[ template_data_offset ] ),
+		 value_32bit );
+		libcnotify_printf(
+		 "%s: offset next\t\t: 0x%08" PRIx32 "\n",
+		 function,
+		 value_32bit );
+
+		if( libfwevt_debug_print_guid_value(
+		     function,
+		     "identifier\t\t",
+		     &( binary_data[ template_data_offset + 4 ] ),
+		     16,
+		     LIBFGUID_ENDIAN_LITTLE,
+		     LIBFGUID_STRING_FORMAT_FLAG_USE_LOWER_CASE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print GUID value.",
+			 function );
+
+			return( -1 );
+		}
+		libcnotify_printf(
+		 "%s: definition size\t\t: %" PRIu32 "\n",
+		 function,
+		 template_definition_data_size );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint32_t value_32bit             = 0;
-	uint16_t value_16bit             = 0;
-#endif
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-	if( internal_xml_document == NULL )
+	if( template_definition_data_size > binary_data_size )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid binary XML document.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid template definition data size value out of bounds.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( binary_data == NULL )
+	if( template_data_offset == binary_data_offset )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid binary data.",
-		 function );
-
-		return( -1 );
+		template_values_data_offset = 24 + template_definition_data_size;
 	}
-	if( ( binary_data_size < 4 )
-	 || ( binary_data_size > (size_t) SSIZE_MAX ) )
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid binary XML document data size value out of bounds.",
-		 function );
-
-		return( -1 );
+		template_values_data_offset = 0;
 	}
-	if( binary_data_offset >= binary_data_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid binary data offset value out of bounds.",
-		 function );
+	template_data_offset += 24;
 
-		return( -1 );
-	}
-	if( name_data_size == NULL )
+	if( template_values_data_offset >= xml_document_data_size )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid name data size.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid template values data offset value out of bounds.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( xml_tag == NULL )
+	if( libfwevt_xml_document_read_template_instance_values(
+	     internal_xml_document,
+	     binary_data,
+	     binary_data_size,
+	     binary_data_offset + template_values_data_offset,
+	     template_instance_recursion_depth,
+	     &template_values_array,
+	     &template_values_data_size,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid XML tag.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read document template instance values.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	xml_document_data      = &( binary_data[ binary_data_offset ] );
-	xml_document_data_size = binary_data_size - binary_data_offset;
+	xml_token->size += template_values_data_size;
 
-	if( ( flags & LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS ) != 0 )
-	{
-		additional_value_size += 4;
-	}
-	if( ( additional_value_size + 4 ) > xml_document_data_size )
+	if( libfwevt_xml_token_initialize(
+	     &xml_sub_token,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid binary XML document data size value too small.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create binary XML sub token.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( internal_xml_document->template_cache != NULL )
 	{
-		libcnotify_printf(
-		 "%s: data offset\t\t\t\t: 0x%08" PRIzx "\n",
-		 function,
-		 binary_data_offset );
+		if( libfwevt_xml_document_get_template_definition(
+		     internal_xml_document,
+		     binary_data,
+		     binary_data_size,
+		     template_definition_data_offset,
+		     ascii_codepage,
+		     flags,
+		     &template_definition,
+		     &free_template_definition,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve template definition.",
+			 function );
 
-		libcnotify_printf(
-		 "%s: name header data:\n",
-		 function );
-		libcnotify_print_data(
-		 xml_document_data,
-		 additional_value_size + 4,
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+			goto on_error;
+		}
 	}
-#endif
-	if( ( flags & LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS ) != 0 )
+	if( template_definition != NULL )
 	{
-/* TODO determine if this used */
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		internal_xml_document->number_of_active_template_definitions += 1;
+
+		result = libfwevt_xml_document_substitute_template_definition(
+		          internal_xml_document,
+		          template_definition,
+		          binary_data,
+		          binary_data_size,
+		          ascii_codepage,
+		          flags,
+		          template_values_array,
+		          xml_tag,
+		          element_recursion_depth + 1,
+		          template_instance_recursion_depth,
+		          error );
+
+		internal_xml_document->number_of_active_template_definitions -= 1;
+
+		if( result != 1 )
 		{
-			byte_stream_copy_to_uint32_little_endian(
-			 xml_document_data,
-			 value_32bit );
-			libcnotify_printf(
-			 "%s: name unknown1\t\t\t\t: 0x%08" PRIx32 "\n",
-			 function,
-			 value_32bit );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to substitute template definition.",
+			 function );
+
+			goto on_error;
 		}
-#endif
-		xml_document_data_offset += 4;
-	}
-	byte_stream_copy_to_uint16_little_endian(
-	 &( xml_document_data[ xml_document_data_offset + 2 ] ),
-	 name_size );
+		/* The template definition data contains the end of file token
+		 */
+		template_data_offset = template_definition_data_offset + template_definition->data_size - 1;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		byte_stream_copy_to_uint16_little_endian(
-		 &( xml_document_data[ xml_document_data_offset ] ),
-		 value_16bit );
-		libcnotify_printf(
-		 "%s: name hash\t\t\t\t: 0x%04" PRIx16 "\n",
-		 function,
-		 value_16bit );
+		if( free_template_definition != 0 )
+		{
+			if( libfwevt_xml_template_definition_free(
+			     &template_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free template definition.",
+				 function );
 
-		libcnotify_printf(
-		 "%s: name number of characters\t\t: %" PRIu16 "\n",
-		 function,
-		 name_size );
+				goto on_error;
+			}
+		}
 	}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+	else
+	{
+		if( libfwevt_xml_token_read_data(
+		     xml_sub_token,
+		     binary_data,
+		     binary_data_size,
+		     template_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read binary XML sub token.",
+			 function );
 
-	xml_document_data_offset += 4;
+			goto on_error;
+		}
+		if( libfwevt_xml_document_read_fragment_header(
+		     internal_xml_document,
+		     xml_sub_token,
+		     binary_data,
+		     binary_data_size,
+		     template_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read fragment header.",
+			 function );
 
-	if( ( name_size == 0 )
-	 || ( (size_t) name_size > ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE - 1 ) / 2 ) ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid name size value out of bounds.",
-		 function );
+			goto on_error;
+		}
+		template_data_offset += xml_sub_token->size;
+
+		if( libfwevt_xml_token_read_data(
+		     xml_sub_token,
+		     binary_data,
+		     binary_data_size,
+		     template_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read binary XML sub token.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfwevt_xml_document_read_element(
+		     internal_xml_document,
+		     xml_sub_token,
+		     binary_data,
+		     binary_data_size,
+		     template_data_offset,
+		     ascii_codepage,
+		     flags,
+		     template_values_array,
+		     xml_tag,
+		     element_recursion_depth + 1,
+		     template_instance_recursion_depth,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read element.",
+			 function );
+
+			goto on_error;
+		}
+		template_data_offset += xml_sub_token->size;
+
+		if( libfwevt_xml_token_read_data(
+		     xml_sub_token,
+		     binary_data,
+		     binary_data_size,
+		     template_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read binary XML sub token.",
+			 function );
 
-		return( -1 );
-	}
-	name_size = ( name_size + 1 ) * 2;
+			goto on_error;
+		}
+		if( xml_sub_token->type != LIBFWEVT_XML_TOKEN_END_OF_FILE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid binary XML token - unsupported type: 0x%02" PRIx8 ".",
+			 function,
+			 xml_token->type );
 
-	if( (size_t) name_size > ( xml_document_data_size - xml_document_data_offset ) )
+			goto on_error;
+		}
+	}
+	if( binary_data_offset >= ( binary_data_size - 1 ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -3594,83 +9759,129 @@ int libfwevt_xml_document_read_name(
 		 "%s: invalid binary XML document data size value too small.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		 "%s: name data:\n",
+		 "%s: data offset\t\t: 0x%08" PRIzx "\n",
+		 function,
+		 binary_data_offset );
+
+		libcnotify_printf(
+		 "%s: end of file data:\n",
 		 function );
 		libcnotify_print_data(
-		 &( xml_document_data[ xml_document_data_offset ] ),
-		 name_size,
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+		 &( binary_data[ binary_data_offset ] ),
+		 1,
+		 0 );
 	}
 #endif
-	if( libfwevt_xml_tag_set_name_data(
-	     xml_tag,
-	     &( xml_document_data[ xml_document_data_offset ] ),
-	     name_size,
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: type\t\t\t: 0x%02" PRIx8 "\n",
+		 function,
+		 binary_data[ binary_data_offset ] );
+
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif
+	template_data_offset += 1;
+
+	if( libfwevt_xml_token_free(
+	     &xml_sub_token,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set name data.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free binary XML sub token.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( template_definition_data_offset == binary_data_offset )
 	{
-		if( libfwevt_xml_tag_name_debug_print(
-		     xml_tag,
-		     error ) != 1 )
+		template_data_size = template_data_offset
+		                   - template_definition_data_offset;
+
+		xml_token->size += template_data_size;
+
+		/* The template data size does not include the first 33 bytes
+		 * of the template definition
+		 * In this case the template data size contains 24 of the 33 bytes
+		 */
+		if( template_definition_data_size < ( template_data_size - 24 ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print name.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid template definition data size value too small.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
+/* TODO
+		template_definition_data_size -= (uint32_t) ( template_data_size - 24 );
+*/
 	}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-
-	*name_data_size = (uint32_t) ( xml_document_data_offset + name_size );
+/* TODO check if template_definition_data_size is 0 */
 
 	return( 1 );
+
+on_error:
+	if( ( free_template_definition != 0 )
+	 && ( template_definition != NULL ) )
+	{
+		libfwevt_xml_template_definition_free(
+		 &template_definition,
+		 NULL );
+	}
+	if( xml_sub_token != NULL )
+	{
+		libfwevt_xml_token_free(
+		 &xml_sub_token,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Reads a normal substitution from a binary XML document
- * Returns 1 if successful or -1 on error
+/* Reads the template instance of a binary XML document for a XML template program
+ * The binary XML document is supported if it consists of a fragment header and
+ * a single template instance of which the template definition can be compiled
+ * If free template definition is set the caller must free the template definition
+ * Returns 1 if successful, 0 if not supported by a XML template program or -1 on error
  */
-int libfwevt_xml_document_read_normal_substitution(
+int libfwevt_xml_document_read_template_program_instance(
      libfwevt_internal_xml_document_t *internal_xml_document,
-     libfwevt_xml_token_t *xml_token,
      const uint8_t *binary_data,
      size_t binary_data_size,
      size_t binary_data_offset,
      int ascii_codepage,
      uint8_t flags,
-     libcdata_array_t *template_values_array,
-     size_t *template_value_offset,
-     libfwevt_xml_tag_t *xml_tag,
-     int element_recursion_depth,
      int template_instance_recursion_depth,
+     libfwevt_xml_template_definition_t **template_definition,
+     uint8_t *free_template_definition,
+     libfwevt_xml_template_program_t **program,
+     libcdata_array_t **template_values_array,
      libcerror_error_t **error )
 {
-	const uint8_t *xml_document_data = NULL;
-	static char *function            = "libfwevt_xml_document_read_normal_substitution";
-	size_t xml_document_data_size    = 0;
-	uint16_t template_value_index    = 0;
-	uint8_t template_value_type      = 0;
-	int result                       = 0;
+	libfwevt_xml_template_definition_t *safe_template_definition = NULL;
+	static char *function                                        = "libfwevt_xml_document_read_template_program_instance";
+	size_t template_instance_data_offset                         = 0;
+	size_t template_values_data_offset                           = 0;
+	size_t template_values_data_size                             = 0;
+	uint32_t template_definition_data_offset                     = 0;
+	uint32_t template_definition_data_size                       = 0;
+	uint8_t safe_free_template_definition                        = 0;
+	uint8_t supported_flags                                      = 0;
+	int result                                                   = 0;
 
 	if( internal_xml_document == NULL )
 	{
@@ -3683,363 +9894,612 @@ int libfwevt_xml_document_read_normal_substitution(
 
 		return( -1 );
 	}
-	if( xml_token == NULL )
+	if( binary_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid binary XML token.",
+		 "%s: invalid binary data.",
 		 function );
 
 		return( -1 );
 	}
-	if( xml_token->type != LIBFWEVT_XML_TOKEN_NORMAL_SUBSTITUTION )
+	if( binary_data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid binary XML token - unsupported type: 0x%02" PRIx8 ".",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid binary XML document data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data_offset >= binary_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid binary data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	supported_flags = LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS
+	                | LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DEPENDENCY_IDENTIFIERS
+	                | LIBFWEVT_XML_DOCUMENT_READ_FLAG_USE_ARENA
+	                | LIBFWEVT_XML_DOCUMENT_READ_FLAG_BORROW_DATA
+	                | LIBFWEVT_XML_DOCUMENT_READ_FLAG_FLAT_TREE;
+
+	if( ( flags & ~( supported_flags ) ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported flags: 0x%02" PRIx8 ".",
 		 function,
-		 xml_token->type );
+		 flags );
 
 		return( -1 );
 	}
-	if( binary_data == NULL )
+	if( template_definition == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid binary data.",
+		 "%s: invalid template definition.",
 		 function );
 
 		return( -1 );
 	}
-	if( binary_data_size > (size_t) SSIZE_MAX )
+	if( free_template_definition == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid binary XML document data size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid free template definition.",
 		 function );
 
 		return( -1 );
 	}
-	if( binary_data_offset >= binary_data_size )
+	if( program == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid binary data offset value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid program.",
 		 function );
 
 		return( -1 );
 	}
-	xml_document_data      = &( binary_data[ binary_data_offset ] );
-	xml_document_data_size = binary_data_size - binary_data_offset;
-
-	if( xml_document_data_size < 4 )
+	if( template_values_array == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid binary XML document data size value too small.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template values array.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	/* The binary XML document should start with a fragment header followed by a template instance
+	 */
+	if( ( ( binary_data_size - binary_data_offset ) < 14 )
+	 || ( binary_data[ binary_data_offset ] != LIBFWEVT_XML_TOKEN_FRAGMENT_HEADER )
+	 || ( binary_data[ binary_data_offset + 4 ] != LIBFWEVT_XML_TOKEN_TEMPLATE_INSTANCE ) )
 	{
-		libcnotify_printf(
-		 "%s: data offset\t\t: 0x%08" PRIzx "\n",
-		 function,
-		 binary_data_offset );
-
-		libcnotify_printf(
-		 "%s: normal substitution data:\n",
-		 function );
-		libcnotify_print_data(
-		 xml_document_data,
-		 4,
-		 0 );
+		return( 0 );
 	}
-#endif
-	byte_stream_copy_to_uint16_little_endian(
-	 &( xml_document_data[ 1 ] ),
-	 template_value_index );
+	template_instance_data_offset = binary_data_offset + 4;
 
-	template_value_type = xml_document_data[ 3 ];
+	byte_stream_copy_to_uint32_little_endian(
+	 &( binary_data[ template_instance_data_offset + 6 ] ),
+	 template_definition_data_offset );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( ( (size_t) template_definition_data_offset >= binary_data_size )
+	 || ( ( binary_data_size - template_definition_data_offset ) < 24 ) )
 	{
-		libcnotify_printf(
-		 "%s: type\t\t\t: 0x%02" PRIx8 "\n",
-		 function,
-		 xml_document_data[ 0 ] );
-
-		libcnotify_printf(
-		 "%s: identifier\t\t: %" PRIu16 "\n",
-		 function,
-		 template_value_index );
-
-		libcnotify_printf(
-		 "%s: value type\t\t: 0x%02" PRIx8 " (",
-		 function,
-		 template_value_type );
-		libfwevt_debug_print_value_type(
-		 template_value_type );
-		libcnotify_printf(
-		 ")\n" );
-
-		libcnotify_printf(
-		 "\n" );
+		return( 0 );
 	}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-
-	xml_token->size = 4;
+	/* The template values follow the template definition if it is stored in the template instance
+	 */
+	if( (size_t) template_definition_data_offset > ( template_instance_data_offset + 10 ) )
+	{
+		return( 0 );
+	}
+	else if( (size_t) template_definition_data_offset == ( template_instance_data_offset + 10 ) )
+	{
+		byte_stream_copy_to_uint32_little_endian(
+		 &( binary_data[ template_definition_data_offset + 20 ] ),
+		 template_definition_data_size );
 
-	result = libfwevt_xml_document_substitute_template_value(
-	          internal_xml_document,
-	          binary_data,
-	          binary_data_size,
-	          ascii_codepage,
-	          flags,
-	          template_values_array,
-	          template_value_index,
-	          template_value_type,
-	          template_value_offset,
-	          xml_tag,
-	          element_recursion_depth,
-	          template_instance_recursion_depth,
-	          error );
+		if( (size_t) template_definition_data_size > ( binary_data_size - template_definition_data_offset - 24 ) )
+		{
+			return( 0 );
+		}
+		template_values_data_offset = (size_t) template_definition_data_offset + 24 + template_definition_data_size;
+	}
+	else
+	{
+		template_values_data_offset = template_instance_data_offset + 10;
+	}
+	if( template_values_data_offset >= binary_data_size )
+	{
+		return( 0 );
+	}
+	if( internal_xml_document->template_cache != NULL )
+	{
+		result = libfwevt_xml_document_get_template_definition(
+		          internal_xml_document,
+		          binary_data,
+		          binary_data_size,
+		          template_definition_data_offset,
+		          ascii_codepage,
+		          flags,
+		          &safe_template_definition,
+		          &safe_free_template_definition,
+		          error );
+	}
+	else
+	{
+		result = libfwevt_xml_document_read_template_definition(
+		          internal_xml_document,
+		          binary_data,
+		          binary_data_size,
+		          (size_t) template_definition_data_offset,
+		          ascii_codepage,
+		          flags,
+		          &safe_template_definition,
+		          error );
 
-	if( result != 1 )
+		safe_free_template_definition = 1;
+	}
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to substitute template value.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve template definition.",
 		 function );
 
-		return( -1 );
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		result = libfwevt_xml_template_definition_get_program(
+		          safe_template_definition,
+		          program,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve template program.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( result != 0 )
+	{
+		if( libfwevt_xml_document_read_template_instance_values(
+		     internal_xml_document,
+		     binary_data,
+		     binary_data_size,
+		     template_values_data_offset,
+		     template_instance_recursion_depth,
+		     template_values_array,
+		     &template_values_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read document template instance values.",
+			 function );
+
+			goto on_error;
+		}
+		/* The template instance should be followed by the end of file token
+		 */
+		template_values_data_offset += template_values_data_size;
+
+		if( ( template_values_data_offset < binary_data_size )
+		 && ( binary_data[ template_values_data_offset ] != LIBFWEVT_XML_TOKEN_END_OF_FILE ) )
+		{
+			result = 0;
+		}
+	}
+	if( result == 0 )
+	{
+		if( libfwevt_xml_document_free_template_program_instance(
+		     &safe_template_definition,
+		     safe_free_template_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free template instance.",
+			 function );
+
+			goto on_error;
+		}
+		return( 0 );
 	}
+	*template_definition      = safe_template_definition;
+	*free_template_definition = safe_free_template_definition;
+
 	return( 1 );
+
+on_error:
+	libfwevt_xml_document_free_template_program_instance(
+	 &safe_template_definition,
+	 safe_free_template_definition,
+	 NULL );
+
+	return( -1 );
 }
 
-/* Reads an optional substitution from a binary XML document
- * Returns 1 if successful, 0 if no substitution or -1 on error
+/* Frees the template instance of a binary XML document read for a XML template program
+ * Returns 1 if successful or -1 on error
  */
-int libfwevt_xml_document_read_optional_substitution(
-     libfwevt_internal_xml_document_t *internal_xml_document,
-     libfwevt_xml_token_t *xml_token,
-     const uint8_t *binary_data,
-     size_t binary_data_size,
-     size_t binary_data_offset,
-     int ascii_codepage,
-     uint8_t flags,
-     libcdata_array_t *template_values_array,
-     size_t *template_value_offset,
-     libfwevt_xml_tag_t *xml_tag,
-     int element_recursion_depth,
-     int template_instance_recursion_depth,
+int libfwevt_xml_document_free_template_program_instance(
+     libfwevt_xml_template_definition_t **template_definition,
+     uint8_t free_template_definition,
      libcerror_error_t **error )
 {
-	const uint8_t *xml_document_data = NULL;
-	static char *function            = "libfwevt_xml_document_read_optional_substitution";
-	size_t xml_document_data_size    = 0;
-	uint16_t template_value_index    = 0;
-	uint8_t template_value_type      = 0;
-	int result                       = 0;
+	static char *function = "libfwevt_xml_document_free_template_program_instance";
+	int result            = 1;
 
-	if( internal_xml_document == NULL )
+	if( template_definition == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid binary XML document.",
+		 "%s: invalid template definition.",
 		 function );
 
 		return( -1 );
 	}
-	if( xml_token == NULL )
+	/* A template definition stored in the template cache is freed by the template cache
+	 */
+	if( ( free_template_definition != 0 )
+	 && ( *template_definition != NULL ) )
+	{
+		if( libfwevt_xml_template_definition_free(
+		     template_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free template definition.",
+			 function );
+
+			result = -1;
+		}
+	}
+	*template_definition = NULL;
+
+	return( result );
+}
+
+/* Renders the template instance of a binary XML document with a XML template program
+ * The template program state is a libfwevt_xml_document_template_program_state_t so that this
+ * function can be used as the binary XML callback of libfwevt_xml_template_program_render_utf8_xml_string
+ * If the UTF-8 string is NULL only the UTF-8 string index is advanced
+ * Returns 1 if successful, 0 if not supported by a XML template program or -1 on error
+ */
+int libfwevt_xml_document_render_template_program_instance(
+     void *template_program_state,
+     size_t binary_data_offset,
+     size_t binary_data_size,
+     int element_depth,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *template_values_array                 = NULL;
+	libfwevt_xml_document_template_program_state_t *state   = NULL;
+	libfwevt_xml_template_definition_t *template_definition = NULL;
+	libfwevt_xml_template_program_t *program                = NULL;
+	static char *function                                   = "libfwevt_xml_document_render_template_program_instance";
+	uint8_t free_template_definition                        = 0;
+	int result                                              = 0;
+
+	if( template_program_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid binary XML token.",
+		 "%s: invalid template program state.",
 		 function );
 
 		return( -1 );
 	}
-	if( xml_token->type != LIBFWEVT_XML_TOKEN_OPTIONAL_SUBSTITUTION )
+	state = (libfwevt_xml_document_template_program_state_t *) template_program_state;
+
+	if( state->internal_xml_document == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid binary XML token - unsupported type: 0x%02" PRIx8 ".",
-		 function,
-		 xml_token->type );
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid template program state - missing binary XML document.",
+		 function );
 
 		return( -1 );
 	}
-	if( binary_data == NULL )
+	/* The XML document reports the recursion errors
+	 */
+	if( ( state->template_instance_recursion_depth < 0 )
+	 || ( state->template_instance_recursion_depth > LIBFWEVT_XML_DOCUMENT_TEMPLATE_INSTANCE_RECURSION_DEPTH )
+	 || ( element_depth < 0 )
+	 || ( element_depth > LIBFWEVT_XML_DOCUMENT_ELEMENT_RECURSION_DEPTH ) )
+	{
+		return( 0 );
+	}
+	result = libfwevt_xml_document_read_template_program_instance(
+	          state->internal_xml_document,
+	          state->binary_data,
+	          binary_data_size,
+	          binary_data_offset,
+	          state->ascii_codepage,
+	          state->flags,
+	          state->template_instance_recursion_depth,
+	          &template_definition,
+	          &free_template_definition,
+	          &program,
+	          &template_values_array,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid binary data.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read template instance.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( binary_data_size > (size_t) SSIZE_MAX )
+	else if( result != 0 )
+	{
+		state->internal_xml_document->number_of_active_template_definitions += 1;
+		state->template_instance_recursion_depth += 1;
+
+		result = libfwevt_xml_template_program_render_utf8_xml_string(
+		          program,
+		          state->binary_data,
+		          binary_data_size,
+		          template_values_array,
+		          state->ascii_codepage,
+		          element_depth,
+		          &libfwevt_xml_document_render_template_program_instance,
+		          template_program_state,
+		          utf8_string,
+		          utf8_string_size,
+		          utf8_string_index,
+		          error );
+
+		state->template_instance_recursion_depth -= 1;
+		state->internal_xml_document->number_of_active_template_definitions -= 1;
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to render template instance.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfwevt_xml_document_free_template_program_instance(
+		     &template_definition,
+		     free_template_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free template instance.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( result );
+
+on_error:
+	libfwevt_xml_document_free_template_program_instance(
+	 &template_definition,
+	 free_template_definition,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Extracts the fields of the template instance of a binary XML document with a XML template program
+ * The template program state is a libfwevt_xml_document_template_program_state_t so that this
+ * function can be used as the binary XML callback of libfwevt_xml_template_program_extract_fields
+ * Returns 1 if successful, 0 if not supported by a XML template program or -1 on error
+ */
+int libfwevt_xml_document_extract_template_program_instance_fields(
+     void *template_program_state,
+     size_t binary_data_offset,
+     size_t binary_data_size,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *template_values_array                 = NULL;
+	libfwevt_xml_document_template_program_state_t *state   = NULL;
+	libfwevt_xml_template_definition_t *template_definition = NULL;
+	libfwevt_xml_template_program_t *program                = NULL;
+	static char *function                                   = "libfwevt_xml_document_extract_template_program_instance_fields";
+	uint8_t free_template_definition                        = 0;
+	int result                                              = 0;
+
+	if( template_program_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid binary XML document data size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template program state.",
 		 function );
 
 		return( -1 );
 	}
-	if( binary_data_offset >= binary_data_size )
+	state = (libfwevt_xml_document_template_program_state_t *) template_program_state;
+
+	if( state->internal_xml_document == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid binary data offset value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid template program state - missing binary XML document.",
 		 function );
 
 		return( -1 );
 	}
-	xml_document_data      = &( binary_data[ binary_data_offset ] );
-	xml_document_data_size = binary_data_size - binary_data_offset;
-
-	if( xml_document_data_size < 4 )
+	if( state->field_callback == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid binary XML document data size value too small.",
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid template program state - missing field callback.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	/* The XML document reports the recursion errors
+	 */
+	if( ( state->template_instance_recursion_depth < 0 )
+	 || ( state->template_instance_recursion_depth > LIBFWEVT_XML_DOCUMENT_TEMPLATE_INSTANCE_RECURSION_DEPTH ) )
 	{
-		libcnotify_printf(
-		 "%s: data offset\t\t: 0x%08" PRIzx "\n",
-		 function,
-		 binary_data_offset );
-
-		libcnotify_printf(
-		 "%s: optional substitution data:\n",
-		 function );
-		libcnotify_print_data(
-		 xml_document_data,
-		 4,
-		 0 );
+		return( 0 );
 	}
-#endif
-	byte_stream_copy_to_uint16_little_endian(
-	 &( xml_document_data[ 1 ] ),
-	 template_value_index );
-
-	template_value_type = xml_document_data[ 3 ];
+	result = libfwevt_xml_document_read_template_program_instance(
+	          state->internal_xml_document,
+	          state->binary_data,
+	          binary_data_size,
+	          binary_data_offset,
+	          state->ascii_codepage,
+	          state->flags,
+	          state->template_instance_recursion_depth,
+	          &template_definition,
+	          &free_template_definition,
+	          &program,
+	          &template_values_array,
+	          error );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( result == -1 )
 	{
-		libcnotify_printf(
-		 "%s: type\t\t\t: 0x%02" PRIx8 "\n",
-		 function,
-		 xml_document_data[ 0 ] );
-
-		libcnotify_printf(
-		 "%s: identifier\t\t: %" PRIu16 "\n",
-		 function,
-		 template_value_index );
-
-		libcnotify_printf(
-		 "%s: value type\t\t: 0x%02" PRIx8 " (",
-		 function,
-		 template_value_type );
-		libfwevt_debug_print_value_type(
-		 template_value_type );
-		libcnotify_printf(
-		 ")\n" );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read template instance.",
+		 function );
 
-		libcnotify_printf(
-		 "\n" );
+		goto on_error;
 	}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+	else if( result != 0 )
+	{
+		state->internal_xml_document->number_of_active_template_definitions += 1;
+		state->template_instance_recursion_depth += 1;
 
-	xml_token->size = 4;
+		result = libfwevt_xml_template_program_extract_fields(
+		          program,
+		          state->binary_data,
+		          binary_data_size,
+		          template_values_array,
+		          state->field_callback,
+		          state->callback_data,
+		          &libfwevt_xml_document_extract_template_program_instance_fields,
+		          template_program_state,
+		          error );
 
-	result = libfwevt_xml_document_substitute_template_value(
-	          internal_xml_document,
-	          binary_data,
-	          binary_data_size,
-	          ascii_codepage,
-	          flags,
-	          template_values_array,
-	          template_value_index,
-	          template_value_type,
-	          template_value_offset,
-	          xml_tag,
-	          element_recursion_depth,
-	          template_instance_recursion_depth,
-	          error );
+		state->template_instance_recursion_depth -= 1;
+		state->internal_xml_document->number_of_active_template_definitions -= 1;
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to extract fields of template instance.",
+			 function );
 
-	if( result == -1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to substitute template value.",
-		 function );
+			goto on_error;
+		}
+		if( libfwevt_xml_document_free_template_program_instance(
+		     &template_definition,
+		     free_template_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free template instance.",
+			 function );
 
-		return( -1 );
+			goto on_error;
+		}
 	}
 	return( result );
+
+on_error:
+	libfwevt_xml_document_free_template_program_instance(
+	 &template_definition,
+	 free_template_definition,
+	 NULL );
+
+	return( -1 );
 }
 
-/* Reads a PI data from a binary XML document
+/* Retrieves the template values array for a template instance
+ * The template values array and its template values are owned by the binary XML document
+ * and are reused by template instances with the same template instance recursion depth,
+ * so that the template values do not need to be allocated for every template instance
  * Returns 1 if successful or -1 on error
  */
-int libfwevt_xml_document_read_pi_data(
+int libfwevt_xml_document_get_template_values_array(
      libfwevt_internal_xml_document_t *internal_xml_document,
-     libfwevt_xml_token_t *xml_token,
-     const uint8_t *binary_data,
-     size_t binary_data_size,
-     size_t binary_data_offset,
-     libfwevt_xml_tag_t *xml_tag,
-     int ascii_codepage LIBFWEVT_ATTRIBUTE_UNUSED,
+     int template_instance_recursion_depth,
+     int number_of_template_values,
+     libcdata_array_t **template_values_array,
      libcerror_error_t **error )
 {
-	const uint8_t *xml_document_data = NULL;
-	static char *function            = "libfwevt_xml_document_read_pi_data";
-	size_t value_data_size           = 0;
-	size_t xml_document_data_size    = 0;
-
-	LIBFWEVT_UNREFERENCED_PARAMETER( ascii_codepage )
+	libfwevt_xml_template_value_t *template_value = NULL;
+	static char *function                         = "libfwevt_xml_document_get_template_values_array";
+	int number_of_pooled_template_values          = 0;
+	int template_value_index                      = 0;
 
 	if( internal_xml_document == NULL )
 	{
@@ -4052,83 +10512,304 @@ int libfwevt_xml_document_read_pi_data(
 
 		return( -1 );
 	}
-	if( xml_token == NULL )
+	if( ( template_instance_recursion_depth < 0 )
+	 || ( template_instance_recursion_depth > LIBFWEVT_XML_DOCUMENT_TEMPLATE_INSTANCE_RECURSION_DEPTH ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid binary XML token.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid template instance recursion depth value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( xml_token->type != LIBFWEVT_XML_TOKEN_PI_DATA )
+	if( number_of_template_values < 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid binary XML token - unsupported type: 0x%02" PRIx8 ".",
-		 function,
-		 xml_token->type );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of template values value less than zero.",
+		 function );
 
 		return( -1 );
 	}
-	if( binary_data == NULL )
+	if( template_values_array == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid binary data.",
+		 "%s: invalid template values array.",
 		 function );
 
 		return( -1 );
 	}
-	if( binary_data_size > (size_t) SSIZE_MAX )
+	if( internal_xml_document->template_values_pools[ template_instance_recursion_depth ] == NULL )
+	{
+		if( libcdata_array_initialize(
+		     &( internal_xml_document->template_values_pools[ template_instance_recursion_depth ] ),
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create template values pool: %d.",
+			 function,
+			 template_instance_recursion_depth );
+
+			return( -1 );
+		}
+	}
+	if( internal_xml_document->template_values_arrays[ template_instance_recursion_depth ] == NULL )
+	{
+		if( libcdata_array_initialize(
+		     &( internal_xml_document->template_values_arrays[ template_instance_recursion_depth ] ),
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create template values array: %d.",
+			 function,
+			 template_instance_recursion_depth );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_xml_document->template_values_pools[ template_instance_recursion_depth ],
+	     &number_of_pooled_template_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of pooled template values.",
+		 function );
+
+		return( -1 );
+	}
+	/* The template values pool only grows, the template values are freed with the binary XML document
+	 */
+	if( number_of_template_values > number_of_pooled_template_values )
+	{
+		if( libcdata_array_resize(
+		     internal_xml_document->template_values_pools[ template_instance_recursion_depth ],
+		     number_of_template_values,
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfwevt_xml_template_value_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+			 "%s: unable to resize template values pool.",
+			 function );
+
+			return( -1 );
+		}
+		for( template_value_index = number_of_pooled_template_values;
+		     template_value_index < number_of_template_values;
+		     template_value_index++ )
+		{
+			if( libfwevt_xml_template_value_initialize(
+			     &template_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create template value.",
+				 function );
+
+				return( -1 );
+			}
+			if( libcdata_array_set_entry_by_index(
+			     internal_xml_document->template_values_pools[ template_instance_recursion_depth ],
+			     template_value_index,
+			     (intptr_t *) template_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set template value: %d in pool.",
+				 function,
+				 template_value_index );
+
+				libfwevt_xml_template_value_free(
+				 &template_value,
+				 NULL );
+
+				return( -1 );
+			}
+			template_value = NULL;
+		}
+	}
+	/* The template values array does not own its entries and is emptied before it is
+	 * resized so that the number of entries matches the number of template values
+	 */
+	if( libcdata_array_empty(
+	     internal_xml_document->template_values_arrays[ template_instance_recursion_depth ],
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty template values array.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_resize(
+	     internal_xml_document->template_values_arrays[ template_instance_recursion_depth ],
+	     number_of_template_values,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize template values array.",
+		 function );
+
+		return( -1 );
+	}
+	for( template_value_index = 0;
+	     template_value_index < number_of_template_values;
+	     template_value_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_xml_document->template_values_pools[ template_instance_recursion_depth ],
+		     template_value_index,
+		     (intptr_t **) &template_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve template value: %d from pool.",
+			 function,
+			 template_value_index );
+
+			return( -1 );
+		}
+		if( libfwevt_xml_template_value_reset(
+		     template_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to reset template value: %d.",
+			 function,
+			 template_value_index );
+
+			return( -1 );
+		}
+		if( libcdata_array_set_entry_by_index(
+		     internal_xml_document->template_values_arrays[ template_instance_recursion_depth ],
+		     template_value_index,
+		     (intptr_t *) template_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set template value: %d in array.",
+			 function,
+			 template_value_index );
+
+			return( -1 );
+		}
+	}
+	*template_values_array = internal_xml_document->template_values_arrays[ template_instance_recursion_depth ];
+
+	return( 1 );
+}
+
+/* Reads the template instance values from a binary XML document
+ * The template values array is owned by the binary XML document and remains valid until
+ * another template instance with the same template instance recursion depth is read
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_read_template_instance_values(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     int template_instance_recursion_depth,
+     libcdata_array_t **template_values_array,
+     size_t *template_values_size,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *safe_template_values_array  = NULL;
+	libfwevt_xml_template_value_t *template_value = NULL;
+	static char *function                         = "libfwevt_xml_document_read_template_instance_values";
+	size_t safe_template_values_size              = 0;
+	size_t template_value_definitions_data_size   = 0;
+	size_t template_values_data_size              = 0;
+	uint32_t number_of_template_values            = 0;
+	uint32_t template_value_index                 = 0;
+	uint16_t template_value_data_size             = 0;
+	uint8_t template_value_type                   = 0;
+
+	if( internal_xml_document == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid binary XML document data size value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
 		 function );
 
 		return( -1 );
 	}
-	if( binary_data_offset >= binary_data_size )
+	if( ( binary_data_size < 4 )
+	 || ( binary_data_offset >= ( binary_data_size - 4 ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid binary data offset value out of bounds.",
+		 "%s: invalid binary data size value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( xml_tag == NULL )
+	if( template_values_array == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid XML tag.",
+		 "%s: invalid template values array.",
 		 function );
 
 		return( -1 );
 	}
-	xml_document_data      = &( binary_data[ binary_data_offset ] );
-	xml_document_data_size = binary_data_size - binary_data_offset;
-
-	if( xml_document_data_size < 3 )
+	if( template_values_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid binary XML document data size value too small.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template values size.",
 		 function );
 
 		return( -1 );
@@ -4137,50 +10818,48 @@ int libfwevt_xml_document_read_pi_data(
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		 "%s: data offset\t\t: 0x%08" PRIzx "\n",
+		 "%s: data offset\t: 0x%08" PRIzx "\n",
 		 function,
 		 binary_data_offset );
 
 		libcnotify_printf(
-		 "%s: PI data:\n",
+		 "%s: template instance data:\n",
 		 function );
 		libcnotify_print_data(
-		 xml_document_data,
-		 3,
+		 &( binary_data[ binary_data_offset ] ),
+		 4,
 		 0 );
-	}
-#endif
-	byte_stream_copy_to_uint16_little_endian(
-	 &( xml_document_data[ 1 ] ),
-	 value_data_size );
+	}
+#endif
+	byte_stream_copy_to_uint32_little_endian(
+	 &( binary_data[ binary_data_offset ] ),
+	 number_of_template_values );
 
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		 "%s: type\t\t\t\t: 0x%02" PRIx8 "\n",
+		 "%s: number of values\t: %" PRIu32 "\n",
 		 function,
-		 xml_document_data[ 0 ] );
+		 number_of_template_values );
 
 		libcnotify_printf(
-		 "%s: number of characters\t\t: %" PRIzd "\n",
-		 function,
-		 value_data_size );
+		 "\n" );
 	}
 #endif
-	xml_token->size     = 3;
-	binary_data_offset += 3;
+	safe_template_values_size = 4;
+	binary_data_offset       += 4;
 
-	value_data_size *= 2;
+	template_value_definitions_data_size = number_of_template_values * 4;
 
-	if( ( value_data_size > binary_data_size )
-	 || ( binary_data_offset >= ( binary_data_size - value_data_size ) ) )
+	if( ( template_value_definitions_data_size > binary_data_size )
+	 || ( binary_data_offset >= ( binary_data_size - template_value_definitions_data_size ) ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid value data size value out of bounds.",
+		 "%s: invalid template value definitions data size value out of bounds.",
 		 function );
 
 		return( -1 );
@@ -4189,44 +10868,133 @@ int libfwevt_xml_document_read_pi_data(
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		 "%s: data offset\t\t: 0x%08" PRIzx "\n",
+		 "%s: data offset\t: 0x%08" PRIzx "\n",
 		 function,
 		 binary_data_offset );
 
 		libcnotify_printf(
-		 "%s: value data:\n",
+		 "%s: template instance value descriptor data:\n",
 		 function );
 		libcnotify_print_data(
-		 &( xml_document_data[ 3 ] ),
-		 value_data_size,
+		 &( binary_data[ binary_data_offset ] ),
+		 template_value_definitions_data_size,
 		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
 	}
 #endif
-	if( libfwevt_xml_tag_set_value_type(
-	     xml_tag,
-	     LIBFWEVT_VALUE_TYPE_STRING_UTF16,
+	if( libfwevt_xml_document_get_template_values_array(
+	     internal_xml_document,
+	     template_instance_recursion_depth,
+	     (int) number_of_template_values,
+	     &safe_template_values_array,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set value type.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve template values array.",
 		 function );
 
 		return( -1 );
 	}
-	if( libfwevt_xml_tag_set_value_data(
-	     xml_tag,
-	     &( binary_data[ binary_data_offset ] ),
-	     value_data_size,
-	     error ) != 1 )
+	for( template_value_index = 0;
+	     template_value_index < number_of_template_values;
+	     template_value_index++ )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( binary_data[ binary_data_offset ] ),
+		 template_value_data_size );
+
+		template_value_type = binary_data[ binary_data_offset + 2 ];
+
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: value: %02" PRIu32 " size\t: %" PRIu16 "\n",
+			 function,
+			 template_value_index,
+			 template_value_data_size );
+
+			libcnotify_printf(
+			 "%s: value: %02" PRIu32 " type\t: 0x%02" PRIx8 " (",
+			 function,
+			 template_value_index,
+			 template_value_type );
+			libfwevt_debug_print_value_type(
+			 template_value_type );
+			libcnotify_printf(
+			 ")\n" );
+
+			libcnotify_printf(
+			 "%s: value: %02" PRIu32 " unknown1\t: 0x%02" PRIx8 "\n",
+			 function,
+			 template_value_index,
+			 binary_data[ binary_data_offset + 3 ] );
+
+			libcnotify_printf(
+			 "\n" );
+		}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+		safe_template_values_size += 4;
+		binary_data_offset        += 4;
+
+		template_values_data_size += template_value_data_size;
+
+		if( libcdata_array_get_entry_by_index(
+		     safe_template_values_array,
+		     (int) template_value_index,
+		     (intptr_t **) &template_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve template value: %" PRIu32 " from array.",
+			 function,
+			 template_value_index );
+
+			return( -1 );
+		}
+		if( libfwevt_xml_template_value_set_type(
+		     template_value,
+		     template_value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set template value type.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwevt_xml_template_value_set_size(
+		     template_value,
+		     template_value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set template value data size.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( ( template_values_data_size > binary_data_size )
+	 || ( binary_data_offset >= ( binary_data_size - template_values_data_size ) ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set value data.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid template values data size value out of bounds.",
 		 function );
 
 		return( -1 );
@@ -4234,54 +11002,122 @@ int libfwevt_xml_document_read_pi_data(
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
-		if( libfwevt_xml_tag_debug_print_value_data_segment(
-		     xml_tag,
-		     0,
-		     0,
-		     ascii_codepage,
+		libcnotify_printf(
+		 "%s: data offset\t: 0x%08" PRIzx "\n",
+		 function,
+		 binary_data_offset );
+
+		libcnotify_printf(
+		 "%s: values data:\n",
+		 function );
+		libcnotify_print_data(
+		 &( binary_data[ binary_data_offset ] ),
+		 template_values_data_size,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+	}
+#endif
+	for( template_value_index = 0;
+	     template_value_index < number_of_template_values;
+	     template_value_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     safe_template_values_array,
+		     (int) template_value_index,
+		     (intptr_t **) &template_value,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print value data segment: 0.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve template value: %" PRIu32 " from array.",
+			 function,
+			 template_value_index );
+
+			return( -1 );
+		}
+		if( libfwevt_xml_template_value_get_size(
+		     template_value,
+		     &template_value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve template value data size.",
 			 function );
 
 			return( -1 );
 		}
-	}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+#if defined( HAVE_DEBUG_OUTPUT )
+		if( libcnotify_verbose != 0 )
+		{
+			libcnotify_printf(
+			 "%s: data offset\t: 0x%08" PRIzx "\n",
+			 function,
+			 binary_data_offset );
 
-	xml_token->size += value_data_size;
+			libcnotify_printf(
+			 "%s: value: %02" PRIu32 " data:\n",
+			 function,
+			 template_value_index );
+			libcnotify_print_data(
+			 &( binary_data[ binary_data_offset ] ),
+			 template_value_data_size,
+			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+		}
+#endif
+		/* Note that template_value_data_size is allowed to be 0.
+		 * Don't set the template value offset in such a case.
+		 */
+		if( template_value_data_size == 0 )
+		{
+			continue;
+		}
+		if( libfwevt_xml_template_value_set_offset(
+		     template_value,
+		     binary_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set template value data offset.",
+			 function );
+
+			return( -1 );
+		}
+		binary_data_offset += template_value_data_size;
+	}
+	*template_values_array = safe_template_values_array;
+	*template_values_size  = safe_template_values_size + template_values_data_size;
 
 	return( 1 );
 }
 
-/* Reads a PI target from a binary XML document
+/* Reads a value from a binary XML document
  * Returns 1 if successful or -1 on error
  */
-int libfwevt_xml_document_read_pi_target(
+int libfwevt_xml_document_read_value(
      libfwevt_internal_xml_document_t *internal_xml_document,
      libfwevt_xml_token_t *xml_token,
      const uint8_t *binary_data,
      size_t binary_data_size,
      size_t binary_data_offset,
-     uint8_t flags,
      libfwevt_xml_tag_t *xml_tag,
-     int ascii_codepage,
+     int ascii_codepage LIBFWEVT_ATTRIBUTE_UNUSED,
      libcerror_error_t **error )
 {
-	libfwevt_xml_tag_t *pi_xml_tag      = NULL;
-	libfwevt_xml_token_t *xml_sub_token = NULL;
-	const uint8_t *xml_document_data    = NULL;
-	static char *function               = "libfwevt_xml_document_read_pi_target";
-	size_t additional_value_size        = 0;
-	size_t trailing_data_size           = 0;
-	size_t xml_document_data_offset     = 0;
-	size_t xml_document_data_size       = 0;
-	uint32_t pi_name_offset             = 0;
-	uint32_t pi_name_size               = 0;
+	const uint8_t *xml_document_data = NULL;
+	static char *function            = "libfwevt_xml_document_read_value";
+	size_t value_data_size           = 0;
+	size_t xml_document_data_size    = 0;
+	uint8_t value_type               = 0;
+	int data_segment_index           = 0;
+
+	LIBFWEVT_UNREFERENCED_PARAMETER( ascii_codepage )
 
 	if( internal_xml_document == NULL )
 	{
@@ -4305,7 +11141,7 @@ int libfwevt_xml_document_read_pi_target(
 
 		return( -1 );
 	}
-	if( xml_token->type != LIBFWEVT_XML_TOKEN_PI_TARGET )
+	if( ( xml_token->type & 0xbf ) != LIBFWEVT_XML_TOKEN_VALUE )
 	{
 		libcerror_error_set(
 		 error,
@@ -4361,14 +11197,10 @@ int libfwevt_xml_document_read_pi_target(
 
 		return( -1 );
 	}
-	if( ( flags & LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS ) != 0 )
-	{
-		additional_value_size = 4;
-	}
 	xml_document_data      = &( binary_data[ binary_data_offset ] );
 	xml_document_data_size = binary_data_size - binary_data_offset;
 
-	if( xml_document_data_size < ( 1 + additional_value_size ) )
+	if( xml_document_data_size < 4 )
 	{
 		libcerror_error_set(
 		 error,
@@ -4379,302 +11211,647 @@ int libfwevt_xml_document_read_pi_target(
 
 		return( -1 );
 	}
-	if( libfwevt_xml_tag_initialize(
-	     &pi_xml_tag,
-	     error ) != 1 )
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create PI XML tag.",
+		libcnotify_printf(
+		 "%s: data offset\t\t\t\t: 0x%08" PRIzx "\n",
+		 function,
+		 binary_data_offset );
+
+		libcnotify_printf(
+		 "%s: value data:\n",
 		 function );
+		libcnotify_print_data(
+		 xml_document_data,
+		 4,
+		 0 );
+	}
+#endif
+	value_type = xml_document_data[ 1 ];
 
-		goto on_error;
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: type\t\t\t\t\t: 0x%02" PRIx8 "\n",
+		 function,
+		 xml_document_data[ 0 ] );
+
+		libcnotify_printf(
+		 "%s: value type\t\t\t\t: 0x%02" PRIx8 " (",
+		 function,
+		 value_type );
+		libfwevt_debug_print_value_type(
+		 value_type );
+		libcnotify_printf(
+		 ")\n" );
 	}
-	if( libfwevt_xml_tag_set_type(
-	     pi_xml_tag,
-	     LIBFWEVT_XML_TAG_TYPE_PI,
-	     error ) != 1 )
+#endif
+	xml_token->size     = 4;
+	binary_data_offset += 4;
+
+	switch( value_type )
+	{
+		case LIBFWEVT_VALUE_TYPE_STRING_UTF16:
+			byte_stream_copy_to_uint16_little_endian(
+			 &( xml_document_data[ 2 ] ),
+			 value_data_size );
+
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: number of characters\t\t\t: %" PRIzd "\n",
+				 function,
+				 value_data_size );
+			}
+#endif
+			value_data_size *= 2;
+
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value type: 0x%02" PRIx8 ".",
+			 function,
+			 value_type );
+
+			return( -1 );
+	}
+	if( ( value_data_size > binary_data_size )
+	 || ( binary_data_offset >= ( binary_data_size - value_data_size ) ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set XML tag type.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value data size value out of bounds.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		 "%s: data offset\t\t: 0x%08" PRIzx "\n",
+		 "%s: data offset\t\t\t\t: 0x%08" PRIzx "\n",
 		 function,
 		 binary_data_offset );
 
 		libcnotify_printf(
-		 "%s: PI target data:\n",
+		 "%s: value data:\n",
 		 function );
 		libcnotify_print_data(
-		 xml_document_data,
-		 1 + additional_value_size,
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+		 &( binary_data[ binary_data_offset ] ),
+		 value_data_size,
+		 0 );
 	}
 #endif
+	if( libfwevt_xml_tag_set_value_type(
+	     xml_tag,
+	     value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_append_value_data(
+	     xml_tag,
+	     &( binary_data[ binary_data_offset ] ),
+	     value_data_size,
+	     internal_xml_document->data_segment_flags,
+	     &data_segment_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append value data.",
+		 function );
+
+		return( -1 );
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
-		libcnotify_printf(
-		 "%s: type\t\t\t: 0x%02" PRIx8 "\n",
-		 function,
-		 xml_document_data[ 0 ] );
+		if( libfwevt_xml_tag_debug_print_value_data_segment(
+		     xml_tag,
+		     data_segment_index,
+		     0,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+			 "%s: unable to print value data segment: %d.",
+			 function,
+			 data_segment_index );
+
+			return( -1 );
+		}
 	}
-#endif
-	xml_token->size          = 1;
-	xml_document_data_offset = 1;
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-	if( ( flags & LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS ) == 0 )
+	xml_token->size += value_data_size;
+
+	return( 1 );
+}
+
+/* Sets the name of a XML tag
+ * If the binary XML document was read with LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS
+ * the name is interned, so that XML tags with the same name share one copy of the name
+ * While parsing with callbacks the name is not copied since the XML tag is freed
+ * before parsing returns
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_set_xml_tag_name(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     libfwevt_xml_tag_t *xml_tag,
+     uint8_t flags,
+     uint32_t name_offset,
+     uint16_t name_hash,
+     const uint8_t *name_data,
+     size_t name_data_size,
+     libcerror_error_t **error )
+{
+	const uint8_t *interned_name_data = NULL;
+	static char *function             = "libfwevt_xml_document_set_xml_tag_name";
+	int result                        = 0;
+
+	if( internal_xml_document == NULL )
 	{
-		/* TODO double check if this needs to be binary_data_offset + xml_document_data_offset + 1
-		 */
-		pi_name_offset = (uint32_t) ( binary_data_offset + xml_document_data_offset );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
+		 function );
+
+		return( -1 );
 	}
-	else
+	if( internal_xml_document->parse_state != NULL )
 	{
-		if( ( xml_document_data_size < 4 )
-		 || ( xml_document_data_offset >= ( xml_document_data_size - 4 ) ) )
+		interned_name_data = name_data;
+
+		result = 1;
+	}
+	else if( ( ( flags & LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS ) != 0 )
+	      && ( internal_xml_document->name_table != NULL ) )
+	{
+		result = libfwevt_xml_name_table_intern_name(
+		          internal_xml_document->name_table,
+		          name_offset,
+		          name_hash,
+		          name_data,
+		          name_data_size,
+		          &interned_name_data,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid binary XML document data size value too small.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve interned name.",
 			 function );
 
-			goto on_error;
-		}
-		byte_stream_copy_to_uint32_little_endian(
-		 &( xml_document_data[ xml_document_data_offset ] ),
-		 pi_name_offset );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: name offset\t\t\t: 0x%08" PRIx32 "\n",
-			 function,
-			 pi_name_offset );
+			return( -1 );
 		}
-#endif
-		xml_token->size           = 4;
-/* TODO
-		xml_document_data_offset += 4;
-*/
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	if( result != 0 )
 	{
-		libcnotify_printf(
-		 "\n" );
+		result = libfwevt_xml_tag_set_interned_name_data(
+		          xml_tag,
+		          interned_name_data,
+		          name_data_size,
+		          error );
 	}
-#endif
+	else
+	{
+		result = libfwevt_xml_tag_set_name_data(
+		          xml_tag,
+		          name_data,
+		          name_data_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set name data.",
+		 function );
 
-	/* TODO double check setting this to 5 but this is currently needed
-	 * likely because of additional_value_size when LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS is not set
-	 */
-	xml_token->size          = 5;
-	xml_document_data_offset = 5;
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Substitutes the template values into a template definition
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_substitute_template_definition(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     libfwevt_xml_template_definition_t *template_definition,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     int ascii_codepage,
+     uint8_t flags,
+     libcdata_array_t *template_values_array,
+     libfwevt_xml_tag_t *xml_tag,
+     int element_recursion_depth,
+     int template_instance_recursion_depth,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_xml_document_substitute_template_definition";
+	int node_index        = 0;
 
-	if( pi_name_offset > ( binary_data_offset + xml_document_data_offset ) )
+	if( template_definition == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid PI name offset value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
 		 function );
 
-		goto on_error;
-	}
-	if( ( binary_data_offset + xml_document_data_offset ) < pi_name_offset )
-	{
-		trailing_data_size = pi_name_offset - ( binary_data_offset + xml_document_data_offset );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: data offset\t\t: 0x%08" PRIzx "\n",
-			 function,
-			 binary_data_offset + 5 );
-
-			libcnotify_printf(
-			 "%s: trailing data:\n",
-			 function );
-			libcnotify_print_data(
-			 &( xml_document_data[ 5 ] ),
-			 trailing_data_size,
-			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-		}
-#endif
-		xml_token->size          += trailing_data_size;
-		xml_document_data_offset += trailing_data_size;
+		return( -1 );
 	}
-	if( libfwevt_xml_document_read_name(
+	if( libfwevt_xml_document_substitute_template_definition_element(
 	     internal_xml_document,
+	     template_definition,
+	     &node_index,
 	     binary_data,
 	     binary_data_size,
-	     pi_name_offset,
+	     ascii_codepage,
 	     flags,
-	     &pi_name_size,
-	     pi_xml_tag,
+	     template_values_array,
+	     xml_tag,
+	     element_recursion_depth,
+	     template_instance_recursion_depth,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read PI name.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to substitute element.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( ( binary_data_offset + xml_document_data_offset ) == pi_name_offset )
+	if( node_index != template_definition->number_of_nodes )
 	{
-		xml_token->size          += pi_name_size;
-		xml_document_data_offset += pi_name_size;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid template definition - number of nodes value out of bounds.",
+		 function );
+
+		return( -1 );
 	}
-	if( libfwevt_xml_token_initialize(
-	     &xml_sub_token,
-	     error ) != 1 )
+	return( 1 );
+}
+
+/* Substitutes the template values into an attribute node of a template definition
+ * The attribute node is followed by a literal or substitution node
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_substitute_template_definition_attribute(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     libfwevt_xml_template_definition_t *template_definition,
+     int node_index,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     int ascii_codepage,
+     uint8_t flags,
+     libcdata_array_t *template_values_array,
+     libfwevt_xml_tag_t *xml_tag,
+     int element_recursion_depth,
+     int template_instance_recursion_depth,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_tag_t *attribute_xml_tag       = NULL;
+	libfwevt_xml_template_node_t *content_node  = NULL;
+	libfwevt_xml_token_t *xml_sub_token         = NULL;
+	const uint8_t *name_data                    = NULL;
+	static char *function                       = "libfwevt_xml_document_substitute_template_definition_attribute";
+	size_t name_data_size                       = 0;
+	size_t template_value_offset                = 0;
+	uint16_t name_hash                          = 0;
+	int result                                  = 0;
+	int template_value_array_recursion_depth    = 0;
+
+	if( internal_xml_document == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create binary XML sub token.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfwevt_xml_token_read_data(
-	     xml_sub_token,
-	     binary_data,
-	     binary_data_size,
-	     binary_data_offset + xml_document_data_offset,
-	     error ) != 1 )
+	if( template_definition == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read binary XML sub token.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfwevt_xml_document_read_pi_data(
-	     internal_xml_document,
-	     xml_sub_token,
-	     binary_data,
-	     binary_data_size,
-	     binary_data_offset + xml_document_data_offset,
-	     pi_xml_tag,
-	     ascii_codepage,
+	if( ( node_index < 0 )
+	 || ( node_index >= ( template_definition->number_of_nodes - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid node index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_template_definition_get_node_name(
+	     template_definition,
+	     &( template_definition->nodes[ node_index ] ),
+	     &name_data,
+	     &name_data_size,
+	     &name_hash,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read PI target.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve attribute name.",
 		 function );
 
 		goto on_error;
 	}
-	xml_token->size += xml_sub_token->size;
+	content_node = &( template_definition->nodes[ node_index + 1 ] );
 
-	if( libfwevt_xml_token_free(
+	if( libfwevt_xml_token_initialize(
 	     &xml_sub_token,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free binary XML sub token.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create binary XML sub token.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfwevt_xml_tag_append_element(
-	     xml_tag,
-	     pi_xml_tag,
+	do
+	{
+		if( ( template_value_array_recursion_depth < 0 )
+		 || ( template_value_array_recursion_depth > LIBFWEVT_XML_DOCUMENT_TEMPLATE_VALUE_ARRAY_RECURSION_DEPTH ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid template value array recursion depth value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfwevt_xml_tag_initialize_with_arena(
+		     &attribute_xml_tag,
+		     internal_xml_document->arena,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create attribute XML tag.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfwevt_xml_document_set_xml_tag_name(
+		     internal_xml_document,
+		     attribute_xml_tag,
+		     flags,
+		     template_definition->nodes[ node_index ].name_offset,
+		     name_hash,
+		     name_data,
+		     name_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set attribute name.",
+			 function );
+
+			goto on_error;
+		}
+		result = 1;
+
+		if( content_node->type == LIBFWEVT_XML_TEMPLATE_NODE_TYPE_LITERAL )
+		{
+			if( template_value_offset != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid template value offset value out of bounds.",
+				 function );
+
+				goto on_error;
+			}
+			xml_sub_token->type = content_node->token_type;
+
+			if( libfwevt_xml_document_read_value(
+			     internal_xml_document,
+			     xml_sub_token,
+			     binary_data,
+			     binary_data_size,
+			     template_definition->offset + content_node->data_offset,
+			     attribute_xml_tag,
+			     ascii_codepage,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read value.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else if( content_node->type == LIBFWEVT_XML_TEMPLATE_NODE_TYPE_SUBSTITUTION )
+		{
+			result = libfwevt_xml_document_substitute_template_value(
+			          internal_xml_document,
+			          binary_data,
+			          binary_data_size,
+			          ascii_codepage,
+			          flags,
+			          template_values_array,
+			          content_node->value_index,
+			          content_node->value_type,
+			          &template_value_offset,
+			          attribute_xml_tag,
+			          element_recursion_depth,
+			          template_instance_recursion_depth,
+			          error );
+
+			if( ( result == -1 )
+			 || ( ( result == 0 )
+			  &&  ( content_node->token_type == LIBFWEVT_XML_TOKEN_NORMAL_SUBSTITUTION ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to substitute template value.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		else
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: invalid template definition - unsupported node type: %" PRIu8 ".",
+			 function,
+			 content_node->type );
+
+			goto on_error;
+		}
+		if( result != 0 )
+		{
+			if( libfwevt_xml_tag_append_attribute(
+			     xml_tag,
+			     attribute_xml_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append attribute to XML tag.",
+				 function );
+
+				goto on_error;
+			}
+			attribute_xml_tag = NULL;
+		}
+		template_value_array_recursion_depth++;
+	}
+	while( template_value_offset > 0 );
+
+	if( attribute_xml_tag != NULL )
+	{
+		if( libfwevt_internal_xml_tag_free(
+		     (libfwevt_internal_xml_tag_t **) &attribute_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free attribute XML tag.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfwevt_xml_token_free(
+	     &xml_sub_token,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append PI to XML tag.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free binary XML sub token.",
 		 function );
 
 		goto on_error;
 	}
-	pi_xml_tag = NULL;
-
 	return( 1 );
 
 on_error:
-	if( xml_sub_token != NULL )
+	if( attribute_xml_tag != NULL )
 	{
-		libfwevt_xml_token_free(
-		 &xml_sub_token,
+		libfwevt_internal_xml_tag_free(
+		 (libfwevt_internal_xml_tag_t **) &attribute_xml_tag,
 		 NULL );
 	}
-	if( pi_xml_tag != NULL )
+	if( xml_sub_token != NULL )
 	{
-		libfwevt_internal_xml_tag_free(
-		 (libfwevt_internal_xml_tag_t **) &pi_xml_tag,
+		libfwevt_xml_token_free(
+		 &xml_sub_token,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Reads a template instance from a binary XML document
+/* Substitutes the template values into an element node of a template definition
+ * On return the node index refers to the node after the end element node
  * Returns 1 if successful or -1 on error
  */
-int libfwevt_xml_document_read_template_instance(
+int libfwevt_xml_document_substitute_template_definition_element(
      libfwevt_internal_xml_document_t *internal_xml_document,
-     libfwevt_xml_token_t *xml_token,
+     libfwevt_xml_template_definition_t *template_definition,
+     int *node_index,
      const uint8_t *binary_data,
      size_t binary_data_size,
-     size_t binary_data_offset,
      int ascii_codepage,
      uint8_t flags,
+     libcdata_array_t *template_values_array,
      libfwevt_xml_tag_t *xml_tag,
      int element_recursion_depth,
      int template_instance_recursion_depth,
      libcerror_error_t **error )
 {
-	libcdata_array_t *template_values_array  = NULL;
+	libfwevt_xml_tag_t *element_xml_tag      = NULL;
+	libfwevt_xml_template_node_t *node       = NULL;
 	libfwevt_xml_token_t *xml_sub_token      = NULL;
-	const uint8_t *xml_document_data         = NULL;
-	static char *function                    = "libfwevt_xml_document_read_template_instance";
-	size_t template_data_offset              = 0;
-	size_t template_data_size                = 0;
-	size_t template_values_data_offset       = 0;
-	size_t template_values_data_size         = 0;
-	size_t trailing_data_size                = 0;
-	size_t xml_document_data_size            = 0;
-	uint32_t template_definition_data_offset = 0;
-	uint32_t template_definition_data_size   = 0;
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	uint32_t value_32bit                     = 0;
-#endif
+	const uint8_t *name_data                 = NULL;
+	static char *function                    = "libfwevt_xml_document_substitute_template_definition_element";
+	size_t name_data_size                    = 0;
+	size_t template_value_offset             = 0;
+	uint16_t name_hash                       = 0;
+	uint8_t is_filtered                      = 0;
+	int content_node_index                   = 0;
+	int element_node_index                   = 0;
+	int end_node_index                       = 0;
+	int result                               = 0;
+	int template_value_array_recursion_depth = 0;
 
 	if( internal_xml_document == NULL )
 	{
@@ -4687,833 +11864,1223 @@ int libfwevt_xml_document_read_template_instance(
 
 		return( -1 );
 	}
-	if( xml_token == NULL )
+	if( template_definition == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid binary XML token.",
+		 "%s: invalid template definition.",
 		 function );
 
 		return( -1 );
 	}
-	if( xml_token->type != LIBFWEVT_XML_TOKEN_TEMPLATE_INSTANCE )
+	if( node_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid binary XML token - unsupported type: 0x%02" PRIx8 ".",
-		 function,
-		 xml_token->type );
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node index.",
+		 function );
 
 		return( -1 );
 	}
-	if( binary_data == NULL )
+	element_node_index = *node_index;
+
+	if( ( element_node_index < 0 )
+	 || ( element_node_index >= template_definition->number_of_nodes )
+	 || ( template_definition->nodes[ element_node_index ].type != LIBFWEVT_XML_TEMPLATE_NODE_TYPE_ELEMENT ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid binary data.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid node index value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( binary_data_size > (size_t) SSIZE_MAX )
+	end_node_index = template_definition->nodes[ element_node_index ].end_node_index;
+
+	if( ( end_node_index <= element_node_index )
+	 || ( end_node_index >= template_definition->number_of_nodes ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid binary XML document data size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid template definition - end node index value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( binary_data_offset >= binary_data_size )
+	if( ( element_recursion_depth < 0 )
+	 || ( element_recursion_depth > LIBFWEVT_XML_DOCUMENT_ELEMENT_RECURSION_DEPTH ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid binary data offset value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid element recursion depth value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( template_instance_recursion_depth < 0 )
-	 || ( template_instance_recursion_depth > LIBFWEVT_XML_DOCUMENT_TEMPLATE_INSTANCE_RECURSION_DEPTH ) )
+	if( libfwevt_xml_template_definition_get_node_name(
+	     template_definition,
+	     &( template_definition->nodes[ element_node_index ] ),
+	     &name_data,
+	     &name_data_size,
+	     &name_hash,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid template instance recursion depth value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve element name.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	xml_document_data      = &( binary_data[ binary_data_offset ] );
-	xml_document_data_size = binary_data_size - binary_data_offset;
-
-	if( ( binary_data_size < 10 )
-	 || ( binary_data_offset >= ( binary_data_size - 10 ) ) )
+	if( libfwevt_xml_token_initialize(
+	     &xml_sub_token,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid binary XML document data size value too small.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create binary XML sub token.",
 		 function );
 
 		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
+	do
 	{
-		libcnotify_printf(
-		 "%s: data offset\t\t: 0x%08" PRIzx "\n",
-		 function,
-		 binary_data_offset );
+		if( ( template_value_array_recursion_depth < 0 )
+		 || ( template_value_array_recursion_depth > LIBFWEVT_XML_DOCUMENT_TEMPLATE_VALUE_ARRAY_RECURSION_DEPTH ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid template value array recursion depth value out of bounds.",
+			 function );
 
-		libcnotify_printf(
-		 "%s: template instance header data:\n",
-		 function );
-		libcnotify_print_data(
-		 xml_document_data,
-		 10,
-		 0 );
-	}
-#endif
-	byte_stream_copy_to_uint32_little_endian(
-	 &( xml_document_data[ 6 ] ),
-	 template_definition_data_offset );
+			goto on_error;
+		}
+		is_filtered = 0;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: type\t\t\t: 0x%02" PRIx8 "\n",
-		 function,
-		 xml_document_data[ 0 ] );
+		if( internal_xml_document->parse_state != NULL )
+		{
+			if( libfwevt_xml_document_push_parse_element(
+			     internal_xml_document,
+			     name_data,
+			     name_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to push parse element.",
+				 function );
+
+				goto on_error;
+			}
+			result = libfwevt_xml_document_filter_parse_element(
+			          internal_xml_document,
+			          0,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to filter parse element.",
+				 function );
+
+				goto on_error;
+			}
+			is_filtered = (uint8_t) ( result == 0 );
+		}
+		/* No XML tag is created for an element of which the name cannot match the path filter
+		 */
+		if( is_filtered == 0 )
+		{
+			if( internal_xml_document->parse_state != NULL )
+			{
+				if( libfwevt_xml_document_get_parse_element_xml_tag(
+				     internal_xml_document,
+				     &element_xml_tag,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve parse element XML tag.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			else if( libfwevt_xml_tag_initialize_with_arena(
+			          &element_xml_tag,
+			          internal_xml_document->arena,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create element XML tag.",
+				 function );
+
+				goto on_error;
+			}
+			if( libfwevt_xml_document_set_xml_tag_name(
+			     internal_xml_document,
+			     element_xml_tag,
+			     flags,
+			     template_definition->nodes[ element_node_index ].name_offset,
+			     name_hash,
+			     name_data,
+			     name_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set element name.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		/* The attribute and content nodes of an element that cannot match the path filter are skipped
+		 */
+		if( is_filtered != 0 )
+		{
+			content_node_index = end_node_index;
+		}
+		else
+		{
+			content_node_index = element_node_index + 1;
+		}
+
+		while( ( content_node_index < end_node_index )
+		    && ( template_definition->nodes[ content_node_index ].type == LIBFWEVT_XML_TEMPLATE_NODE_TYPE_ATTRIBUTE ) )
+		{
+			if( libfwevt_xml_document_substitute_template_definition_attribute(
+			     internal_xml_document,
+			     template_definition,
+			     content_node_index,
+			     binary_data,
+			     binary_data_size,
+			     ascii_codepage,
+			     flags,
+			     template_values_array,
+			     element_xml_tag,
+			     element_recursion_depth,
+			     template_instance_recursion_depth,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to substitute attribute.",
+				 function );
+
+				goto on_error;
+			}
+			content_node_index += 2;
+		}
+		if( ( is_filtered == 0 )
+		 && ( internal_xml_document->parse_state != NULL ) )
+		{
+			result = libfwevt_xml_document_filter_parse_element(
+			          internal_xml_document,
+			          1,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to filter parse element.",
+				 function );
+
+				goto on_error;
+			}
+			if( result == 0 )
+			{
+				is_filtered        = 1;
+				content_node_index = end_node_index;
+			}
+		}
+		result = (int) ( is_filtered == 0 );
+
+		while( content_node_index < end_node_index )
+		{
+			node = &( template_definition->nodes[ content_node_index ] );
+
+			switch( node->type )
+			{
+				case LIBFWEVT_XML_TEMPLATE_NODE_TYPE_ELEMENT:
+					if( libfwevt_xml_document_substitute_template_definition_element(
+					     internal_xml_document,
+					     template_definition,
+					     &content_node_index,
+					     binary_data,
+					     binary_data_size,
+					     ascii_codepage,
+					     flags,
+					     template_values_array,
+					     element_xml_tag,
+					     element_recursion_depth + 1,
+					     template_instance_recursion_depth,
+					     error ) != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+						 "%s: unable to substitute element.",
+						 function );
+
+						goto on_error;
+					}
+					break;
+
+				case LIBFWEVT_XML_TEMPLATE_NODE_TYPE_LITERAL:
+					if( template_value_offset != 0 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+						 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: invalid template value offset value out of bounds.",
+						 function );
+
+						goto on_error;
+					}
+					xml_sub_token->type = node->token_type;
+
+					switch( node->token_type & 0xbf )
+					{
+						case LIBFWEVT_XML_TOKEN_CDATA_SECTION:
+							result = libfwevt_xml_document_read_cdata_section(
+							          internal_xml_document,
+							          xml_sub_token,
+							          binary_data,
+							          binary_data_size,
+							          template_definition->offset + node->data_offset,
+							          element_xml_tag,
+							          ascii_codepage,
+							          error );
+							break;
+
+						case LIBFWEVT_XML_TOKEN_CHARACTER_REFERENCE:
+							result = libfwevt_xml_document_read_character_reference(
+							          internal_xml_document,
+							          xml_sub_token,
+							          binary_data,
+							          binary_data_size,
+							          template_definition->offset + node->data_offset,
+							          element_xml_tag,
+							          ascii_codepage,
+							          error );
+							break;
+
+						default:
+							result = libfwevt_xml_document_read_value(
+							          internal_xml_document,
+							          xml_sub_token,
+							          binary_data,
+							          binary_data_size,
+							          template_definition->offset + node->data_offset,
+							          element_xml_tag,
+							          ascii_codepage,
+							          error );
+							break;
+					}
+					if( result != 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_IO,
+						 LIBCERROR_IO_ERROR_READ_FAILED,
+						 "%s: unable to read literal.",
+						 function );
 
-		libcnotify_printf(
-		 "%s: unknown1\t\t\t: %" PRIu8 "\n",
-		 function,
-		 xml_document_data[ 1 ] );
+						goto on_error;
+					}
+					if( internal_xml_document->parse_state != NULL )
+					{
+						if( libfwevt_xml_document_report_parse_element_content(
+						     internal_xml_document,
+						     -1,
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_GENERIC,
+							 "%s: unable to report parse element content.",
+							 function );
 
-		byte_stream_copy_to_uint32_little_endian(
-		 &( xml_document_data[ 2 ] ),
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: unknown2\t\t\t: 0x%08" PRIx32 "\n",
-		 function,
-		 value_32bit );
+							goto on_error;
+						}
+					}
+					content_node_index++;
 
-		libcnotify_printf(
-		 "%s: data offset\t\t: 0x%08" PRIx32 "\n",
-		 function,
-		 template_definition_data_offset );
+					break;
 
-		libcnotify_printf(
-		 "\n" );
-	}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+				case LIBFWEVT_XML_TEMPLATE_NODE_TYPE_SUBSTITUTION:
+					result = libfwevt_xml_document_substitute_template_value(
+					          internal_xml_document,
+					          binary_data,
+					          binary_data_size,
+					          ascii_codepage,
+					          flags,
+					          template_values_array,
+					          node->value_index,
+					          node->value_type,
+					          &template_value_offset,
+					          element_xml_tag,
+					          element_recursion_depth,
+					          template_instance_recursion_depth,
+					          error );
+
+					if( ( result == -1 )
+					 || ( ( result == 0 )
+					  &&  ( node->token_type == LIBFWEVT_XML_TOKEN_NORMAL_SUBSTITUTION ) ) )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+						 "%s: unable to substitute template value.",
+						 function );
 
-	xml_token->size     = 10;
-	binary_data_offset += 10;
+						goto on_error;
+					}
+					if( internal_xml_document->parse_state != NULL )
+					{
+						if( libfwevt_xml_document_report_parse_element_content(
+						     internal_xml_document,
+						     (int) node->value_index,
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_GENERIC,
+							 "%s: unable to report parse element content.",
+							 function );
 
-	if( template_definition_data_offset >= binary_data_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid template definition data offset value out of bounds.",
-		 function );
+							goto on_error;
+						}
+					}
+					content_node_index++;
 
-		goto on_error;
-	}
-	if( template_definition_data_offset > binary_data_offset )
-	{
-		trailing_data_size = template_definition_data_offset - binary_data_offset;
+					break;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+				default:
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+					 "%s: invalid template definition - unsupported node type: %" PRIu8 ".",
+					 function,
+					 node->type );
+
+					goto on_error;
+			}
+		}
+		if( internal_xml_document->parse_state != NULL )
 		{
-			libcnotify_printf(
-			 "%s: data offset\t\t: 0x%08" PRIzx "\n",
-			 function,
-			 binary_data_offset );
+			if( libfwevt_xml_document_pop_parse_element(
+			     internal_xml_document,
+			     (uint8_t) ( result == 0 ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_REMOVE_FAILED,
+				 "%s: unable to pop parse element.",
+				 function );
 
-			libcnotify_printf(
-			 "%s: trailing data:\n",
-			 function );
-			libcnotify_print_data(
-			 &( binary_data[ binary_data_offset ] ),
-			 trailing_data_size,
-			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+				goto on_error;
+			}
+			/* The XML tag of the element is owned by the parse state
+			 */
+			element_xml_tag = NULL;
 		}
-#endif
-		xml_token->size    += trailing_data_size;
-		binary_data_offset += trailing_data_size;
-	}
-	template_data_offset = template_definition_data_offset;
+		else if( result != 0 )
+		{
+			if( xml_tag != NULL )
+			{
+				if( libfwevt_xml_tag_append_element(
+				     xml_tag,
+				     element_xml_tag,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append element to XML tag.",
+					 function );
 
-	if( ( binary_data_size < 24 )
-	 || ( template_data_offset >= ( binary_data_size - 24 ) ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid binary XML document data size value too small.",
-		 function );
+					goto on_error;
+				}
+				element_xml_tag = NULL;
+			}
+			else if( internal_xml_document->root_xml_tag == NULL )
+			{
+				internal_xml_document->root_xml_tag = element_xml_tag;
 
-		goto on_error;
+				element_xml_tag = NULL;
+			}
+		}
+		template_value_array_recursion_depth++;
 	}
-	byte_stream_copy_to_uint32_little_endian(
-	 &( binary_data[ template_data_offset + 20 ] ),
-	 template_definition_data_size );
+	while( template_value_offset > 0 );
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		byte_stream_copy_to_uint32_little_endian(
-		 &( binary_data[ template_data_offset ] ),
-		 value_32bit );
-		libcnotify_printf(
-		 "%s: offset next\t\t: 0x%08" PRIx32 "\n",
-		 function,
-		 value_32bit );
+	*node_index = end_node_index + 1;
 
-		if( libfwevt_debug_print_guid_value(
-		     function,
-		     "identifier\t\t",
-		     &( binary_data[ template_data_offset + 4 ] ),
-		     16,
-		     LIBFGUID_ENDIAN_LITTLE,
-		     LIBFGUID_STRING_FORMAT_FLAG_USE_LOWER_CASE,
+	if( element_xml_tag != NULL )
+	{
+		if( libfwevt_internal_xml_tag_free(
+		     (libfwevt_internal_xml_tag_t **) &element_xml_tag,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print GUID value.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free element XML tag.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
-		libcnotify_printf(
-		 "%s: definition size\t\t: %" PRIu32 "\n",
-		 function,
-		 template_definition_data_size );
-
-		libcnotify_printf(
-		 "\n" );
 	}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-
-	if( template_definition_data_size > binary_data_size )
+	if( libfwevt_xml_token_free(
+	     &xml_sub_token,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid template definition data size value out of bounds.",
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free binary XML sub token.",
 		 function );
 
 		goto on_error;
 	}
-	if( template_data_offset == binary_data_offset )
+	return( 1 );
+
+on_error:
+	if( ( element_xml_tag != NULL )
+	 && ( element_xml_tag != internal_xml_document->root_xml_tag )
+	 && ( internal_xml_document->parse_state == NULL ) )
 	{
-		template_values_data_offset = 24 + template_definition_data_size;
+		libfwevt_internal_xml_tag_free(
+		 (libfwevt_internal_xml_tag_t **) &element_xml_tag,
+		 NULL );
 	}
-	else
+	if( xml_sub_token != NULL )
 	{
-		template_values_data_offset = 0;
+		libfwevt_xml_token_free(
+		 &xml_sub_token,
+		 NULL );
 	}
-	template_data_offset += 24;
+	return( -1 );
+}
 
-	if( template_values_data_offset >= xml_document_data_size )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid template values data offset value out of bounds.",
-		 function );
+/* Substitutes a substitution placeholder with a template value
+ * Returns 1 if successful, 0 if no substitution or -1 on error
+ */
+int libfwevt_xml_document_substitute_template_value(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     int ascii_codepage,
+     uint8_t flags,
+     libcdata_array_t *template_values_array,
+     uint16_t template_value_index,
+     uint8_t template_value_type,
+     size_t *template_value_offset,
+     libfwevt_xml_tag_t *xml_tag,
+     int element_recursion_depth,
+     int template_instance_recursion_depth,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_template_value_t *template_value = NULL;
+	libfwevt_xml_token_t *xml_sub_token           = NULL;
+	const uint8_t *template_value_data            = NULL;
+	static char *function                         = "libfwevt_xml_document_substitute_template_value";
+	size_t binary_data_offset                     = 0;
+	size_t safe_template_value_offset             = 0;
+	size_t template_value_data_offset             = 0;
+	size_t template_value_data_size               = 0;
+	size_t template_value_size                    = 0;
+	uint16_t substitution_value_data_size         = 0;
+	uint8_t substitution_value_type               = 0;
+	uint8_t template_value_flags                  = 0;
 
-		goto on_error;
-	}
-	if( libfwevt_xml_document_read_template_instance_values(
-	     internal_xml_document,
-	     binary_data,
-	     binary_data_size,
-	     binary_data_offset + template_values_data_offset,
-	     &template_values_array,
-	     &template_values_data_size,
-	     error ) != 1 )
+	if( internal_xml_document == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read document template instance values.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML document.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	xml_token->size += template_values_data_size;
-
-	if( libfwevt_xml_token_initialize(
-	     &xml_sub_token,
-	     error ) != 1 )
+	if( template_value_offset == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create binary XML sub token.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template value offset.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfwevt_xml_token_read_data(
-	     xml_sub_token,
-	     binary_data,
-	     binary_data_size,
-	     template_data_offset,
-	     error ) != 1 )
+	if( xml_tag == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read binary XML sub token.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tag.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( libfwevt_xml_document_read_fragment_header(
-	     internal_xml_document,
-	     xml_sub_token,
-	     binary_data,
-	     binary_data_size,
-	     template_data_offset,
+	if( libcdata_array_get_entry_by_index(
+	     template_values_array,
+	     (int) template_value_index,
+	     (intptr_t **) &template_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read fragment header.",
-		 function );
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve template value: %" PRIu16 " from array.",
+		 function,
+		 template_value_index );
 
 		goto on_error;
 	}
-	template_data_offset += xml_sub_token->size;
-
-	if( libfwevt_xml_token_read_data(
-	     xml_sub_token,
-	     binary_data,
-	     binary_data_size,
-	     template_data_offset,
+	if( libfwevt_xml_template_value_get_flags(
+	     template_value,
+	     &template_value_flags,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read binary XML sub token.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve template value flags.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfwevt_xml_document_read_element(
-	     internal_xml_document,
-	     xml_sub_token,
-	     binary_data,
-	     binary_data_size,
-	     template_data_offset,
-	     ascii_codepage,
-	     flags,
-	     template_values_array,
-	     xml_tag,
-	     element_recursion_depth + 1,
-	     template_instance_recursion_depth,
+	if( ( template_value_flags & LIBFWEVT_XML_TEMPLATE_VALUE_FLAG_IS_DEFINITION ) != 0 )
+	{
+		substitution_value_type = LIBFWEVT_VALUE_TYPE_STRING_UTF16;
+	}
+	else
+	{
+		if( libfwevt_xml_template_value_get_type(
+		     template_value,
+		     &substitution_value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve template value type.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libfwevt_xml_template_value_get_offset(
+	     template_value,
+	     &binary_data_offset,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read element.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve template value data offset.",
 		 function );
 
 		goto on_error;
 	}
-	template_data_offset += xml_sub_token->size;
-
-	if( libfwevt_xml_token_read_data(
-	     xml_sub_token,
-	     binary_data,
-	     binary_data_size,
-	     template_data_offset,
+	if( libfwevt_xml_template_value_get_size(
+	     template_value,
+	     &substitution_value_data_size,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read binary XML sub token.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve template value data size.",
 		 function );
 
 		goto on_error;
 	}
-	if( xml_sub_token->type != LIBFWEVT_XML_TOKEN_END_OF_FILE )
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid binary XML token - unsupported type: 0x%02" PRIx8 ".",
+		libcnotify_printf(
+		 "%s: value: %02" PRIu32 " offset\t: 0x%08" PRIzx "\n",
 		 function,
-		 xml_token->type );
+		 template_value_index,
+		 binary_data_offset );
 
-		goto on_error;
+		libcnotify_printf(
+		 "%s: value: %02" PRIu32 " size\t\t: %" PRIu16 "\n",
+		 function,
+		 template_value_index,
+		 substitution_value_data_size );
+
+		libcnotify_printf(
+		 "%s: value: %02" PRIu32 " type\t\t: 0x%02" PRIx8 " (",
+		 function,
+		 template_value_index,
+		 substitution_value_type );
+		libfwevt_debug_print_value_type(
+		 substitution_value_type );
+		libcnotify_printf(
+		 ")\n" );
+
+		libcnotify_printf(
+		 "%s: value: %02" PRIu32 " data:\n",
+		 function,
+		 template_value_index );
+		libcnotify_print_data(
+		 &( binary_data[ binary_data_offset ] ),
+		 substitution_value_data_size,
+		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+
+		libcnotify_printf(
+		 "\n" );
 	}
-	if( binary_data_offset >= ( binary_data_size - 1 ) )
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+	/* No substitution
+	 */
+	if( substitution_value_type == LIBFWEVT_VALUE_TYPE_NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid binary XML document data size value too small.",
-		 function );
+		*template_value_offset = 0;
+
+		return( 0 );
+	}
+#if defined( HAVE_VERBOSE_OUTPUT )
+	if( template_value_type != substitution_value_type )
+	{
+		/* The size type can be substituded by a 32-bit or 64-bit hexadecimal integer
+		 * The same applies to it's array type
+		 */
+		if( ( ( template_value_type & 0x7f ) != LIBFWEVT_VALUE_TYPE_SIZE )
+		 || ( ( ( substitution_value_type & 0x7f ) != LIBFWEVT_VALUE_TYPE_HEXADECIMAL_INTEGER_32BIT )
+		  &&  ( ( substitution_value_type & 0x7f ) != LIBFWEVT_VALUE_TYPE_HEXADECIMAL_INTEGER_64BIT ) ) )
+		{
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: mismatch in value type ( 0x%02" PRIx8 " != 0x%02" PRIx8 " ).\n",
+				 function,
+				 template_value_type,
+				 substitution_value_type );
+			}
+		}
+	}
+#endif /* defined( HAVE_VERBOSE_OUTPUT ) */
+
+	if( substitution_value_type == LIBFWEVT_VALUE_TYPE_BINARY_XML )
+	{
+		if( libfwevt_xml_token_initialize(
+		     &xml_sub_token,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create binary XML sub token.",
+			 function );
+
+			goto on_error;
+		}
+		if( libfwevt_xml_token_read_data(
+		     xml_sub_token,
+		     binary_data,
+		     binary_data_size,
+		     binary_data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read binary XML sub token.",
+			 function );
+
+			goto on_error;
+		}
+		switch( xml_sub_token->type & 0xbf )
+		{
+			case LIBFWEVT_XML_TOKEN_OPEN_START_ELEMENT_TAG:
+				if( libfwevt_xml_document_read_element(
+				     internal_xml_document,
+				     xml_sub_token,
+				     binary_data,
+				     binary_data_size,
+				     binary_data_offset,
+				     ascii_codepage,
+				     flags,
+				     template_values_array,
+				     xml_tag,
+				     element_recursion_depth + 1,
+				     template_instance_recursion_depth,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read element.",
+					 function );
 
-		goto on_error;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: data offset\t\t: 0x%08" PRIzx "\n",
-		 function,
-		 binary_data_offset );
+					goto on_error;
+				}
+				break;
 
-		libcnotify_printf(
-		 "%s: end of file data:\n",
-		 function );
-		libcnotify_print_data(
-		 &( binary_data[ binary_data_offset ] ),
-		 1,
-		 0 );
-	}
-#endif
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: type\t\t\t: 0x%02" PRIx8 "\n",
-		 function,
-		 binary_data[ binary_data_offset ] );
+			case LIBFWEVT_XML_TOKEN_FRAGMENT_HEADER:
+				if( libfwevt_xml_document_read_fragment(
+				     internal_xml_document,
+				     xml_sub_token,
+				     binary_data,
+				     binary_data_size,
+				     binary_data_offset,
+				     ascii_codepage,
+				     flags,
+				     NULL,
+				     xml_tag,
+				     element_recursion_depth,
+				     template_instance_recursion_depth,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read fragment header.",
+					 function );
 
-		libcnotify_printf(
-		 "\n" );
-	}
-#endif
-	template_data_offset += 1;
+					goto on_error;
+				}
+				break;
 
-	if( libfwevt_xml_token_free(
-	     &xml_sub_token,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free binary XML sub token.",
-		 function );
+			case LIBFWEVT_XML_TOKEN_TEMPLATE_INSTANCE:
+				if( libfwevt_xml_document_read_template_instance(
+				     internal_xml_document,
+				     xml_sub_token,
+				     binary_data,
+				     binary_data_size,
+				     binary_data_offset,
+				     ascii_codepage,
+				     flags,
+				     xml_tag,
+				     element_recursion_depth,
+				     template_instance_recursion_depth + 1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read document template instance.",
+					 function );
 
-		goto on_error;
-	}
-	if( template_definition_data_offset == binary_data_offset )
-	{
-		template_data_size = template_data_offset
-		                   - template_definition_data_offset;
+					goto on_error;
+				}
+				break;
 
-		xml_token->size += template_data_size;
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: invalid binary XML token - unsupported type: 0x%02" PRIx8 ".",
+				 function,
+				 xml_sub_token->type );
 
-		/* The template data size does not include the first 33 bytes
-		 * of the template definition
-		 * In this case the template data size contains 24 of the 33 bytes
-		 */
-		if( template_definition_data_size < ( template_data_size - 24 ) )
+				goto on_error;
+		}
+		if( libfwevt_xml_token_free(
+		     &xml_sub_token,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-			 "%s: invalid template definition data size value too small.",
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free binary XML sub token.",
 			 function );
 
 			goto on_error;
 		}
-/* TODO
-		template_definition_data_size -= (uint32_t) ( template_data_size - 24 );
-*/
 	}
-/* TODO check if template_definition_data_size is 0 */
-
-	if( libcdata_array_free(
-	     &template_values_array,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libfwevt_xml_template_value_free,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free template values array.",
-		 function );
-
-		goto on_error;
-	}
-	return( 1 );
-
-on_error:
-	if( template_values_array != NULL )
-	{
-		libcdata_array_free(
-		 &template_values_array,
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libfwevt_xml_template_value_free,
-		 NULL );
-	}
-	if( xml_sub_token != NULL )
+	else
 	{
-		libfwevt_xml_token_free(
-		 &xml_sub_token,
-		 NULL );
-	}
-	return( -1 );
-}
-
-/* Reads the template instance values from a binary XML document
- * Returns 1 if successful or -1 on error
+/* TODO for now the array types are kept separate to find undocumented values
+ * when done apply ( substitution_value_type & 0x7f ) and remove the array types
  */
-int libfwevt_xml_document_read_template_instance_values(
-     libfwevt_internal_xml_document_t *internal_xml_document,
-     const uint8_t *binary_data,
-     size_t binary_data_size,
-     size_t binary_data_offset,
-     libcdata_array_t **template_values_array,
-     size_t *template_values_size,
-     libcerror_error_t **error )
-{
-	libfwevt_xml_template_value_t *template_value = NULL;
-	static char *function                         = "libfwevt_xml_document_read_template_instance_values";
-	size_t safe_template_values_size              = 0;
-	size_t template_value_definitions_data_size   = 0;
-	size_t template_values_data_size              = 0;
-	uint32_t number_of_template_values            = 0;
-	uint32_t template_value_index                 = 0;
-	uint16_t template_value_data_size             = 0;
-	uint8_t template_value_type                   = 0;
+		switch( substitution_value_type )
+		{
+			case LIBFWEVT_VALUE_TYPE_STRING_UTF16:
+			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_STRING_UTF16:
+				break;
 
-	if( internal_xml_document == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid binary XML document.",
-		 function );
+			case LIBFWEVT_VALUE_TYPE_STRING_BYTE_STREAM:
+			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_STRING_BYTE_STREAM:
+				break;
 
-		return( -1 );
-	}
-	if( ( binary_data_size < 4 )
-	 || ( binary_data_offset >= ( binary_data_size - 4 ) ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid binary data size value out of bounds.",
-		 function );
+			case LIBFWEVT_VALUE_TYPE_INTEGER_8BIT:
+			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_INTEGER_8BIT:
+				template_value_size = 1;
+				break;
 
-		return( -1 );
-	}
-	if( template_values_size == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid template values size.",
-		 function );
+			case LIBFWEVT_VALUE_TYPE_UNSIGNED_INTEGER_8BIT:
+			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_UNSIGNED_INTEGER_8BIT:
+				template_value_size = 1;
+				break;
 
-		return( -1 );
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: data offset\t: 0x%08" PRIzx "\n",
-		 function,
-		 binary_data_offset );
+			case LIBFWEVT_VALUE_TYPE_INTEGER_16BIT:
+			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_INTEGER_16BIT:
+				template_value_size = 2;
+				break;
 
-		libcnotify_printf(
-		 "%s: template instance data:\n",
-		 function );
-		libcnotify_print_data(
-		 &( binary_data[ binary_data_offset ] ),
-		 4,
-		 0 );
-	}
-#endif
-	byte_stream_copy_to_uint32_little_endian(
-	 &( binary_data[ binary_data_offset ] ),
-	 number_of_template_values );
+			case LIBFWEVT_VALUE_TYPE_UNSIGNED_INTEGER_16BIT:
+			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_UNSIGNED_INTEGER_16BIT:
+				template_value_size = 2;
+				break;
+
+			case LIBFWEVT_VALUE_TYPE_INTEGER_32BIT:
+			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_INTEGER_32BIT:
+				template_value_size = 4;
+				break;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: number of values\t: %" PRIu32 "\n",
-		 function,
-		 number_of_template_values );
+			case LIBFWEVT_VALUE_TYPE_UNSIGNED_INTEGER_32BIT:
+			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_UNSIGNED_INTEGER_32BIT:
+				template_value_size = 4;
+				break;
 
-		libcnotify_printf(
-		 "\n" );
-	}
-#endif
-	safe_template_values_size = 4;
-	binary_data_offset       += 4;
+			case LIBFWEVT_VALUE_TYPE_HEXADECIMAL_INTEGER_32BIT:
+			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_HEXADECIMAL_INTEGER_32BIT:
+				template_value_size = 4;
+				break;
 
-	template_value_definitions_data_size = number_of_template_values * 4;
+			case LIBFWEVT_VALUE_TYPE_INTEGER_64BIT:
+			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_INTEGER_64BIT:
+				template_value_size = 8;
+				break;
 
-	if( ( template_value_definitions_data_size > binary_data_size )
-	 || ( binary_data_offset >= ( binary_data_size - template_value_definitions_data_size ) ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid template value definitions data size value out of bounds.",
-		 function );
+			case LIBFWEVT_VALUE_TYPE_UNSIGNED_INTEGER_64BIT:
+			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_UNSIGNED_INTEGER_64BIT:
+				template_value_size = 8;
+				break;
 
-		goto on_error;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: data offset\t: 0x%08" PRIzx "\n",
-		 function,
-		 binary_data_offset );
+			case LIBFWEVT_VALUE_TYPE_HEXADECIMAL_INTEGER_64BIT:
+			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_HEXADECIMAL_INTEGER_64BIT:
+				template_value_size = 8;
+				break;
 
-		libcnotify_printf(
-		 "%s: template instance value descriptor data:\n",
-		 function );
-		libcnotify_print_data(
-		 &( binary_data[ binary_data_offset ] ),
-		 template_value_definitions_data_size,
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-	}
-#endif
-	if( libcdata_array_initialize(
-	     template_values_array,
-	     number_of_template_values,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create template values array.",
-		 function );
+			case LIBFWEVT_VALUE_TYPE_FLOATING_POINT_32BIT:
+			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_FLOATING_POINT_32BIT:
+				template_value_size = 4;
+				break;
 
-		goto on_error;
-	}
-	for( template_value_index = 0;
-	     template_value_index < number_of_template_values;
-	     template_value_index++ )
-	{
-		byte_stream_copy_to_uint16_little_endian(
-		 &( binary_data[ binary_data_offset ] ),
-		 template_value_data_size );
+			case LIBFWEVT_VALUE_TYPE_FLOATING_POINT_64BIT:
+			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_FLOATING_POINT_64BIT:
+				template_value_size = 8;
+				break;
 
-		template_value_type = binary_data[ binary_data_offset + 2 ];
+			case LIBFWEVT_VALUE_TYPE_BOOLEAN:
+				template_value_size = 4;
+				break;
 
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			libcnotify_printf(
-			 "%s: value: %02" PRIu32 " size\t: %" PRIu16 "\n",
-			 function,
-			 template_value_index,
-			 template_value_data_size );
+			case LIBFWEVT_VALUE_TYPE_BINARY_DATA:
+				break;
 
-			libcnotify_printf(
-			 "%s: value: %02" PRIu32 " type\t: 0x%02" PRIx8 " (",
-			 function,
-			 template_value_index,
-			 template_value_type );
-			libfwevt_debug_print_value_type(
-			 template_value_type );
-			libcnotify_printf(
-			 ")\n" );
+			case LIBFWEVT_VALUE_TYPE_GUID:
+			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_GUID:
+				template_value_size = 16;
+				break;
 
-			libcnotify_printf(
-			 "%s: value: %02" PRIu32 " unknown1\t: 0x%02" PRIx8 "\n",
-			 function,
-			 template_value_index,
-			 binary_data[ binary_data_offset + 3 ] );
+/* TODO how to deal with array types ? */
+			case LIBFWEVT_VALUE_TYPE_SIZE:
+				if( ( substitution_value_data_size != 4 )
+				 && ( substitution_value_data_size != 8 ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+					 "%s: unsupported value data size: %" PRIu16 ".",
+					 function,
+					 substitution_value_data_size );
 
-			libcnotify_printf(
-			 "\n" );
-		}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+					goto on_error;
+				}
+				break;
 
-		safe_template_values_size += 4;
-		binary_data_offset        += 4;
+			case LIBFWEVT_VALUE_TYPE_FILETIME:
+			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_FILETIME:
+				template_value_size = 8;
+				break;
 
-		template_values_data_size += template_value_data_size;
+			case LIBFWEVT_VALUE_TYPE_SYSTEMTIME:
+			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_SYSTEMTIME:
+				template_value_size = 16;
+				break;
 
-		if( libfwevt_xml_template_value_initialize(
-		     &template_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create template value.",
-			 function );
+			case LIBFWEVT_VALUE_TYPE_NT_SECURITY_IDENTIFIER:
+				break;
 
-			goto on_error;
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported value type: 0x%02" PRIx8 ".",
+				 function,
+				 substitution_value_type );
+
+				goto on_error;
 		}
-		if( libfwevt_xml_template_value_set_type(
-		     template_value,
-		     template_value_type,
+		if( libfwevt_xml_tag_set_value_type(
+		     xml_tag,
+		     substitution_value_type,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set template value type.",
+			 "%s: unable to set value type.",
 			 function );
 
-			libfwevt_xml_template_value_free(
-			 &template_value,
-			 NULL );
-
 			goto on_error;
 		}
-		if( libfwevt_xml_template_value_set_size(
-		     template_value,
-		     template_value_data_size,
-		     error ) != 1 )
+		if( ( substitution_value_type & LIBFWEVT_VALUE_TYPE_ARRAY ) != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set template value data size.",
-			 function );
+			safe_template_value_offset = *template_value_offset;
+
+			if( substitution_value_data_size > 0 )
+			{
+				if( safe_template_value_offset >= (size_t) substitution_value_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid template value offset value out of bounds.",
+					 function );
+
+					goto on_error;
+				}
+				template_value_data      = &( binary_data[ binary_data_offset + safe_template_value_offset ] );
+				template_value_data_size = substitution_value_data_size - (uint16_t) safe_template_value_offset;
+			}
+			if( template_value_data_size > 0 )
+			{
+#if defined( HAVE_DEBUG_OUTPUT )
+				if( libcnotify_verbose != 0 )
+				{
+					libcnotify_printf(
+					 "%s: template value data:\n",
+					 function );
+					libcnotify_print_data(
+					 template_value_data,
+					 template_value_data_size,
+					 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
+				}
+#endif
+				if( substitution_value_type == LIBFWEVT_VALUE_TYPE_ARRAY_OF_STRING_BYTE_STREAM )
+				{
+					if( template_value_data_size < 1 )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+						 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: invalid byte string template value data size value out of bounds.",
+						 function );
+
+						goto on_error;
+					}
+					while( template_value_data_offset < template_value_data_size )
+					{
+						if( template_value_data[ template_value_data_offset ] == 0 )
+						{
+							template_value_data_offset += 1;
+
+							break;
+						}
+						template_value_data_offset += 1;
+					}
+					template_value_data_size = template_value_data_offset;
+				}
+				else if( substitution_value_type == LIBFWEVT_VALUE_TYPE_ARRAY_OF_STRING_UTF16 )
+				{
+					if( ( template_value_data_size < 2 )
+					 && ( ( template_value_data_size % 2 ) != 0 ) )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+						 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: invalid UTF-16 template value data size value out of bounds.",
+						 function );
 
-			libfwevt_xml_template_value_free(
-			 &template_value,
-			 NULL );
+						goto on_error;
+					}
+					while( template_value_data_offset < template_value_data_size )
+					{
+						if( ( template_value_data[ template_value_data_offset ] == 0 )
+						 && ( template_value_data[ template_value_data_offset + 1 ] == 0 ) )
+						{
+							template_value_data_offset += 2;
 
-			goto on_error;
-		}
-		if( libcdata_array_set_entry_by_index(
-		     *template_values_array,
-		     (int) template_value_index,
-		     (intptr_t *) template_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set template value: %" PRIu32 " in array.",
-			 function,
-			 template_value_index );
+							break;
+						}
+						template_value_data_offset += 2;
+					}
+					template_value_data_size = template_value_data_offset;
+				}
+				else
+				{
+					if( template_value_size > template_value_data_size )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+						 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+						 "%s: invalid template value size value out of bounds.",
+						 function );
 
-			libfwevt_xml_template_value_free(
-			 &template_value,
-			 NULL );
+						goto on_error;
+					}
+					template_value_data_size = template_value_size;
+				}
+			}
+			/* An empty XML tag should be created if template_value_data_size == 0
+			 */
+/* TODO create empty XML tag if template value data is an empty string */
+			if( template_value_data_size > 0 )
+			{
+				if( libfwevt_xml_tag_set_value_data(
+				     xml_tag,
+				     template_value_data,
+				     template_value_data_size,
+				     internal_xml_document->data_segment_flags,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set value data.",
+					 function );
 
-			goto on_error;
+					goto on_error;
+				}
+				safe_template_value_offset += template_value_data_size;
+			}
+			if( safe_template_value_offset == substitution_value_data_size )
+			{
+				safe_template_value_offset = 0;
+			}
 		}
-		template_value = NULL;
-	}
-	if( ( template_values_data_size > binary_data_size )
-	 || ( binary_data_offset >= ( binary_data_size - template_values_data_size ) ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid template values data size value out of bounds.",
-		 function );
+		else
+		{
+			if( ( template_value_size != 0 )
+			 && ( template_value_size != substitution_value_data_size ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid substitution value data size value out of bounds.",
+				 function );
 
-		goto on_error;
-	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: data offset\t: 0x%08" PRIzx "\n",
-		 function,
-		 binary_data_offset );
+				goto on_error;
+			}
+			else if( ( substitution_value_type == LIBFWEVT_VALUE_TYPE_STRING_UTF16 )
+			      && ( ( substitution_value_data_size % 2 ) != 0 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid UTF-16 substitution value data size value out of bounds.",
+				 function );
 
-		libcnotify_printf(
-		 "%s: values data:\n",
-		 function );
-		libcnotify_print_data(
-		 &( binary_data[ binary_data_offset ] ),
-		 template_values_data_size,
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-	}
-#endif
-	for( template_value_index = 0;
-	     template_value_index < number_of_template_values;
-	     template_value_index++ )
-	{
-		if( libcdata_array_get_entry_by_index(
-		     *template_values_array,
-		     (int) template_value_index,
-		     (intptr_t **) &template_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve template value: %" PRIu32 " from array.",
-			 function,
-			 template_value_index );
+				goto on_error;
+			}
+			if( libfwevt_xml_tag_set_value_data(
+			     xml_tag,
+			     &( binary_data[ binary_data_offset ] ),
+			     (size_t) substitution_value_data_size,
+			     internal_xml_document->data_segment_flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set value data.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
 		}
-		if( libfwevt_xml_template_value_get_size(
-		     template_value,
-		     &template_value_data_size,
+		if( libfwevt_xml_tag_set_flags(
+		     xml_tag,
+		     LIBFWEVT_XML_TAG_FLAG_IS_TEMPLATE_DEFINITION,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve template value data size.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set flags.",
 			 function );
 
 			goto on_error;
@@ -5521,1051 +13088,834 @@ int libfwevt_xml_document_read_template_instance_values(
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
-			libcnotify_printf(
-			 "%s: data offset\t: 0x%08" PRIzx "\n",
-			 function,
-			 binary_data_offset );
-
-			libcnotify_printf(
-			 "%s: value: %02" PRIu32 " data:\n",
-			 function,
-			 template_value_index );
-			libcnotify_print_data(
-			 &( binary_data[ binary_data_offset ] ),
-			 template_value_data_size,
-			 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-		}
-#endif
-		/* Note that template_value_data_size is allowed to be 0.
-		 * Don't set the template value offset in such a case.
-		 */
-		if( template_value_data_size == 0 )
-		{
-			continue;
-		}
-		if( libfwevt_xml_template_value_set_offset(
-		     template_value,
-		     binary_data_offset,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set template value data offset.",
-			 function );
+			if( libfwevt_xml_tag_debug_print_value_data_segment(
+			     xml_tag,
+			     0,
+			     0,
+			     ascii_codepage,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
+				 "%s: unable to print value data segment: 0.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
 		}
-		binary_data_offset += template_value_data_size;
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
 	}
-	*template_values_size = safe_template_values_size + template_values_data_size;
+	*template_value_offset = safe_template_value_offset;
 
 	return( 1 );
 
 on_error:
-	if( template_values_array != NULL )
+	if( xml_sub_token != NULL )
 	{
-		libcdata_array_free(
-		 template_values_array,
-		 (int (*)(intptr_t **, libcerror_error_t **)) &libfwevt_xml_template_value_free,
+		libfwevt_xml_token_free(
+		 &xml_sub_token,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Reads a value from a binary XML document
+/* Retrieves the size of the UTF-8 formatted string of the XML document
  * Returns 1 if successful or -1 on error
  */
-int libfwevt_xml_document_read_value(
-     libfwevt_internal_xml_document_t *internal_xml_document,
-     libfwevt_xml_token_t *xml_token,
-     const uint8_t *binary_data,
-     size_t binary_data_size,
-     size_t binary_data_offset,
-     libfwevt_xml_tag_t *xml_tag,
-     int ascii_codepage LIBFWEVT_ATTRIBUTE_UNUSED,
+int libfwevt_xml_document_get_utf8_xml_string_size(
+     libfwevt_xml_document_t *xml_document,
+     size_t *utf8_string_size,
      libcerror_error_t **error )
 {
-	const uint8_t *xml_document_data = NULL;
-	static char *function            = "libfwevt_xml_document_read_value";
-	size_t value_data_size           = 0;
-	size_t xml_document_data_size    = 0;
-	uint8_t value_type               = 0;
-	int data_segment_index           = 0;
+	libfwevt_internal_xml_document_t *internal_xml_document = NULL;
+	static char *function                                   = "libfwevt_xml_document_get_utf8_xml_string_size";
 
-	LIBFWEVT_UNREFERENCED_PARAMETER( ascii_codepage )
+	if( xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML document.",
+		 function );
 
-	if( internal_xml_document == NULL )
+		return( -1 );
+	}
+	internal_xml_document = (libfwevt_internal_xml_document_t *) xml_document;
+
+/* TODO pass codepage */
+	if( libfwevt_xml_tag_get_utf8_xml_string_size(
+	     internal_xml_document->root_xml_tag,
+	     0,
+	     utf8_string_size,
+	     LIBUNA_CODEPAGE_WINDOWS_1252,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid binary XML document.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve size of UTF-8 string of root XML tag.",
 		 function );
 
 		return( -1 );
 	}
-	if( xml_token == NULL )
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 formatted string of the XML document
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_get_utf8_xml_string(
+     libfwevt_xml_document_t *xml_document,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_document_t *internal_xml_document = NULL;
+	static char *function                                   = "libfwevt_xml_document_get_utf8_xml_string";
+	size_t utf8_string_index                                = 0;
+
+	if( xml_document == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid binary XML token.",
+		 "%s: invalid XML document.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( xml_token->type & 0xbf ) != LIBFWEVT_XML_TOKEN_VALUE )
+	internal_xml_document = (libfwevt_internal_xml_document_t *) xml_document;
+
+/* TODO pass codepage */
+	if( libfwevt_xml_tag_get_utf8_xml_string_with_index(
+	     internal_xml_document->root_xml_tag,
+	     0,
+	     utf8_string,
+	     utf8_string_size,
+	     &utf8_string_index,
+	     LIBUNA_CODEPAGE_WINDOWS_1252,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: invalid binary XML token - unsupported type: 0x%02" PRIx8 ".",
-		 function,
-		 xml_token->type );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string of root XML tag.",
+		 function );
 
 		return( -1 );
 	}
-	if( binary_data == NULL )
+	return( 1 );
+}
+
+/* Renders the UTF-8 formatted string of the XML document in a single pass
+ * The UTF-8 string is reallocated when it is too small so that it can be reused
+ * for multiple XML documents, the caller must free it with free()
+ * The UTF-8 string size is set to the size of the rendered string including the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_render_utf8(
+     libfwevt_xml_document_t *xml_document,
+     uint8_t **utf8_string,
+     size_t *allocated_utf8_string_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwevt_output_buffer_t output_buffer;
+
+	libfwevt_internal_xml_document_t *internal_xml_document = NULL;
+	static char *function                                   = "libfwevt_xml_document_render_utf8";
+
+	if( xml_document == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid binary data.",
+		 "%s: invalid XML document.",
 		 function );
 
 		return( -1 );
 	}
-	if( binary_data_size > (size_t) SSIZE_MAX )
+	internal_xml_document = (libfwevt_internal_xml_document_t *) xml_document;
+
+	if( internal_xml_document->root_xml_tag == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid binary XML document data size value exceeds maximum.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid XML document - missing root XML tag.",
 		 function );
 
 		return( -1 );
 	}
-	if( binary_data_offset >= binary_data_size )
+	if( utf8_string == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid binary data offset value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
 		 function );
 
 		return( -1 );
 	}
-	if( xml_tag == NULL )
+	if( allocated_utf8_string_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid XML tag.",
+		 "%s: invalid allocated UTF-8 string size.",
 		 function );
 
 		return( -1 );
 	}
-	xml_document_data      = &( binary_data[ binary_data_offset ] );
-	xml_document_data_size = binary_data_size - binary_data_offset;
-
-	if( xml_document_data_size < 4 )
+	if( ( *utf8_string != NULL )
+	 && ( *allocated_utf8_string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid binary XML document data size value too small.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid allocated UTF-8 string size value exceeds maximum.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: data offset\t\t\t\t: 0x%08" PRIzx "\n",
-		 function,
-		 binary_data_offset );
-
-		libcnotify_printf(
-		 "%s: value data:\n",
-		 function );
-		libcnotify_print_data(
-		 xml_document_data,
-		 4,
-		 0 );
-	}
-#endif
-	value_type = xml_document_data[ 1 ];
-
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: type\t\t\t\t\t: 0x%02" PRIx8 "\n",
-		 function,
-		 xml_document_data[ 0 ] );
-
-		libcnotify_printf(
-		 "%s: value type\t\t\t\t: 0x%02" PRIx8 " (",
-		 function,
-		 value_type );
-		libfwevt_debug_print_value_type(
-		 value_type );
-		libcnotify_printf(
-		 ")\n" );
-	}
-#endif
-	xml_token->size     = 4;
-	binary_data_offset += 4;
-
-	switch( value_type )
-	{
-		case LIBFWEVT_VALUE_TYPE_STRING_UTF16:
-			byte_stream_copy_to_uint16_little_endian(
-			 &( xml_document_data[ 2 ] ),
-			 value_data_size );
-
-#if defined( HAVE_DEBUG_OUTPUT )
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: number of characters\t\t\t: %" PRIzd "\n",
-				 function,
-				 value_data_size );
-			}
-#endif
-			value_data_size *= 2;
-
-			break;
-
-		default:
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported value type: 0x%02" PRIx8 ".",
-			 function,
-			 value_type );
-
-			return( -1 );
-	}
-	if( ( value_data_size > binary_data_size )
-	 || ( binary_data_offset >= ( binary_data_size - value_data_size ) ) )
+	if( utf8_string_size == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid value data size value out of bounds.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
 		 function );
 
 		return( -1 );
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: data offset\t\t\t\t: 0x%08" PRIzx "\n",
-		 function,
-		 binary_data_offset );
+	output_buffer.data                = *utf8_string;
+	output_buffer.data_size           = 0;
+	output_buffer.allocated_data_size = 0;
+	output_buffer.data_is_fixed       = 0;
+	output_buffer.write_callback      = NULL;
+	output_buffer.callback_data       = NULL;
 
-		libcnotify_printf(
-		 "%s: value data:\n",
-		 function );
-		libcnotify_print_data(
-		 &( binary_data[ binary_data_offset ] ),
-		 value_data_size,
-		 0 );
+	if( output_buffer.data != NULL )
+	{
+		output_buffer.allocated_data_size = *allocated_utf8_string_size;
 	}
-#endif
-	if( libfwevt_xml_tag_set_value_type(
-	     xml_tag,
-	     value_type,
+/* TODO pass codepage */
+	if( libfwevt_xml_tag_render_utf8_xml_string(
+	     internal_xml_document->root_xml_tag,
+	     0,
+	     &output_buffer,
+	     LIBUNA_CODEPAGE_WINDOWS_1252,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set value type.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to render UTF-8 string of root XML tag.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( libfwevt_xml_tag_append_value_data(
-	     xml_tag,
-	     &( binary_data[ binary_data_offset ] ),
-	     value_data_size,
-	     &data_segment_index,
+	if( libfwevt_output_buffer_append_data(
+	     &output_buffer,
+	     (uint8_t *) "",
+	     1,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append value data.",
+		 "%s: unable to append end-of-string character.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		if( libfwevt_xml_tag_debug_print_value_data_segment(
-		     xml_tag,
-		     data_segment_index,
-		     0,
-		     ascii_codepage,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-			 "%s: unable to print value data segment: %d.",
-			 function,
-			 data_segment_index );
+	*utf8_string                = output_buffer.data;
+	*allocated_utf8_string_size = output_buffer.allocated_data_size;
+	*utf8_string_size           = output_buffer.data_size;
 
-			return( -1 );
-		}
-	}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+	return( 1 );
 
-	xml_token->size += value_data_size;
+on_error:
+	/* The UTF-8 string could have been reallocated
+	 */
+	*utf8_string                = output_buffer.data;
+	*allocated_utf8_string_size = output_buffer.allocated_data_size;
 
-	return( 1 );
+	return( -1 );
 }
 
-/* Substitutes a substitution placeholder with a template value
- * Returns 1 if successful, 0 if no substitution or -1 on error
+/* Writes the UTF-8 formatted string of the XML document to a write callback
+ * The string is rendered into a small staging buffer that is passed to the write
+ * callback when it is full, the end-of-string character is not written
+ * Returns 1 if successful or -1 on error
  */
-int libfwevt_xml_document_substitute_template_value(
-     libfwevt_internal_xml_document_t *internal_xml_document,
-     const uint8_t *binary_data,
-     size_t binary_data_size,
-     int ascii_codepage,
-     uint8_t flags,
-     libcdata_array_t *template_values_array,
-     uint16_t template_value_index,
-     uint8_t template_value_type,
-     size_t *template_value_offset,
-     libfwevt_xml_tag_t *xml_tag,
-     int element_recursion_depth,
-     int template_instance_recursion_depth,
-     libcerror_error_t **error )
-{
-	libfwevt_xml_template_value_t *template_value = NULL;
-	libfwevt_xml_token_t *xml_sub_token           = NULL;
-	const uint8_t *template_value_data            = NULL;
-	static char *function                         = "libfwevt_xml_document_substitute_template_value";
-	size_t binary_data_offset                     = 0;
-	size_t safe_template_value_offset             = 0;
-	size_t template_value_data_offset             = 0;
-	size_t template_value_data_size               = 0;
-	size_t template_value_size                    = 0;
-	uint16_t substitution_value_data_size         = 0;
-	uint8_t substitution_value_type               = 0;
-	uint8_t template_value_flags                  = 0;
+int libfwevt_xml_document_write_utf8_xml_string(
+     libfwevt_xml_document_t *xml_document,
+     int (*write_callback)(
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libfwevt_output_buffer_t output_buffer;
 
-	if( internal_xml_document == NULL )
+	libfwevt_internal_xml_document_t *internal_xml_document = NULL;
+	static char *function                                   = "libfwevt_xml_document_write_utf8_xml_string";
+
+	if( xml_document == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid binary XML document.",
+		 "%s: invalid XML document.",
 		 function );
 
 		return( -1 );
 	}
-	if( template_value_offset == NULL )
+	internal_xml_document = (libfwevt_internal_xml_document_t *) xml_document;
+
+	if( internal_xml_document->root_xml_tag == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid template value offset.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid XML document - missing root XML tag.",
 		 function );
 
 		return( -1 );
 	}
-	if( xml_tag == NULL )
+	if( write_callback == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid XML tag.",
+		 "%s: invalid write callback.",
 		 function );
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     template_values_array,
-	     (int) template_value_index,
-	     (intptr_t **) &template_value,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve template value: %" PRIu16 " from array.",
-		 function,
-		 template_value_index );
-
-		goto on_error;
-	}
-	if( libfwevt_xml_template_value_get_flags(
-	     template_value,
-	     &template_value_flags,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve template value flags.",
-		 function );
-
-		goto on_error;
-	}
-	if( ( template_value_flags & LIBFWEVT_XML_TEMPLATE_VALUE_FLAG_IS_DEFINITION ) != 0 )
-	{
-		substitution_value_type = LIBFWEVT_VALUE_TYPE_STRING_UTF16;
-	}
-	else
-	{
-		if( libfwevt_xml_template_value_get_type(
-		     template_value,
-		     &substitution_value_type,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve template value type.",
-			 function );
+	output_buffer.data                = NULL;
+	output_buffer.data_size           = 0;
+	output_buffer.allocated_data_size = 0;
+	output_buffer.data_is_fixed       = 0;
+	output_buffer.write_callback      = write_callback;
+	output_buffer.callback_data       = callback_data;
 
-			goto on_error;
-		}
-	}
-	if( libfwevt_xml_template_value_get_offset(
-	     template_value,
-	     &binary_data_offset,
+/* TODO pass codepage */
+	if( libfwevt_xml_tag_render_utf8_xml_string(
+	     internal_xml_document->root_xml_tag,
+	     0,
+	     &output_buffer,
+	     LIBUNA_CODEPAGE_WINDOWS_1252,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve template value data offset.",
+		 "%s: unable to render UTF-8 string of root XML tag.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfwevt_xml_template_value_get_size(
-	     template_value,
-	     &substitution_value_data_size,
+	if( libfwevt_output_buffer_flush(
+	     &output_buffer,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve template value data size.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output buffer.",
 		 function );
 
 		goto on_error;
 	}
-#if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		libcnotify_printf(
-		 "%s: value: %02" PRIu32 " offset\t: 0x%08" PRIzx "\n",
-		 function,
-		 template_value_index,
-		 binary_data_offset );
-
-		libcnotify_printf(
-		 "%s: value: %02" PRIu32 " size\t\t: %" PRIu16 "\n",
-		 function,
-		 template_value_index,
-		 substitution_value_data_size );
-
-		libcnotify_printf(
-		 "%s: value: %02" PRIu32 " type\t\t: 0x%02" PRIx8 " (",
-		 function,
-		 template_value_index,
-		 substitution_value_type );
-		libfwevt_debug_print_value_type(
-		 substitution_value_type );
-		libcnotify_printf(
-		 ")\n" );
-
-		libcnotify_printf(
-		 "%s: value: %02" PRIu32 " data:\n",
-		 function,
-		 template_value_index );
-		libcnotify_print_data(
-		 &( binary_data[ binary_data_offset ] ),
-		 substitution_value_data_size,
-		 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-
-		libcnotify_printf(
-		 "\n" );
-	}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-
-	/* No substitution
-	 */
-	if( substitution_value_type == LIBFWEVT_VALUE_TYPE_NULL )
-	{
-		*template_value_offset = 0;
-
-		return( 0 );
-	}
-#if defined( HAVE_VERBOSE_OUTPUT )
-	if( template_value_type != substitution_value_type )
-	{
-		/* The size type can be substituded by a 32-bit or 64-bit hexadecimal integer
-		 * The same applies to it's array type
-		 */
-		if( ( ( template_value_type & 0x7f ) != LIBFWEVT_VALUE_TYPE_SIZE )
-		 || ( ( ( substitution_value_type & 0x7f ) != LIBFWEVT_VALUE_TYPE_HEXADECIMAL_INTEGER_32BIT )
-		  &&  ( ( substitution_value_type & 0x7f ) != LIBFWEVT_VALUE_TYPE_HEXADECIMAL_INTEGER_64BIT ) ) )
-		{
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%s: mismatch in value type ( 0x%02" PRIx8 " != 0x%02" PRIx8 " ).\n",
-				 function,
-				 template_value_type,
-				 substitution_value_type );
-			}
-		}
-	}
-#endif /* defined( HAVE_VERBOSE_OUTPUT ) */
-
-	if( substitution_value_type == LIBFWEVT_VALUE_TYPE_BINARY_XML )
+	if( output_buffer.data != NULL )
 	{
-		if( libfwevt_xml_token_initialize(
-		     &xml_sub_token,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create binary XML sub token.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfwevt_xml_token_read_data(
-		     xml_sub_token,
-		     binary_data,
-		     binary_data_size,
-		     binary_data_offset,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read binary XML sub token.",
-			 function );
-
-			goto on_error;
-		}
-		switch( xml_sub_token->type & 0xbf )
-		{
-			case LIBFWEVT_XML_TOKEN_OPEN_START_ELEMENT_TAG:
-				if( libfwevt_xml_document_read_element(
-				     internal_xml_document,
-				     xml_sub_token,
-				     binary_data,
-				     binary_data_size,
-				     binary_data_offset,
-				     ascii_codepage,
-				     flags,
-				     template_values_array,
-				     xml_tag,
-				     element_recursion_depth + 1,
-				     template_instance_recursion_depth,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read element.",
-					 function );
-
-					goto on_error;
-				}
-				break;
-
-			case LIBFWEVT_XML_TOKEN_FRAGMENT_HEADER:
-				if( libfwevt_xml_document_read_fragment(
-				     internal_xml_document,
-				     xml_sub_token,
-				     binary_data,
-				     binary_data_size,
-				     binary_data_offset,
-				     ascii_codepage,
-				     flags,
-				     NULL,
-				     xml_tag,
-				     element_recursion_depth,
-				     template_instance_recursion_depth,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read fragment header.",
-					 function );
-
-					goto on_error;
-				}
-				break;
-
-			case LIBFWEVT_XML_TOKEN_TEMPLATE_INSTANCE:
-				if( libfwevt_xml_document_read_template_instance(
-				     internal_xml_document,
-				     xml_sub_token,
-				     binary_data,
-				     binary_data_size,
-				     binary_data_offset,
-				     ascii_codepage,
-				     flags,
-				     xml_tag,
-				     element_recursion_depth,
-				     template_instance_recursion_depth + 1,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_IO,
-					 LIBCERROR_IO_ERROR_READ_FAILED,
-					 "%s: unable to read document template instance.",
-					 function );
+		memory_free(
+		 output_buffer.data );
+	}
+	return( 1 );
 
-					goto on_error;
-				}
-				break;
+on_error:
+	if( output_buffer.data != NULL )
+	{
+		memory_free(
+		 output_buffer.data );
+	}
+	return( -1 );
+}
 
-			default:
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: invalid binary XML token - unsupported type: 0x%02" PRIx8 ".",
-				 function,
-				 xml_sub_token->type );
+/* Writes the UTF-8 formatted string of the XML document to a FILE stream
+ * The end-of-string character is not written
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_write_utf8_xml_string_to_file_stream(
+     libfwevt_xml_document_t *xml_document,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_xml_document_write_utf8_xml_string_to_file_stream";
 
-				goto on_error;
-		}
-		if( libfwevt_xml_token_free(
-		     &xml_sub_token,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free binary XML sub token.",
-			 function );
+	if( stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid stream.",
+		 function );
 
-			goto on_error;
-		}
+		return( -1 );
 	}
-	else
+	if( libfwevt_xml_document_write_utf8_xml_string(
+	     xml_document,
+	     &libfwevt_output_buffer_write_to_file_stream,
+	     (void *) stream,
+	     error ) != 1 )
 	{
-/* TODO for now the array types are kept separate to find undocumented values
- * when done apply ( substitution_value_type & 0x7f ) and remove the array types
- */
-		switch( substitution_value_type )
-		{
-			case LIBFWEVT_VALUE_TYPE_STRING_UTF16:
-			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_STRING_UTF16:
-				break;
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write UTF-8 string to stream.",
+		 function );
 
-			case LIBFWEVT_VALUE_TYPE_STRING_BYTE_STREAM:
-			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_STRING_BYTE_STREAM:
-				break;
+		return( -1 );
+	}
+	return( 1 );
+}
 
-			case LIBFWEVT_VALUE_TYPE_INTEGER_8BIT:
-			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_INTEGER_8BIT:
-				template_value_size = 1;
-				break;
+/* Renders the UTF-8 JSON formatted string of the XML document to an output buffer
+ * The JSON string contains an object with the name of the root XML tag as key
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_internal_xml_document_render_utf8_json_string(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     libfwevt_output_buffer_t *output_buffer,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_tag_t *internal_root_xml_tag = NULL;
+	static char *function                              = "libfwevt_internal_xml_document_render_utf8_json_string";
 
-			case LIBFWEVT_VALUE_TYPE_UNSIGNED_INTEGER_8BIT:
-			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_UNSIGNED_INTEGER_8BIT:
-				template_value_size = 1;
-				break;
+	if( internal_xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML document.",
+		 function );
 
-			case LIBFWEVT_VALUE_TYPE_INTEGER_16BIT:
-			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_INTEGER_16BIT:
-				template_value_size = 2;
-				break;
+		return( -1 );
+	}
+	if( internal_xml_document->root_xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid XML document - missing root XML tag.",
+		 function );
 
-			case LIBFWEVT_VALUE_TYPE_UNSIGNED_INTEGER_16BIT:
-			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_UNSIGNED_INTEGER_16BIT:
-				template_value_size = 2;
-				break;
+		return( -1 );
+	}
+	internal_root_xml_tag = (libfwevt_internal_xml_tag_t *) internal_xml_document->root_xml_tag;
 
-			case LIBFWEVT_VALUE_TYPE_INTEGER_32BIT:
-			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_INTEGER_32BIT:
-				template_value_size = 4;
-				break;
+	if( libfwevt_output_buffer_append_data(
+	     output_buffer,
+	     (uint8_t *) "{",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append start of object.",
+		 function );
 
-			case LIBFWEVT_VALUE_TYPE_UNSIGNED_INTEGER_32BIT:
-			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_UNSIGNED_INTEGER_32BIT:
-				template_value_size = 4;
-				break;
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_append_utf8_json_string_to_output_buffer(
+	     output_buffer,
+	     internal_root_xml_tag->name,
+	     internal_root_xml_tag->name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append name of root XML tag.",
+		 function );
 
-			case LIBFWEVT_VALUE_TYPE_HEXADECIMAL_INTEGER_32BIT:
-			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_HEXADECIMAL_INTEGER_32BIT:
-				template_value_size = 4;
-				break;
+		return( -1 );
+	}
+	if( libfwevt_output_buffer_append_data(
+	     output_buffer,
+	     (uint8_t *) ":",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append separator.",
+		 function );
 
-			case LIBFWEVT_VALUE_TYPE_INTEGER_64BIT:
-			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_INTEGER_64BIT:
-				template_value_size = 8;
-				break;
+		return( -1 );
+	}
+/* TODO pass codepage */
+	if( libfwevt_xml_tag_render_utf8_json_string(
+	     internal_xml_document->root_xml_tag,
+	     output_buffer,
+	     LIBUNA_CODEPAGE_WINDOWS_1252,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to render UTF-8 JSON string of root XML tag.",
+		 function );
 
-			case LIBFWEVT_VALUE_TYPE_UNSIGNED_INTEGER_64BIT:
-			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_UNSIGNED_INTEGER_64BIT:
-				template_value_size = 8;
-				break;
+		return( -1 );
+	}
+	if( libfwevt_output_buffer_append_data(
+	     output_buffer,
+	     (uint8_t *) "}",
+	     2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append end of object and end-of-string character.",
+		 function );
 
-			case LIBFWEVT_VALUE_TYPE_HEXADECIMAL_INTEGER_64BIT:
-			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_HEXADECIMAL_INTEGER_64BIT:
-				template_value_size = 8;
-				break;
+		return( -1 );
+	}
+	return( 1 );
+}
 
-			case LIBFWEVT_VALUE_TYPE_FLOATING_POINT_32BIT:
-			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_FLOATING_POINT_32BIT:
-				template_value_size = 4;
-				break;
+/* Retrieves the size of the UTF-8 JSON formatted string of the XML document
+ * The size is determined by rendering the string into a small staging buffer
+ * of which only the size is counted
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_get_utf8_json_string_size(
+     libfwevt_xml_document_t *xml_document,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwevt_output_buffer_t output_buffer;
 
-			case LIBFWEVT_VALUE_TYPE_FLOATING_POINT_64BIT:
-			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_FLOATING_POINT_64BIT:
-				template_value_size = 8;
-				break;
+	static char *function        = "libfwevt_xml_document_get_utf8_json_string_size";
+	size_t safe_utf8_string_size = 0;
 
-			case LIBFWEVT_VALUE_TYPE_BOOLEAN:
-				template_value_size = 4;
-				break;
+	if( xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML document.",
+		 function );
 
-			case LIBFWEVT_VALUE_TYPE_BINARY_DATA:
-				break;
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
 
-			case LIBFWEVT_VALUE_TYPE_GUID:
-			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_GUID:
-				template_value_size = 16;
-				break;
+		return( -1 );
+	}
+	output_buffer.data                = NULL;
+	output_buffer.data_size           = 0;
+	output_buffer.allocated_data_size = 0;
+	output_buffer.data_is_fixed       = 0;
+	output_buffer.write_callback      = &libfwevt_output_buffer_count_data_size;
+	output_buffer.callback_data       = (void *) &safe_utf8_string_size;
 
-/* TODO how to deal with array types ? */
-			case LIBFWEVT_VALUE_TYPE_SIZE:
-				if( ( substitution_value_data_size != 4 )
-				 && ( substitution_value_data_size != 8 ) )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-					 "%s: unsupported value data size: %" PRIu16 ".",
-					 function,
-					 substitution_value_data_size );
+	if( libfwevt_internal_xml_document_render_utf8_json_string(
+	     (libfwevt_internal_xml_document_t *) xml_document,
+	     &output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to render UTF-8 JSON string.",
+		 function );
 
-					goto on_error;
-				}
-				break;
+		goto on_error;
+	}
+	if( libfwevt_output_buffer_flush(
+	     &output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to flush output buffer.",
+		 function );
 
-			case LIBFWEVT_VALUE_TYPE_FILETIME:
-			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_FILETIME:
-				template_value_size = 8;
-				break;
+		goto on_error;
+	}
+	if( output_buffer.data != NULL )
+	{
+		memory_free(
+		 output_buffer.data );
+	}
+	*utf8_string_size = safe_utf8_string_size;
 
-			case LIBFWEVT_VALUE_TYPE_SYSTEMTIME:
-			case LIBFWEVT_VALUE_TYPE_ARRAY_OF_SYSTEMTIME:
-				template_value_size = 16;
-				break;
+	return( 1 );
 
-			case LIBFWEVT_VALUE_TYPE_NT_SECURITY_IDENTIFIER:
-				break;
+on_error:
+	if( output_buffer.data != NULL )
+	{
+		memory_free(
+		 output_buffer.data );
+	}
+	return( -1 );
+}
 
-			default:
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported value type: 0x%02" PRIx8 ".",
-				 function,
-				 substitution_value_type );
+/* Retrieves the UTF-8 JSON formatted string of the XML document
+ * The size should include the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_get_utf8_json_string(
+     libfwevt_xml_document_t *xml_document,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwevt_output_buffer_t output_buffer;
 
-				goto on_error;
-		}
-		if( libfwevt_xml_tag_set_value_type(
-		     xml_tag,
-		     substitution_value_type,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set value type.",
-			 function );
+	static char *function = "libfwevt_xml_document_get_utf8_json_string";
 
-			goto on_error;
-		}
-		if( ( substitution_value_type & LIBFWEVT_VALUE_TYPE_ARRAY ) != 0 )
-		{
-			safe_template_value_offset = *template_value_offset;
+	if( xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML document.",
+		 function );
 
-			if( substitution_value_data_size > 0 )
-			{
-				if( safe_template_value_offset >= (size_t) substitution_value_data_size )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-					 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-					 "%s: invalid template value offset value out of bounds.",
-					 function );
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
 
-					goto on_error;
-				}
-				template_value_data      = &( binary_data[ binary_data_offset + safe_template_value_offset ] );
-				template_value_data_size = substitution_value_data_size - (uint16_t) safe_template_value_offset;
-			}
-			if( template_value_data_size > 0 )
-			{
-#if defined( HAVE_DEBUG_OUTPUT )
-				if( libcnotify_verbose != 0 )
-				{
-					libcnotify_printf(
-					 "%s: template value data:\n",
-					 function );
-					libcnotify_print_data(
-					 template_value_data,
-					 template_value_data_size,
-					 LIBCNOTIFY_PRINT_DATA_FLAG_GROUP_DATA );
-				}
-#endif
-				if( substitution_value_type == LIBFWEVT_VALUE_TYPE_ARRAY_OF_STRING_BYTE_STREAM )
-				{
-					if( template_value_data_size < 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-						 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-						 "%s: invalid byte string template value data size value out of bounds.",
-						 function );
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
 
-						goto on_error;
-					}
-					while( template_value_data_offset < template_value_data_size )
-					{
-						if( template_value_data[ template_value_data_offset ] == 0 )
-						{
-							template_value_data_offset += 1;
+		return( -1 );
+	}
+	/* The JSON string is rendered directly into the UTF-8 string
+	 */
+	output_buffer.data                = utf8_string;
+	output_buffer.data_size           = 0;
+	output_buffer.allocated_data_size = utf8_string_size;
+	output_buffer.data_is_fixed       = 1;
+	output_buffer.write_callback      = NULL;
+	output_buffer.callback_data       = NULL;
+
+	if( libfwevt_internal_xml_document_render_utf8_json_string(
+	     (libfwevt_internal_xml_document_t *) xml_document,
+	     &output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to render UTF-8 JSON string.",
+		 function );
 
-							break;
-						}
-						template_value_data_offset += 1;
-					}
-					template_value_data_size = template_value_data_offset;
-				}
-				else if( substitution_value_type == LIBFWEVT_VALUE_TYPE_ARRAY_OF_STRING_UTF16 )
-				{
-					if( ( template_value_data_size < 2 )
-					 && ( ( template_value_data_size % 2 ) != 0 ) )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-						 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-						 "%s: invalid UTF-16 template value data size value out of bounds.",
-						 function );
+		return( -1 );
+	}
+	return( 1 );
+}
 
-						goto on_error;
-					}
-					while( template_value_data_offset < template_value_data_size )
-					{
-						if( ( template_value_data[ template_value_data_offset ] == 0 )
-						 && ( template_value_data[ template_value_data_offset + 1 ] == 0 ) )
-						{
-							template_value_data_offset += 2;
+/* Renders the UTF-8 JSON formatted string of the XML document in a single pass
+ * The UTF-8 string is reallocated when it is too small so that it can be reused
+ * for multiple XML documents, the caller must free it with free()
+ * The UTF-8 string size is set to the size of the rendered string including the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_document_render_utf8_json(
+     libfwevt_xml_document_t *xml_document,
+     uint8_t **utf8_string,
+     size_t *allocated_utf8_string_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwevt_output_buffer_t output_buffer;
 
-							break;
-						}
-						template_value_data_offset += 2;
-					}
-					template_value_data_size = template_value_data_offset;
-				}
-				else
-				{
-					if( template_value_size > template_value_data_size )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-						 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-						 "%s: invalid template value size value out of bounds.",
-						 function );
+	static char *function = "libfwevt_xml_document_render_utf8_json";
 
-						goto on_error;
-					}
-					template_value_data_size = template_value_size;
-				}
-			}
-			/* An empty XML tag should be created if template_value_data_size == 0
-			 */
-/* TODO create empty XML tag if template value data is an empty string */
-			if( template_value_data_size > 0 )
-			{
-				if( libfwevt_xml_tag_set_value_data(
-				     xml_tag,
-				     template_value_data,
-				     template_value_data_size,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-					 "%s: unable to set value data.",
-					 function );
+	if( xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML document.",
+		 function );
 
-					goto on_error;
-				}
-				safe_template_value_offset += template_value_data_size;
-			}
-			if( safe_template_value_offset == substitution_value_data_size )
-			{
-				safe_template_value_offset = 0;
-			}
-		}
-		else
-		{
-			if( ( template_value_size != 0 )
-			 && ( template_value_size != substitution_value_data_size ) )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid substitution value data size value out of bounds.",
-				 function );
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
 
-				goto on_error;
-			}
-			else if( ( substitution_value_type == LIBFWEVT_VALUE_TYPE_STRING_UTF16 )
-			      && ( ( substitution_value_data_size % 2 ) != 0 ) )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid UTF-16 substitution value data size value out of bounds.",
-				 function );
+		return( -1 );
+	}
+	if( allocated_utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid allocated UTF-8 string size.",
+		 function );
 
-				goto on_error;
-			}
-			if( libfwevt_xml_tag_set_value_data(
-			     xml_tag,
-			     &( binary_data[ binary_data_offset ] ),
-			     (size_t) substitution_value_data_size,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-				 "%s: unable to set value data.",
-				 function );
+		return( -1 );
+	}
+	if( ( *utf8_string != NULL )
+	 && ( *allocated_utf8_string_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid allocated UTF-8 string size value exceeds maximum.",
+		 function );
 
-				goto on_error;
-			}
-		}
-		if( libfwevt_xml_tag_set_flags(
-		     xml_tag,
-		     LIBFWEVT_XML_TAG_FLAG_IS_TEMPLATE_DEFINITION,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-			 "%s: unable to set flags.",
-			 function );
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
 
-			goto on_error;
-		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
-		{
-			if( libfwevt_xml_tag_debug_print_value_data_segment(
-			     xml_tag,
-			     0,
-			     0,
-			     ascii_codepage,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_PRINT_FAILED,
-				 "%s: unable to print value data segment: 0.",
-				 function );
+		return( -1 );
+	}
+	output_buffer.data                = *utf8_string;
+	output_buffer.data_size           = 0;
+	output_buffer.allocated_data_size = 0;
+	output_buffer.data_is_fixed       = 0;
+	output_buffer.write_callback      = NULL;
+	output_buffer.callback_data       = NULL;
 
-				goto on_error;
-			}
-		}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+	if( output_buffer.data != NULL )
+	{
+		output_buffer.allocated_data_size = *allocated_utf8_string_size;
 	}
-	*template_value_offset = safe_template_value_offset;
+	if( libfwevt_internal_xml_document_render_utf8_json_string(
+	     (libfwevt_internal_xml_document_t *) xml_document,
+	     &output_buffer,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to render UTF-8 JSON string.",
+		 function );
+
+		goto on_error;
+	}
+	*utf8_string                = output_buffer.data;
+	*allocated_utf8_string_size = output_buffer.allocated_data_size;
+	*utf8_string_size           = output_buffer.data_size;
 
 	return( 1 );
 
 on_error:
-	if( xml_sub_token != NULL )
-	{
-		libfwevt_xml_token_free(
-		 &xml_sub_token,
-		 NULL );
-	}
+	/* The UTF-8 string could have been reallocated
+	 */
+	*utf8_string                = output_buffer.data;
+	*allocated_utf8_string_size = output_buffer.allocated_data_size;
+
 	return( -1 );
 }
 
-/* Retrieves the size of the UTF-8 formatted string of the XML document
- * Returns 1 if successful or -1 on error
+/* Retrieves the size of the UTF-8 formatted string of a binary XML document using a XML template program
+ * The binary XML document is rendered directly from its template instance values without reading
+ * it into XML tags. The XML document itself is only used for its template cache
+ * Returns 1 if successful, 0 if the binary XML document is not supported by a XML template program or -1 on error
  */
-int libfwevt_xml_document_get_utf8_xml_string_size(
+int libfwevt_xml_document_get_utf8_xml_string_size_with_template_program(
      libfwevt_xml_document_t *xml_document,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     int ascii_codepage,
+     uint8_t flags,
      size_t *utf8_string_size,
      libcerror_error_t **error )
 {
-	libfwevt_internal_xml_document_t *internal_xml_document = NULL;
-	static char *function                                   = "libfwevt_xml_document_get_utf8_xml_string_size";
+	libfwevt_xml_document_template_program_state_t template_program_state;
+
+	static char *function    = "libfwevt_xml_document_get_utf8_xml_string_size_with_template_program";
+	size_t utf8_string_index = 0;
+	int result               = 0;
 
 	if( xml_document == NULL )
 	{
@@ -6578,40 +13928,86 @@ int libfwevt_xml_document_get_utf8_xml_string_size(
 
 		return( -1 );
 	}
-	internal_xml_document = (libfwevt_internal_xml_document_t *) xml_document;
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
 
-/* TODO pass codepage */
-	if( libfwevt_xml_tag_get_utf8_xml_string_size(
-	     internal_xml_document->root_xml_tag,
+		return( -1 );
+	}
+	if( memory_set(
+	     &template_program_state,
 	     0,
-	     utf8_string_size,
-	     LIBUNA_CODEPAGE_WINDOWS_1252,
-	     error ) != 1 )
+	     sizeof( libfwevt_xml_document_template_program_state_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear template program state.",
+		 function );
+
+		return( -1 );
+	}
+	template_program_state.internal_xml_document = (libfwevt_internal_xml_document_t *) xml_document;
+	template_program_state.binary_data           = binary_data;
+	template_program_state.ascii_codepage        = ascii_codepage;
+	template_program_state.flags                 = flags;
+
+	result = libfwevt_xml_document_render_template_program_instance(
+	          &template_program_state,
+	          binary_data_offset,
+	          binary_data_size,
+	          0,
+	          NULL,
+	          0,
+	          &utf8_string_index,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve size of UTF-8 string of root XML tag.",
+		 "%s: unable to retrieve size of UTF-8 string of template instance.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+	else if( result != 0 )
+	{
+		/* Add the size of the end of string character
+		 */
+		*utf8_string_size = utf8_string_index + 1;
+	}
+	return( result );
 }
 
-/* Retrieves the UTF-8 formatted string of the XML document
- * Returns 1 if successful or -1 on error
+/* Retrieves the UTF-8 formatted string of a binary XML document using a XML template program
+ * The size should include the end of string character
+ * Returns 1 if successful, 0 if the binary XML document is not supported by a XML template program or -1 on error
  */
-int libfwevt_xml_document_get_utf8_xml_string(
+int libfwevt_xml_document_get_utf8_xml_string_with_template_program(
      libfwevt_xml_document_t *xml_document,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     int ascii_codepage,
+     uint8_t flags,
      uint8_t *utf8_string,
      size_t utf8_string_size,
      libcerror_error_t **error )
 {
-	libfwevt_internal_xml_document_t *internal_xml_document = NULL;
-	static char *function                                   = "libfwevt_xml_document_get_utf8_xml_string";
-	size_t utf8_string_index                                = 0;
+	libfwevt_xml_document_template_program_state_t template_program_state;
+
+	static char *function    = "libfwevt_xml_document_get_utf8_xml_string_with_template_program";
+	size_t utf8_string_index = 0;
+	int result               = 0;
 
 	if( xml_document == NULL )
 	{
@@ -6624,28 +14020,171 @@ int libfwevt_xml_document_get_utf8_xml_string(
 
 		return( -1 );
 	}
-	internal_xml_document = (libfwevt_internal_xml_document_t *) xml_document;
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
 
-/* TODO pass codepage */
-	if( libfwevt_xml_tag_get_utf8_xml_string_with_index(
-	     internal_xml_document->root_xml_tag,
+		return( -1 );
+	}
+	if( ( utf8_string_size == 0 )
+	 || ( utf8_string_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &template_program_state,
 	     0,
-	     utf8_string,
-	     utf8_string_size,
-	     &utf8_string_index,
-	     LIBUNA_CODEPAGE_WINDOWS_1252,
-	     error ) != 1 )
+	     sizeof( libfwevt_xml_document_template_program_state_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear template program state.",
+		 function );
+
+		return( -1 );
+	}
+	template_program_state.internal_xml_document = (libfwevt_internal_xml_document_t *) xml_document;
+	template_program_state.binary_data           = binary_data;
+	template_program_state.ascii_codepage        = ascii_codepage;
+	template_program_state.flags                 = flags;
+
+	/* Reserve space for the end of string character
+	 */
+	result = libfwevt_xml_document_render_template_program_instance(
+	          &template_program_state,
+	          binary_data_offset,
+	          binary_data_size,
+	          0,
+	          utf8_string,
+	          utf8_string_size - 1,
+	          &utf8_string_index,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 string of root XML tag.",
+		 "%s: unable to retrieve UTF-8 string of template instance.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+	else if( result != 0 )
+	{
+		utf8_string[ utf8_string_index ] = 0;
+	}
+	return( result );
+}
+
+/* Extracts the substituted fields of a binary XML document using a XML template program
+ * The field callback is called for every substituted value that is not empty with the
+ * name of its element and the name of its attribute or NULL if it is element content.
+ * The fields of binary XML values are extracted from their template instances
+ * Returns 1 if successful, 0 if the binary XML document is not supported by a XML template program or -1 on error
+ */
+int libfwevt_xml_document_extract_fields_with_template_program(
+     libfwevt_xml_document_t *xml_document,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     int ascii_codepage,
+     uint8_t flags,
+     int (*field_callback)(
+            const uint8_t *element_name_utf16_stream,
+            size_t element_name_utf16_stream_size,
+            const uint8_t *attribute_name_utf16_stream,
+            size_t attribute_name_utf16_stream_size,
+            uint16_t template_value_index,
+            uint8_t value_type,
+            const uint8_t *value_data,
+            size_t value_data_size,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_document_template_program_state_t template_program_state;
+
+	static char *function = "libfwevt_xml_document_extract_fields_with_template_program";
+	int result            = 0;
+
+	if( xml_document == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML document.",
+		 function );
+
+		return( -1 );
+	}
+	if( field_callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid field callback.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &template_program_state,
+	     0,
+	     sizeof( libfwevt_xml_document_template_program_state_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear template program state.",
+		 function );
+
+		return( -1 );
+	}
+	template_program_state.internal_xml_document = (libfwevt_internal_xml_document_t *) xml_document;
+	template_program_state.binary_data           = binary_data;
+	template_program_state.ascii_codepage        = ascii_codepage;
+	template_program_state.flags                 = flags;
+	template_program_state.field_callback        = field_callback;
+	template_program_state.callback_data         = callback_data;
+
+	result = libfwevt_xml_document_extract_template_program_instance_fields(
+	          &template_program_state,
+	          binary_data_offset,
+	          binary_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to extract fields of template instance.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
 }
 
 /* Retrieves the size of the UTF-16 formatted string of the XML document
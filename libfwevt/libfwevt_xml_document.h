@@ -23,19 +23,174 @@
 #define _LIBFWEVT_XML_DOCUMENT_H
 
 #include <common.h>
+#include <file_stream.h>
 #include <types.h>
 
+#include "libfwevt_arena.h"
+#include "libfwevt_definitions.h"
 #include "libfwevt_extern.h"
 #include "libfwevt_libcdata.h"
 #include "libfwevt_libcerror.h"
+#include "libfwevt_output_buffer.h"
 #include "libfwevt_types.h"
+#include "libfwevt_xml_name_table.h"
+#include "libfwevt_xml_path_filter.h"
 #include "libfwevt_xml_tag.h"
+#include "libfwevt_xml_template_definition.h"
+#include "libfwevt_xml_template_program.h"
 #include "libfwevt_xml_token.h"
+#include "libfwevt_xml_tree.h"
 
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+typedef struct libfwevt_xml_document_parse_element libfwevt_xml_document_parse_element_t;
+
+struct libfwevt_xml_document_parse_element
+{
+	/* The name data
+	 * The name data is not copied and references the binary data
+	 */
+	const uint8_t *name_data;
+
+	/* The name data size
+	 */
+	size_t name_data_size;
+
+	/* The XML tag
+	 * References one of the XML tags of the parse state and
+	 * is not set if the element cannot match the path filter
+	 */
+	libfwevt_xml_tag_t *xml_tag;
+
+	/* The number of value data segments that have been reported
+	 */
+	int number_of_reported_data_segments;
+
+	/* The number of (sub) elements that have been reported
+	 * Only processing instructions are added to the XML tag as elements while parsing
+	 */
+	int number_of_reported_elements;
+
+	/* The index of the node of the element in the XML tree
+	 * Only set if the element has been started and the binary XML
+	 * document is read into a XML tree, otherwise -1
+	 */
+	int node_index;
+
+	/* The mask of the paths of the path filter that match the element
+	 */
+	uint32_t path_mask;
+};
+
+typedef struct libfwevt_xml_document_parse_state libfwevt_xml_document_parse_state_t;
+
+struct libfwevt_xml_document_parse_state
+{
+	/* The start element callback function
+	 */
+	int (*start_element_callback)(
+	       const uint8_t *name_utf16_stream,
+	       size_t name_utf16_stream_size,
+	       void *callback_data,
+	       libcerror_error_t **error );
+
+	/* The attribute callback function
+	 */
+	int (*attribute_callback)(
+	       const uint8_t *name_utf16_stream,
+	       size_t name_utf16_stream_size,
+	       uint8_t value_type,
+	       const uint8_t *value_data,
+	       size_t value_data_size,
+	       void *callback_data,
+	       libcerror_error_t **error );
+
+	/* The value callback function
+	 */
+	int (*value_callback)(
+	       uint8_t value_type,
+	       const uint8_t *value_data,
+	       size_t value_data_size,
+	       void *callback_data,
+	       libcerror_error_t **error );
+
+	/* The substitution callback function
+	 */
+	int (*substitution_callback)(
+	       uint16_t template_value_index,
+	       uint8_t value_type,
+	       const uint8_t *value_data,
+	       size_t value_data_size,
+	       void *callback_data,
+	       libcerror_error_t **error );
+
+	/* The end element callback function
+	 */
+	int (*end_element_callback)(
+	       const uint8_t *name_utf16_stream,
+	       size_t name_utf16_stream_size,
+	       void *callback_data,
+	       libcerror_error_t **error );
+
+	/* The callback data
+	 */
+	void *callback_data;
+
+	/* The path filter
+	 * Only set if the binary XML document is parsed with a path filter
+	 */
+	libfwevt_internal_xml_path_filter_t *path_filter;
+
+	/* The XML tree
+	 * Only set if the binary XML document is read into a XML tree,
+	 * the nodes are appended to the XML tree as the elements are parsed
+	 */
+	libfwevt_xml_tree_t *tree;
+
+	/* The elements that are being parsed
+	 */
+	libfwevt_xml_document_parse_element_t elements[ LIBFWEVT_XML_DOCUMENT_ELEMENT_RECURSION_DEPTH + 1 ];
+
+	/* The XML tags of the elements that are being parsed
+	 * The XML tag at an element depth is reused by the subsequent elements at that depth
+	 */
+	libfwevt_xml_tag_t *xml_tags[ LIBFWEVT_XML_DOCUMENT_ELEMENT_RECURSION_DEPTH + 1 ];
+
+	/* The number of elements that are being parsed
+	 */
+	int number_of_elements;
+
+	/* The number of elements of which the start has been reported
+	 * The start of an element is reported when its first content or
+	 * sub element is reported, or at its end
+	 */
+	int number_of_started_elements;
+};
+
+typedef struct libfwevt_xml_document_path_filter_result libfwevt_xml_document_path_filter_result_t;
+
+struct libfwevt_xml_document_path_filter_result
+{
+	/* The value data
+	 * References the binary data or the template definition
+	 */
+	const uint8_t *value_data;
+
+	/* The value data size
+	 */
+	size_t value_data_size;
+
+	/* The index of the path in the path filter
+	 */
+	int path_index;
+
+	/* The value type
+	 */
+	uint8_t value_type;
+};
+
 typedef struct libfwevt_internal_xml_document libfwevt_internal_xml_document_t;
 
 struct libfwevt_internal_xml_document
@@ -47,6 +202,118 @@ struct libfwevt_internal_xml_document
 	/* The size
 	 */
 	size_t size;
+
+	/* The template cache
+	 * The template cache is not owned by the binary XML document
+	 */
+	libfwevt_xml_template_cache_t *template_cache;
+
+	/* The number of template definitions that are being substituted
+	 * The template cache is only emptied if no template definitions are being substituted
+	 */
+	int number_of_active_template_definitions;
+
+	/* The arena
+	 * Only set if the binary XML document was read with LIBFWEVT_XML_DOCUMENT_READ_FLAG_USE_ARENA
+	 */
+	libfwevt_arena_t *arena;
+
+	/* The flags used to create the data segments of the values
+	 * Contains LIBFWEVT_DATA_SEGMENT_FLAG_BORROW_DATA if the binary XML document
+	 * was read with LIBFWEVT_XML_DOCUMENT_READ_FLAG_BORROW_DATA
+	 */
+	uint8_t data_segment_flags;
+
+	/* The name table
+	 * Contains the interned element and attribute names, only used if the binary
+	 * XML document was read with LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS
+	 */
+	libfwevt_xml_name_table_t *name_table;
+
+	/* The XML tree
+	 * Contains the XML tags if the binary XML document was read with
+	 * LIBFWEVT_XML_DOCUMENT_READ_FLAG_FLAT_TREE
+	 */
+	libfwevt_xml_tree_t *tree;
+
+	/* The parse state
+	 * Only set while the binary XML document is parsed with callbacks,
+	 * with a path filter or into the XML tree
+	 */
+	libfwevt_xml_document_parse_state_t *parse_state;
+
+	/* The path filter
+	 * The path filter is not owned by the binary XML document
+	 */
+	libfwevt_xml_path_filter_t *path_filter;
+
+	/* The path filter results
+	 */
+	libfwevt_xml_document_path_filter_result_t *path_filter_results;
+
+	/* The number of path filter results
+	 */
+	int number_of_path_filter_results;
+
+	/* The number of allocated path filter results
+	 */
+	int number_of_allocated_path_filter_results;
+
+	/* The template values arrays
+	 * Contains a template values array per template instance recursion depth, which
+	 * references the template values in the corresponding template values pool
+	 */
+	libcdata_array_t *template_values_arrays[ LIBFWEVT_XML_DOCUMENT_TEMPLATE_INSTANCE_RECURSION_DEPTH + 1 ];
+
+	/* The template values pools
+	 * Contains the template values that are reused by the template instances
+	 * per template instance recursion depth
+	 */
+	libcdata_array_t *template_values_pools[ LIBFWEVT_XML_DOCUMENT_TEMPLATE_INSTANCE_RECURSION_DEPTH + 1 ];
+};
+
+typedef struct libfwevt_xml_document_template_program_state libfwevt_xml_document_template_program_state_t;
+
+struct libfwevt_xml_document_template_program_state
+{
+	/* The binary XML document
+	 */
+	libfwevt_internal_xml_document_t *internal_xml_document;
+
+	/* The binary data
+	 */
+	const uint8_t *binary_data;
+
+	/* The ASCII codepage
+	 */
+	int ascii_codepage;
+
+	/* The read flags
+	 */
+	uint8_t flags;
+
+	/* The field callback function
+	 * Only set if the fields of the binary XML document are extracted
+	 */
+	int (*field_callback)(
+	       const uint8_t *element_name_utf16_stream,
+	       size_t element_name_utf16_stream_size,
+	       const uint8_t *attribute_name_utf16_stream,
+	       size_t attribute_name_utf16_stream_size,
+	       uint16_t template_value_index,
+	       uint8_t value_type,
+	       const uint8_t *value_data,
+	       size_t value_data_size,
+	       void *callback_data,
+	       libcerror_error_t **error );
+
+	/* The callback data
+	 */
+	void *callback_data;
+
+	/* The template instance recursion depth
+	 */
+	int template_instance_recursion_depth;
 };
 
 LIBFWEVT_EXTERN \
@@ -59,12 +326,45 @@ int libfwevt_xml_document_free(
      libfwevt_xml_document_t **xml_document,
      libcerror_error_t **error );
 
+LIBFWEVT_EXTERN \
+int libfwevt_xml_document_reset(
+     libfwevt_xml_document_t *xml_document,
+     libcerror_error_t **error );
+
 LIBFWEVT_EXTERN \
 int libfwevt_xml_document_get_root_xml_tag(
      libfwevt_xml_document_t *xml_document,
      libfwevt_xml_tag_t **root_xml_tag,
      libcerror_error_t **error );
 
+LIBFWEVT_EXTERN \
+int libfwevt_xml_document_set_template_cache(
+     libfwevt_xml_document_t *xml_document,
+     libfwevt_xml_template_cache_t *template_cache,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_document_set_path_filter(
+     libfwevt_xml_document_t *xml_document,
+     libfwevt_xml_path_filter_t *path_filter,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_document_get_number_of_path_filter_results(
+     libfwevt_xml_document_t *xml_document,
+     int *number_of_results,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_document_get_path_filter_result_by_index(
+     libfwevt_xml_document_t *xml_document,
+     int result_index,
+     int *path_index,
+     uint8_t *value_type,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error );
+
 LIBFWEVT_EXTERN \
 int libfwevt_xml_document_read(
      libfwevt_xml_document_t *xml_document,
@@ -75,6 +375,139 @@ int libfwevt_xml_document_read(
      uint8_t flags,
      libcerror_error_t **error );
 
+LIBFWEVT_EXTERN \
+int libfwevt_xml_document_read_with_path_filter(
+     libfwevt_xml_document_t *xml_document,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     int ascii_codepage,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+int libfwevt_internal_xml_document_read_tree(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     int ascii_codepage,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_document_parse_with_callbacks(
+     libfwevt_xml_document_t *xml_document,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     int ascii_codepage,
+     uint8_t flags,
+     int (*start_element_callback)(
+            const uint8_t *name_utf16_stream,
+            size_t name_utf16_stream_size,
+            void *callback_data,
+            libcerror_error_t **error ),
+     int (*attribute_callback)(
+            const uint8_t *name_utf16_stream,
+            size_t name_utf16_stream_size,
+            uint8_t value_type,
+            const uint8_t *value_data,
+            size_t value_data_size,
+            void *callback_data,
+            libcerror_error_t **error ),
+     int (*value_callback)(
+            uint8_t value_type,
+            const uint8_t *value_data,
+            size_t value_data_size,
+            void *callback_data,
+            libcerror_error_t **error ),
+     int (*substitution_callback)(
+            uint16_t template_value_index,
+            uint8_t value_type,
+            const uint8_t *value_data,
+            size_t value_data_size,
+            void *callback_data,
+            libcerror_error_t **error ),
+     int (*end_element_callback)(
+            const uint8_t *name_utf16_stream,
+            size_t name_utf16_stream_size,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+int libfwevt_xml_document_parse_state_initialize(
+     libfwevt_xml_document_parse_state_t **parse_state,
+     libcerror_error_t **error );
+
+int libfwevt_xml_document_parse_state_free(
+     libfwevt_xml_document_parse_state_t **parse_state,
+     libcerror_error_t **error );
+
+int libfwevt_xml_document_push_parse_element(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     const uint8_t *name_data,
+     size_t name_data_size,
+     libcerror_error_t **error );
+
+int libfwevt_xml_document_get_parse_element_xml_tag(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     libfwevt_xml_tag_t **xml_tag,
+     libcerror_error_t **error );
+
+int libfwevt_xml_document_filter_parse_element(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     uint8_t match_attributes,
+     libcerror_error_t **error );
+
+int libfwevt_xml_document_start_parse_elements(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     libcerror_error_t **error );
+
+int libfwevt_xml_document_append_parse_element_node(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     int element_index,
+     libcerror_error_t **error );
+
+int libfwevt_xml_document_report_parse_element_values(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     libfwevt_xml_value_t *xml_value,
+     int first_data_segment_index,
+     int number_of_data_segments,
+     int template_value_index,
+     libcerror_error_t **error );
+
+int libfwevt_xml_document_append_path_filter_result(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     int path_index,
+     uint8_t value_type,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error );
+
+int libfwevt_xml_document_append_path_filter_attribute_results(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     int element_index,
+     libcerror_error_t **error );
+
+int libfwevt_xml_document_append_path_filter_value_results(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     int element_index,
+     libfwevt_xml_value_t *xml_value,
+     int first_data_segment_index,
+     int number_of_data_segments,
+     libcerror_error_t **error );
+
+int libfwevt_xml_document_report_parse_element_content(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     int template_value_index,
+     libcerror_error_t **error );
+
+int libfwevt_xml_document_pop_parse_element(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     uint8_t is_omitted,
+     libcerror_error_t **error );
+
 int libfwevt_xml_document_read_with_template_values(
      libfwevt_xml_document_t *xml_document,
      const uint8_t *binary_data,
@@ -166,6 +599,18 @@ int libfwevt_xml_document_read_fragment_header(
      size_t binary_data_offset,
      libcerror_error_t **error );
 
+int libfwevt_xml_document_read_name_data(
+     libfwevt_internal_xml_document_t *xml_document,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     uint8_t flags,
+     uint16_t *name_hash,
+     const uint8_t **name_data,
+     size_t *name_data_size,
+     uint32_t *read_size,
+     libcerror_error_t **error );
+
 int libfwevt_xml_document_read_name(
      libfwevt_internal_xml_document_t *xml_document,
      const uint8_t *binary_data,
@@ -227,6 +672,72 @@ int libfwevt_xml_document_read_pi_target(
      int ascii_codepage,
      libcerror_error_t **error );
 
+int libfwevt_xml_document_read_template_definition(
+     libfwevt_internal_xml_document_t *xml_document,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     int ascii_codepage,
+     uint8_t flags,
+     libfwevt_xml_template_definition_t **template_definition,
+     libcerror_error_t **error );
+
+int libfwevt_xml_document_read_template_definition_attribute(
+     libfwevt_internal_xml_document_t *xml_document,
+     libfwevt_xml_token_t *xml_token,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     int ascii_codepage,
+     uint8_t flags,
+     libfwevt_xml_template_definition_t *template_definition,
+     libcerror_error_t **error );
+
+int libfwevt_xml_document_read_template_definition_content(
+     libfwevt_internal_xml_document_t *xml_document,
+     libfwevt_xml_token_t *xml_token,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     int ascii_codepage,
+     libfwevt_xml_template_definition_t *template_definition,
+     libfwevt_xml_tag_t **value_xml_tag,
+     libcerror_error_t **error );
+
+int libfwevt_xml_document_read_template_definition_element(
+     libfwevt_internal_xml_document_t *xml_document,
+     libfwevt_xml_token_t *xml_token,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     int ascii_codepage,
+     uint8_t flags,
+     libfwevt_xml_template_definition_t *template_definition,
+     int element_recursion_depth,
+     libcerror_error_t **error );
+
+int libfwevt_xml_document_read_template_definition_name(
+     libfwevt_internal_xml_document_t *xml_document,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     uint8_t flags,
+     libfwevt_xml_template_definition_t *template_definition,
+     int node_index,
+     uint32_t *name_data_size,
+     libcerror_error_t **error );
+
+int libfwevt_xml_document_get_template_definition(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     uint32_t template_definition_data_offset,
+     int ascii_codepage,
+     uint8_t flags,
+     libfwevt_xml_template_definition_t **template_definition,
+     uint8_t *free_template_definition,
+     libcerror_error_t **error );
+
 int libfwevt_xml_document_read_template_instance(
      libfwevt_internal_xml_document_t *xml_document,
      libfwevt_xml_token_t *xml_token,
@@ -240,11 +751,54 @@ int libfwevt_xml_document_read_template_instance(
      int template_instance_recursion_depth,
      libcerror_error_t **error );
 
+int libfwevt_xml_document_read_template_program_instance(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     int ascii_codepage,
+     uint8_t flags,
+     int template_instance_recursion_depth,
+     libfwevt_xml_template_definition_t **template_definition,
+     uint8_t *free_template_definition,
+     libfwevt_xml_template_program_t **program,
+     libcdata_array_t **template_values_array,
+     libcerror_error_t **error );
+
+int libfwevt_xml_document_free_template_program_instance(
+     libfwevt_xml_template_definition_t **template_definition,
+     uint8_t free_template_definition,
+     libcerror_error_t **error );
+
+int libfwevt_xml_document_render_template_program_instance(
+     void *template_program_state,
+     size_t binary_data_offset,
+     size_t binary_data_size,
+     int element_depth,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error );
+
+int libfwevt_xml_document_extract_template_program_instance_fields(
+     void *template_program_state,
+     size_t binary_data_offset,
+     size_t binary_data_size,
+     libcerror_error_t **error );
+
+int libfwevt_xml_document_get_template_values_array(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     int template_instance_recursion_depth,
+     int number_of_template_values,
+     libcdata_array_t **template_values_array,
+     libcerror_error_t **error );
+
 int libfwevt_xml_document_read_template_instance_values(
      libfwevt_internal_xml_document_t *xml_document,
      const uint8_t *binary_data,
      size_t binary_data_size,
      size_t binary_data_offset,
+     int template_instance_recursion_depth,
      libcdata_array_t **template_values_array,
      size_t *template_values_size,
      libcerror_error_t **error );
@@ -259,6 +813,57 @@ int libfwevt_xml_document_read_value(
      int ascii_codepage,
      libcerror_error_t **error );
 
+int libfwevt_xml_document_set_xml_tag_name(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     libfwevt_xml_tag_t *xml_tag,
+     uint8_t flags,
+     uint32_t name_offset,
+     uint16_t name_hash,
+     const uint8_t *name_data,
+     size_t name_data_size,
+     libcerror_error_t **error );
+
+int libfwevt_xml_document_substitute_template_definition(
+     libfwevt_internal_xml_document_t *xml_document,
+     libfwevt_xml_template_definition_t *template_definition,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     int ascii_codepage,
+     uint8_t flags,
+     libcdata_array_t *template_values_array,
+     libfwevt_xml_tag_t *xml_tag,
+     int element_recursion_depth,
+     int template_instance_recursion_depth,
+     libcerror_error_t **error );
+
+int libfwevt_xml_document_substitute_template_definition_attribute(
+     libfwevt_internal_xml_document_t *xml_document,
+     libfwevt_xml_template_definition_t *template_definition,
+     int node_index,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     int ascii_codepage,
+     uint8_t flags,
+     libcdata_array_t *template_values_array,
+     libfwevt_xml_tag_t *xml_tag,
+     int element_recursion_depth,
+     int template_instance_recursion_depth,
+     libcerror_error_t **error );
+
+int libfwevt_xml_document_substitute_template_definition_element(
+     libfwevt_internal_xml_document_t *xml_document,
+     libfwevt_xml_template_definition_t *template_definition,
+     int *node_index,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     int ascii_codepage,
+     uint8_t flags,
+     libcdata_array_t *template_values_array,
+     libfwevt_xml_tag_t *xml_tag,
+     int element_recursion_depth,
+     int template_instance_recursion_depth,
+     libcerror_error_t **error );
+
 int libfwevt_xml_document_substitute_template_value(
      libfwevt_internal_xml_document_t *xml_document,
      const uint8_t *binary_data,
@@ -287,6 +892,102 @@ int libfwevt_xml_document_get_utf8_xml_string(
      size_t utf8_string_size,
      libcerror_error_t **error );
 
+LIBFWEVT_EXTERN \
+int libfwevt_xml_document_render_utf8(
+     libfwevt_xml_document_t *xml_document,
+     uint8_t **utf8_string,
+     size_t *allocated_utf8_string_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_document_write_utf8_xml_string(
+     libfwevt_xml_document_t *xml_document,
+     int (*write_callback)(
+            const uint8_t *data,
+            size_t data_size,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_document_write_utf8_xml_string_to_file_stream(
+     libfwevt_xml_document_t *xml_document,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int libfwevt_internal_xml_document_render_utf8_json_string(
+     libfwevt_internal_xml_document_t *internal_xml_document,
+     libfwevt_output_buffer_t *output_buffer,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_document_get_utf8_json_string_size(
+     libfwevt_xml_document_t *xml_document,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_document_get_utf8_json_string(
+     libfwevt_xml_document_t *xml_document,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_document_render_utf8_json(
+     libfwevt_xml_document_t *xml_document,
+     uint8_t **utf8_string,
+     size_t *allocated_utf8_string_size,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_document_get_utf8_xml_string_size_with_template_program(
+     libfwevt_xml_document_t *xml_document,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     int ascii_codepage,
+     uint8_t flags,
+     size_t *utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_document_get_utf8_xml_string_with_template_program(
+     libfwevt_xml_document_t *xml_document,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     int ascii_codepage,
+     uint8_t flags,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_document_extract_fields_with_template_program(
+     libfwevt_xml_document_t *xml_document,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t binary_data_offset,
+     int ascii_codepage,
+     uint8_t flags,
+     int (*field_callback)(
+            const uint8_t *element_name_utf16_stream,
+            size_t element_name_utf16_stream_size,
+            const uint8_t *attribute_name_utf16_stream,
+            size_t attribute_name_utf16_stream_size,
+            uint16_t template_value_index,
+            uint8_t value_type,
+            const uint8_t *value_data,
+            size_t value_data_size,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     libcerror_error_t **error );
+
 LIBFWEVT_EXTERN \
 int libfwevt_xml_document_get_utf16_xml_string_size(
      libfwevt_xml_document_t *xml_document,
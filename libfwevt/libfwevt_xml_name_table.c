@@ -0,0 +1,358 @@
+/*
+ * XML name table functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwevt_libcerror.h"
+#include "libfwevt_xml_name_table.h"
+
+/* Creates a XML name table
+ * Make sure the value name_table is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_name_table_initialize(
+     libfwevt_xml_name_table_t **name_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_xml_name_table_initialize";
+
+	if( name_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name_table != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid name table value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*name_table = memory_allocate_structure(
+	               libfwevt_xml_name_table_t );
+
+	if( *name_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name table.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *name_table,
+	     0,
+	     sizeof( libfwevt_xml_name_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear name table.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *name_table != NULL )
+	{
+		memory_free(
+		 *name_table );
+
+		*name_table = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a XML name table
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_name_table_free(
+     libfwevt_xml_name_table_t **name_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_xml_name_table_free";
+	int result            = 1;
+
+	if( name_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name table.",
+		 function );
+
+		return( -1 );
+	}
+	if( *name_table != NULL )
+	{
+		if( libfwevt_xml_name_table_empty(
+		     *name_table,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty name table.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 *name_table );
+
+		*name_table = NULL;
+	}
+	return( result );
+}
+
+/* Empties a XML name table
+ * The interned names are freed and should no longer be referenced
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_name_table_empty(
+     libfwevt_xml_name_table_t *name_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_xml_name_table_empty";
+	int slot_index        = 0;
+
+	if( name_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name table.",
+		 function );
+
+		return( -1 );
+	}
+	for( slot_index = 0;
+	     slot_index < LIBFWEVT_XML_NAME_TABLE_NUMBER_OF_SLOTS;
+	     slot_index++ )
+	{
+		if( name_table->slots[ slot_index ].name_data != NULL )
+		{
+			memory_free(
+			 name_table->slots[ slot_index ].name_data );
+		}
+	}
+	if( memory_set(
+	     name_table,
+	     0,
+	     sizeof( libfwevt_xml_name_table_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear name table.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Determines if a XML name table is full
+ * Returns 1 if full, 0 if not or -1 on error
+ */
+int libfwevt_xml_name_table_is_full(
+     libfwevt_xml_name_table_t *name_table,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_xml_name_table_is_full";
+
+	if( name_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name table.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_table->number_of_names >= LIBFWEVT_XML_NAME_TABLE_MAXIMUM_NUMBER_OF_NAMES )
+	{
+		return( 1 );
+	}
+	return( 0 );
+}
+
+/* Retrieves the interned copy of a name
+ * The name is looked up by the offset and hash of the name in the binary data,
+ * the name data is compared as well since the offset is only unique within
+ * the binary data the name was read from. If the name is not yet in the table
+ * a copy of the name data is added
+ * Returns 1 if successful, 0 if the name table is full or -1 on error
+ */
+int libfwevt_xml_name_table_intern_name(
+     libfwevt_xml_name_table_t *name_table,
+     uint32_t name_offset,
+     uint16_t name_hash,
+     const uint8_t *name_data,
+     size_t name_data_size,
+     const uint8_t **interned_name_data,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_name_table_slot_t *slot = NULL;
+	static char *function                = "libfwevt_xml_name_table_intern_name";
+	uint32_t slot_index                  = 0;
+
+	if( name_table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name table.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_data_size == 0 )
+	 || ( name_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( interned_name_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid interned name data.",
+		 function );
+
+		return( -1 );
+	}
+	/* The name table is never full so a free slot is always found
+	 */
+	slot_index = ( ( name_offset * 0x9e3779b1UL ) ^ name_hash ) & ( LIBFWEVT_XML_NAME_TABLE_NUMBER_OF_SLOTS - 1 );
+
+	while( name_table->slots[ slot_index ].name_data != NULL )
+	{
+		slot = &( name_table->slots[ slot_index ] );
+
+		if( ( slot->name_offset == name_offset )
+		 && ( slot->name_hash == name_hash )
+		 && ( slot->name_data_size == name_data_size )
+		 && ( memory_compare(
+		       slot->name_data,
+		       name_data,
+		       name_data_size ) == 0 ) )
+		{
+			*interned_name_data = slot->name_data;
+
+			return( 1 );
+		}
+		slot_index = ( slot_index + 1 ) & ( LIBFWEVT_XML_NAME_TABLE_NUMBER_OF_SLOTS - 1 );
+	}
+	if( name_table->number_of_names >= LIBFWEVT_XML_NAME_TABLE_MAXIMUM_NUMBER_OF_NAMES )
+	{
+		return( 0 );
+	}
+	slot = &( name_table->slots[ slot_index ] );
+
+	slot->name_data = (uint8_t *) memory_allocate(
+	                               sizeof( uint8_t ) * name_data_size );
+
+	if( slot->name_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name data.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     slot->name_data,
+	     name_data,
+	     name_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name data.",
+		 function );
+
+		memory_free(
+		 slot->name_data );
+
+		slot->name_data = NULL;
+
+		return( -1 );
+	}
+	slot->name_data_size = name_data_size;
+	slot->name_offset    = name_offset;
+	slot->name_hash      = name_hash;
+
+	name_table->number_of_names += 1;
+
+	*interned_name_data = slot->name_data;
+
+	return( 1 );
+}
+
@@ -0,0 +1,107 @@
+/*
+ * XML name table functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWEVT_XML_NAME_TABLE_H )
+#define _LIBFWEVT_XML_NAME_TABLE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwevt_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The number of slots of a XML name table, must be a power of 2
+ */
+#define LIBFWEVT_XML_NAME_TABLE_NUMBER_OF_SLOTS			512
+
+/* The maximum number of names in a XML name table
+ */
+#define LIBFWEVT_XML_NAME_TABLE_MAXIMUM_NUMBER_OF_NAMES		384
+
+typedef struct libfwevt_xml_name_table_slot libfwevt_xml_name_table_slot_t;
+
+struct libfwevt_xml_name_table_slot
+{
+	/* The name data, NULL if the slot is not used
+	 * Contains an UTF-16 little-endian encoded string
+	 */
+	uint8_t *name_data;
+
+	/* The name data size
+	 */
+	size_t name_data_size;
+
+	/* The offset of the name in the binary data
+	 */
+	uint32_t name_offset;
+
+	/* The name hash
+	 */
+	uint16_t name_hash;
+};
+
+typedef struct libfwevt_xml_name_table libfwevt_xml_name_table_t;
+
+struct libfwevt_xml_name_table
+{
+	/* The number of names
+	 */
+	int number_of_names;
+
+	/* The slots
+	 */
+	libfwevt_xml_name_table_slot_t slots[ LIBFWEVT_XML_NAME_TABLE_NUMBER_OF_SLOTS ];
+};
+
+int libfwevt_xml_name_table_initialize(
+     libfwevt_xml_name_table_t **name_table,
+     libcerror_error_t **error );
+
+int libfwevt_xml_name_table_free(
+     libfwevt_xml_name_table_t **name_table,
+     libcerror_error_t **error );
+
+int libfwevt_xml_name_table_empty(
+     libfwevt_xml_name_table_t *name_table,
+     libcerror_error_t **error );
+
+int libfwevt_xml_name_table_is_full(
+     libfwevt_xml_name_table_t *name_table,
+     libcerror_error_t **error );
+
+int libfwevt_xml_name_table_intern_name(
+     libfwevt_xml_name_table_t *name_table,
+     uint32_t name_offset,
+     uint16_t name_hash,
+     const uint8_t *name_data,
+     size_t name_data_size,
+     const uint8_t **interned_name_data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWEVT_XML_NAME_TABLE_H ) */
+
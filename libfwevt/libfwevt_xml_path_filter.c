@@ -0,0 +1,1236 @@
+/*
+ * XML path filter functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwevt_definitions.h"
+#include "libfwevt_libcerror.h"
+#include "libfwevt_libuna.h"
+#include "libfwevt_types.h"
+#include "libfwevt_xml_path_filter.h"
+#include "libfwevt_xml_tag.h"
+#include "libfwevt_xml_value.h"
+
+/* Creates a XML path filter
+ * Make sure the value path_filter is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_path_filter_initialize(
+     libfwevt_xml_path_filter_t **path_filter,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_path_filter_t *internal_path_filter = NULL;
+	static char *function                                     = "libfwevt_xml_path_filter_initialize";
+
+	if( path_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path_filter != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid path filter value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_path_filter = memory_allocate_structure(
+	                        libfwevt_internal_xml_path_filter_t );
+
+	if( internal_path_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path filter.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_path_filter,
+	     0,
+	     sizeof( libfwevt_internal_xml_path_filter_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear path filter.",
+		 function );
+
+		goto on_error;
+	}
+	*path_filter = (libfwevt_xml_path_filter_t *) internal_path_filter;
+
+	return( 1 );
+
+on_error:
+	if( internal_path_filter != NULL )
+	{
+		memory_free(
+		 internal_path_filter );
+	}
+	return( -1 );
+}
+
+/* Frees a XML path filter
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_path_filter_free(
+     libfwevt_xml_path_filter_t **path_filter,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_path_filter_t *internal_path_filter = NULL;
+	static char *function                                     = "libfwevt_xml_path_filter_free";
+	int path_index                                            = 0;
+	int result                                                = 1;
+
+	if( path_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path_filter != NULL )
+	{
+		internal_path_filter = (libfwevt_internal_xml_path_filter_t *) *path_filter;
+		*path_filter         = NULL;
+
+		for( path_index = 0;
+		     path_index < internal_path_filter->number_of_paths;
+		     path_index++ )
+		{
+			if( libfwevt_xml_path_filter_path_free(
+			     &( internal_path_filter->paths[ path_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free path: %d.",
+				 function,
+				 path_index );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 internal_path_filter );
+	}
+	return( result );
+}
+
+/* Frees a XML path filter path
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_path_filter_path_free(
+     libfwevt_xml_path_filter_path_t **path,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_path_filter_element_t *element = NULL;
+	static char *function                       = "libfwevt_xml_path_filter_path_free";
+	int element_index                           = 0;
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path.",
+		 function );
+
+		return( -1 );
+	}
+	if( *path != NULL )
+	{
+		for( element_index = 0;
+		     element_index < LIBFWEVT_XML_PATH_FILTER_MAXIMUM_NUMBER_OF_ELEMENTS;
+		     element_index++ )
+		{
+			element = &( ( *path )->elements[ element_index ] );
+
+			if( element->name != NULL )
+			{
+				memory_free(
+				 element->name );
+			}
+			if( element->predicate_name != NULL )
+			{
+				memory_free(
+				 element->predicate_name );
+			}
+			if( element->predicate_value != NULL )
+			{
+				memory_free(
+				 element->predicate_value );
+			}
+		}
+		if( ( *path )->attribute_name != NULL )
+		{
+			memory_free(
+			 ( *path )->attribute_name );
+		}
+		memory_free(
+		 *path );
+
+		*path = NULL;
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of paths
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_path_filter_get_number_of_paths(
+     libfwevt_xml_path_filter_t *path_filter,
+     int *number_of_paths,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_path_filter_t *internal_path_filter = NULL;
+	static char *function                                     = "libfwevt_xml_path_filter_get_number_of_paths";
+
+	if( path_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_path_filter = (libfwevt_internal_xml_path_filter_t *) path_filter;
+
+	if( number_of_paths == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of paths.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_paths = internal_path_filter->number_of_paths;
+
+	return( 1 );
+}
+
+/* Appends an UTF-8 encoded path
+ * The path is relative to the root element and consists of element names
+ * separated by '/', for example "System/EventID". An element name can be
+ * followed by an attribute predicate, "Data[@Name='SubjectUserName']" or
+ * "Data[@Name]", and the last element name by an attribute name, for example
+ * "System/TimeCreated/@SystemTime"
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_path_filter_append_utf8_path(
+     libfwevt_xml_path_filter_t *path_filter,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *path_index,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_path_filter_t *internal_path_filter = NULL;
+	libfwevt_xml_path_filter_element_t *element               = NULL;
+	libfwevt_xml_path_filter_path_t *path                     = NULL;
+	static char *function                                     = "libfwevt_xml_path_filter_append_utf8_path";
+	size_t name_length                                        = 0;
+	size_t name_start_index                                   = 0;
+	size_t string_index                                       = 0;
+	uint8_t quote_character                                   = 0;
+
+	if( path_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path filter.",
+		 function );
+
+		return( -1 );
+	}
+	internal_path_filter = (libfwevt_internal_xml_path_filter_t *) path_filter;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_length == 0 )
+	 || ( utf8_string_length > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 4 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path index.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_path_filter->number_of_paths >= LIBFWEVT_XML_PATH_FILTER_MAXIMUM_NUMBER_OF_PATHS )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid path filter - number of paths value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	path = memory_allocate_structure(
+	        libfwevt_xml_path_filter_path_t );
+
+	if( path == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create path.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     path,
+	     0,
+	     sizeof( libfwevt_xml_path_filter_path_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear path.",
+		 function );
+
+		memory_free(
+		 path );
+
+		return( -1 );
+	}
+	while( string_index < utf8_string_length )
+	{
+		if( utf8_string[ string_index ] == (uint8_t) '@' )
+		{
+			/* The attribute name must be the last part of the path
+			 */
+			name_start_index = string_index + 1;
+
+			for( string_index = name_start_index;
+			     string_index < utf8_string_length;
+			     string_index++ )
+			{
+				if( ( utf8_string[ string_index ] == (uint8_t) '/' )
+				 || ( utf8_string[ string_index ] == (uint8_t) '[' )
+				 || ( utf8_string[ string_index ] == (uint8_t) ']' )
+				 || ( utf8_string[ string_index ] == (uint8_t) '=' )
+				 || ( utf8_string[ string_index ] == (uint8_t) '@' ) )
+				{
+					break;
+				}
+			}
+			name_length = string_index - name_start_index;
+
+			if( ( name_length == 0 )
+			 || ( string_index < utf8_string_length ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported attribute name at index: %" PRIzd ".",
+				 function,
+				 name_start_index );
+
+				goto on_error;
+			}
+			if( libfwevt_xml_path_filter_copy_utf16_stream_from_utf8(
+			     &( utf8_string[ name_start_index ] ),
+			     name_length,
+			     1,
+			     &( path->attribute_name ),
+			     &( path->attribute_name_size ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set attribute name.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+		}
+		if( path->number_of_elements >= LIBFWEVT_XML_PATH_FILTER_MAXIMUM_NUMBER_OF_ELEMENTS )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid path - number of elements value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		element = &( path->elements[ path->number_of_elements ] );
+
+		name_start_index = string_index;
+
+		while( string_index < utf8_string_length )
+		{
+			if( ( utf8_string[ string_index ] == (uint8_t) '/' )
+			 || ( utf8_string[ string_index ] == (uint8_t) '[' )
+			 || ( utf8_string[ string_index ] == (uint8_t) ']' )
+			 || ( utf8_string[ string_index ] == (uint8_t) '=' )
+			 || ( utf8_string[ string_index ] == (uint8_t) '@' ) )
+			{
+				break;
+			}
+			string_index++;
+		}
+		name_length = string_index - name_start_index;
+
+		if( name_length == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported element name at index: %" PRIzd ".",
+			 function,
+			 name_start_index );
+
+			goto on_error;
+		}
+		if( libfwevt_xml_path_filter_copy_utf16_stream_from_utf8(
+		     &( utf8_string[ name_start_index ] ),
+		     name_length,
+		     1,
+		     &( element->name ),
+		     &( element->name_size ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set element name.",
+			 function );
+
+			goto on_error;
+		}
+		if( ( string_index < utf8_string_length )
+		 && ( utf8_string[ string_index ] == (uint8_t) '[' ) )
+		{
+			string_index++;
+
+			if( ( string_index >= utf8_string_length )
+			 || ( utf8_string[ string_index ] != (uint8_t) '@' ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported predicate at index: %" PRIzd ".",
+				 function,
+				 string_index );
+
+				goto on_error;
+			}
+			string_index++;
+
+			name_start_index = string_index;
+
+			while( string_index < utf8_string_length )
+			{
+				if( ( utf8_string[ string_index ] == (uint8_t) '/' )
+				 || ( utf8_string[ string_index ] == (uint8_t) '[' )
+				 || ( utf8_string[ string_index ] == (uint8_t) ']' )
+				 || ( utf8_string[ string_index ] == (uint8_t) '=' )
+				 || ( utf8_string[ string_index ] == (uint8_t) '@' ) )
+				{
+					break;
+				}
+				string_index++;
+			}
+			name_length = string_index - name_start_index;
+
+			if( name_length == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported predicate attribute name at index: %" PRIzd ".",
+				 function,
+				 name_start_index );
+
+				goto on_error;
+			}
+			if( libfwevt_xml_path_filter_copy_utf16_stream_from_utf8(
+			     &( utf8_string[ name_start_index ] ),
+			     name_length,
+			     1,
+			     &( element->predicate_name ),
+			     &( element->predicate_name_size ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set predicate attribute name.",
+				 function );
+
+				goto on_error;
+			}
+			if( ( string_index < utf8_string_length )
+			 && ( utf8_string[ string_index ] == (uint8_t) '=' ) )
+			{
+				string_index++;
+
+				if( string_index < utf8_string_length )
+				{
+					quote_character = utf8_string[ string_index ];
+				}
+				if( ( string_index >= utf8_string_length )
+				 || ( ( quote_character != (uint8_t) '\'' )
+				  &&  ( quote_character != (uint8_t) '"' ) ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+					 "%s: unsupported predicate value at index: %" PRIzd ".",
+					 function,
+					 string_index );
+
+					goto on_error;
+				}
+				string_index++;
+
+				name_start_index = string_index;
+
+				while( ( string_index < utf8_string_length )
+				    && ( utf8_string[ string_index ] != quote_character ) )
+				{
+					string_index++;
+				}
+				name_length = string_index - name_start_index;
+
+				if( ( name_length == 0 )
+				 || ( string_index >= utf8_string_length ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+					 "%s: unsupported predicate value at index: %" PRIzd ".",
+					 function,
+					 name_start_index );
+
+					goto on_error;
+				}
+				if( libfwevt_xml_path_filter_copy_utf16_stream_from_utf8(
+				     &( utf8_string[ name_start_index ] ),
+				     name_length,
+				     0,
+				     &( element->predicate_value ),
+				     &( element->predicate_value_size ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set predicate attribute value.",
+					 function );
+
+					goto on_error;
+				}
+				string_index++;
+			}
+			if( ( string_index >= utf8_string_length )
+			 || ( utf8_string[ string_index ] != (uint8_t) ']' ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported predicate at index: %" PRIzd ".",
+				 function,
+				 string_index );
+
+				goto on_error;
+			}
+			string_index++;
+		}
+		path->number_of_elements += 1;
+
+		if( string_index < utf8_string_length )
+		{
+			if( ( utf8_string[ string_index ] != (uint8_t) '/' )
+			 || ( ( string_index + 1 ) >= utf8_string_length ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported path separator at index: %" PRIzd ".",
+				 function,
+				 string_index );
+
+				goto on_error;
+			}
+			string_index++;
+		}
+	}
+	*path_index = internal_path_filter->number_of_paths;
+
+	internal_path_filter->paths[ internal_path_filter->number_of_paths ] = path;
+
+	internal_path_filter->number_of_paths += 1;
+
+	return( 1 );
+
+on_error:
+	if( path != NULL )
+	{
+		libfwevt_xml_path_filter_path_free(
+		 &path,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Copies an UTF-8 encoded string to a newly allocated UTF-16 little-endian stream
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_path_filter_copy_utf16_stream_from_utf8(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint8_t include_end_of_string,
+     uint8_t **utf16_stream,
+     size_t *utf16_stream_size,
+     libcerror_error_t **error )
+{
+	libuna_utf16_character_t utf16_characters[ 2 ];
+
+	static char *function                        = "libfwevt_xml_path_filter_copy_utf16_stream_from_utf8";
+	libuna_unicode_character_t unicode_character = 0;
+	size_t safe_utf16_stream_size                = 0;
+	size_t utf16_character_index                 = 0;
+	size_t utf16_stream_index                    = 0;
+	size_t utf8_string_index                     = 0;
+	size_t utf16_index                           = 0;
+
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( utf8_string_length == 0 )
+	 || ( utf8_string_length > (size_t) ( ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 4 ) - 1 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid UTF-8 string length value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( *utf16_stream != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid UTF-16 stream value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Every UTF-8 character requires at most 4 bytes in UTF-16
+	 */
+	safe_utf16_stream_size = utf8_string_length * 4;
+
+	if( include_end_of_string != 0 )
+	{
+		safe_utf16_stream_size += 2;
+	}
+	*utf16_stream = (uint8_t *) memory_allocate(
+	                             sizeof( uint8_t ) * safe_utf16_stream_size );
+
+	if( *utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create UTF-16 stream.",
+		 function );
+
+		goto on_error;
+	}
+	while( utf8_string_index < utf8_string_length )
+	{
+		if( libuna_unicode_character_copy_from_utf8(
+		     &unicode_character,
+		     utf8_string,
+		     utf8_string_length,
+		     &utf8_string_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+			 "%s: unable to copy Unicode character from UTF-8.",
+			 function );
+
+			goto on_error;
+		}
+		if( unicode_character == 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported end-of-string character in UTF-8 string.",
+			 function );
+
+			goto on_error;
+		}
+		utf16_character_index = 0;
+
+		if( libuna_unicode_character_copy_to_utf16(
+		     unicode_character,
+		     utf16_characters,
+		     2,
+		     &utf16_character_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_OUTPUT_FAILED,
+			 "%s: unable to copy Unicode character to UTF-16.",
+			 function );
+
+			goto on_error;
+		}
+		for( utf16_index = 0;
+		     utf16_index < utf16_character_index;
+		     utf16_index++ )
+		{
+			byte_stream_copy_from_uint16_little_endian(
+			 &( ( *utf16_stream )[ utf16_stream_index ] ),
+			 utf16_characters[ utf16_index ] );
+
+			utf16_stream_index += 2;
+		}
+	}
+	if( include_end_of_string != 0 )
+	{
+		( *utf16_stream )[ utf16_stream_index++ ] = 0;
+		( *utf16_stream )[ utf16_stream_index++ ] = 0;
+	}
+	*utf16_stream_size = utf16_stream_index;
+
+	return( 1 );
+
+on_error:
+	if( *utf16_stream != NULL )
+	{
+		memory_free(
+		 *utf16_stream );
+
+		*utf16_stream = NULL;
+	}
+	return( -1 );
+}
+
+/* Retrieves the mask of all the paths
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_internal_xml_path_filter_get_path_mask(
+     libfwevt_internal_xml_path_filter_t *internal_path_filter,
+     uint32_t *path_mask,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_internal_xml_path_filter_get_path_mask";
+
+	if( internal_path_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_mask == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path mask.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_path_filter->number_of_paths <= 0 )
+	{
+		*path_mask = 0;
+	}
+	else
+	{
+		*path_mask = (uint32_t) 0xffffffffUL >> ( LIBFWEVT_XML_PATH_FILTER_MAXIMUM_NUMBER_OF_PATHS - internal_path_filter->number_of_paths );
+	}
+	return( 1 );
+}
+
+/* Matches the name of an element against the paths that matched its parent element
+ * The root element has an element depth of 0 and matches all paths
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_internal_xml_path_filter_match_element_name(
+     libfwevt_internal_xml_path_filter_t *internal_path_filter,
+     uint32_t parent_path_mask,
+     int element_depth,
+     const uint8_t *name_data,
+     size_t name_data_size,
+     uint32_t *path_mask,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_path_filter_element_t *element = NULL;
+	libfwevt_xml_path_filter_path_t *path       = NULL;
+	static char *function                       = "libfwevt_internal_xml_path_filter_match_element_name";
+	uint32_t safe_path_mask                     = 0;
+	int path_index                              = 0;
+
+	if( internal_path_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( element_depth < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid element depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name data.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_mask == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path mask.",
+		 function );
+
+		return( -1 );
+	}
+	if( element_depth == 0 )
+	{
+		*path_mask = parent_path_mask;
+
+		return( 1 );
+	}
+	for( path_index = 0;
+	     path_index < internal_path_filter->number_of_paths;
+	     path_index++ )
+	{
+		if( ( parent_path_mask & ( (uint32_t) 1 << path_index ) ) == 0 )
+		{
+			continue;
+		}
+		path = internal_path_filter->paths[ path_index ];
+
+		if( element_depth > path->number_of_elements )
+		{
+			continue;
+		}
+		element = &( path->elements[ element_depth - 1 ] );
+
+		if( ( element->name_size == name_data_size )
+		 && ( memory_compare(
+		       element->name,
+		       name_data,
+		       name_data_size ) == 0 ) )
+		{
+			safe_path_mask |= (uint32_t) 1 << path_index;
+		}
+	}
+	*path_mask = safe_path_mask;
+
+	return( 1 );
+}
+
+/* Matches the attributes of an element against the predicates of the paths that matched its name
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_internal_xml_path_filter_match_element_attributes(
+     libfwevt_internal_xml_path_filter_t *internal_path_filter,
+     int element_depth,
+     libfwevt_xml_tag_t *xml_tag,
+     uint32_t *path_mask,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_path_filter_element_t *element = NULL;
+	libfwevt_xml_tag_t *attribute_xml_tag       = NULL;
+	libfwevt_xml_value_t *xml_value             = NULL;
+	const uint8_t *name_data                    = NULL;
+	const uint8_t *value_data                   = NULL;
+	static char *function                       = "libfwevt_internal_xml_path_filter_match_element_attributes";
+	size_t name_data_size                       = 0;
+	size_t value_data_size                      = 0;
+	uint32_t safe_path_mask                     = 0;
+	uint8_t value_type                          = 0;
+	int attribute_index                         = 0;
+	int number_of_attributes                    = 0;
+	int number_of_data_segments                 = 0;
+	int path_index                              = 0;
+	int result                                  = 0;
+
+	if( internal_path_filter == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path filter.",
+		 function );
+
+		return( -1 );
+	}
+	if( element_depth < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid element depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( path_mask == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid path mask.",
+		 function );
+
+		return( -1 );
+	}
+	if( element_depth == 0 )
+	{
+		return( 1 );
+	}
+	safe_path_mask = *path_mask;
+
+	for( path_index = 0;
+	     path_index < internal_path_filter->number_of_paths;
+	     path_index++ )
+	{
+		if( ( safe_path_mask & ( (uint32_t) 1 << path_index ) ) == 0 )
+		{
+			continue;
+		}
+		element = &( internal_path_filter->paths[ path_index ]->elements[ element_depth - 1 ] );
+
+		if( element->predicate_name == NULL )
+		{
+			continue;
+		}
+		if( number_of_attributes == 0 )
+		{
+			if( libfwevt_xml_tag_get_number_of_attributes(
+			     xml_tag,
+			     &number_of_attributes,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve number of attributes.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		result = 0;
+
+		for( attribute_index = 0;
+		     attribute_index < number_of_attributes;
+		     attribute_index++ )
+		{
+			if( libfwevt_xml_tag_get_attribute_by_index(
+			     xml_tag,
+			     attribute_index,
+			     &attribute_xml_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve attribute: %d.",
+				 function,
+				 attribute_index );
+
+				return( -1 );
+			}
+			if( libfwevt_xml_tag_get_name_data(
+			     attribute_xml_tag,
+			     &name_data,
+			     &name_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve attribute: %d name data.",
+				 function,
+				 attribute_index );
+
+				return( -1 );
+			}
+			if( ( element->predicate_name_size != name_data_size )
+			 || ( memory_compare(
+			       element->predicate_name,
+			       name_data,
+			       name_data_size ) != 0 ) )
+			{
+				continue;
+			}
+			if( element->predicate_value == NULL )
+			{
+				result = 1;
+
+				break;
+			}
+			if( libfwevt_xml_tag_get_value(
+			     attribute_xml_tag,
+			     &xml_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve attribute: %d value.",
+				 function,
+				 attribute_index );
+
+				return( -1 );
+			}
+			if( xml_value == NULL )
+			{
+				break;
+			}
+			if( libfwevt_xml_value_get_type(
+			     xml_value,
+			     &value_type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve attribute: %d value type.",
+				 function,
+				 attribute_index );
+
+				return( -1 );
+			}
+			if( libfwevt_xml_value_get_number_of_data_segments(
+			     xml_value,
+			     &number_of_data_segments,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve attribute: %d number of value data segments.",
+				 function,
+				 attribute_index );
+
+				return( -1 );
+			}
+			if( ( value_type != LIBFWEVT_VALUE_TYPE_STRING_UTF16 )
+			 || ( number_of_data_segments != 1 ) )
+			{
+				break;
+			}
+			if( libfwevt_xml_value_get_data_segment_data(
+			     xml_value,
+			     0,
+			     &value_data,
+			     &value_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve attribute: %d value data.",
+				 function,
+				 attribute_index );
+
+				return( -1 );
+			}
+			/* Substituted strings can contain trailing end-of-string characters
+			 */
+			while( ( value_data_size >= 2 )
+			    && ( value_data[ value_data_size - 2 ] == 0 )
+			    && ( value_data[ value_data_size - 1 ] == 0 ) )
+			{
+				value_data_size -= 2;
+			}
+			if( ( element->predicate_value_size == value_data_size )
+			 && ( memory_compare(
+			       element->predicate_value,
+			       value_data,
+			       value_data_size ) == 0 ) )
+			{
+				result = 1;
+			}
+			break;
+		}
+		if( result == 0 )
+		{
+			safe_path_mask &= ~( (uint32_t) 1 << path_index );
+		}
+	}
+	*path_mask = safe_path_mask;
+
+	return( 1 );
+}
+
@@ -0,0 +1,174 @@
+/*
+ * XML path filter functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWEVT_XML_PATH_FILTER_H )
+#define _LIBFWEVT_XML_PATH_FILTER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwevt_extern.h"
+#include "libfwevt_libcerror.h"
+#include "libfwevt_types.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+/* The maximum number of paths of a XML path filter
+ * The paths that match an element are stored as a 32-bit mask
+ */
+#define LIBFWEVT_XML_PATH_FILTER_MAXIMUM_NUMBER_OF_PATHS	32
+
+/* The maximum number of elements of a XML path
+ */
+#define LIBFWEVT_XML_PATH_FILTER_MAXIMUM_NUMBER_OF_ELEMENTS	16
+
+typedef struct libfwevt_xml_path_filter_element libfwevt_xml_path_filter_element_t;
+
+struct libfwevt_xml_path_filter_element
+{
+	/* The name
+	 * Contains an UTF-16 little-endian encoded string including the end-of-string character
+	 */
+	uint8_t *name;
+
+	/* The name size
+	 */
+	size_t name_size;
+
+	/* The attribute name of the predicate or NULL if not set
+	 * Contains an UTF-16 little-endian encoded string including the end-of-string character
+	 */
+	uint8_t *predicate_name;
+
+	/* The attribute name size of the predicate
+	 */
+	size_t predicate_name_size;
+
+	/* The attribute value of the predicate or NULL if only the attribute must be present
+	 * Contains an UTF-16 little-endian encoded string without the end-of-string character
+	 */
+	uint8_t *predicate_value;
+
+	/* The attribute value size of the predicate
+	 */
+	size_t predicate_value_size;
+};
+
+typedef struct libfwevt_xml_path_filter_path libfwevt_xml_path_filter_path_t;
+
+struct libfwevt_xml_path_filter_path
+{
+	/* The elements
+	 */
+	libfwevt_xml_path_filter_element_t elements[ LIBFWEVT_XML_PATH_FILTER_MAXIMUM_NUMBER_OF_ELEMENTS ];
+
+	/* The number of elements
+	 */
+	int number_of_elements;
+
+	/* The attribute name or NULL if the path selects the value of the last element
+	 * Contains an UTF-16 little-endian encoded string including the end-of-string character
+	 */
+	uint8_t *attribute_name;
+
+	/* The attribute name size
+	 */
+	size_t attribute_name_size;
+};
+
+typedef struct libfwevt_internal_xml_path_filter libfwevt_internal_xml_path_filter_t;
+
+struct libfwevt_internal_xml_path_filter
+{
+	/* The paths
+	 */
+	libfwevt_xml_path_filter_path_t *paths[ LIBFWEVT_XML_PATH_FILTER_MAXIMUM_NUMBER_OF_PATHS ];
+
+	/* The number of paths
+	 */
+	int number_of_paths;
+};
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_path_filter_initialize(
+     libfwevt_xml_path_filter_t **path_filter,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_path_filter_free(
+     libfwevt_xml_path_filter_t **path_filter,
+     libcerror_error_t **error );
+
+int libfwevt_xml_path_filter_path_free(
+     libfwevt_xml_path_filter_path_t **path,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_path_filter_get_number_of_paths(
+     libfwevt_xml_path_filter_t *path_filter,
+     int *number_of_paths,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_path_filter_append_utf8_path(
+     libfwevt_xml_path_filter_t *path_filter,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     int *path_index,
+     libcerror_error_t **error );
+
+int libfwevt_xml_path_filter_copy_utf16_stream_from_utf8(
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     uint8_t include_end_of_string,
+     uint8_t **utf16_stream,
+     size_t *utf16_stream_size,
+     libcerror_error_t **error );
+
+int libfwevt_internal_xml_path_filter_get_path_mask(
+     libfwevt_internal_xml_path_filter_t *internal_path_filter,
+     uint32_t *path_mask,
+     libcerror_error_t **error );
+
+int libfwevt_internal_xml_path_filter_match_element_name(
+     libfwevt_internal_xml_path_filter_t *internal_path_filter,
+     uint32_t parent_path_mask,
+     int element_depth,
+     const uint8_t *name_data,
+     size_t name_data_size,
+     uint32_t *path_mask,
+     libcerror_error_t **error );
+
+int libfwevt_internal_xml_path_filter_match_element_attributes(
+     libfwevt_internal_xml_path_filter_t *internal_path_filter,
+     int element_depth,
+     libfwevt_xml_tag_t *xml_tag,
+     uint32_t *path_mask,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWEVT_XML_PATH_FILTER_H ) */
+
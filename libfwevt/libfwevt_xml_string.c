@@ -20,12 +20,472 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <types.h>
 
 #include "libfwevt_libcerror.h"
 #include "libfwevt_libuna.h"
 #include "libfwevt_xml_string.h"
 
+#if defined( LIBFWEVT_XML_STRING_HAVE_AVX2 )
+#include <immintrin.h>
+
+#define LIBFWEVT_XML_STRING_TARGET_SSE2	__attribute__((target("sse2")))
+#define LIBFWEVT_XML_STRING_TARGET_AVX2	__attribute__((target("avx2")))
+
+#elif defined( LIBFWEVT_XML_STRING_HAVE_SSE2 )
+#include <emmintrin.h>
+#include <intrin.h>
+
+#define LIBFWEVT_XML_STRING_TARGET_SSE2
+
+#endif
+
+#if defined( LIBFWEVT_XML_STRING_HAVE_SSE2 )
+
+/* Retrieves the index of the first bit that is set in a non-zero bit mask
+ * Returns the bit index
+ */
+int libfwevt_xml_string_get_first_bit_set(
+     uint32_t bit_mask )
+{
+#if defined( _MSC_VER )
+	unsigned long bit_index = 0;
+
+	_BitScanForward(
+	 &bit_index,
+	 (unsigned long) bit_mask );
+
+	return( (int) bit_index );
+#else
+	return( __builtin_ctz( bit_mask ) );
+#endif
+}
+
+#endif /* defined( LIBFWEVT_XML_STRING_HAVE_SSE2 ) */
+
+/* Copies the leading ASCII characters that do not need to be escaped from an UTF-16 little-endian stream
+ * Copying stops at the first end-of-string, '&', '<', '>' or non-ASCII character
+ * If utf8_string is NULL the characters are only counted, otherwise it must
+ * be able to contain number_of_characters characters
+ * Returns the number of characters copied
+ */
+size_t libfwevt_xml_string_copy_ascii_from_utf16_little_endian(
+        const uint8_t *utf16_stream,
+        size_t number_of_characters,
+        uint8_t *utf8_string )
+{
+	size_t character_index = 0;
+	uint8_t byte_value     = 0;
+
+	while( character_index < number_of_characters )
+	{
+		byte_value = utf16_stream[ character_index * 2 ];
+
+		if( ( utf16_stream[ ( character_index * 2 ) + 1 ] != 0 )
+		 || ( byte_value == 0 )
+		 || ( byte_value >= 0x80 )
+		 || ( byte_value == (uint8_t) '&' )
+		 || ( byte_value == (uint8_t) '<' )
+		 || ( byte_value == (uint8_t) '>' ) )
+		{
+			break;
+		}
+		if( utf8_string != NULL )
+		{
+			utf8_string[ character_index ] = byte_value;
+		}
+		character_index++;
+	}
+	return( character_index );
+}
+
+#if defined( LIBFWEVT_XML_STRING_HAVE_SSE2 )
+
+/* Copies the leading ASCII characters that do not need to be escaped from an UTF-16 little-endian stream
+ * using SSE2 to test 16 characters at a time
+ * Returns the number of characters copied
+ */
+LIBFWEVT_XML_STRING_TARGET_SSE2
+size_t libfwevt_xml_string_copy_ascii_from_utf16_little_endian_sse2(
+        const uint8_t *utf16_stream,
+        size_t number_of_characters,
+        uint8_t *utf8_string )
+{
+	__m128i ampersand_vector    = _mm_set1_epi8( '&' );
+	__m128i greater_than_vector = _mm_set1_epi8( '>' );
+	__m128i less_than_vector    = _mm_set1_epi8( '<' );
+	__m128i zero_vector         = _mm_setzero_si128();
+	__m128i byte_vector;
+	__m128i escape_vector;
+
+	size_t character_index      = 0;
+	uint32_t bit_mask           = 0;
+
+	while( ( number_of_characters - character_index ) >= 16 )
+	{
+		/* The pack uses unsigned saturation of the characters, read as signed
+		 * 16-bit integers, which maps characters 0x0100 - 0x7fff to 0xff and
+		 * characters 0x8000 - 0xffff to 0x00, both stop the copy
+		 */
+		byte_vector = _mm_packus_epi16(
+		               _mm_loadu_si128(
+		                (const __m128i *) &( utf16_stream[ character_index * 2 ] ) ),
+		               _mm_loadu_si128(
+		                (const __m128i *) &( utf16_stream[ ( character_index * 2 ) + 16 ] ) ) );
+
+		escape_vector = _mm_or_si128(
+		                 _mm_or_si128(
+		                  _mm_cmpeq_epi8(
+		                   byte_vector,
+		                   zero_vector ),
+		                  _mm_cmpeq_epi8(
+		                   byte_vector,
+		                   ampersand_vector ) ),
+		                 _mm_or_si128(
+		                  _mm_cmpeq_epi8(
+		                   byte_vector,
+		                   less_than_vector ),
+		                  _mm_cmpeq_epi8(
+		                   byte_vector,
+		                   greater_than_vector ) ) );
+
+		/* The most significant bit of a byte is set for non-ASCII and escaped characters
+		 */
+		bit_mask = (uint32_t) _mm_movemask_epi8(
+		                       _mm_or_si128(
+		                        byte_vector,
+		                        escape_vector ) );
+
+		if( utf8_string != NULL )
+		{
+			_mm_storeu_si128(
+			 (__m128i *) &( utf8_string[ character_index ] ),
+			 byte_vector );
+		}
+		if( bit_mask != 0 )
+		{
+			return( character_index + libfwevt_xml_string_get_first_bit_set( bit_mask ) );
+		}
+		character_index += 16;
+	}
+	if( utf8_string != NULL )
+	{
+		utf8_string = &( utf8_string[ character_index ] );
+	}
+	character_index += libfwevt_xml_string_copy_ascii_from_utf16_little_endian(
+	                    &( utf16_stream[ character_index * 2 ] ),
+	                    number_of_characters - character_index,
+	                    utf8_string );
+
+	return( character_index );
+}
+
+#endif /* defined( LIBFWEVT_XML_STRING_HAVE_SSE2 ) */
+
+#if defined( LIBFWEVT_XML_STRING_HAVE_AVX2 )
+
+/* Copies the leading ASCII characters that do not need to be escaped from an UTF-16 little-endian stream
+ * using AVX2 to test 32 characters at a time
+ * Returns the number of characters copied
+ */
+LIBFWEVT_XML_STRING_TARGET_AVX2
+size_t libfwevt_xml_string_copy_ascii_from_utf16_little_endian_avx2(
+        const uint8_t *utf16_stream,
+        size_t number_of_characters,
+        uint8_t *utf8_string )
+{
+	__m256i ampersand_vector    = _mm256_set1_epi8( '&' );
+	__m256i greater_than_vector = _mm256_set1_epi8( '>' );
+	__m256i less_than_vector    = _mm256_set1_epi8( '<' );
+	__m256i zero_vector         = _mm256_setzero_si256();
+	__m256i byte_vector;
+	__m256i escape_vector;
+
+	size_t character_index      = 0;
+	uint32_t bit_mask           = 0;
+
+	while( ( number_of_characters - character_index ) >= 32 )
+	{
+		/* The pack operates per 128-bit lane, the permute restores the character order
+		 */
+		byte_vector = _mm256_permute4x64_epi64(
+		               _mm256_packus_epi16(
+		                _mm256_loadu_si256(
+		                 (const __m256i *) &( utf16_stream[ character_index * 2 ] ) ),
+		                _mm256_loadu_si256(
+		                 (const __m256i *) &( utf16_stream[ ( character_index * 2 ) + 32 ] ) ) ),
+		               0xd8 );
+
+		escape_vector = _mm256_or_si256(
+		                 _mm256_or_si256(
+		                  _mm256_cmpeq_epi8(
+		                   byte_vector,
+		                   zero_vector ),
+		                  _mm256_cmpeq_epi8(
+		                   byte_vector,
+		                   ampersand_vector ) ),
+		                 _mm256_or_si256(
+		                  _mm256_cmpeq_epi8(
+		                   byte_vector,
+		                   less_than_vector ),
+		                  _mm256_cmpeq_epi8(
+		                   byte_vector,
+		                   greater_than_vector ) ) );
+
+		bit_mask = (uint32_t) _mm256_movemask_epi8(
+		                       _mm256_or_si256(
+		                        byte_vector,
+		                        escape_vector ) );
+
+		if( utf8_string != NULL )
+		{
+			_mm256_storeu_si256(
+			 (__m256i *) &( utf8_string[ character_index ] ),
+			 byte_vector );
+		}
+		if( bit_mask != 0 )
+		{
+			return( character_index + libfwevt_xml_string_get_first_bit_set( bit_mask ) );
+		}
+		character_index += 32;
+	}
+	if( utf8_string != NULL )
+	{
+		utf8_string = &( utf8_string[ character_index ] );
+	}
+	character_index += libfwevt_xml_string_copy_ascii_from_utf16_little_endian_sse2(
+	                    &( utf16_stream[ character_index * 2 ] ),
+	                    number_of_characters - character_index,
+	                    utf8_string );
+
+	return( character_index );
+}
+
+#endif /* defined( LIBFWEVT_XML_STRING_HAVE_AVX2 ) */
+
+#if defined( LIBFWEVT_XML_STRING_HAVE_AVX2 )
+
+/* The function to copy ASCII characters, selected on first use
+ */
+static libfwevt_xml_string_copy_ascii_function_t libfwevt_xml_string_copy_ascii_function = NULL;
+
+#endif
+
+/* Selects the function to copy ASCII characters from an UTF-16 little-endian stream
+ * that uses the widest vector instructions supported by the CPU
+ * Returns a pointer to the function
+ */
+libfwevt_xml_string_copy_ascii_function_t libfwevt_xml_string_select_copy_ascii_function(
+                                           void )
+{
+#if defined( LIBFWEVT_XML_STRING_HAVE_AVX2 )
+	if( __builtin_cpu_supports( "avx2" ) )
+	{
+		return( &libfwevt_xml_string_copy_ascii_from_utf16_little_endian_avx2 );
+	}
+#endif
+#if defined( LIBFWEVT_XML_STRING_HAVE_SSE2 )
+#if defined( __GNUC__ )
+	if( __builtin_cpu_supports( "sse2" ) )
+#endif
+	{
+		return( &libfwevt_xml_string_copy_ascii_from_utf16_little_endian_sse2 );
+	}
+#endif
+	return( &libfwevt_xml_string_copy_ascii_from_utf16_little_endian );
+}
+
+/* Retrieves the function to copy ASCII characters from an UTF-16 little-endian stream
+ * The function is selected on first use and cached, concurrent first uses select
+ * and store the same function
+ * Returns a pointer to the function
+ */
+libfwevt_xml_string_copy_ascii_function_t libfwevt_xml_string_get_copy_ascii_function(
+                                           void )
+{
+#if defined( LIBFWEVT_XML_STRING_HAVE_AVX2 )
+	libfwevt_xml_string_copy_ascii_function_t copy_ascii_function = NULL;
+
+	copy_ascii_function = __atomic_load_n(
+	                       &libfwevt_xml_string_copy_ascii_function,
+	                       __ATOMIC_RELAXED );
+
+	if( copy_ascii_function == NULL )
+	{
+		copy_ascii_function = libfwevt_xml_string_select_copy_ascii_function();
+
+		__atomic_store_n(
+		 &libfwevt_xml_string_copy_ascii_function,
+		 copy_ascii_function,
+		 __ATOMIC_RELAXED );
+	}
+	return( copy_ascii_function );
+#else
+	return( libfwevt_xml_string_select_copy_ascii_function() );
+#endif
+}
+
+/* Copies the characters of an UTF-16 little-endian stream that can be converted
+ * without decoding them with libuna, which are ASCII characters that do not need
+ * to be escaped and characters in the basic multilingual plane other than surrogates
+ * Copying stops at the first other character or when the UTF-8 string is full
+ * If utf8_string is NULL only the UTF-8 string index is updated
+ * The last character is set to the last character copied and left unchanged if no characters are copied
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_utf8_xml_string_with_index_copy_from_utf16_little_endian_run(
+     libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *utf16_stream_index,
+     libuna_unicode_character_t *last_unicode_character,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_string_copy_ascii_function_t copy_ascii_function = NULL;
+	static char *function                                         = "libfwevt_utf8_xml_string_with_index_copy_from_utf16_little_endian_run";
+	size_t number_of_characters                                   = 0;
+	size_t safe_utf16_stream_index                                = 0;
+	size_t safe_utf8_string_index                                 = 0;
+	uint16_t character_value                                      = 0;
+
+	if( utf8_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream index.",
+		 function );
+
+		return( -1 );
+	}
+	if( last_unicode_character == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid last Unicode character.",
+		 function );
+
+		return( -1 );
+	}
+	copy_ascii_function = libfwevt_xml_string_get_copy_ascii_function();
+
+	safe_utf16_stream_index = *utf16_stream_index;
+	safe_utf8_string_index  = *utf8_string_index;
+
+	while( ( safe_utf16_stream_index + 1 ) < utf16_stream_size )
+	{
+		number_of_characters = ( utf16_stream_size - safe_utf16_stream_index ) / 2;
+
+		if( utf8_string != NULL )
+		{
+			if( safe_utf8_string_index >= utf8_string_size )
+			{
+				break;
+			}
+			if( number_of_characters > ( utf8_string_size - safe_utf8_string_index ) )
+			{
+				number_of_characters = utf8_string_size - safe_utf8_string_index;
+			}
+			number_of_characters = copy_ascii_function(
+			                        &( utf16_stream[ safe_utf16_stream_index ] ),
+			                        number_of_characters,
+			                        &( utf8_string[ safe_utf8_string_index ] ) );
+		}
+		else
+		{
+			number_of_characters = copy_ascii_function(
+			                        &( utf16_stream[ safe_utf16_stream_index ] ),
+			                        number_of_characters,
+			                        NULL );
+		}
+		if( number_of_characters > 0 )
+		{
+			safe_utf16_stream_index += number_of_characters * 2;
+			safe_utf8_string_index  += number_of_characters;
+
+			*last_unicode_character = utf16_stream[ safe_utf16_stream_index - 2 ];
+		}
+		if( ( safe_utf16_stream_index + 1 ) >= utf16_stream_size )
+		{
+			break;
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( utf16_stream[ safe_utf16_stream_index ] ),
+		 character_value );
+
+		/* ASCII characters that stopped the copy and surrogates are left to libuna
+		 */
+		if( ( character_value < 0x0080 )
+		 || ( ( character_value >= 0xd800 )
+		  &&  ( character_value <= 0xdfff ) ) )
+		{
+			break;
+		}
+		if( character_value < 0x0800 )
+		{
+			if( utf8_string != NULL )
+			{
+				if( ( utf8_string_size - safe_utf8_string_index ) < 2 )
+				{
+					break;
+				}
+				utf8_string[ safe_utf8_string_index ]     = (libuna_utf8_character_t) ( 0xc0 | ( character_value >> 6 ) );
+				utf8_string[ safe_utf8_string_index + 1 ] = (libuna_utf8_character_t) ( 0x80 | ( character_value & 0x3f ) );
+			}
+			safe_utf8_string_index += 2;
+		}
+		else
+		{
+			if( utf8_string != NULL )
+			{
+				if( ( utf8_string_size - safe_utf8_string_index ) < 3 )
+				{
+					break;
+				}
+				utf8_string[ safe_utf8_string_index ]     = (libuna_utf8_character_t) ( 0xe0 | ( character_value >> 12 ) );
+				utf8_string[ safe_utf8_string_index + 1 ] = (libuna_utf8_character_t) ( 0x80 | ( ( character_value >> 6 ) & 0x3f ) );
+				utf8_string[ safe_utf8_string_index + 2 ] = (libuna_utf8_character_t) ( 0x80 | ( character_value & 0x3f ) );
+			}
+			safe_utf8_string_index += 3;
+		}
+		safe_utf16_stream_index += 2;
+
+		*last_unicode_character = character_value;
+	}
+	*utf16_stream_index = safe_utf16_stream_index;
+	*utf8_string_index  = safe_utf8_string_index;
+
+	return( 1 );
+}
+
 /* Determines the size of an UTF-8 XML string from an UTF-16 stream
  * Returns 1 if successful or -1 on error
  */
@@ -40,6 +500,7 @@ int libfwevt_utf8_xml_string_size_from_utf16_stream(
 	libuna_unicode_character_t unicode_character = 0;
 	size_t safe_utf8_string_size                 = 0;
 	size_t utf16_stream_index                    = 0;
+	int is_little_endian                         = 0;
 	int read_byte_order                          = 0;
 	int result                                   = 0;
 
@@ -112,8 +573,40 @@ int libfwevt_utf8_xml_string_size_from_utf16_stream(
 			byte_order = read_byte_order;
 		}
 	}
+	/* Characters that do not need libuna are converted in runs of little-endian characters
+	 */
+	if( ( byte_order & ~( LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE ) ) == LIBUNA_ENDIAN_LITTLE )
+	{
+		is_little_endian = 1;
+	}
 	while( ( utf16_stream_index + 1 ) < utf16_stream_size )
 	{
+		if( is_little_endian != 0 )
+		{
+			if( libfwevt_utf8_xml_string_with_index_copy_from_utf16_little_endian_run(
+			     NULL,
+			     0,
+			     &safe_utf8_string_size,
+			     utf16_stream,
+			     utf16_stream_size,
+			     &utf16_stream_index,
+			     &unicode_character,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+				 "%s: unable to copy characters from UTF-16 stream.",
+				 function );
+
+				return( -1 );
+			}
+			if( ( utf16_stream_index + 1 ) >= utf16_stream_size )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-16 stream bytes into an Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf16_stream(
@@ -216,6 +709,7 @@ int libfwevt_utf8_xml_string_with_index_copy_from_utf16_stream(
 	libuna_unicode_character_t unicode_character = 0;
 	size_t safe_utf8_string_index                = 0;
 	size_t utf16_stream_index                    = 0;
+	int is_little_endian                         = 0;
 	int read_byte_order                          = 0;
 	int result                                   = 0;
 
@@ -307,10 +801,42 @@ int libfwevt_utf8_xml_string_with_index_copy_from_utf16_stream(
 			byte_order = read_byte_order;
 		}
 	}
+	/* Characters that do not need libuna are converted in runs of little-endian characters
+	 */
+	if( ( byte_order & ~( LIBUNA_UTF16_STREAM_ALLOW_UNPAIRED_SURROGATE ) ) == LIBUNA_ENDIAN_LITTLE )
+	{
+		is_little_endian = 1;
+	}
 	safe_utf8_string_index = *utf8_string_index;
 
 	while( ( utf16_stream_index + 1 ) < utf16_stream_size )
 	{
+		if( is_little_endian != 0 )
+		{
+			if( libfwevt_utf8_xml_string_with_index_copy_from_utf16_little_endian_run(
+			     utf8_string,
+			     utf8_string_size,
+			     &safe_utf8_string_index,
+			     utf16_stream,
+			     utf16_stream_size,
+			     &utf16_stream_index,
+			     &unicode_character,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+				 LIBCERROR_CONVERSION_ERROR_INPUT_FAILED,
+				 "%s: unable to copy characters from UTF-16 stream.",
+				 function );
+
+				return( -1 );
+			}
+			if( ( utf16_stream_index + 1 ) >= utf16_stream_size )
+			{
+				break;
+			}
+		}
 		/* Convert the UTF-16 stream bytes into an Unicode character
 		 */
 		if( libuna_unicode_character_copy_from_utf16_stream(
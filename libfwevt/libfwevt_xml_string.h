@@ -28,10 +28,74 @@
 #include "libfwevt_libcerror.h"
 #include "libfwevt_libuna.h"
 
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+#if defined( __clang__ ) || ( __GNUC__ > 4 ) || ( ( __GNUC__ == 4 ) && ( __GNUC_MINOR__ >= 9 ) )
+#define LIBFWEVT_XML_STRING_HAVE_SSE2
+#define LIBFWEVT_XML_STRING_HAVE_AVX2
+#endif
+
+#elif defined( _MSC_VER ) && ( defined( _M_X64 ) || defined( _M_AMD64 ) )
+/* SSE2 is part of the x64 instruction set
+ */
+#define LIBFWEVT_XML_STRING_HAVE_SSE2
+
+#endif
+
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+typedef size_t (*libfwevt_xml_string_copy_ascii_function_t)(
+                 const uint8_t *utf16_stream,
+                 size_t number_of_characters,
+                 uint8_t *utf8_string );
+
+#if defined( LIBFWEVT_XML_STRING_HAVE_SSE2 )
+
+int libfwevt_xml_string_get_first_bit_set(
+     uint32_t bit_mask );
+
+#endif
+
+size_t libfwevt_xml_string_copy_ascii_from_utf16_little_endian(
+        const uint8_t *utf16_stream,
+        size_t number_of_characters,
+        uint8_t *utf8_string );
+
+#if defined( LIBFWEVT_XML_STRING_HAVE_SSE2 )
+
+size_t libfwevt_xml_string_copy_ascii_from_utf16_little_endian_sse2(
+        const uint8_t *utf16_stream,
+        size_t number_of_characters,
+        uint8_t *utf8_string );
+
+#endif
+
+#if defined( LIBFWEVT_XML_STRING_HAVE_AVX2 )
+
+size_t libfwevt_xml_string_copy_ascii_from_utf16_little_endian_avx2(
+        const uint8_t *utf16_stream,
+        size_t number_of_characters,
+        uint8_t *utf8_string );
+
+#endif
+
+libfwevt_xml_string_copy_ascii_function_t libfwevt_xml_string_select_copy_ascii_function(
+                                           void );
+
+libfwevt_xml_string_copy_ascii_function_t libfwevt_xml_string_get_copy_ascii_function(
+                                           void );
+
+int libfwevt_utf8_xml_string_with_index_copy_from_utf16_little_endian_run(
+     libuna_utf8_character_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     size_t *utf16_stream_index,
+     libuna_unicode_character_t *last_unicode_character,
+     libcerror_error_t **error );
+
 int libfwevt_utf8_xml_string_size_from_utf16_stream(
      const uint8_t *utf16_stream,
      size_t utf16_stream_size,
@@ -30,14 +30,18 @@
 #include <wctype.h>
 #endif
 
+#include "libfwevt_arena.h"
+#include "libfwevt_array.h"
 #include "libfwevt_debug.h"
 #include "libfwevt_definitions.h"
-#include "libfwevt_libcdata.h"
+#include "libfwevt_json_string.h"
 #include "libfwevt_libcerror.h"
 #include "libfwevt_libcnotify.h"
 #include "libfwevt_libuna.h"
+#include "libfwevt_output_buffer.h"
 #include "libfwevt_types.h"
 #include "libfwevt_xml_tag.h"
+#include "libfwevt_xml_tree.h"
 #include "libfwevt_xml_value.h"
 
 /* Creates a XML tag
@@ -47,9 +51,39 @@
 int libfwevt_xml_tag_initialize(
      libfwevt_xml_tag_t **xml_tag,
      libcerror_error_t **error )
+{
+	static char *function = "libfwevt_xml_tag_initialize";
+
+	if( libfwevt_xml_tag_initialize_with_arena(
+	     xml_tag,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a XML tag
+ * Make sure the value xml_tag is referencing, is set to NULL
+ * If an arena is provided the XML tag, its name, value and attribute and element arrays
+ * are allocated from the arena and are released when the arena is reset or freed
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_tag_initialize_with_arena(
+     libfwevt_xml_tag_t **xml_tag,
+     libfwevt_arena_t *arena,
+     libcerror_error_t **error )
 {
 	libfwevt_internal_xml_tag_t *internal_xml_tag = NULL;
-	static char *function                         = "libfwevt_xml_tag_initialize";
+	static char *function                         = "libfwevt_xml_tag_initialize_with_arena";
 
 	if( xml_tag == NULL )
 	{
@@ -73,19 +107,40 @@ int libfwevt_xml_tag_initialize(
 
 		return( -1 );
 	}
-	internal_xml_tag = memory_allocate_structure(
-	                    libfwevt_internal_xml_tag_t );
+	if( arena != NULL )
+	{
+		if( libfwevt_arena_allocate(
+		     arena,
+		     sizeof( libfwevt_internal_xml_tag_t ),
+		     (void **) &internal_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create XML tag.",
+			 function );
 
-	if( internal_xml_tag == NULL )
+			return( -1 );
+		}
+	}
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create XML tag.",
-		 function );
+		internal_xml_tag = memory_allocate_structure(
+		                    libfwevt_internal_xml_tag_t );
 
-		goto on_error;
+		if( internal_xml_tag == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create XML tag.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	if( memory_set(
 	     internal_xml_tag,
@@ -99,14 +154,18 @@ int libfwevt_xml_tag_initialize(
 		 "%s: unable to clear XML tag.",
 		 function );
 
-		memory_free(
-		 internal_xml_tag );
-
+		if( arena == NULL )
+		{
+			memory_free(
+			 internal_xml_tag );
+		}
 		return( -1 );
 	}
-	if( libcdata_array_initialize(
+	internal_xml_tag->arena = arena;
+
+	if( libfwevt_array_initialize_with_arena(
 	     &( internal_xml_tag->attributes_array ),
-	     0,
+	     arena,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -118,9 +177,9 @@ int libfwevt_xml_tag_initialize(
 
 		goto on_error;
 	}
-	if( libcdata_array_initialize(
+	if( libfwevt_array_initialize_with_arena(
 	     &( internal_xml_tag->elements_array ),
-	     0,
+	     arena,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -141,13 +200,16 @@ on_error:
 	{
 		if( internal_xml_tag->attributes_array != NULL )
 		{
-			libcdata_array_free(
+			libfwevt_array_free(
 			 &( internal_xml_tag->attributes_array ),
 			 NULL,
 			 NULL );
 		}
-		memory_free(
-		 internal_xml_tag );
+		if( arena == NULL )
+		{
+			memory_free(
+			 internal_xml_tag );
+		}
 	}
 	return( -1 );
 }
@@ -202,7 +264,20 @@ int libfwevt_internal_xml_tag_free(
 	}
 	if( *internal_xml_tag != NULL )
 	{
-		if( libcdata_array_free(
+		/* The nodes of a XML tree are freed with the XML tree
+		 */
+		if( ( *internal_xml_tag )->tree != NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported XML tag - node of XML tree.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwevt_array_free(
 		     &( ( *internal_xml_tag )->elements_array ),
 		     (int (*)(intptr_t **, libcerror_error_t **)) &libfwevt_internal_xml_tag_free,
 		     error ) != 1 )
@@ -216,7 +291,7 @@ int libfwevt_internal_xml_tag_free(
 
 			result = -1;
 		}
-		if( libcdata_array_free(
+		if( libfwevt_array_free(
 		     &( ( *internal_xml_tag )->attributes_array ),
 		     (int (*)(intptr_t **, libcerror_error_t **)) &libfwevt_internal_xml_tag_free,
 		     error ) != 1 )
@@ -246,19 +321,118 @@ int libfwevt_internal_xml_tag_free(
 				result = -1;
 			}
 		}
-		if( ( *internal_xml_tag )->name != NULL )
+		/* The name and XML tag allocated from an arena are released with the arena
+		 * and an interned name is owned by the name table
+		 */
+		if( ( *internal_xml_tag )->arena == NULL )
 		{
+			if( ( ( *internal_xml_tag )->name != NULL )
+			 && ( ( *internal_xml_tag )->name_is_interned == 0 ) )
+			{
+				memory_free(
+				 ( *internal_xml_tag )->name );
+			}
 			memory_free(
-			 ( *internal_xml_tag )->name );
+			 *internal_xml_tag );
 		}
-		memory_free(
-		 *internal_xml_tag );
-
 		*internal_xml_tag = NULL;
 	}
 	return( result );
 }
 
+/* Clears a XML tag
+ * Frees the name, value, attributes and elements, so that the XML tag can be reused
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_internal_xml_tag_clear(
+     libfwevt_internal_xml_tag_t *internal_xml_tag,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_internal_xml_tag_clear";
+	int result            = 1;
+
+	if( internal_xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_xml_tag->tree != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported XML tag - node of XML tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_array_empty(
+	     internal_xml_tag->elements_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfwevt_internal_xml_tag_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty elements array.",
+		 function );
+
+		result = -1;
+	}
+	if( libfwevt_array_empty(
+	     internal_xml_tag->attributes_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfwevt_internal_xml_tag_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty attributes array.",
+		 function );
+
+		result = -1;
+	}
+	if( internal_xml_tag->value != NULL )
+	{
+		if( libfwevt_internal_xml_value_free(
+		     (libfwevt_internal_xml_value_t **) &( internal_xml_tag->value ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free value.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( ( internal_xml_tag->name != NULL )
+	 && ( internal_xml_tag->name_is_interned == 0 )
+	 && ( internal_xml_tag->arena == NULL ) )
+	{
+		memory_free(
+		 internal_xml_tag->name );
+	}
+	internal_xml_tag->type             = 0;
+	internal_xml_tag->name             = NULL;
+	internal_xml_tag->name_size        = 0;
+	internal_xml_tag->name_is_interned = 0;
+	internal_xml_tag->flags            = 0;
+
+	return( result );
+}
+
 /* Appends an attribute
  * Returns 1 if successful or -1 on error
  */
@@ -284,7 +458,7 @@ int libfwevt_xml_tag_append_attribute(
 	}
 	internal_xml_tag = (libfwevt_internal_xml_tag_t *) xml_tag;
 
-	if( libcdata_array_append_entry(
+	if( libfwevt_array_append_entry(
 	     internal_xml_tag->attributes_array,
 	     &entry_index,
 	     (intptr_t *) attribute_xml_tag,
@@ -391,9 +565,22 @@ int libfwevt_xml_tag_set_name_data(
 	}
 	if( data_size > 0 )
 	{
-		internal_xml_tag->name = (uint8_t *) memory_allocate(
-		                                      sizeof( uint8_t ) * data_size );
-
+		if( internal_xml_tag->arena != NULL )
+		{
+			if( libfwevt_arena_allocate(
+			     internal_xml_tag->arena,
+			     sizeof( uint8_t ) * data_size,
+			     (void **) &( internal_xml_tag->name ),
+			     error ) != 1 )
+			{
+				internal_xml_tag->name = NULL;
+			}
+		}
+		else
+		{
+			internal_xml_tag->name = (uint8_t *) memory_allocate(
+			                                      sizeof( uint8_t ) * data_size );
+		}
 		if( internal_xml_tag->name == NULL )
 		{
 			libcerror_error_set(
@@ -427,9 +614,11 @@ int libfwevt_xml_tag_set_name_data(
 on_error:
 	if( internal_xml_tag->name != NULL )
 	{
-		memory_free(
-		 internal_xml_tag->name );
-
+		if( internal_xml_tag->arena == NULL )
+		{
+			memory_free(
+			 internal_xml_tag->name );
+		}
 		internal_xml_tag->name = NULL;
 	}
 	internal_xml_tag->name_size = 0;
@@ -437,6 +626,74 @@ on_error:
 	return( -1 );
 }
 
+/* Sets interned UTF-16 little-endian encoded name data
+ * The name data is not copied and must remain available while the XML tag is used
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_tag_set_interned_name_data(
+     libfwevt_xml_tag_t *xml_tag,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_tag_t *internal_xml_tag = NULL;
+	static char *function                         = "libfwevt_xml_tag_set_interned_name_data";
+
+	if( xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_tag = (libfwevt_internal_xml_tag_t *) xml_tag;
+
+	if( internal_xml_tag->name != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid XML tag - name value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > 0 )
+	{
+		internal_xml_tag->name             = (uint8_t *) data;
+		internal_xml_tag->name_size        = data_size;
+		internal_xml_tag->name_is_interned = 1;
+	}
+	return( 1 );
+}
+
 /* Sets the value type
  * Returns 1 if successful or -1 on error
  */
@@ -464,9 +721,10 @@ int libfwevt_xml_tag_set_value_type(
 
 	if( internal_xml_tag->value == NULL )
 	{
-		if( libfwevt_xml_value_initialize(
+		if( libfwevt_xml_value_initialize_with_arena(
 		     &( internal_xml_tag->value ),
 		     value_type,
+		     internal_xml_tag->arena,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -511,12 +769,14 @@ int libfwevt_xml_tag_set_value_type(
 }
 
 /* Sets the value data
+ * The flags are passed to the data segment, refer to libfwevt_data_segment_initialize_with_arena
  * Returns 1 if successful or -1 on error
  */
 int libfwevt_xml_tag_set_value_data(
      libfwevt_xml_tag_t *xml_tag,
      const uint8_t *data,
      size_t data_size,
+     uint8_t flags,
      libcerror_error_t **error )
 {
 	libfwevt_internal_xml_tag_t *internal_xml_tag = NULL;
@@ -540,6 +800,7 @@ int libfwevt_xml_tag_set_value_data(
 	     internal_xml_tag->value,
 	     data,
 	     data_size,
+	     flags,
 	     &data_segment_index,
 	     error ) != 1 )
 	{
@@ -556,12 +817,14 @@ int libfwevt_xml_tag_set_value_data(
 }
 
 /* Appends value data
+ * The flags are passed to the data segment, refer to libfwevt_data_segment_initialize_with_arena
  * Returns 1 if successful or -1 on error
  */
 int libfwevt_xml_tag_append_value_data(
      libfwevt_xml_tag_t *xml_tag,
      const uint8_t *data,
      size_t data_size,
+     uint8_t flags,
      int *data_segment_index,
      libcerror_error_t **error )
 {
@@ -585,6 +848,7 @@ int libfwevt_xml_tag_append_value_data(
 	     internal_xml_tag->value,
 	     data,
 	     data_size,
+	     flags,
 	     data_segment_index,
 	     error ) != 1 )
 	{
@@ -625,7 +889,7 @@ int libfwevt_xml_tag_append_element(
 	}
 	internal_xml_tag = (libfwevt_internal_xml_tag_t *) xml_tag;
 
-	if( libcdata_array_append_entry(
+	if( libfwevt_array_append_entry(
 	     internal_xml_tag->elements_array,
 	     &entry_index,
 	     (intptr_t *) element_xml_tag,
@@ -643,16 +907,19 @@ int libfwevt_xml_tag_append_element(
 	return( 1 );
 }
 
-/* Retrieves the size of the UTF-8 formatted name
+/* Retrieves the name data
+ * The name data contains an UTF-16 little-endian encoded string including
+ * the end-of-string character, it is not copied and remains owned by the XML tag
  * Returns 1 if successful or -1 on error
  */
-int libfwevt_xml_tag_get_utf8_name_size(
+int libfwevt_xml_tag_get_name_data(
      libfwevt_xml_tag_t *xml_tag,
-     size_t *utf8_string_size,
+     const uint8_t **name_data,
+     size_t *name_data_size,
      libcerror_error_t **error )
 {
 	libfwevt_internal_xml_tag_t *internal_xml_tag = NULL;
-	static char *function                         = "libfwevt_xml_tag_get_utf8_name_size";
+	static char *function                         = "libfwevt_xml_tag_get_name_data";
 
 	if( xml_tag == NULL )
 	{
@@ -667,36 +934,44 @@ int libfwevt_xml_tag_get_utf8_name_size(
 	}
 	internal_xml_tag = (libfwevt_internal_xml_tag_t *) xml_tag;
 
-	if( libuna_utf8_string_size_from_utf16_stream(
-	     internal_xml_tag->name,
-	     internal_xml_tag->name_size,
-	     LIBUNA_ENDIAN_LITTLE,
-	     utf8_string_size,
-	     error ) != 1 )
+	if( name_data == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve UTF-8 string size.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name data.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name data size.",
 		 function );
 
 		return( -1 );
 	}
+	*name_data      = internal_xml_tag->name;
+	*name_data_size = internal_xml_tag->name_size;
+
 	return( 1 );
 }
 
-/* Retrieves the UTF-8 formatted name
+/* Retrieves the size of the UTF-8 formatted name
  * Returns 1 if successful or -1 on error
  */
-int libfwevt_xml_tag_get_utf8_name(
+int libfwevt_xml_tag_get_utf8_name_size(
      libfwevt_xml_tag_t *xml_tag,
-     uint8_t *utf8_string,
-     size_t utf8_string_size,
+     size_t *utf8_string_size,
      libcerror_error_t **error )
 {
 	libfwevt_internal_xml_tag_t *internal_xml_tag = NULL;
-	static char *function                         = "libfwevt_xml_tag_get_utf8_name";
+	static char *function                         = "libfwevt_xml_tag_get_utf8_name_size";
 
 	if( xml_tag == NULL )
 	{
@@ -711,8 +986,52 @@ int libfwevt_xml_tag_get_utf8_name(
 	}
 	internal_xml_tag = (libfwevt_internal_xml_tag_t *) xml_tag;
 
-	if( libuna_utf8_string_copy_from_utf16_stream(
-	     utf8_string,
+	if( libuna_utf8_string_size_from_utf16_stream(
+	     internal_xml_tag->name,
+	     internal_xml_tag->name_size,
+	     LIBUNA_ENDIAN_LITTLE,
+	     utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-8 formatted name
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_tag_get_utf8_name(
+     libfwevt_xml_tag_t *xml_tag,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_tag_t *internal_xml_tag = NULL;
+	static char *function                         = "libfwevt_xml_tag_get_utf8_name";
+
+	if( xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_tag = (libfwevt_internal_xml_tag_t *) xml_tag;
+
+	if( libuna_utf8_string_copy_from_utf16_stream(
+	     utf8_string,
 	     utf8_string_size,
 	     internal_xml_tag->name,
 	     internal_xml_tag->name_size,
@@ -1031,6 +1350,123 @@ int libfwevt_xml_tag_get_utf16_value(
 	return( 1 );
 }
 
+/* Retrieves the number of attributes
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_internal_xml_tag_get_number_of_attributes(
+     libfwevt_internal_xml_tag_t *internal_xml_tag,
+     int *number_of_attributes,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_internal_xml_tag_get_number_of_attributes";
+
+	if( internal_xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_xml_tag->tree != NULL )
+	{
+		if( libfwevt_xml_tree_get_number_of_attributes(
+		     internal_xml_tag->tree,
+		     internal_xml_tag->node_index,
+		     number_of_attributes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of attributes from XML tree.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( libfwevt_array_get_number_of_entries(
+	          internal_xml_tag->attributes_array,
+	          number_of_attributes,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of attributes.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific attribute
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_internal_xml_tag_get_attribute_by_index(
+     libfwevt_internal_xml_tag_t *internal_xml_tag,
+     int attribute_index,
+     libfwevt_xml_tag_t **attribute_xml_tag,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_internal_xml_tag_get_attribute_by_index";
+
+	if( internal_xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_xml_tag->tree != NULL )
+	{
+		if( libfwevt_xml_tree_get_attribute_by_index(
+		     internal_xml_tag->tree,
+		     internal_xml_tag->node_index,
+		     attribute_index,
+		     attribute_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve attribute: %d from XML tree.",
+			 function,
+			 attribute_index );
+
+			return( -1 );
+		}
+	}
+	else if( libfwevt_array_get_entry_by_index(
+	          internal_xml_tag->attributes_array,
+	          attribute_index,
+	          (intptr_t **) attribute_xml_tag,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve attribute: %d.",
+		 function,
+		 attribute_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the number of attributes
  * Returns 1 if successful or -1 on error
  */
@@ -1055,8 +1491,8 @@ int libfwevt_xml_tag_get_number_of_attributes(
 	}
 	internal_xml_tag = (libfwevt_internal_xml_tag_t *) xml_tag;
 
-	if( libcdata_array_get_number_of_entries(
-	     internal_xml_tag->attributes_array,
+	if( libfwevt_internal_xml_tag_get_number_of_attributes(
+	     internal_xml_tag,
 	     number_of_attributes,
 	     error ) != 1 )
 	{
@@ -1097,10 +1533,10 @@ int libfwevt_xml_tag_get_attribute_by_index(
 	}
 	internal_xml_tag = (libfwevt_internal_xml_tag_t *) xml_tag;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_xml_tag->attributes_array,
+	if( libfwevt_internal_xml_tag_get_attribute_by_index(
+	     internal_xml_tag,
 	     attribute_index,
-	     (intptr_t **) attribute_xml_tag,
+	     attribute_xml_tag,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1195,8 +1631,8 @@ int libfwevt_xml_tag_get_attribute_by_utf8_name(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     internal_xml_tag->attributes_array,
+	if( libfwevt_internal_xml_tag_get_number_of_attributes(
+	     internal_xml_tag,
 	     &number_of_attributes,
 	     error ) != 1 )
 	{
@@ -1217,10 +1653,10 @@ int libfwevt_xml_tag_get_attribute_by_utf8_name(
 	     attribute_index < number_of_attributes;
 	     attribute_index++ )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     internal_xml_tag->attributes_array,
+		if( libfwevt_internal_xml_tag_get_attribute_by_index(
+		     internal_xml_tag,
 		     attribute_index,
-		     (intptr_t **) &internal_attribute_xml_tag,
+		     (libfwevt_xml_tag_t **) &internal_attribute_xml_tag,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1392,8 +1828,8 @@ int libfwevt_xml_tag_get_attribute_by_utf16_name(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     internal_xml_tag->attributes_array,
+	if( libfwevt_internal_xml_tag_get_number_of_attributes(
+	     internal_xml_tag,
 	     &number_of_attributes,
 	     error ) != 1 )
 	{
@@ -1414,10 +1850,10 @@ int libfwevt_xml_tag_get_attribute_by_utf16_name(
 	     attribute_index < number_of_attributes;
 	     attribute_index++ )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     internal_xml_tag->attributes_array,
+		if( libfwevt_internal_xml_tag_get_attribute_by_index(
+		     internal_xml_tag,
 		     attribute_index,
-		     (intptr_t **) &internal_attribute_xml_tag,
+		     (libfwevt_xml_tag_t **) &internal_attribute_xml_tag,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1510,6 +1946,123 @@ int libfwevt_xml_tag_get_attribute_by_utf16_name(
 	return( 0 );
 }
 
+/* Retrieves the number of elements
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_internal_xml_tag_get_number_of_elements(
+     libfwevt_internal_xml_tag_t *internal_xml_tag,
+     int *number_of_elements,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_internal_xml_tag_get_number_of_elements";
+
+	if( internal_xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_xml_tag->tree != NULL )
+	{
+		if( libfwevt_xml_tree_get_number_of_elements(
+		     internal_xml_tag->tree,
+		     internal_xml_tag->node_index,
+		     number_of_elements,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of elements from XML tree.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( libfwevt_array_get_number_of_entries(
+	          internal_xml_tag->elements_array,
+	          number_of_elements,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves a specific element
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_internal_xml_tag_get_element_by_index(
+     libfwevt_internal_xml_tag_t *internal_xml_tag,
+     int element_index,
+     libfwevt_xml_tag_t **element_xml_tag,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_internal_xml_tag_get_element_by_index";
+
+	if( internal_xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_xml_tag->tree != NULL )
+	{
+		if( libfwevt_xml_tree_get_element_by_index(
+		     internal_xml_tag->tree,
+		     internal_xml_tag->node_index,
+		     element_index,
+		     element_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve element: %d from XML tree.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+	}
+	else if( libfwevt_array_get_entry_by_index(
+	          internal_xml_tag->elements_array,
+	          element_index,
+	          (intptr_t **) element_xml_tag,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve element: %d.",
+		 function,
+		 element_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
 /* Retrieves the number of elements
  * Returns 1 if successful or -1 on error
  */
@@ -1534,8 +2087,8 @@ int libfwevt_xml_tag_get_number_of_elements(
 	}
 	internal_xml_tag = (libfwevt_internal_xml_tag_t *) xml_tag;
 
-	if( libcdata_array_get_number_of_entries(
-	     internal_xml_tag->elements_array,
+	if( libfwevt_internal_xml_tag_get_number_of_elements(
+	     internal_xml_tag,
 	     number_of_elements,
 	     error ) != 1 )
 	{
@@ -1576,10 +2129,10 @@ int libfwevt_xml_tag_get_element_by_index(
 	}
 	internal_xml_tag = (libfwevt_internal_xml_tag_t *) xml_tag;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_xml_tag->elements_array,
+	if( libfwevt_internal_xml_tag_get_element_by_index(
+	     internal_xml_tag,
 	     element_index,
-	     (intptr_t **) element_xml_tag,
+	     element_xml_tag,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1607,6 +2160,7 @@ int libfwevt_xml_tag_get_element_by_utf8_name(
 {
 	libfwevt_internal_xml_tag_t *internal_element_xml_tag = NULL;
 	libfwevt_internal_xml_tag_t *internal_xml_tag         = NULL;
+	uint8_t *mismatched_name                              = NULL;
 	uint8_t *value_entry_data                             = NULL;
 	static char *function                                 = "libfwevt_xml_tag_get_element_by_utf8_name";
 	libuna_unicode_character_t name_character             = 0;
@@ -1674,8 +2228,8 @@ int libfwevt_xml_tag_get_element_by_utf8_name(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     internal_xml_tag->elements_array,
+	if( libfwevt_internal_xml_tag_get_number_of_elements(
+	     internal_xml_tag,
 	     &number_of_elements,
 	     error ) != 1 )
 	{
@@ -1696,10 +2250,10 @@ int libfwevt_xml_tag_get_element_by_utf8_name(
 	     element_index < number_of_elements;
 	     element_index++ )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     internal_xml_tag->elements_array,
+		if( libfwevt_internal_xml_tag_get_element_by_index(
+		     internal_xml_tag,
 		     element_index,
-		     (intptr_t **) &internal_element_xml_tag,
+		     (libfwevt_xml_tag_t **) &internal_element_xml_tag,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1724,6 +2278,14 @@ int libfwevt_xml_tag_get_element_by_utf8_name(
 
 			return( -1 );
 		}
+		/* Elements with the same interned name as an element that did not match
+		 * can be skipped without comparing the name
+		 */
+		if( ( internal_element_xml_tag->name_is_interned != 0 )
+		 && ( internal_element_xml_tag->name == mismatched_name ) )
+		{
+			continue;
+		}
 /* TODO bounds check and clean up */
 		value_entry_data      = internal_element_xml_tag->name;
 		value_entry_data_size = internal_element_xml_tag->name_size;
@@ -1788,6 +2350,10 @@ int libfwevt_xml_tag_get_element_by_utf8_name(
 
 			return( 1 );
 		}
+		if( internal_element_xml_tag->name_is_interned != 0 )
+		{
+			mismatched_name = internal_element_xml_tag->name;
+		}
 	}
 	return( 0 );
 }
@@ -1804,6 +2370,7 @@ int libfwevt_xml_tag_get_element_by_utf16_name(
 {
 	libfwevt_internal_xml_tag_t *internal_element_xml_tag = NULL;
 	libfwevt_internal_xml_tag_t *internal_xml_tag         = NULL;
+	uint8_t *mismatched_name                              = NULL;
 	uint8_t *value_entry_data                             = NULL;
 	static char *function                                 = "libfwevt_xml_tag_get_element_by_utf16_name";
 	libuna_unicode_character_t name_character             = 0;
@@ -1871,8 +2438,8 @@ int libfwevt_xml_tag_get_element_by_utf16_name(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     internal_xml_tag->elements_array,
+	if( libfwevt_internal_xml_tag_get_number_of_elements(
+	     internal_xml_tag,
 	     &number_of_elements,
 	     error ) != 1 )
 	{
@@ -1893,10 +2460,10 @@ int libfwevt_xml_tag_get_element_by_utf16_name(
 	     element_index < number_of_elements;
 	     element_index++ )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     internal_xml_tag->elements_array,
+		if( libfwevt_internal_xml_tag_get_element_by_index(
+		     internal_xml_tag,
 		     element_index,
-		     (intptr_t **) &internal_element_xml_tag,
+		     (libfwevt_xml_tag_t **) &internal_element_xml_tag,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1921,7 +2488,15 @@ int libfwevt_xml_tag_get_element_by_utf16_name(
 
 			return( -1 );
 		}
-/* TODO bounds check and clean up */
+		/* Elements with the same interned name as an element that did not match
+		 * can be skipped without comparing the name
+		 */
+		if( ( internal_element_xml_tag->name_is_interned != 0 )
+		 && ( internal_element_xml_tag->name == mismatched_name ) )
+		{
+			continue;
+		}
+/* TODO bounds check and clean up */
 		value_entry_data      = internal_element_xml_tag->name;
 		value_entry_data_size = internal_element_xml_tag->name_size;
 
@@ -1985,6 +2560,10 @@ int libfwevt_xml_tag_get_element_by_utf16_name(
 
 			return( 1 );
 		}
+		if( internal_element_xml_tag->name_is_interned != 0 )
+		{
+			mismatched_name = internal_element_xml_tag->name;
+		}
 	}
 	return( 0 );
 }
@@ -2121,8 +2700,8 @@ int libfwevt_xml_tag_get_utf8_xml_string_size(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     internal_xml_tag->attributes_array,
+	if( libfwevt_internal_xml_tag_get_number_of_attributes(
+	     internal_xml_tag,
 	     &number_of_attributes,
 	     error ) != 1 )
 	{
@@ -2143,8 +2722,8 @@ int libfwevt_xml_tag_get_utf8_xml_string_size(
 
 	if( internal_xml_tag->type == LIBFWEVT_XML_TAG_TYPE_NODE )
 	{
-		if( libcdata_array_get_number_of_entries(
-		     internal_xml_tag->elements_array,
+		if( libfwevt_internal_xml_tag_get_number_of_elements(
+		     internal_xml_tag,
 		     &number_of_elements,
 		     error ) != 1 )
 		{
@@ -2184,10 +2763,10 @@ int libfwevt_xml_tag_get_utf8_xml_string_size(
 			     attribute_index < number_of_attributes;
 			     attribute_index++ )
 			{
-				if( libcdata_array_get_entry_by_index(
-				     internal_xml_tag->attributes_array,
+				if( libfwevt_internal_xml_tag_get_attribute_by_index(
+				     internal_xml_tag,
 				     attribute_index,
-				     (intptr_t **) &internal_attribute_xml_tag,
+				     (libfwevt_xml_tag_t **) &internal_attribute_xml_tag,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
@@ -2304,10 +2883,10 @@ int libfwevt_xml_tag_get_utf8_xml_string_size(
 			     element_index < number_of_elements;
 			     element_index++ )
 			{
-				if( libcdata_array_get_entry_by_index(
-				     internal_xml_tag->elements_array,
+				if( libfwevt_internal_xml_tag_get_element_by_index(
+				     internal_xml_tag,
 				     element_index,
-				     (intptr_t **) &element_xml_tag,
+				     &element_xml_tag,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
@@ -2538,8 +3117,8 @@ int libfwevt_xml_tag_get_utf8_xml_string_with_index(
 
 	if( internal_xml_tag->type == LIBFWEVT_XML_TAG_TYPE_NODE )
 	{
-		if( libcdata_array_get_number_of_entries(
-		     internal_xml_tag->attributes_array,
+		if( libfwevt_internal_xml_tag_get_number_of_attributes(
+		     internal_xml_tag,
 		     &number_of_attributes,
 		     error ) != 1 )
 		{
@@ -2552,8 +3131,8 @@ int libfwevt_xml_tag_get_utf8_xml_string_with_index(
 
 			return( -1 );
 		}
-		if( libcdata_array_get_number_of_entries(
-		     internal_xml_tag->elements_array,
+		if( libfwevt_internal_xml_tag_get_number_of_elements(
+		     internal_xml_tag,
 		     &number_of_elements,
 		     error ) != 1 )
 		{
@@ -2592,10 +3171,10 @@ int libfwevt_xml_tag_get_utf8_xml_string_with_index(
 			     attribute_index < number_of_attributes;
 			     attribute_index++ )
 			{
-				if( libcdata_array_get_entry_by_index(
-				     internal_xml_tag->attributes_array,
+				if( libfwevt_internal_xml_tag_get_attribute_by_index(
+				     internal_xml_tag,
 				     attribute_index,
-				     (intptr_t **) &internal_attribute_xml_tag,
+				     (libfwevt_xml_tag_t **) &internal_attribute_xml_tag,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
@@ -2812,279 +3391,2775 @@ int libfwevt_xml_tag_get_utf8_xml_string_with_index(
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: UTF-8 string size too small.",
-				 function );
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: UTF-8 string size too small.",
+				 function );
+
+				return( -1 );
+			}
+			utf8_string[ string_index++ ] = (uint8_t) '>';
+			utf8_string[ string_index++ ] = (uint8_t) '\n';
+
+			for( element_index = 0;
+			     element_index < number_of_elements;
+			     element_index++ )
+			{
+				if( libfwevt_internal_xml_tag_get_element_by_index(
+				     internal_xml_tag,
+				     element_index,
+				     &element_xml_tag,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve sub element: %d.",
+					 function,
+					 element_index );
+
+					return( -1 );
+				}
+				if( libfwevt_xml_tag_get_utf8_xml_string_with_index(
+				     element_xml_tag,
+				     xml_tag_level + 1,
+				     utf8_string,
+				     utf8_string_size,
+				     &string_index,
+				     ascii_codepage,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy sub element: %d to UTF-8 string.",
+					 function,
+					 element_index );
+
+					return( -1 );
+				}
+				string_index--;
+			}
+			if( ( string_index + ( xml_tag_level * 2 ) ) > utf8_string_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: UTF-8 string size too small.",
+				 function );
+
+				return( -1 );
+			}
+			for( indentation_iterator = 0;
+			     indentation_iterator < xml_tag_level;
+			     indentation_iterator++ )
+			{
+				utf8_string[ string_index++ ] = (uint8_t) ' ';
+				utf8_string[ string_index++ ] = (uint8_t) ' ';
+			}
+			if( ( string_index + 2 ) > utf8_string_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: UTF-8 string size too small.",
+				 function );
+
+				return( -1 );
+			}
+			utf8_string[ string_index++ ] = (uint8_t) '<';
+			utf8_string[ string_index++ ] = (uint8_t) '/';
+
+			if( libuna_utf8_string_with_index_copy_from_utf16_stream(
+			     utf8_string,
+			     utf8_string_size,
+			     &string_index,
+			     internal_xml_tag->name,
+			     internal_xml_tag->name_size,
+			     LIBUNA_ENDIAN_LITTLE,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy name to UTF-8 string.",
+				 function );
+
+				return( -1 );
+			}
+			string_index--;
+		}
+		else
+		{
+			if( ( string_index + 1 ) > utf8_string_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+				 "%s: UTF-8 string size too small.",
+				 function );
+
+				return( -1 );
+			}
+			utf8_string[ string_index++ ] = (uint8_t) '/';
+		}
+		if( ( string_index + 3 ) > utf8_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string size too small.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( internal_xml_tag->type == LIBFWEVT_XML_TAG_TYPE_CDATA )
+	{
+		if( ( string_index + 8 ) > utf8_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string size too small.",
+			 function );
+
+			return( -1 );
+		}
+		utf8_string[ string_index++ ] = (uint8_t) '!';
+		utf8_string[ string_index++ ] = (uint8_t) '[';
+		utf8_string[ string_index++ ] = (uint8_t) 'C';
+		utf8_string[ string_index++ ] = (uint8_t) 'D';
+		utf8_string[ string_index++ ] = (uint8_t) 'A';
+		utf8_string[ string_index++ ] = (uint8_t) 'T';
+		utf8_string[ string_index++ ] = (uint8_t) 'A';
+		utf8_string[ string_index++ ] = (uint8_t) '[';
+
+		if( libfwevt_internal_xml_value_get_data_as_utf8_string_with_index(
+		     (libfwevt_internal_xml_value_t *) internal_xml_tag->value,
+		     utf8_string,
+		     utf8_string_size,
+		     &string_index,
+		     0,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy value to UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		string_index--;
+
+		if( ( string_index + 2 ) > utf8_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string size too small.",
+			 function );
+
+			return( -1 );
+		}
+		utf8_string[ string_index++ ] = (uint8_t) ']';
+		utf8_string[ string_index++ ] = (uint8_t) ']';
+	}
+	else if( internal_xml_tag->type == LIBFWEVT_XML_TAG_TYPE_PI )
+	{
+		if( ( string_index + 1 ) > utf8_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string size too small.",
+			 function );
+
+			return( -1 );
+		}
+		utf8_string[ string_index++ ] = (uint8_t) '?';
+
+		if( libuna_utf8_string_with_index_copy_from_utf16_stream(
+		     utf8_string,
+		     utf8_string_size,
+		     &string_index,
+		     internal_xml_tag->name,
+		     internal_xml_tag->name_size,
+		     LIBUNA_ENDIAN_LITTLE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy name to UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		string_index--;
+
+		if( ( string_index + 1 ) > utf8_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string size too small.",
+			 function );
+
+			return( -1 );
+		}
+		utf8_string[ string_index++ ] = (uint8_t) ' ';
+
+		if( libfwevt_internal_xml_value_get_data_as_utf8_string_with_index(
+		     (libfwevt_internal_xml_value_t *) internal_xml_tag->value,
+		     utf8_string,
+		     utf8_string_size,
+		     &string_index,
+		     0,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy value to UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		string_index--;
+
+		if( ( string_index + 1 ) > utf8_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string size too small.",
+			 function );
+
+			return( -1 );
+		}
+		utf8_string[ string_index++ ] = (uint8_t) '?';
+	}
+	utf8_string[ string_index++ ] = (uint8_t) '>';
+	utf8_string[ string_index++ ] = (uint8_t) '\n';
+	utf8_string[ string_index++ ] = 0;
+
+	*utf8_string_index = string_index;
+
+	return( 1 );
+}
+
+/* Appends the UTF-8 formatted string of a XML value to an output buffer
+ * The end-of-string character is not appended
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_tag_append_utf8_value_to_output_buffer(
+     libfwevt_output_buffer_t *output_buffer,
+     libfwevt_xml_value_t *xml_value,
+     uint8_t escape_characters,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_xml_tag_append_utf8_value_to_output_buffer";
+	size_t data_size      = 0;
+	size_t value_size     = 0;
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_internal_xml_value_get_data_as_utf8_string_maximum_size(
+	     (libfwevt_internal_xml_value_t *) xml_value,
+	     &value_size,
+	     escape_characters,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum UTF-8 string size of value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_output_buffer_reserve(
+	     output_buffer,
+	     value_size + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve space in output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	data_size = output_buffer->data_size;
+
+	if( libfwevt_internal_xml_value_get_data_as_utf8_string_with_index(
+	     (libfwevt_internal_xml_value_t *) xml_value,
+	     output_buffer->data,
+	     output_buffer->allocated_data_size,
+	     &data_size,
+	     escape_characters,
+	     ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy value to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	/* Remove the end-of-string character
+	 */
+	if( data_size > output_buffer->data_size )
+	{
+		output_buffer->data_size = data_size - 1;
+	}
+	return( 1 );
+}
+
+/* Renders the UTF-8 formatted string of the XML tag to an output buffer
+ * The output is the same as that of libfwevt_xml_tag_get_utf8_xml_string_with_index
+ * except that the end-of-string character is not appended. Every value is formatted
+ * only once, the output buffer is resized based on the maximum size of the value
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_tag_render_utf8_xml_string(
+     libfwevt_xml_tag_t *xml_tag,
+     int xml_tag_level,
+     libfwevt_output_buffer_t *output_buffer,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_tag_t *internal_attribute_xml_tag = NULL;
+	libfwevt_internal_xml_tag_t *internal_xml_tag           = NULL;
+	libfwevt_xml_tag_t *element_xml_tag                     = NULL;
+	static char *function                                   = "libfwevt_xml_tag_render_utf8_xml_string";
+	size_t value_string_index                               = 0;
+	size_t value_string_size                                = 0;
+	int attribute_index                                     = 0;
+	int element_index                                       = 0;
+	int number_of_attributes                                = 0;
+	int number_of_elements                                  = 0;
+
+	if( xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_tag = (libfwevt_internal_xml_tag_t *) xml_tag;
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_output_buffer_append_indentation(
+	     output_buffer,
+	     xml_tag_level,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append indentation to output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_output_buffer_append_data(
+	     output_buffer,
+	     (uint8_t *) "<",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append start of tag to output buffer.",
+		 function );
+
+		return( -1 );
+	}
+
+	if( internal_xml_tag->type == LIBFWEVT_XML_TAG_TYPE_NODE )
+	{
+		if( libfwevt_internal_xml_tag_get_number_of_attributes(
+		     internal_xml_tag,
+		     &number_of_attributes,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of attributes.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwevt_internal_xml_tag_get_number_of_elements(
+		     internal_xml_tag,
+		     &number_of_elements,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of elements.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwevt_output_buffer_append_utf16_stream(
+		     output_buffer,
+		     internal_xml_tag->name,
+		     internal_xml_tag->name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append name to output buffer.",
+			 function );
+
+			return( -1 );
+		}
+		for( attribute_index = 0;
+		     attribute_index < number_of_attributes;
+		     attribute_index++ )
+		{
+			if( libfwevt_internal_xml_tag_get_attribute_by_index(
+			     internal_xml_tag,
+			     attribute_index,
+			     (libfwevt_xml_tag_t **) &internal_attribute_xml_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve attribute: %d.",
+				 function,
+				 attribute_index );
+
+				return( -1 );
+			}
+			if( internal_attribute_xml_tag == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing attribute: %d.",
+				 function,
+				 attribute_index );
+
+				return( -1 );
+			}
+			if( libfwevt_output_buffer_append_data(
+			     output_buffer,
+			     (uint8_t *) " ",
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append attribute: %d to output buffer.",
+				 function,
+				 attribute_index );
+
+				return( -1 );
+			}
+			if( libfwevt_output_buffer_append_utf16_stream(
+			     output_buffer,
+			     internal_attribute_xml_tag->name,
+			     internal_attribute_xml_tag->name_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append attribute: %d name to output buffer.",
+				 function,
+				 attribute_index );
+
+				return( -1 );
+			}
+			if( libfwevt_output_buffer_append_data(
+			     output_buffer,
+			     (uint8_t *) "=\"",
+			     2,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append attribute: %d to output buffer.",
+				 function,
+				 attribute_index );
+
+				return( -1 );
+			}
+			if( libfwevt_xml_tag_append_utf8_value_to_output_buffer(
+			     output_buffer,
+			     internal_attribute_xml_tag->value,
+			     1,
+			     ascii_codepage,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append attribute: %d value to output buffer.",
+				 function,
+				 attribute_index );
+
+				return( -1 );
+			}
+			if( libfwevt_output_buffer_append_data(
+			     output_buffer,
+			     (uint8_t *) "\"",
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append attribute: %d to output buffer.",
+				 function,
+				 attribute_index );
+
+				return( -1 );
+			}
+		}
+		if( internal_xml_tag->value != NULL )
+		{
+			if( libfwevt_internal_xml_value_get_data_as_utf8_string_maximum_size(
+			     (libfwevt_internal_xml_value_t *) internal_xml_tag->value,
+			     &value_string_size,
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve maximum UTF-8 string size of element value.",
+				 function );
+
+				return( -1 );
+			}
+			/* The size of:
+			 *   1 x '>' or '/' character
+			 *   element value
+			 */
+			if( libfwevt_output_buffer_reserve(
+			     output_buffer,
+			     value_string_size + 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to reserve space in output buffer.",
+				 function );
+
+				return( -1 );
+			}
+			/* The element value is formatted directly after the '>' character,
+			 * if the formatted value turns out to be empty the '>' character
+			 * is replaced by '/' so that the value is not formatted twice
+			 */
+			output_buffer->data[ output_buffer->data_size ] = (uint8_t) '>';
+
+			value_string_index = 0;
+
+			if( libfwevt_internal_xml_value_get_data_as_utf8_string_with_index(
+			     (libfwevt_internal_xml_value_t *) internal_xml_tag->value,
+			     &( output_buffer->data[ output_buffer->data_size + 1 ] ),
+			     output_buffer->allocated_data_size - ( output_buffer->data_size + 1 ),
+			     &value_string_index,
+			     1,
+			     ascii_codepage,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve UTF-8 string of element value.",
+				 function );
+
+				return( -1 );
+			}
+			if( value_string_index > 0 )
+			{
+				output_buffer->data_size += value_string_index;
+
+				if( libfwevt_output_buffer_append_data(
+				     output_buffer,
+				     (uint8_t *) "</",
+				     2,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append end tag to output buffer.",
+					 function );
+
+					return( -1 );
+				}
+				if( libfwevt_output_buffer_append_utf16_stream(
+				     output_buffer,
+				     internal_xml_tag->name,
+				     internal_xml_tag->name_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append name to output buffer.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			else
+			{
+				output_buffer->data[ output_buffer->data_size++ ] = (uint8_t) '/';
+			}
+		}
+		else if( number_of_elements > 0 )
+		{
+			if( libfwevt_output_buffer_append_data(
+			     output_buffer,
+			     (uint8_t *) ">\n",
+			     2,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append start tag to output buffer.",
+				 function );
+
+				return( -1 );
+			}
+			for( element_index = 0;
+			     element_index < number_of_elements;
+			     element_index++ )
+			{
+				if( libfwevt_internal_xml_tag_get_element_by_index(
+				     internal_xml_tag,
+				     element_index,
+				     &element_xml_tag,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve sub element: %d.",
+					 function,
+					 element_index );
+
+					return( -1 );
+				}
+				if( libfwevt_xml_tag_render_utf8_xml_string(
+				     element_xml_tag,
+				     xml_tag_level + 1,
+				     output_buffer,
+				     ascii_codepage,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to render sub element: %d.",
+					 function,
+					 element_index );
+
+					return( -1 );
+				}
+			}
+			if( libfwevt_output_buffer_append_indentation(
+			     output_buffer,
+			     xml_tag_level,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append indentation to output buffer.",
+				 function );
+
+				return( -1 );
+			}
+			if( libfwevt_output_buffer_append_data(
+			     output_buffer,
+			     (uint8_t *) "</",
+			     2,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append end tag to output buffer.",
+				 function );
+
+				return( -1 );
+			}
+			if( libfwevt_output_buffer_append_utf16_stream(
+			     output_buffer,
+			     internal_xml_tag->name,
+			     internal_xml_tag->name_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append name to output buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			if( libfwevt_output_buffer_append_data(
+			     output_buffer,
+			     (uint8_t *) "/",
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append empty tag to output buffer.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	else if( internal_xml_tag->type == LIBFWEVT_XML_TAG_TYPE_CDATA )
+	{
+		if( libfwevt_output_buffer_append_data(
+		     output_buffer,
+		     (uint8_t *) "![CDATA[",
+		     8,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append CDATA start to output buffer.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwevt_xml_tag_append_utf8_value_to_output_buffer(
+		     output_buffer,
+		     internal_xml_tag->value,
+		     0,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append value to output buffer.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwevt_output_buffer_append_data(
+		     output_buffer,
+		     (uint8_t *) "]]",
+		     2,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append CDATA end to output buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	else if( internal_xml_tag->type == LIBFWEVT_XML_TAG_TYPE_PI )
+	{
+		if( libfwevt_output_buffer_append_data(
+		     output_buffer,
+		     (uint8_t *) "?",
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append processing instruction to output buffer.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwevt_output_buffer_append_utf16_stream(
+		     output_buffer,
+		     internal_xml_tag->name,
+		     internal_xml_tag->name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append name to output buffer.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwevt_output_buffer_append_data(
+		     output_buffer,
+		     (uint8_t *) " ",
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append processing instruction to output buffer.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwevt_xml_tag_append_utf8_value_to_output_buffer(
+		     output_buffer,
+		     internal_xml_tag->value,
+		     0,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append value to output buffer.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwevt_output_buffer_append_data(
+		     output_buffer,
+		     (uint8_t *) "?",
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append processing instruction to output buffer.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libfwevt_output_buffer_append_data(
+	     output_buffer,
+	     (uint8_t *) ">\n",
+	     2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append end of tag to output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Compares the name of the XML tag with an ASCII string
+ * Returns 1 if equal, 0 if not or -1 on error
+ */
+int libfwevt_internal_xml_tag_compare_name_with_ascii_string(
+     libfwevt_internal_xml_tag_t *internal_xml_tag,
+     const char *string,
+     size_t string_length,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_internal_xml_tag_compare_name_with_ascii_string";
+	size_t name_index     = 0;
+	size_t name_size      = 0;
+	size_t string_index   = 0;
+
+	if( internal_xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid string.",
+		 function );
+
+		return( -1 );
+	}
+	if( string_length > (size_t) ( SSIZE_MAX / 2 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_xml_tag->name == NULL )
+	{
+		return( 0 );
+	}
+	name_size = internal_xml_tag->name_size;
+
+	if( ( name_size >= 2 )
+	 && ( internal_xml_tag->name[ name_size - 2 ] == 0 )
+	 && ( internal_xml_tag->name[ name_size - 1 ] == 0 ) )
+	{
+		name_size -= 2;
+	}
+	if( name_size != ( string_length * 2 ) )
+	{
+		return( 0 );
+	}
+	for( string_index = 0;
+	     string_index < string_length;
+	     string_index++ )
+	{
+		if( ( internal_xml_tag->name[ name_index ] != (uint8_t) string[ string_index ] )
+		 || ( internal_xml_tag->name[ name_index + 1 ] != 0 ) )
+		{
+			return( 0 );
+		}
+		name_index += 2;
+	}
+	return( 1 );
+}
+
+/* Compares the names of two XML tags
+ * Returns 1 if equal, 0 if not or -1 on error
+ */
+int libfwevt_internal_xml_tag_compare_name(
+     libfwevt_internal_xml_tag_t *internal_xml_tag,
+     libfwevt_internal_xml_tag_t *other_internal_xml_tag,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_internal_xml_tag_compare_name";
+
+	if( internal_xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( other_internal_xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid other XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_xml_tag->type != other_internal_xml_tag->type )
+	 || ( internal_xml_tag->name_size != other_internal_xml_tag->name_size ) )
+	{
+		return( 0 );
+	}
+	if( ( internal_xml_tag->name == other_internal_xml_tag->name )
+	 || ( internal_xml_tag->name_size == 0 ) )
+	{
+		return( 1 );
+	}
+	if( ( internal_xml_tag->name == NULL )
+	 || ( other_internal_xml_tag->name == NULL ) )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     internal_xml_tag->name,
+	     other_internal_xml_tag->name,
+	     internal_xml_tag->name_size ) != 0 )
+	{
+		return( 0 );
+	}
+	return( 1 );
+}
+
+/* Determines if the XML tag has an element value that is not empty
+ * A value that consists of a single linefeed is considered empty
+ * Returns 1 if the XML tag has an element value, 0 if not or -1 on error
+ */
+int libfwevt_internal_xml_tag_has_element_value(
+     libfwevt_internal_xml_tag_t *internal_xml_tag,
+     libcerror_error_t **error )
+{
+	libfwevt_data_segment_t *data_segment             = NULL;
+	libfwevt_internal_xml_value_t *internal_xml_value = NULL;
+	static char *function                             = "libfwevt_internal_xml_tag_has_element_value";
+	int number_of_data_segments                       = 0;
+
+	if( internal_xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_value = (libfwevt_internal_xml_value_t *) internal_xml_tag->value;
+
+	if( internal_xml_value == NULL )
+	{
+		return( 0 );
+	}
+	if( libfwevt_array_get_number_of_entries(
+	     internal_xml_value->data_segments,
+	     &number_of_data_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data segments.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_data_segments == 0 )
+	{
+		return( 0 );
+	}
+	if( number_of_data_segments > 1 )
+	{
+		return( 1 );
+	}
+	if( libfwevt_array_get_entry_by_index(
+	     internal_xml_value->data_segments,
+	     0,
+	     (intptr_t **) &data_segment,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data segment: 0.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing data segment: 0.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( internal_xml_value->value_type & 0x7f ) != LIBFWEVT_VALUE_TYPE_STRING_UTF16 )
+	{
+		return( 1 );
+	}
+	if( ( data_segment->data_size < 2 )
+	 || ( ( data_segment->data[ 0 ] == 0 )
+	  &&  ( data_segment->data[ 1 ] == 0 ) ) )
+	{
+		return( 0 );
+	}
+	/* The value data consists of a single linefeed consider it empty
+	 */
+	if( ( data_segment->data[ 0 ] == (uint8_t) '\n' )
+	 && ( data_segment->data[ 1 ] == 0 ) )
+	{
+		if( ( data_segment->data_size < 4 )
+		 || ( ( data_segment->data[ 2 ] == 0 )
+		  &&  ( data_segment->data[ 3 ] == 0 ) ) )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves the data name of an EventData Data element
+ * The data name is the UTF-16 string value of the Name attribute of the element
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwevt_internal_xml_tag_get_event_data_name(
+     libfwevt_internal_xml_tag_t *internal_xml_tag,
+     const uint8_t **name_data,
+     size_t *name_data_size,
+     libcerror_error_t **error )
+{
+	libfwevt_data_segment_t *data_segment             = NULL;
+	libfwevt_internal_xml_tag_t *internal_name_xml_tag = NULL;
+	libfwevt_internal_xml_value_t *internal_xml_value = NULL;
+	static char *function                             = "libfwevt_internal_xml_tag_get_event_data_name";
+	int number_of_data_segments                       = 0;
+	int result                                        = 0;
+
+	if( internal_xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name data.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_xml_tag->type != LIBFWEVT_XML_TAG_TYPE_NODE )
+	{
+		return( 0 );
+	}
+	result = libfwevt_internal_xml_tag_compare_name_with_ascii_string(
+	          internal_xml_tag,
+	          "Data",
+	          4,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compare name.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	result = libfwevt_xml_tag_get_attribute_by_utf8_name(
+	          (libfwevt_xml_tag_t *) internal_xml_tag,
+	          (uint8_t *) "Name",
+	          4,
+	          (libfwevt_xml_tag_t **) &internal_name_xml_tag,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve Name attribute.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	internal_xml_value = (libfwevt_internal_xml_value_t *) internal_name_xml_tag->value;
+
+	if( ( internal_xml_value == NULL )
+	 || ( internal_xml_value->value_type != LIBFWEVT_VALUE_TYPE_STRING_UTF16 ) )
+	{
+		return( 0 );
+	}
+	if( libfwevt_array_get_number_of_entries(
+	     internal_xml_value->data_segments,
+	     &number_of_data_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data segments.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_data_segments != 1 )
+	{
+		return( 0 );
+	}
+	if( libfwevt_array_get_entry_by_index(
+	     internal_xml_value->data_segments,
+	     0,
+	     (intptr_t **) &data_segment,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data segment: 0.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing data segment: 0.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_segment->data_size < 2 )
+	 || ( ( data_segment->data[ 0 ] == 0 )
+	  &&  ( data_segment->data[ 1 ] == 0 ) ) )
+	{
+		return( 0 );
+	}
+	*name_data      = data_segment->data;
+	*name_data_size = data_segment->data_size;
+
+	return( 1 );
+}
+
+/* Appends an UTF-16 little-endian stream as an UTF-8 JSON string to an output buffer
+ * The JSON string is enclosed in quotes, the end-of-string character is not appended
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_tag_append_utf8_json_string_to_output_buffer(
+     libfwevt_output_buffer_t *output_buffer,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_xml_tag_append_utf8_json_string_to_output_buffer";
+	size_t data_size      = 0;
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 4 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* An UTF-16 character is encoded as at most 6 UTF-8 bytes when escaped as \u00##
+	 * The size includes the quotes and the end-of-string character
+	 */
+	if( libfwevt_output_buffer_reserve_maximum(
+	     output_buffer,
+	     2,
+	     ( ( ( utf16_stream_size + 1 ) / 2 ) * 6 ) + 3,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve space in output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	output_buffer->data[ output_buffer->data_size++ ] = (uint8_t) '"';
+
+	data_size = output_buffer->data_size;
+
+	if( utf16_stream_size > 0 )
+	{
+		if( libfwevt_utf8_json_string_with_index_copy_from_utf16_stream(
+		     output_buffer->data,
+		     output_buffer->allocated_data_size,
+		     &data_size,
+		     utf16_stream,
+		     utf16_stream_size,
+		     LIBUNA_ENDIAN_LITTLE,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy UTF-16 stream to UTF-8 JSON string.",
+			 function );
+
+			return( -1 );
+		}
+		/* Remove the end-of-string character
+		 */
+		data_size--;
+	}
+	output_buffer->data[ data_size++ ] = (uint8_t) '"';
+
+	output_buffer->data_size = data_size;
+
+	return( 1 );
+}
+
+/* Appends the UTF-8 JSON formatted value of a XML value to an output buffer
+ * Integer, floating-point and boolean values are formatted as JSON numbers and literals,
+ * other values as JSON strings. A missing value is formatted as null
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_tag_append_utf8_json_value_to_output_buffer(
+     libfwevt_output_buffer_t *output_buffer,
+     libfwevt_xml_value_t *xml_value,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	uint8_t float_string[ 16 ];
+
+	libfwevt_data_segment_t *data_segment             = NULL;
+	libfwevt_internal_xml_value_t *internal_xml_value = NULL;
+	static char *function                             = "libfwevt_xml_tag_append_utf8_json_value_to_output_buffer";
+	size_t data_size                                  = 0;
+	size_t float_string_index                         = 0;
+	size_t value_index                                = 0;
+	size_t value_size                                 = 0;
+	uint8_t value_type                                = 0;
+	int data_segment_index                            = 0;
+	int number_of_data_segments                       = 0;
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_value = (libfwevt_internal_xml_value_t *) xml_value;
+
+	if( internal_xml_value != NULL )
+	{
+		if( libfwevt_array_get_number_of_entries(
+		     internal_xml_value->data_segments,
+		     &number_of_data_segments,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of data segments.",
+			 function );
+
+			return( -1 );
+		}
+		value_type = internal_xml_value->value_type & 0x7f;
+	}
+	if( number_of_data_segments == 0 )
+	{
+		if( libfwevt_output_buffer_append_data(
+		     output_buffer,
+		     (uint8_t *) "null",
+		     4,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append null to output buffer.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( ( value_type == LIBFWEVT_VALUE_TYPE_STRING_UTF16 )
+	 || ( value_type == LIBFWEVT_VALUE_TYPE_STRING_BYTE_STREAM ) )
+	{
+		if( libfwevt_output_buffer_append_data(
+		     output_buffer,
+		     (uint8_t *) "\"",
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append quote to output buffer.",
+			 function );
+
+			return( -1 );
+		}
+		for( data_segment_index = 0;
+		     data_segment_index < number_of_data_segments;
+		     data_segment_index++ )
+		{
+			if( libfwevt_array_get_entry_by_index(
+			     internal_xml_value->data_segments,
+			     data_segment_index,
+			     (intptr_t **) &data_segment,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve data segment: %d.",
+				 function,
+				 data_segment_index );
+
+				return( -1 );
+			}
+			if( data_segment == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing data segment: %d.",
+				 function,
+				 data_segment_index );
+
+				return( -1 );
+			}
+			if( data_segment->data_size == 0 )
+			{
+				continue;
+			}
+			if( data_segment->data_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 8 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid data segment: %d - data size value exceeds maximum.",
+				 function,
+				 data_segment_index );
+
+				return( -1 );
+			}
+			/* A character is encoded as at most 6 UTF-8 bytes when escaped as \u00##
+			 * The size includes the end-of-string character
+			 */
+			if( value_type == LIBFWEVT_VALUE_TYPE_STRING_UTF16 )
+			{
+				value_size = ( ( data_segment->data_size + 1 ) / 2 ) * 6;
+			}
+			else
+			{
+				value_size = data_segment->data_size * 6;
+			}
+			if( libfwevt_output_buffer_reserve_maximum(
+			     output_buffer,
+			     1,
+			     value_size + 1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+				 "%s: unable to reserve space in output buffer.",
+				 function );
+
+				return( -1 );
+			}
+			data_size = output_buffer->data_size;
+
+			if( value_type == LIBFWEVT_VALUE_TYPE_STRING_UTF16 )
+			{
+				if( libfwevt_utf8_json_string_with_index_copy_from_utf16_stream(
+				     output_buffer->data,
+				     output_buffer->allocated_data_size,
+				     &data_size,
+				     data_segment->data,
+				     data_segment->data_size,
+				     LIBUNA_ENDIAN_LITTLE,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy data segment: %d to UTF-8 JSON string.",
+					 function,
+					 data_segment_index );
+
+					return( -1 );
+				}
+			}
+			else
+			{
+				if( libfwevt_utf8_json_string_with_index_copy_from_byte_stream(
+				     output_buffer->data,
+				     output_buffer->allocated_data_size,
+				     &data_size,
+				     data_segment->data,
+				     data_segment->data_size,
+				     ascii_codepage,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+					 "%s: unable to copy data segment: %d to UTF-8 JSON string.",
+					 function,
+					 data_segment_index );
+
+					return( -1 );
+				}
+			}
+			/* Remove the end-of-string character
+			 */
+			output_buffer->data_size = data_size - 1;
+		}
+		if( libfwevt_output_buffer_append_data(
+		     output_buffer,
+		     (uint8_t *) "\"",
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append quote to output buffer.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( ( number_of_data_segments == 1 )
+	 && ( ( value_type == LIBFWEVT_VALUE_TYPE_FLOATING_POINT_32BIT )
+	  ||  ( value_type == LIBFWEVT_VALUE_TYPE_FLOATING_POINT_64BIT ) ) )
+	{
+		if( libfwevt_internal_xml_value_get_data_segment_with_cached_value(
+		     internal_xml_value,
+		     0,
+		     &data_segment,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data segment: 0.",
+			 function );
+
+			return( -1 );
+		}
+		/* The floating-point value is formatted as "[-]0.000000e[+-]000" or as
+		 * Inf, Nan or Ind. The latter are not valid JSON numbers and are quoted
+		 */
+		float_string_index = 1;
+
+		if( libfwevt_internal_xml_value_get_data_segment_as_utf8_string(
+		     internal_xml_value,
+		     0,
+		     data_segment,
+		     float_string,
+		     16,
+		     &float_string_index,
+		     0,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy floating-point value to UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		/* Remove the end-of-string character
+		 */
+		float_string_index--;
+
+		if( ( float_string[ 1 ] == (uint8_t) '-' )
+		 || ( ( float_string[ 1 ] >= (uint8_t) '0' )
+		  &&  ( float_string[ 1 ] <= (uint8_t) '9' ) ) )
+		{
+			data_size = 1;
+		}
+		else
+		{
+			float_string[ 0 ]                    = (uint8_t) '"';
+			float_string[ float_string_index++ ] = (uint8_t) '"';
+
+			data_size = 0;
+		}
+		if( libfwevt_output_buffer_append_data(
+		     output_buffer,
+		     &( float_string[ data_size ] ),
+		     float_string_index - data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append floating-point value to output buffer.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libfwevt_internal_xml_value_get_data_as_utf8_string_maximum_size(
+	     internal_xml_value,
+	     &value_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve maximum UTF-8 string size of value.",
+		 function );
+
+		return( -1 );
+	}
+	/* The size of:
+	 *   2 x '"' characters
+	 *   value
+	 */
+	if( libfwevt_output_buffer_reserve_maximum(
+	     output_buffer,
+	     2,
+	     value_size + 2,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to reserve space in output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	data_size = output_buffer->data_size;
+
+	switch( value_type )
+	{
+		case LIBFWEVT_VALUE_TYPE_INTEGER_8BIT:
+		case LIBFWEVT_VALUE_TYPE_INTEGER_16BIT:
+		case LIBFWEVT_VALUE_TYPE_INTEGER_32BIT:
+		case LIBFWEVT_VALUE_TYPE_INTEGER_64BIT:
+		case LIBFWEVT_VALUE_TYPE_UNSIGNED_INTEGER_8BIT:
+		case LIBFWEVT_VALUE_TYPE_UNSIGNED_INTEGER_16BIT:
+		case LIBFWEVT_VALUE_TYPE_UNSIGNED_INTEGER_32BIT:
+		case LIBFWEVT_VALUE_TYPE_UNSIGNED_INTEGER_64BIT:
+		case LIBFWEVT_VALUE_TYPE_BOOLEAN:
+			if( number_of_data_segments != 1 )
+			{
+				output_buffer->data[ data_size++ ] = (uint8_t) '"';
+			}
+			break;
+
+		default:
+			output_buffer->data[ data_size++ ] = (uint8_t) '"';
+			break;
+	}
+	value_index = data_size;
+
+	/* The other value types are formatted without characters that need to be escaped
+	 */
+	if( libfwevt_internal_xml_value_get_data_as_utf8_string_with_index(
+	     internal_xml_value,
+	     output_buffer->data,
+	     output_buffer->allocated_data_size,
+	     &data_size,
+	     0,
+	     ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy value to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	/* Remove the end-of-string character
+	 */
+	if( data_size > value_index )
+	{
+		data_size--;
+	}
+	if( value_index > output_buffer->data_size )
+	{
+		output_buffer->data[ data_size++ ] = (uint8_t) '"';
+	}
+	output_buffer->data_size = data_size;
+
+	return( 1 );
+}
+
+/* Appends the UTF-8 JSON formatted key and value of a sub element to an output buffer
+ * Returns 1 if successful, 0 if the sub element was already formatted or -1 on error
+ */
+int libfwevt_xml_tag_append_utf8_json_element_to_output_buffer(
+     libfwevt_internal_xml_tag_t *internal_xml_tag,
+     int element_index,
+     int number_of_elements,
+     uint8_t is_event_data,
+     libfwevt_output_buffer_t *output_buffer,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_tag_t *internal_element_xml_tag = NULL;
+	libfwevt_internal_xml_tag_t *internal_other_xml_tag   = NULL;
+	const uint8_t *name_data                              = NULL;
+	static char *function                                 = "libfwevt_xml_tag_append_utf8_json_element_to_output_buffer";
+	size_t name_data_size                                 = 0;
+	int number_of_values                                  = 0;
+	int other_element_index                               = 0;
+	int result                                            = 0;
+
+	if( internal_xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_internal_xml_tag_get_element_by_index(
+	     internal_xml_tag,
+	     element_index,
+	     (libfwevt_xml_tag_t **) &internal_element_xml_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve sub element: %d.",
+		 function,
+		 element_index );
+
+		return( -1 );
+	}
+	if( internal_element_xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing sub element: %d.",
+		 function,
+		 element_index );
+
+		return( -1 );
+	}
+	if( internal_element_xml_tag->type == LIBFWEVT_XML_TAG_TYPE_CDATA )
+	{
+		if( libfwevt_output_buffer_append_data(
+		     output_buffer,
+		     (uint8_t *) "\"#cdata\":",
+		     9,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append CDATA key to output buffer.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwevt_xml_tag_append_utf8_json_value_to_output_buffer(
+		     output_buffer,
+		     internal_element_xml_tag->value,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append CDATA value to output buffer.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( internal_element_xml_tag->type == LIBFWEVT_XML_TAG_TYPE_PI )
+	{
+		if( libfwevt_output_buffer_append_data(
+		     output_buffer,
+		     (uint8_t *) "\"#pi\":{",
+		     7,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append processing instruction key to output buffer.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwevt_xml_tag_append_utf8_json_string_to_output_buffer(
+		     output_buffer,
+		     internal_element_xml_tag->name,
+		     internal_element_xml_tag->name_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append processing instruction name to output buffer.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwevt_output_buffer_append_data(
+		     output_buffer,
+		     (uint8_t *) ":",
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append separator to output buffer.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwevt_xml_tag_append_utf8_json_value_to_output_buffer(
+		     output_buffer,
+		     internal_element_xml_tag->value,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append processing instruction value to output buffer.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwevt_output_buffer_append_data(
+		     output_buffer,
+		     (uint8_t *) "}",
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append end of object to output buffer.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( is_event_data != 0 )
+	{
+		result = libfwevt_internal_xml_tag_get_event_data_name(
+		          internal_element_xml_tag,
+		          &name_data,
+		          &name_data_size,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve event data name of sub element: %d.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+	}
+	if( result != 0 )
+	{
+		/* An EventData Data element with a Name attribute is formatted as "name":value
+		 */
+		if( libfwevt_xml_tag_append_utf8_json_string_to_output_buffer(
+		     output_buffer,
+		     name_data,
+		     name_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append event data name to output buffer.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwevt_output_buffer_append_data(
+		     output_buffer,
+		     (uint8_t *) ":",
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append separator to output buffer.",
+			 function );
+
+			return( -1 );
+		}
+		result = libfwevt_internal_xml_tag_has_element_value(
+		          internal_element_xml_tag,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if sub element: %d has a value.",
+			 function,
+			 element_index );
+
+			return( -1 );
+		}
+		if( libfwevt_xml_tag_append_utf8_json_value_to_output_buffer(
+		     output_buffer,
+		     ( result != 0 ) ? internal_element_xml_tag->value : NULL,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append event data value to output buffer.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	/* Sub elements with the same name are formatted as a JSON array
+	 * at the position of the first sub element with that name
+	 */
+	number_of_values = 1;
+
+	for( other_element_index = 0;
+	     other_element_index < number_of_elements;
+	     other_element_index++ )
+	{
+		if( other_element_index == element_index )
+		{
+			continue;
+		}
+		if( libfwevt_internal_xml_tag_get_element_by_index(
+		     internal_xml_tag,
+		     other_element_index,
+		     (libfwevt_xml_tag_t **) &internal_other_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub element: %d.",
+			 function,
+			 other_element_index );
+
+			return( -1 );
+		}
+		result = libfwevt_internal_xml_tag_compare_name(
+		          internal_element_xml_tag,
+		          internal_other_xml_tag,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare name of sub element: %d.",
+			 function,
+			 other_element_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		if( is_event_data != 0 )
+		{
+			result = libfwevt_internal_xml_tag_get_event_data_name(
+			          internal_other_xml_tag,
+			          &name_data,
+			          &name_data_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve event data name of sub element: %d.",
+				 function,
+				 other_element_index );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				continue;
+			}
+		}
+		if( other_element_index < element_index )
+		{
+			/* The sub element was already formatted
+			 */
+			return( 0 );
+		}
+		number_of_values++;
+	}
+	if( libfwevt_xml_tag_append_utf8_json_string_to_output_buffer(
+	     output_buffer,
+	     internal_element_xml_tag->name,
+	     internal_element_xml_tag->name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append name to output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_output_buffer_append_data(
+	     output_buffer,
+	     (uint8_t *) ( ( number_of_values > 1 ) ? ":[" : ":" ),
+	     ( number_of_values > 1 ) ? 2 : 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append separator to output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_render_utf8_json_string(
+	     (libfwevt_xml_tag_t *) internal_element_xml_tag,
+	     output_buffer,
+	     ascii_codepage,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to render sub element: %d.",
+		 function,
+		 element_index );
+
+		return( -1 );
+	}
+	if( number_of_values == 1 )
+	{
+		return( 1 );
+	}
+	for( other_element_index = element_index + 1;
+	     other_element_index < number_of_elements;
+	     other_element_index++ )
+	{
+		if( libfwevt_internal_xml_tag_get_element_by_index(
+		     internal_xml_tag,
+		     other_element_index,
+		     (libfwevt_xml_tag_t **) &internal_other_xml_tag,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sub element: %d.",
+			 function,
+			 other_element_index );
+
+			return( -1 );
+		}
+		result = libfwevt_internal_xml_tag_compare_name(
+		          internal_element_xml_tag,
+		          internal_other_xml_tag,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare name of sub element: %d.",
+			 function,
+			 other_element_index );
+
+			return( -1 );
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		if( is_event_data != 0 )
+		{
+			result = libfwevt_internal_xml_tag_get_event_data_name(
+			          internal_other_xml_tag,
+			          &name_data,
+			          &name_data_size,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve event data name of sub element: %d.",
+				 function,
+				 other_element_index );
+
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				continue;
+			}
+		}
+		if( libfwevt_output_buffer_append_data(
+		     output_buffer,
+		     (uint8_t *) ",",
+		     1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append separator to output buffer.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwevt_xml_tag_render_utf8_json_string(
+		     (libfwevt_xml_tag_t *) internal_other_xml_tag,
+		     output_buffer,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to render sub element: %d.",
+			 function,
+			 other_element_index );
+
+			return( -1 );
+		}
+	}
+	if( libfwevt_output_buffer_append_data(
+	     output_buffer,
+	     (uint8_t *) "]",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append end of array to output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Renders the UTF-8 JSON formatted value of the XML tag to an output buffer
+ * An element without attributes and sub elements is formatted as its value, otherwise
+ * as a JSON object with the attributes in "#attributes" and the value in "#text".
+ * Sub elements with the same name are formatted as a JSON array and the Data elements
+ * of EventData with a Name attribute are formatted as "name":value pairs
+ * The end-of-string character is not appended
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_tag_render_utf8_json_string(
+     libfwevt_xml_tag_t *xml_tag,
+     libfwevt_output_buffer_t *output_buffer,
+     int ascii_codepage,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_tag_t *internal_attribute_xml_tag = NULL;
+	libfwevt_internal_xml_tag_t *internal_xml_tag           = NULL;
+	static char *function                                   = "libfwevt_xml_tag_render_utf8_json_string";
+	uint8_t is_event_data                                   = 0;
+	uint8_t has_members                                     = 0;
+	int attribute_index                                     = 0;
+	int element_index                                       = 0;
+	int has_value                                           = 0;
+	int number_of_attributes                                = 0;
+	int number_of_elements                                  = 0;
+	int result                                              = 0;
+
+	if( xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_tag = (libfwevt_internal_xml_tag_t *) xml_tag;
+
+	if( output_buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_xml_tag->type != LIBFWEVT_XML_TAG_TYPE_NODE )
+	{
+		if( libfwevt_xml_tag_append_utf8_json_value_to_output_buffer(
+		     output_buffer,
+		     internal_xml_tag->value,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append value to output buffer.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libfwevt_internal_xml_tag_get_number_of_attributes(
+	     internal_xml_tag,
+	     &number_of_attributes,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of attributes.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_internal_xml_tag_get_number_of_elements(
+	     internal_xml_tag,
+	     &number_of_elements,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of elements.",
+		 function );
+
+		return( -1 );
+	}
+	has_value = libfwevt_internal_xml_tag_has_element_value(
+	             internal_xml_tag,
+	             error );
+
+	if( has_value == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if element has a value.",
+		 function );
+
+		return( -1 );
+	}
+	/* Similar to the XML output the sub elements are ignored if the element has a value
+	 */
+	if( ( number_of_attributes == 0 )
+	 && ( ( has_value != 0 )
+	  ||  ( number_of_elements == 0 ) ) )
+	{
+		if( libfwevt_xml_tag_append_utf8_json_value_to_output_buffer(
+		     output_buffer,
+		     ( has_value != 0 ) ? internal_xml_tag->value : NULL,
+		     ascii_codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append value to output buffer.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
+	}
+	if( libfwevt_output_buffer_append_data(
+	     output_buffer,
+	     (uint8_t *) "{",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append start of object to output buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_attributes > 0 )
+	{
+		if( libfwevt_output_buffer_append_data(
+		     output_buffer,
+		     (uint8_t *) "\"#attributes\":{",
+		     15,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append attributes to output buffer.",
+			 function );
+
+			return( -1 );
+		}
+		for( attribute_index = 0;
+		     attribute_index < number_of_attributes;
+		     attribute_index++ )
+		{
+			if( libfwevt_internal_xml_tag_get_attribute_by_index(
+			     internal_xml_tag,
+			     attribute_index,
+			     (libfwevt_xml_tag_t **) &internal_attribute_xml_tag,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve attribute: %d.",
+				 function,
+				 attribute_index );
 
 				return( -1 );
 			}
-			utf8_string[ string_index++ ] = (uint8_t) '>';
-			utf8_string[ string_index++ ] = (uint8_t) '\n';
-
-			for( element_index = 0;
-			     element_index < number_of_elements;
-			     element_index++ )
+			if( internal_attribute_xml_tag == NULL )
 			{
-				if( libcdata_array_get_entry_by_index(
-				     internal_xml_tag->elements_array,
-				     element_index,
-				     (intptr_t **) &element_xml_tag,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve sub element: %d.",
-					 function,
-					 element_index );
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing attribute: %d.",
+				 function,
+				 attribute_index );
 
-					return( -1 );
-				}
-				if( libfwevt_xml_tag_get_utf8_xml_string_with_index(
-				     element_xml_tag,
-				     xml_tag_level + 1,
-				     utf8_string,
-				     utf8_string_size,
-				     &string_index,
-				     ascii_codepage,
+				return( -1 );
+			}
+			if( attribute_index > 0 )
+			{
+				if( libfwevt_output_buffer_append_data(
+				     output_buffer,
+				     (uint8_t *) ",",
+				     1,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-					 "%s: unable to copy sub element: %d to UTF-8 string.",
-					 function,
-					 element_index );
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append separator to output buffer.",
+					 function );
 
 					return( -1 );
 				}
-				string_index--;
-			}
-			if( ( string_index + ( xml_tag_level * 2 ) ) > utf8_string_size )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: UTF-8 string size too small.",
-				 function );
-
-				return( -1 );
 			}
-			for( indentation_iterator = 0;
-			     indentation_iterator < xml_tag_level;
-			     indentation_iterator++ )
-			{
-				utf8_string[ string_index++ ] = (uint8_t) ' ';
-				utf8_string[ string_index++ ] = (uint8_t) ' ';
-			}
-			if( ( string_index + 2 ) > utf8_string_size )
+			if( libfwevt_xml_tag_append_utf8_json_string_to_output_buffer(
+			     output_buffer,
+			     internal_attribute_xml_tag->name,
+			     internal_attribute_xml_tag->name_size,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: UTF-8 string size too small.",
-				 function );
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append attribute: %d name to output buffer.",
+				 function,
+				 attribute_index );
 
 				return( -1 );
 			}
-			utf8_string[ string_index++ ] = (uint8_t) '<';
-			utf8_string[ string_index++ ] = (uint8_t) '/';
-
-			if( libuna_utf8_string_with_index_copy_from_utf16_stream(
-			     utf8_string,
-			     utf8_string_size,
-			     &string_index,
-			     internal_xml_tag->name,
-			     internal_xml_tag->name_size,
-			     LIBUNA_ENDIAN_LITTLE,
+			if( libfwevt_output_buffer_append_data(
+			     output_buffer,
+			     (uint8_t *) ":",
+			     1,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-				 "%s: unable to copy name to UTF-8 string.",
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append separator to output buffer.",
 				 function );
 
 				return( -1 );
 			}
-			string_index--;
-		}
-		else
-		{
-			if( ( string_index + 1 ) > utf8_string_size )
+			if( libfwevt_xml_tag_append_utf8_json_value_to_output_buffer(
+			     output_buffer,
+			     internal_attribute_xml_tag->value,
+			     ascii_codepage,
+			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-				 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-				 "%s: UTF-8 string size too small.",
-				 function );
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append attribute: %d value to output buffer.",
+				 function,
+				 attribute_index );
 
 				return( -1 );
 			}
-			utf8_string[ string_index++ ] = (uint8_t) '/';
 		}
-		if( ( string_index + 3 ) > utf8_string_size )
+		if( libfwevt_output_buffer_append_data(
+		     output_buffer,
+		     (uint8_t *) "}",
+		     1,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-			 "%s: UTF-8 string size too small.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append end of attributes to output buffer.",
 			 function );
 
 			return( -1 );
 		}
+		has_members = 1;
 	}
-	else if( internal_xml_tag->type == LIBFWEVT_XML_TAG_TYPE_CDATA )
+	if( has_value != 0 )
 	{
-		if( ( string_index + 8 ) > utf8_string_size )
+		if( libfwevt_output_buffer_append_data(
+		     output_buffer,
+		     (uint8_t *) ( ( has_members != 0 ) ? ",\"#text\":" : "\"#text\":" ),
+		     ( has_members != 0 ) ? 9 : 8,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-			 "%s: UTF-8 string size too small.",
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append text key to output buffer.",
 			 function );
 
 			return( -1 );
 		}
-		utf8_string[ string_index++ ] = (uint8_t) '!';
-		utf8_string[ string_index++ ] = (uint8_t) '[';
-		utf8_string[ string_index++ ] = (uint8_t) 'C';
-		utf8_string[ string_index++ ] = (uint8_t) 'D';
-		utf8_string[ string_index++ ] = (uint8_t) 'A';
-		utf8_string[ string_index++ ] = (uint8_t) 'T';
-		utf8_string[ string_index++ ] = (uint8_t) 'A';
-		utf8_string[ string_index++ ] = (uint8_t) '[';
-
-		if( libfwevt_internal_xml_value_get_data_as_utf8_string_with_index(
-		     (libfwevt_internal_xml_value_t *) internal_xml_tag->value,
-		     utf8_string,
-		     utf8_string_size,
-		     &string_index,
-		     0,
+		if( libfwevt_xml_tag_append_utf8_json_value_to_output_buffer(
+		     output_buffer,
+		     internal_xml_tag->value,
 		     ascii_codepage,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy value to UTF-8 string.",
-			 function );
-
-			return( -1 );
-		}
-		string_index--;
-
-		if( ( string_index + 2 ) > utf8_string_size )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-			 "%s: UTF-8 string size too small.",
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append value to output buffer.",
 			 function );
 
 			return( -1 );
 		}
-		utf8_string[ string_index++ ] = (uint8_t) ']';
-		utf8_string[ string_index++ ] = (uint8_t) ']';
 	}
-	else if( internal_xml_tag->type == LIBFWEVT_XML_TAG_TYPE_PI )
+	else if( number_of_elements > 0 )
 	{
-		if( ( string_index + 1 ) > utf8_string_size )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-			 "%s: UTF-8 string size too small.",
-			 function );
-
-			return( -1 );
-		}
-		utf8_string[ string_index++ ] = (uint8_t) '?';
+		result = libfwevt_internal_xml_tag_compare_name_with_ascii_string(
+		          internal_xml_tag,
+		          "EventData",
+		          9,
+		          error );
 
-		if( libuna_utf8_string_with_index_copy_from_utf16_stream(
-		     utf8_string,
-		     utf8_string_size,
-		     &string_index,
-		     internal_xml_tag->name,
-		     internal_xml_tag->name_size,
-		     LIBUNA_ENDIAN_LITTLE,
-		     error ) != 1 )
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy name to UTF-8 string.",
-			 function );
-
-			return( -1 );
-		}
-		string_index--;
-
-		if( ( string_index + 1 ) > utf8_string_size )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-			 "%s: UTF-8 string size too small.",
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare name.",
 			 function );
 
 			return( -1 );
 		}
-		utf8_string[ string_index++ ] = (uint8_t) ' ';
+		is_event_data = (uint8_t) result;
 
-		if( libfwevt_internal_xml_value_get_data_as_utf8_string_with_index(
-		     (libfwevt_internal_xml_value_t *) internal_xml_tag->value,
-		     utf8_string,
-		     utf8_string_size,
-		     &string_index,
-		     0,
-		     ascii_codepage,
-		     error ) != 1 )
+		for( element_index = 0;
+		     element_index < number_of_elements;
+		     element_index++ )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-			 "%s: unable to copy value to UTF-8 string.",
-			 function );
-
-			return( -1 );
-		}
-		string_index--;
+			if( has_members != 0 )
+			{
+				if( libfwevt_output_buffer_append_data(
+				     output_buffer,
+				     (uint8_t *) ",",
+				     1,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append separator to output buffer.",
+					 function );
 
-		if( ( string_index + 1 ) > utf8_string_size )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
-			 "%s: UTF-8 string size too small.",
-			 function );
+					return( -1 );
+				}
+			}
+			result = libfwevt_xml_tag_append_utf8_json_element_to_output_buffer(
+			          internal_xml_tag,
+			          element_index,
+			          number_of_elements,
+			          is_event_data,
+			          output_buffer,
+			          ascii_codepage,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append sub element: %d to output buffer.",
+				 function,
+				 element_index );
 
-			return( -1 );
+				return( -1 );
+			}
+			else if( result != 0 )
+			{
+				has_members = 1;
+			}
+			else if( has_members != 0 )
+			{
+				/* Remove the separator of a sub element that was already formatted
+				 */
+				output_buffer->data_size -= 1;
+			}
 		}
-		utf8_string[ string_index++ ] = (uint8_t) '?';
 	}
-	utf8_string[ string_index++ ] = (uint8_t) '>';
-	utf8_string[ string_index++ ] = (uint8_t) '\n';
-	utf8_string[ string_index++ ] = 0;
-
-	*utf8_string_index = string_index;
+	if( libfwevt_output_buffer_append_data(
+	     output_buffer,
+	     (uint8_t *) "}",
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append end of object to output buffer.",
+		 function );
 
+		return( -1 );
+	}
 	return( 1 );
 }
 
@@ -3136,8 +6211,8 @@ int libfwevt_xml_tag_get_utf16_xml_string_size(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
-	     internal_xml_tag->attributes_array,
+	if( libfwevt_internal_xml_tag_get_number_of_attributes(
+	     internal_xml_tag,
 	     &number_of_attributes,
 	     error ) != 1 )
 	{
@@ -3158,8 +6233,8 @@ int libfwevt_xml_tag_get_utf16_xml_string_size(
 
 	if( internal_xml_tag->type == LIBFWEVT_XML_TAG_TYPE_NODE )
 	{
-		if( libcdata_array_get_number_of_entries(
-		     internal_xml_tag->elements_array,
+		if( libfwevt_internal_xml_tag_get_number_of_elements(
+		     internal_xml_tag,
 		     &number_of_elements,
 		     error ) != 1 )
 		{
@@ -3199,10 +6274,10 @@ int libfwevt_xml_tag_get_utf16_xml_string_size(
 			     attribute_index < number_of_attributes;
 			     attribute_index++ )
 			{
-				if( libcdata_array_get_entry_by_index(
-				     internal_xml_tag->attributes_array,
+				if( libfwevt_internal_xml_tag_get_attribute_by_index(
+				     internal_xml_tag,
 				     attribute_index,
-				     (intptr_t **) &internal_attribute_xml_tag,
+				     (libfwevt_xml_tag_t **) &internal_attribute_xml_tag,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
@@ -3319,10 +6394,10 @@ int libfwevt_xml_tag_get_utf16_xml_string_size(
 			     element_index < number_of_elements;
 			     element_index++ )
 			{
-				if( libcdata_array_get_entry_by_index(
-				     internal_xml_tag->elements_array,
+				if( libfwevt_internal_xml_tag_get_element_by_index(
+				     internal_xml_tag,
 				     element_index,
-				     (intptr_t **) &element_xml_tag,
+				     &element_xml_tag,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
@@ -3553,8 +6628,8 @@ int libfwevt_xml_tag_get_utf16_xml_string_with_index(
 
 	if( internal_xml_tag->type == LIBFWEVT_XML_TAG_TYPE_NODE )
 	{
-		if( libcdata_array_get_number_of_entries(
-		     internal_xml_tag->attributes_array,
+		if( libfwevt_internal_xml_tag_get_number_of_attributes(
+		     internal_xml_tag,
 		     &number_of_attributes,
 		     error ) != 1 )
 		{
@@ -3567,8 +6642,8 @@ int libfwevt_xml_tag_get_utf16_xml_string_with_index(
 
 			return( -1 );
 		}
-		if( libcdata_array_get_number_of_entries(
-		     internal_xml_tag->elements_array,
+		if( libfwevt_internal_xml_tag_get_number_of_elements(
+		     internal_xml_tag,
 		     &number_of_elements,
 		     error ) != 1 )
 		{
@@ -3607,10 +6682,10 @@ int libfwevt_xml_tag_get_utf16_xml_string_with_index(
 			     attribute_index < number_of_attributes;
 			     attribute_index++ )
 			{
-				if( libcdata_array_get_entry_by_index(
-				     internal_xml_tag->attributes_array,
+				if( libfwevt_internal_xml_tag_get_attribute_by_index(
+				     internal_xml_tag,
 				     attribute_index,
-				     (intptr_t **) &internal_attribute_xml_tag,
+				     (libfwevt_xml_tag_t **) &internal_attribute_xml_tag,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
@@ -3841,10 +6916,10 @@ int libfwevt_xml_tag_get_utf16_xml_string_with_index(
 			     element_index < number_of_elements;
 			     element_index++ )
 			{
-				if( libcdata_array_get_entry_by_index(
-				     internal_xml_tag->elements_array,
+				if( libfwevt_internal_xml_tag_get_element_by_index(
+				     internal_xml_tag,
 				     element_index,
-				     (intptr_t **) &element_xml_tag,
+				     &element_xml_tag,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
@@ -4270,8 +7345,8 @@ int libfwevt_xml_tag_debug_print(
 
 	if( internal_xml_tag->type == LIBFWEVT_XML_TAG_TYPE_NODE )
 	{
-		if( libcdata_array_get_number_of_entries(
-		     internal_xml_tag->attributes_array,
+		if( libfwevt_internal_xml_tag_get_number_of_attributes(
+		     internal_xml_tag,
 		     &number_of_attributes,
 		     error ) != 1 )
 		{
@@ -4284,8 +7359,8 @@ int libfwevt_xml_tag_debug_print(
 
 			return( -1 );
 		}
-		if( libcdata_array_get_number_of_entries(
-		     internal_xml_tag->elements_array,
+		if( libfwevt_internal_xml_tag_get_number_of_elements(
+		     internal_xml_tag,
 		     &number_of_elements,
 		     error ) != 1 )
 		{
@@ -4317,10 +7392,10 @@ int libfwevt_xml_tag_debug_print(
 			     attribute_index < number_of_attributes;
 			     attribute_index++ )
 			{
-				if( libcdata_array_get_entry_by_index(
-				     internal_xml_tag->attributes_array,
+				if( libfwevt_internal_xml_tag_get_attribute_by_index(
+				     internal_xml_tag,
 				     attribute_index,
-				     (intptr_t **) &internal_attribute_xml_tag,
+				     (libfwevt_xml_tag_t **) &internal_attribute_xml_tag,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
@@ -4453,10 +7528,10 @@ int libfwevt_xml_tag_debug_print(
 			     element_index < number_of_elements;
 			     element_index++ )
 			{
-				if( libcdata_array_get_entry_by_index(
-				     internal_xml_tag->elements_array,
+				if( libfwevt_internal_xml_tag_get_element_by_index(
+				     internal_xml_tag,
 				     element_index,
-				     (intptr_t **) &element_xml_tag,
+				     &element_xml_tag,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
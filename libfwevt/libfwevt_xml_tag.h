@@ -25,9 +25,11 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfwevt_arena.h"
+#include "libfwevt_array.h"
 #include "libfwevt_extern.h"
-#include "libfwevt_libcdata.h"
 #include "libfwevt_libcerror.h"
+#include "libfwevt_output_buffer.h"
 #include "libfwevt_types.h"
 
 #if defined( __cplusplus )
@@ -50,27 +52,53 @@ struct libfwevt_internal_xml_tag
 	 */
 	size_t name_size;
 
+	/* Value to indicate the name is interned
+	 * An interned name is owned by the name table of the binary XML document
+	 * or by the XML tree
+	 */
+	uint8_t name_is_interned;
+
 	/* The value
 	 */
 	libfwevt_xml_value_t *value;
 
 	/* The attributes array
 	 */
-	libcdata_array_t *attributes_array;
+	libfwevt_array_t *attributes_array;
 
 	/* The elements array
 	 */
-	libcdata_array_t *elements_array;
+	libfwevt_array_t *elements_array;
 
 	/* The flags
 	 */
 	uint8_t flags;
+
+	/* The arena
+	 * Only set if the XML tag was allocated from an arena
+	 */
+	libfwevt_arena_t *arena;
+
+	/* The XML tree
+	 * Only set if the XML tag is a node of a flat XML tree, in which case
+	 * the attributes and elements arrays are not used
+	 */
+	struct libfwevt_xml_tree *tree;
+
+	/* The node index in the XML tree
+	 */
+	int node_index;
 };
 
 int libfwevt_xml_tag_initialize(
      libfwevt_xml_tag_t **xml_tag,
      libcerror_error_t **error );
 
+int libfwevt_xml_tag_initialize_with_arena(
+     libfwevt_xml_tag_t **xml_tag,
+     libfwevt_arena_t *arena,
+     libcerror_error_t **error );
+
 LIBFWEVT_EXTERN \
 int libfwevt_xml_tag_free(
      libfwevt_xml_tag_t **xml_tag,
@@ -80,6 +108,10 @@ int libfwevt_internal_xml_tag_free(
      libfwevt_internal_xml_tag_t **internal_xml_tag,
      libcerror_error_t **error );
 
+int libfwevt_internal_xml_tag_clear(
+     libfwevt_internal_xml_tag_t *internal_xml_tag,
+     libcerror_error_t **error );
+
 int libfwevt_xml_tag_set_type(
      libfwevt_xml_tag_t *xml_tag,
      uint8_t type,
@@ -91,6 +123,12 @@ int libfwevt_xml_tag_set_name_data(
      size_t data_size,
      libcerror_error_t **error );
 
+int libfwevt_xml_tag_set_interned_name_data(
+     libfwevt_xml_tag_t *xml_tag,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 int libfwevt_xml_tag_set_value_type(
      libfwevt_xml_tag_t *xml_tag,
      uint8_t value_type,
@@ -100,12 +138,14 @@ int libfwevt_xml_tag_set_value_data(
      libfwevt_xml_tag_t *xml_tag,
      const uint8_t *data,
      size_t data_size,
+     uint8_t flags,
      libcerror_error_t **error );
 
 int libfwevt_xml_tag_append_value_data(
      libfwevt_xml_tag_t *xml_tag,
      const uint8_t *data,
      size_t data_size,
+     uint8_t flags,
      int *data_segment_index,
      libcerror_error_t **error );
 
@@ -119,6 +159,12 @@ int libfwevt_xml_tag_append_element(
      libfwevt_xml_tag_t *element_xml_tag,
      libcerror_error_t **error );
 
+int libfwevt_xml_tag_get_name_data(
+     libfwevt_xml_tag_t *xml_tag,
+     const uint8_t **name_data,
+     size_t *name_data_size,
+     libcerror_error_t **error );
+
 LIBFWEVT_EXTERN \
 int libfwevt_xml_tag_get_utf8_name_size(
      libfwevt_xml_tag_t *xml_tag,
@@ -177,6 +223,17 @@ int libfwevt_xml_tag_get_utf16_value(
      size_t utf16_string_size,
      libcerror_error_t **error );
 
+int libfwevt_internal_xml_tag_get_number_of_attributes(
+     libfwevt_internal_xml_tag_t *internal_xml_tag,
+     int *number_of_attributes,
+     libcerror_error_t **error );
+
+int libfwevt_internal_xml_tag_get_attribute_by_index(
+     libfwevt_internal_xml_tag_t *internal_xml_tag,
+     int attribute_index,
+     libfwevt_xml_tag_t **attribute_xml_tag,
+     libcerror_error_t **error );
+
 LIBFWEVT_EXTERN \
 int libfwevt_xml_tag_get_number_of_attributes(
      libfwevt_xml_tag_t *xml_tag,
@@ -206,6 +263,17 @@ int libfwevt_xml_tag_get_attribute_by_utf16_name(
      libfwevt_xml_tag_t **attribute_xml_tag,
      libcerror_error_t **error );
 
+int libfwevt_internal_xml_tag_get_number_of_elements(
+     libfwevt_internal_xml_tag_t *internal_xml_tag,
+     int *number_of_elements,
+     libcerror_error_t **error );
+
+int libfwevt_internal_xml_tag_get_element_by_index(
+     libfwevt_internal_xml_tag_t *internal_xml_tag,
+     int element_index,
+     libfwevt_xml_tag_t **element_xml_tag,
+     libcerror_error_t **error );
+
 LIBFWEVT_EXTERN \
 int libfwevt_xml_tag_get_number_of_elements(
      libfwevt_xml_tag_t *xml_tag,
@@ -262,6 +330,68 @@ int libfwevt_xml_tag_get_utf8_xml_string_with_index(
      int ascii_codepage,
      libcerror_error_t **error );
 
+int libfwevt_xml_tag_append_utf8_value_to_output_buffer(
+     libfwevt_output_buffer_t *output_buffer,
+     libfwevt_xml_value_t *xml_value,
+     uint8_t escape_characters,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+int libfwevt_xml_tag_render_utf8_xml_string(
+     libfwevt_xml_tag_t *xml_tag,
+     int xml_tag_level,
+     libfwevt_output_buffer_t *output_buffer,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+int libfwevt_internal_xml_tag_compare_name_with_ascii_string(
+     libfwevt_internal_xml_tag_t *internal_xml_tag,
+     const char *string,
+     size_t string_length,
+     libcerror_error_t **error );
+
+int libfwevt_internal_xml_tag_compare_name(
+     libfwevt_internal_xml_tag_t *internal_xml_tag,
+     libfwevt_internal_xml_tag_t *other_internal_xml_tag,
+     libcerror_error_t **error );
+
+int libfwevt_internal_xml_tag_has_element_value(
+     libfwevt_internal_xml_tag_t *internal_xml_tag,
+     libcerror_error_t **error );
+
+int libfwevt_internal_xml_tag_get_event_data_name(
+     libfwevt_internal_xml_tag_t *internal_xml_tag,
+     const uint8_t **name_data,
+     size_t *name_data_size,
+     libcerror_error_t **error );
+
+int libfwevt_xml_tag_append_utf8_json_string_to_output_buffer(
+     libfwevt_output_buffer_t *output_buffer,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     libcerror_error_t **error );
+
+int libfwevt_xml_tag_append_utf8_json_value_to_output_buffer(
+     libfwevt_output_buffer_t *output_buffer,
+     libfwevt_xml_value_t *xml_value,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+int libfwevt_xml_tag_append_utf8_json_element_to_output_buffer(
+     libfwevt_internal_xml_tag_t *internal_xml_tag,
+     int element_index,
+     int number_of_elements,
+     uint8_t is_event_data,
+     libfwevt_output_buffer_t *output_buffer,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
+int libfwevt_xml_tag_render_utf8_json_string(
+     libfwevt_xml_tag_t *xml_tag,
+     libfwevt_output_buffer_t *output_buffer,
+     int ascii_codepage,
+     libcerror_error_t **error );
+
 int libfwevt_xml_tag_get_utf16_xml_string_size(
      libfwevt_xml_tag_t *xml_tag,
      int xml_tag_level,
@@ -0,0 +1,526 @@
+/*
+ * XML template cache functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwevt_definitions.h"
+#include "libfwevt_guid_index.h"
+#include "libfwevt_libcdata.h"
+#include "libfwevt_libcerror.h"
+#include "libfwevt_xml_template_cache.h"
+#include "libfwevt_xml_template_definition.h"
+
+/* Creates a XML template cache
+ * Make sure the value template_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_template_cache_initialize(
+     libfwevt_xml_template_cache_t **template_cache,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_template_cache_t *internal_template_cache = NULL;
+	static char *function                                           = "libfwevt_xml_template_cache_initialize";
+
+	if( template_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *template_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid template cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	internal_template_cache = memory_allocate_structure(
+	                           libfwevt_internal_xml_template_cache_t );
+
+	if( internal_template_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create template cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     internal_template_cache,
+	     0,
+	     sizeof( libfwevt_internal_xml_template_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear template cache.",
+		 function );
+
+		memory_free(
+		 internal_template_cache );
+
+		return( -1 );
+	}
+	if( libcdata_array_initialize(
+	     &( internal_template_cache->definitions_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create definitions array.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfwevt_guid_index_initialize(
+	     &( internal_template_cache->definitions_index ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create definitions index.",
+		 function );
+
+		goto on_error;
+	}
+	*template_cache = (libfwevt_xml_template_cache_t *) internal_template_cache;
+
+	return( 1 );
+
+on_error:
+	if( internal_template_cache != NULL )
+	{
+		if( internal_template_cache->definitions_array != NULL )
+		{
+			libcdata_array_free(
+			 &( internal_template_cache->definitions_array ),
+			 NULL,
+			 NULL );
+		}
+		memory_free(
+		 internal_template_cache );
+	}
+	return( -1 );
+}
+
+/* Frees a XML template cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_template_cache_free(
+     libfwevt_xml_template_cache_t **template_cache,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_template_cache_t *internal_template_cache = NULL;
+	static char *function                                           = "libfwevt_xml_template_cache_free";
+	int result                                                      = 1;
+
+	if( template_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *template_cache != NULL )
+	{
+		internal_template_cache = (libfwevt_internal_xml_template_cache_t *) *template_cache;
+		*template_cache         = NULL;
+
+		/* The definitions index only references the definitions
+		 */
+		if( libfwevt_guid_index_free(
+		     &( internal_template_cache->definitions_index ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free definitions index.",
+			 function );
+
+			result = -1;
+		}
+		if( libcdata_array_free(
+		     &( internal_template_cache->definitions_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libfwevt_xml_template_definition_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free definitions array.",
+			 function );
+
+			result = -1;
+		}
+		memory_free(
+		 internal_template_cache );
+	}
+	return( result );
+}
+
+/* Empties a XML template cache
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_template_cache_empty(
+     libfwevt_xml_template_cache_t *template_cache,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_template_cache_t *internal_template_cache = NULL;
+	static char *function                                           = "libfwevt_xml_template_cache_empty";
+
+	if( template_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_template_cache = (libfwevt_internal_xml_template_cache_t *) template_cache;
+
+	if( libfwevt_guid_index_empty(
+	     internal_template_cache->definitions_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to empty definitions index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_empty(
+	     internal_template_cache->definitions_array,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfwevt_xml_template_definition_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to empty definitions array.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of definitions
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_template_cache_get_number_of_definitions(
+     libfwevt_xml_template_cache_t *template_cache,
+     int *number_of_definitions,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_template_cache_t *internal_template_cache = NULL;
+	static char *function                                           = "libfwevt_xml_template_cache_get_number_of_definitions";
+
+	if( template_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template cache.",
+		 function );
+
+		return( -1 );
+	}
+	internal_template_cache = (libfwevt_internal_xml_template_cache_t *) template_cache;
+
+	if( libcdata_array_get_number_of_entries(
+	     internal_template_cache->definitions_array,
+	     number_of_definitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of definitions.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the definition of the template definition at a specific offset in the binary data
+ * A cached definition is only returned if it matches the template definition in the binary data
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwevt_internal_xml_template_cache_get_definition(
+     libfwevt_internal_xml_template_cache_t *internal_template_cache,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     uint32_t definition_offset,
+     uint8_t flags,
+     libfwevt_xml_template_definition_t **template_definition,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_template_definition_t *safe_template_definition = NULL;
+	static char *function                                        = "libfwevt_internal_xml_template_cache_get_definition";
+	int result                                                   = 0;
+
+	if( internal_template_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary data.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
+
+		return( -1 );
+	}
+	*template_definition = NULL;
+
+	if( ( binary_data_size < 24 )
+	 || ( (size_t) definition_offset > ( binary_data_size - 24 ) ) )
+	{
+		return( 0 );
+	}
+	result = libfwevt_guid_index_get_value_by_identifier(
+	          internal_template_cache->definitions_index,
+	          &( binary_data[ definition_offset + 4 ] ),
+	          16,
+	          (intptr_t **) &safe_template_definition,
+	          NULL,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve definition from index.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	result = libfwevt_xml_template_definition_matches_data(
+	          safe_template_definition,
+	          binary_data,
+	          binary_data_size,
+	          definition_offset,
+	          flags,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to determine if definition matches data.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		*template_definition = safe_template_definition;
+	}
+	return( result );
+}
+
+/* Inserts a definition into the XML template cache
+ * The cache takes over ownership of the definition if it was inserted
+ * Returns 1 if successful, 0 if the cache is full or already contains a definition
+ * with the same identifier or -1 on error
+ */
+int libfwevt_internal_xml_template_cache_insert_definition(
+     libfwevt_internal_xml_template_cache_t *internal_template_cache,
+     libfwevt_xml_template_definition_t *template_definition,
+     libcerror_error_t **error )
+{
+	intptr_t *value           = NULL;
+	static char *function     = "libfwevt_internal_xml_template_cache_insert_definition";
+	int entry_index           = 0;
+	int number_of_definitions = 0;
+	int result                = 0;
+
+	if( internal_template_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_template_cache->definitions_array,
+	     &number_of_definitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of definitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_definitions >= LIBFWEVT_XML_TEMPLATE_CACHE_MAXIMUM_NUMBER_OF_DEFINITIONS )
+	{
+		return( 0 );
+	}
+	result = libfwevt_guid_index_get_value_by_identifier(
+	          internal_template_cache->definitions_index,
+	          template_definition->identifier,
+	          16,
+	          &value,
+	          NULL,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve definition from index.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_append_entry(
+	     internal_template_cache->definitions_array,
+	     &entry_index,
+	     (intptr_t *) template_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append definition to array.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_guid_index_insert_value(
+	     internal_template_cache->definitions_index,
+	     template_definition->identifier,
+	     16,
+	     (intptr_t *) template_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to insert definition into index.",
+		 function );
+
+		/* The definition was not inserted hence the caller retains ownership
+		 */
+		libcdata_array_set_entry_by_index(
+		 internal_template_cache->definitions_array,
+		 entry_index,
+		 NULL,
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
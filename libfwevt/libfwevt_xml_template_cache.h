@@ -0,0 +1,93 @@
+/*
+ * XML template cache functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWEVT_XML_TEMPLATE_CACHE_H )
+#define _LIBFWEVT_XML_TEMPLATE_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwevt_extern.h"
+#include "libfwevt_guid_index.h"
+#include "libfwevt_libcdata.h"
+#include "libfwevt_libcerror.h"
+#include "libfwevt_types.h"
+#include "libfwevt_xml_template_definition.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfwevt_internal_xml_template_cache libfwevt_internal_xml_template_cache_t;
+
+struct libfwevt_internal_xml_template_cache
+{
+	/* The definitions array
+	 */
+	libcdata_array_t *definitions_array;
+
+	/* The definitions index
+	 * Contains the definitions by identifier (GUID)
+	 */
+	libfwevt_guid_index_t *definitions_index;
+};
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_template_cache_initialize(
+     libfwevt_xml_template_cache_t **template_cache,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_template_cache_free(
+     libfwevt_xml_template_cache_t **template_cache,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_template_cache_empty(
+     libfwevt_xml_template_cache_t *template_cache,
+     libcerror_error_t **error );
+
+LIBFWEVT_EXTERN \
+int libfwevt_xml_template_cache_get_number_of_definitions(
+     libfwevt_xml_template_cache_t *template_cache,
+     int *number_of_definitions,
+     libcerror_error_t **error );
+
+int libfwevt_internal_xml_template_cache_get_definition(
+     libfwevt_internal_xml_template_cache_t *internal_template_cache,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     uint32_t definition_offset,
+     uint8_t flags,
+     libfwevt_xml_template_definition_t **template_definition,
+     libcerror_error_t **error );
+
+int libfwevt_internal_xml_template_cache_insert_definition(
+     libfwevt_internal_xml_template_cache_t *internal_template_cache,
+     libfwevt_xml_template_definition_t *template_definition,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWEVT_XML_TEMPLATE_CACHE_H ) */
+
@@ -0,0 +1,829 @@
+/*
+ * XML template definition functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwevt_definitions.h"
+#include "libfwevt_libcerror.h"
+#include "libfwevt_xml_template_definition.h"
+#include "libfwevt_xml_template_program.h"
+
+/* The initial number of allocated nodes of a XML template definition
+ */
+#define LIBFWEVT_XML_TEMPLATE_DEFINITION_INITIAL_NUMBER_OF_NODES	32
+
+/* Creates a XML template definition
+ * Make sure the value template_definition is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_template_definition_initialize(
+     libfwevt_xml_template_definition_t **template_definition,
+     uint32_t offset,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_xml_template_definition_initialize";
+
+	if( template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( *template_definition != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid template definition value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*template_definition = memory_allocate_structure(
+	                        libfwevt_xml_template_definition_t );
+
+	if( *template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create template definition.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *template_definition,
+	     0,
+	     sizeof( libfwevt_xml_template_definition_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear template definition.",
+		 function );
+
+		goto on_error;
+	}
+	( *template_definition )->offset = offset;
+	( *template_definition )->flags  = flags & LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS;
+
+	return( 1 );
+
+on_error:
+	if( *template_definition != NULL )
+	{
+		memory_free(
+		 *template_definition );
+
+		*template_definition = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a XML template definition
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_template_definition_free(
+     libfwevt_xml_template_definition_t **template_definition,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_xml_template_definition_free";
+	int result            = 1;
+
+	if( template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( *template_definition != NULL )
+	{
+		if( ( *template_definition )->program != NULL )
+		{
+			if( libfwevt_xml_template_program_free(
+			     &( ( *template_definition )->program ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free program.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *template_definition )->nodes != NULL )
+		{
+			memory_free(
+			 ( *template_definition )->nodes );
+		}
+		if( ( *template_definition )->names_data != NULL )
+		{
+			memory_free(
+			 ( *template_definition )->names_data );
+		}
+		if( ( *template_definition )->data != NULL )
+		{
+			memory_free(
+			 ( *template_definition )->data );
+		}
+		memory_free(
+		 *template_definition );
+
+		*template_definition = NULL;
+	}
+	return( result );
+}
+
+/* Sets the data of a XML template definition
+ * The data is copied from the offset of the template definition in the binary data
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_template_definition_set_data(
+     libfwevt_xml_template_definition_t *template_definition,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_xml_template_definition_set_data";
+
+	if( template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_definition->data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid template definition - data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary data.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid binary data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < 24 )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	 || ( (size_t) template_definition->offset > binary_data_size )
+	 || ( data_size > ( binary_data_size - template_definition->offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	template_definition->data = (uint8_t *) memory_allocate(
+	                                         sizeof( uint8_t ) * data_size );
+
+	if( template_definition->data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     template_definition->data,
+	     &( binary_data[ template_definition->offset ] ),
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     template_definition->identifier,
+	     &( template_definition->data[ 4 ] ),
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy identifier.",
+		 function );
+
+		goto on_error;
+	}
+	template_definition->data_size        = data_size;
+	template_definition->binary_data_size = binary_data_size;
+
+	return( 1 );
+
+on_error:
+	if( template_definition->data != NULL )
+	{
+		memory_free(
+		 template_definition->data );
+
+		template_definition->data = NULL;
+	}
+	return( -1 );
+}
+
+/* Appends a node to a XML template definition
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_template_definition_append_node(
+     libfwevt_xml_template_definition_t *template_definition,
+     uint8_t type,
+     int *node_index,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_template_node_t *nodes = NULL;
+	static char *function               = "libfwevt_xml_template_definition_append_node";
+	size_t nodes_size                   = 0;
+	int number_of_allocated_nodes       = 0;
+
+	if( template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node index.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_definition->number_of_nodes >= template_definition->number_of_allocated_nodes )
+	{
+		if( template_definition->number_of_allocated_nodes == 0 )
+		{
+			number_of_allocated_nodes = LIBFWEVT_XML_TEMPLATE_DEFINITION_INITIAL_NUMBER_OF_NODES;
+		}
+		else
+		{
+			if( template_definition->number_of_allocated_nodes > ( INT_MAX / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid number of allocated nodes value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			number_of_allocated_nodes = template_definition->number_of_allocated_nodes * 2;
+		}
+		nodes_size = sizeof( libfwevt_xml_template_node_t ) * number_of_allocated_nodes;
+
+		if( nodes_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid nodes size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		nodes = (libfwevt_xml_template_node_t *) memory_reallocate(
+		                                          template_definition->nodes,
+		                                          nodes_size );
+
+		if( nodes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize nodes.",
+			 function );
+
+			return( -1 );
+		}
+		template_definition->nodes                     = nodes;
+		template_definition->number_of_allocated_nodes = number_of_allocated_nodes;
+	}
+	*node_index = template_definition->number_of_nodes;
+
+	if( memory_set(
+	     &( template_definition->nodes[ *node_index ] ),
+	     0,
+	     sizeof( libfwevt_xml_template_node_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear node.",
+		 function );
+
+		return( -1 );
+	}
+	template_definition->nodes[ *node_index ].type = type;
+
+	template_definition->number_of_nodes += 1;
+
+	return( 1 );
+}
+
+/* Sets the name of a node of a XML template definition
+ * The name, including its header, is copied into the names data
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_template_definition_set_node_name(
+     libfwevt_xml_template_definition_t *template_definition,
+     int node_index,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     uint32_t name_offset,
+     uint32_t name_size,
+     libcerror_error_t **error )
+{
+	uint8_t *names_data              = NULL;
+	static char *function            = "libfwevt_xml_template_definition_set_node_name";
+	size_t allocated_names_data_size = 0;
+
+	if( template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( node_index < 0 )
+	 || ( node_index >= template_definition->number_of_nodes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid node index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( (size_t) name_offset > binary_data_size )
+	 || ( (size_t) name_size > ( binary_data_size - name_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( (size_t) name_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - template_definition->names_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid names data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( template_definition->names_data_size + name_size ) > template_definition->allocated_names_data_size )
+	{
+		allocated_names_data_size = ( template_definition->names_data_size + name_size ) * 2;
+
+		if( allocated_names_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			allocated_names_data_size = (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE;
+		}
+		names_data = (uint8_t *) memory_reallocate(
+		                          template_definition->names_data,
+		                          sizeof( uint8_t ) * allocated_names_data_size );
+
+		if( names_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize names data.",
+			 function );
+
+			return( -1 );
+		}
+		template_definition->names_data                = names_data;
+		template_definition->allocated_names_data_size = allocated_names_data_size;
+	}
+	if( memory_copy(
+	     &( template_definition->names_data[ template_definition->names_data_size ] ),
+	     &( binary_data[ name_offset ] ),
+	     (size_t) name_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		return( -1 );
+	}
+	template_definition->nodes[ node_index ].data_offset = (uint32_t) template_definition->names_data_size;
+	template_definition->nodes[ node_index ].data_size   = name_size;
+	template_definition->nodes[ node_index ].name_offset = name_offset;
+
+	template_definition->names_data_size += name_size;
+
+	return( 1 );
+}
+
+/* Retrieves the name of an element or attribute node of a XML template definition
+ * The name data is the UTF-16 little-endian string stored after the name header
+ * and the name hash is the hash stored in the name header
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_template_definition_get_node_name(
+     libfwevt_xml_template_definition_t *template_definition,
+     libfwevt_xml_template_node_t *node,
+     const uint8_t **name_data,
+     size_t *name_data_size,
+     uint16_t *name_hash,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfwevt_xml_template_definition_get_node_name";
+	uint32_t name_header_size = 4;
+
+	if( template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name data.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( template_definition->flags & LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS ) != 0 )
+	{
+		name_header_size += 4;
+	}
+	if( ( node->data_size <= name_header_size )
+	 || ( (size_t) node->data_offset > template_definition->names_data_size )
+	 || ( (size_t) node->data_size > ( template_definition->names_data_size - node->data_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid node - name data value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( template_definition->names_data[ node->data_offset + name_header_size - 4 ] ),
+	 *name_hash );
+
+	*name_data      = &( template_definition->names_data[ node->data_offset + name_header_size ] );
+	*name_data_size = (size_t) ( node->data_size - name_header_size );
+
+	return( 1 );
+}
+
+/* Determines if a XML template definition matches the definition in the binary data
+ * Names that are stored outside the definition are compared as well
+ * Returns 1 if the definition matches, 0 if not or -1 on error
+ */
+int libfwevt_xml_template_definition_matches_data(
+     libfwevt_xml_template_definition_t *template_definition,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     uint32_t offset,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_template_node_t *node = NULL;
+	static char *function              = "libfwevt_xml_template_definition_matches_data";
+	int node_index                     = 0;
+
+	if( template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( binary_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( template_definition->offset != offset )
+	 || ( template_definition->flags != ( flags & LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS ) )
+	 || ( template_definition->binary_data_size != binary_data_size )
+	 || ( template_definition->data == NULL ) )
+	{
+		return( 0 );
+	}
+	if( template_definition->data_size > ( binary_data_size - offset ) )
+	{
+		return( 0 );
+	}
+	if( memory_compare(
+	     template_definition->data,
+	     &( binary_data[ offset ] ),
+	     template_definition->data_size ) != 0 )
+	{
+		return( 0 );
+	}
+	for( node_index = 0;
+	     node_index < template_definition->number_of_nodes;
+	     node_index++ )
+	{
+		node = &( template_definition->nodes[ node_index ] );
+
+		if( ( node->type != LIBFWEVT_XML_TEMPLATE_NODE_TYPE_ELEMENT )
+		 && ( node->type != LIBFWEVT_XML_TEMPLATE_NODE_TYPE_ATTRIBUTE ) )
+		{
+			continue;
+		}
+		if( ( node->name_offset >= offset )
+		 && ( (size_t) ( node->name_offset - offset ) < template_definition->data_size ) )
+		{
+			continue;
+		}
+		if( ( (size_t) node->name_offset > binary_data_size )
+		 || ( (size_t) node->data_size > ( binary_data_size - node->name_offset ) ) )
+		{
+			return( 0 );
+		}
+		if( memory_compare(
+		     &( template_definition->names_data[ node->data_offset ] ),
+		     &( binary_data[ node->name_offset ] ),
+		     (size_t) node->data_size ) != 0 )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+
+/* Retrieves the XML template program of a XML template definition
+ * The program is compiled on first use
+ * Returns 1 if successful, 0 if the definition is not supported by a XML template program or -1 on error
+ */
+int libfwevt_xml_template_definition_get_program(
+     libfwevt_xml_template_definition_t *template_definition,
+     struct libfwevt_xml_template_program **program,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_template_program_t *safe_program = NULL;
+	static char *function                         = "libfwevt_xml_template_definition_get_program";
+	int result                                    = 0;
+
+	if( template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( program == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid program.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_definition->program_is_unsupported != 0 )
+	{
+		return( 0 );
+	}
+	if( template_definition->program == NULL )
+	{
+		if( libfwevt_xml_template_program_initialize(
+		     &safe_program,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create program.",
+			 function );
+
+			goto on_error;
+		}
+		result = libfwevt_xml_template_program_compile(
+		          safe_program,
+		          template_definition,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compile program.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			template_definition->program_is_unsupported = 1;
+
+			if( libfwevt_xml_template_program_free(
+			     &safe_program,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free program.",
+				 function );
+
+				goto on_error;
+			}
+			return( 0 );
+		}
+		template_definition->program = safe_program;
+	}
+	*program = template_definition->program;
+
+	return( 1 );
+
+on_error:
+	if( safe_program != NULL )
+	{
+		libfwevt_xml_template_program_free(
+		 &safe_program,
+		 NULL );
+	}
+	return( -1 );
+}
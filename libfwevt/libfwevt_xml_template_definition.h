@@ -0,0 +1,205 @@
+/*
+ * XML template definition functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWEVT_XML_TEMPLATE_DEFINITION_H )
+#define _LIBFWEVT_XML_TEMPLATE_DEFINITION_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwevt_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfwevt_xml_template_node libfwevt_xml_template_node_t;
+
+struct libfwevt_xml_template_node
+{
+	/* The type
+	 */
+	uint8_t type;
+
+	/* The binary XML token type
+	 */
+	uint8_t token_type;
+
+	/* The template value type
+	 * Only used by substitution nodes
+	 */
+	uint8_t value_type;
+
+	/* The template value index
+	 * Only used by substitution nodes
+	 */
+	uint16_t value_index;
+
+	/* The data offset
+	 * Contains the offset of the token relative to the start of the definition
+	 * for literal nodes or the offset of the name in the names data for element
+	 * and attribute nodes
+	 */
+	uint32_t data_offset;
+
+	/* The data size
+	 * Contains the size of the name in the names data for element and attribute nodes
+	 */
+	uint32_t data_size;
+
+	/* The name offset
+	 * Contains the offset of the name in the binary data for element and attribute nodes
+	 */
+	uint32_t name_offset;
+
+	/* The index of the end element node
+	 * Only used by element nodes
+	 */
+	int end_node_index;
+};
+
+typedef struct libfwevt_xml_template_definition libfwevt_xml_template_definition_t;
+
+struct libfwevt_xml_template_definition
+{
+	/* The identifier
+	 * Contains a GUID
+	 */
+	uint8_t identifier[ 16 ];
+
+	/* The offset of the definition in the binary data
+	 */
+	uint32_t offset;
+
+	/* The read flags
+	 * Only contains the read flags that affect how the definition is parsed
+	 */
+	uint8_t flags;
+
+	/* The size of the binary data the definition was read from
+	 */
+	size_t binary_data_size;
+
+	/* The data
+	 * Contains a copy of the definition from the header up to and including
+	 * the end of file token
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The names data
+	 * Contains copies of the element and attribute names including their header
+	 */
+	uint8_t *names_data;
+
+	/* The names data size
+	 */
+	size_t names_data_size;
+
+	/* The allocated names data size
+	 */
+	size_t allocated_names_data_size;
+
+	/* The nodes
+	 * Contains the element tree of the definition in document order
+	 */
+	libfwevt_xml_template_node_t *nodes;
+
+	/* The number of nodes
+	 */
+	int number_of_nodes;
+
+	/* The number of allocated nodes
+	 */
+	int number_of_allocated_nodes;
+
+	/* The XML template program
+	 * Compiled on first use
+	 */
+	struct libfwevt_xml_template_program *program;
+
+	/* Value to indicate the definition cannot be compiled into a XML template program
+	 */
+	uint8_t program_is_unsupported;
+};
+
+int libfwevt_xml_template_definition_initialize(
+     libfwevt_xml_template_definition_t **template_definition,
+     uint32_t offset,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+int libfwevt_xml_template_definition_free(
+     libfwevt_xml_template_definition_t **template_definition,
+     libcerror_error_t **error );
+
+int libfwevt_xml_template_definition_set_data(
+     libfwevt_xml_template_definition_t *template_definition,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfwevt_xml_template_definition_append_node(
+     libfwevt_xml_template_definition_t *template_definition,
+     uint8_t type,
+     int *node_index,
+     libcerror_error_t **error );
+
+int libfwevt_xml_template_definition_set_node_name(
+     libfwevt_xml_template_definition_t *template_definition,
+     int node_index,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     uint32_t name_offset,
+     uint32_t name_size,
+     libcerror_error_t **error );
+
+int libfwevt_xml_template_definition_get_node_name(
+     libfwevt_xml_template_definition_t *template_definition,
+     libfwevt_xml_template_node_t *node,
+     const uint8_t **name_data,
+     size_t *name_data_size,
+     uint16_t *name_hash,
+     libcerror_error_t **error );
+
+int libfwevt_xml_template_definition_matches_data(
+     libfwevt_xml_template_definition_t *template_definition,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     uint32_t offset,
+     uint8_t flags,
+     libcerror_error_t **error );
+
+int libfwevt_xml_template_definition_get_program(
+     libfwevt_xml_template_definition_t *template_definition,
+     struct libfwevt_xml_template_program **program,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWEVT_XML_TEMPLATE_DEFINITION_H ) */
+
@@ -0,0 +1,3117 @@
+/*
+ * XML template program functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwevt_data_segment.h"
+#include "libfwevt_definitions.h"
+#include "libfwevt_libcdata.h"
+#include "libfwevt_libcerror.h"
+#include "libfwevt_libuna.h"
+#include "libfwevt_xml_string.h"
+#include "libfwevt_xml_template_definition.h"
+#include "libfwevt_xml_template_program.h"
+#include "libfwevt_xml_template_value.h"
+#include "libfwevt_xml_value.h"
+
+/* The initial number of allocated instructions of a XML template program
+ */
+#define LIBFWEVT_XML_TEMPLATE_PROGRAM_INITIAL_NUMBER_OF_INSTRUCTIONS	32
+
+/* The initial allocated data size of a XML template program
+ */
+#define LIBFWEVT_XML_TEMPLATE_PROGRAM_INITIAL_DATA_SIZE			512
+
+/* Creates a XML template program
+ * Make sure the value program is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_template_program_initialize(
+     libfwevt_xml_template_program_t **program,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_xml_template_program_initialize";
+
+	if( program == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid program.",
+		 function );
+
+		return( -1 );
+	}
+	if( *program != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid program value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*program = memory_allocate_structure(
+	            libfwevt_xml_template_program_t );
+
+	if( *program == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create program.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *program,
+	     0,
+	     sizeof( libfwevt_xml_template_program_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear program.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *program != NULL )
+	{
+		memory_free(
+		 *program );
+
+		*program = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a XML template program
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_template_program_free(
+     libfwevt_xml_template_program_t **program,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_xml_template_program_free";
+
+	if( program == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid program.",
+		 function );
+
+		return( -1 );
+	}
+	if( *program != NULL )
+	{
+		if( ( *program )->instructions != NULL )
+		{
+			memory_free(
+			 ( *program )->instructions );
+		}
+		if( ( *program )->data != NULL )
+		{
+			memory_free(
+			 ( *program )->data );
+		}
+		memory_free(
+		 *program );
+
+		*program = NULL;
+	}
+	return( 1 );
+}
+
+/* Appends an instruction to a XML template program
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_template_program_append_instruction(
+     libfwevt_xml_template_program_t *program,
+     uint8_t opcode,
+     int element_depth,
+     int *instruction_index,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_template_program_instruction_t *instructions = NULL;
+	static char *function                                     = "libfwevt_xml_template_program_append_instruction";
+	size_t instructions_size                                  = 0;
+	int number_of_allocated_instructions                      = 0;
+
+	if( program == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid program.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( element_depth < 0 )
+	 || ( element_depth >= LIBFWEVT_XML_TEMPLATE_PROGRAM_MAXIMUM_ELEMENT_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid element depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( instruction_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid instruction index.",
+		 function );
+
+		return( -1 );
+	}
+	if( program->number_of_instructions >= program->number_of_allocated_instructions )
+	{
+		if( program->number_of_allocated_instructions == 0 )
+		{
+			number_of_allocated_instructions = LIBFWEVT_XML_TEMPLATE_PROGRAM_INITIAL_NUMBER_OF_INSTRUCTIONS;
+		}
+		else
+		{
+			if( program->number_of_allocated_instructions > ( INT_MAX / 2 ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid number of allocated instructions value out of bounds.",
+				 function );
+
+				return( -1 );
+			}
+			number_of_allocated_instructions = program->number_of_allocated_instructions * 2;
+		}
+		instructions_size = sizeof( libfwevt_xml_template_program_instruction_t ) * number_of_allocated_instructions;
+
+		if( instructions_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid instructions size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		instructions = (libfwevt_xml_template_program_instruction_t *) memory_reallocate(
+		                                                                program->instructions,
+		                                                                instructions_size );
+
+		if( instructions == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize instructions.",
+			 function );
+
+			return( -1 );
+		}
+		program->instructions                     = instructions;
+		program->number_of_allocated_instructions = number_of_allocated_instructions;
+	}
+	*instruction_index = program->number_of_instructions;
+
+	if( memory_set(
+	     &( program->instructions[ *instruction_index ] ),
+	     0,
+	     sizeof( libfwevt_xml_template_program_instruction_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear instruction.",
+		 function );
+
+		return( -1 );
+	}
+	program->instructions[ *instruction_index ].opcode        = opcode;
+	program->instructions[ *instruction_index ].element_depth = (uint8_t) element_depth;
+
+	program->number_of_instructions += 1;
+
+	return( 1 );
+}
+
+/* Resizes the data of a XML template program
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_template_program_resize_data(
+     libfwevt_xml_template_program_t *program,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *data              = NULL;
+	static char *function      = "libfwevt_xml_template_program_resize_data";
+	size_t allocated_data_size = 0;
+
+	if( program == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid program.",
+		 function );
+
+		return( -1 );
+	}
+	/* The offsets in the instructions are 32-bit
+	 */
+	if( ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	 || ( data_size > (size_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size <= program->allocated_data_size )
+	{
+		return( 1 );
+	}
+	allocated_data_size = program->allocated_data_size;
+
+	if( allocated_data_size == 0 )
+	{
+		allocated_data_size = LIBFWEVT_XML_TEMPLATE_PROGRAM_INITIAL_DATA_SIZE;
+	}
+	while( allocated_data_size < data_size )
+	{
+		allocated_data_size *= 2;
+	}
+	if( allocated_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		allocated_data_size = (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE;
+	}
+	data = (uint8_t *) memory_reallocate(
+	                    program->data,
+	                    sizeof( uint8_t ) * allocated_data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to resize data.",
+		 function );
+
+		return( -1 );
+	}
+	program->data                = data;
+	program->allocated_data_size = allocated_data_size;
+
+	return( 1 );
+}
+
+/* Appends data to a XML template program
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_template_program_append_data(
+     libfwevt_xml_template_program_t *program,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *data_offset,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_xml_template_program_append_data";
+
+	if( program == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid program.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - program->data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_template_program_resize_data(
+	     program,
+	     program->data_size + data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size > 0 )
+	{
+		if( memory_copy(
+		     &( program->data[ program->data_size ] ),
+		     data,
+		     data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( data_offset != NULL )
+	{
+		*data_offset = (uint32_t) program->data_size;
+	}
+	program->data_size += data_size;
+
+	return( 1 );
+}
+
+/* Appends an UTF-16 little-endian stream formatted as UTF-8 to a XML template program
+ * The end-of-string character is not appended
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_template_program_append_utf16_stream(
+     libfwevt_xml_template_program_t *program,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint8_t escape_characters,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfwevt_xml_template_program_append_utf16_stream";
+	size_t utf8_string_size = 0;
+	size_t data_index       = 0;
+	int result              = 0;
+
+	if( program == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid program.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size == 0 )
+	{
+		return( 1 );
+	}
+	if( escape_characters == 0 )
+	{
+		result = libuna_utf8_string_size_from_utf16_stream(
+		          utf16_stream,
+		          utf16_stream_size,
+		          LIBUNA_ENDIAN_LITTLE,
+		          &utf8_string_size,
+		          error );
+	}
+	else
+	{
+		result = libfwevt_utf8_xml_string_size_from_utf16_stream(
+		          utf16_stream,
+		          utf16_stream_size,
+		          LIBUNA_ENDIAN_LITTLE,
+		          &utf8_string_size,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine size of UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - program->data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_template_program_resize_data(
+	     program,
+	     program->data_size + utf8_string_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize data.",
+		 function );
+
+		return( -1 );
+	}
+	data_index = program->data_size;
+
+	if( escape_characters == 0 )
+	{
+		result = libuna_utf8_string_with_index_copy_from_utf16_stream(
+		          program->data,
+		          program->data_size + utf8_string_size,
+		          &data_index,
+		          utf16_stream,
+		          utf16_stream_size,
+		          LIBUNA_ENDIAN_LITTLE,
+		          error );
+	}
+	else
+	{
+		result = libfwevt_utf8_xml_string_with_index_copy_from_utf16_stream(
+		          program->data,
+		          program->data_size + utf8_string_size,
+		          &data_index,
+		          utf16_stream,
+		          utf16_stream_size,
+		          LIBUNA_ENDIAN_LITTLE,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy UTF-16 stream to UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	/* The end-of-string character is overwritten by the next fragment
+	 */
+	if( data_index > program->data_size )
+	{
+		program->data_size = data_index - 1;
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the data of a template value type
+ * The size is 0 if the size of the value type is variable
+ * Returns 1 if successful, 0 if the value type is not supported by a XML template program or -1 on error
+ */
+int libfwevt_xml_template_program_get_value_data_size(
+     uint8_t value_type,
+     uint16_t *value_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_xml_template_program_get_value_data_size";
+
+	if( value_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Arrays are substituted as repeated elements and binary XML as a nested
+	 * document, which XML template programs handle separately
+	 */
+	switch( value_type )
+	{
+		case LIBFWEVT_VALUE_TYPE_STRING_UTF16:
+		case LIBFWEVT_VALUE_TYPE_STRING_BYTE_STREAM:
+		case LIBFWEVT_VALUE_TYPE_BINARY_DATA:
+		case LIBFWEVT_VALUE_TYPE_SIZE:
+		case LIBFWEVT_VALUE_TYPE_NT_SECURITY_IDENTIFIER:
+			*value_data_size = 0;
+			break;
+
+		case LIBFWEVT_VALUE_TYPE_INTEGER_8BIT:
+		case LIBFWEVT_VALUE_TYPE_UNSIGNED_INTEGER_8BIT:
+			*value_data_size = 1;
+			break;
+
+		case LIBFWEVT_VALUE_TYPE_INTEGER_16BIT:
+		case LIBFWEVT_VALUE_TYPE_UNSIGNED_INTEGER_16BIT:
+			*value_data_size = 2;
+			break;
+
+		case LIBFWEVT_VALUE_TYPE_INTEGER_32BIT:
+		case LIBFWEVT_VALUE_TYPE_UNSIGNED_INTEGER_32BIT:
+		case LIBFWEVT_VALUE_TYPE_HEXADECIMAL_INTEGER_32BIT:
+		case LIBFWEVT_VALUE_TYPE_FLOATING_POINT_32BIT:
+		case LIBFWEVT_VALUE_TYPE_BOOLEAN:
+			*value_data_size = 4;
+			break;
+
+		case LIBFWEVT_VALUE_TYPE_INTEGER_64BIT:
+		case LIBFWEVT_VALUE_TYPE_UNSIGNED_INTEGER_64BIT:
+		case LIBFWEVT_VALUE_TYPE_HEXADECIMAL_INTEGER_64BIT:
+		case LIBFWEVT_VALUE_TYPE_FLOATING_POINT_64BIT:
+		case LIBFWEVT_VALUE_TYPE_FILETIME:
+			*value_data_size = 8;
+			break;
+
+		case LIBFWEVT_VALUE_TYPE_GUID:
+		case LIBFWEVT_VALUE_TYPE_SYSTEMTIME:
+			*value_data_size = 16;
+			break;
+
+		default:
+			return( 0 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the UTF-16 little-endian string of a literal node of a XML template definition
+ * Returns 1 if successful, 0 if the literal is not supported by a XML template program or -1 on error
+ */
+int libfwevt_xml_template_program_get_literal_utf16_stream(
+     libfwevt_xml_template_definition_t *template_definition,
+     libfwevt_xml_template_node_t *node,
+     const uint8_t **utf16_stream,
+     size_t *utf16_stream_size,
+     libcerror_error_t **error )
+{
+	static char *function         = "libfwevt_xml_template_program_get_literal_utf16_stream";
+	size_t safe_utf16_stream_size = 0;
+
+	if( template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( node == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_stream_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 stream size.",
+		 function );
+
+		return( -1 );
+	}
+	/* Character data sections and character references are not supported
+	 */
+	if( ( node->token_type & 0xbf ) != LIBFWEVT_XML_TOKEN_VALUE )
+	{
+		return( 0 );
+	}
+	if( ( template_definition->data == NULL )
+	 || ( template_definition->data_size < 4 )
+	 || ( (size_t) node->data_offset > ( template_definition->data_size - 4 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid node - data offset value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_definition->data[ node->data_offset + 1 ] != LIBFWEVT_VALUE_TYPE_STRING_UTF16 )
+	{
+		return( 0 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( template_definition->data[ node->data_offset + 2 ] ),
+	 safe_utf16_stream_size );
+
+	safe_utf16_stream_size *= 2;
+
+	if( safe_utf16_stream_size > ( template_definition->data_size - ( node->data_offset + 4 ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid node - value data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*utf16_stream      = &( template_definition->data[ node->data_offset + 4 ] );
+	*utf16_stream_size = safe_utf16_stream_size;
+
+	return( 1 );
+}
+
+/* Compiles a XML template definition into a XML template program
+ * Returns 1 if successful, 0 if the template definition is not supported by a XML template program or -1 on error
+ */
+int libfwevt_xml_template_program_compile(
+     libfwevt_xml_template_program_t *program,
+     libfwevt_xml_template_definition_t *template_definition,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_xml_template_program_compile";
+	int node_index        = 0;
+	int result            = 0;
+
+	if( program == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid program.",
+		 function );
+
+		return( -1 );
+	}
+	if( program->number_of_instructions != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid program - instructions value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_definition->number_of_nodes == 0 )
+	{
+		return( 0 );
+	}
+	result = libfwevt_xml_template_program_compile_element(
+	          program,
+	          template_definition,
+	          &node_index,
+	          0,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compile element.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		if( node_index != template_definition->number_of_nodes )
+		{
+			result = 0;
+		}
+	}
+	return( result );
+}
+
+/* Compiles an element node of a XML template definition
+ *
+ * An element is compiled into a start element instruction, an instruction per attribute,
+ * the instructions of its content and an end element instruction. The XML string is
+ * formatted the same as libfwevt_xml_tag_get_utf8_xml_string_with_index, where the
+ * content of an element is either a single value or sub elements
+ *
+ * On return the node index refers to the node after the end element node
+ * Returns 1 if successful, 0 if the element is not supported by a XML template program or -1 on error
+ */
+int libfwevt_xml_template_program_compile_element(
+     libfwevt_xml_template_program_t *program,
+     libfwevt_xml_template_definition_t *template_definition,
+     int *node_index,
+     int element_depth,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_template_node_t *content_node     = NULL;
+	libfwevt_xml_template_node_t *node             = NULL;
+	const uint8_t *element_name_data               = NULL;
+	const uint8_t *name_data                       = NULL;
+	const uint8_t *utf16_stream                    = NULL;
+	static char *function                          = "libfwevt_xml_template_program_compile_element";
+	size_t element_name_data_size                  = 0;
+	size_t name_data_size                          = 0;
+	size_t utf16_stream_size                       = 0;
+	size_t utf8_string_size                        = 0;
+	uint32_t element_name_offset                   = 0;
+	uint32_t fragment_offset                       = 0;
+	uint32_t name_offset                           = 0;
+	uint16_t name_hash                             = 0;
+	uint16_t value_data_size                       = 0;
+	int content_instruction_index                  = -1;
+	int content_node_index                         = 0;
+	int element_node_index                         = 0;
+	int end_node_index                             = 0;
+	int instruction_index                          = 0;
+	int number_of_content_nodes                    = 0;
+	int number_of_sub_elements                     = 0;
+	int result                                     = 0;
+	int scan_node_index                            = 0;
+	int start_instruction_index                    = 0;
+
+	if( program == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid program.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid template definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node index.",
+		 function );
+
+		return( -1 );
+	}
+	element_node_index = *node_index;
+
+	if( ( element_node_index < 0 )
+	 || ( element_node_index >= template_definition->number_of_nodes )
+	 || ( template_definition->nodes[ element_node_index ].type != LIBFWEVT_XML_TEMPLATE_NODE_TYPE_ELEMENT ) )
+	{
+		return( 0 );
+	}
+	end_node_index = template_definition->nodes[ element_node_index ].end_node_index;
+
+	if( ( end_node_index <= element_node_index )
+	 || ( end_node_index >= template_definition->number_of_nodes ) )
+	{
+		return( 0 );
+	}
+	if( ( element_depth < 0 )
+	 || ( element_depth >= LIBFWEVT_XML_TEMPLATE_PROGRAM_MAXIMUM_ELEMENT_DEPTH ) )
+	{
+		return( 0 );
+	}
+	if( libfwevt_xml_template_definition_get_node_name(
+	     template_definition,
+	     &( template_definition->nodes[ element_node_index ] ),
+	     &element_name_data,
+	     &element_name_data_size,
+	     &name_hash,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve element name.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_template_program_append_data(
+	     program,
+	     element_name_data,
+	     element_name_data_size,
+	     &element_name_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append element name.",
+		 function );
+
+		return( -1 );
+	}
+	/* The start element fragment: <name
+	 * The indentation is added when the program is rendered
+	 */
+	fragment_offset = (uint32_t) program->data_size;
+
+	if( libfwevt_xml_template_program_append_data(
+	     program,
+	     (uint8_t *) "<",
+	     1,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append start element.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_template_program_append_utf16_stream(
+	     program,
+	     element_name_data,
+	     element_name_data_size,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append element name.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_template_program_append_instruction(
+	     program,
+	     LIBFWEVT_XML_TEMPLATE_PROGRAM_OPCODE_START_ELEMENT,
+	     element_depth,
+	     &start_instruction_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append start element instruction.",
+		 function );
+
+		return( -1 );
+	}
+	program->instructions[ start_instruction_index ].fragment_offset = fragment_offset;
+	program->instructions[ start_instruction_index ].fragment_size   = (uint32_t) program->data_size - fragment_offset;
+	program->instructions[ start_instruction_index ].name_offset     = element_name_offset;
+	program->instructions[ start_instruction_index ].name_size       = (uint32_t) element_name_data_size;
+
+	content_node_index = element_node_index + 1;
+
+	while( ( content_node_index < end_node_index )
+	    && ( template_definition->nodes[ content_node_index ].type == LIBFWEVT_XML_TEMPLATE_NODE_TYPE_ATTRIBUTE ) )
+	{
+		if( ( content_node_index + 1 ) >= end_node_index )
+		{
+			return( 0 );
+		}
+		content_node = &( template_definition->nodes[ content_node_index + 1 ] );
+
+		if( libfwevt_xml_template_definition_get_node_name(
+		     template_definition,
+		     &( template_definition->nodes[ content_node_index ] ),
+		     &name_data,
+		     &name_data_size,
+		     &name_hash,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve attribute name.",
+			 function );
+
+			return( -1 );
+		}
+		if( content_node->type == LIBFWEVT_XML_TEMPLATE_NODE_TYPE_LITERAL )
+		{
+			result = libfwevt_xml_template_program_get_literal_utf16_stream(
+			          template_definition,
+			          content_node,
+			          &utf16_stream,
+			          &utf16_stream_size,
+			          error );
+
+			if( result != 1 )
+			{
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve attribute literal.",
+					 function );
+				}
+				return( result );
+			}
+			/* An empty or single linefeed literal attribute value is formatted
+			 * inconsistently by the XML tag
+			 */
+			if( ( utf16_stream_size == 0 )
+			 || ( ( utf16_stream_size >= 2 )
+			  &&  ( utf16_stream[ 0 ] == (uint8_t) '\n' )
+			  &&  ( utf16_stream[ 1 ] == 0 ) ) )
+			{
+				return( 0 );
+			}
+		}
+		else if( content_node->type == LIBFWEVT_XML_TEMPLATE_NODE_TYPE_SUBSTITUTION )
+		{
+			result = libfwevt_xml_template_program_get_value_data_size(
+			          content_node->value_type,
+			          &value_data_size,
+			          error );
+
+			if( result != 1 )
+			{
+				return( result );
+			}
+		}
+		else
+		{
+			return( 0 );
+		}
+		if( libfwevt_xml_template_program_append_data(
+		     program,
+		     name_data,
+		     name_data_size,
+		     &name_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append attribute name.",
+			 function );
+
+			return( -1 );
+		}
+		/* The attribute fragment: name="value" or name=" for a substitution
+		 */
+		fragment_offset = (uint32_t) program->data_size;
+
+		if( libfwevt_xml_template_program_append_data(
+		     program,
+		     (uint8_t *) " ",
+		     1,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append attribute.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwevt_xml_template_program_append_utf16_stream(
+		     program,
+		     name_data,
+		     name_data_size,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append attribute name.",
+			 function );
+
+			return( -1 );
+		}
+		if( libfwevt_xml_template_program_append_data(
+		     program,
+		     (uint8_t *) "=\"",
+		     2,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append attribute.",
+			 function );
+
+			return( -1 );
+		}
+		if( content_node->type == LIBFWEVT_XML_TEMPLATE_NODE_TYPE_LITERAL )
+		{
+			if( libfwevt_xml_template_program_append_utf16_stream(
+			     program,
+			     utf16_stream,
+			     utf16_stream_size,
+			     1,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append attribute value.",
+				 function );
+
+				return( -1 );
+			}
+			if( libfwevt_xml_template_program_append_data(
+			     program,
+			     (uint8_t *) "\"",
+			     1,
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append attribute.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( libfwevt_xml_template_program_append_instruction(
+		     program,
+		     ( content_node->type == LIBFWEVT_XML_TEMPLATE_NODE_TYPE_LITERAL ) ? LIBFWEVT_XML_TEMPLATE_PROGRAM_OPCODE_ATTRIBUTE : LIBFWEVT_XML_TEMPLATE_PROGRAM_OPCODE_SUBSTITUTE_ATTRIBUTE,
+		     element_depth,
+		     &instruction_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append attribute instruction.",
+			 function );
+
+			return( -1 );
+		}
+		program->instructions[ instruction_index ].fragment_offset = fragment_offset;
+		program->instructions[ instruction_index ].fragment_size   = (uint32_t) program->data_size - fragment_offset;
+		program->instructions[ instruction_index ].name_offset     = name_offset;
+		program->instructions[ instruction_index ].name_size       = (uint32_t) name_data_size;
+
+		if( content_node->type == LIBFWEVT_XML_TEMPLATE_NODE_TYPE_SUBSTITUTION )
+		{
+			program->instructions[ instruction_index ].token_type  = content_node->token_type;
+			program->instructions[ instruction_index ].value_type  = content_node->value_type;
+			program->instructions[ instruction_index ].value_index = content_node->value_index;
+		}
+		content_node_index += 2;
+	}
+	/* The content of an element is either a single literal or substitution or sub elements,
+	 * where a binary XML substitution provides sub elements
+	 */
+	scan_node_index = content_node_index;
+
+	while( scan_node_index < end_node_index )
+	{
+		node = &( template_definition->nodes[ scan_node_index ] );
+
+		if( node->type == LIBFWEVT_XML_TEMPLATE_NODE_TYPE_ELEMENT )
+		{
+			if( ( node->end_node_index <= scan_node_index )
+			 || ( node->end_node_index >= end_node_index ) )
+			{
+				return( 0 );
+			}
+			number_of_sub_elements++;
+
+			scan_node_index = node->end_node_index + 1;
+		}
+		else if( ( node->type == LIBFWEVT_XML_TEMPLATE_NODE_TYPE_SUBSTITUTION )
+		      && ( node->value_type == LIBFWEVT_VALUE_TYPE_BINARY_XML ) )
+		{
+			number_of_sub_elements++;
+
+			scan_node_index++;
+		}
+		else if( ( node->type == LIBFWEVT_XML_TEMPLATE_NODE_TYPE_LITERAL )
+		      || ( node->type == LIBFWEVT_XML_TEMPLATE_NODE_TYPE_SUBSTITUTION ) )
+		{
+			number_of_content_nodes++;
+
+			scan_node_index++;
+		}
+		else
+		{
+			return( 0 );
+		}
+	}
+	if( number_of_content_nodes > 0 )
+	{
+		if( ( number_of_content_nodes != 1 )
+		 || ( number_of_sub_elements != 0 ) )
+		{
+			return( 0 );
+		}
+		content_node = &( template_definition->nodes[ content_node_index ] );
+
+		fragment_offset = (uint32_t) program->data_size;
+
+		if( content_node->type == LIBFWEVT_XML_TEMPLATE_NODE_TYPE_LITERAL )
+		{
+			result = libfwevt_xml_template_program_get_literal_utf16_stream(
+			          template_definition,
+			          content_node,
+			          &utf16_stream,
+			          &utf16_stream_size,
+			          error );
+
+			if( result != 1 )
+			{
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve element literal.",
+					 function );
+				}
+				return( result );
+			}
+			utf8_string_size = 0;
+
+			if( utf16_stream_size > 0 )
+			{
+				if( libfwevt_utf8_xml_string_size_from_utf16_stream(
+				     utf16_stream,
+				     utf16_stream_size,
+				     LIBUNA_ENDIAN_LITTLE,
+				     &utf8_string_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to determine size of UTF-8 string of element literal.",
+					 function );
+
+					return( -1 );
+				}
+			}
+			/* A value that consists of a single linefeed is considered empty
+			 */
+			if( ( utf8_string_size == 2 )
+			 && ( utf16_stream[ 0 ] == (uint8_t) '\n' )
+			 && ( utf16_stream[ 1 ] == 0 ) )
+			{
+				utf8_string_size = 0;
+			}
+			/* The content fragment: >value</name or / for an empty value
+			 */
+			if( utf8_string_size <= 1 )
+			{
+				result = libfwevt_xml_template_program_append_data(
+				          program,
+				          (uint8_t *) "/",
+				          1,
+				          NULL,
+				          error );
+			}
+			else
+			{
+				result = libfwevt_xml_template_program_append_data(
+				          program,
+				          (uint8_t *) ">",
+				          1,
+				          NULL,
+				          error );
+
+				if( result == 1 )
+				{
+					result = libfwevt_xml_template_program_append_utf16_stream(
+					          program,
+					          utf16_stream,
+					          utf16_stream_size,
+					          1,
+					          error );
+				}
+				if( result == 1 )
+				{
+					result = libfwevt_xml_template_program_append_data(
+					          program,
+					          (uint8_t *) "</",
+					          2,
+					          NULL,
+					          error );
+				}
+				if( result == 1 )
+				{
+					result = libfwevt_xml_template_program_append_utf16_stream(
+					          program,
+					          element_name_data,
+					          element_name_data_size,
+					          0,
+					          error );
+				}
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append element content.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		else
+		{
+			/* The elements of an array value are substituted as separate elements
+			 */
+			result = libfwevt_xml_template_program_get_value_data_size(
+			          content_node->value_type & 0x7f,
+			          &value_data_size,
+			          error );
+
+			if( result != 1 )
+			{
+				return( result );
+			}
+			/* The substitute content fragment: </name
+			 */
+			if( libfwevt_xml_template_program_append_data(
+			     program,
+			     (uint8_t *) "</",
+			     2,
+			     NULL,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append element content.",
+				 function );
+
+				return( -1 );
+			}
+			if( libfwevt_xml_template_program_append_utf16_stream(
+			     program,
+			     element_name_data,
+			     element_name_data_size,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append element name.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( libfwevt_xml_template_program_append_instruction(
+		     program,
+		     ( content_node->type == LIBFWEVT_XML_TEMPLATE_NODE_TYPE_LITERAL ) ? LIBFWEVT_XML_TEMPLATE_PROGRAM_OPCODE_CONTENT : LIBFWEVT_XML_TEMPLATE_PROGRAM_OPCODE_SUBSTITUTE_CONTENT,
+		     element_depth,
+		     &content_instruction_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append content instruction.",
+			 function );
+
+			return( -1 );
+		}
+		program->instructions[ content_instruction_index ].fragment_offset = fragment_offset;
+		program->instructions[ content_instruction_index ].fragment_size   = (uint32_t) program->data_size - fragment_offset;
+		program->instructions[ content_instruction_index ].name_offset     = element_name_offset;
+		program->instructions[ content_instruction_index ].name_size       = (uint32_t) element_name_data_size;
+
+		if( content_node->type == LIBFWEVT_XML_TEMPLATE_NODE_TYPE_SUBSTITUTION )
+		{
+			program->instructions[ content_instruction_index ].token_type  = content_node->token_type;
+			program->instructions[ content_instruction_index ].value_type  = content_node->value_type;
+			program->instructions[ content_instruction_index ].value_index = content_node->value_index;
+		}
+		else
+		{
+			content_instruction_index = -1;
+		}
+	}
+	else
+	{
+		while( content_node_index < end_node_index )
+		{
+			content_node = &( template_definition->nodes[ content_node_index ] );
+
+			if( content_node->type == LIBFWEVT_XML_TEMPLATE_NODE_TYPE_SUBSTITUTION )
+			{
+				if( libfwevt_xml_template_program_append_instruction(
+				     program,
+				     LIBFWEVT_XML_TEMPLATE_PROGRAM_OPCODE_SUBSTITUTE_BINARY_XML,
+				     element_depth,
+				     &instruction_index,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+					 "%s: unable to append binary XML instruction.",
+					 function );
+
+					return( -1 );
+				}
+				program->instructions[ instruction_index ].fragment_offset = (uint32_t) program->data_size;
+				program->instructions[ instruction_index ].name_offset     = element_name_offset;
+				program->instructions[ instruction_index ].name_size       = (uint32_t) element_name_data_size;
+				program->instructions[ instruction_index ].token_type      = content_node->token_type;
+				program->instructions[ instruction_index ].value_type      = content_node->value_type;
+				program->instructions[ instruction_index ].value_index     = content_node->value_index;
+
+				content_node_index++;
+
+				continue;
+			}
+			result = libfwevt_xml_template_program_compile_element(
+			          program,
+			          template_definition,
+			          &content_node_index,
+			          element_depth + 1,
+			          error );
+
+			if( result != 1 )
+			{
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to compile sub element.",
+					 function );
+				}
+				return( result );
+			}
+		}
+	}
+	/* The end element fragment: </name> used if the element has sub elements
+	 */
+	fragment_offset = (uint32_t) program->data_size;
+
+	result = libfwevt_xml_template_program_append_data(
+	          program,
+	          (uint8_t *) "</",
+	          2,
+	          NULL,
+	          error );
+
+	if( result == 1 )
+	{
+		result = libfwevt_xml_template_program_append_utf16_stream(
+		          program,
+		          element_name_data,
+		          element_name_data_size,
+		          0,
+		          error );
+	}
+	if( result == 1 )
+	{
+		result = libfwevt_xml_template_program_append_data(
+		          program,
+		          (uint8_t *) ">\n",
+		          2,
+		          NULL,
+		          error );
+	}
+	if( result != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append end element.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_template_program_append_instruction(
+	     program,
+	     LIBFWEVT_XML_TEMPLATE_PROGRAM_OPCODE_END_ELEMENT,
+	     element_depth,
+	     &instruction_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append end element instruction.",
+		 function );
+
+		return( -1 );
+	}
+	program->instructions[ instruction_index ].fragment_offset = fragment_offset;
+	program->instructions[ instruction_index ].fragment_size   = (uint32_t) program->data_size - fragment_offset;
+	program->instructions[ instruction_index ].name_offset     = element_name_offset;
+	program->instructions[ instruction_index ].name_size       = (uint32_t) element_name_data_size;
+
+	program->instructions[ start_instruction_index ].end_instruction_index = instruction_index + 1;
+
+	if( content_instruction_index != -1 )
+	{
+		program->instructions[ content_instruction_index ].end_instruction_index = instruction_index + 1;
+	}
+	*node_index = end_node_index + 1;
+
+	return( 1 );
+}
+
+/* Copies data to an UTF-8 string
+ * If the UTF-8 string is NULL only the UTF-8 string index is advanced
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_template_program_copy_data_to_utf8_string_with_index(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_xml_template_program_copy_data_to_utf8_string_with_index";
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string != NULL )
+	{
+		if( ( *utf8_string_index > utf8_string_size )
+		 || ( data_size > ( utf8_string_size - *utf8_string_index ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string size too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( data_size > 0 )
+		{
+			if( memory_copy(
+			     &( utf8_string[ *utf8_string_index ] ),
+			     data,
+			     data_size ) == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+				 "%s: unable to copy data to UTF-8 string.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	*utf8_string_index += data_size;
+
+	return( 1 );
+}
+
+/* Copies the indentation of an element to an UTF-8 string
+ * If the UTF-8 string is NULL only the UTF-8 string index is advanced
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_template_program_copy_indentation_to_utf8_string_with_index(
+     int element_depth,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error )
+{
+	static char *function   = "libfwevt_xml_template_program_copy_indentation_to_utf8_string_with_index";
+	size_t indentation_size = 0;
+
+	if( element_depth < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid element depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string index.",
+		 function );
+
+		return( -1 );
+	}
+	indentation_size = (size_t) element_depth * 2;
+
+	if( utf8_string != NULL )
+	{
+		if( ( *utf8_string_index > utf8_string_size )
+		 || ( indentation_size > ( utf8_string_size - *utf8_string_index ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string size too small.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_set(
+		     &( utf8_string[ *utf8_string_index ] ),
+		     (uint8_t) ' ',
+		     indentation_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to set indentation in UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	*utf8_string_index += indentation_size;
+
+	return( 1 );
+}
+
+/* Retrieves a template value
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_template_program_get_template_value(
+     libcdata_array_t *template_values_array,
+     uint16_t template_value_index,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     uint8_t *value_type,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error )
+{
+	libfwevt_xml_template_value_t *template_value = NULL;
+	static char *function                         = "libfwevt_xml_template_program_get_template_value";
+	size_t template_value_offset                  = 0;
+	uint16_t template_value_size                  = 0;
+	uint8_t template_value_flags                  = 0;
+	uint8_t template_value_type                   = 0;
+
+	if( binary_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary data.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     template_values_array,
+	     (int) template_value_index,
+	     (intptr_t **) &template_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve template value: %" PRIu16 " from array.",
+		 function,
+		 template_value_index );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_template_value_get_flags(
+	     template_value,
+	     &template_value_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve template value flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( template_value_flags & LIBFWEVT_XML_TEMPLATE_VALUE_FLAG_IS_DEFINITION ) != 0 )
+	{
+		template_value_type = LIBFWEVT_VALUE_TYPE_STRING_UTF16;
+	}
+	else if( libfwevt_xml_template_value_get_type(
+	          template_value,
+	          &template_value_type,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve template value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_template_value_get_offset(
+	     template_value,
+	     &template_value_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve template value data offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_template_value_get_size(
+	     template_value,
+	     &template_value_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve template value data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( template_value_offset > binary_data_size )
+	 || ( (size_t) template_value_size > ( binary_data_size - template_value_offset ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid template value: %" PRIu16 " data size value out of bounds.",
+		 function,
+		 template_value_index );
+
+		return( -1 );
+	}
+	*value_type      = template_value_type;
+	*value_data      = &( binary_data[ template_value_offset ] );
+	*value_data_size = (size_t) template_value_size;
+
+	return( 1 );
+}
+
+/* Retrieves the next element of an array template value
+ * The array value offset contains the offset of the element and is set to 0 after the last element,
+ * similar to the template value offset of libfwevt_xml_document_substitute_template_value
+ * Returns 1 if successful, 0 if the array value is not supported by a XML template program or -1 on error
+ */
+int libfwevt_xml_template_program_get_array_value_element(
+     uint8_t value_type,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     size_t *array_value_offset,
+     const uint8_t **element_data,
+     size_t *element_data_size,
+     libcerror_error_t **error )
+{
+	static char *function          = "libfwevt_xml_template_program_get_array_value_element";
+	size_t remaining_data_size     = 0;
+	size_t safe_array_value_offset = 0;
+	size_t safe_element_data_size  = 0;
+	uint16_t fixed_data_size       = 0;
+	int result                     = 0;
+
+	if( ( value_type & LIBFWEVT_VALUE_TYPE_ARRAY ) == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported value type: 0x%02" PRIx8 ".",
+		 function,
+		 value_type );
+
+		return( -1 );
+	}
+	if( ( value_data == NULL )
+	 && ( value_data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( array_value_offset == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid array value offset.",
+		 function );
+
+		return( -1 );
+	}
+	if( element_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid element data.",
+		 function );
+
+		return( -1 );
+	}
+	if( element_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid element data size.",
+		 function );
+
+		return( -1 );
+	}
+	safe_array_value_offset = *array_value_offset;
+
+	/* An empty array is substituted as an empty element
+	 */
+	if( value_data_size == 0 )
+	{
+		*element_data      = NULL;
+		*element_data_size = 0;
+
+		return( 1 );
+	}
+	if( safe_array_value_offset >= value_data_size )
+	{
+		return( 0 );
+	}
+	remaining_data_size = value_data_size - safe_array_value_offset;
+
+	switch( value_type & 0x7f )
+	{
+		case LIBFWEVT_VALUE_TYPE_STRING_BYTE_STREAM:
+			/* The element includes the end-of-string character
+			 */
+			while( safe_element_data_size < remaining_data_size )
+			{
+				safe_element_data_size += 1;
+
+				if( value_data[ safe_array_value_offset + safe_element_data_size - 1 ] == 0 )
+				{
+					break;
+				}
+			}
+			break;
+
+		case LIBFWEVT_VALUE_TYPE_STRING_UTF16:
+			if( ( remaining_data_size % 2 ) != 0 )
+			{
+				return( 0 );
+			}
+			/* The element includes the end-of-string character
+			 */
+			while( safe_element_data_size < remaining_data_size )
+			{
+				safe_element_data_size += 2;
+
+				if( ( value_data[ safe_array_value_offset + safe_element_data_size - 2 ] == 0 )
+				 && ( value_data[ safe_array_value_offset + safe_element_data_size - 1 ] == 0 ) )
+				{
+					break;
+				}
+			}
+			break;
+
+		case LIBFWEVT_VALUE_TYPE_BOOLEAN:
+			return( 0 );
+
+		default:
+			result = libfwevt_xml_template_program_get_value_data_size(
+			          value_type & 0x7f,
+			          &fixed_data_size,
+			          error );
+
+			if( result != 1 )
+			{
+				return( result );
+			}
+			if( ( fixed_data_size == 0 )
+			 || ( (size_t) fixed_data_size > remaining_data_size ) )
+			{
+				return( 0 );
+			}
+			safe_element_data_size = (size_t) fixed_data_size;
+
+			break;
+	}
+	*element_data      = &( value_data[ safe_array_value_offset ] );
+	*element_data_size = safe_element_data_size;
+
+	safe_array_value_offset += safe_element_data_size;
+
+	if( safe_array_value_offset == value_data_size )
+	{
+		safe_array_value_offset = 0;
+	}
+	*array_value_offset = safe_array_value_offset;
+
+	return( 1 );
+}
+
+/* Copies a template value formatted as an UTF-8 XML string
+ * The value is formatted the same as a XML value with escaped characters and
+ * without an end-of-string character. If the UTF-8 string is NULL only the
+ * UTF-8 string index is advanced
+ * Returns 1 if successful, 0 if the value is not supported by a XML template program or -1 on error
+ */
+int libfwevt_xml_template_program_copy_value_to_utf8_string_with_index(
+     uint8_t value_type,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     int ascii_codepage,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error )
+{
+	libfwevt_data_segment_t data_segment;
+	libfwevt_internal_xml_value_t internal_xml_value;
+
+	static char *function        = "libfwevt_xml_template_program_copy_value_to_utf8_string_with_index";
+	size_t safe_utf8_string_index = 0;
+	size_t value_string_size     = 0;
+	uint16_t fixed_data_size     = 0;
+	int result                   = 0;
+
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string index.",
+		 function );
+
+		return( -1 );
+	}
+	result = libfwevt_xml_template_program_get_value_data_size(
+	          value_type,
+	          &fixed_data_size,
+	          error );
+
+	if( result != 1 )
+	{
+		return( result );
+	}
+	/* Values that would fail to substitute are left to the XML document to report
+	 */
+	if( fixed_data_size != 0 )
+	{
+		if( value_data_size != (size_t) fixed_data_size )
+		{
+			return( 0 );
+		}
+	}
+	else if( value_type == LIBFWEVT_VALUE_TYPE_STRING_UTF16 )
+	{
+		if( ( value_data_size % 2 ) != 0 )
+		{
+			return( 0 );
+		}
+	}
+	else if( value_type == LIBFWEVT_VALUE_TYPE_SIZE )
+	{
+		if( ( value_data_size != 4 )
+		 && ( value_data_size != 8 ) )
+		{
+			return( 0 );
+		}
+	}
+	else if( value_type == LIBFWEVT_VALUE_TYPE_NT_SECURITY_IDENTIFIER )
+	{
+		if( value_data_size == 0 )
+		{
+			return( 0 );
+		}
+	}
+	if( value_data_size == 0 )
+	{
+		return( 1 );
+	}
+	if( memory_set(
+	     &data_segment,
+	     0,
+	     sizeof( libfwevt_data_segment_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data segment.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     &internal_xml_value,
+	     0,
+	     sizeof( libfwevt_internal_xml_value_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear XML value.",
+		 function );
+
+		return( -1 );
+	}
+	/* The data segment refers to the value data and is only used to format the value
+	 */
+	data_segment.data             = (uint8_t *) value_data;
+	data_segment.data_size        = value_data_size;
+	data_segment.data_is_borrowed = 1;
+
+	internal_xml_value.value_type = value_type;
+
+	if( libfwevt_data_segment_set_cached_value(
+	     &data_segment,
+	     value_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set cached value of data segment.",
+		 function );
+
+		goto on_error;
+	}
+	if( utf8_string == NULL )
+	{
+		result = libfwevt_internal_xml_value_get_data_segment_as_utf8_string_size(
+		          &internal_xml_value,
+		          0,
+		          &data_segment,
+		          &value_string_size,
+		          1,
+		          ascii_codepage,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve UTF-8 string size of value.",
+			 function );
+
+			goto on_error;
+		}
+		if( value_string_size > 0 )
+		{
+			value_string_size -= 1;
+		}
+	}
+	else
+	{
+		safe_utf8_string_index = *utf8_string_index;
+
+		result = libfwevt_internal_xml_value_get_data_segment_as_utf8_string(
+		          &internal_xml_value,
+		          0,
+		          &data_segment,
+		          utf8_string,
+		          utf8_string_size,
+		          &safe_utf8_string_index,
+		          1,
+		          ascii_codepage,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy value to UTF-8 string.",
+			 function );
+
+			goto on_error;
+		}
+		if( safe_utf8_string_index > *utf8_string_index )
+		{
+			value_string_size = safe_utf8_string_index - *utf8_string_index - 1;
+		}
+	}
+	if( libfwevt_data_segment_clear_cached_value(
+	     &data_segment,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to clear cached value of data segment.",
+		 function );
+
+		return( -1 );
+	}
+	/* A value that consists of a single linefeed is considered empty
+	 */
+	if( ( value_string_size == 1 )
+	 && ( value_data_size >= 2 )
+	 && ( value_data[ 0 ] == (uint8_t) '\n' )
+	 && ( value_data[ 1 ] == 0 ) )
+	{
+		value_string_size = 0;
+	}
+	*utf8_string_index += value_string_size;
+
+	return( 1 );
+
+on_error:
+	libfwevt_data_segment_clear_cached_value(
+	 &data_segment,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Renders a XML template program with the values of a template instance as an UTF-8 XML string
+ * The XML string is formatted the same as libfwevt_xml_tag_get_utf8_xml_string_with_index
+ * without the end-of-string character, where the elements are indented relative to the base
+ * element depth. The binary XML callback is called to render the elements of a binary XML
+ * value. If the UTF-8 string is NULL only the UTF-8 string index is advanced, which can be
+ * used to determine the size of the UTF-8 XML string
+ * Returns 1 if successful, 0 if the template instance is not supported by the XML template program or -1 on error
+ */
+int libfwevt_xml_template_program_render_utf8_xml_string(
+     libfwevt_xml_template_program_t *program,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     libcdata_array_t *template_values_array,
+     int ascii_codepage,
+     int base_element_depth,
+     int (*binary_xml_callback)(
+            void *callback_data,
+            size_t binary_data_offset,
+            size_t binary_data_size,
+            int element_depth,
+            uint8_t *utf8_string,
+            size_t utf8_string_size,
+            size_t *utf8_string_index,
+            libcerror_error_t **error ),
+     void *callback_data,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error )
+{
+	size_t array_value_offset[ LIBFWEVT_XML_TEMPLATE_PROGRAM_MAXIMUM_ELEMENT_DEPTH ];
+	size_t rollback_string_index[ LIBFWEVT_XML_TEMPLATE_PROGRAM_MAXIMUM_ELEMENT_DEPTH ];
+	int number_of_array_elements[ LIBFWEVT_XML_TEMPLATE_PROGRAM_MAXIMUM_ELEMENT_DEPTH ];
+	int start_instruction_index[ LIBFWEVT_XML_TEMPLATE_PROGRAM_MAXIMUM_ELEMENT_DEPTH ];
+	uint8_t has_content[ LIBFWEVT_XML_TEMPLATE_PROGRAM_MAXIMUM_ELEMENT_DEPTH ];
+	uint8_t has_elements[ LIBFWEVT_XML_TEMPLATE_PROGRAM_MAXIMUM_ELEMENT_DEPTH ];
+	uint8_t parent_has_elements[ LIBFWEVT_XML_TEMPLATE_PROGRAM_MAXIMUM_ELEMENT_DEPTH ];
+
+	libfwevt_xml_template_program_instruction_t *instruction = NULL;
+	const uint8_t *value_data                                = NULL;
+	static char *function                                    = "libfwevt_xml_template_program_render_utf8_xml_string";
+	size_t string_index                                      = 0;
+	size_t value_data_size                                   = 0;
+	size_t value_string_index                                = 0;
+	uint8_t value_type                                       = 0;
+	int element_depth                                        = 0;
+	int instruction_index                                    = 0;
+	int result                                               = 0;
+
+	if( program == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid program.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string index.",
+		 function );
+
+		return( -1 );
+	}
+	if( base_element_depth < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid base element depth value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( program->number_of_instructions == 0 )
+	{
+		return( 0 );
+	}
+	for( element_depth = 0;
+	     element_depth < LIBFWEVT_XML_TEMPLATE_PROGRAM_MAXIMUM_ELEMENT_DEPTH;
+	     element_depth++ )
+	{
+		array_value_offset[ element_depth ]       = 0;
+		number_of_array_elements[ element_depth ] = 0;
+	}
+	string_index = *utf8_string_index;
+
+	while( instruction_index < program->number_of_instructions )
+	{
+		instruction   = &( program->instructions[ instruction_index ] );
+		element_depth = (int) instruction->element_depth;
+
+		instruction_index++;
+
+		if( element_depth >= LIBFWEVT_XML_TEMPLATE_PROGRAM_MAXIMUM_ELEMENT_DEPTH )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid instruction - element depth value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( ( instruction->opcode == LIBFWEVT_XML_TEMPLATE_PROGRAM_OPCODE_SUBSTITUTE_ATTRIBUTE )
+		 || ( instruction->opcode == LIBFWEVT_XML_TEMPLATE_PROGRAM_OPCODE_SUBSTITUTE_CONTENT )
+		 || ( instruction->opcode == LIBFWEVT_XML_TEMPLATE_PROGRAM_OPCODE_SUBSTITUTE_BINARY_XML ) )
+		{
+			if( libfwevt_xml_template_program_get_template_value(
+			     template_values_array,
+			     instruction->value_index,
+			     binary_data,
+			     binary_data_size,
+			     &value_type,
+			     &value_data,
+			     &value_data_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve template value: %" PRIu16 ".",
+				 function,
+				 instruction->value_index );
+
+				return( -1 );
+			}
+			if( value_type == LIBFWEVT_VALUE_TYPE_NULL )
+			{
+				/* A missing value of a normal substitution is left to the XML document to report
+				 */
+				if( instruction->token_type == LIBFWEVT_XML_TOKEN_NORMAL_SUBSTITUTION )
+				{
+					return( 0 );
+				}
+				/* A missing optional attribute or binary XML value is omitted and a missing optional element is removed
+				 */
+				if( instruction->opcode == LIBFWEVT_XML_TEMPLATE_PROGRAM_OPCODE_SUBSTITUTE_CONTENT )
+				{
+					if( element_depth == 0 )
+					{
+						return( 0 );
+					}
+					string_index = rollback_string_index[ element_depth ];
+
+					has_elements[ element_depth - 1 ] = parent_has_elements[ element_depth ];
+
+					instruction_index = instruction->end_instruction_index;
+				}
+				continue;
+			}
+		}
+		switch( instruction->opcode )
+		{
+			case LIBFWEVT_XML_TEMPLATE_PROGRAM_OPCODE_START_ELEMENT:
+				rollback_string_index[ element_depth ]   = string_index;
+				start_instruction_index[ element_depth ] = instruction_index - 1;
+
+				if( element_depth > 0 )
+				{
+					parent_has_elements[ element_depth ] = has_elements[ element_depth - 1 ];
+
+					if( has_elements[ element_depth - 1 ] == 0 )
+					{
+						if( libfwevt_xml_template_program_copy_data_to_utf8_string_with_index(
+						     (uint8_t *) ">\n",
+						     2,
+						     utf8_string,
+						     utf8_string_size,
+						     &string_index,
+						     error ) != 1 )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+							 "%s: unable to copy start of element content to UTF-8 string.",
+							 function );
+
+							return( -1 );
+						}
+						has_elements[ element_depth - 1 ] = 1;
+					}
+				}
+				has_content[ element_depth ]  = 0;
+				has_elements[ element_depth ] = 0;
+
+				result = libfwevt_xml_template_program_copy_indentation_to_utf8_string_with_index(
+				          base_element_depth + element_depth,
+				          utf8_string,
+				          utf8_string_size,
+				          &string_index,
+				          error );
+
+				if( result == 1 )
+				{
+					result = libfwevt_xml_template_program_copy_data_to_utf8_string_with_index(
+					          &( program->data[ instruction->fragment_offset ] ),
+					          (size_t) instruction->fragment_size,
+					          utf8_string,
+					          utf8_string_size,
+					          &string_index,
+					          error );
+				}
+				break;
+
+			case LIBFWEVT_XML_TEMPLATE_PROGRAM_OPCODE_ATTRIBUTE:
+				result = libfwevt_xml_template_program_copy_data_to_utf8_string_with_index(
+				          &( program->data[ instruction->fragment_offset ] ),
+				          (size_t) instruction->fragment_size,
+				          utf8_string,
+				          utf8_string_size,
+				          &string_index,
+				          error );
+				break;
+
+			case LIBFWEVT_XML_TEMPLATE_PROGRAM_OPCODE_SUBSTITUTE_ATTRIBUTE:
+				result = libfwevt_xml_template_program_copy_data_to_utf8_string_with_index(
+				          &( program->data[ instruction->fragment_offset ] ),
+				          (size_t) instruction->fragment_size,
+				          utf8_string,
+				          utf8_string_size,
+				          &string_index,
+				          error );
+
+				if( result == 1 )
+				{
+					value_string_index = string_index;
+
+					result = libfwevt_xml_template_program_copy_value_to_utf8_string_with_index(
+					          value_type,
+					          value_data,
+					          value_data_size,
+					          ascii_codepage,
+					          utf8_string,
+					          utf8_string_size,
+					          &string_index,
+					          error );
+
+					/* An empty attribute value is formatted inconsistently by the XML tag
+					 */
+					if( ( result == 1 )
+					 && ( string_index == value_string_index ) )
+					{
+						result = 0;
+					}
+				}
+				if( result == 1 )
+				{
+					result = libfwevt_xml_template_program_copy_data_to_utf8_string_with_index(
+					          (uint8_t *) "\"",
+					          1,
+					          utf8_string,
+					          utf8_string_size,
+					          &string_index,
+					          error );
+				}
+				break;
+
+			case LIBFWEVT_XML_TEMPLATE_PROGRAM_OPCODE_CONTENT:
+				has_content[ element_depth ] = 1;
+
+				result = libfwevt_xml_template_program_copy_data_to_utf8_string_with_index(
+				          &( program->data[ instruction->fragment_offset ] ),
+				          (size_t) instruction->fragment_size,
+				          utf8_string,
+				          utf8_string_size,
+				          &string_index,
+				          error );
+				break;
+
+			case LIBFWEVT_XML_TEMPLATE_PROGRAM_OPCODE_SUBSTITUTE_CONTENT:
+				has_content[ element_depth ] = 1;
+
+				/* The element is repeated for every element of an array value
+				 */
+				if( ( value_type & LIBFWEVT_VALUE_TYPE_ARRAY ) != 0 )
+				{
+					result = libfwevt_xml_template_program_get_array_value_element(
+					          value_type,
+					          value_data,
+					          value_data_size,
+					          &( array_value_offset[ element_depth ] ),
+					          &value_data,
+					          &value_data_size,
+					          error );
+
+					if( result != 1 )
+					{
+						break;
+					}
+					value_type &= 0x7f;
+				}
+				result = libfwevt_xml_template_program_copy_data_to_utf8_string_with_index(
+				          (uint8_t *) ">",
+				          1,
+				          utf8_string,
+				          utf8_string_size,
+				          &string_index,
+				          error );
+
+				if( result == 1 )
+				{
+					value_string_index = string_index;
+
+					result = libfwevt_xml_template_program_copy_value_to_utf8_string_with_index(
+					          value_type,
+					          value_data,
+					          value_data_size,
+					          ascii_codepage,
+					          utf8_string,
+					          utf8_string_size,
+					          &string_index,
+					          error );
+				}
+				if( result == 1 )
+				{
+					if( string_index == value_string_index )
+					{
+						/* An empty value is formatted as an empty element
+						 */
+						string_index--;
+
+						result = libfwevt_xml_template_program_copy_data_to_utf8_string_with_index(
+						          (uint8_t *) "/",
+						          1,
+						          utf8_string,
+						          utf8_string_size,
+						          &string_index,
+						          error );
+					}
+					else
+					{
+						result = libfwevt_xml_template_program_copy_data_to_utf8_string_with_index(
+						          &( program->data[ instruction->fragment_offset ] ),
+						          (size_t) instruction->fragment_size,
+						          utf8_string,
+						          utf8_string_size,
+						          &string_index,
+						          error );
+					}
+				}
+				break;
+
+			case LIBFWEVT_XML_TEMPLATE_PROGRAM_OPCODE_END_ELEMENT:
+				if( has_content[ element_depth ] != 0 )
+				{
+					result = libfwevt_xml_template_program_copy_data_to_utf8_string_with_index(
+					          (uint8_t *) ">\n",
+					          2,
+					          utf8_string,
+					          utf8_string_size,
+					          &string_index,
+					          error );
+				}
+				else if( has_elements[ element_depth ] != 0 )
+				{
+					result = libfwevt_xml_template_program_copy_indentation_to_utf8_string_with_index(
+					          base_element_depth + element_depth,
+					          utf8_string,
+					          utf8_string_size,
+					          &string_index,
+					          error );
+
+					if( result == 1 )
+					{
+						result = libfwevt_xml_template_program_copy_data_to_utf8_string_with_index(
+						          &( program->data[ instruction->fragment_offset ] ),
+						          (size_t) instruction->fragment_size,
+						          utf8_string,
+						          utf8_string_size,
+						          &string_index,
+						          error );
+					}
+				}
+				else
+				{
+					result = libfwevt_xml_template_program_copy_data_to_utf8_string_with_index(
+					          (uint8_t *) "/>\n",
+					          3,
+					          utf8_string,
+					          utf8_string_size,
+					          &string_index,
+					          error );
+				}
+				if( array_value_offset[ element_depth ] == 0 )
+				{
+					number_of_array_elements[ element_depth ] = 0;
+				}
+				else if( result == 1 )
+				{
+					/* The XML document reports the array recursion error
+					 */
+					if( number_of_array_elements[ element_depth ] >= LIBFWEVT_XML_DOCUMENT_TEMPLATE_VALUE_ARRAY_RECURSION_DEPTH )
+					{
+						return( 0 );
+					}
+					number_of_array_elements[ element_depth ] += 1;
+
+					instruction_index = start_instruction_index[ element_depth ];
+				}
+				break;
+
+			case LIBFWEVT_XML_TEMPLATE_PROGRAM_OPCODE_SUBSTITUTE_BINARY_XML:
+				/* The elements of a binary XML value are rendered as sub elements
+				 */
+				if( ( binary_xml_callback == NULL )
+				 || ( value_type != LIBFWEVT_VALUE_TYPE_BINARY_XML )
+				 || ( value_data_size == 0 ) )
+				{
+					return( 0 );
+				}
+				if( ( value_data < binary_data )
+				 || ( (size_t) ( value_data - binary_data ) > binary_data_size )
+				 || ( value_data_size > ( binary_data_size - (size_t) ( value_data - binary_data ) ) ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid template value: %" PRIu16 " data value out of bounds.",
+					 function,
+					 instruction->value_index );
+
+					return( -1 );
+				}
+				result = 1;
+
+				if( has_elements[ element_depth ] == 0 )
+				{
+					result = libfwevt_xml_template_program_copy_data_to_utf8_string_with_index(
+					          (uint8_t *) ">\n",
+					          2,
+					          utf8_string,
+					          utf8_string_size,
+					          &string_index,
+					          error );
+
+					has_elements[ element_depth ] = 1;
+				}
+				if( result == 1 )
+				{
+					result = binary_xml_callback(
+					          callback_data,
+					          (size_t) ( value_data - binary_data ),
+					          (size_t) ( value_data - binary_data ) + value_data_size,
+					          base_element_depth + element_depth + 1,
+					          utf8_string,
+					          utf8_string_size,
+					          &string_index,
+					          error );
+				}
+				break;
+
+			default:
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported opcode: %" PRIu8 ".",
+				 function,
+				 instruction->opcode );
+
+				return( -1 );
+		}
+		if( result != 1 )
+		{
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+				 "%s: unable to copy instruction: %d to UTF-8 string.",
+				 function,
+				 instruction_index - 1 );
+			}
+			return( result );
+		}
+	}
+	*utf8_string_index = string_index;
+
+	return( 1 );
+}
+
+/* Extracts the substituted fields of a template instance using a XML template program
+ * The field callback is called for every substitution that has a value, with the name
+ * of the element and the name of the attribute or NULL for element content. The binary
+ * XML callback is called to extract the fields of a binary XML value
+ * Returns 1 if successful, 0 if the template instance is not supported by the XML template program or -1 on error
+ */
+int libfwevt_xml_template_program_extract_fields(
+     libfwevt_xml_template_program_t *program,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     libcdata_array_t *template_values_array,
+     int (*field_callback)(
+            const uint8_t *element_name_utf16_stream,
+            size_t element_name_utf16_stream_size,
+            const uint8_t *attribute_name_utf16_stream,
+            size_t attribute_name_utf16_stream_size,
+            uint16_t template_value_index,
+            uint8_t value_type,
+            const uint8_t *value_data,
+            size_t value_data_size,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     int (*binary_xml_callback)(
+            void *binary_xml_callback_data,
+            size_t binary_data_offset,
+            size_t binary_data_size,
+            libcerror_error_t **error ),
+     void *binary_xml_callback_data,
+     libcerror_error_t **error )
+{
+	uint32_t element_name_offset[ LIBFWEVT_XML_TEMPLATE_PROGRAM_MAXIMUM_ELEMENT_DEPTH ];
+	uint32_t element_name_size[ LIBFWEVT_XML_TEMPLATE_PROGRAM_MAXIMUM_ELEMENT_DEPTH ];
+
+	libfwevt_xml_template_program_instruction_t *instruction = NULL;
+	const uint8_t *attribute_name                            = NULL;
+	const uint8_t *value_data                                = NULL;
+	static char *function                                    = "libfwevt_xml_template_program_extract_fields";
+	size_t attribute_name_size                               = 0;
+	size_t value_data_size                                   = 0;
+	uint16_t fixed_data_size                                 = 0;
+	uint8_t value_type                                       = 0;
+	int content_instruction_index                            = 0;
+	int element_depth                                        = 0;
+	int instruction_index                                    = 0;
+	int result                                               = 0;
+
+	if( program == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid program.",
+		 function );
+
+		return( -1 );
+	}
+	if( field_callback == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid field callback.",
+		 function );
+
+		return( -1 );
+	}
+	if( program->number_of_instructions == 0 )
+	{
+		return( 0 );
+	}
+	/* The values are validated before the first callback so that the callback
+	 * is not called for a template instance that is not supported, except for
+	 * the template instances of binary XML values that are validated when extracted
+	 */
+	for( instruction_index = 0;
+	     instruction_index < program->number_of_instructions;
+	     instruction_index++ )
+	{
+		instruction = &( program->instructions[ instruction_index ] );
+
+		if( ( instruction->opcode != LIBFWEVT_XML_TEMPLATE_PROGRAM_OPCODE_SUBSTITUTE_ATTRIBUTE )
+		 && ( instruction->opcode != LIBFWEVT_XML_TEMPLATE_PROGRAM_OPCODE_SUBSTITUTE_CONTENT )
+		 && ( instruction->opcode != LIBFWEVT_XML_TEMPLATE_PROGRAM_OPCODE_SUBSTITUTE_BINARY_XML ) )
+		{
+			continue;
+		}
+		if( libfwevt_xml_template_program_get_template_value(
+		     template_values_array,
+		     instruction->value_index,
+		     binary_data,
+		     binary_data_size,
+		     &value_type,
+		     &value_data,
+		     &value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve template value: %" PRIu16 ".",
+			 function,
+			 instruction->value_index );
+
+			return( -1 );
+		}
+		if( value_type == LIBFWEVT_VALUE_TYPE_NULL )
+		{
+			if( instruction->token_type == LIBFWEVT_XML_TOKEN_NORMAL_SUBSTITUTION )
+			{
+				return( 0 );
+			}
+			continue;
+		}
+		if( instruction->opcode == LIBFWEVT_XML_TEMPLATE_PROGRAM_OPCODE_SUBSTITUTE_BINARY_XML )
+		{
+			if( ( binary_xml_callback == NULL )
+			 || ( value_type != LIBFWEVT_VALUE_TYPE_BINARY_XML )
+			 || ( value_data_size == 0 ) )
+			{
+				return( 0 );
+			}
+			if( ( value_data < binary_data )
+			 || ( (size_t) ( value_data - binary_data ) > binary_data_size )
+			 || ( value_data_size > ( binary_data_size - (size_t) ( value_data - binary_data ) ) ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid template value: %" PRIu16 " data value out of bounds.",
+				 function,
+				 instruction->value_index );
+
+				return( -1 );
+			}
+			continue;
+		}
+		/* An array value is passed to the field callback as a whole
+		 */
+		if( ( value_type & LIBFWEVT_VALUE_TYPE_ARRAY ) != 0 )
+		{
+			continue;
+		}
+		result = libfwevt_xml_template_program_get_value_data_size(
+		          value_type,
+		          &fixed_data_size,
+		          error );
+
+		if( result != 1 )
+		{
+			return( result );
+		}
+		if( ( fixed_data_size != 0 )
+		 && ( value_data_size != (size_t) fixed_data_size ) )
+		{
+			return( 0 );
+		}
+	}
+	instruction_index = 0;
+
+	while( instruction_index < program->number_of_instructions )
+	{
+		instruction   = &( program->instructions[ instruction_index ] );
+		element_depth = (int) instruction->element_depth;
+
+		instruction_index++;
+
+		if( element_depth >= LIBFWEVT_XML_TEMPLATE_PROGRAM_MAXIMUM_ELEMENT_DEPTH )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid instruction - element depth value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( instruction->opcode == LIBFWEVT_XML_TEMPLATE_PROGRAM_OPCODE_START_ELEMENT )
+		{
+			element_name_offset[ element_depth ] = instruction->name_offset;
+			element_name_size[ element_depth ]   = instruction->name_size;
+
+			/* The fields of an element without an optional value, including its attributes, are skipped
+			 */
+			content_instruction_index = instruction_index;
+
+			while( ( content_instruction_index < program->number_of_instructions )
+			    && ( ( program->instructions[ content_instruction_index ].opcode == LIBFWEVT_XML_TEMPLATE_PROGRAM_OPCODE_ATTRIBUTE )
+			     ||  ( program->instructions[ content_instruction_index ].opcode == LIBFWEVT_XML_TEMPLATE_PROGRAM_OPCODE_SUBSTITUTE_ATTRIBUTE ) ) )
+			{
+				content_instruction_index++;
+			}
+			if( ( content_instruction_index < program->number_of_instructions )
+			 && ( program->instructions[ content_instruction_index ].opcode == LIBFWEVT_XML_TEMPLATE_PROGRAM_OPCODE_SUBSTITUTE_CONTENT ) )
+			{
+				if( libfwevt_xml_template_program_get_template_value(
+				     template_values_array,
+				     program->instructions[ content_instruction_index ].value_index,
+				     binary_data,
+				     binary_data_size,
+				     &value_type,
+				     &value_data,
+				     &value_data_size,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve template value: %" PRIu16 ".",
+					 function,
+					 program->instructions[ content_instruction_index ].value_index );
+
+					return( -1 );
+				}
+				if( value_type == LIBFWEVT_VALUE_TYPE_NULL )
+				{
+					instruction_index = instruction->end_instruction_index;
+				}
+			}
+			continue;
+		}
+		if( ( instruction->opcode != LIBFWEVT_XML_TEMPLATE_PROGRAM_OPCODE_SUBSTITUTE_ATTRIBUTE )
+		 && ( instruction->opcode != LIBFWEVT_XML_TEMPLATE_PROGRAM_OPCODE_SUBSTITUTE_CONTENT )
+		 && ( instruction->opcode != LIBFWEVT_XML_TEMPLATE_PROGRAM_OPCODE_SUBSTITUTE_BINARY_XML ) )
+		{
+			continue;
+		}
+		if( libfwevt_xml_template_program_get_template_value(
+		     template_values_array,
+		     instruction->value_index,
+		     binary_data,
+		     binary_data_size,
+		     &value_type,
+		     &value_data,
+		     &value_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve template value: %" PRIu16 ".",
+			 function,
+			 instruction->value_index );
+
+			return( -1 );
+		}
+		if( value_type == LIBFWEVT_VALUE_TYPE_NULL )
+		{
+			continue;
+		}
+		if( instruction->opcode == LIBFWEVT_XML_TEMPLATE_PROGRAM_OPCODE_SUBSTITUTE_BINARY_XML )
+		{
+			result = binary_xml_callback(
+			          binary_xml_callback_data,
+			          (size_t) ( value_data - binary_data ),
+			          (size_t) ( value_data - binary_data ) + value_data_size,
+			          error );
+
+			if( result != 1 )
+			{
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to extract fields of binary XML template value: %" PRIu16 ".",
+					 function,
+					 instruction->value_index );
+				}
+				return( result );
+			}
+			continue;
+		}
+		if( instruction->opcode == LIBFWEVT_XML_TEMPLATE_PROGRAM_OPCODE_SUBSTITUTE_ATTRIBUTE )
+		{
+			attribute_name      = &( program->data[ instruction->name_offset ] );
+			attribute_name_size = (size_t) instruction->name_size;
+		}
+		else
+		{
+			attribute_name      = NULL;
+			attribute_name_size = 0;
+		}
+		if( field_callback(
+		     &( program->data[ element_name_offset[ element_depth ] ] ),
+		     (size_t) element_name_size[ element_depth ],
+		     attribute_name,
+		     attribute_name_size,
+		     instruction->value_index,
+		     value_type,
+		     value_data,
+		     value_data_size,
+		     callback_data,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to process field of template value: %" PRIu16 ".",
+			 function,
+			 instruction->value_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
@@ -0,0 +1,274 @@
+/*
+ * XML template program functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWEVT_XML_TEMPLATE_PROGRAM_H )
+#define _LIBFWEVT_XML_TEMPLATE_PROGRAM_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwevt_libcdata.h"
+#include "libfwevt_libcerror.h"
+#include "libfwevt_xml_template_definition.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfwevt_xml_template_program_instruction libfwevt_xml_template_program_instruction_t;
+
+struct libfwevt_xml_template_program_instruction
+{
+	/* The opcode
+	 */
+	uint8_t opcode;
+
+	/* The element depth
+	 */
+	uint8_t element_depth;
+
+	/* The binary XML token type
+	 * Only used by substitute opcodes
+	 */
+	uint8_t token_type;
+
+	/* The template value type
+	 * Only used by substitute opcodes
+	 */
+	uint8_t value_type;
+
+	/* The template value index
+	 * Only used by substitute opcodes
+	 */
+	uint16_t value_index;
+
+	/* The offset of the UTF-8 output fragment in the program data
+	 */
+	uint32_t fragment_offset;
+
+	/* The size of the UTF-8 output fragment
+	 */
+	uint32_t fragment_size;
+
+	/* The offset of the name in the program data
+	 * Contains the UTF-16 little-endian name of the element or attribute
+	 */
+	uint32_t name_offset;
+
+	/* The size of the name
+	 */
+	uint32_t name_size;
+
+	/* The index of the instruction after the end element instruction
+	 * Only used by start element and substitute content opcodes
+	 */
+	int end_instruction_index;
+};
+
+typedef struct libfwevt_xml_template_program libfwevt_xml_template_program_t;
+
+/* A XML template program contains the output of a template definition as a
+ * sequence of literal UTF-8 fragments and typed substitution instructions,
+ * so that a template instance can be rendered without building XML tags
+ */
+struct libfwevt_xml_template_program
+{
+	/* The instructions
+	 */
+	libfwevt_xml_template_program_instruction_t *instructions;
+
+	/* The number of instructions
+	 */
+	int number_of_instructions;
+
+	/* The number of allocated instructions
+	 */
+	int number_of_allocated_instructions;
+
+	/* The data
+	 * Contains the UTF-8 output fragments and UTF-16 names
+	 */
+	uint8_t *data;
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The allocated data size
+	 */
+	size_t allocated_data_size;
+};
+
+int libfwevt_xml_template_program_initialize(
+     libfwevt_xml_template_program_t **program,
+     libcerror_error_t **error );
+
+int libfwevt_xml_template_program_free(
+     libfwevt_xml_template_program_t **program,
+     libcerror_error_t **error );
+
+int libfwevt_xml_template_program_append_instruction(
+     libfwevt_xml_template_program_t *program,
+     uint8_t opcode,
+     int element_depth,
+     int *instruction_index,
+     libcerror_error_t **error );
+
+int libfwevt_xml_template_program_resize_data(
+     libfwevt_xml_template_program_t *program,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libfwevt_xml_template_program_append_data(
+     libfwevt_xml_template_program_t *program,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t *data_offset,
+     libcerror_error_t **error );
+
+int libfwevt_xml_template_program_append_utf16_stream(
+     libfwevt_xml_template_program_t *program,
+     const uint8_t *utf16_stream,
+     size_t utf16_stream_size,
+     uint8_t escape_characters,
+     libcerror_error_t **error );
+
+int libfwevt_xml_template_program_get_value_data_size(
+     uint8_t value_type,
+     uint16_t *value_data_size,
+     libcerror_error_t **error );
+
+int libfwevt_xml_template_program_get_literal_utf16_stream(
+     libfwevt_xml_template_definition_t *template_definition,
+     libfwevt_xml_template_node_t *node,
+     const uint8_t **utf16_stream,
+     size_t *utf16_stream_size,
+     libcerror_error_t **error );
+
+int libfwevt_xml_template_program_compile(
+     libfwevt_xml_template_program_t *program,
+     libfwevt_xml_template_definition_t *template_definition,
+     libcerror_error_t **error );
+
+int libfwevt_xml_template_program_compile_element(
+     libfwevt_xml_template_program_t *program,
+     libfwevt_xml_template_definition_t *template_definition,
+     int *node_index,
+     int element_depth,
+     libcerror_error_t **error );
+
+int libfwevt_xml_template_program_copy_data_to_utf8_string_with_index(
+     const uint8_t *data,
+     size_t data_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error );
+
+int libfwevt_xml_template_program_copy_indentation_to_utf8_string_with_index(
+     int element_depth,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error );
+
+int libfwevt_xml_template_program_get_template_value(
+     libcdata_array_t *template_values_array,
+     uint16_t template_value_index,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     uint8_t *value_type,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error );
+
+int libfwevt_xml_template_program_get_array_value_element(
+     uint8_t value_type,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     size_t *array_value_offset,
+     const uint8_t **element_data,
+     size_t *element_data_size,
+     libcerror_error_t **error );
+
+int libfwevt_xml_template_program_copy_value_to_utf8_string_with_index(
+     uint8_t value_type,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     int ascii_codepage,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error );
+
+int libfwevt_xml_template_program_render_utf8_xml_string(
+     libfwevt_xml_template_program_t *program,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     libcdata_array_t *template_values_array,
+     int ascii_codepage,
+     int base_element_depth,
+     int (*binary_xml_callback)(
+            void *callback_data,
+            size_t binary_data_offset,
+            size_t binary_data_size,
+            int element_depth,
+            uint8_t *utf8_string,
+            size_t utf8_string_size,
+            size_t *utf8_string_index,
+            libcerror_error_t **error ),
+     void *callback_data,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *utf8_string_index,
+     libcerror_error_t **error );
+
+int libfwevt_xml_template_program_extract_fields(
+     libfwevt_xml_template_program_t *program,
+     const uint8_t *binary_data,
+     size_t binary_data_size,
+     libcdata_array_t *template_values_array,
+     int (*field_callback)(
+            const uint8_t *element_name_utf16_stream,
+            size_t element_name_utf16_stream_size,
+            const uint8_t *attribute_name_utf16_stream,
+            size_t attribute_name_utf16_stream_size,
+            uint16_t template_value_index,
+            uint8_t value_type,
+            const uint8_t *value_data,
+            size_t value_data_size,
+            void *callback_data,
+            libcerror_error_t **error ),
+     void *callback_data,
+     int (*binary_xml_callback)(
+            void *binary_xml_callback_data,
+            size_t binary_data_offset,
+            size_t binary_data_size,
+            libcerror_error_t **error ),
+     void *binary_xml_callback_data,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWEVT_XML_TEMPLATE_PROGRAM_H ) */
+
@@ -410,3 +410,41 @@ int libfwevt_xml_template_value_set_flags(
 	return( 1 );
 }
 
+/* Resets a template value
+ * Clears the type, offset, size and flags so that the template value can be reused
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_template_value_reset(
+     libfwevt_xml_template_value_t *xml_template_value,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_xml_template_value_reset";
+
+	if( xml_template_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid binary XML template value.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     xml_template_value,
+	     0,
+	     sizeof( libfwevt_internal_xml_template_value_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear binary XML template value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
@@ -101,6 +101,10 @@ int libfwevt_xml_template_value_set_flags(
      uint8_t flags,
      libcerror_error_t **error );
 
+int libfwevt_xml_template_value_reset(
+     libfwevt_xml_template_value_t *xml_template_value,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -0,0 +1,1994 @@
+/*
+ * XML tree functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libfwevt_array.h"
+#include "libfwevt_data_segment.h"
+#include "libfwevt_definitions.h"
+#include "libfwevt_libcerror.h"
+#include "libfwevt_types.h"
+#include "libfwevt_xml_tag.h"
+#include "libfwevt_xml_tree.h"
+#include "libfwevt_xml_value.h"
+
+/* Creates a XML tree
+ * Make sure the value xml_tree is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_tree_initialize(
+     libfwevt_xml_tree_t **xml_tree,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_xml_tree_initialize";
+
+	if( xml_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( *xml_tree != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid XML tree value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*xml_tree = memory_allocate_structure(
+	             libfwevt_xml_tree_t );
+
+	if( *xml_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create XML tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *xml_tree,
+	     0,
+	     sizeof( libfwevt_xml_tree_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear XML tree.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *xml_tree != NULL )
+	{
+		memory_free(
+		 *xml_tree );
+
+		*xml_tree = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a XML tree
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_tree_free(
+     libfwevt_xml_tree_t **xml_tree,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_xml_tree_free";
+	int result            = 1;
+
+	if( xml_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( *xml_tree != NULL )
+	{
+		if( libfwevt_xml_tree_empty(
+		     *xml_tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty XML tree.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *xml_tree )->nodes != NULL )
+		{
+			memory_free(
+			 ( *xml_tree )->nodes );
+		}
+		if( ( *xml_tree )->parent_indexes != NULL )
+		{
+			memory_free(
+			 ( *xml_tree )->parent_indexes );
+		}
+		if( ( *xml_tree )->first_element_indexes != NULL )
+		{
+			memory_free(
+			 ( *xml_tree )->first_element_indexes );
+		}
+		if( ( *xml_tree )->next_sibling_indexes != NULL )
+		{
+			memory_free(
+			 ( *xml_tree )->next_sibling_indexes );
+		}
+		if( ( *xml_tree )->number_of_attributes != NULL )
+		{
+			memory_free(
+			 ( *xml_tree )->number_of_attributes );
+		}
+		if( ( *xml_tree )->number_of_elements != NULL )
+		{
+			memory_free(
+			 ( *xml_tree )->number_of_elements );
+		}
+		if( ( *xml_tree )->element_offsets != NULL )
+		{
+			memory_free(
+			 ( *xml_tree )->element_offsets );
+		}
+		if( ( *xml_tree )->element_node_indexes != NULL )
+		{
+			memory_free(
+			 ( *xml_tree )->element_node_indexes );
+		}
+		if( ( *xml_tree )->names_data != NULL )
+		{
+			memory_free(
+			 ( *xml_tree )->names_data );
+		}
+		if( ( *xml_tree )->value_types != NULL )
+		{
+			memory_free(
+			 ( *xml_tree )->value_types );
+		}
+		if( ( *xml_tree )->value_segment_indexes != NULL )
+		{
+			memory_free(
+			 ( *xml_tree )->value_segment_indexes );
+		}
+		if( ( *xml_tree )->number_of_value_segments != NULL )
+		{
+			memory_free(
+			 ( *xml_tree )->number_of_value_segments );
+		}
+		if( ( *xml_tree )->value_segments_data != NULL )
+		{
+			memory_free(
+			 ( *xml_tree )->value_segments_data );
+		}
+		if( ( *xml_tree )->value_segments_data_offsets != NULL )
+		{
+			memory_free(
+			 ( *xml_tree )->value_segments_data_offsets );
+		}
+		if( ( *xml_tree )->value_segments_data_sizes != NULL )
+		{
+			memory_free(
+			 ( *xml_tree )->value_segments_data_sizes );
+		}
+		if( ( *xml_tree )->values_data != NULL )
+		{
+			memory_free(
+			 ( *xml_tree )->values_data );
+		}
+		memory_free(
+		 *xml_tree );
+
+		*xml_tree = NULL;
+	}
+	return( result );
+}
+
+/* Empties a XML tree
+ * Frees the XML values of the nodes, the allocated memory is retained for reuse
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_tree_empty(
+     libfwevt_xml_tree_t *xml_tree,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_xml_tree_empty";
+	int node_index        = 0;
+	int result            = 1;
+
+	if( xml_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tree.",
+		 function );
+
+		return( -1 );
+	}
+	for( node_index = 0;
+	     node_index < xml_tree->number_of_nodes;
+	     node_index++ )
+	{
+		if( xml_tree->nodes[ node_index ].value != NULL )
+		{
+			if( libfwevt_internal_xml_value_free(
+			     (libfwevt_internal_xml_value_t **) &( xml_tree->nodes[ node_index ].value ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free value of node: %d.",
+				 function,
+				 node_index );
+
+				result = -1;
+			}
+		}
+	}
+	xml_tree->number_of_nodes                = 0;
+	xml_tree->number_of_element_node_indexes = 0;
+	xml_tree->names_data_size                = 0;
+	xml_tree->total_number_of_value_segments = 0;
+	xml_tree->values_data_size               = 0;
+
+	return( result );
+}
+
+/* Resizes the arrays of a XML tree to store at least the number of nodes and names data size
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_tree_resize(
+     libfwevt_xml_tree_t *xml_tree,
+     int number_of_nodes,
+     size_t names_data_size,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_tag_t *nodes = NULL;
+	uint8_t *names_data                = NULL;
+	uint8_t *value_types               = NULL;
+	int *index_array                   = NULL;
+	static char *function              = "libfwevt_xml_tree_resize";
+	size_t allocated_names_data_size   = 0;
+	size_t index_array_size            = 0;
+	size_t names_data_offset           = 0;
+	size_t nodes_size                  = 0;
+	int node_index                     = 0;
+	int number_of_allocated_nodes      = 0;
+
+	if( xml_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_nodes < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of nodes value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( names_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid names data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_nodes > xml_tree->number_of_allocated_nodes )
+	{
+		number_of_allocated_nodes = xml_tree->number_of_allocated_nodes;
+
+		if( number_of_allocated_nodes == 0 )
+		{
+			number_of_allocated_nodes = 64;
+		}
+		while( number_of_nodes > number_of_allocated_nodes )
+		{
+			if( number_of_allocated_nodes >= ( INT_MAX / 2 ) )
+			{
+				number_of_allocated_nodes = number_of_nodes;
+
+				break;
+			}
+			number_of_allocated_nodes *= 2;
+		}
+		nodes_size = sizeof( libfwevt_internal_xml_tag_t ) * number_of_allocated_nodes;
+
+		if( nodes_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid nodes size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		nodes = (libfwevt_internal_xml_tag_t *) memory_reallocate(
+		                                         xml_tree->nodes,
+		                                         nodes_size );
+
+		if( nodes == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize nodes.",
+			 function );
+
+			return( -1 );
+		}
+		xml_tree->nodes = nodes;
+
+		index_array_size = sizeof( int ) * number_of_allocated_nodes;
+
+		index_array = (int *) memory_reallocate(
+		                       xml_tree->parent_indexes,
+		                       index_array_size );
+
+		if( index_array == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize parent indexes.",
+			 function );
+
+			return( -1 );
+		}
+		xml_tree->parent_indexes = index_array;
+
+		index_array = (int *) memory_reallocate(
+		                       xml_tree->first_element_indexes,
+		                       index_array_size );
+
+		if( index_array == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize first element indexes.",
+			 function );
+
+			return( -1 );
+		}
+		xml_tree->first_element_indexes = index_array;
+
+		index_array = (int *) memory_reallocate(
+		                       xml_tree->next_sibling_indexes,
+		                       index_array_size );
+
+		if( index_array == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize next sibling indexes.",
+			 function );
+
+			return( -1 );
+		}
+		xml_tree->next_sibling_indexes = index_array;
+
+		index_array = (int *) memory_reallocate(
+		                       xml_tree->number_of_attributes,
+		                       index_array_size );
+
+		if( index_array == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize number of attributes.",
+			 function );
+
+			return( -1 );
+		}
+		xml_tree->number_of_attributes = index_array;
+
+		index_array = (int *) memory_reallocate(
+		                       xml_tree->number_of_elements,
+		                       index_array_size );
+
+		if( index_array == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize number of elements.",
+			 function );
+
+			return( -1 );
+		}
+		xml_tree->number_of_elements = index_array;
+
+		index_array = (int *) memory_reallocate(
+		                       xml_tree->element_offsets,
+		                       index_array_size );
+
+		if( index_array == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize element offsets.",
+			 function );
+
+			return( -1 );
+		}
+		xml_tree->element_offsets = index_array;
+
+		index_array = (int *) memory_reallocate(
+		                       xml_tree->element_node_indexes,
+		                       index_array_size );
+
+		if( index_array == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize element node indexes.",
+			 function );
+
+			return( -1 );
+		}
+		xml_tree->element_node_indexes = index_array;
+
+		index_array = (int *) memory_reallocate(
+		                       xml_tree->value_segment_indexes,
+		                       index_array_size );
+
+		if( index_array == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize value segment indexes.",
+			 function );
+
+			return( -1 );
+		}
+		xml_tree->value_segment_indexes = index_array;
+
+		index_array = (int *) memory_reallocate(
+		                       xml_tree->number_of_value_segments,
+		                       index_array_size );
+
+		if( index_array == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize number of value segments.",
+			 function );
+
+			return( -1 );
+		}
+		xml_tree->number_of_value_segments = index_array;
+
+		value_types = (uint8_t *) memory_reallocate(
+		                           xml_tree->value_types,
+		                           sizeof( uint8_t ) * number_of_allocated_nodes );
+
+		if( value_types == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize value types.",
+			 function );
+
+			return( -1 );
+		}
+		xml_tree->value_types = value_types;
+
+		/* The number of allocated nodes is only updated when all the arrays have been resized
+		 */
+		xml_tree->number_of_allocated_nodes = number_of_allocated_nodes;
+	}
+	if( names_data_size > xml_tree->allocated_names_data_size )
+	{
+		allocated_names_data_size = xml_tree->allocated_names_data_size;
+
+		if( allocated_names_data_size == 0 )
+		{
+			allocated_names_data_size = 1024;
+		}
+		while( names_data_size > allocated_names_data_size )
+		{
+			if( allocated_names_data_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+			{
+				allocated_names_data_size = names_data_size;
+
+				break;
+			}
+			allocated_names_data_size *= 2;
+		}
+		names_data = (uint8_t *) memory_reallocate(
+		                          xml_tree->names_data,
+		                          sizeof( uint8_t ) * allocated_names_data_size );
+
+		if( names_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize names data.",
+			 function );
+
+			return( -1 );
+		}
+		xml_tree->names_data                = names_data;
+		xml_tree->allocated_names_data_size = allocated_names_data_size;
+
+		/* The names are stored in node order hence the names of the nodes
+		 * can be relocated to the resized names data
+		 */
+		names_data_offset = 0;
+
+		for( node_index = 0;
+		     node_index < xml_tree->number_of_nodes;
+		     node_index++ )
+		{
+			if( xml_tree->nodes[ node_index ].name_size > 0 )
+			{
+				xml_tree->nodes[ node_index ].name = &( names_data[ names_data_offset ] );
+
+				names_data_offset += xml_tree->nodes[ node_index ].name_size;
+			}
+		}
+	}
+	return( 1 );
+}
+
+/* Resizes the value data segment arrays of a XML tree to store at least the number of
+ * value data segments and values data size
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_tree_resize_value_segments(
+     libfwevt_xml_tree_t *xml_tree,
+     int number_of_value_segments,
+     size_t values_data_size,
+     libcerror_error_t **error )
+{
+	const uint8_t **value_segments_data = NULL;
+	uint8_t *values_data                = NULL;
+	size_t *size_array                  = NULL;
+	static char *function               = "libfwevt_xml_tree_resize_value_segments";
+	size_t allocated_values_data_size   = 0;
+	size_t size_array_size              = 0;
+	int number_of_allocated_segments    = 0;
+
+	if( xml_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_value_segments < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_LESS_THAN_ZERO,
+		 "%s: invalid number of value segments value less than zero.",
+		 function );
+
+		return( -1 );
+	}
+	if( values_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid values data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_value_segments > xml_tree->number_of_allocated_value_segments )
+	{
+		number_of_allocated_segments = xml_tree->number_of_allocated_value_segments;
+
+		if( number_of_allocated_segments == 0 )
+		{
+			number_of_allocated_segments = 64;
+		}
+		while( number_of_value_segments > number_of_allocated_segments )
+		{
+			if( number_of_allocated_segments >= ( INT_MAX / 2 ) )
+			{
+				number_of_allocated_segments = number_of_value_segments;
+
+				break;
+			}
+			number_of_allocated_segments *= 2;
+		}
+		size_array_size = sizeof( size_t ) * number_of_allocated_segments;
+
+		if( size_array_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid value segments size value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		value_segments_data = (const uint8_t **) memory_reallocate(
+		                                          xml_tree->value_segments_data,
+		                                          sizeof( const uint8_t * ) * number_of_allocated_segments );
+
+		if( value_segments_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize value segments data.",
+			 function );
+
+			return( -1 );
+		}
+		xml_tree->value_segments_data = value_segments_data;
+
+		size_array = (size_t *) memory_reallocate(
+		                         xml_tree->value_segments_data_offsets,
+		                         size_array_size );
+
+		if( size_array == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize value segments data offsets.",
+			 function );
+
+			return( -1 );
+		}
+		xml_tree->value_segments_data_offsets = size_array;
+
+		size_array = (size_t *) memory_reallocate(
+		                         xml_tree->value_segments_data_sizes,
+		                         size_array_size );
+
+		if( size_array == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize value segments data sizes.",
+			 function );
+
+			return( -1 );
+		}
+		xml_tree->value_segments_data_sizes = size_array;
+
+		/* The number of allocated value segments is only updated when all the arrays have been resized
+		 */
+		xml_tree->number_of_allocated_value_segments = number_of_allocated_segments;
+	}
+	/* The copied value data is referenced by offset hence it does not need to be relocated
+	 */
+	if( values_data_size > xml_tree->allocated_values_data_size )
+	{
+		allocated_values_data_size = xml_tree->allocated_values_data_size;
+
+		if( allocated_values_data_size == 0 )
+		{
+			allocated_values_data_size = 1024;
+		}
+		while( values_data_size > allocated_values_data_size )
+		{
+			if( allocated_values_data_size > (size_t) ( MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+			{
+				allocated_values_data_size = values_data_size;
+
+				break;
+			}
+			allocated_values_data_size *= 2;
+		}
+		values_data = (uint8_t *) memory_reallocate(
+		                           xml_tree->values_data,
+		                           sizeof( uint8_t ) * allocated_values_data_size );
+
+		if( values_data == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize values data.",
+			 function );
+
+			return( -1 );
+		}
+		xml_tree->values_data                = values_data;
+		xml_tree->allocated_values_data_size = allocated_values_data_size;
+	}
+	return( 1 );
+}
+
+/* Appends a XML tag as a node
+ * The name, type and flags of the XML tag are copied to the node, its value is
+ * not, refer to libfwevt_xml_tree_set_node_value
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_tree_append_node(
+     libfwevt_xml_tree_t *xml_tree,
+     int parent_index,
+     libfwevt_internal_xml_tag_t *internal_xml_tag,
+     int *node_index,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_tag_t *node = NULL;
+	static char *function             = "libfwevt_xml_tree_append_node";
+	int safe_node_index               = 0;
+
+	if( xml_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_tree->number_of_nodes >= ( INT_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid XML tree - number of nodes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( parent_index < -1 )
+	 || ( parent_index >= xml_tree->number_of_nodes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid parent index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_xml_tag->tree != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported XML tag - already stored in a XML tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_xml_tag->name_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - xml_tree->names_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid XML tag - name size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( node_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid node index.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tree_resize(
+	     xml_tree,
+	     xml_tree->number_of_nodes + 1,
+	     xml_tree->names_data_size + internal_xml_tag->name_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize XML tree.",
+		 function );
+
+		return( -1 );
+	}
+	safe_node_index = xml_tree->number_of_nodes;
+
+	node = &( xml_tree->nodes[ safe_node_index ] );
+
+	if( memory_set(
+	     node,
+	     0,
+	     sizeof( libfwevt_internal_xml_tag_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear node.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_xml_tag->name_size > 0 )
+	{
+		if( memory_copy(
+		     &( xml_tree->names_data[ xml_tree->names_data_size ] ),
+		     internal_xml_tag->name,
+		     internal_xml_tag->name_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy name data.",
+			 function );
+
+			return( -1 );
+		}
+		node->name = &( xml_tree->names_data[ xml_tree->names_data_size ] );
+
+		xml_tree->names_data_size += internal_xml_tag->name_size;
+	}
+	/* The name of a node is owned by the XML tree
+	 */
+	node->type             = internal_xml_tag->type;
+	node->name_size        = internal_xml_tag->name_size;
+	node->name_is_interned = 1;
+	node->flags            = internal_xml_tag->flags;
+	node->tree             = xml_tree;
+	node->node_index       = safe_node_index;
+
+	xml_tree->parent_indexes[ safe_node_index ]        = parent_index;
+	xml_tree->first_element_indexes[ safe_node_index ] = -1;
+	xml_tree->next_sibling_indexes[ safe_node_index ]  = -1;
+	xml_tree->number_of_attributes[ safe_node_index ]  = 0;
+	xml_tree->number_of_elements[ safe_node_index ]    = 0;
+	xml_tree->element_offsets[ safe_node_index ]       = 0;
+	xml_tree->value_types[ safe_node_index ]           = 0;
+	xml_tree->value_segment_indexes[ safe_node_index ] = 0;
+
+	xml_tree->number_of_value_segments[ safe_node_index ] = -1;
+
+	xml_tree->number_of_nodes += 1;
+
+	*node_index = safe_node_index;
+
+	return( 1 );
+}
+
+/* Appends a XML tag as an attribute of a specific node
+ * The attributes are stored directly after the node of the element hence they
+ * must be appended before any other node, the value of the XML tag is moved to the node
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_tree_append_attribute(
+     libfwevt_xml_tree_t *xml_tree,
+     int node_index,
+     libfwevt_internal_xml_tag_t *internal_xml_tag,
+     libcerror_error_t **error )
+{
+	static char *function    = "libfwevt_xml_tree_append_attribute";
+	int attribute_node_index = 0;
+
+	if( xml_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( node_index < 0 )
+	 || ( node_index >= xml_tree->number_of_nodes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid node index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( node_index + 1 + xml_tree->number_of_attributes[ node_index ] ) != xml_tree->number_of_nodes )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported node index - attributes must directly follow the node.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tree_append_node(
+	     xml_tree,
+	     node_index,
+	     internal_xml_tag,
+	     &attribute_node_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append attribute node.",
+		 function );
+
+		return( -1 );
+	}
+	xml_tree->number_of_attributes[ node_index ] += 1;
+
+	if( libfwevt_xml_tree_set_node_value(
+	     xml_tree,
+	     attribute_node_index,
+	     internal_xml_tag,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set value of attribute node: %d.",
+		 function,
+		 attribute_node_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Sets the value of a specific node
+ * The type and flags of the XML tag are copied to the node and the data segments
+ * of its value are stored in the value segment arrays, since these are only known
+ * after the content has been read. Borrowed data is referenced and other data is
+ * copied into the values data, the XML value is created when the node is retrieved
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_tree_set_node_value(
+     libfwevt_xml_tree_t *xml_tree,
+     int node_index,
+     libfwevt_internal_xml_tag_t *internal_xml_tag,
+     libcerror_error_t **error )
+{
+	libfwevt_data_segment_t *data_segment             = NULL;
+	libfwevt_internal_xml_value_t *internal_xml_value = NULL;
+	static char *function                             = "libfwevt_xml_tree_set_node_value";
+	size_t values_data_size                           = 0;
+	int number_of_data_segments                       = 0;
+	int segment_index                                 = 0;
+	int value_segment_index                           = 0;
+
+	if( xml_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( node_index < 0 )
+	 || ( node_index >= xml_tree->number_of_nodes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid node index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_tree->number_of_value_segments[ node_index ] != -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid node: %d - value already set.",
+		 function,
+		 node_index );
+
+		return( -1 );
+	}
+	xml_tree->nodes[ node_index ].type  = internal_xml_tag->type;
+	xml_tree->nodes[ node_index ].flags = internal_xml_tag->flags;
+
+	if( internal_xml_tag->value == NULL )
+	{
+		return( 1 );
+	}
+	internal_xml_value = (libfwevt_internal_xml_value_t *) internal_xml_tag->value;
+
+	if( libfwevt_array_get_number_of_entries(
+	     internal_xml_value->data_segments,
+	     &number_of_data_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data segments.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_data_segments > ( INT_MAX - xml_tree->total_number_of_value_segments ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid number of data segments value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	/* The size of the data that needs to be copied is determined first
+	 * so that the values data only needs to be resized once
+	 */
+	values_data_size = xml_tree->values_data_size;
+
+	for( segment_index = 0;
+	     segment_index < number_of_data_segments;
+	     segment_index++ )
+	{
+		if( libfwevt_array_get_entry_by_index(
+		     internal_xml_value->data_segments,
+		     segment_index,
+		     (intptr_t **) &data_segment,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data segment: %d.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		if( data_segment == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing data segment: %d.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		if( data_segment->data_is_borrowed == 0 )
+		{
+			if( data_segment->data_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - values_data_size ) )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+				 "%s: invalid values data size value exceeds maximum.",
+				 function );
+
+				return( -1 );
+			}
+			values_data_size += data_segment->data_size;
+		}
+	}
+	if( libfwevt_xml_tree_resize_value_segments(
+	     xml_tree,
+	     xml_tree->total_number_of_value_segments + number_of_data_segments,
+	     values_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_RESIZE_FAILED,
+		 "%s: unable to resize value segments.",
+		 function );
+
+		return( -1 );
+	}
+	value_segment_index = xml_tree->total_number_of_value_segments;
+
+	for( segment_index = 0;
+	     segment_index < number_of_data_segments;
+	     segment_index++ )
+	{
+		if( libfwevt_array_get_entry_by_index(
+		     internal_xml_value->data_segments,
+		     segment_index,
+		     (intptr_t **) &data_segment,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve data segment: %d.",
+			 function,
+			 segment_index );
+
+			return( -1 );
+		}
+		xml_tree->value_segments_data_sizes[ value_segment_index ] = data_segment->data_size;
+
+		if( data_segment->data_is_borrowed != 0 )
+		{
+			xml_tree->value_segments_data[ value_segment_index ]         = data_segment->data;
+			xml_tree->value_segments_data_offsets[ value_segment_index ] = 0;
+		}
+		else
+		{
+			xml_tree->value_segments_data[ value_segment_index ]         = NULL;
+			xml_tree->value_segments_data_offsets[ value_segment_index ] = xml_tree->values_data_size;
+
+			if( data_segment->data_size > 0 )
+			{
+				if( memory_copy(
+				     &( xml_tree->values_data[ xml_tree->values_data_size ] ),
+				     data_segment->data,
+				     data_segment->data_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy data segment: %d.",
+					 function,
+					 segment_index );
+
+					return( -1 );
+				}
+				xml_tree->values_data_size += data_segment->data_size;
+			}
+		}
+		value_segment_index++;
+	}
+	xml_tree->value_types[ node_index ]              = internal_xml_value->value_type;
+	xml_tree->value_segment_indexes[ node_index ]    = xml_tree->total_number_of_value_segments;
+	xml_tree->number_of_value_segments[ node_index ] = number_of_data_segments;
+
+	xml_tree->total_number_of_value_segments = value_segment_index;
+
+	return( 1 );
+}
+
+/* Initializes the XML value of a specific node from its value data segments
+ * The data segments reference the binary data or the values data of the XML tree
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_tree_initialize_node_value(
+     libfwevt_xml_tree_t *xml_tree,
+     int node_index,
+     libcerror_error_t **error )
+{
+	libfwevt_internal_xml_tag_t *node = NULL;
+	const uint8_t *segment_data       = NULL;
+	static char *function             = "libfwevt_xml_tree_initialize_node_value";
+	int data_segment_index            = 0;
+	int number_of_value_segments      = 0;
+	int value_segment_index           = 0;
+
+	if( xml_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( node_index < 0 )
+	 || ( node_index >= xml_tree->number_of_nodes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid node index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	node = &( xml_tree->nodes[ node_index ] );
+
+	number_of_value_segments = xml_tree->number_of_value_segments[ node_index ];
+
+	if( ( node->value != NULL )
+	 || ( number_of_value_segments < 0 ) )
+	{
+		return( 1 );
+	}
+	if( libfwevt_xml_value_initialize(
+	     &( node->value ),
+	     xml_tree->value_types[ node_index ],
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create value of node: %d.",
+		 function,
+		 node_index );
+
+		goto on_error;
+	}
+	for( value_segment_index = xml_tree->value_segment_indexes[ node_index ];
+	     number_of_value_segments > 0;
+	     value_segment_index++ )
+	{
+		segment_data = xml_tree->value_segments_data[ value_segment_index ];
+
+		if( segment_data == NULL )
+		{
+			segment_data = &( xml_tree->values_data[ xml_tree->value_segments_data_offsets[ value_segment_index ] ] );
+		}
+		if( libfwevt_xml_value_append_data_segment(
+		     node->value,
+		     segment_data,
+		     xml_tree->value_segments_data_sizes[ value_segment_index ],
+		     LIBFWEVT_DATA_SEGMENT_FLAG_BORROW_DATA,
+		     &data_segment_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append data segment: %d to value of node: %d.",
+			 function,
+			 value_segment_index,
+			 node_index );
+
+			goto on_error;
+		}
+		number_of_value_segments--;
+	}
+	return( 1 );
+
+on_error:
+	if( node->value != NULL )
+	{
+		libfwevt_internal_xml_value_free(
+		 (libfwevt_internal_xml_value_t **) &( node->value ),
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Truncates the XML tree to a specific number of nodes
+ * Frees the values and the value data segments of the nodes that are removed, the nodes are removed from
+ * the end hence this is used to remove an element and all the nodes after it
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_tree_truncate(
+     libfwevt_xml_tree_t *xml_tree,
+     int number_of_nodes,
+     libcerror_error_t **error )
+{
+	static char *function        = "libfwevt_xml_tree_truncate";
+	int node_index               = 0;
+	int number_of_value_segments = 0;
+	int parent_index             = 0;
+	int value_segment_index      = 0;
+
+	if( xml_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_nodes < 0 )
+	 || ( number_of_nodes > xml_tree->number_of_nodes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of nodes value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_nodes < xml_tree->number_of_nodes )
+	{
+		parent_index = xml_tree->parent_indexes[ number_of_nodes ];
+
+		if( ( parent_index != -1 )
+		 && ( number_of_nodes <= ( parent_index + xml_tree->number_of_attributes[ parent_index ] ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported number of nodes - node: %d is an attribute.",
+			 function,
+			 number_of_nodes );
+
+			return( -1 );
+		}
+	}
+	number_of_value_segments = xml_tree->total_number_of_value_segments;
+
+	for( node_index = xml_tree->number_of_nodes - 1;
+	     node_index >= number_of_nodes;
+	     node_index-- )
+	{
+		/* The value data segments of a node are stored after those of the nodes
+		 * that were appended before it hence the value data segments of the
+		 * removed nodes are at the end
+		 */
+		if( xml_tree->number_of_value_segments[ node_index ] >= 0 )
+		{
+			value_segment_index = xml_tree->value_segment_indexes[ node_index ];
+
+			if( value_segment_index < xml_tree->total_number_of_value_segments )
+			{
+				xml_tree->total_number_of_value_segments = value_segment_index;
+			}
+		}
+		if( xml_tree->nodes[ node_index ].value != NULL )
+		{
+			if( libfwevt_internal_xml_value_free(
+			     (libfwevt_internal_xml_value_t **) &( xml_tree->nodes[ node_index ].value ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free value of node: %d.",
+				 function,
+				 node_index );
+
+				return( -1 );
+			}
+		}
+		xml_tree->names_data_size -= xml_tree->nodes[ node_index ].name_size;
+		xml_tree->number_of_nodes  = node_index;
+	}
+	for( value_segment_index = xml_tree->total_number_of_value_segments;
+	     value_segment_index < number_of_value_segments;
+	     value_segment_index++ )
+	{
+		if( ( xml_tree->value_segments_data[ value_segment_index ] == NULL )
+		 && ( xml_tree->value_segments_data_offsets[ value_segment_index ] < xml_tree->values_data_size ) )
+		{
+			xml_tree->values_data_size = xml_tree->value_segments_data_offsets[ value_segment_index ];
+		}
+	}
+	return( 1 );
+}
+
+/* Sets the sub element node indexes of the nodes
+ * The sub elements of a node are determined from the parent node indexes once
+ * all the nodes have been appended, so that the node indexes of the sub elements
+ * of a node can be stored consecutively
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_tree_set_element_node_indexes(
+     libfwevt_xml_tree_t *xml_tree,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_xml_tree_set_element_node_indexes";
+	int element_index     = 0;
+	int element_offset    = 0;
+	int node_index        = 0;
+	int parent_index      = 0;
+
+	if( xml_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tree.",
+		 function );
+
+		return( -1 );
+	}
+	for( node_index = 0;
+	     node_index < xml_tree->number_of_nodes;
+	     node_index++ )
+	{
+		xml_tree->first_element_indexes[ node_index ] = -1;
+		xml_tree->next_sibling_indexes[ node_index ]  = -1;
+		xml_tree->number_of_elements[ node_index ]    = 0;
+	}
+	/* Nodes that are not attributes are sub elements of their parent
+	 */
+	for( node_index = 0;
+	     node_index < xml_tree->number_of_nodes;
+	     node_index++ )
+	{
+		parent_index = xml_tree->parent_indexes[ node_index ];
+
+		if( ( parent_index != -1 )
+		 && ( node_index > ( parent_index + xml_tree->number_of_attributes[ parent_index ] ) ) )
+		{
+			xml_tree->number_of_elements[ parent_index ] += 1;
+		}
+	}
+	for( node_index = 0;
+	     node_index < xml_tree->number_of_nodes;
+	     node_index++ )
+	{
+		xml_tree->element_offsets[ node_index ] = element_offset;
+
+		element_offset += xml_tree->number_of_elements[ node_index ];
+
+		xml_tree->number_of_elements[ node_index ] = 0;
+	}
+	xml_tree->number_of_element_node_indexes = element_offset;
+
+	/* The number of sub elements per node is determined again while the
+	 * node indexes of the sub elements are stored
+	 */
+	for( node_index = 0;
+	     node_index < xml_tree->number_of_nodes;
+	     node_index++ )
+	{
+		parent_index = xml_tree->parent_indexes[ node_index ];
+
+		if( ( parent_index == -1 )
+		 || ( node_index <= ( parent_index + xml_tree->number_of_attributes[ parent_index ] ) ) )
+		{
+			continue;
+		}
+		element_index  = xml_tree->number_of_elements[ parent_index ];
+		element_offset = xml_tree->element_offsets[ parent_index ];
+
+		if( element_index == 0 )
+		{
+			xml_tree->first_element_indexes[ parent_index ] = node_index;
+		}
+		else
+		{
+			xml_tree->next_sibling_indexes[ xml_tree->element_node_indexes[ element_offset + element_index - 1 ] ] = node_index;
+		}
+		xml_tree->element_node_indexes[ element_offset + element_index ] = node_index;
+
+		xml_tree->number_of_elements[ parent_index ] += 1;
+	}
+	return( 1 );
+}
+
+/* Retrieves the root XML tag
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwevt_xml_tree_get_root_xml_tag(
+     libfwevt_xml_tree_t *xml_tree,
+     libfwevt_xml_tag_t **root_xml_tag,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_xml_tree_get_root_xml_tag";
+
+	if( xml_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( root_xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid root XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( xml_tree->number_of_nodes == 0 )
+	{
+		return( 0 );
+	}
+	if( libfwevt_xml_tree_initialize_node_value(
+	     xml_tree,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize value of root node.",
+		 function );
+
+		return( -1 );
+	}
+	*root_xml_tag = (libfwevt_xml_tag_t *) &( xml_tree->nodes[ 0 ] );
+
+	return( 1 );
+}
+
+/* Retrieves the parent XML tag of a specific node
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libfwevt_xml_tree_get_parent_xml_tag(
+     libfwevt_xml_tree_t *xml_tree,
+     int node_index,
+     libfwevt_xml_tag_t **parent_xml_tag,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_xml_tree_get_parent_xml_tag";
+	int parent_index      = 0;
+
+	if( xml_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( node_index < 0 )
+	 || ( node_index >= xml_tree->number_of_nodes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid node index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( parent_xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid parent XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	parent_index = xml_tree->parent_indexes[ node_index ];
+
+	if( parent_index == -1 )
+	{
+		return( 0 );
+	}
+	if( libfwevt_xml_tree_initialize_node_value(
+	     xml_tree,
+	     parent_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize value of parent node.",
+		 function );
+
+		return( -1 );
+	}
+	*parent_xml_tag = (libfwevt_xml_tag_t *) &( xml_tree->nodes[ parent_index ] );
+
+	return( 1 );
+}
+
+/* Retrieves the number of attributes of a specific node
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_tree_get_number_of_attributes(
+     libfwevt_xml_tree_t *xml_tree,
+     int node_index,
+     int *number_of_attributes,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_xml_tree_get_number_of_attributes";
+
+	if( xml_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( node_index < 0 )
+	 || ( node_index >= xml_tree->number_of_nodes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid node index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_attributes == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of attributes.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_attributes = xml_tree->number_of_attributes[ node_index ];
+
+	return( 1 );
+}
+
+/* Retrieves a specific attribute of a specific node
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_tree_get_attribute_by_index(
+     libfwevt_xml_tree_t *xml_tree,
+     int node_index,
+     int attribute_index,
+     libfwevt_xml_tag_t **attribute_xml_tag,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_xml_tree_get_attribute_by_index";
+
+	if( xml_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( node_index < 0 )
+	 || ( node_index >= xml_tree->number_of_nodes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid node index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( attribute_index < 0 )
+	 || ( attribute_index >= xml_tree->number_of_attributes[ node_index ] ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid attribute index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( attribute_xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid attribute XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tree_initialize_node_value(
+	     xml_tree,
+	     node_index + 1 + attribute_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize value of attribute node.",
+		 function );
+
+		return( -1 );
+	}
+	*attribute_xml_tag = (libfwevt_xml_tag_t *) &( xml_tree->nodes[ node_index + 1 + attribute_index ] );
+
+	return( 1 );
+}
+
+/* Retrieves the number of sub elements of a specific node
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_tree_get_number_of_elements(
+     libfwevt_xml_tree_t *xml_tree,
+     int node_index,
+     int *number_of_elements,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_xml_tree_get_number_of_elements";
+
+	if( xml_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( node_index < 0 )
+	 || ( node_index >= xml_tree->number_of_nodes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid node index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_elements == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of elements.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_elements = xml_tree->number_of_elements[ node_index ];
+
+	return( 1 );
+}
+
+/* Retrieves a specific sub element of a specific node
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_tree_get_element_by_index(
+     libfwevt_xml_tree_t *xml_tree,
+     int node_index,
+     int element_index,
+     libfwevt_xml_tag_t **element_xml_tag,
+     libcerror_error_t **error )
+{
+	static char *function  = "libfwevt_xml_tree_get_element_by_index";
+	int element_node_index = 0;
+
+	if( xml_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( node_index < 0 )
+	 || ( node_index >= xml_tree->number_of_nodes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid node index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( element_index < 0 )
+	 || ( element_index >= xml_tree->number_of_elements[ node_index ] ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid element index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( element_xml_tag == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid element XML tag.",
+		 function );
+
+		return( -1 );
+	}
+	element_node_index = xml_tree->element_node_indexes[ xml_tree->element_offsets[ node_index ] + element_index ];
+
+	if( ( element_node_index <= node_index )
+	 || ( element_node_index >= xml_tree->number_of_nodes ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid element: %d node index value out of bounds.",
+		 function,
+		 element_index );
+
+		return( -1 );
+	}
+	if( libfwevt_xml_tree_initialize_node_value(
+	     xml_tree,
+	     element_node_index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize value of element node.",
+		 function );
+
+		return( -1 );
+	}
+	*element_xml_tag = (libfwevt_xml_tag_t *) &( xml_tree->nodes[ element_node_index ] );
+
+	return( 1 );
+}
+
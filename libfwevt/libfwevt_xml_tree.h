@@ -0,0 +1,254 @@
+/*
+ * XML tree functions
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBFWEVT_XML_TREE_H )
+#define _LIBFWEVT_XML_TREE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libfwevt_libcerror.h"
+#include "libfwevt_types.h"
+#include "libfwevt_xml_tag.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libfwevt_xml_tree libfwevt_xml_tree_t;
+
+/* A flat XML tree stores the XML tags of a document as nodes in a single array.
+ * The attributes of an element are stored directly after the element, the
+ * structure of the tree and the values of the nodes are stored in separate
+ * arrays indexed by node index. The XML value of a node is only created when
+ * the node is retrieved.
+ */
+struct libfwevt_xml_tree
+{
+	/* The nodes in document order
+	 * The nodes are the XML tags that are returned to the caller
+	 */
+	libfwevt_internal_xml_tag_t *nodes;
+
+	/* The node index of the parent per node or -1 if not set
+	 */
+	int *parent_indexes;
+
+	/* The node index of the first sub element per node or -1 if not set
+	 */
+	int *first_element_indexes;
+
+	/* The node index of the next sibling element per node or -1 if not set
+	 */
+	int *next_sibling_indexes;
+
+	/* The number of attributes per node
+	 */
+	int *number_of_attributes;
+
+	/* The number of sub elements per node
+	 */
+	int *number_of_elements;
+
+	/* The number of nodes
+	 */
+	int number_of_nodes;
+
+	/* The number of allocated nodes
+	 */
+	int number_of_allocated_nodes;
+
+	/* The names data
+	 * Contains the UTF-16 little-endian encoded names of the nodes
+	 */
+	uint8_t *names_data;
+
+	/* The names data size
+	 */
+	size_t names_data_size;
+
+	/* The allocated names data size
+	 */
+	size_t allocated_names_data_size;
+
+	/* The offset of the sub elements in the element node indexes per node
+	 */
+	int *element_offsets;
+
+	/* The node indexes of the sub elements
+	 * The node indexes of the sub elements of a node are stored consecutively
+	 * so that a sub element can be retrieved by index directly
+	 */
+	int *element_node_indexes;
+
+	/* The number of element node indexes
+	 */
+	int number_of_element_node_indexes;
+
+	/* The value type per node
+	 */
+	uint8_t *value_types;
+
+	/* The index of the first value data segment per node
+	 */
+	int *value_segment_indexes;
+
+	/* The number of value data segments per node or -1 if the node has no value
+	 */
+	int *number_of_value_segments;
+
+	/* The data per value data segment
+	 * Refers to the binary data if the data was borrowed or NULL if the data
+	 * was copied into the values data
+	 */
+	const uint8_t **value_segments_data;
+
+	/* The offset in the values data per value data segment
+	 * Only used if the data was copied into the values data
+	 */
+	size_t *value_segments_data_offsets;
+
+	/* The data size per value data segment
+	 */
+	size_t *value_segments_data_sizes;
+
+	/* The total number of value data segments
+	 */
+	int total_number_of_value_segments;
+
+	/* The number of allocated value data segments
+	 */
+	int number_of_allocated_value_segments;
+
+	/* The values data
+	 * Contains copies of the value data that was not borrowed
+	 */
+	uint8_t *values_data;
+
+	/* The values data size
+	 */
+	size_t values_data_size;
+
+	/* The allocated values data size
+	 */
+	size_t allocated_values_data_size;
+};
+
+int libfwevt_xml_tree_initialize(
+     libfwevt_xml_tree_t **xml_tree,
+     libcerror_error_t **error );
+
+int libfwevt_xml_tree_free(
+     libfwevt_xml_tree_t **xml_tree,
+     libcerror_error_t **error );
+
+int libfwevt_xml_tree_empty(
+     libfwevt_xml_tree_t *xml_tree,
+     libcerror_error_t **error );
+
+int libfwevt_xml_tree_resize(
+     libfwevt_xml_tree_t *xml_tree,
+     int number_of_nodes,
+     size_t names_data_size,
+     libcerror_error_t **error );
+
+int libfwevt_xml_tree_resize_value_segments(
+     libfwevt_xml_tree_t *xml_tree,
+     int number_of_value_segments,
+     size_t values_data_size,
+     libcerror_error_t **error );
+
+int libfwevt_xml_tree_append_node(
+     libfwevt_xml_tree_t *xml_tree,
+     int parent_index,
+     libfwevt_internal_xml_tag_t *internal_xml_tag,
+     int *node_index,
+     libcerror_error_t **error );
+
+int libfwevt_xml_tree_append_attribute(
+     libfwevt_xml_tree_t *xml_tree,
+     int node_index,
+     libfwevt_internal_xml_tag_t *internal_xml_tag,
+     libcerror_error_t **error );
+
+int libfwevt_xml_tree_set_node_value(
+     libfwevt_xml_tree_t *xml_tree,
+     int node_index,
+     libfwevt_internal_xml_tag_t *internal_xml_tag,
+     libcerror_error_t **error );
+
+int libfwevt_xml_tree_initialize_node_value(
+     libfwevt_xml_tree_t *xml_tree,
+     int node_index,
+     libcerror_error_t **error );
+
+int libfwevt_xml_tree_truncate(
+     libfwevt_xml_tree_t *xml_tree,
+     int number_of_nodes,
+     libcerror_error_t **error );
+
+int libfwevt_xml_tree_set_element_node_indexes(
+     libfwevt_xml_tree_t *xml_tree,
+     libcerror_error_t **error );
+
+int libfwevt_xml_tree_get_root_xml_tag(
+     libfwevt_xml_tree_t *xml_tree,
+     libfwevt_xml_tag_t **root_xml_tag,
+     libcerror_error_t **error );
+
+int libfwevt_xml_tree_get_parent_xml_tag(
+     libfwevt_xml_tree_t *xml_tree,
+     int node_index,
+     libfwevt_xml_tag_t **parent_xml_tag,
+     libcerror_error_t **error );
+
+int libfwevt_xml_tree_get_number_of_attributes(
+     libfwevt_xml_tree_t *xml_tree,
+     int node_index,
+     int *number_of_attributes,
+     libcerror_error_t **error );
+
+int libfwevt_xml_tree_get_attribute_by_index(
+     libfwevt_xml_tree_t *xml_tree,
+     int node_index,
+     int attribute_index,
+     libfwevt_xml_tag_t **attribute_xml_tag,
+     libcerror_error_t **error );
+
+int libfwevt_xml_tree_get_number_of_elements(
+     libfwevt_xml_tree_t *xml_tree,
+     int node_index,
+     int *number_of_elements,
+     libcerror_error_t **error );
+
+int libfwevt_xml_tree_get_element_by_index(
+     libfwevt_xml_tree_t *xml_tree,
+     int node_index,
+     int element_index,
+     libfwevt_xml_tag_t **element_xml_tag,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBFWEVT_XML_TREE_H ) */
+
@@ -27,12 +27,13 @@
 #include <types.h>
 #include <wide_string.h>
 
+#include "libfwevt_arena.h"
+#include "libfwevt_array.h"
 #include "libfwevt_data_segment.h"
 #include "libfwevt_date_time.h"
 #include "libfwevt_definitions.h"
 #include "libfwevt_floating_point.h"
 #include "libfwevt_integer.h"
-#include "libfwevt_libcdata.h"
 #include "libfwevt_libcerror.h"
 #include "libfwevt_libfdatetime.h"
 #include "libfwevt_libfguid.h"
@@ -50,9 +51,41 @@ int libfwevt_xml_value_initialize(
      libfwevt_xml_value_t **xml_value,
      uint8_t value_type,
      libcerror_error_t **error )
+{
+	static char *function = "libfwevt_xml_value_initialize";
+
+	if( libfwevt_xml_value_initialize_with_arena(
+	     xml_value,
+	     value_type,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create XML value.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Creates a XML value
+ * Make sure the value xml_value is referencing, is set to NULL
+ * If an arena is provided the XML value, its data segments array and data segments are
+ * allocated from the arena
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_value_initialize_with_arena(
+     libfwevt_xml_value_t **xml_value,
+     uint8_t value_type,
+     libfwevt_arena_t *arena,
+     libcerror_error_t **error )
 {
 	libfwevt_internal_xml_value_t *internal_xml_value = NULL;
-	static char *function                             = "libfwevt_xml_value_initialize";
+	static char *function                             = "libfwevt_xml_value_initialize_with_arena";
 
 	if( xml_value == NULL )
 	{
@@ -76,19 +109,40 @@ int libfwevt_xml_value_initialize(
 
 		return( -1 );
 	}
-	internal_xml_value = memory_allocate_structure(
-	                      libfwevt_internal_xml_value_t );
+	if( arena != NULL )
+	{
+		if( libfwevt_arena_allocate(
+		     arena,
+		     sizeof( libfwevt_internal_xml_value_t ),
+		     (void **) &internal_xml_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create XML value.",
+			 function );
 
-	if( internal_xml_value == NULL )
+			return( -1 );
+		}
+	}
+	else
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_MEMORY,
-		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-		 "%s: unable to create XML value.",
-		 function );
+		internal_xml_value = memory_allocate_structure(
+		                      libfwevt_internal_xml_value_t );
 
-		goto on_error;
+		if( internal_xml_value == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create XML value.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	if( memory_set(
 	     internal_xml_value,
@@ -102,14 +156,18 @@ int libfwevt_xml_value_initialize(
 		 "%s: unable to clear XML value.",
 		 function );
 
-		memory_free(
-		 internal_xml_value );
-
+		if( arena == NULL )
+		{
+			memory_free(
+			 internal_xml_value );
+		}
 		return( -1 );
 	}
-	if( libcdata_array_initialize(
+	internal_xml_value->arena = arena;
+
+	if( libfwevt_array_initialize_with_arena(
 	     &( internal_xml_value->data_segments ),
-	     0,
+	     arena,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -128,7 +186,8 @@ int libfwevt_xml_value_initialize(
 	return( 1 );
 
 on_error:
-	if( internal_xml_value != NULL )
+	if( ( internal_xml_value != NULL )
+	 && ( arena == NULL ) )
 	{
 		memory_free(
 		 internal_xml_value );
@@ -186,7 +245,7 @@ int libfwevt_internal_xml_value_free(
 	}
 	if( *internal_xml_value != NULL )
 	{
-		if( libcdata_array_free(
+		if( libfwevt_array_free(
 		     &( ( *internal_xml_value )->data_segments ),
 		     (int (*)(intptr_t **, libcerror_error_t **)) &libfwevt_data_segment_free,
 		     error ) != 1 )
@@ -200,14 +259,58 @@ int libfwevt_internal_xml_value_free(
 
 			result = -1;
 		}
-		memory_free(
-		 *internal_xml_value );
-
+		if( ( *internal_xml_value )->arena == NULL )
+		{
+			memory_free(
+			 *internal_xml_value );
+		}
 		*internal_xml_value = NULL;
 	}
 	return( result );
 }
 
+/* Empties a XML value and sets its value type
+ * The data segments are freed, the XML value itself is retained for reuse
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_internal_xml_value_empty(
+     libfwevt_internal_xml_value_t *internal_xml_value,
+     uint8_t value_type,
+     libcerror_error_t **error )
+{
+	static char *function = "libfwevt_internal_xml_value_empty";
+
+	if( internal_xml_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_array_empty(
+	     internal_xml_value->data_segments,
+	     (int (*)(intptr_t **, libcerror_error_t **)) &libfwevt_data_segment_free,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to empty data segments array.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_value->value_type = value_type;
+	internal_xml_value->data_size  = 0;
+
+	return( 1 );
+}
+
 /* Retrieves the value type
  * Returns 1 if successful or -1 on error
  */
@@ -272,7 +375,7 @@ int libfwevt_xml_value_get_number_of_data_segments(
 	}
 	internal_xml_value = (libfwevt_internal_xml_value_t *) xml_value;
 
-	if( libcdata_array_get_number_of_entries(
+	if( libfwevt_array_get_number_of_entries(
 	     internal_xml_value->data_segments,
 	     number_of_data_segments,
 	     error ) != 1 )
@@ -289,6 +392,90 @@ int libfwevt_xml_value_get_number_of_data_segments(
 	return( 1 );
 }
 
+/* Retrieves the data of a specific data segment
+ * The data is not copied and remains owned by the XML value
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_xml_value_get_data_segment_data(
+     libfwevt_xml_value_t *xml_value,
+     int data_segment_index,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	libfwevt_data_segment_t *data_segment             = NULL;
+	libfwevt_internal_xml_value_t *internal_xml_value = NULL;
+	static char *function                             = "libfwevt_xml_value_get_data_segment_data";
+
+	if( xml_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_xml_value = (libfwevt_internal_xml_value_t *) xml_value;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_array_get_entry_by_index(
+	     internal_xml_value->data_segments,
+	     data_segment_index,
+	     (intptr_t **) &data_segment,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data segment: %d.",
+		 function,
+		 data_segment_index );
+
+		return( -1 );
+	}
+	if( data_segment == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing data segment: %d.",
+		 function,
+		 data_segment_index );
+
+		return( -1 );
+	}
+	*data      = data_segment->data;
+	*data_size = data_segment->data_size;
+
+	return( 1 );
+}
+
 /* Retrieves a specific data segment and initialized its cached value
  * Returns 1 if successful or -1 on error
  */
@@ -323,7 +510,7 @@ int libfwevt_internal_xml_value_get_data_segment_with_cached_value(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
+	if( libfwevt_array_get_entry_by_index(
 	     internal_xml_value->data_segments,
 	     data_segment_index,
 	     (intptr_t **) &safe_data_segment,
@@ -353,220 +540,21 @@ int libfwevt_internal_xml_value_get_data_segment_with_cached_value(
 	}
 	if( safe_data_segment->cached_value_type == 0 )
 	{
-		switch( internal_xml_value->value_type & 0x7f )
+		if( libfwevt_data_segment_set_cached_value(
+		     safe_data_segment,
+		     internal_xml_value->value_type,
+		     error ) != 1 )
 		{
-			case LIBFWEVT_VALUE_TYPE_INTEGER_8BIT:
-			case LIBFWEVT_VALUE_TYPE_UNSIGNED_INTEGER_8BIT:
-				if( safe_data_segment->data_size != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-					 "%s: invalid data segment: %d - unsupported data size.",
-					 function,
-					 safe_data_segment );
-
-					return( -1 );
-				}
-				safe_data_segment->value_64bit = safe_data_segment->data[ 0 ];
-
-				break;
-
-			case LIBFWEVT_VALUE_TYPE_INTEGER_16BIT:
-			case LIBFWEVT_VALUE_TYPE_UNSIGNED_INTEGER_16BIT:
-				if( safe_data_segment->data_size != 2 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-					 "%s: invalid data segment: %d - unsupported data size.",
-					 function,
-					 safe_data_segment );
-
-					return( -1 );
-				}
-				byte_stream_copy_to_uint16_little_endian(
-				 safe_data_segment->data,
-				 safe_data_segment->value_64bit );
-
-				break;
-
-			case LIBFWEVT_VALUE_TYPE_INTEGER_32BIT:
-			case LIBFWEVT_VALUE_TYPE_UNSIGNED_INTEGER_32BIT:
-			case LIBFWEVT_VALUE_TYPE_HEXADECIMAL_INTEGER_32BIT:
-			case LIBFWEVT_VALUE_TYPE_FLOATING_POINT_32BIT:
-			case LIBFWEVT_VALUE_TYPE_BOOLEAN:
-				if( safe_data_segment->data_size != 4 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-					 "%s: invalid data segment: %d - unsupported data size.",
-					 function,
-					 safe_data_segment );
-
-					return( -1 );
-				}
-				byte_stream_copy_to_uint32_little_endian(
-				 safe_data_segment->data,
-				 safe_data_segment->value_64bit );
-
-				break;
-
-			case LIBFWEVT_VALUE_TYPE_INTEGER_64BIT:
-			case LIBFWEVT_VALUE_TYPE_UNSIGNED_INTEGER_64BIT:
-			case LIBFWEVT_VALUE_TYPE_HEXADECIMAL_INTEGER_64BIT:
-			case LIBFWEVT_VALUE_TYPE_FLOATING_POINT_64BIT:
-				if( safe_data_segment->data_size != 8 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-					 "%s: invalid data segment: %d - unsupported data size.",
-					 function,
-					 safe_data_segment );
-
-					return( -1 );
-				}
-				byte_stream_copy_to_uint64_little_endian(
-				 safe_data_segment->data,
-				 safe_data_segment->value_64bit );
-
-				break;
-
-			case LIBFWEVT_VALUE_TYPE_GUID:
-				if( libfguid_identifier_initialize(
-				     &( safe_data_segment->guid ),
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create GUID.",
-					 function );
-
-					return( -1 );
-				}
-				if( libfguid_identifier_copy_from_byte_stream(
-				     safe_data_segment->guid,
-				     safe_data_segment->data,
-				     safe_data_segment->data_size,
-				     LIBFGUID_ENDIAN_LITTLE,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-					 "%s: unable to copy byte stream to GUID.",
-					 function );
-
-					return( -1 );
-				}
-				break;
-
-			case LIBFWEVT_VALUE_TYPE_FILETIME:
-				if( libfdatetime_filetime_initialize(
-				     &( safe_data_segment->filetime ),
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create FILETIME.",
-					 function );
-
-					return( -1 );
-				}
-				if( libfdatetime_filetime_copy_from_byte_stream(
-				     safe_data_segment->filetime,
-				     safe_data_segment->data,
-				     safe_data_segment->data_size,
-				     LIBFDATETIME_ENDIAN_LITTLE,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-					 "%s: unable to copy byte stream to FILETIME.",
-					 function );
-
-					return( -1 );
-				}
-				break;
-
-			case LIBFWEVT_VALUE_TYPE_SYSTEMTIME:
-				if( libfdatetime_systemtime_initialize(
-				     &( safe_data_segment->systemtime ),
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create SYSTEMTIME.",
-					 function );
-
-					return( -1 );
-				}
-				if( libfdatetime_systemtime_copy_from_byte_stream(
-				     safe_data_segment->systemtime,
-				     safe_data_segment->data,
-				     safe_data_segment->data_size,
-				     LIBFDATETIME_ENDIAN_LITTLE,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-					 "%s: unable to copy byte stream to SYSTEMTIME.",
-					 function );
-
-					return( -1 );
-				}
-				break;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set cached value of data segment: %d.",
+			 function,
+			 data_segment_index );
 
-			case LIBFWEVT_VALUE_TYPE_NT_SECURITY_IDENTIFIER:
-				if( libfwnt_security_identifier_initialize(
-				     &( safe_data_segment->security_identifier ),
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-					 "%s: unable to create NT security identifier.",
-					 function );
-
-					return( -1 );
-				}
-				if( libfwnt_security_identifier_copy_from_byte_stream(
-				     safe_data_segment->security_identifier,
-				     safe_data_segment->data,
-				     safe_data_segment->data_size,
-				     LIBFWNT_ENDIAN_LITTLE,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
-					 "%s: unable to copy byte stream to NT security identifier.",
-					 function );
-
-					return( -1 );
-				}
-				break;
+			return( -1 );
 		}
-		safe_data_segment->cached_value_type = internal_xml_value->value_type & 0x7f;
 	}
 	*data_segment = safe_data_segment;
 
@@ -574,12 +562,14 @@ int libfwevt_internal_xml_value_get_data_segment_with_cached_value(
 }
 
 /* Appends a data segment
+ * The flags are passed to the data segment, refer to libfwevt_data_segment_initialize_with_arena
  * Returns 1 if successful or -1 on error
  */
 int libfwevt_xml_value_append_data_segment(
      libfwevt_xml_value_t *xml_value,
      const uint8_t *data,
      size_t data_size,
+     uint8_t flags,
      int *data_segment_index,
      libcerror_error_t **error )
 {
@@ -600,10 +590,12 @@ int libfwevt_xml_value_append_data_segment(
 	}
 	internal_xml_value = (libfwevt_internal_xml_value_t *) xml_value;
 
-	if( libfwevt_data_segment_initialize(
+	if( libfwevt_data_segment_initialize_with_arena(
 	     &data_segment,
 	     data,
 	     data_size,
+	     flags,
+	     internal_xml_value->arena,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -615,7 +607,7 @@ int libfwevt_xml_value_append_data_segment(
 
 		goto on_error;
 	}
-	if( libcdata_array_append_entry(
+	if( libfwevt_array_append_entry(
 	     internal_xml_value->data_segments,
 	     data_segment_index,
 	     (intptr_t *) data_segment,
@@ -736,7 +728,7 @@ int libfwevt_xml_value_copy_data(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
+	if( libfwevt_array_get_number_of_entries(
 	     internal_xml_value->data_segments,
 	     &number_of_data_segments,
 	     error ) != 1 )
@@ -754,7 +746,7 @@ int libfwevt_xml_value_copy_data(
 	     data_segment_index < number_of_data_segments;
 	     data_segment_index++ )
 	{
-		if( libcdata_array_get_entry_by_index(
+		if( libfwevt_array_get_entry_by_index(
 		     internal_xml_value->data_segments,
 		     data_segment_index,
 		     (intptr_t **) &data_segment,
@@ -1185,7 +1177,7 @@ int libfwevt_value_get_data_as_filetime(
 	{
 		return( 0 );
 	}
-	if( libcdata_array_get_entry_by_index(
+	if( libfwevt_array_get_entry_by_index(
 	     internal_xml_value->data_segments,
 	     0,
 	     (intptr_t **) &data_segment,
@@ -1275,6 +1267,8 @@ int libfwevt_internal_xml_value_get_data_segment_as_utf8_string_size(
      int ascii_codepage,
      libcerror_error_t **error )
 {
+	libfwevt_data_segment_t temporary_data_segment;
+
 	static char *function        = "libfwevt_internal_xml_value_get_data_segment_as_utf8_string_size";
 	size_t base16_stream_size    = 0;
 	size_t safe_utf8_string_size = 0;
@@ -1314,6 +1308,53 @@ int libfwevt_internal_xml_value_get_data_segment_as_utf8_string_size(
 
 		return( -1 );
 	}
+	/* The GUID, FILETIME, SYSTEMTIME and NT security identifier values are not cached
+	 * for a data segment allocated from an arena hence a temporary data segment is used
+	 */
+	if( ( data_segment->cached_value_type == 0 )
+	 && ( data_segment->arena != NULL ) )
+	{
+		if( libfwevt_data_segment_copy_with_cached_value(
+		     &temporary_data_segment,
+		     data_segment,
+		     internal_xml_value->value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy data segment: %d.",
+			 function,
+			 data_segment_index );
+
+			return( -1 );
+		}
+		result = libfwevt_internal_xml_value_get_data_segment_as_utf8_string_size(
+		          internal_xml_value,
+		          data_segment_index,
+		          &temporary_data_segment,
+		          utf8_string_size,
+		          escape_characters,
+		          ascii_codepage,
+		          error );
+
+		if( libfwevt_data_segment_clear_cached_value(
+		     &temporary_data_segment,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear cached value of data segment: %d.",
+			 function,
+			 data_segment_index );
+
+			result = -1;
+		}
+		return( result );
+	}
 	switch( internal_xml_value->value_type & 0x7f )
 	{
 		case LIBFWEVT_VALUE_TYPE_STRING_UTF16:
@@ -1543,6 +1584,8 @@ int libfwevt_internal_xml_value_get_data_segment_as_utf8_string(
      int ascii_codepage,
      libcerror_error_t **error )
 {
+	libfwevt_data_segment_t temporary_data_segment;
+
 	static char *function         = "libfwevt_internal_xml_value_get_data_segment_as_utf8_string";
 	size_t base16_stream_index    = 0;
 	size_t safe_utf8_string_index = 0;
@@ -1605,6 +1648,55 @@ int libfwevt_internal_xml_value_get_data_segment_as_utf8_string(
 
 		return( -1 );
 	}
+	/* The GUID, FILETIME, SYSTEMTIME and NT security identifier values are not cached
+	 * for a data segment allocated from an arena hence a temporary data segment is used
+	 */
+	if( ( data_segment->cached_value_type == 0 )
+	 && ( data_segment->arena != NULL ) )
+	{
+		if( libfwevt_data_segment_copy_with_cached_value(
+		     &temporary_data_segment,
+		     data_segment,
+		     internal_xml_value->value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy data segment: %d.",
+			 function,
+			 data_segment_index );
+
+			return( -1 );
+		}
+		result = libfwevt_internal_xml_value_get_data_segment_as_utf8_string(
+		          internal_xml_value,
+		          data_segment_index,
+		          &temporary_data_segment,
+		          utf8_string,
+		          utf8_string_size,
+		          utf8_string_index,
+		          escape_characters,
+		          ascii_codepage,
+		          error );
+
+		if( libfwevt_data_segment_clear_cached_value(
+		     &temporary_data_segment,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear cached value of data segment: %d.",
+			 function,
+			 data_segment_index );
+
+			result = -1;
+		}
+		return( result );
+	}
 	switch( internal_xml_value->value_type & 0x7f )
 	{
 		case LIBFWEVT_VALUE_TYPE_STRING_UTF16:
@@ -1924,7 +2016,7 @@ int libfwevt_internal_xml_value_get_data_as_utf8_string_size(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
+	if( libfwevt_array_get_number_of_entries(
 	     internal_xml_value->data_segments,
 	     &number_of_data_segments,
 	     error ) != 1 )
@@ -2069,7 +2161,7 @@ int libfwevt_internal_xml_value_get_data_as_utf8_string_with_index(
 	}
 	safe_utf8_string_index = *utf8_string_index;
 
-	if( libcdata_array_get_number_of_entries(
+	if( libfwevt_array_get_number_of_entries(
 	     internal_xml_value->data_segments,
 	     &number_of_data_segments,
 	     error ) != 1 )
@@ -2159,6 +2251,163 @@ int libfwevt_internal_xml_value_get_data_as_utf8_string_with_index(
 	return( 1 );
 }
 
+/* Retrieves the maximum size of the data formatted as an UTF-8 string
+ * The maximum size is determined from the value type and data size without formatting the data,
+ * it includes the end of string character of every data segment
+ * Returns 1 if successful or -1 on error
+ */
+int libfwevt_internal_xml_value_get_data_as_utf8_string_maximum_size(
+     libfwevt_internal_xml_value_t *internal_xml_value,
+     size_t *utf8_string_size,
+     uint8_t escape_characters,
+     libcerror_error_t **error )
+{
+	static char *function        = "libfwevt_internal_xml_value_get_data_as_utf8_string_maximum_size";
+	size_t data_segment_size     = 0;
+	size_t maximum_data_size     = 0;
+	size_t safe_utf8_string_size = 0;
+	int number_of_data_segments  = 0;
+
+	if( internal_xml_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid XML value.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfwevt_array_get_number_of_entries(
+	     internal_xml_value->data_segments,
+	     &number_of_data_segments,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of data segments.",
+		 function );
+
+		return( -1 );
+	}
+	/* The maximum size is bound by the maximum allocation size so that the calculations below cannot overflow
+	 */
+	maximum_data_size = (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 16;
+
+	if( internal_xml_value->data_size > maximum_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid XML value - data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	switch( internal_xml_value->value_type & 0x7f )
+	{
+		case LIBFWEVT_VALUE_TYPE_STRING_UTF16:
+			/* An UTF-16 character is encoded as at most 3 UTF-8 bytes, a surrogate pair as 4,
+			 * and an escaped character as at most 6 bytes, such as "&quot;"
+			 */
+			safe_utf8_string_size = ( internal_xml_value->data_size + 1 ) / 2;
+
+			if( escape_characters == 0 )
+			{
+				safe_utf8_string_size *= 3;
+			}
+			else
+			{
+				safe_utf8_string_size *= 6;
+			}
+			break;
+
+		case LIBFWEVT_VALUE_TYPE_STRING_BYTE_STREAM:
+			safe_utf8_string_size = internal_xml_value->data_size * 3;
+			break;
+
+		case LIBFWEVT_VALUE_TYPE_BINARY_DATA:
+			safe_utf8_string_size = internal_xml_value->data_size * 2;
+			break;
+
+		case LIBFWEVT_VALUE_TYPE_INTEGER_8BIT:
+		case LIBFWEVT_VALUE_TYPE_INTEGER_16BIT:
+		case LIBFWEVT_VALUE_TYPE_INTEGER_32BIT:
+		case LIBFWEVT_VALUE_TYPE_INTEGER_64BIT:
+		case LIBFWEVT_VALUE_TYPE_UNSIGNED_INTEGER_8BIT:
+		case LIBFWEVT_VALUE_TYPE_UNSIGNED_INTEGER_16BIT:
+		case LIBFWEVT_VALUE_TYPE_UNSIGNED_INTEGER_32BIT:
+		case LIBFWEVT_VALUE_TYPE_UNSIGNED_INTEGER_64BIT:
+			/* "[-]18446744073709551615" */
+			data_segment_size = 21;
+			break;
+
+		case LIBFWEVT_VALUE_TYPE_FLOATING_POINT_32BIT:
+		case LIBFWEVT_VALUE_TYPE_FLOATING_POINT_64BIT:
+			/* "[-]0.000000e[+-]000" */
+			data_segment_size = 15;
+			break;
+
+		case LIBFWEVT_VALUE_TYPE_BOOLEAN:
+			/* "false" */
+			data_segment_size = 6;
+			break;
+
+		case LIBFWEVT_VALUE_TYPE_GUID:
+			/* "{00000000-0000-0000-0000-000000000000}" */
+			data_segment_size = 39;
+			break;
+
+		case LIBFWEVT_VALUE_TYPE_FILETIME:
+		case LIBFWEVT_VALUE_TYPE_SYSTEMTIME:
+			/* "YYYY-MM-DDThh:mm:ss.nnnnnnnnnZ" or "(0x00000000 0x00000000)"
+			 * with room to spare for years beyond 9999
+			 */
+			data_segment_size = 48;
+			break;
+
+		case LIBFWEVT_VALUE_TYPE_NT_SECURITY_IDENTIFIER:
+			/* "S-255-281474976710655" followed by "-4294967295" per 32-bit sub authority
+			 */
+			data_segment_size     = 24;
+			safe_utf8_string_size = ( internal_xml_value->data_size / 4 ) * 11;
+			break;
+
+		case LIBFWEVT_VALUE_TYPE_HEXADECIMAL_INTEGER_32BIT:
+		case LIBFWEVT_VALUE_TYPE_HEXADECIMAL_INTEGER_64BIT:
+		case LIBFWEVT_VALUE_TYPE_SIZE:
+			/* "0x0000000000000000" */
+			data_segment_size = 19;
+			break;
+
+		default:
+			break;
+	}
+	/* The size of the formatted data segment and the end of string character
+	 * per data segment
+	 */
+	safe_utf8_string_size += ( data_segment_size + 1 ) * (size_t) number_of_data_segments;
+
+	*utf8_string_size = safe_utf8_string_size;
+
+	return( 1 );
+}
+
 /* Retrieves the size of an UTF-8 encoded string of the value data
  * Returns 1 if successful or -1 on error
  */
@@ -2329,6 +2578,8 @@ int libfwevt_internal_xml_value_get_data_segment_as_utf16_string_size(
      int ascii_codepage,
      libcerror_error_t **error )
 {
+	libfwevt_data_segment_t temporary_data_segment;
+
 	static char *function         = "libfwevt_internal_xml_value_get_data_segment_as_utf16_string_size";
 	size_t base16_stream_size     = 0;
 	size_t safe_utf16_string_size = 0;
@@ -2368,6 +2619,53 @@ int libfwevt_internal_xml_value_get_data_segment_as_utf16_string_size(
 
 		return( -1 );
 	}
+	/* The GUID, FILETIME, SYSTEMTIME and NT security identifier values are not cached
+	 * for a data segment allocated from an arena hence a temporary data segment is used
+	 */
+	if( ( data_segment->cached_value_type == 0 )
+	 && ( data_segment->arena != NULL ) )
+	{
+		if( libfwevt_data_segment_copy_with_cached_value(
+		     &temporary_data_segment,
+		     data_segment,
+		     internal_xml_value->value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy data segment: %d.",
+			 function,
+			 data_segment_index );
+
+			return( -1 );
+		}
+		result = libfwevt_internal_xml_value_get_data_segment_as_utf16_string_size(
+		          internal_xml_value,
+		          data_segment_index,
+		          &temporary_data_segment,
+		          utf16_string_size,
+		          escape_characters,
+		          ascii_codepage,
+		          error );
+
+		if( libfwevt_data_segment_clear_cached_value(
+		     &temporary_data_segment,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear cached value of data segment: %d.",
+			 function,
+			 data_segment_index );
+
+			result = -1;
+		}
+		return( result );
+	}
 	switch( internal_xml_value->value_type & 0x7f )
 	{
 		case LIBFWEVT_VALUE_TYPE_STRING_UTF16:
@@ -2602,6 +2900,8 @@ int libfwevt_internal_xml_value_get_data_segment_as_utf16_string(
      int ascii_codepage,
      libcerror_error_t **error )
 {
+	libfwevt_data_segment_t temporary_data_segment;
+
 	static char *function          = "libfwevt_internal_xml_value_get_data_segment_as_utf16_string";
 	size_t base16_stream_index     = 0;
 	size_t safe_utf16_string_index = 0;
@@ -2680,6 +2980,55 @@ int libfwevt_internal_xml_value_get_data_segment_as_utf16_string(
 
 		return( -1 );
 	}
+	/* The GUID, FILETIME, SYSTEMTIME and NT security identifier values are not cached
+	 * for a data segment allocated from an arena hence a temporary data segment is used
+	 */
+	if( ( data_segment->cached_value_type == 0 )
+	 && ( data_segment->arena != NULL ) )
+	{
+		if( libfwevt_data_segment_copy_with_cached_value(
+		     &temporary_data_segment,
+		     data_segment,
+		     internal_xml_value->value_type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+			 "%s: unable to copy data segment: %d.",
+			 function,
+			 data_segment_index );
+
+			return( -1 );
+		}
+		result = libfwevt_internal_xml_value_get_data_segment_as_utf16_string(
+		          internal_xml_value,
+		          data_segment_index,
+		          &temporary_data_segment,
+		          utf16_string,
+		          utf16_string_size,
+		          utf16_string_index,
+		          escape_characters,
+		          ascii_codepage,
+		          error );
+
+		if( libfwevt_data_segment_clear_cached_value(
+		     &temporary_data_segment,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to clear cached value of data segment: %d.",
+			 function,
+			 data_segment_index );
+
+			result = -1;
+		}
+		return( result );
+	}
 	switch( internal_xml_value->value_type & 0x7f )
 	{
 		case LIBFWEVT_VALUE_TYPE_STRING_UTF16:
@@ -3005,7 +3354,7 @@ int libfwevt_internal_xml_value_get_data_as_utf16_string_size(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_number_of_entries(
+	if( libfwevt_array_get_number_of_entries(
 	     internal_xml_value->data_segments,
 	     &number_of_data_segments,
 	     error ) != 1 )
@@ -3150,7 +3499,7 @@ int libfwevt_internal_xml_value_get_data_as_utf16_string_with_index(
 	}
 	safe_utf16_string_index = *utf16_string_index;
 
-	if( libcdata_array_get_number_of_entries(
+	if( libfwevt_array_get_number_of_entries(
 	     internal_xml_value->data_segments,
 	     &number_of_data_segments,
 	     error ) != 1 )
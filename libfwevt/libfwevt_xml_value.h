@@ -25,9 +25,10 @@
 #include <common.h>
 #include <types.h>
 
+#include "libfwevt_arena.h"
+#include "libfwevt_array.h"
 #include "libfwevt_data_segment.h"
 #include "libfwevt_extern.h"
-#include "libfwevt_libcdata.h"
 #include "libfwevt_libcerror.h"
 #include "libfwevt_libcnotify.h"
 #include "libfwevt_types.h"
@@ -46,11 +47,16 @@ struct libfwevt_internal_xml_value
 
 	/* The data segments
 	 */
-	libcdata_array_t *data_segments;
+	libfwevt_array_t *data_segments;
 
 	/* The data size
 	 */
 	size_t data_size;
+
+	/* The arena
+	 * Only set if the XML value was allocated from an arena
+	 */
+	libfwevt_arena_t *arena;
 };
 
 int libfwevt_xml_value_initialize(
@@ -58,6 +64,12 @@ int libfwevt_xml_value_initialize(
      uint8_t value_type,
      libcerror_error_t **error );
 
+int libfwevt_xml_value_initialize_with_arena(
+     libfwevt_xml_value_t **xml_value,
+     uint8_t value_type,
+     libfwevt_arena_t *arena,
+     libcerror_error_t **error );
+
 LIBFWEVT_EXTERN \
 int libfwevt_xml_value_free(
      libfwevt_xml_value_t **xml_value,
@@ -67,6 +79,11 @@ int libfwevt_internal_xml_value_free(
      libfwevt_internal_xml_value_t **internal_xml_value,
      libcerror_error_t **error );
 
+int libfwevt_internal_xml_value_empty(
+     libfwevt_internal_xml_value_t *internal_xml_value,
+     uint8_t value_type,
+     libcerror_error_t **error );
+
 int libfwevt_xml_value_get_type(
      libfwevt_xml_value_t *xml_value,
      uint8_t *value_type,
@@ -77,6 +94,13 @@ int libfwevt_xml_value_get_number_of_data_segments(
      int *number_of_data_segments,
      libcerror_error_t **error );
 
+int libfwevt_xml_value_get_data_segment_data(
+     libfwevt_xml_value_t *xml_value,
+     int data_segment_index,
+     const uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
 int libfwevt_internal_xml_value_get_data_segment_with_cached_value(
      libfwevt_internal_xml_value_t *internal_xml_value,
      int data_segment_index,
@@ -87,6 +111,7 @@ int libfwevt_xml_value_append_data_segment(
      libfwevt_xml_value_t *xml_value,
      const uint8_t *data,
      size_t data_size,
+     uint8_t flags,
      int *data_segment_index,
      libcerror_error_t **error );
 
@@ -163,6 +188,12 @@ int libfwevt_internal_xml_value_get_data_as_utf8_string_with_index(
      int ascii_codepage,
      libcerror_error_t **error );
 
+int libfwevt_internal_xml_value_get_data_as_utf8_string_maximum_size(
+     libfwevt_internal_xml_value_t *internal_xml_value,
+     size_t *utf8_string_size,
+     uint8_t escape_characters,
+     libcerror_error_t **error );
+
 LIBFWEVT_EXTERN \
 int libfwevt_xml_value_get_utf8_string_size(
      libfwevt_xml_value_t *xml_value,
@@ -0,0 +1,677 @@
+/*
+ * Library arena type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwevt_test_libcerror.h"
+#include "fwevt_test_libfwevt.h"
+#include "fwevt_test_macros.h"
+#include "fwevt_test_memory.h"
+#include "fwevt_test_unused.h"
+
+#include "../libfwevt/libfwevt_arena.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+
+/* Tests the libfwevt_arena_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_arena_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libfwevt_arena_t *arena         = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_FWEVT_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int number_of_memset_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfwevt_arena_initialize(
+	          &arena,
+	          1024,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_arena_free(
+	          &arena,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_arena_initialize(
+	          NULL,
+	          1024,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	arena = (libfwevt_arena_t *) 0x12345678UL;
+
+	result = libfwevt_arena_initialize(
+	          &arena,
+	          1024,
+	          &error );
+
+	arena = NULL;
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_arena_initialize(
+	          &arena,
+	          0,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FWEVT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwevt_arena_initialize with malloc failing
+		 */
+		fwevt_test_malloc_attempts_before_fail = test_number;
+
+		result = libfwevt_arena_initialize(
+		          &arena,
+		          1024,
+		          &error );
+
+		if( fwevt_test_malloc_attempts_before_fail != -1 )
+		{
+			fwevt_test_malloc_attempts_before_fail = -1;
+
+			if( arena != NULL )
+			{
+				libfwevt_arena_free(
+				 &arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWEVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWEVT_TEST_ASSERT_IS_NULL(
+			 "arena",
+			 arena );
+
+			FWEVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwevt_arena_initialize with memset failing
+		 */
+		fwevt_test_memset_attempts_before_fail = test_number;
+
+		result = libfwevt_arena_initialize(
+		          &arena,
+		          1024,
+		          &error );
+
+		if( fwevt_test_memset_attempts_before_fail != -1 )
+		{
+			fwevt_test_memset_attempts_before_fail = -1;
+
+			if( arena != NULL )
+			{
+				libfwevt_arena_free(
+				 &arena,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWEVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWEVT_TEST_ASSERT_IS_NULL(
+			 "arena",
+			 arena );
+
+			FWEVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FWEVT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libfwevt_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_arena_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_arena_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfwevt_arena_free(
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_arena_allocate and libfwevt_arena_reset functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_arena_allocate(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	libfwevt_arena_t *arena  = NULL;
+	void *first_memory       = NULL;
+	void *memory             = NULL;
+	int allocation_index     = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfwevt_arena_initialize(
+	          &arena,
+	          1024,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwevt_arena_allocate(
+	          arena,
+	          1,
+	          &first_memory,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "first_memory",
+	 first_memory );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "first_memory alignment",
+	 (int) ( (intptr_t) first_memory % 16 ),
+	 0 );
+
+	result = libfwevt_arena_allocate(
+	          arena,
+	          24,
+	          &memory,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "memory offset",
+	 (int) ( (uint8_t *) memory - (uint8_t *) first_memory ),
+	 16 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test allocations that span multiple blocks
+	 */
+	for( allocation_index = 0;
+	     allocation_index < 256;
+	     allocation_index++ )
+	{
+		result = libfwevt_arena_allocate(
+		          arena,
+		          48,
+		          &memory,
+		          &error );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWEVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "memory alignment",
+		 (int) ( (intptr_t) memory % 16 ),
+		 0 );
+
+		memory_set(
+		 memory,
+		 0xff,
+		 48 );
+	}
+	/* Test an allocation that is larger than the block size
+	 */
+	result = libfwevt_arena_allocate(
+	          arena,
+	          4096,
+	          &memory,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "memory",
+	 memory );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 memory,
+	 0xff,
+	 4096 );
+
+	/* Test that the blocks are reused after a reset
+	 */
+	result = libfwevt_arena_reset(
+	          arena,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_arena_allocate(
+	          arena,
+	          8,
+	          &memory,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "memory is first_memory",
+	 (int) ( memory == first_memory ),
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( allocation_index = 0;
+	     allocation_index < 512;
+	     allocation_index++ )
+	{
+		result = libfwevt_arena_allocate(
+		          arena,
+		          48,
+		          &memory,
+		          &error );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWEVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		memory_set(
+		 memory,
+		 0xff,
+		 48 );
+	}
+	/* Test error cases
+	 */
+	result = libfwevt_arena_allocate(
+	          NULL,
+	          8,
+	          &memory,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_arena_allocate(
+	          arena,
+	          0,
+	          &memory,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_arena_allocate(
+	          arena,
+	          8,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_arena_reset(
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FWEVT_TEST_MEMORY )
+
+	/* Test libfwevt_arena_allocate with malloc failing
+	 */
+	fwevt_test_malloc_attempts_before_fail = 0;
+
+	result = libfwevt_arena_allocate(
+	          arena,
+	          8192,
+	          &memory,
+	          &error );
+
+	if( fwevt_test_malloc_attempts_before_fail != -1 )
+	{
+		fwevt_test_malloc_attempts_before_fail = -1;
+	}
+	else
+	{
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FWEVT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+#endif /* defined( HAVE_FWEVT_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libfwevt_arena_free(
+	          &arena,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libfwevt_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWEVT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWEVT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWEVT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWEVT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWEVT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWEVT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_arena_initialize",
+	 fwevt_test_arena_initialize );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_arena_free",
+	 fwevt_test_arena_free );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_arena_allocate",
+	 fwevt_test_arena_allocate );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
+}
+
@@ -0,0 +1,591 @@
+/*
+ * Library array type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwevt_test_libcerror.h"
+#include "fwevt_test_libfwevt.h"
+#include "fwevt_test_macros.h"
+#include "fwevt_test_memory.h"
+#include "fwevt_test_unused.h"
+
+#include "../libfwevt/libfwevt_arena.h"
+#include "../libfwevt/libfwevt_array.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+
+/* Tests the libfwevt_array_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_array_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libfwevt_array_t *array         = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_FWEVT_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfwevt_array_initialize(
+	          &array,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "array",
+	 array );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_array_free(
+	          &array,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "array",
+	 array );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_array_initialize(
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	array = (libfwevt_array_t *) 0x12345678UL;
+
+	result = libfwevt_array_initialize(
+	          &array,
+	          &error );
+
+	array = NULL;
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FWEVT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwevt_array_initialize with malloc failing
+		 */
+		fwevt_test_malloc_attempts_before_fail = test_number;
+
+		result = libfwevt_array_initialize(
+		          &array,
+		          &error );
+
+		if( fwevt_test_malloc_attempts_before_fail != -1 )
+		{
+			fwevt_test_malloc_attempts_before_fail = -1;
+
+			if( array != NULL )
+			{
+				libfwevt_array_free(
+				 &array,
+				 NULL,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWEVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWEVT_TEST_ASSERT_IS_NULL(
+			 "array",
+			 array );
+
+			FWEVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FWEVT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( array != NULL )
+	{
+		libfwevt_array_free(
+		 &array,
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_array_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_array_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfwevt_array_free(
+	          NULL,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_array_append_entry, libfwevt_array_get_number_of_entries,
+ * libfwevt_array_get_entry_by_index and libfwevt_array_empty functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_array_append_entry(
+     libfwevt_arena_t *arena )
+{
+	int values[ 9 ]          = { 0, 1, 2, 3, 4, 5, 6, 7, 8 };
+
+	libcerror_error_t *error = NULL;
+	libfwevt_array_t *array  = NULL;
+	intptr_t *entry          = NULL;
+	int entry_index          = 0;
+	int number_of_entries    = 0;
+	int result               = 0;
+	int value_index          = 0;
+
+	/* Initialize test
+	 */
+	result = libfwevt_array_initialize_with_arena(
+	          &array,
+	          arena,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "array",
+	 array );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The number of entries exceeds the initial number of allocated entries
+	 */
+	for( value_index = 0;
+	     value_index < 9;
+	     value_index++ )
+	{
+		result = libfwevt_array_append_entry(
+		          array,
+		          &entry_index,
+		          (intptr_t *) &( values[ value_index ] ),
+		          &error );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "entry_index",
+		 entry_index,
+		 value_index );
+
+		FWEVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfwevt_array_get_number_of_entries(
+	          array,
+	          &number_of_entries,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 9 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 9;
+	     value_index++ )
+	{
+		result = libfwevt_array_get_entry_by_index(
+		          array,
+		          value_index,
+		          &entry,
+		          &error );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "entry",
+		 (int) ( entry == (intptr_t *) &( values[ value_index ] ) ),
+		 1 );
+
+		FWEVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfwevt_array_empty(
+	          array,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_array_get_number_of_entries(
+	          array,
+	          &number_of_entries,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_array_append_entry(
+	          NULL,
+	          &entry_index,
+	          (intptr_t *) &( values[ 0 ] ),
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_array_append_entry(
+	          array,
+	          NULL,
+	          (intptr_t *) &( values[ 0 ] ),
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_array_get_entry_by_index(
+	          array,
+	          0,
+	          &entry,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_array_get_number_of_entries(
+	          array,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwevt_array_free(
+	          &array,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "array",
+	 array );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( array != NULL )
+	{
+		libfwevt_array_free(
+		 &array,
+		 NULL,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWEVT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWEVT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWEVT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWEVT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+	libcerror_error_t *error = NULL;
+	libfwevt_arena_t *arena  = NULL;
+	int result               = 0;
+#endif
+
+	FWEVT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWEVT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_array_initialize",
+	 fwevt_test_array_initialize );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_array_free",
+	 fwevt_test_array_free );
+
+	FWEVT_TEST_RUN_WITH_ARGS(
+	 "libfwevt_array_append_entry",
+	 fwevt_test_array_append_entry,
+	 NULL );
+
+	/* Initialize arena for tests
+	 */
+	result = libfwevt_arena_initialize(
+	          &arena,
+	          1024,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "arena",
+	 arena );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_RUN_WITH_ARGS(
+	 "libfwevt_array_append_entry",
+	 fwevt_test_array_append_entry,
+	 arena );
+
+	/* Clean up
+	 */
+	result = libfwevt_arena_free(
+	          &arena,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "arena",
+	 arena );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( arena != NULL )
+	{
+		libfwevt_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
+}
+
@@ -33,7 +33,9 @@
 #include "fwevt_test_memory.h"
 #include "fwevt_test_unused.h"
 
+#include "../libfwevt/libfwevt_arena.h"
 #include "../libfwevt/libfwevt_data_segment.h"
+#include "../libfwevt/libfwevt_definitions.h"
 
 #if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
 
@@ -279,6 +281,185 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfwevt_data_segment_initialize_with_arena function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_data_segment_initialize_with_arena(
+     void )
+{
+	uint8_t data[ 4 ]                     = { 'd', 'a', 't', 'a' };
+	libcerror_error_t *error              = NULL;
+	libfwevt_arena_t *arena               = NULL;
+	libfwevt_data_segment_t *data_segment = NULL;
+	int result                            = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_data_segment_initialize_with_arena(
+	          &data_segment,
+	          data,
+	          4,
+	          LIBFWEVT_DATA_SEGMENT_FLAG_BORROW_DATA,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "data_segment",
+	 data_segment );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "data_segment->data",
+	 (int) ( data_segment->data == data ),
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "data_segment->data_size",
+	 data_segment->data_size,
+	 (size_t) 4 );
+
+	result = libfwevt_data_segment_free(
+	          &data_segment,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "data_segment",
+	 data_segment );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_arena_initialize(
+	          &arena,
+	          1024,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_data_segment_initialize_with_arena(
+	          &data_segment,
+	          data,
+	          4,
+	          0,
+	          arena,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "data_segment",
+	 data_segment );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "data_segment->data",
+	 (int) ( data_segment->data == data ),
+	 0 );
+
+	result = libfwevt_data_segment_free(
+	          &data_segment,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_data_segment_initialize_with_arena(
+	          &data_segment,
+	          data,
+	          4,
+	          0xff,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "data_segment",
+	 data_segment );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwevt_arena_free(
+	          &arena,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_segment != NULL )
+	{
+		libfwevt_data_segment_free(
+		 &data_segment,
+		 NULL );
+	}
+	if( arena != NULL )
+	{
+		libfwevt_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfwevt_data_segment_free function
  * Returns 1 if successful or 0 if not
  */
@@ -317,6 +498,209 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfwevt_data_segment_copy_with_cached_value function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_data_segment_copy_with_cached_value(
+     void )
+{
+	libfwevt_data_segment_t temporary_data_segment;
+
+	uint8_t data[ 16 ]                    = {
+		0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10 };
+
+	libcerror_error_t *error              = NULL;
+	libfwevt_arena_t *arena               = NULL;
+	libfwevt_data_segment_t *data_segment = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfwevt_arena_initialize(
+	          &arena,
+	          1024,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_data_segment_initialize_with_arena(
+	          &data_segment,
+	          data,
+	          16,
+	          0,
+	          arena,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The GUID value of a data segment allocated from an arena is not cached
+	 */
+	result = libfwevt_data_segment_set_cached_value(
+	          data_segment,
+	          LIBFWEVT_VALUE_TYPE_GUID,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_EQUAL_UINT8(
+	 "data_segment->cached_value_type",
+	 data_segment->cached_value_type,
+	 0 );
+
+	/* Test regular cases
+	 */
+	result = libfwevt_data_segment_copy_with_cached_value(
+	          &temporary_data_segment,
+	          data_segment,
+	          LIBFWEVT_VALUE_TYPE_GUID,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_EQUAL_UINT8(
+	 "temporary_data_segment.cached_value_type",
+	 temporary_data_segment.cached_value_type,
+	 LIBFWEVT_VALUE_TYPE_GUID );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "temporary_data_segment.guid",
+	 temporary_data_segment.guid );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "temporary_data_segment.data",
+	 (int) ( temporary_data_segment.data == data_segment->data ),
+	 1 );
+
+	result = libfwevt_data_segment_clear_cached_value(
+	          &temporary_data_segment,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_data_segment_copy_with_cached_value(
+	          NULL,
+	          data_segment,
+	          LIBFWEVT_VALUE_TYPE_GUID,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_data_segment_copy_with_cached_value(
+	          &temporary_data_segment,
+	          NULL,
+	          LIBFWEVT_VALUE_TYPE_GUID,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwevt_data_segment_free(
+	          &data_segment,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_arena_free(
+	          &arena,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_segment != NULL )
+	{
+		libfwevt_data_segment_free(
+		 &data_segment,
+		 NULL );
+	}
+	if( arena != NULL )
+	{
+		libfwevt_arena_free(
+		 &arena,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
 
 /* The main program
@@ -340,10 +724,18 @@ int main(
 	 "libfwevt_data_segment_initialize",
 	 fwevt_test_data_segment_initialize );
 
+	FWEVT_TEST_RUN(
+	 "libfwevt_data_segment_initialize_with_arena",
+	 fwevt_test_data_segment_initialize_with_arena );
+
 	FWEVT_TEST_RUN(
 	 "libfwevt_data_segment_free",
 	 fwevt_test_data_segment_free );
 
+	FWEVT_TEST_RUN(
+	 "libfwevt_data_segment_copy_with_cached_value",
+	 fwevt_test_data_segment_copy_with_cached_value );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,730 @@
+/*
+ * Library guid_index type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwevt_test_libcerror.h"
+#include "fwevt_test_libfwevt.h"
+#include "fwevt_test_macros.h"
+#include "fwevt_test_memory.h"
+#include "fwevt_test_unused.h"
+
+#include "../libfwevt/libfwevt_guid_index.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+
+/* Tests the libfwevt_guid_index_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_guid_index_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libfwevt_guid_index_t *guid_index = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_FWEVT_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 1;
+	int number_of_memset_fail_tests   = 1;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfwevt_guid_index_initialize(
+	          &guid_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "guid_index",
+	 guid_index );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_guid_index_free(
+	          &guid_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "guid_index",
+	 guid_index );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_guid_index_initialize(
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	guid_index = (libfwevt_guid_index_t *) 0x12345678UL;
+
+	result = libfwevt_guid_index_initialize(
+	          &guid_index,
+	          &error );
+
+	guid_index = NULL;
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FWEVT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwevt_guid_index_initialize with malloc failing
+		 */
+		fwevt_test_malloc_attempts_before_fail = test_number;
+
+		result = libfwevt_guid_index_initialize(
+		          &guid_index,
+		          &error );
+
+		if( fwevt_test_malloc_attempts_before_fail != -1 )
+		{
+			fwevt_test_malloc_attempts_before_fail = -1;
+
+			if( guid_index != NULL )
+			{
+				libfwevt_guid_index_free(
+				 &guid_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWEVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWEVT_TEST_ASSERT_IS_NULL(
+			 "guid_index",
+			 guid_index );
+
+			FWEVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwevt_guid_index_initialize with memset failing
+		 */
+		fwevt_test_memset_attempts_before_fail = test_number;
+
+		result = libfwevt_guid_index_initialize(
+		          &guid_index,
+		          &error );
+
+		if( fwevt_test_memset_attempts_before_fail != -1 )
+		{
+			fwevt_test_memset_attempts_before_fail = -1;
+
+			if( guid_index != NULL )
+			{
+				libfwevt_guid_index_free(
+				 &guid_index,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWEVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWEVT_TEST_ASSERT_IS_NULL(
+			 "guid_index",
+			 guid_index );
+
+			FWEVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FWEVT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( guid_index != NULL )
+	{
+		libfwevt_guid_index_free(
+		 &guid_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_guid_index_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_guid_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfwevt_guid_index_free(
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_guid_index_insert_value and libfwevt_guid_index_get_value_by_identifier functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_guid_index_insert_value(
+     void )
+{
+	uint8_t identifier[ 16 ]          = {
+		0x53, 0xea, 0xa2, 0x06, 0x6c, 0xfc, 0xe5, 0x42, 0x91, 0x76, 0x18, 0x74, 0x9a, 0xb2, 0xca, 0x13 };
+
+	int values[ 64 ];
+
+	libcerror_error_t *error          = NULL;
+	libfwevt_guid_index_t *guid_index = NULL;
+	intptr_t *value                   = NULL;
+	int number_of_probes              = 0;
+	int number_of_values              = 0;
+	int result                        = 0;
+	int value_index                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfwevt_guid_index_initialize(
+	          &guid_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "guid_index",
+	 guid_index );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test retrieve value from an empty index
+	 */
+	result = libfwevt_guid_index_get_value_by_identifier(
+	          guid_index,
+	          identifier,
+	          16,
+	          &value,
+	          &number_of_probes,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "value",
+	 value );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_probes",
+	 number_of_probes,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases, insert enough values to force the slots to be resized
+	 */
+	for( value_index = 0;
+	     value_index < 64;
+	     value_index++ )
+	{
+		values[ value_index ] = value_index;
+
+		identifier[ 0 ] = (uint8_t) value_index;
+
+		result = libfwevt_guid_index_insert_value(
+		          guid_index,
+		          identifier,
+		          16,
+		          (intptr_t *) &( values[ value_index ] ),
+		          &error );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWEVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test insert of an identifier that already has a value
+	 */
+	identifier[ 0 ] = 0;
+
+	result = libfwevt_guid_index_insert_value(
+	          guid_index,
+	          identifier,
+	          16,
+	          (intptr_t *) &( values[ 1 ] ),
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_guid_index_get_number_of_values(
+	          guid_index,
+	          &number_of_values,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 64 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 64;
+	     value_index++ )
+	{
+		identifier[ 0 ] = (uint8_t) value_index;
+
+		result = libfwevt_guid_index_get_value_by_identifier(
+		          guid_index,
+		          identifier,
+		          16,
+		          &value,
+		          &number_of_probes,
+		          &error );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "value",
+		 *( (int *) value ),
+		 value_index );
+
+		FWEVT_TEST_ASSERT_GREATER_THAN_INT(
+		 "number_of_probes",
+		 number_of_probes,
+		 0 );
+
+		FWEVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	identifier[ 0 ] = 0xff;
+
+	result = libfwevt_guid_index_get_value_by_identifier(
+	          guid_index,
+	          identifier,
+	          16,
+	          &value,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "value",
+	 value );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_guid_index_insert_value(
+	          NULL,
+	          identifier,
+	          16,
+	          (intptr_t *) &( values[ 0 ] ),
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_guid_index_insert_value(
+	          guid_index,
+	          NULL,
+	          16,
+	          (intptr_t *) &( values[ 0 ] ),
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_guid_index_insert_value(
+	          guid_index,
+	          identifier,
+	          8,
+	          (intptr_t *) &( values[ 0 ] ),
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_guid_index_insert_value(
+	          guid_index,
+	          identifier,
+	          16,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_guid_index_get_value_by_identifier(
+	          NULL,
+	          identifier,
+	          16,
+	          &value,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_guid_index_get_value_by_identifier(
+	          guid_index,
+	          NULL,
+	          16,
+	          &value,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_guid_index_get_value_by_identifier(
+	          guid_index,
+	          identifier,
+	          8,
+	          &value,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_guid_index_get_value_by_identifier(
+	          guid_index,
+	          identifier,
+	          16,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test libfwevt_guid_index_empty
+	 */
+	result = libfwevt_guid_index_empty(
+	          guid_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_guid_index_get_number_of_values(
+	          guid_index,
+	          &number_of_values,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_values",
+	 number_of_values,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfwevt_guid_index_free(
+	          &guid_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "guid_index",
+	 guid_index );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( guid_index != NULL )
+	{
+		libfwevt_guid_index_free(
+		 &guid_index,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWEVT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWEVT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWEVT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWEVT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWEVT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWEVT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_guid_index_initialize",
+	 fwevt_test_guid_index_initialize );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_guid_index_free",
+	 fwevt_test_guid_index_free );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_guid_index_insert_value",
+	 fwevt_test_guid_index_insert_value );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
+}
+
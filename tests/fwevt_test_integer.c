@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <types.h>
 
@@ -37,6 +38,92 @@
 
 #if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
 
+/* The number of integer boundary values: each power of 10 - 1, + 0 and + 1
+ * and the maximum 64-bit value, which includes 0 as 10^0 - 1
+ */
+#define FWEVT_TEST_INTEGER_NUMBER_OF_BOUNDARY_VALUES	61
+
+/* Retrieves an integer boundary value
+ */
+uint64_t fwevt_test_integer_get_boundary_value(
+          int value_index )
+{
+	uint64_t integer_value = 1;
+	int power_index        = 0;
+
+	if( value_index >= ( FWEVT_TEST_INTEGER_NUMBER_OF_BOUNDARY_VALUES - 1 ) )
+	{
+		return( 0xffffffffffffffffUL );
+	}
+	for( power_index = 0;
+	     power_index < ( value_index / 3 );
+	     power_index++ )
+	{
+		integer_value *= 10;
+	}
+	return( integer_value + ( value_index % 3 ) - 1 );
+}
+
+/* Formats an integer as decimal with a division loop, for reference
+ * Returns the number of characters including the end of string character
+ */
+size_t fwevt_test_integer_reference_decimal_format(
+        uint64_t integer_value,
+        uint8_t *string )
+{
+	uint64_t divider    = 1;
+	size_t string_index = 0;
+
+	while( ( integer_value / divider ) >= 10 )
+	{
+		divider *= 10;
+	}
+	while( divider > 0 )
+	{
+		string[ string_index++ ] = (uint8_t) '0' + (uint8_t) ( integer_value / divider );
+
+		integer_value %= divider;
+		divider       /= 10;
+	}
+	string[ string_index++ ] = 0;
+
+	return( string_index );
+}
+
+/* Formats a 64-bit integer as hexadecimal with a shift loop, for reference
+ * Returns the number of characters including the end of string character
+ */
+size_t fwevt_test_integer_reference_hexadecimal_format(
+        uint64_t integer_value,
+        uint8_t *string )
+{
+	size_t string_index = 0;
+	uint8_t nibble      = 0;
+	int bit_shift       = 0;
+
+	string[ string_index++ ] = (uint8_t) '0';
+	string[ string_index++ ] = (uint8_t) 'x';
+
+	for( bit_shift = 60;
+	     bit_shift >= 0;
+	     bit_shift -= 4 )
+	{
+		nibble = (uint8_t) ( ( integer_value >> bit_shift ) & 0x0f );
+
+		if( nibble <= 9 )
+		{
+			string[ string_index++ ] = (uint8_t) '0' + nibble;
+		}
+		else
+		{
+			string[ string_index++ ] = (uint8_t) 'a' + nibble - 10;
+		}
+	}
+	string[ string_index++ ] = 0;
+
+	return( string_index );
+}
+
 /* Tests the libfwevt_integer_copy_from_utf16_stream function
  * Returns 1 if successful or 0 if not
  */
@@ -175,6 +262,775 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfwevt_integer_get_number_of_decimal_digits function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_integer_get_number_of_decimal_digits(
+     void )
+{
+	uint64_t integer_value   = 0;
+	uint8_t expected_digits  = 0;
+	uint8_t number_of_digits = 0;
+
+	/* Test regular cases
+	 */
+	number_of_digits = libfwevt_integer_get_number_of_decimal_digits(
+	                    0 );
+
+	FWEVT_TEST_ASSERT_EQUAL_UINT8(
+	 "number_of_digits",
+	 number_of_digits,
+	 (uint8_t) 1 );
+
+	/* Test the values around every power of 10
+	 */
+	integer_value = 1;
+
+	for( expected_digits = 1;
+	     expected_digits < 20;
+	     expected_digits++ )
+	{
+		number_of_digits = libfwevt_integer_get_number_of_decimal_digits(
+		                    integer_value );
+
+		FWEVT_TEST_ASSERT_EQUAL_UINT8(
+		 "number_of_digits",
+		 number_of_digits,
+		 expected_digits );
+
+		number_of_digits = libfwevt_integer_get_number_of_decimal_digits(
+		                    ( integer_value * 10 ) - 1 );
+
+		FWEVT_TEST_ASSERT_EQUAL_UINT8(
+		 "number_of_digits",
+		 number_of_digits,
+		 expected_digits );
+
+		integer_value *= 10;
+	}
+	number_of_digits = libfwevt_integer_get_number_of_decimal_digits(
+	                    integer_value );
+
+	FWEVT_TEST_ASSERT_EQUAL_UINT8(
+	 "number_of_digits",
+	 number_of_digits,
+	 (uint8_t) 20 );
+
+	number_of_digits = libfwevt_integer_get_number_of_decimal_digits(
+	                    0xffffffffffffffffUL );
+
+	FWEVT_TEST_ASSERT_EQUAL_UINT8(
+	 "number_of_digits",
+	 number_of_digits,
+	 (uint8_t) 20 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfwevt_integer_as_signed_decimal_copy_to_utf8_string_with_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_integer_as_signed_decimal_copy_to_utf8_string_with_index(
+     void )
+{
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_index = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	utf8_string_index = 0;
+
+	result = libfwevt_integer_as_signed_decimal_copy_to_utf8_string_with_index(
+	          0x80000002UL,
+	          32,
+	          utf8_string,
+	          32,
+	          &utf8_string_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 3 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "-2",
+	          3 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	utf8_string_index = 0;
+
+	result = libfwevt_integer_as_signed_decimal_copy_to_utf8_string_with_index(
+	          1234567,
+	          32,
+	          utf8_string,
+	          32,
+	          &utf8_string_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 8 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "1234567",
+	          8 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	utf8_string_index = 0;
+
+	result = libfwevt_integer_as_signed_decimal_copy_to_utf8_string_with_index(
+	          1234567,
+	          32,
+	          NULL,
+	          32,
+	          &utf8_string_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_integer_as_signed_decimal_copy_to_utf8_string_with_index(
+	          1234567,
+	          32,
+	          utf8_string,
+	          32,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_integer_as_signed_decimal_copy_to_utf8_string_with_index(
+	          1234567,
+	          32,
+	          utf8_string,
+	          7,
+	          &utf8_string_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_integer_as_unsigned_decimal_copy_to_utf8_string_with_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_integer_as_unsigned_decimal_copy_to_utf8_string_with_index(
+     void )
+{
+	uint8_t expected_utf8_string[ 32 ];
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error    = NULL;
+	uint64_t integer_value      = 0;
+	size_t expected_string_size = 0;
+	size_t utf8_string_index    = 0;
+	int result                  = 0;
+	int value_index             = 0;
+
+	/* Test regular cases
+	 */
+	utf8_string_index = 1;
+
+	result = libfwevt_integer_as_unsigned_decimal_copy_to_utf8_string_with_index(
+	          0xffffffffffffffffUL,
+	          utf8_string,
+	          32,
+	          &utf8_string_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 22 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          &( utf8_string[ 1 ] ),
+	          "18446744073709551615",
+	          21 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	utf8_string_index = 0;
+
+	result = libfwevt_integer_as_unsigned_decimal_copy_to_utf8_string_with_index(
+	          0,
+	          utf8_string,
+	          2,
+	          &utf8_string_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 2 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "0",
+	          2 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test the boundary values
+	 */
+	for( value_index = 0;
+	     value_index < FWEVT_TEST_INTEGER_NUMBER_OF_BOUNDARY_VALUES;
+	     value_index++ )
+	{
+		integer_value = fwevt_test_integer_get_boundary_value(
+		                 value_index );
+
+		expected_string_size = fwevt_test_integer_reference_decimal_format(
+		                        integer_value,
+		                        expected_utf8_string );
+
+		utf8_string_index = 0;
+
+		result = libfwevt_integer_as_unsigned_decimal_copy_to_utf8_string_with_index(
+		          integer_value,
+		          utf8_string,
+		          expected_string_size,
+		          &utf8_string_index,
+		          &error );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWEVT_TEST_ASSERT_EQUAL_SIZE(
+		 "utf8_string_index",
+		 utf8_string_index,
+		 expected_string_size );
+
+		FWEVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          utf8_string,
+		          expected_utf8_string,
+		          expected_string_size );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+
+	/* Test error cases
+	 */
+	utf8_string_index = 0;
+
+	result = libfwevt_integer_as_unsigned_decimal_copy_to_utf8_string_with_index(
+	          0,
+	          NULL,
+	          2,
+	          &utf8_string_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_integer_as_unsigned_decimal_copy_to_utf8_string_with_index(
+	          0,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &utf8_string_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	utf8_string_index = 1;
+
+	result = libfwevt_integer_as_unsigned_decimal_copy_to_utf8_string_with_index(
+	          10,
+	          utf8_string,
+	          3,
+	          &utf8_string_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_integer_as_unsigned_decimal_copy_to_utf16_string_with_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_integer_as_unsigned_decimal_copy_to_utf16_string_with_index(
+     void )
+{
+	uint16_t expected_utf16_string[ 6 ] = {
+		'1', '2', '3', '4', '5', 0 };
+
+	uint8_t expected_utf8_string[ 32 ];
+	uint16_t utf16_string[ 32 ];
+
+	libcerror_error_t *error    = NULL;
+	uint64_t integer_value      = 0;
+	size_t expected_string_size = 0;
+	size_t string_index         = 0;
+	size_t utf16_string_index   = 0;
+	int result                  = 0;
+	int value_index             = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_integer_as_unsigned_decimal_copy_to_utf16_string_with_index(
+	          12345,
+	          utf16_string,
+	          32,
+	          &utf16_string_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_index",
+	 utf16_string_index,
+	 (size_t) 6 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf16_string,
+	          expected_utf16_string,
+	          sizeof( uint16_t ) * 6 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test the boundary values
+	 */
+	for( value_index = 0;
+	     value_index < FWEVT_TEST_INTEGER_NUMBER_OF_BOUNDARY_VALUES;
+	     value_index++ )
+	{
+		integer_value = fwevt_test_integer_get_boundary_value(
+		                 value_index );
+
+		expected_string_size = fwevt_test_integer_reference_decimal_format(
+		                        integer_value,
+		                        expected_utf8_string );
+
+		utf16_string_index = 0;
+
+		result = libfwevt_integer_as_unsigned_decimal_copy_to_utf16_string_with_index(
+		          integer_value,
+		          utf16_string,
+		          expected_string_size,
+		          &utf16_string_index,
+		          &error );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWEVT_TEST_ASSERT_EQUAL_SIZE(
+		 "utf16_string_index",
+		 utf16_string_index,
+		 expected_string_size );
+
+		FWEVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( string_index = 0;
+		     string_index < expected_string_size;
+		     string_index++ )
+		{
+			FWEVT_TEST_ASSERT_EQUAL_UINT16(
+			 "utf16_string[ string_index ]",
+			 utf16_string[ string_index ],
+			 (uint16_t) expected_utf8_string[ string_index ] );
+		}
+	}
+
+	/* Test error cases
+	 */
+	utf16_string_index = 0;
+
+	result = libfwevt_integer_as_unsigned_decimal_copy_to_utf16_string_with_index(
+	          12345,
+	          NULL,
+	          32,
+	          &utf16_string_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_integer_as_unsigned_decimal_copy_to_utf16_string_with_index(
+	          12345,
+	          utf16_string,
+	          5,
+	          &utf16_string_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_integer_as_hexadecimal_copy_to_utf8_string_with_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_integer_as_hexadecimal_copy_to_utf8_string_with_index(
+     void )
+{
+	uint8_t expected_utf8_string[ 32 ];
+	uint8_t utf8_string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	uint64_t integer_value   = 0;
+	size_t utf8_string_index = 0;
+	int result               = 0;
+	int value_index          = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_integer_as_hexadecimal_copy_to_utf8_string_with_index(
+	          0x8000000000abcdefUL,
+	          64,
+	          utf8_string,
+	          32,
+	          &utf8_string_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 19 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "0x8000000000abcdef",
+	          19 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	utf8_string_index = 0;
+
+	result = libfwevt_integer_as_hexadecimal_copy_to_utf8_string_with_index(
+	          0x0000f00dUL,
+	          32,
+	          utf8_string,
+	          32,
+	          &utf8_string_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 11 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          "0x0000f00d",
+	          11 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test the boundary values
+	 */
+	for( value_index = 0;
+	     value_index < FWEVT_TEST_INTEGER_NUMBER_OF_BOUNDARY_VALUES;
+	     value_index++ )
+	{
+		integer_value = fwevt_test_integer_get_boundary_value(
+		                 value_index );
+
+		fwevt_test_integer_reference_hexadecimal_format(
+		 integer_value,
+		 expected_utf8_string );
+
+		utf8_string_index = 0;
+
+		result = libfwevt_integer_as_hexadecimal_copy_to_utf8_string_with_index(
+		          integer_value,
+		          64,
+		          utf8_string,
+		          19,
+		          &utf8_string_index,
+		          &error );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWEVT_TEST_ASSERT_EQUAL_SIZE(
+		 "utf8_string_index",
+		 utf8_string_index,
+		 (size_t) 19 );
+
+		FWEVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = memory_compare(
+		          utf8_string,
+		          expected_utf8_string,
+		          19 );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+
+	/* Test error cases
+	 */
+	utf8_string_index = 0;
+
+	result = libfwevt_integer_as_hexadecimal_copy_to_utf8_string_with_index(
+	          0x0000f00dUL,
+	          16,
+	          utf8_string,
+	          32,
+	          &utf8_string_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_integer_as_hexadecimal_copy_to_utf8_string_with_index(
+	          0x0000f00dUL,
+	          32,
+	          utf8_string,
+	          10,
+	          &utf8_string_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
 
 /* The main program
@@ -198,19 +1054,31 @@ int main(
 	 "libfwevt_integer_copy_from_utf16_stream",
 	 fwevt_test_integer_copy_from_utf16_stream );
 
+	FWEVT_TEST_RUN(
+	 "libfwevt_integer_get_number_of_decimal_digits",
+	 fwevt_test_integer_get_number_of_decimal_digits );
+
 	/* TODO: add tests for libfwevt_integer_as_signed_decimal_get_string_size */
 
-	/* TODO: add tests for libfwevt_integer_as_signed_decimal_copy_to_utf8_string_with_index */
+	FWEVT_TEST_RUN(
+	 "libfwevt_integer_as_signed_decimal_copy_to_utf8_string_with_index",
+	 fwevt_test_integer_as_signed_decimal_copy_to_utf8_string_with_index );
 
 	/* TODO: add tests for libfwevt_integer_as_signed_decimal_copy_to_utf16_string_with_index */
 
 	/* TODO: add tests for libfwevt_integer_as_unsigned_decimal_get_string_size */
 
-	/* TODO: add tests for libfwevt_integer_as_unsigned_decimal_copy_to_utf8_string_with_index */
+	FWEVT_TEST_RUN(
+	 "libfwevt_integer_as_unsigned_decimal_copy_to_utf8_string_with_index",
+	 fwevt_test_integer_as_unsigned_decimal_copy_to_utf8_string_with_index );
 
-	/* TODO: add tests for libfwevt_integer_as_unsigned_decimal_copy_to_utf16_string_with_index */
+	FWEVT_TEST_RUN(
+	 "libfwevt_integer_as_unsigned_decimal_copy_to_utf16_string_with_index",
+	 fwevt_test_integer_as_unsigned_decimal_copy_to_utf16_string_with_index );
 
-	/* TODO: add tests for libfwevt_integer_as_hexadecimal_copy_to_utf8_string_with_index */
+	FWEVT_TEST_RUN(
+	 "libfwevt_integer_as_hexadecimal_copy_to_utf8_string_with_index",
+	 fwevt_test_integer_as_hexadecimal_copy_to_utf8_string_with_index );
 
 	/* TODO: add tests for libfwevt_integer_as_hexadecimal_copy_to_utf16_string_with_index */
 
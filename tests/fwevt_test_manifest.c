@@ -34,6 +34,8 @@
 #include "fwevt_test_memory.h"
 #include "fwevt_test_unused.h"
 
+#include "../libfwevt/libfwevt_template.h"
+
 uint8_t fwevt_test_manifest_data1[ 634 ] = {
 	0x43, 0x52, 0x49, 0x4d, 0x78, 0x02, 0x00, 0x00, 0x05, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00,
 	0x53, 0xea, 0xa2, 0x06, 0x6c, 0xfc, 0xe5, 0x42, 0x91, 0x76, 0x18, 0x74, 0x9a, 0xb2, 0xca, 0x13,
@@ -87,7 +89,7 @@ int fwevt_test_manifest_initialize(
 	int result                      = 0;
 
 #if defined( HAVE_FWEVT_TEST_MEMORY )
-	int number_of_malloc_fail_tests = 2;
+	int number_of_malloc_fail_tests = 3;
 	int number_of_memset_fail_tests = 1;
 	int test_number                 = 0;
 #endif
@@ -529,18 +531,85 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfwevt_manifest_get_number_of_providers function
+/* Tests the libfwevt_manifest_open_file function
  * Returns 1 if successful or 0 if not
  */
-int fwevt_test_manifest_get_number_of_providers(
-     libfwevt_manifest_t *manifest )
+int fwevt_test_manifest_open_file(
+     void )
 {
-	libcerror_error_t *error = NULL;
-	int number_of_providers  = 0;
-	int result               = 0;
+	const char *filename          = "fwevt_test_manifest.bin";
+	libcerror_error_t *error      = NULL;
+	libfwevt_manifest_t *manifest = NULL;
+	libfwevt_provider_t *provider = NULL;
+	FILE *file_stream             = NULL;
+	size_t write_count            = 0;
+	int number_of_providers       = 0;
+	int number_of_templates       = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	file_stream = file_stream_open(
+	               filename,
+	               FILE_STREAM_BINARY_OPEN_WRITE );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_stream",
+	 file_stream );
+
+	write_count = file_stream_write(
+	               file_stream,
+	               fwevt_test_manifest_data1,
+	               634 );
+
+	result = file_stream_close(
+	          file_stream );
+
+	file_stream = NULL;
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "write_count",
+	 write_count,
+	 (size_t) 634 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfwevt_manifest_initialize(
+	          &manifest,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "manifest",
+	 manifest );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test regular cases
 	 */
+	result = libfwevt_manifest_open_file(
+	          manifest,
+	          filename,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	result = libfwevt_manifest_get_number_of_providers(
 	          manifest,
 	          &number_of_providers,
@@ -551,15 +620,71 @@ int fwevt_test_manifest_get_number_of_providers(
 	 result,
 	 1 );
 
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_providers",
+	 number_of_providers,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_manifest_get_provider_by_index(
+	          manifest,
+	          0,
+	          &provider,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "provider",
+	 provider );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_provider_get_number_of_templates(
+	          provider,
+	          &number_of_templates,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_templates",
+	 number_of_templates,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_provider_free(
+	          &provider,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
 	FWEVT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	/* Test error cases
 	 */
-	result = libfwevt_manifest_get_number_of_providers(
+	result = libfwevt_manifest_open_file(
 	          NULL,
-	          &number_of_providers,
+	          filename,
 	          &error );
 
 	FWEVT_TEST_ASSERT_EQUAL_INT(
@@ -574,9 +699,9 @@ int fwevt_test_manifest_get_number_of_providers(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwevt_manifest_get_number_of_providers(
+	result = libfwevt_manifest_open_file(
 	          manifest,
-	          NULL,
+	          filename,
 	          &error );
 
 	FWEVT_TEST_ASSERT_EQUAL_INT(
@@ -591,33 +716,25 @@ int fwevt_test_manifest_get_number_of_providers(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
+	/* Clean up
+	 */
+	result = libfwevt_manifest_free(
+	          &manifest,
+	          NULL );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-/* Tests the libfwevt_manifest_get_provider_by_index function
- * Returns 1 if successful or 0 if not
- */
-int fwevt_test_manifest_get_provider_by_index(
-     libfwevt_manifest_t *manifest )
-{
-	libcerror_error_t *error      = NULL;
-	libfwevt_provider_t *provider = NULL;
-	int number_of_providers       = 0;
-	int result                    = 0;
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "manifest",
+	 manifest );
 
 	/* Initialize test
 	 */
-	result = libfwevt_manifest_get_number_of_providers(
-	          manifest,
-	          &number_of_providers,
+	result = libfwevt_manifest_initialize(
+	          &manifest,
 	          &error );
 
 	FWEVT_TEST_ASSERT_EQUAL_INT(
@@ -625,58 +742,19 @@ int fwevt_test_manifest_get_provider_by_index(
 	 result,
 	 1 );
 
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "manifest",
+	 manifest );
+
 	FWEVT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-	if( number_of_providers > 0 )
-	{
-		result = libfwevt_manifest_get_provider_by_index(
-		          manifest,
-		          0,
-		          &provider,
-		          &error );
-
-		FWEVT_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
-
-		FWEVT_TEST_ASSERT_IS_NOT_NULL(
-		 "provider",
-		 provider );
-
-		FWEVT_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-
-		/* Clean up
-		 */
-		result = libfwevt_provider_free(
-		          &provider,
-		          &error );
-
-		FWEVT_TEST_ASSERT_EQUAL_INT(
-		 "result",
-		 result,
-		 1 );
-
-		FWEVT_TEST_ASSERT_IS_NULL(
-		 "provider",
-		 provider );
-
-		FWEVT_TEST_ASSERT_IS_NULL(
-		 "error",
-		 error );
-	}
 	/* Test error cases
 	 */
-	result = libfwevt_manifest_get_provider_by_index(
+	result = libfwevt_manifest_open_file(
+	          manifest,
 	          NULL,
-	          0,
-	          &provider,
 	          &error );
 
 	FWEVT_TEST_ASSERT_EQUAL_INT(
@@ -691,10 +769,9 @@ int fwevt_test_manifest_get_provider_by_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwevt_manifest_get_provider_by_index(
+	result = libfwevt_manifest_open_file(
 	          manifest,
-	          -1,
-	          &provider,
+	          "fwevt_test_manifest.nonexistent",
 	          &error );
 
 	FWEVT_TEST_ASSERT_EQUAL_INT(
@@ -709,23 +786,23 @@ int fwevt_test_manifest_get_provider_by_index(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwevt_manifest_get_provider_by_index(
-	          manifest,
-	          0,
-	          NULL,
-	          &error );
+	/* Clean up
+	 */
+	result = libfwevt_manifest_free(
+	          &manifest,
+	          NULL );
 
 	FWEVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	FWEVT_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "manifest",
+	 manifest );
 
-	libcerror_error_free(
-	 &error );
+	remove(
+	 filename );
 
 	return( 1 );
 
@@ -735,51 +812,919 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( provider != NULL )
+	if( file_stream != NULL )
 	{
-		libfwevt_provider_free(
-		 &provider,
+		file_stream_close(
+		 file_stream );
+	}
+	if( manifest != NULL )
+	{
+		libfwevt_manifest_free(
+		 &manifest,
 		 NULL );
 	}
+	remove(
+	 filename );
+
 	return( 0 );
 }
 
-/* Tests the libfwevt_manifest_get_provider_by_identifier function
+/* Tests the libfwevt_manifest_read_with_flags function
  * Returns 1 if successful or 0 if not
  */
-int fwevt_test_manifest_get_provider_by_identifier(
-     libfwevt_manifest_t *manifest )
+int fwevt_test_manifest_read_with_flags(
+     void )
 {
-	uint8_t provider_identifier[ 16 ] = {
-		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+	uint8_t template_identifier[ 16 ] = {
+		0x33, 0x12, 0x8a, 0x27, 0x65, 0xf6, 0x52, 0x52, 0x0b, 0xa7, 0x2b, 0xca, 0x59, 0x74, 0x33, 0xa8 };
 
 	libcerror_error_t *error          = NULL;
+	libfwevt_event_t *event           = NULL;
+	libfwevt_manifest_t *manifest     = NULL;
 	libfwevt_provider_t *provider     = NULL;
+	libfwevt_template_t *template     = NULL;
+	int number_of_events              = 0;
+	int number_of_templates           = 0;
 	int result                        = 0;
 
-	/* Test regular cases
+	/* Initialize test
 	 */
-	result = libfwevt_manifest_get_provider_by_identifier(
-	          manifest,
-	          provider_identifier,
-	          16,
-	          &provider,
+	result = libfwevt_manifest_initialize(
+	          &manifest,
 	          &error );
 
 	FWEVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "manifest",
+	 manifest );
 
 	FWEVT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	if( result != 0 )
-	{
-		FWEVT_TEST_ASSERT_IS_NOT_NULL(
-		 "provider",
-		 provider );
+	/* Test regular cases
+	 */
+	result = libfwevt_manifest_read_with_flags(
+	          manifest,
+	          fwevt_test_manifest_data1,
+	          634,
+	          LIBFWEVT_MANIFEST_READ_FLAG_READ_ON_DEMAND,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_manifest_get_provider_by_index(
+	          manifest,
+	          0,
+	          &provider,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "provider",
+	 provider );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the provider tables are read on demand
+	 */
+	result = libfwevt_provider_get_number_of_templates(
+	          provider,
+	          &number_of_templates,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_templates",
+	 number_of_templates,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_provider_get_template_by_identifier(
+	          provider,
+	          template_identifier,
+	          16,
+	          &template,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "template",
+	 template );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_template_free(
+	          &template,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_provider_get_event_by_identifier(
+	          provider,
+	          1,
+	          &event,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "event",
+	 event );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_event_free(
+	          &event,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_provider_get_number_of_events(
+	          provider,
+	          &number_of_events,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_events",
+	 number_of_events,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_provider_free(
+	          &provider,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_manifest_read_with_flags(
+	          NULL,
+	          fwevt_test_manifest_data1,
+	          634,
+	          LIBFWEVT_MANIFEST_READ_FLAG_READ_ON_DEMAND,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_manifest_read_with_flags(
+	          manifest,
+	          fwevt_test_manifest_data1,
+	          634,
+	          0xff,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwevt_manifest_free(
+	          &manifest,
+	          NULL );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "manifest",
+	 manifest );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( template != NULL )
+	{
+		libfwevt_template_free(
+		 &template,
+		 NULL );
+	}
+	if( event != NULL )
+	{
+		libfwevt_event_free(
+		 &event,
+		 NULL );
+	}
+	if( manifest != NULL )
+	{
+		libfwevt_manifest_free(
+		 &manifest,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+
+/* Tests the libfwevt_manifest_read_with_flags function with LIBFWEVT_MANIFEST_READ_FLAG_BORROW_DATA
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_manifest_read_with_flags_borrow_data(
+     void )
+{
+	uint8_t template_identifier[ 16 ] = {
+		0x33, 0x12, 0x8a, 0x27, 0x65, 0xf6, 0x52, 0x52, 0x0b, 0xa7, 0x2b, 0xca, 0x59, 0x74, 0x33, 0xa8 };
+
+	libcerror_error_t *error          = NULL;
+	libfwevt_manifest_t *manifest     = NULL;
+	libfwevt_provider_t *provider     = NULL;
+	libfwevt_template_t *template     = NULL;
+	uint32_t template_size            = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfwevt_manifest_initialize(
+	          &manifest,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "manifest",
+	 manifest );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwevt_manifest_read_with_flags(
+	          manifest,
+	          fwevt_test_manifest_data1,
+	          634,
+	          LIBFWEVT_MANIFEST_READ_FLAG_BORROW_DATA,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_manifest_get_provider_by_index(
+	          manifest,
+	          0,
+	          &provider,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "provider",
+	 provider );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_provider_get_template_by_identifier(
+	          provider,
+	          template_identifier,
+	          16,
+	          &template,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "template",
+	 template );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_template_get_size(
+	          template,
+	          &template_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_UINT32(
+	 "template_size",
+	 template_size,
+	 (uint32_t) 324 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the template data refers to the manifest data
+	 */
+	FWEVT_TEST_ASSERT_EQUAL_UINT8(
+	 "template->data_is_borrowed",
+	 ( (libfwevt_internal_template_t *) template )->data_is_borrowed,
+	 (uint8_t) 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "template->data",
+	 ( ( (libfwevt_internal_template_t *) template )->data == &( fwevt_test_manifest_data1[ 120 ] ) ),
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "template->data_size",
+	 ( (libfwevt_internal_template_t *) template )->data_size,
+	 (size_t) 324 );
+
+	/* Clean up
+	 */
+	result = libfwevt_template_free(
+	          &template,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_provider_free(
+	          &provider,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_manifest_free(
+	          &manifest,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "manifest",
+	 manifest );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( template != NULL )
+	{
+		libfwevt_template_free(
+		 &template,
+		 NULL );
+	}
+	if( provider != NULL )
+	{
+		libfwevt_provider_free(
+		 &provider,
+		 NULL );
+	}
+	if( manifest != NULL )
+	{
+		libfwevt_manifest_free(
+		 &manifest,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
+
+/* Tests the libfwevt_manifest_set_maximum_number_of_threads function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_manifest_set_maximum_number_of_threads(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	libfwevt_manifest_t *manifest = NULL;
+	int number_of_providers       = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libfwevt_manifest_initialize(
+	          &manifest,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "manifest",
+	 manifest );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwevt_manifest_set_maximum_number_of_threads(
+	          manifest,
+	          4,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_manifest_read(
+	          manifest,
+	          fwevt_test_manifest_data1,
+	          634,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_manifest_get_number_of_providers(
+	          manifest,
+	          &number_of_providers,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_providers",
+	 number_of_providers,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_manifest_set_maximum_number_of_threads(
+	          NULL,
+	          4,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_manifest_set_maximum_number_of_threads(
+	          manifest,
+	          -1,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwevt_manifest_free(
+	          &manifest,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "manifest",
+	 manifest );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( manifest != NULL )
+	{
+		libfwevt_manifest_free(
+		 &manifest,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_manifest_get_number_of_providers function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_manifest_get_number_of_providers(
+     libfwevt_manifest_t *manifest )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_providers  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_manifest_get_number_of_providers(
+	          manifest,
+	          &number_of_providers,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_manifest_get_number_of_providers(
+	          NULL,
+	          &number_of_providers,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_manifest_get_number_of_providers(
+	          manifest,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_manifest_get_provider_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_manifest_get_provider_by_index(
+     libfwevt_manifest_t *manifest )
+{
+	libcerror_error_t *error      = NULL;
+	libfwevt_provider_t *provider = NULL;
+	int number_of_providers       = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libfwevt_manifest_get_number_of_providers(
+	          manifest,
+	          &number_of_providers,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	if( number_of_providers > 0 )
+	{
+		result = libfwevt_manifest_get_provider_by_index(
+		          manifest,
+		          0,
+		          &provider,
+		          &error );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWEVT_TEST_ASSERT_IS_NOT_NULL(
+		 "provider",
+		 provider );
+
+		FWEVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		/* Clean up
+		 */
+		result = libfwevt_provider_free(
+		          &provider,
+		          &error );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWEVT_TEST_ASSERT_IS_NULL(
+		 "provider",
+		 provider );
+
+		FWEVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libfwevt_manifest_get_provider_by_index(
+	          NULL,
+	          0,
+	          &provider,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_manifest_get_provider_by_index(
+	          manifest,
+	          -1,
+	          &provider,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_manifest_get_provider_by_index(
+	          manifest,
+	          0,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( provider != NULL )
+	{
+		libfwevt_provider_free(
+		 &provider,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_manifest_get_provider_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_manifest_get_provider_by_identifier(
+     libfwevt_manifest_t *manifest )
+{
+	uint8_t provider_identifier[ 16 ] = {
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+	uint8_t expected_identifier[ 16 ] = {
+		0x53, 0xea, 0xa2, 0x06, 0x6c, 0xfc, 0xe5, 0x42, 0x91, 0x76, 0x18, 0x74, 0x9a, 0xb2, 0xca, 0x13 };
+
+	uint8_t template_identifier[ 16 ] = {
+		0x33, 0x12, 0x8a, 0x27, 0x65, 0xf6, 0x52, 0x52, 0x0b, 0xa7, 0x2b, 0xca, 0x59, 0x74, 0x33, 0xa8 };
+
+	libcerror_error_t *error          = NULL;
+	libfwevt_provider_t *provider     = NULL;
+	libfwevt_template_t *template     = NULL;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_manifest_get_provider_by_identifier(
+	          manifest,
+	          provider_identifier,
+	          16,
+	          &provider,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result != 0 )
+	{
+		FWEVT_TEST_ASSERT_IS_NOT_NULL(
+		 "provider",
+		 provider );
 
 		/* Clean up
 		 */
@@ -800,6 +1745,106 @@ int fwevt_test_manifest_get_provider_by_identifier(
 		 "error",
 		 error );
 	}
+	result = libfwevt_manifest_get_provider_by_identifier(
+	          manifest,
+	          expected_identifier,
+	          16,
+	          &provider,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "provider",
+	 provider );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test retrieve template of the provider using the indexes
+	 */
+	result = libfwevt_provider_get_template_by_offset(
+	          provider,
+	          120,
+	          &template,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "template",
+	 template );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_template_free(
+	          &template,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_provider_get_template_by_identifier(
+	          provider,
+	          template_identifier,
+	          16,
+	          &template,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "template",
+	 template );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_template_free(
+	          &template,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_provider_free(
+	          &provider,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test error cases
 	 */
 	result = libfwevt_manifest_get_provider_by_identifier(
@@ -926,6 +1971,26 @@ int main(
 	 "libfwevt_manifest_read",
 	 fwevt_test_manifest_read );
 
+	FWEVT_TEST_RUN(
+	 "libfwevt_manifest_open_file",
+	 fwevt_test_manifest_open_file );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_manifest_read_with_flags",
+	 fwevt_test_manifest_read_with_flags );
+
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_manifest_read_with_flags_borrow_data",
+	 fwevt_test_manifest_read_with_flags_borrow_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_manifest_set_maximum_number_of_threads",
+	 fwevt_test_manifest_set_maximum_number_of_threads );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	/* Initialize manifest for tests
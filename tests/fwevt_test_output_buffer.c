@@ -0,0 +1,1001 @@
+/*
+ * Library output_buffer type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwevt_test_libcerror.h"
+#include "fwevt_test_libfwevt.h"
+#include "fwevt_test_macros.h"
+#include "fwevt_test_memory.h"
+#include "fwevt_test_unused.h"
+
+#include "../libfwevt/libfwevt_output_buffer.h"
+
+uint8_t fwevt_test_output_buffer_utf16_stream[ 10 ] = {
+	'D', 0, 'a', 0, 't', 0, 'a', 0, 0, 0 };
+
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+
+/* Write callback that counts the written data
+ * Returns 1 if successful or -1 on error
+ */
+int fwevt_test_output_buffer_write_callback(
+     const uint8_t *data FWEVT_TEST_ATTRIBUTE_UNUSED,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error FWEVT_TEST_ATTRIBUTE_UNUSED )
+{
+	size_t *written_data_size = (size_t *) callback_data;
+
+	FWEVT_TEST_UNREFERENCED_PARAMETER( data )
+	FWEVT_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( written_data_size == NULL )
+	{
+		return( -1 );
+	}
+	*written_data_size += data_size;
+
+	return( 1 );
+}
+
+/* Tests the libfwevt_output_buffer_flush function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_output_buffer_flush(
+     void )
+{
+	libfwevt_output_buffer_t output_buffer;
+
+	libcerror_error_t *error   = NULL;
+	size_t allocated_data_size = 0;
+	size_t written_data_size   = 0;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	output_buffer.data                = NULL;
+	output_buffer.data_size           = 0;
+	output_buffer.allocated_data_size = 0;
+	output_buffer.data_is_fixed       = 0;
+	output_buffer.write_callback      = &fwevt_test_output_buffer_write_callback;
+	output_buffer.callback_data       = &written_data_size;
+
+	result = libfwevt_output_buffer_append_data(
+	          &output_buffer,
+	          (uint8_t *) "test",
+	          4,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwevt_output_buffer_flush(
+	          &output_buffer,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer.data_size",
+	 output_buffer.data_size,
+	 (size_t) 0 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "written_data_size",
+	 written_data_size,
+	 (size_t) 4 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that reserve flushes the data instead of reallocating it
+	 */
+	allocated_data_size     = output_buffer.allocated_data_size;
+	output_buffer.data_size = allocated_data_size - 2;
+
+	result = libfwevt_output_buffer_reserve(
+	          &output_buffer,
+	          4,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer.data_size",
+	 output_buffer.data_size,
+	 (size_t) 0 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer.allocated_data_size",
+	 output_buffer.allocated_data_size,
+	 allocated_data_size );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "written_data_size",
+	 written_data_size,
+	 allocated_data_size + 2 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_output_buffer_flush(
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	output_buffer.data_size     = 4;
+	output_buffer.callback_data = NULL;
+
+	result = libfwevt_output_buffer_flush(
+	          &output_buffer,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 output_buffer.data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer.data != NULL )
+	{
+		memory_free(
+		 output_buffer.data );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_output_buffer_reserve function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_output_buffer_reserve(
+     void )
+{
+	libfwevt_output_buffer_t output_buffer;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	output_buffer.data                = NULL;
+	output_buffer.data_size           = 0;
+	output_buffer.allocated_data_size = 0;
+	output_buffer.data_is_fixed       = 0;
+	output_buffer.write_callback      = NULL;
+	output_buffer.callback_data       = NULL;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_output_buffer_reserve(
+	          &output_buffer,
+	          16,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "output_buffer.data",
+	 output_buffer.data );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer.allocated_data_size",
+	 output_buffer.allocated_data_size,
+	 (size_t) 4096 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	output_buffer.data_size = 4000;
+
+	result = libfwevt_output_buffer_reserve(
+	          &output_buffer,
+	          10000,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer.allocated_data_size",
+	 output_buffer.allocated_data_size,
+	 (size_t) 16384 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_output_buffer_reserve(
+	          NULL,
+	          16,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_output_buffer_reserve(
+	          &output_buffer,
+	          (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 output_buffer.data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer.data != NULL )
+	{
+		memory_free(
+		 output_buffer.data );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_output_buffer_reserve_maximum function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_output_buffer_reserve_maximum(
+     void )
+{
+	uint8_t data[ 32 ];
+
+	libfwevt_output_buffer_t output_buffer;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	output_buffer.data                = NULL;
+	output_buffer.data_size           = 0;
+	output_buffer.allocated_data_size = 0;
+	output_buffer.data_is_fixed       = 0;
+	output_buffer.write_callback      = NULL;
+	output_buffer.callback_data       = NULL;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_output_buffer_reserve_maximum(
+	          &output_buffer,
+	          2,
+	          10000,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer.allocated_data_size",
+	 output_buffer.allocated_data_size,
+	 (size_t) 16384 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 output_buffer.data );
+
+	/* Test if only the minimum size is reserved in fixed data
+	 */
+	output_buffer.data                = data;
+	output_buffer.data_size           = 24;
+	output_buffer.allocated_data_size = 32;
+	output_buffer.data_is_fixed       = 1;
+
+	result = libfwevt_output_buffer_reserve_maximum(
+	          &output_buffer,
+	          8,
+	          10000,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "output_buffer.data",
+	 (int) ( output_buffer.data == data ),
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer.allocated_data_size",
+	 output_buffer.allocated_data_size,
+	 (size_t) 32 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_output_buffer_reserve_maximum(
+	          NULL,
+	          2,
+	          16,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_output_buffer_reserve_maximum(
+	          &output_buffer,
+	          16,
+	          2,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test if reserving more than the remaining fixed data fails
+	 */
+	result = libfwevt_output_buffer_reserve_maximum(
+	          &output_buffer,
+	          9,
+	          10000,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( ( output_buffer.data != NULL )
+	 && ( output_buffer.data_is_fixed == 0 ) )
+	{
+		memory_free(
+		 output_buffer.data );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_output_buffer_append_data function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_output_buffer_append_data(
+     void )
+{
+	libfwevt_output_buffer_t output_buffer;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	output_buffer.data                = NULL;
+	output_buffer.data_size           = 0;
+	output_buffer.allocated_data_size = 0;
+	output_buffer.data_is_fixed       = 0;
+	output_buffer.write_callback      = NULL;
+	output_buffer.callback_data       = NULL;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_output_buffer_append_data(
+	          &output_buffer,
+	          (uint8_t *) "test",
+	          4,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer.data_size",
+	 output_buffer.data_size,
+	 (size_t) 4 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_buffer.data,
+	          "test",
+	          4 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwevt_output_buffer_append_data(
+	          NULL,
+	          (uint8_t *) "test",
+	          4,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_output_buffer_append_data(
+	          &output_buffer,
+	          NULL,
+	          4,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 output_buffer.data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer.data != NULL )
+	{
+		memory_free(
+		 output_buffer.data );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_output_buffer_append_indentation function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_output_buffer_append_indentation(
+     void )
+{
+	libfwevt_output_buffer_t output_buffer;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	output_buffer.data                = NULL;
+	output_buffer.data_size           = 0;
+	output_buffer.allocated_data_size = 0;
+	output_buffer.data_is_fixed       = 0;
+	output_buffer.write_callback      = NULL;
+	output_buffer.callback_data       = NULL;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_output_buffer_append_indentation(
+	          &output_buffer,
+	          2,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer.data_size",
+	 output_buffer.data_size,
+	 (size_t) 4 );
+
+	FWEVT_TEST_ASSERT_EQUAL_UINT8(
+	 "output_buffer.data[ 3 ]",
+	 output_buffer.data[ 3 ],
+	 (uint8_t) ' ' );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_output_buffer_append_indentation(
+	          NULL,
+	          2,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_output_buffer_append_indentation(
+	          &output_buffer,
+	          -1,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 output_buffer.data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer.data != NULL )
+	{
+		memory_free(
+		 output_buffer.data );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_output_buffer_append_utf16_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_output_buffer_append_utf16_stream(
+     void )
+{
+	libfwevt_output_buffer_t output_buffer;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	output_buffer.data                = NULL;
+	output_buffer.data_size           = 0;
+	output_buffer.allocated_data_size = 0;
+	output_buffer.data_is_fixed       = 0;
+	output_buffer.write_callback      = NULL;
+	output_buffer.callback_data       = NULL;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_output_buffer_append_utf16_stream(
+	          &output_buffer,
+	          fwevt_test_output_buffer_utf16_stream,
+	          10,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer.data_size",
+	 output_buffer.data_size,
+	 (size_t) 4 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_buffer.data,
+	          "Data",
+	          4 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwevt_output_buffer_append_utf16_stream(
+	          NULL,
+	          fwevt_test_output_buffer_utf16_stream,
+	          10,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_output_buffer_append_utf16_stream(
+	          &output_buffer,
+	          NULL,
+	          10,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 output_buffer.data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( output_buffer.data != NULL )
+	{
+		memory_free(
+		 output_buffer.data );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_output_buffer_count_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_output_buffer_count_data_size(
+     void )
+{
+	uint8_t data[ 4 ] = {
+		'd', 'a', 't', 'a' };
+
+	libcerror_error_t *error = NULL;
+	size_t counted_data_size = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_output_buffer_count_data_size(
+	          data,
+	          4,
+	          (void *) &counted_data_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_output_buffer_count_data_size(
+	          data,
+	          3,
+	          (void *) &counted_data_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "counted_data_size",
+	 counted_data_size,
+	 (size_t) 7 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_output_buffer_count_data_size(
+	          NULL,
+	          4,
+	          (void *) &counted_data_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_output_buffer_count_data_size(
+	          data,
+	          4,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	counted_data_size = (size_t) SSIZE_MAX;
+
+	result = libfwevt_output_buffer_count_data_size(
+	          data,
+	          4,
+	          (void *) &counted_data_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWEVT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWEVT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWEVT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWEVT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWEVT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWEVT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_output_buffer_flush",
+	 fwevt_test_output_buffer_flush );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_output_buffer_reserve",
+	 fwevt_test_output_buffer_reserve );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_output_buffer_reserve_maximum",
+	 fwevt_test_output_buffer_reserve_maximum );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_output_buffer_append_data",
+	 fwevt_test_output_buffer_append_data );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_output_buffer_append_indentation",
+	 fwevt_test_output_buffer_append_indentation );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_output_buffer_append_utf16_stream",
+	 fwevt_test_output_buffer_append_utf16_stream );
+
+	/* TODO: add tests for libfwevt_output_buffer_write_to_file_stream */
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_output_buffer_count_data_size",
+	 fwevt_test_output_buffer_count_data_size );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
+}
+
@@ -34,6 +34,7 @@
 #include "fwevt_test_memory.h"
 #include "fwevt_test_unused.h"
 
+#include "../libfwevt/libfwevt_definitions.h"
 #include "../libfwevt/libfwevt_provider.h"
 
 uint8_t fwevt_test_provider_identifier_data1[ 16 ] = {
@@ -92,7 +93,7 @@ int fwevt_test_provider_initialize(
 	int result                      = 0;
 
 #if defined( HAVE_FWEVT_TEST_MEMORY )
-	int number_of_malloc_fail_tests = 16;
+	int number_of_malloc_fail_tests = 19;
 	int number_of_memset_fail_tests = 1;
 	int test_number                 = 0;
 #endif
@@ -974,8 +975,10 @@ int fwevt_test_provider_read_events(
      void )
 {
 	libcerror_error_t *error      = NULL;
+	libfwevt_event_t *event       = NULL;
 	libfwevt_provider_t *provider = NULL;
 	uint32_t events_offset        = 0;
+	uint8_t event_version         = 0;
 	int result                    = 0;
 
 	/* Initialize test
@@ -1032,6 +1035,83 @@ int fwevt_test_provider_read_events(
 	 "error",
 	 error );
 
+	result = libfwevt_provider_get_event_by_identifier(
+	          provider,
+	          1,
+	          &event,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "event",
+	 event );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_event_get_version(
+	          event,
+	          &event_version,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	event = NULL;
+
+	result = libfwevt_provider_get_event_by_identifier_and_version(
+	          provider,
+	          1,
+	          event_version,
+	          &event,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "event",
+	 event );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	event = NULL;
+
+	result = libfwevt_provider_get_event_by_identifier_and_version(
+	          provider,
+	          1,
+	          event_version + 1,
+	          &event,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "event",
+	 event );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Clean up
 	 */
 	result = libfwevt_internal_provider_free(
@@ -2626,6 +2706,209 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfwevt_provider_set_read_on_demand function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_provider_set_read_on_demand(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	libfwevt_provider_t *provider = NULL;
+	int number_of_events          = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libfwevt_provider_initialize(
+	          &provider,
+	          fwevt_test_provider_identifier_data1,
+	          16,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "provider",
+	 provider );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_provider_read_data(
+	          provider,
+	          fwevt_test_provider_data1,
+	          598,
+	          0,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwevt_provider_set_read_on_demand(
+	          provider,
+	          fwevt_test_provider_data1,
+	          598,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_EQUAL_UINT16(
+	 "unread_tables_flags",
+	 ( (libfwevt_internal_provider_t *) provider )->unread_tables_flags,
+	 LIBFWEVT_PROVIDER_TABLE_FLAG_ALL );
+
+	result = libfwevt_provider_get_number_of_events(
+	          provider,
+	          &number_of_events,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_events",
+	 number_of_events,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_EQUAL_UINT16(
+	 "unread_tables_flags",
+	 ( (libfwevt_internal_provider_t *) provider )->unread_tables_flags,
+	 (uint16_t) ( LIBFWEVT_PROVIDER_TABLE_FLAG_ALL & ~( LIBFWEVT_PROVIDER_TABLE_FLAG_EVENTS ) ) );
+
+	/* Test error cases
+	 */
+	result = libfwevt_provider_set_read_on_demand(
+	          NULL,
+	          fwevt_test_provider_data1,
+	          598,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_provider_set_read_on_demand(
+	          provider,
+	          NULL,
+	          598,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_provider_set_read_on_demand(
+	          provider,
+	          fwevt_test_provider_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_internal_provider_read_table_on_demand(
+	          NULL,
+	          LIBFWEVT_PROVIDER_TABLE_FLAG_EVENTS,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwevt_internal_provider_free(
+	          (libfwevt_internal_provider_t **) &provider,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "provider",
+	 provider );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( provider != NULL )
+	{
+		libfwevt_internal_provider_free(
+		 (libfwevt_internal_provider_t **) &provider,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfwevt_provider_compare_identifier function
  * Returns 1 if successful or 0 if not
  */
@@ -3335,6 +3618,114 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfwevt_provider_get_event_by_identifier_and_version function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_provider_get_event_by_identifier_and_version(
+     libfwevt_provider_t *provider )
+{
+	libcerror_error_t *error = NULL;
+	libfwevt_event_t *event  = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_provider_get_event_by_identifier_and_version(
+	          provider,
+	          0,
+	          0,
+	          &event,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	if( result != 0 )
+	{
+		FWEVT_TEST_ASSERT_IS_NOT_NULL(
+		 "event",
+		 event );
+
+		result = libfwevt_event_free(
+		          &event,
+		          &error );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWEVT_TEST_ASSERT_IS_NULL(
+		 "event",
+		 event );
+
+		FWEVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libfwevt_provider_get_event_by_identifier_and_version(
+	          NULL,
+	          0,
+	          0,
+	          &event,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_provider_get_event_by_identifier_and_version(
+	          provider,
+	          0,
+	          0,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( event != NULL )
+	{
+		libfwevt_event_free(
+		 &event,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfwevt_provider_get_number_of_keywords function
  * Returns 1 if successful or 0 if not
  */
@@ -4778,6 +5169,126 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfwevt_provider_get_template_by_identifier function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_provider_get_template_by_identifier(
+     libfwevt_provider_t *provider )
+{
+	uint8_t template_identifier[ 16 ] = {
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
+
+	libcerror_error_t *error          = NULL;
+	libfwevt_template_t *template     = NULL;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_provider_get_template_by_identifier(
+	          provider,
+	          template_identifier,
+	          16,
+	          &template,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_provider_get_template_by_identifier(
+	          NULL,
+	          template_identifier,
+	          16,
+	          &template,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_provider_get_template_by_identifier(
+	          provider,
+	          NULL,
+	          16,
+	          &template,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_provider_get_template_by_identifier(
+	          provider,
+	          template_identifier,
+	          8,
+	          &template,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_provider_get_template_by_identifier(
+	          provider,
+	          template_identifier,
+	          16,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
 
 /* The main program
@@ -4855,6 +5366,10 @@ int main(
 	 "libfwevt_provider_read_templates",
 	 fwevt_test_provider_read_templates );
 
+	FWEVT_TEST_RUN(
+	 "libfwevt_provider_set_read_on_demand",
+	 fwevt_test_provider_set_read_on_demand );
+
 	FWEVT_TEST_RUN(
 	 "libfwevt_provider_compare_identifier",
 	 fwevt_test_provider_compare_identifier );
@@ -4923,6 +5438,11 @@ int main(
 	 fwevt_test_provider_get_event_by_identifier,
 	 provider );
 
+	FWEVT_TEST_RUN_WITH_ARGS(
+	 "libfwevt_provider_get_event_by_identifier_and_version",
+	 fwevt_test_provider_get_event_by_identifier_and_version,
+	 provider );
+
 	FWEVT_TEST_RUN_WITH_ARGS(
 	 "libfwevt_provider_get_number_of_keywords",
 	 fwevt_test_provider_get_number_of_keywords,
@@ -4988,6 +5508,11 @@ int main(
 	 fwevt_test_provider_get_template_by_offset,
 	 provider );
 
+	FWEVT_TEST_RUN_WITH_ARGS(
+	 "libfwevt_provider_get_template_by_identifier",
+	 fwevt_test_provider_get_template_by_identifier,
+	 provider );
+
 	/* Clean up
 	 */
 	result = libfwevt_internal_provider_free(
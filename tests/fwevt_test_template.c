@@ -34,6 +34,7 @@
 #include "fwevt_test_memory.h"
 #include "fwevt_test_unused.h"
 
+#include "../libfwevt/libfwevt_definitions.h"
 #include "../libfwevt/libfwevt_template.h"
 
 unsigned char fwevt_test_template_data1[ 268 ] = {
@@ -640,6 +641,202 @@ on_error:
 
 #if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
 
+/* Tests the libfwevt_template_read_with_flags function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_template_read_with_flags(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	libfwevt_template_t *template = NULL;
+	uint32_t size                 = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libfwevt_template_initialize(
+	          &template,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "template",
+	 template );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwevt_template_read_with_flags(
+	          template,
+	          fwevt_test_template_data1,
+	          268,
+	          0,
+	          LIBFWEVT_TEMPLATE_READ_FLAG_BORROW_DATA,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_template_get_size(
+	          template,
+	          &size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_UINT32(
+	 "size",
+	 size,
+	 (uint32_t) 268 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_EQUAL_UINT8(
+	 "template->data_is_borrowed",
+	 ( (libfwevt_internal_template_t *) template )->data_is_borrowed,
+	 (uint8_t) 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "template->data",
+	 ( ( (libfwevt_internal_template_t *) template )->data == fwevt_test_template_data1 ),
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libfwevt_template_read_with_flags(
+	          template,
+	          fwevt_test_template_data1,
+	          268,
+	          0,
+	          LIBFWEVT_TEMPLATE_READ_FLAG_BORROW_DATA,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwevt_template_free(
+	          &template,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "template",
+	 template );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libfwevt_template_initialize(
+	          &template,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "template",
+	 template );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_template_read_with_flags(
+	          template,
+	          fwevt_test_template_data1,
+	          268,
+	          0,
+	          0xff,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwevt_template_free(
+	          &template,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "template",
+	 template );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( template != NULL )
+	{
+		libfwevt_template_free(
+		 &template,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfwevt_template_read_header function
  * Returns 1 if successful or 0 if not
  */
@@ -1229,6 +1426,10 @@ int main(
 
 #if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
 
+	FWEVT_TEST_RUN(
+	 "libfwevt_template_read_with_flags",
+	 fwevt_test_template_read_with_flags );
+
 	FWEVT_TEST_RUN(
 	 "libfwevt_template_read_header",
 	 fwevt_test_template_read_header );
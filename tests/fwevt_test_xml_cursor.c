@@ -0,0 +1,1965 @@
+/*
+ * Library xml_cursor type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwevt_test_libcerror.h"
+#include "fwevt_test_libfwevt.h"
+#include "fwevt_test_libuna.h"
+#include "fwevt_test_macros.h"
+#include "fwevt_test_memory.h"
+#include "fwevt_test_unused.h"
+
+#include "../libfwevt/libfwevt_xml_cursor.h"
+
+/* Binary XML document of:
+ * <Event>
+ *   <System Name="a" Guid="b">
+ *     <EventID>7</EventID>
+ *     <Level>4</Level>
+ *   </System>
+ *   <Data>xy</Data>
+ *   <Empty/>
+ * </Event>
+ */
+uint8_t fwevt_test_xml_cursor_data1[ 288 ] = {
+	0x0f, 0x01, 0x01, 0x00, 0x01, 0x0a, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xba, 0x0c, 0x05, 0x00, 0x45, 0x00, 0x76, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x00,
+	0x00, 0x02, 0x41, 0xa8, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f,
+	0x54, 0x06, 0x00, 0x53, 0x00, 0x79, 0x00, 0x73, 0x00, 0x74, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x00,
+	0x00, 0x3a, 0x00, 0x00, 0x00, 0x46, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x95,
+	0x04, 0x00, 0x4e, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x00, 0x00, 0x05, 0x01, 0x01, 0x00,
+	0x61, 0x00, 0x06, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x15, 0x04, 0x00, 0x47,
+	0x00, 0x75, 0x00, 0x69, 0x00, 0x64, 0x00, 0x00, 0x00, 0x05, 0x01, 0x01, 0x00, 0x62, 0x00, 0x02,
+	0x01, 0x24, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x61, 0x07,
+	0x00, 0x45, 0x00, 0x76, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x49, 0x00, 0x44, 0x00, 0x00,
+	0x00, 0x02, 0x05, 0x01, 0x01, 0x00, 0x37, 0x00, 0x04, 0x01, 0x20, 0x00, 0x00, 0x00, 0xb2, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xce, 0x05, 0x00, 0x4c, 0x00, 0x65, 0x00, 0x76, 0x00,
+	0x65, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x02, 0x05, 0x01, 0x01, 0x00, 0x34, 0x00, 0x04, 0x04, 0x01,
+	0x20, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x6f, 0x04, 0x00,
+	0x44, 0x00, 0x61, 0x00, 0x74, 0x00, 0x61, 0x00, 0x00, 0x00, 0x02, 0x05, 0x01, 0x02, 0x00, 0x78,
+	0x00, 0x79, 0x00, 0x04, 0x01, 0x19, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0d, 0x62, 0x05, 0x00, 0x45, 0x00, 0x6d, 0x00, 0x70, 0x00, 0x74, 0x00, 0x79, 0x00, 0x00,
+	0x00, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+/* Tests the libfwevt_xml_cursor_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_cursor_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libfwevt_xml_cursor_t *xml_cursor = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_FWEVT_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 1;
+	int test_number                   = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_cursor_initialize(
+	          &xml_cursor,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "xml_cursor",
+	 xml_cursor );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_cursor_free(
+	          &xml_cursor,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "xml_cursor",
+	 xml_cursor );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_cursor_initialize(
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	xml_cursor = (libfwevt_xml_cursor_t *) 0x12345678UL;
+
+	result = libfwevt_xml_cursor_initialize(
+	          &xml_cursor,
+	          &error );
+
+	xml_cursor = NULL;
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FWEVT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwevt_xml_cursor_initialize with malloc failing
+		 */
+		fwevt_test_malloc_attempts_before_fail = test_number;
+
+		result = libfwevt_xml_cursor_initialize(
+		          &xml_cursor,
+		          &error );
+
+		if( fwevt_test_malloc_attempts_before_fail != -1 )
+		{
+			fwevt_test_malloc_attempts_before_fail = -1;
+
+			if( xml_cursor != NULL )
+			{
+				libfwevt_xml_cursor_free(
+				 &xml_cursor,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWEVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWEVT_TEST_ASSERT_IS_NULL(
+			 "xml_cursor",
+			 xml_cursor );
+
+			FWEVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FWEVT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( xml_cursor != NULL )
+	{
+		libfwevt_xml_cursor_free(
+		 &xml_cursor,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_cursor_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_cursor_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_cursor_free(
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_cursor_read function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_cursor_read(
+     libfwevt_xml_cursor_t *xml_cursor )
+{
+	libcerror_error_t *error              = NULL;
+	libfwevt_xml_document_t *xml_document = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfwevt_xml_document_initialize(
+	          &xml_document,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "xml_document",
+	 xml_document );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_cursor_read(
+	          xml_cursor,
+	          xml_document,
+	          fwevt_test_xml_cursor_data1,
+	          288,
+	          0,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_cursor_read(
+	          NULL,
+	          xml_document,
+	          fwevt_test_xml_cursor_data1,
+	          288,
+	          0,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_cursor_read(
+	          xml_cursor,
+	          NULL,
+	          fwevt_test_xml_cursor_data1,
+	          288,
+	          0,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_cursor_read(
+	          xml_cursor,
+	          xml_document,
+	          fwevt_test_xml_cursor_data1,
+	          288,
+	          288,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The cursor is cleared when reading fails
+	 */
+	result = libfwevt_xml_cursor_go_to_root(
+	          xml_cursor,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfwevt_xml_document_free(
+	          &xml_document,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "xml_document",
+	 xml_document );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( xml_document != NULL )
+	{
+		libfwevt_xml_document_free(
+		 &xml_document,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_cursor_read_xml_tag function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_cursor_read_xml_tag(
+     libfwevt_xml_cursor_t *xml_cursor )
+{
+	libcerror_error_t *error              = NULL;
+	libfwevt_xml_document_t *xml_document = NULL;
+	libfwevt_xml_tag_t *root_xml_tag      = NULL;
+	int number_of_attributes              = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfwevt_xml_document_initialize(
+	          &xml_document,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "xml_document",
+	 xml_document );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_document_read(
+	          xml_document,
+	          fwevt_test_xml_cursor_data1,
+	          288,
+	          0,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_document_get_root_xml_tag(
+	          xml_document,
+	          &root_xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "root_xml_tag",
+	 root_xml_tag );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_cursor_read_xml_tag(
+	          xml_cursor,
+	          root_xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_cursor_enter_child(
+	          xml_cursor,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_cursor_get_number_of_attributes(
+	          xml_cursor,
+	          &number_of_attributes,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_attributes",
+	 number_of_attributes,
+	 2 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_cursor_read_xml_tag(
+	          NULL,
+	          root_xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_cursor_read_xml_tag(
+	          xml_cursor,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwevt_xml_document_free(
+	          &xml_document,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "xml_document",
+	 xml_document );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( xml_document != NULL )
+	{
+		libfwevt_xml_document_free(
+		 &xml_document,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_cursor_enter_child, libfwevt_xml_cursor_next and libfwevt_xml_cursor_leave functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_cursor_navigation(
+     libfwevt_xml_cursor_t *xml_cursor )
+{
+	uint8_t utf8_name[ 16 ];
+
+	uint8_t expected_utf8_name1[ 8 ] = { 'E', 'v', 'e', 'n', 't', 'I', 'D', 0 };
+	uint8_t expected_utf8_name2[ 6 ] = { 'L', 'e', 'v', 'e', 'l', 0 };
+	uint8_t expected_utf8_name3[ 6 ] = { 'E', 'm', 'p', 't', 'y', 0 };
+	libcerror_error_t *error         = NULL;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_cursor_go_to_root(
+	          xml_cursor,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The root element has no siblings or parent
+	 */
+	result = libfwevt_xml_cursor_next(
+	          xml_cursor,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_cursor_leave(
+	          xml_cursor,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Move to Event/System/EventID
+	 */
+	result = libfwevt_xml_cursor_enter_child(
+	          xml_cursor,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_cursor_enter_child(
+	          xml_cursor,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_cursor_get_utf8_name(
+	          xml_cursor,
+	          utf8_name,
+	          16,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          expected_utf8_name1,
+	          utf8_name,
+	          8 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The value of EventID is skipped, it has no sub elements
+	 */
+	result = libfwevt_xml_cursor_enter_child(
+	          xml_cursor,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Move to Event/System/Level
+	 */
+	result = libfwevt_xml_cursor_next(
+	          xml_cursor,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_cursor_get_utf8_name(
+	          xml_cursor,
+	          utf8_name,
+	          16,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          expected_utf8_name2,
+	          utf8_name,
+	          6 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfwevt_xml_cursor_next(
+	          xml_cursor,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Move to Event/Empty
+	 */
+	result = libfwevt_xml_cursor_leave(
+	          xml_cursor,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_cursor_next(
+	          xml_cursor,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_cursor_next(
+	          xml_cursor,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_cursor_get_utf8_name(
+	          xml_cursor,
+	          utf8_name,
+	          16,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          expected_utf8_name3,
+	          utf8_name,
+	          6 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfwevt_xml_cursor_next(
+	          xml_cursor,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_cursor_go_to_root(
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_cursor_next(
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_cursor_enter_child(
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_cursor_leave(
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_cursor_get_utf8_name_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_cursor_get_utf8_name_size(
+     libfwevt_xml_cursor_t *xml_cursor )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf8_name_size    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_cursor_go_to_root(
+	          xml_cursor,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_cursor_get_utf8_name_size(
+	          xml_cursor,
+	          &utf8_name_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_name_size",
+	 utf8_name_size,
+	 (size_t) 6 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_cursor_get_utf8_name_size(
+	          NULL,
+	          &utf8_name_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_cursor_get_utf16_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_cursor_get_utf16_name(
+     libfwevt_xml_cursor_t *xml_cursor )
+{
+	uint16_t utf16_name[ 16 ];
+
+	uint16_t expected_utf16_name[ 6 ] = { 'E', 'v', 'e', 'n', 't', 0 };
+	libcerror_error_t *error          = NULL;
+	size_t utf16_name_size            = 0;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_cursor_go_to_root(
+	          xml_cursor,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_cursor_get_utf16_name_size(
+	          xml_cursor,
+	          &utf16_name_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_name_size",
+	 utf16_name_size,
+	 (size_t) 6 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_cursor_get_utf16_name(
+	          xml_cursor,
+	          utf16_name,
+	          16,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          expected_utf16_name,
+	          utf16_name,
+	          sizeof( uint16_t ) * 6 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_cursor_get_utf16_name(
+	          NULL,
+	          utf16_name,
+	          16,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_cursor_get_value function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_cursor_get_value(
+     libfwevt_xml_cursor_t *xml_cursor )
+{
+	uint8_t utf8_string[ 16 ];
+
+	uint8_t expected_utf8_string[ 3 ]        = { 'x', 'y', 0 };
+	libcerror_error_t *error                 = NULL;
+	libfwevt_xml_value_t *previous_xml_value = NULL;
+	libfwevt_xml_value_t *xml_value          = NULL;
+	uint8_t value_type                       = 0;
+	int result                               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_cursor_go_to_root(
+	          xml_cursor,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The root element only contains sub elements
+	 */
+	result = libfwevt_xml_cursor_get_value_type(
+	          xml_cursor,
+	          &value_type,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_cursor_get_value(
+	          xml_cursor,
+	          &xml_value,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Move to Event/Data
+	 */
+	result = libfwevt_xml_cursor_enter_child(
+	          xml_cursor,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_cursor_next(
+	          xml_cursor,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_cursor_get_value_type(
+	          xml_cursor,
+	          &value_type,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_UINT8(
+	 "value_type",
+	 value_type,
+	 LIBFWEVT_VALUE_TYPE_STRING_UTF16 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_cursor_get_value(
+	          xml_cursor,
+	          &xml_value,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "xml_value",
+	 xml_value );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_value_get_data_as_utf8_string(
+	          xml_value,
+	          utf8_string,
+	          16,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          expected_utf8_string,
+	          utf8_string,
+	          3 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* The XML value of the cursor is reused
+	 */
+	previous_xml_value = xml_value;
+
+	result = libfwevt_xml_cursor_get_value(
+	          xml_cursor,
+	          &xml_value,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "xml_value == previous_xml_value",
+	 (int) ( xml_value == previous_xml_value ),
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_cursor_get_value(
+	          NULL,
+	          &xml_value,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_cursor_get_value(
+	          xml_cursor,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_cursor_get_value_type(
+	          xml_cursor,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_cursor_get_attribute_utf8_name and libfwevt_xml_cursor_get_attribute_value functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_cursor_get_attribute_value(
+     libfwevt_xml_cursor_t *xml_cursor )
+{
+	uint8_t utf8_string[ 16 ];
+
+	uint8_t expected_utf8_name[ 5 ]   = { 'G', 'u', 'i', 'd', 0 };
+	uint8_t expected_utf8_string[ 2 ] = { 'b', 0 };
+	libcerror_error_t *error          = NULL;
+	libfwevt_xml_value_t *xml_value   = NULL;
+	size_t utf8_name_size             = 0;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_cursor_go_to_root(
+	          xml_cursor,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_cursor_enter_child(
+	          xml_cursor,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_cursor_get_attribute_utf8_name_size(
+	          xml_cursor,
+	          1,
+	          &utf8_name_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_name_size",
+	 utf8_name_size,
+	 (size_t) 5 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_cursor_get_attribute_utf8_name(
+	          xml_cursor,
+	          1,
+	          utf8_string,
+	          16,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          expected_utf8_name,
+	          utf8_string,
+	          5 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfwevt_xml_cursor_get_attribute_value(
+	          xml_cursor,
+	          1,
+	          &xml_value,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "xml_value",
+	 xml_value );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_value_get_data_as_utf8_string(
+	          xml_value,
+	          utf8_string,
+	          16,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          expected_utf8_string,
+	          utf8_string,
+	          2 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_cursor_get_attribute_value(
+	          NULL,
+	          1,
+	          &xml_value,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_cursor_get_attribute_value(
+	          xml_cursor,
+	          -1,
+	          &xml_value,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_cursor_get_attribute_value(
+	          xml_cursor,
+	          2,
+	          &xml_value,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_cursor_get_attribute_value(
+	          xml_cursor,
+	          1,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_cursor_get_attribute_value_by_utf8_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_cursor_get_attribute_value_by_utf8_name(
+     libfwevt_xml_cursor_t *xml_cursor )
+{
+	uint8_t utf8_string[ 16 ];
+
+	uint8_t expected_utf8_string[ 2 ] = { 'a', 0 };
+	libcerror_error_t *error          = NULL;
+	libfwevt_xml_value_t *xml_value   = NULL;
+	int result                        = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_cursor_go_to_root(
+	          xml_cursor,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_cursor_enter_child(
+	          xml_cursor,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_cursor_get_attribute_value_by_utf8_name(
+	          xml_cursor,
+	          (uint8_t *) "name",
+	          4,
+	          &xml_value,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "xml_value",
+	 xml_value );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_value_get_data_as_utf8_string(
+	          xml_value,
+	          utf8_string,
+	          16,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          expected_utf8_string,
+	          utf8_string,
+	          2 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfwevt_xml_cursor_get_attribute_value_by_utf8_name(
+	          xml_cursor,
+	          (uint8_t *) "Nam",
+	          3,
+	          &xml_value,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_cursor_get_attribute_value_by_utf8_name(
+	          NULL,
+	          (uint8_t *) "Name",
+	          4,
+	          &xml_value,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_cursor_get_attribute_value_by_utf8_name(
+	          xml_cursor,
+	          NULL,
+	          4,
+	          &xml_value,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_cursor_get_attribute_value_by_utf8_name(
+	          xml_cursor,
+	          (uint8_t *) "Name",
+	          4,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWEVT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWEVT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWEVT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWEVT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	libcerror_error_t *error              = NULL;
+	libfwevt_xml_cursor_t *xml_cursor     = NULL;
+	libfwevt_xml_document_t *xml_document = NULL;
+	uint8_t *binary_data                  = NULL;
+	int result                            = 0;
+
+	FWEVT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWEVT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_xml_cursor_initialize",
+	 fwevt_test_xml_cursor_initialize );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_xml_cursor_free",
+	 fwevt_test_xml_cursor_free );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize xml_cursor for tests
+	 */
+	result = libfwevt_xml_cursor_initialize(
+	          &xml_cursor,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "xml_cursor",
+	 xml_cursor );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_RUN_WITH_ARGS(
+	 "libfwevt_xml_cursor_read",
+	 fwevt_test_xml_cursor_read,
+	 xml_cursor );
+
+	FWEVT_TEST_RUN_WITH_ARGS(
+	 "libfwevt_xml_cursor_read_xml_tag",
+	 fwevt_test_xml_cursor_read_xml_tag,
+	 xml_cursor );
+
+	result = libfwevt_xml_document_initialize(
+	          &xml_document,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "xml_document",
+	 xml_document );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The cursor is read from a copy of the binary data that is freed
+	 * after the cursor is used, since the cursor refers to the names
+	 * and value data in the binary data
+	 */
+	binary_data = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * 288 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "binary_data",
+	 binary_data );
+
+	memory_copy(
+	 binary_data,
+	 fwevt_test_xml_cursor_data1,
+	 288 );
+
+	result = libfwevt_xml_cursor_read(
+	          xml_cursor,
+	          xml_document,
+	          binary_data,
+	          288,
+	          0,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_RUN_WITH_ARGS(
+	 "libfwevt_xml_cursor_navigation",
+	 fwevt_test_xml_cursor_navigation,
+	 xml_cursor );
+
+	FWEVT_TEST_RUN_WITH_ARGS(
+	 "libfwevt_xml_cursor_get_utf8_name_size",
+	 fwevt_test_xml_cursor_get_utf8_name_size,
+	 xml_cursor );
+
+	FWEVT_TEST_RUN_WITH_ARGS(
+	 "libfwevt_xml_cursor_get_utf16_name",
+	 fwevt_test_xml_cursor_get_utf16_name,
+	 xml_cursor );
+
+	FWEVT_TEST_RUN_WITH_ARGS(
+	 "libfwevt_xml_cursor_get_value",
+	 fwevt_test_xml_cursor_get_value,
+	 xml_cursor );
+
+	FWEVT_TEST_RUN_WITH_ARGS(
+	 "libfwevt_xml_cursor_get_attribute_value",
+	 fwevt_test_xml_cursor_get_attribute_value,
+	 xml_cursor );
+
+	FWEVT_TEST_RUN_WITH_ARGS(
+	 "libfwevt_xml_cursor_get_attribute_value_by_utf8_name",
+	 fwevt_test_xml_cursor_get_attribute_value_by_utf8_name,
+	 xml_cursor );
+
+	/* Clean up
+	 */
+	memory_free(
+	 binary_data );
+
+	binary_data = NULL;
+
+	result = libfwevt_xml_cursor_free(
+	          &xml_cursor,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "xml_cursor",
+	 xml_cursor );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_document_free(
+	          &xml_document,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "xml_document",
+	 xml_document );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( xml_cursor != NULL )
+	{
+		libfwevt_xml_cursor_free(
+		 &xml_cursor,
+		 NULL );
+	}
+	if( xml_document != NULL )
+	{
+		libfwevt_xml_document_free(
+		 &xml_document,
+		 NULL );
+	}
+	if( binary_data != NULL )
+	{
+		memory_free(
+		 binary_data );
+	}
+	return( EXIT_FAILURE );
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -4483,8 +4484,14 @@ on_error:
 int fwevt_test_xml_document_read(
      void )
 {
+	uint8_t expected_utf8_string[ 2048 ];
+	uint8_t utf8_string[ 2048 ];
+
 	libcerror_error_t *error              = NULL;
 	libfwevt_xml_document_t *xml_document = NULL;
+	size_t arena_utf8_string_size         = 0;
+	size_t flat_tree_utf8_string_size     = 0;
+	size_t utf8_string_size               = 0;
 	int result                            = 0;
 
 	/* Initialize test
@@ -4506,6 +4513,19 @@ int fwevt_test_xml_document_read(
 	 "error",
 	 error );
 
+	/* The UTF-8 string size can be larger than the rendered string,
+	 * hence the strings are cleared so that their remainders are equal
+	 */
+	memory_set(
+	 expected_utf8_string,
+	 0,
+	 2048 );
+
+	memory_set(
+	 utf8_string,
+	 0,
+	 2048 );
+
 	/* Test regular cases
 	 */
 	result = libfwevt_xml_document_read(
@@ -4526,6 +4546,202 @@ int fwevt_test_xml_document_read(
 	 "error",
 	 error );
 
+	result = libfwevt_xml_document_get_utf8_xml_string_size(
+	          xml_document,
+	          &utf8_string_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_document_get_utf8_xml_string(
+	          xml_document,
+	          expected_utf8_string,
+	          2048,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_document_free(
+	          &xml_document,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test read with the XML tags and values allocated from an arena
+	 */
+	result = libfwevt_xml_document_initialize(
+	          &xml_document,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_document_read(
+	          xml_document,
+	          fwevt_test_xml_document_data1,
+	          65536,
+	          0x850,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS | LIBFWEVT_XML_DOCUMENT_READ_FLAG_USE_ARENA,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_document_get_utf8_xml_string_size(
+	          xml_document,
+	          &arena_utf8_string_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "arena_utf8_string_size",
+	 arena_utf8_string_size,
+	 utf8_string_size );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_document_get_utf8_xml_string(
+	          xml_document,
+	          utf8_string,
+	          2048,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          expected_utf8_string,
+	          utf8_string_size );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test read with the XML tags stored in a flat tree
+	 */
+	result = libfwevt_xml_document_reset(
+	          xml_document,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_document_read(
+	          xml_document,
+	          fwevt_test_xml_document_data1,
+	          65536,
+	          0x850,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS | LIBFWEVT_XML_DOCUMENT_READ_FLAG_FLAT_TREE,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_document_get_utf8_xml_string_size(
+	          xml_document,
+	          &flat_tree_utf8_string_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "flat_tree_utf8_string_size",
+	 flat_tree_utf8_string_size,
+	 utf8_string_size );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_document_get_utf8_xml_string(
+	          xml_document,
+	          utf8_string,
+	          2048,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          expected_utf8_string,
+	          utf8_string_size );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
 	/* Test error cases
 	 */
 	result = libfwevt_xml_document_read(
@@ -4585,16 +4801,30 @@ on_error:
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
-
-/* Tests the libfwevt_xml_document_read_with_template_values function
+/* Tests the libfwevt_xml_document_reset function
  * Returns 1 if successful or 0 if not
  */
-int fwevt_test_xml_document_read_with_template_values(
+int fwevt_test_xml_document_reset(
      void )
 {
+	uint8_t read_flags[ 7 ] = {
+		LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS | LIBFWEVT_XML_DOCUMENT_READ_FLAG_USE_ARENA,
+		LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS | LIBFWEVT_XML_DOCUMENT_READ_FLAG_USE_ARENA,
+		LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+		LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS | LIBFWEVT_XML_DOCUMENT_READ_FLAG_USE_ARENA | LIBFWEVT_XML_DOCUMENT_READ_FLAG_BORROW_DATA,
+		LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS | LIBFWEVT_XML_DOCUMENT_READ_FLAG_FLAT_TREE,
+		LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS | LIBFWEVT_XML_DOCUMENT_READ_FLAG_FLAT_TREE,
+		LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS | LIBFWEVT_XML_DOCUMENT_READ_FLAG_USE_ARENA | LIBFWEVT_XML_DOCUMENT_READ_FLAG_FLAT_TREE };
+
+	uint8_t expected_utf8_string[ 2048 ];
+	uint8_t utf8_string[ 2048 ];
+
 	libcerror_error_t *error              = NULL;
 	libfwevt_xml_document_t *xml_document = NULL;
+	libfwevt_xml_tag_t *root_xml_tag      = NULL;
+	size_t expected_utf8_string_size      = 0;
+	size_t utf8_string_size               = 0;
+	int read_index                        = 0;
 	int result                            = 0;
 
 	/* Initialize test
@@ -4616,18 +4846,3456 @@ int fwevt_test_xml_document_read_with_template_values(
 	 "error",
 	 error );
 
+	/* The UTF-8 string size can be larger than the rendered string,
+	 * hence the strings are cleared so that their remainders are equal
+	 */
+	memory_set(
+	 expected_utf8_string,
+	 0,
+	 2048 );
+
+	memory_set(
+	 utf8_string,
+	 0,
+	 2048 );
+
 	/* Test regular cases
 	 */
-	result = libfwevt_xml_document_read_with_template_values(
+	result = libfwevt_xml_document_reset(
 	          xml_document,
-	          fwevt_test_xml_document_data1,
-	          65536,
-	          0x850,
-	          LIBUNA_CODEPAGE_WINDOWS_1252,
-	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( read_index = 0;
+	     read_index < 7;
+	     read_index++ )
+	{
+		result = libfwevt_xml_document_read(
+		          xml_document,
+		          fwevt_test_xml_document_data1,
+		          65536,
+		          0x850,
+		          LIBUNA_CODEPAGE_WINDOWS_1252,
+		          read_flags[ read_index ],
+		          &error );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWEVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwevt_xml_document_get_utf8_xml_string_size(
+		          xml_document,
+		          &utf8_string_size,
+		          &error );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWEVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwevt_xml_document_get_utf8_xml_string(
+		          xml_document,
+		          utf8_string,
+		          2048,
+		          &error );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWEVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( read_index == 0 )
+		{
+			expected_utf8_string_size = utf8_string_size;
+
+			memory_copy(
+			 expected_utf8_string,
+			 utf8_string,
+			 utf8_string_size );
+		}
+		FWEVT_TEST_ASSERT_EQUAL_SIZE(
+		 "utf8_string_size",
+		 utf8_string_size,
+		 expected_utf8_string_size );
+
+		result = memory_compare(
+		          utf8_string,
+		          expected_utf8_string,
+		          utf8_string_size );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+
+		result = libfwevt_xml_document_reset(
+		          xml_document,
+		          &error );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWEVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwevt_xml_document_get_root_xml_tag(
+		          xml_document,
+		          &root_xml_tag,
+		          &error );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWEVT_TEST_ASSERT_IS_NULL(
+		 "root_xml_tag",
+		 root_xml_tag );
+
+		FWEVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libfwevt_xml_document_reset(
 	          NULL,
 	          &error );
 
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test reset of a document read without an arena
+	 */
+	result = libfwevt_xml_document_free(
+	          &xml_document,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_document_initialize(
+	          &xml_document,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "xml_document",
+	 xml_document );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_document_read(
+	          xml_document,
+	          fwevt_test_xml_document_data1,
+	          65536,
+	          0x850,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_document_reset(
+	          xml_document,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwevt_xml_document_free(
+	          &xml_document,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "xml_document",
+	 xml_document );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( xml_document != NULL )
+	{
+		libfwevt_xml_document_free(
+		 &xml_document,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_document_set_template_cache function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_document_set_template_cache(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libfwevt_xml_document_t *xml_document         = NULL;
+	libfwevt_xml_template_cache_t *template_cache = NULL;
+	size_t expected_utf8_xml_string_size          = 0;
+	size_t utf8_xml_string_size                   = 0;
+	int number_of_definitions                     = 0;
+	int read_iteration                            = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libfwevt_xml_template_cache_initialize(
+	          &template_cache,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "template_cache",
+	 template_cache );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The first read without cache, the second read fills the cache
+	 * and the third read uses the cached template definitions
+	 */
+	for( read_iteration = 0;
+	     read_iteration < 3;
+	     read_iteration++ )
+	{
+		result = libfwevt_xml_document_initialize(
+		          &xml_document,
+		          &error );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWEVT_TEST_ASSERT_IS_NOT_NULL(
+		 "xml_document",
+		 xml_document );
+
+		FWEVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( read_iteration > 0 )
+		{
+			result = libfwevt_xml_document_set_template_cache(
+			          xml_document,
+			          template_cache,
+			          &error );
+
+			FWEVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWEVT_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		result = libfwevt_xml_document_read(
+		          xml_document,
+		          fwevt_test_xml_document_data1,
+		          65536,
+		          0x850,
+		          LIBUNA_CODEPAGE_WINDOWS_1252,
+		          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+		          &error );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWEVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libfwevt_xml_document_get_utf8_xml_string_size(
+		          xml_document,
+		          &utf8_xml_string_size,
+		          &error );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWEVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( read_iteration == 0 )
+		{
+			expected_utf8_xml_string_size = utf8_xml_string_size;
+		}
+		FWEVT_TEST_ASSERT_EQUAL_SIZE(
+		 "utf8_xml_string_size",
+		 utf8_xml_string_size,
+		 expected_utf8_xml_string_size );
+
+		result = libfwevt_xml_document_free(
+		          &xml_document,
+		          &error );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWEVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libfwevt_xml_template_cache_get_number_of_definitions(
+	          template_cache,
+	          &number_of_definitions,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_GREATER_THAN_INT(
+	 "number_of_definitions",
+	 number_of_definitions,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_document_set_template_cache(
+	          NULL,
+	          template_cache,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwevt_xml_template_cache_free(
+	          &template_cache,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "template_cache",
+	 template_cache );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( xml_document != NULL )
+	{
+		libfwevt_xml_document_free(
+		 &xml_document,
+		 NULL );
+	}
+	if( template_cache != NULL )
+	{
+		libfwevt_xml_template_cache_free(
+		 &template_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_document_set_path_filter function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_document_set_path_filter(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libfwevt_xml_document_t *xml_document   = NULL;
+	libfwevt_xml_path_filter_t *path_filter = NULL;
+	libfwevt_xml_tag_t *root_xml_tag        = NULL;
+	const uint8_t *value_data               = NULL;
+	size_t value_data_size                  = 0;
+	uint8_t value_type                      = 0;
+	int number_of_results                   = 0;
+	int path_index                          = 0;
+	int result                              = 0;
+	int result_index                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfwevt_xml_path_filter_initialize(
+	          &path_filter,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "path_filter",
+	 path_filter );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_path_filter_append_utf8_path(
+	          path_filter,
+	          (uint8_t *) "System/EventID",
+	          14,
+	          &path_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_path_filter_append_utf8_path(
+	          path_filter,
+	          (uint8_t *) "System/TimeCreated/@SystemTime",
+	          30,
+	          &path_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_document_initialize(
+	          &xml_document,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "xml_document",
+	 xml_document );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_document_set_path_filter(
+	          xml_document,
+	          path_filter,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_document_read_with_path_filter(
+	          xml_document,
+	          fwevt_test_xml_document_data1,
+	          65536,
+	          0x850,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* No XML tags are built when reading with a path filter
+	 */
+	result = libfwevt_xml_document_get_root_xml_tag(
+	          xml_document,
+	          &root_xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_NOT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "root_xml_tag",
+	 root_xml_tag );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_document_get_number_of_path_filter_results(
+	          xml_document,
+	          &number_of_results,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_results",
+	 number_of_results,
+	 2 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( result_index = 0;
+	     result_index < number_of_results;
+	     result_index++ )
+	{
+		result = libfwevt_xml_document_get_path_filter_result_by_index(
+		          xml_document,
+		          result_index,
+		          &path_index,
+		          &value_type,
+		          &value_data,
+		          &value_data_size,
+		          &error );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "path_index",
+		 path_index,
+		 result_index );
+
+		FWEVT_TEST_ASSERT_IS_NOT_NULL(
+		 "value_data",
+		 value_data );
+
+		FWEVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libfwevt_xml_document_set_path_filter(
+	          NULL,
+	          path_filter,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_get_number_of_path_filter_results(
+	          NULL,
+	          &number_of_results,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_get_number_of_path_filter_results(
+	          xml_document,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_get_path_filter_result_by_index(
+	          NULL,
+	          0,
+	          &path_index,
+	          &value_type,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_get_path_filter_result_by_index(
+	          xml_document,
+	          -1,
+	          &path_index,
+	          &value_type,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_get_path_filter_result_by_index(
+	          xml_document,
+	          number_of_results,
+	          &path_index,
+	          &value_type,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_get_path_filter_result_by_index(
+	          xml_document,
+	          0,
+	          NULL,
+	          &value_type,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* XML tags cannot be read while a path filter is set
+	 */
+	result = libfwevt_xml_document_read(
+	          xml_document,
+	          fwevt_test_xml_document_data1,
+	          65536,
+	          0x850,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_read_with_path_filter(
+	          xml_document,
+	          fwevt_test_xml_document_data1,
+	          65536,
+	          0x850,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS | LIBFWEVT_XML_DOCUMENT_READ_FLAG_FLAT_TREE,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_read_with_path_filter(
+	          NULL,
+	          fwevt_test_xml_document_data1,
+	          65536,
+	          0x850,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_set_path_filter(
+	          xml_document,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_document_read_with_path_filter(
+	          xml_document,
+	          fwevt_test_xml_document_data1,
+	          65536,
+	          0x850,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwevt_xml_document_free(
+	          &xml_document,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "xml_document",
+	 xml_document );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_path_filter_free(
+	          &path_filter,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "path_filter",
+	 path_filter );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( xml_document != NULL )
+	{
+		libfwevt_xml_document_free(
+		 &xml_document,
+		 NULL );
+	}
+	if( path_filter != NULL )
+	{
+		libfwevt_xml_path_filter_free(
+		 &path_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* The parse callbacks test data
+ */
+typedef struct fwevt_test_xml_document_parse_counts fwevt_test_xml_document_parse_counts_t;
+
+struct fwevt_test_xml_document_parse_counts
+{
+	/* The number of start element callbacks
+	 */
+	int number_of_start_elements;
+
+	/* The number of attribute callbacks
+	 */
+	int number_of_attributes;
+
+	/* The number of value callbacks
+	 */
+	int number_of_values;
+
+	/* The number of substitution callbacks
+	 */
+	int number_of_substitutions;
+
+	/* The number of end element callbacks
+	 */
+	int number_of_end_elements;
+
+	/* The depth of the current element
+	 */
+	int depth;
+
+	/* The number of start element callbacks after which to fail, 0 to never fail
+	 */
+	int fail_after_number_of_start_elements;
+};
+
+/* Counts a start element
+ * Returns 1 if successful or -1 on error
+ */
+int fwevt_test_xml_document_parse_start_element(
+     const uint8_t *name_utf16_stream,
+     size_t name_utf16_stream_size,
+     void *callback_data,
+     libcerror_error_t **error FWEVT_TEST_ATTRIBUTE_UNUSED )
+{
+	fwevt_test_xml_document_parse_counts_t *parse_counts = (fwevt_test_xml_document_parse_counts_t *) callback_data;
+
+	FWEVT_TEST_UNREFERENCED_PARAMETER( error );
+
+	if( ( name_utf16_stream == NULL )
+	 || ( name_utf16_stream_size < 2 ) )
+	{
+		return( -1 );
+	}
+	parse_counts->number_of_start_elements += 1;
+	parse_counts->depth                    += 1;
+
+	if( parse_counts->number_of_start_elements == parse_counts->fail_after_number_of_start_elements )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Counts an attribute
+ * Returns 1 if successful or -1 on error
+ */
+int fwevt_test_xml_document_parse_attribute(
+     const uint8_t *name_utf16_stream,
+     size_t name_utf16_stream_size,
+     uint8_t value_type FWEVT_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *value_data FWEVT_TEST_ATTRIBUTE_UNUSED,
+     size_t value_data_size FWEVT_TEST_ATTRIBUTE_UNUSED,
+     void *callback_data,
+     libcerror_error_t **error FWEVT_TEST_ATTRIBUTE_UNUSED )
+{
+	fwevt_test_xml_document_parse_counts_t *parse_counts = (fwevt_test_xml_document_parse_counts_t *) callback_data;
+
+	FWEVT_TEST_UNREFERENCED_PARAMETER( value_type );
+	FWEVT_TEST_UNREFERENCED_PARAMETER( value_data );
+	FWEVT_TEST_UNREFERENCED_PARAMETER( value_data_size );
+	FWEVT_TEST_UNREFERENCED_PARAMETER( error );
+
+	if( ( name_utf16_stream == NULL )
+	 || ( name_utf16_stream_size < 2 ) )
+	{
+		return( -1 );
+	}
+	parse_counts->number_of_attributes += 1;
+
+	return( 1 );
+}
+
+/* Counts a value
+ * Returns 1 if successful or -1 on error
+ */
+int fwevt_test_xml_document_parse_value(
+     uint8_t value_type FWEVT_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *value_data FWEVT_TEST_ATTRIBUTE_UNUSED,
+     size_t value_data_size FWEVT_TEST_ATTRIBUTE_UNUSED,
+     void *callback_data,
+     libcerror_error_t **error FWEVT_TEST_ATTRIBUTE_UNUSED )
+{
+	fwevt_test_xml_document_parse_counts_t *parse_counts = (fwevt_test_xml_document_parse_counts_t *) callback_data;
+
+	FWEVT_TEST_UNREFERENCED_PARAMETER( value_type );
+	FWEVT_TEST_UNREFERENCED_PARAMETER( value_data );
+	FWEVT_TEST_UNREFERENCED_PARAMETER( value_data_size );
+	FWEVT_TEST_UNREFERENCED_PARAMETER( error );
+
+	parse_counts->number_of_values += 1;
+
+	return( 1 );
+}
+
+/* Counts a substitution
+ * Returns 1 if successful or -1 on error
+ */
+int fwevt_test_xml_document_parse_substitution(
+     uint16_t template_value_index FWEVT_TEST_ATTRIBUTE_UNUSED,
+     uint8_t value_type FWEVT_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *value_data FWEVT_TEST_ATTRIBUTE_UNUSED,
+     size_t value_data_size FWEVT_TEST_ATTRIBUTE_UNUSED,
+     void *callback_data,
+     libcerror_error_t **error FWEVT_TEST_ATTRIBUTE_UNUSED )
+{
+	fwevt_test_xml_document_parse_counts_t *parse_counts = (fwevt_test_xml_document_parse_counts_t *) callback_data;
+
+	FWEVT_TEST_UNREFERENCED_PARAMETER( template_value_index );
+	FWEVT_TEST_UNREFERENCED_PARAMETER( value_type );
+	FWEVT_TEST_UNREFERENCED_PARAMETER( value_data );
+	FWEVT_TEST_UNREFERENCED_PARAMETER( value_data_size );
+	FWEVT_TEST_UNREFERENCED_PARAMETER( error );
+
+	parse_counts->number_of_substitutions += 1;
+
+	return( 1 );
+}
+
+/* Counts an end element
+ * Returns 1 if successful or -1 on error
+ */
+int fwevt_test_xml_document_parse_end_element(
+     const uint8_t *name_utf16_stream,
+     size_t name_utf16_stream_size,
+     void *callback_data,
+     libcerror_error_t **error FWEVT_TEST_ATTRIBUTE_UNUSED )
+{
+	fwevt_test_xml_document_parse_counts_t *parse_counts = (fwevt_test_xml_document_parse_counts_t *) callback_data;
+
+	FWEVT_TEST_UNREFERENCED_PARAMETER( error );
+
+	if( ( name_utf16_stream == NULL )
+	 || ( name_utf16_stream_size < 2 )
+	 || ( parse_counts->depth <= 0 ) )
+	{
+		return( -1 );
+	}
+	parse_counts->number_of_end_elements += 1;
+	parse_counts->depth                  -= 1;
+
+	return( 1 );
+}
+
+/* Tests the libfwevt_xml_document_parse_with_callbacks function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_document_parse_with_callbacks(
+     void )
+{
+	fwevt_test_xml_document_parse_counts_t cached_parse_counts;
+	fwevt_test_xml_document_parse_counts_t parse_counts;
+
+	libcerror_error_t *error                      = NULL;
+	libfwevt_xml_document_t *xml_document         = NULL;
+	libfwevt_xml_template_cache_t *template_cache = NULL;
+	int read_iteration                            = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libfwevt_xml_template_cache_initialize(
+	          &template_cache,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "template_cache",
+	 template_cache );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The first parse without cache, the second parse fills the cache
+	 * and the third parse uses the cached template definitions
+	 */
+	for( read_iteration = 0;
+	     read_iteration < 3;
+	     read_iteration++ )
+	{
+		result = libfwevt_xml_document_initialize(
+		          &xml_document,
+		          &error );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWEVT_TEST_ASSERT_IS_NOT_NULL(
+		 "xml_document",
+		 xml_document );
+
+		FWEVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( read_iteration > 0 )
+		{
+			result = libfwevt_xml_document_set_template_cache(
+			          xml_document,
+			          template_cache,
+			          &error );
+
+			FWEVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			FWEVT_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+		memory_set(
+		 &cached_parse_counts,
+		 0,
+		 sizeof( fwevt_test_xml_document_parse_counts_t ) );
+
+		result = libfwevt_xml_document_parse_with_callbacks(
+		          xml_document,
+		          fwevt_test_xml_document_data1,
+		          65536,
+		          0x850,
+		          LIBUNA_CODEPAGE_WINDOWS_1252,
+		          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+		          &fwevt_test_xml_document_parse_start_element,
+		          &fwevt_test_xml_document_parse_attribute,
+		          &fwevt_test_xml_document_parse_value,
+		          &fwevt_test_xml_document_parse_substitution,
+		          &fwevt_test_xml_document_parse_end_element,
+		          (void *) &cached_parse_counts,
+		          &error );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWEVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		FWEVT_TEST_ASSERT_GREATER_THAN_INT(
+		 "cached_parse_counts.number_of_start_elements",
+		 cached_parse_counts.number_of_start_elements,
+		 0 );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "cached_parse_counts.number_of_end_elements",
+		 cached_parse_counts.number_of_end_elements,
+		 cached_parse_counts.number_of_start_elements );
+
+		FWEVT_TEST_ASSERT_GREATER_THAN_INT(
+		 "cached_parse_counts.number_of_substitutions",
+		 cached_parse_counts.number_of_substitutions,
+		 0 );
+
+		if( read_iteration == 0 )
+		{
+			memory_copy(
+			 &parse_counts,
+			 &cached_parse_counts,
+			 sizeof( fwevt_test_xml_document_parse_counts_t ) );
+		}
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "cached_parse_counts.number_of_start_elements",
+		 cached_parse_counts.number_of_start_elements,
+		 parse_counts.number_of_start_elements );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "cached_parse_counts.number_of_attributes",
+		 cached_parse_counts.number_of_attributes,
+		 parse_counts.number_of_attributes );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "cached_parse_counts.number_of_values",
+		 cached_parse_counts.number_of_values,
+		 parse_counts.number_of_values );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "cached_parse_counts.number_of_substitutions",
+		 cached_parse_counts.number_of_substitutions,
+		 parse_counts.number_of_substitutions );
+
+		result = libfwevt_xml_document_free(
+		          &xml_document,
+		          &error );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		FWEVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test parse without callbacks
+	 */
+	result = libfwevt_xml_document_initialize(
+	          &xml_document,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_document_parse_with_callbacks(
+	          xml_document,
+	          fwevt_test_xml_document_data1,
+	          65536,
+	          0x850,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_document_parse_with_callbacks(
+	          NULL,
+	          fwevt_test_xml_document_data1,
+	          65536,
+	          0x850,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+	          &fwevt_test_xml_document_parse_start_element,
+	          &fwevt_test_xml_document_parse_attribute,
+	          &fwevt_test_xml_document_parse_value,
+	          &fwevt_test_xml_document_parse_substitution,
+	          &fwevt_test_xml_document_parse_end_element,
+	          (void *) &parse_counts,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_parse_with_callbacks(
+	          xml_document,
+	          fwevt_test_xml_document_data1,
+	          65536,
+	          0x850,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS | LIBFWEVT_XML_DOCUMENT_READ_FLAG_USE_ARENA,
+	          &fwevt_test_xml_document_parse_start_element,
+	          &fwevt_test_xml_document_parse_attribute,
+	          &fwevt_test_xml_document_parse_value,
+	          &fwevt_test_xml_document_parse_substitution,
+	          &fwevt_test_xml_document_parse_end_element,
+	          (void *) &parse_counts,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test parse with a callback that fails
+	 */
+	memory_set(
+	 &parse_counts,
+	 0,
+	 sizeof( fwevt_test_xml_document_parse_counts_t ) );
+
+	parse_counts.fail_after_number_of_start_elements = 2;
+
+	result = libfwevt_xml_document_parse_with_callbacks(
+	          xml_document,
+	          fwevt_test_xml_document_data1,
+	          65536,
+	          0x850,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+	          &fwevt_test_xml_document_parse_start_element,
+	          &fwevt_test_xml_document_parse_attribute,
+	          &fwevt_test_xml_document_parse_value,
+	          &fwevt_test_xml_document_parse_substitution,
+	          &fwevt_test_xml_document_parse_end_element,
+	          (void *) &parse_counts,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "parse_counts.number_of_start_elements",
+	 parse_counts.number_of_start_elements,
+	 2 );
+
+	/* Clean up
+	 */
+	result = libfwevt_xml_document_free(
+	          &xml_document,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "xml_document",
+	 xml_document );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_template_cache_free(
+	          &template_cache,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( xml_document != NULL )
+	{
+		libfwevt_xml_document_free(
+		 &xml_document,
+		 NULL );
+	}
+	if( template_cache != NULL )
+	{
+		libfwevt_xml_template_cache_free(
+		 &template_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+
+/* Tests the libfwevt_xml_document_read_with_template_values function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_document_read_with_template_values(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libfwevt_xml_document_t *xml_document = NULL;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfwevt_xml_document_initialize(
+	          &xml_document,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "xml_document",
+	 xml_document );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_document_read_with_template_values(
+	          xml_document,
+	          fwevt_test_xml_document_data1,
+	          65536,
+	          0x850,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libfwevt_xml_document_free(
+	          &xml_document,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "xml_document",
+	 xml_document );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libfwevt_xml_document_initialize(
+	          &xml_document,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "xml_document",
+	 xml_document );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_document_read_with_template_values(
+	          NULL,
+	          fwevt_test_xml_document_data1,
+	          65536,
+	          0x850,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_read_with_template_values(
+	          xml_document,
+	          NULL,
+	          65536,
+	          0x850,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_read_with_template_values(
+	          xml_document,
+	          fwevt_test_xml_document_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          0x850,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test data offset value out of bounds
+	 */
+	result = libfwevt_xml_document_read_with_template_values(
+	          xml_document,
+	          fwevt_test_xml_document_data1,
+	          65536,
+	          65536,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test data value too small
+	 */
+	result = libfwevt_xml_document_read_with_template_values(
+	          xml_document,
+	          fwevt_test_xml_document_data1,
+	          11,
+	          0x850,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwevt_xml_document_free(
+	          &xml_document,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "xml_document",
+	 xml_document );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( xml_document != NULL )
+	{
+		libfwevt_xml_document_free(
+		 &xml_document,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_document_get_template_values_array function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_document_get_template_values_array(
+     void )
+{
+	libcdata_array_t *first_template_values_array = NULL;
+	libcdata_array_t *template_values_array       = NULL;
+	libcerror_error_t *error                      = NULL;
+	libfwevt_xml_document_t *xml_document         = NULL;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libfwevt_xml_document_initialize(
+	          &xml_document,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "xml_document",
+	 xml_document );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_document_get_template_values_array(
+	          (libfwevt_internal_xml_document_t *) xml_document,
+	          0,
+	          3,
+	          &first_template_values_array,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "first_template_values_array",
+	 first_template_values_array );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the template values array is reused
+	 */
+	result = libfwevt_xml_document_get_template_values_array(
+	          (libfwevt_internal_xml_document_t *) xml_document,
+	          0,
+	          1,
+	          &template_values_array,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "template_values_array",
+	 (int) ( template_values_array == first_template_values_array ),
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if a template instance with a different recursion depth uses another template values array
+	 */
+	result = libfwevt_xml_document_get_template_values_array(
+	          (libfwevt_internal_xml_document_t *) xml_document,
+	          1,
+	          2,
+	          &template_values_array,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "template_values_array",
+	 (int) ( template_values_array == first_template_values_array ),
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_document_get_template_values_array(
+	          NULL,
+	          0,
+	          1,
+	          &template_values_array,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_get_template_values_array(
+	          (libfwevt_internal_xml_document_t *) xml_document,
+	          -1,
+	          1,
+	          &template_values_array,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_get_template_values_array(
+	          (libfwevt_internal_xml_document_t *) xml_document,
+	          LIBFWEVT_XML_DOCUMENT_TEMPLATE_INSTANCE_RECURSION_DEPTH + 1,
+	          1,
+	          &template_values_array,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_get_template_values_array(
+	          (libfwevt_internal_xml_document_t *) xml_document,
+	          0,
+	          -1,
+	          &template_values_array,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_get_template_values_array(
+	          (libfwevt_internal_xml_document_t *) xml_document,
+	          0,
+	          1,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwevt_xml_document_free(
+	          &xml_document,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "xml_document",
+	 xml_document );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( xml_document != NULL )
+	{
+		libfwevt_xml_document_free(
+		 &xml_document,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
+
+/* Tests the libfwevt_xml_document_get_utf8_xml_string_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_document_get_utf8_xml_string_size(
+     libfwevt_xml_document_t *xml_document )
+{
+	libcerror_error_t *error    = NULL;
+	size_t utf8_xml_string_size = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_document_get_utf8_xml_string_size(
+	          xml_document,
+	          &utf8_xml_string_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_document_get_utf8_xml_string_size(
+	          NULL,
+	          &utf8_xml_string_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_get_utf8_xml_string_size(
+	          xml_document,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_document_get_utf8_xml_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_document_get_utf8_xml_string(
+     libfwevt_xml_document_t *xml_document )
+{
+	uint8_t utf8_xml_string[ 1024 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_document_get_utf8_xml_string(
+	          xml_document,
+	          utf8_xml_string,
+	          1024,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_document_get_utf8_xml_string(
+	          NULL,
+	          utf8_xml_string,
+	          1024,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_get_utf8_xml_string(
+	          xml_document,
+	          NULL,
+	          1024,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_get_utf8_xml_string(
+	          xml_document,
+	          utf8_xml_string,
+	          0,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_get_utf8_xml_string(
+	          xml_document,
+	          utf8_xml_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_document_render_utf8 function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_document_render_utf8(
+     libfwevt_xml_document_t *xml_document )
+{
+	uint8_t expected_utf8_xml_string[ 1024 ];
+
+	libcerror_error_t *error          = NULL;
+	uint8_t *utf8_xml_string          = NULL;
+	size_t allocated_utf8_string_size = 0;
+	size_t utf8_xml_string_size       = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfwevt_xml_document_get_utf8_xml_string(
+	          xml_document,
+	          expected_utf8_xml_string,
+	          1024,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_document_render_utf8(
+	          xml_document,
+	          &utf8_xml_string,
+	          &allocated_utf8_string_size,
+	          &utf8_xml_string_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "utf8_xml_string",
+	 utf8_xml_string );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_xml_string_size",
+	 utf8_xml_string_size,
+	 (size_t) 629 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_xml_string,
+	          expected_utf8_xml_string,
+	          629 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test rendering into a previously allocated UTF-8 string
+	 */
+	result = libfwevt_xml_document_render_utf8(
+	          xml_document,
+	          &utf8_xml_string,
+	          &allocated_utf8_string_size,
+	          &utf8_xml_string_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_xml_string_size",
+	 utf8_xml_string_size,
+	 (size_t) 629 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_xml_string,
+	          expected_utf8_xml_string,
+	          629 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_document_render_utf8(
+	          NULL,
+	          &utf8_xml_string,
+	          &allocated_utf8_string_size,
+	          &utf8_xml_string_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_render_utf8(
+	          xml_document,
+	          NULL,
+	          &allocated_utf8_string_size,
+	          &utf8_xml_string_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_render_utf8(
+	          xml_document,
+	          &utf8_xml_string,
+	          NULL,
+	          &utf8_xml_string_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_render_utf8(
+	          xml_document,
+	          &utf8_xml_string,
+	          &allocated_utf8_string_size,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 utf8_xml_string );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( utf8_xml_string != NULL )
+	{
+		memory_free(
+		 utf8_xml_string );
+	}
+	return( 0 );
+}
+
+/* The write callback test data
+ */
+typedef struct fwevt_test_xml_document_write_data fwevt_test_xml_document_write_data_t;
+
+struct fwevt_test_xml_document_write_data
+{
+	/* The data
+	 */
+	uint8_t data[ 1024 ];
+
+	/* The data size
+	 */
+	size_t data_size;
+
+	/* The number of write callbacks
+	 */
+	int number_of_writes;
+};
+
+/* Appends the written data to the write callback test data
+ * Returns 1 if successful or -1 on error
+ */
+int fwevt_test_xml_document_write(
+     const uint8_t *data,
+     size_t data_size,
+     void *callback_data,
+     libcerror_error_t **error FWEVT_TEST_ATTRIBUTE_UNUSED )
+{
+	fwevt_test_xml_document_write_data_t *write_data = (fwevt_test_xml_document_write_data_t *) callback_data;
+
+	FWEVT_TEST_UNREFERENCED_PARAMETER( error )
+
+	if( ( write_data == NULL )
+	 || ( data_size > ( 1024 - write_data->data_size ) ) )
+	{
+		return( -1 );
+	}
+	if( memory_copy(
+	     &( write_data->data[ write_data->data_size ] ),
+	     data,
+	     data_size ) == NULL )
+	{
+		return( -1 );
+	}
+	write_data->data_size += data_size;
+
+	write_data->number_of_writes++;
+
+	return( 1 );
+}
+
+/* Tests the libfwevt_xml_document_write_utf8_xml_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_document_write_utf8_xml_string(
+     libfwevt_xml_document_t *xml_document )
+{
+	uint8_t expected_utf8_xml_string[ 1024 ];
+
+	fwevt_test_xml_document_write_data_t write_data;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfwevt_xml_document_get_utf8_xml_string(
+	          xml_document,
+	          expected_utf8_xml_string,
+	          1024,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	write_data.data_size        = 0;
+	write_data.number_of_writes = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_document_write_utf8_xml_string(
+	          xml_document,
+	          &fwevt_test_xml_document_write,
+	          &write_data,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The end-of-string character is not written
+	 */
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "write_data.data_size",
+	 write_data.data_size,
+	 (size_t) 628 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "write_data.number_of_writes",
+	 write_data.number_of_writes,
+	 1 );
+
+	result = memory_compare(
+	          write_data.data,
+	          expected_utf8_xml_string,
+	          628 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_document_write_utf8_xml_string(
+	          NULL,
+	          &fwevt_test_xml_document_write,
+	          &write_data,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_write_utf8_xml_string(
+	          xml_document,
+	          NULL,
+	          &write_data,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test write callback failure
+	 */
+	result = libfwevt_xml_document_write_utf8_xml_string(
+	          xml_document,
+	          &fwevt_test_xml_document_write,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_document_write_utf8_xml_string_to_file_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_document_write_utf8_xml_string_to_file_stream(
+     libfwevt_xml_document_t *xml_document )
+{
+	uint8_t expected_utf8_xml_string[ 1024 ];
+	uint8_t utf8_xml_string[ 1024 ];
+
+	libcerror_error_t *error = NULL;
+	FILE *file_stream        = NULL;
+	size_t read_count        = 0;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	result = libfwevt_xml_document_get_utf8_xml_string(
+	          xml_document,
+	          expected_utf8_xml_string,
+	          1024,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	file_stream = tmpfile();
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "file_stream",
+	 file_stream );
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_document_write_utf8_xml_string_to_file_stream(
+	          xml_document,
+	          file_stream,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = file_stream_seek_offset(
+	          file_stream,
+	          0,
+	          SEEK_SET );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	read_count = file_stream_read(
+	              file_stream,
+	              utf8_xml_string,
+	              1024 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "read_count",
+	 read_count,
+	 (size_t) 628 );
+
+	result = memory_compare(
+	          utf8_xml_string,
+	          expected_utf8_xml_string,
+	          628 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_document_write_utf8_xml_string_to_file_stream(
+	          NULL,
+	          file_stream,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_write_utf8_xml_string_to_file_stream(
+	          xml_document,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = file_stream_close(
+	          file_stream );
+
+	file_stream = NULL;
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_stream != NULL )
+	{
+		file_stream_close(
+		 file_stream );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_document_get_utf8_json_string_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_document_get_utf8_json_string_size(
+     libfwevt_xml_document_t *xml_document )
+{
+	libcerror_error_t *error     = NULL;
+	size_t utf8_json_string_size = 0;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_document_get_utf8_json_string_size(
+	          xml_document,
+	          &utf8_json_string_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_json_string_size",
+	 utf8_json_string_size,
+	 (size_t) 562 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_document_get_utf8_json_string_size(
+	          NULL,
+	          &utf8_json_string_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_get_utf8_json_string_size(
+	          xml_document,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_document_get_utf8_json_string function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_document_get_utf8_json_string(
+     libfwevt_xml_document_t *xml_document )
+{
+	uint8_t utf8_json_string[ 1024 ];
+
+	char *expected_json_string = "{\"Event\":{\"#attributes\":{\"xmlns\":\"http://schemas.microsoft.com/win/2004/08/events/event\"},"
+	                             "\"System\":{\"Provider\":{\"#attributes\":{\"Name\":\"edgeupdate\"}},"
+	                             "\"EventID\":{\"#attributes\":{\"Qualifiers\":0},\"#text\":0},"
+	                             "\"Version\":0,\"Level\":4,\"Task\":0,\"Opcode\":0,"
+	                             "\"Keywords\":\"0x0080000000000000\","
+	                             "\"TimeCreated\":{\"#attributes\":{\"SystemTime\":\"2021-10-22T08:00:29.364230900Z\"}},"
+	                             "\"EventRecordID\":2,\"Correlation\":null,"
+	                             "\"Execution\":{\"#attributes\":{\"ProcessID\":2444,\"ThreadID\":0}},"
+	                             "\"Channel\":\"Application\",\"Computer\":\"WIN-GVM7G420DEL\","
+	                             "\"Security\":null},\"EventData\":{\"Data\":\"Service stopped\"}}}";
+	libcerror_error_t *error   = NULL;
+	int result                 = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_document_get_utf8_json_string(
+	          xml_document,
+	          utf8_json_string,
+	          1024,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_json_string,
+	          expected_json_string,
+	          562 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test if the JSON string is rendered into an UTF-8 string of the exact size
+	 */
+	memory_set(
+	 utf8_json_string,
+	 0xff,
+	 1024 );
+
+	result = libfwevt_xml_document_get_utf8_json_string(
+	          xml_document,
+	          utf8_json_string,
+	          562,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_json_string,
+	          expected_json_string,
+	          562 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWEVT_TEST_ASSERT_EQUAL_UINT8(
+	 "utf8_json_string[ 562 ]",
+	 utf8_json_string[ 562 ],
+	 0xff );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_document_get_utf8_json_string(
+	          NULL,
+	          utf8_json_string,
+	          1024,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_get_utf8_json_string(
+	          xml_document,
+	          NULL,
+	          1024,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_get_utf8_json_string(
+	          xml_document,
+	          utf8_json_string,
+	          561,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_get_utf8_json_string(
+	          xml_document,
+	          utf8_json_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_document_render_utf8_json function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_document_render_utf8_json(
+     libfwevt_xml_document_t *xml_document )
+{
+	uint8_t expected_utf8_json_string[ 1024 ];
+
+	libcerror_error_t *error          = NULL;
+	uint8_t *utf8_json_string         = NULL;
+	size_t allocated_utf8_string_size = 0;
+	size_t utf8_json_string_size      = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfwevt_xml_document_get_utf8_json_string(
+	          xml_document,
+	          expected_utf8_json_string,
+	          1024,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_document_render_utf8_json(
+	          xml_document,
+	          &utf8_json_string,
+	          &allocated_utf8_string_size,
+	          &utf8_json_string_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "utf8_json_string",
+	 utf8_json_string );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_json_string_size",
+	 utf8_json_string_size,
+	 (size_t) 562 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_json_string,
+	          expected_utf8_json_string,
+	          562 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test rendering into a previously allocated UTF-8 string
+	 */
+	result = libfwevt_xml_document_render_utf8_json(
+	          xml_document,
+	          &utf8_json_string,
+	          &allocated_utf8_string_size,
+	          &utf8_json_string_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_json_string_size",
+	 utf8_json_string_size,
+	 (size_t) 562 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_json_string,
+	          expected_utf8_json_string,
+	          562 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_document_render_utf8_json(
+	          NULL,
+	          &utf8_json_string,
+	          &allocated_utf8_string_size,
+	          &utf8_json_string_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_render_utf8_json(
+	          xml_document,
+	          NULL,
+	          &allocated_utf8_string_size,
+	          &utf8_json_string_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_render_utf8_json(
+	          xml_document,
+	          &utf8_json_string,
+	          NULL,
+	          &utf8_json_string_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_render_utf8_json(
+	          xml_document,
+	          &utf8_json_string,
+	          &allocated_utf8_string_size,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	memory_free(
+	 utf8_json_string );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( utf8_json_string != NULL )
+	{
+		memory_free(
+		 utf8_json_string );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_document_get_utf8_xml_string_size_with_template_program function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_document_get_utf8_xml_string_size_with_template_program(
+     libfwevt_xml_document_t *xml_document )
+{
+	libcerror_error_t *error                     = NULL;
+	libfwevt_xml_template_cache_t *template_cache = NULL;
+	size_t expected_utf8_xml_string_size         = 0;
+	size_t utf8_xml_string_size                  = 0;
+	int result                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libfwevt_xml_document_get_utf8_xml_string_size(
+	          xml_document,
+	          &expected_utf8_xml_string_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_document_get_utf8_xml_string_size_with_template_program(
+	          xml_document,
+	          fwevt_test_xml_document_data1,
+	          65536,
+	          0x850,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+	          &utf8_xml_string_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_xml_string_size",
+	 utf8_xml_string_size,
+	 expected_utf8_xml_string_size );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with a template cache, where the second call reuses the cached template program
+	 */
+	result = libfwevt_xml_template_cache_initialize(
+	          &template_cache,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_document_set_template_cache(
+	          xml_document,
+	          template_cache,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_document_get_utf8_xml_string_size_with_template_program(
+	          xml_document,
+	          fwevt_test_xml_document_data1,
+	          65536,
+	          0x850,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+	          &utf8_xml_string_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	utf8_xml_string_size = 0;
+
+	result = libfwevt_xml_document_get_utf8_xml_string_size_with_template_program(
+	          xml_document,
+	          fwevt_test_xml_document_data1,
+	          65536,
+	          0x850,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+	          &utf8_xml_string_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_xml_string_size",
+	 utf8_xml_string_size,
+	 expected_utf8_xml_string_size );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_document_set_template_cache(
+	          xml_document,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_template_cache_free(
+	          &template_cache,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with data that does not start with a template instance
+	 */
+	result = libfwevt_xml_document_get_utf8_xml_string_size_with_template_program(
+	          xml_document,
+	          fwevt_test_xml_document_data1,
+	          65536,
+	          0,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+	          &utf8_xml_string_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_document_get_utf8_xml_string_size_with_template_program(
+	          NULL,
+	          fwevt_test_xml_document_data1,
+	          65536,
+	          0x850,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+	          &utf8_xml_string_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_get_utf8_xml_string_size_with_template_program(
+	          xml_document,
+	          NULL,
+	          65536,
+	          0x850,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+	          &utf8_xml_string_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_get_utf8_xml_string_size_with_template_program(
+	          xml_document,
+	          fwevt_test_xml_document_data1,
+	          65536,
+	          65536,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+	          &utf8_xml_string_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_get_utf8_xml_string_size_with_template_program(
+	          xml_document,
+	          fwevt_test_xml_document_data1,
+	          65536,
+	          0x850,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          0xff,
+	          &utf8_xml_string_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_document_get_utf8_xml_string_size_with_template_program(
+	          xml_document,
+	          fwevt_test_xml_document_data1,
+	          65536,
+	          0x850,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( template_cache != NULL )
+	{
+		libfwevt_xml_document_set_template_cache(
+		 xml_document,
+		 NULL,
+		 NULL );
+		libfwevt_xml_template_cache_free(
+		 &template_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_document_get_utf8_xml_string_with_template_program function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_document_get_utf8_xml_string_with_template_program(
+     libfwevt_xml_document_t *xml_document )
+{
+	uint8_t expected_utf8_xml_string[ 1024 ];
+	uint8_t utf8_xml_string[ 1024 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 expected_utf8_xml_string,
+	 0,
+	 1024 );
+
+	memory_set(
+	 utf8_xml_string,
+	 0,
+	 1024 );
+
+	result = libfwevt_xml_document_get_utf8_xml_string(
+	          xml_document,
+	          expected_utf8_xml_string,
+	          1024,
+	          &error );
+
 	FWEVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
@@ -4637,10 +8305,17 @@ int fwevt_test_xml_document_read_with_template_values(
 	 "error",
 	 error );
 
-	/* Clean up
+	/* Test regular cases
 	 */
-	result = libfwevt_xml_document_free(
-	          &xml_document,
+	result = libfwevt_xml_document_get_utf8_xml_string_with_template_program(
+	          xml_document,
+	          fwevt_test_xml_document_data1,
+	          65536,
+	          0x850,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+	          utf8_xml_string,
+	          1024,
 	          &error );
 
 	FWEVT_TEST_ASSERT_EQUAL_INT(
@@ -4648,43 +8323,31 @@ int fwevt_test_xml_document_read_with_template_values(
 	 result,
 	 1 );
 
-	FWEVT_TEST_ASSERT_IS_NULL(
-	 "xml_document",
-	 xml_document );
-
 	FWEVT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Initialize test
-	 */
-	result = libfwevt_xml_document_initialize(
-	          &xml_document,
-	          &error );
+	result = memory_compare(
+	          utf8_xml_string,
+	          expected_utf8_xml_string,
+	          630 );
 
 	FWEVT_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	FWEVT_TEST_ASSERT_IS_NOT_NULL(
-	 "xml_document",
-	 xml_document );
-
-	FWEVT_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
+	 0 );
 
 	/* Test error cases
 	 */
-	result = libfwevt_xml_document_read_with_template_values(
+	result = libfwevt_xml_document_get_utf8_xml_string_with_template_program(
 	          NULL,
 	          fwevt_test_xml_document_data1,
 	          65536,
 	          0x850,
 	          LIBUNA_CODEPAGE_WINDOWS_1252,
 	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
-	          NULL,
+	          utf8_xml_string,
+	          1024,
 	          &error );
 
 	FWEVT_TEST_ASSERT_EQUAL_INT(
@@ -4699,14 +8362,15 @@ int fwevt_test_xml_document_read_with_template_values(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwevt_xml_document_read_with_template_values(
+	result = libfwevt_xml_document_get_utf8_xml_string_with_template_program(
 	          xml_document,
-	          NULL,
+	          fwevt_test_xml_document_data1,
 	          65536,
 	          0x850,
 	          LIBUNA_CODEPAGE_WINDOWS_1252,
 	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
 	          NULL,
+	          1024,
 	          &error );
 
 	FWEVT_TEST_ASSERT_EQUAL_INT(
@@ -4721,14 +8385,15 @@ int fwevt_test_xml_document_read_with_template_values(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwevt_xml_document_read_with_template_values(
+	result = libfwevt_xml_document_get_utf8_xml_string_with_template_program(
 	          xml_document,
 	          fwevt_test_xml_document_data1,
-	          (size_t) SSIZE_MAX + 1,
+	          65536,
 	          0x850,
 	          LIBUNA_CODEPAGE_WINDOWS_1252,
 	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
-	          NULL,
+	          utf8_xml_string,
+	          0,
 	          &error );
 
 	FWEVT_TEST_ASSERT_EQUAL_INT(
@@ -4743,16 +8408,15 @@ int fwevt_test_xml_document_read_with_template_values(
 	libcerror_error_free(
 	 &error );
 
-	/* Test data offset value out of bounds
-	 */
-	result = libfwevt_xml_document_read_with_template_values(
+	result = libfwevt_xml_document_get_utf8_xml_string_with_template_program(
 	          xml_document,
 	          fwevt_test_xml_document_data1,
 	          65536,
-	          65536,
+	          0x850,
 	          LIBUNA_CODEPAGE_WINDOWS_1252,
 	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
-	          NULL,
+	          utf8_xml_string,
+	          (size_t) SSIZE_MAX + 1,
 	          &error );
 
 	FWEVT_TEST_ASSERT_EQUAL_INT(
@@ -4767,16 +8431,17 @@ int fwevt_test_xml_document_read_with_template_values(
 	libcerror_error_free(
 	 &error );
 
-	/* Test data value too small
+	/* Test with an UTF-8 string that is too small
 	 */
-	result = libfwevt_xml_document_read_with_template_values(
+	result = libfwevt_xml_document_get_utf8_xml_string_with_template_program(
 	          xml_document,
 	          fwevt_test_xml_document_data1,
-	          11,
+	          65536,
 	          0x850,
 	          LIBUNA_CODEPAGE_WINDOWS_1252,
 	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
-	          NULL,
+	          utf8_xml_string,
+	          16,
 	          &error );
 
 	FWEVT_TEST_ASSERT_EQUAL_INT(
@@ -4791,25 +8456,6 @@ int fwevt_test_xml_document_read_with_template_values(
 	libcerror_error_free(
 	 &error );
 
-	/* Clean up
-	 */
-	result = libfwevt_xml_document_free(
-	          &xml_document,
-	          &error );
-
-	FWEVT_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	FWEVT_TEST_ASSERT_IS_NULL(
-	 "xml_document",
-	 xml_document );
-
-	FWEVT_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
 	return( 1 );
 
 on_error:
@@ -4818,107 +8464,65 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( xml_document != NULL )
-	{
-		libfwevt_xml_document_free(
-		 &xml_document,
-		 NULL );
-	}
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
-
-/* Tests the libfwevt_xml_document_get_utf8_xml_string_size function
- * Returns 1 if successful or 0 if not
+/* Counts an extracted field
+ * Returns 1 if successful or -1 on error
  */
-int fwevt_test_xml_document_get_utf8_xml_string_size(
-     libfwevt_xml_document_t *xml_document )
+int fwevt_test_xml_document_extract_field(
+     const uint8_t *element_name_utf16_stream,
+     size_t element_name_utf16_stream_size,
+     const uint8_t *attribute_name_utf16_stream FWEVT_TEST_ATTRIBUTE_UNUSED,
+     size_t attribute_name_utf16_stream_size FWEVT_TEST_ATTRIBUTE_UNUSED,
+     uint16_t template_value_index FWEVT_TEST_ATTRIBUTE_UNUSED,
+     uint8_t value_type FWEVT_TEST_ATTRIBUTE_UNUSED,
+     const uint8_t *value_data FWEVT_TEST_ATTRIBUTE_UNUSED,
+     size_t value_data_size FWEVT_TEST_ATTRIBUTE_UNUSED,
+     void *callback_data,
+     libcerror_error_t **error FWEVT_TEST_ATTRIBUTE_UNUSED )
 {
-	libcerror_error_t *error    = NULL;
-	size_t utf8_xml_string_size = 0;
-	int result                  = 0;
-
-	/* Test regular cases
-	 */
-	result = libfwevt_xml_document_get_utf8_xml_string_size(
-	          xml_document,
-	          &utf8_xml_string_size,
-	          &error );
-
-	FWEVT_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 1 );
-
-	FWEVT_TEST_ASSERT_IS_NULL(
-	 "error",
-	 error );
-
-	/* Test error cases
-	 */
-	result = libfwevt_xml_document_get_utf8_xml_string_size(
-	          NULL,
-	          &utf8_xml_string_size,
-	          &error );
-
-	FWEVT_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	FWEVT_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	result = libfwevt_xml_document_get_utf8_xml_string_size(
-	          xml_document,
-	          NULL,
-	          &error );
-
-	FWEVT_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	FWEVT_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	return( 1 );
-
-on_error:
-	if( error != NULL )
+	int *number_of_fields = (int *) callback_data;
+
+	FWEVT_TEST_UNREFERENCED_PARAMETER( attribute_name_utf16_stream );
+	FWEVT_TEST_UNREFERENCED_PARAMETER( attribute_name_utf16_stream_size );
+	FWEVT_TEST_UNREFERENCED_PARAMETER( template_value_index );
+	FWEVT_TEST_UNREFERENCED_PARAMETER( value_type );
+	FWEVT_TEST_UNREFERENCED_PARAMETER( value_data );
+	FWEVT_TEST_UNREFERENCED_PARAMETER( value_data_size );
+	FWEVT_TEST_UNREFERENCED_PARAMETER( error );
+
+	if( ( element_name_utf16_stream == NULL )
+	 || ( element_name_utf16_stream_size < 2 ) )
 	{
-		libcerror_error_free(
-		 &error );
+		return( -1 );
 	}
-	return( 0 );
+	*number_of_fields += 1;
+
+	return( 1 );
 }
 
-/* Tests the libfwevt_xml_document_get_utf8_xml_string function
+/* Tests the libfwevt_xml_document_extract_fields_with_template_program function
  * Returns 1 if successful or 0 if not
  */
-int fwevt_test_xml_document_get_utf8_xml_string(
+int fwevt_test_xml_document_extract_fields_with_template_program(
      libfwevt_xml_document_t *xml_document )
 {
-	uint8_t utf8_xml_string[ 1024 ];
-
 	libcerror_error_t *error = NULL;
+	int number_of_fields     = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libfwevt_xml_document_get_utf8_xml_string(
+	result = libfwevt_xml_document_extract_fields_with_template_program(
 	          xml_document,
-	          utf8_xml_string,
-	          1024,
+	          fwevt_test_xml_document_data1,
+	          65536,
+	          0x850,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+	          &fwevt_test_xml_document_extract_field,
+	          &number_of_fields,
 	          &error );
 
 	FWEVT_TEST_ASSERT_EQUAL_INT(
@@ -4926,16 +8530,26 @@ int fwevt_test_xml_document_get_utf8_xml_string(
 	 result,
 	 1 );
 
+	FWEVT_TEST_ASSERT_NOT_EQUAL_INT(
+	 "number_of_fields",
+	 number_of_fields,
+	 0 );
+
 	FWEVT_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
 	/* Test error cases
 	 */
-	result = libfwevt_xml_document_get_utf8_xml_string(
+	result = libfwevt_xml_document_extract_fields_with_template_program(
 	          NULL,
-	          utf8_xml_string,
-	          1024,
+	          fwevt_test_xml_document_data1,
+	          65536,
+	          0x850,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
+	          &fwevt_test_xml_document_extract_field,
+	          &number_of_fields,
 	          &error );
 
 	FWEVT_TEST_ASSERT_EQUAL_INT(
@@ -4950,46 +8564,15 @@ int fwevt_test_xml_document_get_utf8_xml_string(
 	libcerror_error_free(
 	 &error );
 
-	result = libfwevt_xml_document_get_utf8_xml_string(
+	result = libfwevt_xml_document_extract_fields_with_template_program(
 	          xml_document,
+	          fwevt_test_xml_document_data1,
+	          65536,
+	          0x850,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS,
 	          NULL,
-	          1024,
-	          &error );
-
-	FWEVT_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	FWEVT_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	result = libfwevt_xml_document_get_utf8_xml_string(
-	          xml_document,
-	          utf8_xml_string,
-	          0,
-	          &error );
-
-	FWEVT_TEST_ASSERT_EQUAL_INT(
-	 "result",
-	 result,
-	 -1 );
-
-	FWEVT_TEST_ASSERT_IS_NOT_NULL(
-	 "error",
-	 error );
-
-	libcerror_error_free(
-	 &error );
-
-	result = libfwevt_xml_document_get_utf8_xml_string(
-	          xml_document,
-	          utf8_xml_string,
-	          (size_t) SSIZE_MAX + 1,
+	          &number_of_fields,
 	          &error );
 
 	FWEVT_TEST_ASSERT_EQUAL_INT(
@@ -5240,6 +8823,22 @@ int main(
 	 "libfwevt_xml_document_read",
 	 fwevt_test_xml_document_read );
 
+	FWEVT_TEST_RUN(
+	 "libfwevt_xml_document_reset",
+	 fwevt_test_xml_document_reset );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_xml_document_set_template_cache",
+	 fwevt_test_xml_document_set_template_cache );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_xml_document_set_path_filter",
+	 fwevt_test_xml_document_set_path_filter );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_xml_document_parse_with_callbacks",
+	 fwevt_test_xml_document_parse_with_callbacks );
+
 #if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
 
 	FWEVT_TEST_RUN(
@@ -5272,6 +8871,10 @@ int main(
 
 	/* TODO: add tests for libfwevt_xml_document_read_template_instance */
 
+	FWEVT_TEST_RUN(
+	 "libfwevt_xml_document_get_template_values_array",
+	 fwevt_test_xml_document_get_template_values_array );
+
 	/* TODO: add tests for libfwevt_xml_document_read_template_instance_values */
 
 	/* TODO: add tests for libfwevt_xml_document_read_value */
@@ -5338,6 +8941,51 @@ int main(
 	 fwevt_test_xml_document_get_utf8_xml_string,
 	 xml_document );
 
+	FWEVT_TEST_RUN_WITH_ARGS(
+	 "libfwevt_xml_document_render_utf8",
+	 fwevt_test_xml_document_render_utf8,
+	 xml_document );
+
+	FWEVT_TEST_RUN_WITH_ARGS(
+	 "libfwevt_xml_document_write_utf8_xml_string",
+	 fwevt_test_xml_document_write_utf8_xml_string,
+	 xml_document );
+
+	FWEVT_TEST_RUN_WITH_ARGS(
+	 "libfwevt_xml_document_write_utf8_xml_string_to_file_stream",
+	 fwevt_test_xml_document_write_utf8_xml_string_to_file_stream,
+	 xml_document );
+
+	FWEVT_TEST_RUN_WITH_ARGS(
+	 "libfwevt_xml_document_get_utf8_json_string_size",
+	 fwevt_test_xml_document_get_utf8_json_string_size,
+	 xml_document );
+
+	FWEVT_TEST_RUN_WITH_ARGS(
+	 "libfwevt_xml_document_get_utf8_json_string",
+	 fwevt_test_xml_document_get_utf8_json_string,
+	 xml_document );
+
+	FWEVT_TEST_RUN_WITH_ARGS(
+	 "libfwevt_xml_document_render_utf8_json",
+	 fwevt_test_xml_document_render_utf8_json,
+	 xml_document );
+
+	FWEVT_TEST_RUN_WITH_ARGS(
+	 "libfwevt_xml_document_get_utf8_xml_string_size_with_template_program",
+	 fwevt_test_xml_document_get_utf8_xml_string_size_with_template_program,
+	 xml_document );
+
+	FWEVT_TEST_RUN_WITH_ARGS(
+	 "libfwevt_xml_document_get_utf8_xml_string_with_template_program",
+	 fwevt_test_xml_document_get_utf8_xml_string_with_template_program,
+	 xml_document );
+
+	FWEVT_TEST_RUN_WITH_ARGS(
+	 "libfwevt_xml_document_extract_fields_with_template_program",
+	 fwevt_test_xml_document_extract_fields_with_template_program,
+	 xml_document );
+
 	FWEVT_TEST_RUN_WITH_ARGS(
 	 "libfwevt_xml_document_get_utf16_xml_string_size",
 	 fwevt_test_xml_document_get_utf16_xml_string_size,
@@ -0,0 +1,641 @@
+/*
+ * Library xml_name_table type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwevt_test_libcerror.h"
+#include "fwevt_test_libfwevt.h"
+#include "fwevt_test_macros.h"
+#include "fwevt_test_memory.h"
+#include "fwevt_test_unused.h"
+
+#include "../libfwevt/libfwevt_xml_name_table.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+
+/* Tests the libfwevt_xml_name_table_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_name_table_initialize(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libfwevt_xml_name_table_t *name_table = NULL;
+	int result                            = 0;
+
+#if defined( HAVE_FWEVT_TEST_MEMORY )
+	int number_of_malloc_fail_tests       = 1;
+	int test_number                       = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_name_table_initialize(
+	          &name_table,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "name_table",
+	 name_table );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_name_table_free(
+	          &name_table,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "name_table",
+	 name_table );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_name_table_initialize(
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	name_table = (libfwevt_xml_name_table_t *) 0x12345678UL;
+
+	result = libfwevt_xml_name_table_initialize(
+	          &name_table,
+	          &error );
+
+	name_table = NULL;
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FWEVT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwevt_xml_name_table_initialize with malloc failing
+		 */
+		fwevt_test_malloc_attempts_before_fail = test_number;
+
+		result = libfwevt_xml_name_table_initialize(
+		          &name_table,
+		          &error );
+
+		if( fwevt_test_malloc_attempts_before_fail != -1 )
+		{
+			fwevt_test_malloc_attempts_before_fail = -1;
+
+			if( name_table != NULL )
+			{
+				libfwevt_xml_name_table_free(
+				 &name_table,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWEVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWEVT_TEST_ASSERT_IS_NULL(
+			 "name_table",
+			 name_table );
+
+			FWEVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FWEVT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_table != NULL )
+	{
+		libfwevt_xml_name_table_free(
+		 &name_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_name_table_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_name_table_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_name_table_free(
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_name_table_intern_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_name_table_intern_name(
+     void )
+{
+	uint8_t name_data1[ 12 ] = {
+		'E', 0, 'v', 0, 'e', 0, 'n', 0, 't', 0, 0, 0 };
+
+	uint8_t name_data2[ 10 ] = {
+		'D', 0, 'a', 0, 't', 0, 'a', 0, 0, 0 };
+
+	const uint8_t *interned_name_data1    = NULL;
+	const uint8_t *interned_name_data2    = NULL;
+	const uint8_t *interned_name_data3    = NULL;
+	libcerror_error_t *error              = NULL;
+	libfwevt_xml_name_table_t *name_table = NULL;
+	int name_index                        = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfwevt_xml_name_table_initialize(
+	          &name_table,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "name_table",
+	 name_table );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_name_table_intern_name(
+	          name_table,
+	          0x0000024e,
+	          0x4a5f,
+	          name_data1,
+	          12,
+	          &interned_name_data1,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "interned_name_data1",
+	 interned_name_data1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "interned_name_data1 is name_data1",
+	 (int) ( interned_name_data1 == name_data1 ),
+	 0 );
+
+	result = libfwevt_xml_name_table_intern_name(
+	          name_table,
+	          0x0000024e,
+	          0x4a5f,
+	          name_data1,
+	          12,
+	          &interned_name_data2,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "interned_name_data2 is interned_name_data1",
+	 (int) ( interned_name_data2 == interned_name_data1 ),
+	 1 );
+
+	/* Test a different name with the same offset and hash
+	 */
+	result = libfwevt_xml_name_table_intern_name(
+	          name_table,
+	          0x0000024e,
+	          0x4a5f,
+	          name_data2,
+	          10,
+	          &interned_name_data3,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "interned_name_data3 is interned_name_data1",
+	 (int) ( interned_name_data3 == interned_name_data1 ),
+	 0 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "name_table->number_of_names",
+	 name_table->number_of_names,
+	 2 );
+
+	/* Test that the name table does not exceed the maximum number of names
+	 */
+	for( name_index = 0;
+	     name_index < LIBFWEVT_XML_NAME_TABLE_MAXIMUM_NUMBER_OF_NAMES;
+	     name_index++ )
+	{
+		result = libfwevt_xml_name_table_intern_name(
+		          name_table,
+		          (uint32_t) ( 0x00001000 + ( name_index * 32 ) ),
+		          0x1234,
+		          name_data2,
+		          10,
+		          &interned_name_data3,
+		          &error );
+
+		FWEVT_TEST_ASSERT_NOT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FWEVT_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libfwevt_xml_name_table_is_full(
+	          name_table,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Names that were interned before the name table was full can still be retrieved
+	 */
+	result = libfwevt_xml_name_table_intern_name(
+	          name_table,
+	          0x0000024e,
+	          0x4a5f,
+	          name_data1,
+	          12,
+	          &interned_name_data2,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "interned_name_data2 is interned_name_data1",
+	 (int) ( interned_name_data2 == interned_name_data1 ),
+	 1 );
+
+	result = libfwevt_xml_name_table_empty(
+	          name_table,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_name_table_is_full(
+	          name_table,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_name_table_intern_name(
+	          NULL,
+	          0x0000024e,
+	          0x4a5f,
+	          name_data1,
+	          12,
+	          &interned_name_data1,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_name_table_intern_name(
+	          name_table,
+	          0x0000024e,
+	          0x4a5f,
+	          NULL,
+	          12,
+	          &interned_name_data1,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_name_table_intern_name(
+	          name_table,
+	          0x0000024e,
+	          0x4a5f,
+	          name_data1,
+	          0,
+	          &interned_name_data1,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_name_table_intern_name(
+	          name_table,
+	          0x0000024e,
+	          0x4a5f,
+	          name_data1,
+	          12,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_name_table_empty(
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_name_table_is_full(
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwevt_xml_name_table_free(
+	          &name_table,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "name_table",
+	 name_table );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( name_table != NULL )
+	{
+		libfwevt_xml_name_table_free(
+		 &name_table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWEVT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWEVT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWEVT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWEVT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWEVT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWEVT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_xml_name_table_initialize",
+	 fwevt_test_xml_name_table_initialize );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_xml_name_table_free",
+	 fwevt_test_xml_name_table_free );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_xml_name_table_intern_name",
+	 fwevt_test_xml_name_table_intern_name );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
+}
+
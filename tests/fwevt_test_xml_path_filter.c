@@ -0,0 +1,969 @@
+/*
+ * Library xml_path_filter type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwevt_test_libcerror.h"
+#include "fwevt_test_libfwevt.h"
+#include "fwevt_test_macros.h"
+#include "fwevt_test_memory.h"
+#include "fwevt_test_unused.h"
+
+#include "../libfwevt/libfwevt_xml_path_filter.h"
+
+/* UTF-16 little-endian encoded element names including the end-of-string character
+ */
+uint8_t fwevt_test_xml_path_filter_system_name[ 14 ] = {
+	'S', 0, 'y', 0, 's', 0, 't', 0, 'e', 0, 'm', 0, 0, 0 };
+
+uint8_t fwevt_test_xml_path_filter_event_id_name[ 16 ] = {
+	'E', 0, 'v', 0, 'e', 0, 'n', 0, 't', 0, 'I', 0, 'D', 0, 0, 0 };
+
+/* Tests the libfwevt_xml_path_filter_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_path_filter_initialize(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libfwevt_xml_path_filter_t *path_filter = NULL;
+	int result                              = 0;
+
+#if defined( HAVE_FWEVT_TEST_MEMORY )
+	int number_of_malloc_fail_tests         = 1;
+	int test_number                         = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_path_filter_initialize(
+	          &path_filter,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "path_filter",
+	 path_filter );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_path_filter_free(
+	          &path_filter,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "path_filter",
+	 path_filter );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_path_filter_initialize(
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	path_filter = (libfwevt_xml_path_filter_t *) 0x12345678UL;
+
+	result = libfwevt_xml_path_filter_initialize(
+	          &path_filter,
+	          &error );
+
+	path_filter = NULL;
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FWEVT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwevt_xml_path_filter_initialize with malloc failing
+		 */
+		fwevt_test_malloc_attempts_before_fail = test_number;
+
+		result = libfwevt_xml_path_filter_initialize(
+		          &path_filter,
+		          &error );
+
+		if( fwevt_test_malloc_attempts_before_fail != -1 )
+		{
+			fwevt_test_malloc_attempts_before_fail = -1;
+
+			if( path_filter != NULL )
+			{
+				libfwevt_xml_path_filter_free(
+				 &path_filter,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWEVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWEVT_TEST_ASSERT_IS_NULL(
+			 "path_filter",
+			 path_filter );
+
+			FWEVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FWEVT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_filter != NULL )
+	{
+		libfwevt_xml_path_filter_free(
+		 &path_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_path_filter_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_path_filter_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_path_filter_free(
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_path_filter_append_utf8_path function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_path_filter_append_utf8_path(
+     void )
+{
+	const char *invalid_paths[ 8 ] = {
+		"/System",
+		"System/",
+		"System//EventID",
+		"System/TimeCreated/@",
+		"System/TimeCreated/@SystemTime/EventID",
+		"EventData/Data[@Name",
+		"EventData/Data[@Name='SubjectUserName]",
+		"EventData/Data[Name]" };
+
+	libcerror_error_t *error                = NULL;
+	libfwevt_xml_path_filter_t *path_filter = NULL;
+	int number_of_paths                     = 0;
+	int path_index                          = 0;
+	int result                              = 0;
+	int test_number                         = 0;
+
+	/* Initialize test
+	 */
+	result = libfwevt_xml_path_filter_initialize(
+	          &path_filter,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "path_filter",
+	 path_filter );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_path_filter_append_utf8_path(
+	          path_filter,
+	          (uint8_t *) "System/EventID",
+	          14,
+	          &path_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "path_index",
+	 path_index,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_path_filter_append_utf8_path(
+	          path_filter,
+	          (uint8_t *) "System/TimeCreated/@SystemTime",
+	          30,
+	          &path_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "path_index",
+	 path_index,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_path_filter_append_utf8_path(
+	          path_filter,
+	          (uint8_t *) "EventData/Data[@Name='SubjectUserName']",
+	          39,
+	          &path_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "path_index",
+	 path_index,
+	 2 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_path_filter_append_utf8_path(
+	          path_filter,
+	          (uint8_t *) "EventData/Data[@Name]/@Name",
+	          27,
+	          &path_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "path_index",
+	 path_index,
+	 3 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	for( test_number = 0;
+	     test_number < 8;
+	     test_number++ )
+	{
+		result = libfwevt_xml_path_filter_append_utf8_path(
+		          path_filter,
+		          (uint8_t *) invalid_paths[ test_number ],
+		          narrow_string_length(
+		           invalid_paths[ test_number ] ),
+		          &path_index,
+		          &error );
+
+		FWEVT_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		FWEVT_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+	}
+	result = libfwevt_xml_path_filter_get_number_of_paths(
+	          path_filter,
+	          &number_of_paths,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_paths",
+	 number_of_paths,
+	 4 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_path_filter_append_utf8_path(
+	          NULL,
+	          (uint8_t *) "System/EventID",
+	          14,
+	          &path_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_path_filter_append_utf8_path(
+	          path_filter,
+	          NULL,
+	          14,
+	          &path_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_path_filter_append_utf8_path(
+	          path_filter,
+	          (uint8_t *) "System/EventID",
+	          0,
+	          &path_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_path_filter_append_utf8_path(
+	          path_filter,
+	          (uint8_t *) "System/EventID",
+	          14,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwevt_xml_path_filter_free(
+	          &path_filter,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "path_filter",
+	 path_filter );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_filter != NULL )
+	{
+		libfwevt_xml_path_filter_free(
+		 &path_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_path_filter_get_number_of_paths function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_path_filter_get_number_of_paths(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libfwevt_xml_path_filter_t *path_filter = NULL;
+	int number_of_paths                     = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libfwevt_xml_path_filter_initialize(
+	          &path_filter,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "path_filter",
+	 path_filter );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_path_filter_get_number_of_paths(
+	          path_filter,
+	          &number_of_paths,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_paths",
+	 number_of_paths,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_path_filter_get_number_of_paths(
+	          NULL,
+	          &number_of_paths,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_path_filter_get_number_of_paths(
+	          path_filter,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwevt_xml_path_filter_free(
+	          &path_filter,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "path_filter",
+	 path_filter );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_filter != NULL )
+	{
+		libfwevt_xml_path_filter_free(
+		 &path_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+
+/* Tests the libfwevt_internal_xml_path_filter_match_element_name function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_internal_xml_path_filter_match_element_name(
+     void )
+{
+	libcerror_error_t *error                = NULL;
+	libfwevt_xml_path_filter_t *path_filter = NULL;
+	uint32_t path_mask                      = 0;
+	int path_index                          = 0;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libfwevt_xml_path_filter_initialize(
+	          &path_filter,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "path_filter",
+	 path_filter );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_path_filter_append_utf8_path(
+	          path_filter,
+	          (uint8_t *) "System/EventID",
+	          14,
+	          &path_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_path_filter_append_utf8_path(
+	          path_filter,
+	          (uint8_t *) "EventData/Data",
+	          14,
+	          &path_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwevt_internal_xml_path_filter_get_path_mask(
+	          (libfwevt_internal_xml_path_filter_t *) path_filter,
+	          &path_mask,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_UINT32(
+	 "path_mask",
+	 path_mask,
+	 (uint32_t) 0x00000003UL );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_internal_xml_path_filter_match_element_name(
+	          (libfwevt_internal_xml_path_filter_t *) path_filter,
+	          0x00000003UL,
+	          1,
+	          fwevt_test_xml_path_filter_system_name,
+	          14,
+	          &path_mask,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_UINT32(
+	 "path_mask",
+	 path_mask,
+	 (uint32_t) 0x00000001UL );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_internal_xml_path_filter_match_element_name(
+	          (libfwevt_internal_xml_path_filter_t *) path_filter,
+	          0x00000001UL,
+	          2,
+	          fwevt_test_xml_path_filter_event_id_name,
+	          16,
+	          &path_mask,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_UINT32(
+	 "path_mask",
+	 path_mask,
+	 (uint32_t) 0x00000001UL );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Elements deeper than a path do not match
+	 */
+	result = libfwevt_internal_xml_path_filter_match_element_name(
+	          (libfwevt_internal_xml_path_filter_t *) path_filter,
+	          0x00000001UL,
+	          3,
+	          fwevt_test_xml_path_filter_event_id_name,
+	          16,
+	          &path_mask,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_UINT32(
+	 "path_mask",
+	 path_mask,
+	 (uint32_t) 0x00000000UL );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_internal_xml_path_filter_match_element_name(
+	          NULL,
+	          0x00000003UL,
+	          1,
+	          fwevt_test_xml_path_filter_system_name,
+	          14,
+	          &path_mask,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_internal_xml_path_filter_match_element_name(
+	          (libfwevt_internal_xml_path_filter_t *) path_filter,
+	          0x00000003UL,
+	          -1,
+	          fwevt_test_xml_path_filter_system_name,
+	          14,
+	          &path_mask,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_internal_xml_path_filter_match_element_name(
+	          (libfwevt_internal_xml_path_filter_t *) path_filter,
+	          0x00000003UL,
+	          1,
+	          NULL,
+	          14,
+	          &path_mask,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_internal_xml_path_filter_match_element_name(
+	          (libfwevt_internal_xml_path_filter_t *) path_filter,
+	          0x00000003UL,
+	          1,
+	          fwevt_test_xml_path_filter_system_name,
+	          14,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwevt_xml_path_filter_free(
+	          &path_filter,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "path_filter",
+	 path_filter );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( path_filter != NULL )
+	{
+		libfwevt_xml_path_filter_free(
+		 &path_filter,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWEVT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWEVT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWEVT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWEVT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWEVT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWEVT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_xml_path_filter_initialize",
+	 fwevt_test_xml_path_filter_initialize );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_xml_path_filter_free",
+	 fwevt_test_xml_path_filter_free );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_xml_path_filter_append_utf8_path",
+	 fwevt_test_xml_path_filter_append_utf8_path );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_xml_path_filter_get_number_of_paths",
+	 fwevt_test_xml_path_filter_get_number_of_paths );
+
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_internal_xml_path_filter_match_element_name",
+	 fwevt_test_internal_xml_path_filter_match_element_name );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
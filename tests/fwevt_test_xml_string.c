@@ -0,0 +1,909 @@
+/*
+ * Library XML string functions test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <narrow_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwevt_test_libcerror.h"
+#include "fwevt_test_libfwevt.h"
+#include "fwevt_test_libuna.h"
+#include "fwevt_test_macros.h"
+#include "fwevt_test_unused.h"
+
+#include "../libfwevt/libfwevt_xml_string.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+
+/* "a<b&c" U+1f600 U+00e9 U+20ac "d" end-of-string
+ */
+uint8_t fwevt_test_xml_string_utf16_stream1[ 24 ] = {
+	'a', 0, '<', 0, 'b', 0, '&', 0, 'c', 0, 0x3d, 0xd8, 0x00, 0xde, 0xe9, 0x00,
+	0xac, 0x20, 'd', 0, 0, 0, 0, 0 };
+
+uint8_t fwevt_test_xml_string_utf8_string1[ 22 ] = {
+	'a', '&', 'l', 't', ';', 'b', '&', 'a', 'm', 'p', ';', 'c', 0xf0, 0x9f, 0x98, 0x80,
+	0xc3, 0xa9, 0xe2, 0x82, 0xac, 'd' };
+
+/* Tests a function to copy ASCII characters from an UTF-16 little-endian stream
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_string_copy_ascii_function(
+     libfwevt_xml_string_copy_ascii_function_t copy_ascii_function )
+{
+	uint16_t stop_characters[ 7 ] = {
+		0x0000, '&', '<', '>', 0x0080, 0x0141, 0x8000 };
+
+	size_t number_of_characters_values[ 9 ] = {
+		0, 1, 15, 16, 17, 31, 32, 33, 70 };
+
+	uint8_t utf16_stream[ 140 ];
+	uint8_t utf8_string[ 70 ];
+
+	size_t character_index            = 0;
+	size_t expected_result            = 0;
+	size_t number_of_characters       = 0;
+	size_t result                     = 0;
+	int number_of_characters_iterator = 0;
+	int stop_character_iterator       = 0;
+	int stop_index                    = 0;
+
+	for( character_index = 0;
+	     character_index < 70;
+	     character_index++ )
+	{
+		utf16_stream[ character_index * 2 ]         = (uint8_t) ( 'A' + ( character_index % 26 ) );
+		utf16_stream[ ( character_index * 2 ) + 1 ] = 0;
+	}
+	/* Test ASCII runs with odd tails
+	 */
+	for( number_of_characters_iterator = 0;
+	     number_of_characters_iterator < 9;
+	     number_of_characters_iterator++ )
+	{
+		number_of_characters = number_of_characters_values[ number_of_characters_iterator ];
+
+		memory_set(
+		 utf8_string,
+		 0xff,
+		 70 );
+
+		result = copy_ascii_function(
+		          utf16_stream,
+		          number_of_characters,
+		          utf8_string );
+
+		FWEVT_TEST_ASSERT_EQUAL_SIZE(
+		 "result",
+		 result,
+		 number_of_characters );
+
+		for( character_index = 0;
+		     character_index < number_of_characters;
+		     character_index++ )
+		{
+			FWEVT_TEST_ASSERT_EQUAL_UINT8(
+			 "utf8_string[ character_index ]",
+			 utf8_string[ character_index ],
+			 utf16_stream[ character_index * 2 ] );
+		}
+		result = copy_ascii_function(
+		          utf16_stream,
+		          number_of_characters,
+		          NULL );
+
+		FWEVT_TEST_ASSERT_EQUAL_SIZE(
+		 "result",
+		 result,
+		 number_of_characters );
+	}
+	/* Test runs that stop at characters that need to be escaped or are not ASCII
+	 */
+	for( stop_character_iterator = 0;
+	     stop_character_iterator < 7;
+	     stop_character_iterator++ )
+	{
+		for( stop_index = 0;
+		     stop_index < 70;
+		     stop_index += 3 )
+		{
+			utf16_stream[ stop_index * 2 ]         = (uint8_t) ( stop_characters[ stop_character_iterator ] & 0x00ff );
+			utf16_stream[ ( stop_index * 2 ) + 1 ] = (uint8_t) ( stop_characters[ stop_character_iterator ] >> 8 );
+
+			for( number_of_characters_iterator = 0;
+			     number_of_characters_iterator < 9;
+			     number_of_characters_iterator++ )
+			{
+				number_of_characters = number_of_characters_values[ number_of_characters_iterator ];
+
+				if( (size_t) stop_index < number_of_characters )
+				{
+					expected_result = (size_t) stop_index;
+				}
+				else
+				{
+					expected_result = number_of_characters;
+				}
+				result = copy_ascii_function(
+				          utf16_stream,
+				          number_of_characters,
+				          utf8_string );
+
+				FWEVT_TEST_ASSERT_EQUAL_SIZE(
+				 "result",
+				 result,
+				 expected_result );
+
+				result = copy_ascii_function(
+				          utf16_stream,
+				          number_of_characters,
+				          NULL );
+
+				FWEVT_TEST_ASSERT_EQUAL_SIZE(
+				 "result",
+				 result,
+				 expected_result );
+			}
+			utf16_stream[ stop_index * 2 ]         = (uint8_t) ( 'A' + ( stop_index % 26 ) );
+			utf16_stream[ ( stop_index * 2 ) + 1 ] = 0;
+		}
+	}
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_string_copy_ascii_from_utf16_little_endian function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_string_copy_ascii_from_utf16_little_endian(
+     void )
+{
+	return( fwevt_test_xml_string_copy_ascii_function(
+	         &libfwevt_xml_string_copy_ascii_from_utf16_little_endian ) );
+}
+
+#if defined( LIBFWEVT_XML_STRING_HAVE_SSE2 )
+
+/* Tests the libfwevt_xml_string_copy_ascii_from_utf16_little_endian_sse2 function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_string_copy_ascii_from_utf16_little_endian_sse2(
+     void )
+{
+	if( __builtin_cpu_supports( "sse2" ) == 0 )
+	{
+		return( 1 );
+	}
+	return( fwevt_test_xml_string_copy_ascii_function(
+	         &libfwevt_xml_string_copy_ascii_from_utf16_little_endian_sse2 ) );
+}
+
+#endif /* defined( LIBFWEVT_XML_STRING_HAVE_SSE2 ) */
+
+#if defined( LIBFWEVT_XML_STRING_HAVE_AVX2 )
+
+/* Tests the libfwevt_xml_string_copy_ascii_from_utf16_little_endian_avx2 function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_string_copy_ascii_from_utf16_little_endian_avx2(
+     void )
+{
+	if( __builtin_cpu_supports( "avx2" ) == 0 )
+	{
+		return( 1 );
+	}
+	return( fwevt_test_xml_string_copy_ascii_function(
+	         &libfwevt_xml_string_copy_ascii_from_utf16_little_endian_avx2 ) );
+}
+
+#endif /* defined( LIBFWEVT_XML_STRING_HAVE_AVX2 ) */
+
+/* Tests the libfwevt_xml_string_get_copy_ascii_function function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_string_get_copy_ascii_function(
+     void )
+{
+	libfwevt_xml_string_copy_ascii_function_t copy_ascii_function = NULL;
+
+	/* Test regular cases
+	 */
+	copy_ascii_function = libfwevt_xml_string_get_copy_ascii_function();
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "copy_ascii_function",
+	 copy_ascii_function );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "copy_ascii_function",
+	 (int) ( copy_ascii_function == libfwevt_xml_string_select_copy_ascii_function() ),
+	 1 );
+
+	/* Test if the cached function is returned
+	 */
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "copy_ascii_function",
+	 (int) ( copy_ascii_function == libfwevt_xml_string_get_copy_ascii_function() ),
+	 1 );
+
+	return( 1 );
+
+on_error:
+	return( 0 );
+}
+
+/* Tests the libfwevt_utf8_xml_string_with_index_copy_from_utf16_little_endian_run function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_utf8_xml_string_with_index_copy_from_utf16_little_endian_run(
+     void )
+{
+	uint8_t expected_utf8_string1[ 9 ] = {
+		'a', 'b', 'c', 0xc3, 0xa9, 0xe2, 0x82, 0xac, 'd' };
+
+	/* "abc" U+00e9 U+20ac "d&e"
+	 */
+	uint8_t utf16_stream1[ 16 ] = {
+		'a', 0, 'b', 0, 'c', 0, 0xe9, 0x00, 0xac, 0x20, 'd', 0, '&', 0, 'e', 0 };
+
+	/* "ab" U+1f600
+	 */
+	uint8_t utf16_stream2[ 8 ] = {
+		'a', 0, 'b', 0, 0x3d, 0xd8, 0x00, 0xde };
+
+	libuna_unicode_character_t last_unicode_character = 0;
+	libuna_utf8_character_t utf8_string[ 16 ];
+
+	libcerror_error_t *error                           = NULL;
+	size_t utf16_stream_index                          = 0;
+	size_t utf8_string_index                           = 0;
+	int result                                         = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_utf8_xml_string_with_index_copy_from_utf16_little_endian_run(
+	          utf8_string,
+	          16,
+	          &utf8_string_index,
+	          utf16_stream1,
+	          16,
+	          &utf16_stream_index,
+	          &last_unicode_character,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_stream_index",
+	 utf16_stream_index,
+	 (size_t) 12 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 9 );
+
+	FWEVT_TEST_ASSERT_EQUAL_UINT32(
+	 "last_unicode_character",
+	 last_unicode_character,
+	 (uint32_t) 'd' );
+
+	result = memory_compare(
+	          utf8_string,
+	          expected_utf8_string1,
+	          9 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test if only the UTF-8 string index is updated without UTF-8 string
+	 */
+	utf16_stream_index = 0;
+	utf8_string_index  = 0;
+
+	result = libfwevt_utf8_xml_string_with_index_copy_from_utf16_little_endian_run(
+	          NULL,
+	          0,
+	          &utf8_string_index,
+	          utf16_stream1,
+	          16,
+	          &utf16_stream_index,
+	          &last_unicode_character,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_stream_index",
+	 utf16_stream_index,
+	 (size_t) 12 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 9 );
+
+	/* Test if the copy stops when the UTF-8 string is too small for a character
+	 */
+	utf16_stream_index = 0;
+	utf8_string_index  = 0;
+
+	result = libfwevt_utf8_xml_string_with_index_copy_from_utf16_little_endian_run(
+	          utf8_string,
+	          7,
+	          &utf8_string_index,
+	          utf16_stream1,
+	          16,
+	          &utf16_stream_index,
+	          &last_unicode_character,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_stream_index",
+	 utf16_stream_index,
+	 (size_t) 8 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 5 );
+
+	FWEVT_TEST_ASSERT_EQUAL_UINT32(
+	 "last_unicode_character",
+	 last_unicode_character,
+	 (uint32_t) 0x00e9 );
+
+	/* Test if the copy stops at a surrogate
+	 */
+	utf16_stream_index = 0;
+	utf8_string_index  = 0;
+
+	result = libfwevt_utf8_xml_string_with_index_copy_from_utf16_little_endian_run(
+	          utf8_string,
+	          16,
+	          &utf8_string_index,
+	          utf16_stream2,
+	          8,
+	          &utf16_stream_index,
+	          &last_unicode_character,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_stream_index",
+	 utf16_stream_index,
+	 (size_t) 4 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 2 );
+
+	/* Test if the copy stops before an odd trailing byte
+	 */
+	utf16_stream_index = 0;
+	utf8_string_index  = 0;
+
+	result = libfwevt_utf8_xml_string_with_index_copy_from_utf16_little_endian_run(
+	          utf8_string,
+	          16,
+	          &utf8_string_index,
+	          utf16_stream2,
+	          5,
+	          &utf16_stream_index,
+	          &last_unicode_character,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_stream_index",
+	 utf16_stream_index,
+	 (size_t) 4 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 2 );
+
+	FWEVT_TEST_ASSERT_EQUAL_UINT32(
+	 "last_unicode_character",
+	 last_unicode_character,
+	 (uint32_t) 'b' );
+
+	/* Test error cases
+	 */
+	result = libfwevt_utf8_xml_string_with_index_copy_from_utf16_little_endian_run(
+	          utf8_string,
+	          16,
+	          NULL,
+	          utf16_stream1,
+	          16,
+	          &utf16_stream_index,
+	          &last_unicode_character,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_utf8_xml_string_with_index_copy_from_utf16_little_endian_run(
+	          utf8_string,
+	          16,
+	          &utf8_string_index,
+	          NULL,
+	          16,
+	          &utf16_stream_index,
+	          &last_unicode_character,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_utf8_xml_string_with_index_copy_from_utf16_little_endian_run(
+	          utf8_string,
+	          16,
+	          &utf8_string_index,
+	          utf16_stream1,
+	          16,
+	          NULL,
+	          &last_unicode_character,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_utf8_xml_string_with_index_copy_from_utf16_little_endian_run(
+	          utf8_string,
+	          16,
+	          &utf8_string_index,
+	          utf16_stream1,
+	          16,
+	          &utf16_stream_index,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_utf8_xml_string_size_from_utf16_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_utf8_xml_string_size_from_utf16_stream(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_utf8_xml_string_size_from_utf16_stream(
+	          fwevt_test_xml_string_utf16_stream1,
+	          24,
+	          LIBUNA_ENDIAN_LITTLE,
+	          &utf8_string_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 23 );
+
+	/* Test error cases
+	 */
+	result = libfwevt_utf8_xml_string_size_from_utf16_stream(
+	          NULL,
+	          24,
+	          LIBUNA_ENDIAN_LITTLE,
+	          &utf8_string_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_utf8_xml_string_size_from_utf16_stream(
+	          fwevt_test_xml_string_utf16_stream1,
+	          23,
+	          LIBUNA_ENDIAN_LITTLE,
+	          &utf8_string_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_utf8_xml_string_size_from_utf16_stream(
+	          fwevt_test_xml_string_utf16_stream1,
+	          24,
+	          LIBUNA_ENDIAN_LITTLE,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_utf8_xml_string_with_index_copy_from_utf16_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_utf8_xml_string_with_index_copy_from_utf16_stream(
+     void )
+{
+	libuna_utf8_character_t utf8_string[ 32 ];
+
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_index = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_utf8_xml_string_with_index_copy_from_utf16_stream(
+	          utf8_string,
+	          32,
+	          &utf8_string_index,
+	          fwevt_test_xml_string_utf16_stream1,
+	          24,
+	          LIBUNA_ENDIAN_LITTLE,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 23 );
+
+	result = memory_compare(
+	          utf8_string,
+	          fwevt_test_xml_string_utf8_string1,
+	          22 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWEVT_TEST_ASSERT_EQUAL_UINT8(
+	 "utf8_string[ 22 ]",
+	 utf8_string[ 22 ],
+	 0 );
+
+	/* Test error cases
+	 */
+	utf8_string_index = 0;
+
+	result = libfwevt_utf8_xml_string_with_index_copy_from_utf16_stream(
+	          NULL,
+	          32,
+	          &utf8_string_index,
+	          fwevt_test_xml_string_utf16_stream1,
+	          24,
+	          LIBUNA_ENDIAN_LITTLE,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_utf8_xml_string_with_index_copy_from_utf16_stream(
+	          utf8_string,
+	          32,
+	          NULL,
+	          fwevt_test_xml_string_utf16_stream1,
+	          24,
+	          LIBUNA_ENDIAN_LITTLE,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_utf8_xml_string_with_index_copy_from_utf16_stream(
+	          utf8_string,
+	          32,
+	          &utf8_string_index,
+	          NULL,
+	          24,
+	          LIBUNA_ENDIAN_LITTLE,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test if a UTF-8 string that is too small is detected
+	 */
+	utf8_string_index = 0;
+
+	result = libfwevt_utf8_xml_string_with_index_copy_from_utf16_stream(
+	          utf8_string,
+	          14,
+	          &utf8_string_index,
+	          fwevt_test_xml_string_utf16_stream1,
+	          24,
+	          LIBUNA_ENDIAN_LITTLE,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWEVT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWEVT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWEVT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWEVT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWEVT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWEVT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_xml_string_copy_ascii_from_utf16_little_endian",
+	 fwevt_test_xml_string_copy_ascii_from_utf16_little_endian );
+
+#if defined( LIBFWEVT_XML_STRING_HAVE_SSE2 )
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_xml_string_copy_ascii_from_utf16_little_endian_sse2",
+	 fwevt_test_xml_string_copy_ascii_from_utf16_little_endian_sse2 );
+
+#endif /* defined( LIBFWEVT_XML_STRING_HAVE_SSE2 ) */
+
+#if defined( LIBFWEVT_XML_STRING_HAVE_AVX2 )
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_xml_string_copy_ascii_from_utf16_little_endian_avx2",
+	 fwevt_test_xml_string_copy_ascii_from_utf16_little_endian_avx2 );
+
+#endif /* defined( LIBFWEVT_XML_STRING_HAVE_AVX2 ) */
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_xml_string_get_copy_ascii_function",
+	 fwevt_test_xml_string_get_copy_ascii_function );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_utf8_xml_string_with_index_copy_from_utf16_little_endian_run",
+	 fwevt_test_utf8_xml_string_with_index_copy_from_utf16_little_endian_run );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_utf8_xml_string_size_from_utf16_stream",
+	 fwevt_test_utf8_xml_string_size_from_utf16_stream );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_utf8_xml_string_with_index_copy_from_utf16_stream",
+	 fwevt_test_utf8_xml_string_with_index_copy_from_utf16_stream );
+
+	/* TODO: add tests for libfwevt_utf16_xml_string_size_from_utf16_stream */
+
+	/* TODO: add tests for libfwevt_utf16_xml_string_with_index_copy_from_utf16_stream */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
+}
+
@@ -35,6 +35,7 @@
 #include "fwevt_test_memory.h"
 #include "fwevt_test_unused.h"
 
+#include "../libfwevt/libfwevt_output_buffer.h"
 #include "../libfwevt/libfwevt_xml_tag.h"
 #include "../libfwevt/libfwevt_xml_value.h"
 
@@ -273,6 +274,245 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfwevt_internal_xml_tag_clear function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_internal_xml_tag_clear(
+     void )
+{
+	libcerror_error_t *error              = NULL;
+	libfwevt_xml_tag_t *attribute_xml_tag = NULL;
+	libfwevt_xml_tag_t *xml_tag           = NULL;
+	libfwevt_xml_value_t *xml_value       = NULL;
+	int number_of_attributes              = 0;
+	int result                            = 0;
+
+	/* Initialize test
+	 */
+	result = libfwevt_xml_tag_initialize(
+	          &xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "xml_tag",
+	 xml_tag );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_tag_set_name_data(
+	          xml_tag,
+	          (uint8_t *) "n\0a\0m\0e\0\0\0",
+	          10,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_tag_set_value_type(
+	          xml_tag,
+	          LIBFWEVT_VALUE_TYPE_BINARY_DATA,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_tag_set_value_data(
+	          xml_tag,
+	          (uint8_t *) "data",
+	          4,
+	          0,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_tag_initialize(
+	          &attribute_xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "attribute_xml_tag",
+	 attribute_xml_tag );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_tag_append_attribute(
+	          xml_tag,
+	          attribute_xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	attribute_xml_tag = NULL;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_internal_xml_tag_clear(
+	          (libfwevt_internal_xml_tag_t *) xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_tag_get_number_of_attributes(
+	          xml_tag,
+	          &number_of_attributes,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_attributes",
+	 number_of_attributes,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_tag_get_value(
+	          xml_tag,
+	          &xml_value,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "xml_value",
+	 xml_value );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test if the XML tag can be reused
+	 */
+	result = libfwevt_xml_tag_set_name_data(
+	          xml_tag,
+	          (uint8_t *) "n\0a\0m\0e\0\0\0",
+	          10,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_internal_xml_tag_clear(
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwevt_internal_xml_tag_free(
+	          (libfwevt_internal_xml_tag_t **) &xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "xml_tag",
+	 xml_tag );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( attribute_xml_tag != NULL )
+	{
+		libfwevt_internal_xml_tag_free(
+		 (libfwevt_internal_xml_tag_t **) &attribute_xml_tag,
+		 NULL );
+	}
+	if( xml_tag != NULL )
+	{
+		libfwevt_internal_xml_tag_free(
+		 (libfwevt_internal_xml_tag_t **) &xml_tag,
+		 NULL );
+	}
+	return( 0 );
+}
+
 /* Tests the libfwevt_xml_tag_set_type function
  * Returns 1 if successful or 0 if not
  */
@@ -678,6 +918,7 @@ int fwevt_test_xml_tag_set_value_data(
 	          xml_tag,
 	          (uint8_t *) "data",
 	          4,
+	          0,
 	          &error );
 
 	FWEVT_TEST_ASSERT_EQUAL_INT(
@@ -695,6 +936,7 @@ int fwevt_test_xml_tag_set_value_data(
 	          NULL,
 	          (uint8_t *) "data",
 	          4,
+	          0,
 	          &error );
 
 	FWEVT_TEST_ASSERT_EQUAL_INT(
@@ -713,6 +955,7 @@ int fwevt_test_xml_tag_set_value_data(
 	          xml_tag,
 	          NULL,
 	          4,
+	          0,
 	          &error );
 
 	FWEVT_TEST_ASSERT_EQUAL_INT(
@@ -731,6 +974,7 @@ int fwevt_test_xml_tag_set_value_data(
 	          xml_tag,
 	          (uint8_t *) "data",
 	          (size_t) SSIZE_MAX + 1,
+	          0,
 	          &error );
 
 	FWEVT_TEST_ASSERT_EQUAL_INT(
@@ -3078,22 +3322,97 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libfwevt_xml_tag_get_utf16_xml_string_size function
+/* Creates a XML tag with a name and value for testing
+ * Returns 1 if successful or -1 on error
+ */
+int fwevt_test_xml_tag_initialize_with_value(
+     libfwevt_xml_tag_t **xml_tag,
+     const uint8_t *name_data,
+     size_t name_data_size,
+     uint8_t value_type,
+     const uint8_t *value_data,
+     size_t value_data_size,
+     libcerror_error_t **error )
+{
+	if( libfwevt_xml_tag_initialize(
+	     xml_tag,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	if( libfwevt_xml_tag_set_name_data(
+	     *xml_tag,
+	     name_data,
+	     name_data_size,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( value_data != NULL )
+	{
+		if( libfwevt_xml_tag_set_value_type(
+		     *xml_tag,
+		     value_type,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( libfwevt_xml_tag_set_value_data(
+		     *xml_tag,
+		     value_data,
+		     value_data_size,
+		     0,
+		     error ) != 1 )
+		{
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	libfwevt_internal_xml_tag_free(
+	 (libfwevt_internal_xml_tag_t **) xml_tag,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Tests the libfwevt_xml_tag_render_utf8_json_string function
  * Returns 1 if successful or 0 if not
  */
-int fwevt_test_xml_tag_get_utf16_xml_string_size(
+int fwevt_test_xml_tag_render_utf8_json_string(
      libfwevt_xml_tag_t *xml_tag )
 {
-	libcerror_error_t *error     = NULL;
-	size_t utf16_xml_string_size = 0;
-	int result                   = 0;
+	libfwevt_output_buffer_t output_buffer;
+
+	uint8_t count_value_data[ 4 ]          = { 5, 0, 0, 0 };
+	uint8_t count_name_data[ 12 ]          = { 'C', 0, 'o', 0, 'u', 0, 'n', 0, 't', 0, 0, 0 };
+	uint8_t data_name_data[ 10 ]           = { 'D', 0, 'a', 0, 't', 0, 'a', 0, 0, 0 };
+	uint8_t event_data_name_data[ 20 ]     = { 'E', 0, 'v', 0, 'e', 0, 'n', 0, 't', 0, 'D', 0, 'a', 0, 't', 0, 'a', 0, 0, 0 };
+	uint8_t name_name_data[ 10 ]           = { 'N', 0, 'a', 0, 'm', 0, 'e', 0, 0, 0 };
+	uint8_t text_name_data[ 10 ]           = { 'T', 0, 'e', 0, 'x', 0, 't', 0, 0, 0 };
+	uint8_t text_value_data[ 10 ]          = { 'a', 0, '"', 0, 'b', 0, '\n', 0, 0, 0 };
+	uint8_t x_value_data[ 4 ]              = { 'x', 0, 0, 0 };
+	uint8_t y_value_data[ 4 ]              = { 'y', 0, 0, 0 };
+	char *expected_json_string             = "{\"Count\":5,\"Data\":[\"x\",\"y\"],\"Text\":\"a\\\"b\\n\"}";
+	libcerror_error_t *error               = NULL;
+	libfwevt_xml_tag_t *attribute_xml_tag  = NULL;
+	libfwevt_xml_tag_t *element_xml_tag    = NULL;
+	libfwevt_xml_tag_t *event_data_xml_tag = NULL;
+	int result                             = 0;
+
+	output_buffer.data                = NULL;
+	output_buffer.data_size           = 0;
+	output_buffer.allocated_data_size = 0;
+	output_buffer.data_is_fixed       = 0;
+	output_buffer.write_callback      = NULL;
+	output_buffer.callback_data       = NULL;
 
 	/* Test regular cases
 	 */
-	result = libfwevt_xml_tag_get_utf16_xml_string_size(
+	result = libfwevt_xml_tag_render_utf8_json_string(
 	          xml_tag,
-	          0,
-	          &utf16_xml_string_size,
+	          &output_buffer,
 	          LIBUNA_CODEPAGE_WINDOWS_1252,
 	          &error );
 
@@ -3103,8 +3422,397 @@ int fwevt_test_xml_tag_get_utf16_xml_string_size(
 	 1 );
 
 	FWEVT_TEST_ASSERT_EQUAL_SIZE(
-	 "utf16_xml_string_size",
-	 utf16_xml_string_size,
+	 "output_buffer.data_size",
+	 output_buffer.data_size,
+	 (size_t) 10 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_buffer.data,
+	          "\"64617461\"",
+	          10 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test EventData with Data elements with and without a Name attribute
+	 */
+	result = fwevt_test_xml_tag_initialize_with_value(
+	          &event_data_xml_tag,
+	          event_data_name_data,
+	          20,
+	          0,
+	          NULL,
+	          0,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fwevt_test_xml_tag_initialize_with_value(
+	          &element_xml_tag,
+	          data_name_data,
+	          10,
+	          LIBFWEVT_VALUE_TYPE_UNSIGNED_INTEGER_32BIT,
+	          count_value_data,
+	          4,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fwevt_test_xml_tag_initialize_with_value(
+	          &attribute_xml_tag,
+	          name_name_data,
+	          10,
+	          LIBFWEVT_VALUE_TYPE_STRING_UTF16,
+	          count_name_data,
+	          12,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_tag_append_attribute(
+	          element_xml_tag,
+	          attribute_xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	attribute_xml_tag = NULL;
+
+	result = libfwevt_xml_tag_append_element(
+	          event_data_xml_tag,
+	          element_xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_xml_tag = NULL;
+
+	result = fwevt_test_xml_tag_initialize_with_value(
+	          &element_xml_tag,
+	          data_name_data,
+	          10,
+	          LIBFWEVT_VALUE_TYPE_STRING_UTF16,
+	          x_value_data,
+	          4,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_tag_append_element(
+	          event_data_xml_tag,
+	          element_xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_xml_tag = NULL;
+
+	result = fwevt_test_xml_tag_initialize_with_value(
+	          &element_xml_tag,
+	          data_name_data,
+	          10,
+	          LIBFWEVT_VALUE_TYPE_STRING_UTF16,
+	          text_value_data,
+	          10,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = fwevt_test_xml_tag_initialize_with_value(
+	          &attribute_xml_tag,
+	          name_name_data,
+	          10,
+	          LIBFWEVT_VALUE_TYPE_STRING_UTF16,
+	          text_name_data,
+	          10,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_tag_append_attribute(
+	          element_xml_tag,
+	          attribute_xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	attribute_xml_tag = NULL;
+
+	result = libfwevt_xml_tag_append_element(
+	          event_data_xml_tag,
+	          element_xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_xml_tag = NULL;
+
+	result = fwevt_test_xml_tag_initialize_with_value(
+	          &element_xml_tag,
+	          data_name_data,
+	          10,
+	          LIBFWEVT_VALUE_TYPE_STRING_UTF16,
+	          y_value_data,
+	          4,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_tag_append_element(
+	          event_data_xml_tag,
+	          element_xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	element_xml_tag = NULL;
+
+	output_buffer.data_size = 0;
+
+	result = libfwevt_xml_tag_render_utf8_json_string(
+	          event_data_xml_tag,
+	          &output_buffer,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "output_buffer.data_size",
+	 output_buffer.data_size,
+	 (size_t) 44 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          output_buffer.data,
+	          expected_json_string,
+	          44 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_tag_render_utf8_json_string(
+	          NULL,
+	          &output_buffer,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_tag_render_utf8_json_string(
+	          xml_tag,
+	          NULL,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwevt_internal_xml_tag_free(
+	          (libfwevt_internal_xml_tag_t **) &event_data_xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 output_buffer.data );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( attribute_xml_tag != NULL )
+	{
+		libfwevt_internal_xml_tag_free(
+		 (libfwevt_internal_xml_tag_t **) &attribute_xml_tag,
+		 NULL );
+	}
+	if( element_xml_tag != NULL )
+	{
+		libfwevt_internal_xml_tag_free(
+		 (libfwevt_internal_xml_tag_t **) &element_xml_tag,
+		 NULL );
+	}
+	if( event_data_xml_tag != NULL )
+	{
+		libfwevt_internal_xml_tag_free(
+		 (libfwevt_internal_xml_tag_t **) &event_data_xml_tag,
+		 NULL );
+	}
+	if( output_buffer.data != NULL )
+	{
+		memory_free(
+		 output_buffer.data );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_tag_get_utf16_xml_string_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_tag_get_utf16_xml_string_size(
+     libfwevt_xml_tag_t *xml_tag )
+{
+	libcerror_error_t *error     = NULL;
+	size_t utf16_xml_string_size = 0;
+	int result                   = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_tag_get_utf16_xml_string_size(
+	          xml_tag,
+	          0,
+	          &utf16_xml_string_size,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_xml_string_size",
+	 utf16_xml_string_size,
 	 (size_t) 23 );
 
 	FWEVT_TEST_ASSERT_IS_NULL(
@@ -3350,6 +4058,10 @@ int main(
 
 	/* TODO: add tests for libfwevt_internal_xml_tag_free */
 
+	FWEVT_TEST_RUN(
+	 "libfwevt_internal_xml_tag_clear",
+	 fwevt_test_internal_xml_tag_clear );
+
 	FWEVT_TEST_RUN(
 	 "libfwevt_xml_tag_set_type",
 	 fwevt_test_xml_tag_set_type );
@@ -3426,6 +4138,7 @@ int main(
 	          xml_tag,
 	          (uint8_t *) "data",
 	          4,
+	          0,
 	          &error );
 
 	FWEVT_TEST_ASSERT_EQUAL_INT(
@@ -3539,6 +4252,11 @@ int main(
 	 fwevt_test_xml_tag_get_utf8_xml_string_with_index,
 	 xml_tag );
 
+	FWEVT_TEST_RUN_WITH_ARGS(
+	 "libfwevt_xml_tag_render_utf8_json_string",
+	 fwevt_test_xml_tag_render_utf8_json_string,
+	 xml_tag );
+
 	FWEVT_TEST_RUN_WITH_ARGS(
 	 "libfwevt_xml_tag_get_utf16_xml_string_size",
 	 fwevt_test_xml_tag_get_utf16_xml_string_size,
@@ -0,0 +1,909 @@
+/*
+ * Library xml_template_cache type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwevt_test_libcerror.h"
+#include "fwevt_test_libfwevt.h"
+#include "fwevt_test_macros.h"
+#include "fwevt_test_memory.h"
+#include "fwevt_test_unused.h"
+
+#include "../libfwevt/libfwevt_xml_template_cache.h"
+#include "../libfwevt/libfwevt_xml_template_definition.h"
+
+/* Tests the libfwevt_xml_template_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_template_cache_initialize(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libfwevt_xml_template_cache_t *template_cache = NULL;
+	int result                                    = 0;
+
+#if defined( HAVE_FWEVT_TEST_MEMORY )
+	int number_of_malloc_fail_tests               = 1;
+	int number_of_memset_fail_tests               = 1;
+	int test_number                               = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_template_cache_initialize(
+	          &template_cache,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "template_cache",
+	 template_cache );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_template_cache_free(
+	          &template_cache,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "template_cache",
+	 template_cache );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_template_cache_initialize(
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	template_cache = (libfwevt_xml_template_cache_t *) 0x12345678UL;
+
+	result = libfwevt_xml_template_cache_initialize(
+	          &template_cache,
+	          &error );
+
+	template_cache = NULL;
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FWEVT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwevt_xml_template_cache_initialize with malloc failing
+		 */
+		fwevt_test_malloc_attempts_before_fail = test_number;
+
+		result = libfwevt_xml_template_cache_initialize(
+		          &template_cache,
+		          &error );
+
+		if( fwevt_test_malloc_attempts_before_fail != -1 )
+		{
+			fwevt_test_malloc_attempts_before_fail = -1;
+
+			if( template_cache != NULL )
+			{
+				libfwevt_xml_template_cache_free(
+				 &template_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWEVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWEVT_TEST_ASSERT_IS_NULL(
+			 "template_cache",
+			 template_cache );
+
+			FWEVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwevt_xml_template_cache_initialize with memset failing
+		 */
+		fwevt_test_memset_attempts_before_fail = test_number;
+
+		result = libfwevt_xml_template_cache_initialize(
+		          &template_cache,
+		          &error );
+
+		if( fwevt_test_memset_attempts_before_fail != -1 )
+		{
+			fwevt_test_memset_attempts_before_fail = -1;
+
+			if( template_cache != NULL )
+			{
+				libfwevt_xml_template_cache_free(
+				 &template_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWEVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWEVT_TEST_ASSERT_IS_NULL(
+			 "template_cache",
+			 template_cache );
+
+			FWEVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FWEVT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( template_cache != NULL )
+	{
+		libfwevt_xml_template_cache_free(
+		 &template_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_template_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_template_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_template_cache_free(
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_template_cache_empty function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_template_cache_empty(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libfwevt_xml_template_cache_t *template_cache = NULL;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libfwevt_xml_template_cache_initialize(
+	          &template_cache,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "template_cache",
+	 template_cache );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_template_cache_empty(
+	          template_cache,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_template_cache_empty(
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwevt_xml_template_cache_free(
+	          &template_cache,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "template_cache",
+	 template_cache );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( template_cache != NULL )
+	{
+		libfwevt_xml_template_cache_free(
+		 &template_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_template_cache_get_number_of_definitions function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_template_cache_get_number_of_definitions(
+     void )
+{
+	libcerror_error_t *error                      = NULL;
+	libfwevt_xml_template_cache_t *template_cache = NULL;
+	int number_of_definitions                     = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libfwevt_xml_template_cache_initialize(
+	          &template_cache,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "template_cache",
+	 template_cache );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_template_cache_get_number_of_definitions(
+	          template_cache,
+	          &number_of_definitions,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_definitions",
+	 number_of_definitions,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_template_cache_get_number_of_definitions(
+	          NULL,
+	          &number_of_definitions,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_template_cache_get_number_of_definitions(
+	          template_cache,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwevt_xml_template_cache_free(
+	          &template_cache,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "template_cache",
+	 template_cache );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( template_cache != NULL )
+	{
+		libfwevt_xml_template_cache_free(
+		 &template_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+
+/* Tests the libfwevt_internal_xml_template_cache_insert_definition and
+ * libfwevt_internal_xml_template_cache_get_definition functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_internal_xml_template_cache_insert_definition(
+     void )
+{
+	uint8_t binary_data[ 25 ] = {
+		0x00, 0x00, 0x00, 0x00, 0x33, 0x12, 0x8a, 0x27, 0x65, 0xf6, 0x52, 0x52, 0x0b, 0xa7, 0x2b, 0xca,
+		0x59, 0x74, 0x33, 0xa8, 0x01, 0x00, 0x00, 0x00, 0x00 };
+
+	libcerror_error_t *error                                = NULL;
+	libfwevt_xml_template_cache_t *template_cache           = NULL;
+	libfwevt_xml_template_definition_t *cached_definition   = NULL;
+	libfwevt_xml_template_definition_t *template_definition = NULL;
+	int number_of_definitions                               = 0;
+	int result                                              = 0;
+
+	/* Initialize test
+	 */
+	result = libfwevt_xml_template_cache_initialize(
+	          &template_cache,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "template_cache",
+	 template_cache );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_template_definition_initialize(
+	          &template_definition,
+	          0,
+	          0,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "template_definition",
+	 template_definition );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_template_definition_set_data(
+	          template_definition,
+	          binary_data,
+	          25,
+	          25,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test retrieve definition from an empty cache
+	 */
+	result = libfwevt_internal_xml_template_cache_get_definition(
+	          (libfwevt_internal_xml_template_cache_t *) template_cache,
+	          binary_data,
+	          25,
+	          0,
+	          0,
+	          &cached_definition,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwevt_internal_xml_template_cache_insert_definition(
+	          (libfwevt_internal_xml_template_cache_t *) template_cache,
+	          template_definition,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	cached_definition   = template_definition;
+	template_definition = NULL;
+
+	result = libfwevt_xml_template_cache_get_number_of_definitions(
+	          template_cache,
+	          &number_of_definitions,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_definitions",
+	 number_of_definitions,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_internal_xml_template_cache_get_definition(
+	          (libfwevt_internal_xml_template_cache_t *) template_cache,
+	          binary_data,
+	          25,
+	          0,
+	          0,
+	          &template_definition,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "template_definition",
+	 (int) ( template_definition == cached_definition ),
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	template_definition = NULL;
+
+	/* Test retrieve definition that does not match the binary data
+	 */
+	binary_data[ 24 ] = 0x04;
+
+	result = libfwevt_internal_xml_template_cache_get_definition(
+	          (libfwevt_internal_xml_template_cache_t *) template_cache,
+	          binary_data,
+	          25,
+	          0,
+	          0,
+	          &template_definition,
+	          &error );
+
+	binary_data[ 24 ] = 0x00;
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_internal_xml_template_cache_get_definition(
+	          (libfwevt_internal_xml_template_cache_t *) template_cache,
+	          binary_data,
+	          25,
+	          0,
+	          1,
+	          &template_definition,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test insert definition with an identifier that is already cached
+	 */
+	result = libfwevt_xml_template_definition_initialize(
+	          &template_definition,
+	          0,
+	          0,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfwevt_xml_template_definition_set_data(
+	          template_definition,
+	          binary_data,
+	          25,
+	          25,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = libfwevt_internal_xml_template_cache_insert_definition(
+	          (libfwevt_internal_xml_template_cache_t *) template_cache,
+	          template_definition,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_internal_xml_template_cache_insert_definition(
+	          NULL,
+	          template_definition,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_internal_xml_template_cache_insert_definition(
+	          (libfwevt_internal_xml_template_cache_t *) template_cache,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_internal_xml_template_cache_get_definition(
+	          NULL,
+	          binary_data,
+	          25,
+	          0,
+	          0,
+	          &cached_definition,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_internal_xml_template_cache_get_definition(
+	          (libfwevt_internal_xml_template_cache_t *) template_cache,
+	          NULL,
+	          25,
+	          0,
+	          0,
+	          &cached_definition,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwevt_xml_template_definition_free(
+	          &template_definition,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_template_cache_free(
+	          &template_cache,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "template_cache",
+	 template_cache );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( template_definition != NULL )
+	{
+		libfwevt_xml_template_definition_free(
+		 &template_definition,
+		 NULL );
+	}
+	if( template_cache != NULL )
+	{
+		libfwevt_xml_template_cache_free(
+		 &template_cache,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWEVT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWEVT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWEVT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWEVT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWEVT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWEVT_TEST_UNREFERENCED_PARAMETER( argv )
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_xml_template_cache_initialize",
+	 fwevt_test_xml_template_cache_initialize );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_xml_template_cache_free",
+	 fwevt_test_xml_template_cache_free );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_xml_template_cache_empty",
+	 fwevt_test_xml_template_cache_empty );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_xml_template_cache_get_number_of_definitions",
+	 fwevt_test_xml_template_cache_get_number_of_definitions );
+
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_internal_xml_template_cache_insert_definition",
+	 fwevt_test_internal_xml_template_cache_insert_definition );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
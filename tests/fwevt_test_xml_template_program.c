@@ -0,0 +1,737 @@
+/*
+ * Library xml_template_program type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwevt_test_libcerror.h"
+#include "fwevt_test_libfwevt.h"
+#include "fwevt_test_libuna.h"
+#include "fwevt_test_macros.h"
+#include "fwevt_test_memory.h"
+#include "fwevt_test_unused.h"
+
+#include "../libfwevt/libfwevt_xml_template_program.h"
+
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+
+/* Tests the libfwevt_xml_template_program_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_template_program_initialize(
+     void )
+{
+	libcerror_error_t *error                 = NULL;
+	libfwevt_xml_template_program_t *program = NULL;
+	int result                               = 0;
+
+#if defined( HAVE_FWEVT_TEST_MEMORY )
+	int number_of_malloc_fail_tests          = 1;
+	int test_number                          = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_template_program_initialize(
+	          &program,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "program",
+	 program );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_template_program_free(
+	          &program,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "program",
+	 program );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_template_program_initialize(
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	program = (libfwevt_xml_template_program_t *) 0x12345678UL;
+
+	result = libfwevt_xml_template_program_initialize(
+	          &program,
+	          &error );
+
+	program = NULL;
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FWEVT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwevt_xml_template_program_initialize with malloc failing
+		 */
+		fwevt_test_malloc_attempts_before_fail = test_number;
+
+		result = libfwevt_xml_template_program_initialize(
+		          &program,
+		          &error );
+
+		if( fwevt_test_malloc_attempts_before_fail != -1 )
+		{
+			fwevt_test_malloc_attempts_before_fail = -1;
+
+			if( program != NULL )
+			{
+				libfwevt_xml_template_program_free(
+				 &program,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWEVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWEVT_TEST_ASSERT_IS_NULL(
+			 "program",
+			 program );
+
+			FWEVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FWEVT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( program != NULL )
+	{
+		libfwevt_xml_template_program_free(
+		 &program,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_template_program_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_template_program_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_template_program_free(
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_template_program_get_value_data_size function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_template_program_get_value_data_size(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint16_t value_data_size = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_template_program_get_value_data_size(
+	          LIBFWEVT_VALUE_TYPE_UNSIGNED_INTEGER_32BIT,
+	          &value_data_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_UINT16(
+	 "value_data_size",
+	 value_data_size,
+	 (uint16_t) 4 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_template_program_get_value_data_size(
+	          LIBFWEVT_VALUE_TYPE_GUID,
+	          &value_data_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_UINT16(
+	 "value_data_size",
+	 value_data_size,
+	 (uint16_t) 16 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_template_program_get_value_data_size(
+	          LIBFWEVT_VALUE_TYPE_STRING_UTF16,
+	          &value_data_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_UINT16(
+	 "value_data_size",
+	 value_data_size,
+	 (uint16_t) 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with an unsupported value type
+	 */
+	result = libfwevt_xml_template_program_get_value_data_size(
+	          LIBFWEVT_VALUE_TYPE_BINARY_XML,
+	          &value_data_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_template_program_get_value_data_size(
+	          LIBFWEVT_VALUE_TYPE_UNSIGNED_INTEGER_32BIT,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_template_program_copy_indentation_to_utf8_string_with_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_template_program_copy_indentation_to_utf8_string_with_index(
+     void )
+{
+	uint8_t utf8_string[ 8 ];
+
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_index = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	utf8_string_index = 1;
+
+	result = libfwevt_xml_template_program_copy_indentation_to_utf8_string_with_index(
+	          2,
+	          utf8_string,
+	          8,
+	          &utf8_string_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_index",
+	 utf8_string_index,
+	 (size_t) 5 );
+
+	FWEVT_TEST_ASSERT_EQUAL_UINT8(
+	 "utf8_string[ 4 ]",
+	 utf8_string[ 4 ],
+	 (uint8_t) ' ' );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	utf8_string_index = 0;
+
+	result = libfwevt_xml_template_program_copy_indentation_to_utf8_string_with_index(
+	          -1,
+	          utf8_string,
+	          8,
+	          &utf8_string_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_template_program_copy_indentation_to_utf8_string_with_index(
+	          2,
+	          utf8_string,
+	          8,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test with an UTF-8 string that is too small
+	 */
+	utf8_string_index = 6;
+
+	result = libfwevt_xml_template_program_copy_indentation_to_utf8_string_with_index(
+	          2,
+	          utf8_string,
+	          8,
+	          &utf8_string_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_template_program_get_array_value_element function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_template_program_get_array_value_element(
+     void )
+{
+	uint8_t utf16_array_data[ 8 ] = {
+		0x61, 0x00, 0x00, 0x00, 0x62, 0x00, 0x00, 0x00 };
+
+	uint8_t integer_array_data[ 4 ] = {
+		0x01, 0x00, 0x02, 0x00 };
+
+	const uint8_t *element_data = NULL;
+	libcerror_error_t *error    = NULL;
+	size_t array_value_offset   = 0;
+	size_t element_data_size    = 0;
+	int result                  = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_template_program_get_array_value_element(
+	          LIBFWEVT_VALUE_TYPE_ARRAY_OF_STRING_UTF16,
+	          utf16_array_data,
+	          8,
+	          &array_value_offset,
+	          &element_data,
+	          &element_data_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "array_value_offset",
+	 array_value_offset,
+	 (size_t) 4 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "element_data_size",
+	 element_data_size,
+	 (size_t) 4 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_template_program_get_array_value_element(
+	          LIBFWEVT_VALUE_TYPE_ARRAY_OF_STRING_UTF16,
+	          utf16_array_data,
+	          8,
+	          &array_value_offset,
+	          &element_data,
+	          &element_data_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "array_value_offset",
+	 array_value_offset,
+	 (size_t) 0 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "element_data_size",
+	 element_data_size,
+	 (size_t) 4 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_template_program_get_array_value_element(
+	          LIBFWEVT_VALUE_TYPE_ARRAY_OF_UNSIGNED_INTEGER_16BIT,
+	          integer_array_data,
+	          4,
+	          &array_value_offset,
+	          &element_data,
+	          &element_data_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "array_value_offset",
+	 array_value_offset,
+	 (size_t) 2 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "element_data_size",
+	 element_data_size,
+	 (size_t) 2 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test with fixed-size array data that is too small
+	 */
+	array_value_offset = 0;
+
+	result = libfwevt_xml_template_program_get_array_value_element(
+	          LIBFWEVT_VALUE_TYPE_ARRAY_OF_UNSIGNED_INTEGER_32BIT,
+	          integer_array_data,
+	          2,
+	          &array_value_offset,
+	          &element_data,
+	          &element_data_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_template_program_get_array_value_element(
+	          LIBFWEVT_VALUE_TYPE_STRING_UTF16,
+	          utf16_array_data,
+	          8,
+	          &array_value_offset,
+	          &element_data,
+	          &element_data_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_template_program_get_array_value_element(
+	          LIBFWEVT_VALUE_TYPE_ARRAY_OF_STRING_UTF16,
+	          utf16_array_data,
+	          8,
+	          NULL,
+	          &element_data,
+	          &element_data_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_template_program_get_array_value_element(
+	          LIBFWEVT_VALUE_TYPE_ARRAY_OF_STRING_UTF16,
+	          utf16_array_data,
+	          8,
+	          &array_value_offset,
+	          NULL,
+	          &element_data_size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_template_program_get_array_value_element(
+	          LIBFWEVT_VALUE_TYPE_ARRAY_OF_STRING_UTF16,
+	          utf16_array_data,
+	          8,
+	          &array_value_offset,
+	          &element_data,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWEVT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWEVT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWEVT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWEVT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	FWEVT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWEVT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_xml_template_program_initialize",
+	 fwevt_test_xml_template_program_initialize );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_xml_template_program_free",
+	 fwevt_test_xml_template_program_free );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_xml_template_program_get_value_data_size",
+	 fwevt_test_xml_template_program_get_value_data_size );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_xml_template_program_copy_indentation_to_utf8_string_with_index",
+	 fwevt_test_xml_template_program_copy_indentation_to_utf8_string_with_index );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_xml_template_program_get_array_value_element",
+	 fwevt_test_xml_template_program_get_array_value_element );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
+}
+
@@ -962,6 +962,172 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libfwevt_xml_template_value_reset function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_template_value_reset(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libfwevt_xml_template_value_t *xml_template_value = NULL;
+	uint16_t size                                     = 0;
+	uint8_t flags                                     = 0;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = libfwevt_xml_template_value_initialize(
+	          &xml_template_value,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "xml_template_value",
+	 xml_template_value );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_template_value_set_size(
+	          xml_template_value,
+	          8,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_template_value_set_flags(
+	          xml_template_value,
+	          LIBFWEVT_XML_TEMPLATE_VALUE_FLAG_IS_DEFINITION,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_template_value_reset(
+	          xml_template_value,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_template_value_get_size(
+	          xml_template_value,
+	          &size,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_UINT16(
+	 "size",
+	 size,
+	 (uint16_t) 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_template_value_get_flags(
+	          xml_template_value,
+	          &flags,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_UINT8(
+	 "flags",
+	 flags,
+	 (uint8_t) 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_template_value_reset(
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwevt_xml_template_value_free(
+	          &xml_template_value,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "xml_template_value",
+	 xml_template_value );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( xml_template_value != NULL )
+	{
+		libfwevt_xml_template_value_free(
+		 &xml_template_value,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* #if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
 
 /* The main program
@@ -1054,6 +1220,10 @@ int main(
 	 "libfwevt_xml_template_value_set_flags",
 	 fwevt_test_xml_template_value_set_flags );
 
+	FWEVT_TEST_RUN(
+	 "libfwevt_xml_template_value_reset",
+	 fwevt_test_xml_template_value_reset );
+
 	/* Clean up
 	 */
 	result = libfwevt_xml_template_value_free(
@@ -0,0 +1,1883 @@
+/*
+ * Library xml_tree type test program
+ *
+ * Copyright (C) 2011-2026, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "fwevt_test_libcerror.h"
+#include "fwevt_test_libfwevt.h"
+#include "fwevt_test_libuna.h"
+#include "fwevt_test_macros.h"
+#include "fwevt_test_memory.h"
+#include "fwevt_test_unused.h"
+
+#include "../libfwevt/libfwevt_xml_document.h"
+#include "../libfwevt/libfwevt_xml_tree.h"
+
+/* Binary XML document of:
+ * <Event>
+ *   <System Name="a" Guid="b">
+ *     <EventID>7</EventID>
+ *     <Level>4</Level>
+ *   </System>
+ *   <Data>xy</Data>
+ *   <Empty/>
+ * </Event>
+ */
+uint8_t fwevt_test_xml_tree_data1[ 288 ] = {
+	0x0f, 0x01, 0x01, 0x00, 0x01, 0x0a, 0x01, 0x00, 0x00, 0x0d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0xba, 0x0c, 0x05, 0x00, 0x45, 0x00, 0x76, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x00,
+	0x00, 0x02, 0x41, 0xa8, 0x00, 0x00, 0x00, 0x2b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f,
+	0x54, 0x06, 0x00, 0x53, 0x00, 0x79, 0x00, 0x73, 0x00, 0x74, 0x00, 0x65, 0x00, 0x6d, 0x00, 0x00,
+	0x00, 0x3a, 0x00, 0x00, 0x00, 0x46, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4b, 0x95,
+	0x04, 0x00, 0x4e, 0x00, 0x61, 0x00, 0x6d, 0x00, 0x65, 0x00, 0x00, 0x00, 0x05, 0x01, 0x01, 0x00,
+	0x61, 0x00, 0x06, 0x67, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x29, 0x15, 0x04, 0x00, 0x47,
+	0x00, 0x75, 0x00, 0x69, 0x00, 0x64, 0x00, 0x00, 0x00, 0x05, 0x01, 0x01, 0x00, 0x62, 0x00, 0x02,
+	0x01, 0x24, 0x00, 0x00, 0x00, 0x89, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf5, 0x61, 0x07,
+	0x00, 0x45, 0x00, 0x76, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x74, 0x00, 0x49, 0x00, 0x44, 0x00, 0x00,
+	0x00, 0x02, 0x05, 0x01, 0x01, 0x00, 0x37, 0x00, 0x04, 0x01, 0x20, 0x00, 0x00, 0x00, 0xb2, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x64, 0xce, 0x05, 0x00, 0x4c, 0x00, 0x65, 0x00, 0x76, 0x00,
+	0x65, 0x00, 0x6c, 0x00, 0x00, 0x00, 0x02, 0x05, 0x01, 0x01, 0x00, 0x34, 0x00, 0x04, 0x04, 0x01,
+	0x20, 0x00, 0x00, 0x00, 0xd8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x6f, 0x04, 0x00,
+	0x44, 0x00, 0x61, 0x00, 0x74, 0x00, 0x61, 0x00, 0x00, 0x00, 0x02, 0x05, 0x01, 0x02, 0x00, 0x78,
+	0x00, 0x79, 0x00, 0x04, 0x01, 0x19, 0x00, 0x00, 0x00, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x0d, 0x62, 0x05, 0x00, 0x45, 0x00, 0x6d, 0x00, 0x70, 0x00, 0x74, 0x00, 0x79, 0x00, 0x00,
+	0x00, 0x03, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+
+/* Tests the libfwevt_xml_tree_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_tree_initialize(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libfwevt_xml_tree_t *xml_tree   = NULL;
+	int result                      = 0;
+
+#if defined( HAVE_FWEVT_TEST_MEMORY )
+	int number_of_malloc_fail_tests = 1;
+	int test_number                 = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_tree_initialize(
+	          &xml_tree,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "xml_tree",
+	 xml_tree );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_tree_free(
+	          &xml_tree,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "xml_tree",
+	 xml_tree );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_tree_initialize(
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	xml_tree = (libfwevt_xml_tree_t *) 0x12345678UL;
+
+	result = libfwevt_xml_tree_initialize(
+	          &xml_tree,
+	          &error );
+
+	xml_tree = NULL;
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_FWEVT_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libfwevt_xml_tree_initialize with malloc failing
+		 */
+		fwevt_test_malloc_attempts_before_fail = test_number;
+
+		result = libfwevt_xml_tree_initialize(
+		          &xml_tree,
+		          &error );
+
+		if( fwevt_test_malloc_attempts_before_fail != -1 )
+		{
+			fwevt_test_malloc_attempts_before_fail = -1;
+
+			if( xml_tree != NULL )
+			{
+				libfwevt_xml_tree_free(
+				 &xml_tree,
+				 NULL );
+			}
+		}
+		else
+		{
+			FWEVT_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			FWEVT_TEST_ASSERT_IS_NULL(
+			 "xml_tree",
+			 xml_tree );
+
+			FWEVT_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_FWEVT_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( xml_tree != NULL )
+	{
+		libfwevt_xml_tree_free(
+		 &xml_tree,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_tree_free function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_tree_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_tree_free(
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_tree_append_node and libfwevt_xml_tree_append_attribute functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_tree_append_node(
+     void )
+{
+	uint8_t name_data[ 4 ]        = { 'a', 0, 0, 0 };
+	libcerror_error_t *error      = NULL;
+	libfwevt_xml_tag_t *xml_tag   = NULL;
+	libfwevt_xml_tree_t *xml_tree = NULL;
+	int node_index                = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libfwevt_xml_tree_initialize(
+	          &xml_tree,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_tag_initialize(
+	          &xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_tag_set_name_data(
+	          xml_tag,
+	          name_data,
+	          4,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_tree_append_node(
+	          xml_tree,
+	          -1,
+	          (libfwevt_internal_xml_tag_t *) xml_tag,
+	          &node_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "node_index",
+	 node_index,
+	 0 );
+
+	result = libfwevt_xml_tree_append_attribute(
+	          xml_tree,
+	          0,
+	          (libfwevt_internal_xml_tag_t *) xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_tree_append_node(
+	          xml_tree,
+	          0,
+	          (libfwevt_internal_xml_tag_t *) xml_tag,
+	          &node_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "node_index",
+	 node_index,
+	 2 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "xml_tree->number_of_nodes",
+	 xml_tree->number_of_nodes,
+	 3 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "xml_tree->number_of_attributes[ 0 ]",
+	 xml_tree->number_of_attributes[ 0 ],
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "xml_tree->names_data_size",
+	 xml_tree->names_data_size,
+	 (size_t) 12 );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_tree_append_node(
+	          NULL,
+	          -1,
+	          (libfwevt_internal_xml_tag_t *) xml_tag,
+	          &node_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_tree_append_node(
+	          xml_tree,
+	          3,
+	          (libfwevt_internal_xml_tag_t *) xml_tag,
+	          &node_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_tree_append_node(
+	          xml_tree,
+	          -1,
+	          NULL,
+	          &node_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_tree_append_node(
+	          xml_tree,
+	          -1,
+	          (libfwevt_internal_xml_tag_t *) xml_tag,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_tree_append_attribute(
+	          NULL,
+	          0,
+	          (libfwevt_internal_xml_tag_t *) xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* An attribute cannot be appended after a sub element
+	 */
+	result = libfwevt_xml_tree_append_attribute(
+	          xml_tree,
+	          0,
+	          (libfwevt_internal_xml_tag_t *) xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwevt_internal_xml_tag_free(
+	          (libfwevt_internal_xml_tag_t **) &xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_tree_free(
+	          &xml_tree,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( xml_tag != NULL )
+	{
+		libfwevt_internal_xml_tag_free(
+		 (libfwevt_internal_xml_tag_t **) &xml_tag,
+		 NULL );
+	}
+	if( xml_tree != NULL )
+	{
+		libfwevt_xml_tree_free(
+		 &xml_tree,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_tree_set_node_value and libfwevt_xml_tree_truncate functions
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_tree_truncate(
+     void )
+{
+	uint8_t name_data[ 4 ]        = { 'a', 0, 0, 0 };
+	uint8_t value_data[ 4 ]       = { 'b', 0, 0, 0 };
+	libcerror_error_t *error      = NULL;
+	libfwevt_xml_tag_t *xml_tag   = NULL;
+	libfwevt_xml_tree_t *xml_tree = NULL;
+	int node_index                = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = libfwevt_xml_tree_initialize(
+	          &xml_tree,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_tag_initialize(
+	          &xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_tag_set_name_data(
+	          xml_tag,
+	          name_data,
+	          4,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_tree_append_node(
+	          xml_tree,
+	          -1,
+	          (libfwevt_internal_xml_tag_t *) xml_tag,
+	          &node_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_tree_append_attribute(
+	          xml_tree,
+	          0,
+	          (libfwevt_internal_xml_tag_t *) xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_tree_append_node(
+	          xml_tree,
+	          0,
+	          (libfwevt_internal_xml_tag_t *) xml_tag,
+	          &node_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_tag_set_value_type(
+	          xml_tag,
+	          LIBFWEVT_VALUE_TYPE_STRING_UTF16,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_tag_set_value_data(
+	          xml_tag,
+	          value_data,
+	          4,
+	          0,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_tree_set_node_value(
+	          xml_tree,
+	          node_index,
+	          (libfwevt_internal_xml_tag_t *) xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "xml_tree->nodes[ node_index ].value",
+	 xml_tree->nodes[ node_index ].value );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "xml_tree->number_of_value_segments[ node_index ]",
+	 xml_tree->number_of_value_segments[ node_index ],
+	 1 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "xml_tree->values_data_size",
+	 xml_tree->values_data_size,
+	 (size_t) 4 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "xml_tag->value",
+	 ( (libfwevt_internal_xml_tag_t *) xml_tag )->value );
+
+	result = libfwevt_xml_tree_initialize_node_value(
+	          xml_tree,
+	          node_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "xml_tree->nodes[ node_index ].value",
+	 xml_tree->nodes[ node_index ].value );
+
+	result = libfwevt_xml_tree_truncate(
+	          xml_tree,
+	          node_index,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "xml_tree->number_of_nodes",
+	 xml_tree->number_of_nodes,
+	 2 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "xml_tree->names_data_size",
+	 xml_tree->names_data_size,
+	 (size_t) 8 );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "xml_tree->total_number_of_value_segments",
+	 xml_tree->total_number_of_value_segments,
+	 0 );
+
+	FWEVT_TEST_ASSERT_EQUAL_SIZE(
+	 "xml_tree->values_data_size",
+	 xml_tree->values_data_size,
+	 (size_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_tree_set_node_value(
+	          NULL,
+	          0,
+	          (libfwevt_internal_xml_tag_t *) xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_tree_set_node_value(
+	          xml_tree,
+	          2,
+	          (libfwevt_internal_xml_tag_t *) xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_tree_truncate(
+	          NULL,
+	          0,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_tree_truncate(
+	          xml_tree,
+	          3,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* An attribute cannot be removed without its element
+	 */
+	result = libfwevt_xml_tree_truncate(
+	          xml_tree,
+	          1,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libfwevt_internal_xml_tag_free(
+	          (libfwevt_internal_xml_tag_t **) &xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_tree_free(
+	          &xml_tree,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( xml_tag != NULL )
+	{
+		libfwevt_internal_xml_tag_free(
+		 (libfwevt_internal_xml_tag_t **) &xml_tag,
+		 NULL );
+	}
+	if( xml_tree != NULL )
+	{
+		libfwevt_xml_tree_free(
+		 &xml_tree,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_tree_get_root_xml_tag function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_tree_get_root_xml_tag(
+     libfwevt_xml_tree_t *xml_tree )
+{
+	libcerror_error_t *error         = NULL;
+	libfwevt_xml_tag_t *root_xml_tag = NULL;
+	int result                       = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_tree_get_root_xml_tag(
+	          xml_tree,
+	          &root_xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "root_xml_tag",
+	 root_xml_tag );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "root_xml_tag->node_index",
+	 ( (libfwevt_internal_xml_tag_t *) root_xml_tag )->node_index,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_tree_get_root_xml_tag(
+	          NULL,
+	          &root_xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_tree_get_root_xml_tag(
+	          xml_tree,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_tree_get_parent_xml_tag function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_tree_get_parent_xml_tag(
+     libfwevt_xml_tree_t *xml_tree )
+{
+	libcerror_error_t *error           = NULL;
+	libfwevt_xml_tag_t *parent_xml_tag = NULL;
+	int result                         = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_tree_get_parent_xml_tag(
+	          xml_tree,
+	          5,
+	          &parent_xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "parent_xml_tag",
+	 parent_xml_tag );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "parent_xml_tag->node_index",
+	 ( (libfwevt_internal_xml_tag_t *) parent_xml_tag )->node_index,
+	 1 );
+
+	result = libfwevt_xml_tree_get_parent_xml_tag(
+	          xml_tree,
+	          3,
+	          &parent_xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "parent_xml_tag",
+	 parent_xml_tag );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "parent_xml_tag->node_index",
+	 ( (libfwevt_internal_xml_tag_t *) parent_xml_tag )->node_index,
+	 1 );
+
+	result = libfwevt_xml_tree_get_parent_xml_tag(
+	          xml_tree,
+	          0,
+	          &parent_xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_tree_get_parent_xml_tag(
+	          NULL,
+	          5,
+	          &parent_xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_tree_get_parent_xml_tag(
+	          xml_tree,
+	          -1,
+	          &parent_xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_tree_get_parent_xml_tag(
+	          xml_tree,
+	          8,
+	          &parent_xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_tree_get_parent_xml_tag(
+	          xml_tree,
+	          5,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_tree_get_number_of_attributes function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_tree_get_number_of_attributes(
+     libfwevt_xml_tree_t *xml_tree )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_attributes = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_tree_get_number_of_attributes(
+	          xml_tree,
+	          1,
+	          &number_of_attributes,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_attributes",
+	 number_of_attributes,
+	 2 );
+
+	result = libfwevt_xml_tree_get_number_of_attributes(
+	          xml_tree,
+	          0,
+	          &number_of_attributes,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_attributes",
+	 number_of_attributes,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_tree_get_number_of_attributes(
+	          NULL,
+	          1,
+	          &number_of_attributes,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_tree_get_number_of_attributes(
+	          xml_tree,
+	          -1,
+	          &number_of_attributes,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_tree_get_number_of_attributes(
+	          xml_tree,
+	          1,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_tree_get_attribute_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_tree_get_attribute_by_index(
+     libfwevt_xml_tree_t *xml_tree )
+{
+	libcerror_error_t *error              = NULL;
+	libfwevt_xml_tag_t *attribute_xml_tag = NULL;
+	int result                            = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_tree_get_attribute_by_index(
+	          xml_tree,
+	          1,
+	          1,
+	          &attribute_xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "attribute_xml_tag",
+	 attribute_xml_tag );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "attribute_xml_tag->node_index",
+	 ( (libfwevt_internal_xml_tag_t *) attribute_xml_tag )->node_index,
+	 3 );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_tree_get_attribute_by_index(
+	          NULL,
+	          1,
+	          1,
+	          &attribute_xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_tree_get_attribute_by_index(
+	          xml_tree,
+	          -1,
+	          1,
+	          &attribute_xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_tree_get_attribute_by_index(
+	          xml_tree,
+	          1,
+	          2,
+	          &attribute_xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_tree_get_attribute_by_index(
+	          xml_tree,
+	          0,
+	          0,
+	          &attribute_xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_tree_get_attribute_by_index(
+	          xml_tree,
+	          1,
+	          1,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_tree_get_number_of_elements function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_tree_get_number_of_elements(
+     libfwevt_xml_tree_t *xml_tree )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_elements   = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_tree_get_number_of_elements(
+	          xml_tree,
+	          0,
+	          &number_of_elements,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_elements",
+	 number_of_elements,
+	 3 );
+
+	result = libfwevt_xml_tree_get_number_of_elements(
+	          xml_tree,
+	          7,
+	          &number_of_elements,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "number_of_elements",
+	 number_of_elements,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_tree_get_number_of_elements(
+	          NULL,
+	          0,
+	          &number_of_elements,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_tree_get_number_of_elements(
+	          xml_tree,
+	          8,
+	          &number_of_elements,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_tree_get_number_of_elements(
+	          xml_tree,
+	          0,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libfwevt_xml_tree_get_element_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int fwevt_test_xml_tree_get_element_by_index(
+     libfwevt_xml_tree_t *xml_tree )
+{
+	libcerror_error_t *error            = NULL;
+	libfwevt_xml_tag_t *element_xml_tag = NULL;
+	int result                          = 0;
+
+	/* Test regular cases
+	 */
+	result = libfwevt_xml_tree_get_element_by_index(
+	          xml_tree,
+	          0,
+	          0,
+	          &element_xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "element_xml_tag",
+	 element_xml_tag );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "element_xml_tag->node_index",
+	 ( (libfwevt_internal_xml_tag_t *) element_xml_tag )->node_index,
+	 1 );
+
+	result = libfwevt_xml_tree_get_element_by_index(
+	          xml_tree,
+	          0,
+	          2,
+	          &element_xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "element_xml_tag",
+	 element_xml_tag );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "element_xml_tag->node_index",
+	 ( (libfwevt_internal_xml_tag_t *) element_xml_tag )->node_index,
+	 7 );
+
+	result = libfwevt_xml_tree_get_element_by_index(
+	          xml_tree,
+	          1,
+	          1,
+	          &element_xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "element_xml_tag",
+	 element_xml_tag );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "element_xml_tag->node_index",
+	 ( (libfwevt_internal_xml_tag_t *) element_xml_tag )->node_index,
+	 5 );
+
+	/* Test error cases
+	 */
+	result = libfwevt_xml_tree_get_element_by_index(
+	          NULL,
+	          0,
+	          0,
+	          &element_xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_tree_get_element_by_index(
+	          xml_tree,
+	          -1,
+	          0,
+	          &element_xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_tree_get_element_by_index(
+	          xml_tree,
+	          0,
+	          3,
+	          &element_xml_tag,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libfwevt_xml_tree_get_element_by_index(
+	          xml_tree,
+	          0,
+	          0,
+	          NULL,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc FWEVT_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] FWEVT_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc FWEVT_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] FWEVT_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+	libcerror_error_t *error              = NULL;
+	libfwevt_xml_document_t *xml_document = NULL;
+	libfwevt_xml_tree_t *xml_tree         = NULL;
+	int result                            = 0;
+#endif
+
+	FWEVT_TEST_UNREFERENCED_PARAMETER( argc )
+	FWEVT_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_xml_tree_initialize",
+	 fwevt_test_xml_tree_initialize );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_xml_tree_free",
+	 fwevt_test_xml_tree_free );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_xml_tree_append_node",
+	 fwevt_test_xml_tree_append_node );
+
+	FWEVT_TEST_RUN(
+	 "libfwevt_xml_tree_truncate",
+	 fwevt_test_xml_tree_truncate );
+
+#if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
+
+	/* Initialize xml_tree for tests
+	 * The XML tree is read by the binary XML document
+	 */
+	result = libfwevt_xml_document_initialize(
+	          &xml_document,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libfwevt_xml_document_read(
+	          xml_document,
+	          fwevt_test_xml_tree_data1,
+	          288,
+	          0,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          LIBFWEVT_XML_DOCUMENT_READ_FLAG_HAS_DATA_OFFSETS | LIBFWEVT_XML_DOCUMENT_READ_FLAG_FLAT_TREE,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	xml_tree = ( (libfwevt_internal_xml_document_t *) xml_document )->tree;
+
+	FWEVT_TEST_ASSERT_IS_NOT_NULL(
+	 "xml_tree",
+	 xml_tree );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "xml_tree->number_of_nodes",
+	 xml_tree->number_of_nodes,
+	 8 );
+
+	FWEVT_TEST_RUN_WITH_ARGS(
+	 "libfwevt_xml_tree_get_root_xml_tag",
+	 fwevt_test_xml_tree_get_root_xml_tag,
+	 xml_tree );
+
+	FWEVT_TEST_RUN_WITH_ARGS(
+	 "libfwevt_xml_tree_get_parent_xml_tag",
+	 fwevt_test_xml_tree_get_parent_xml_tag,
+	 xml_tree );
+
+	FWEVT_TEST_RUN_WITH_ARGS(
+	 "libfwevt_xml_tree_get_number_of_attributes",
+	 fwevt_test_xml_tree_get_number_of_attributes,
+	 xml_tree );
+
+	FWEVT_TEST_RUN_WITH_ARGS(
+	 "libfwevt_xml_tree_get_attribute_by_index",
+	 fwevt_test_xml_tree_get_attribute_by_index,
+	 xml_tree );
+
+	FWEVT_TEST_RUN_WITH_ARGS(
+	 "libfwevt_xml_tree_get_number_of_elements",
+	 fwevt_test_xml_tree_get_number_of_elements,
+	 xml_tree );
+
+	FWEVT_TEST_RUN_WITH_ARGS(
+	 "libfwevt_xml_tree_get_element_by_index",
+	 fwevt_test_xml_tree_get_element_by_index,
+	 xml_tree );
+
+	/* Clean up
+	 */
+	xml_tree = NULL;
+
+	result = libfwevt_xml_document_free(
+	          &xml_document,
+	          &error );
+
+	FWEVT_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	FWEVT_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#endif /* !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT )
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( xml_document != NULL )
+	{
+		libfwevt_xml_document_free(
+		 &xml_document,
+		 NULL );
+	}
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBFWEVT_DLL_IMPORT ) */
+}
+
@@ -953,6 +953,8 @@ int main(
 
 	/* TODO: add tests for libfwevt_internal_xml_value_free */
 
+	/* TODO: add tests for libfwevt_internal_xml_value_empty */
+
 	/* TODO: add tests for libfwevt_xml_value_append_data_segment */
 
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
@@ -981,6 +983,7 @@ int main(
 	          xml_value,
 	          (uint8_t *) "data",
 	          4,
+	          0,
 	          &data_segment_index,
 	          &error );
 
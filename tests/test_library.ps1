@@ -1,6 +1,6 @@
 # Tests library functions and types.
 
-$LibraryTests = "channel data_segment date_time error event floating_point integer keyword level manifest map notify opcode provider support task template xml_document xml_tag xml_template_value xml_token xml_value"
+$LibraryTests = "arena array catalog channel data_segment date_time error event floating_point guid_index integer keyword level manifest manifest_archive map notify opcode output_buffer provider sorted_index support task template xml_cursor xml_document xml_name_table xml_path_filter xml_string xml_tag xml_template_cache xml_template_program xml_template_value xml_token xml_tree xml_value"
 $LibraryTestsWithInput = ""
 $OptionSets = "" -split " "
 